@@ -0,0 +1,200 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the BenchmarkFieldStore class.
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_FIELD_STORE_INCLUDE_H
+#define CUPCFD_BENCHMARK_BENCHMARK_FIELD_STORE_INCLUDE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include "EuclideanVector.h"
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		/**
+		 * The mesh entities that a benchmark field holds a value for
+		 */
+		enum BenchmarkFieldLocation
+		{
+			FIELD_CELL,
+			FIELD_FACE,
+			FIELD_BOUNDARY,
+			FIELD_REGION
+		};
+
+		/**
+		 * A persistent store of the named field arrays (cell, face, boundary and region data) that the
+		 * kernel benchmarks read and write, so that they are allocated once rather than by every kernel
+		 * on every repetition.
+		 *
+		 * Each field is allocated when it is added, with cupcfd::utility::drivers::allocateAligned, so it is
+		 * aligned and its pages are first touched in parallel with the static schedule used by the kernels.
+		 * Fields are allocated separately rather than carved from one block, since a single block would be
+		 * first touched as a whole rather than field by field.
+		 *
+		 * The fields are filled with random values by initialise, which can be called (and timed) separately
+		 * from the kernels that use them.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The type of the field data
+		 */
+		template <class I, class T>
+		class BenchmarkFieldStore
+		{
+			public:
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Create an empty store for a mesh with the given numbers of entities
+				 *
+				 * @param nCells The number of cells (including ghost cells)
+				 * @param nFaces The number of faces
+				 * @param nBoundaries The number of boundaries
+				 * @param nRegions The number of regions
+				 */
+				BenchmarkFieldStore(I nCells, I nFaces, I nBoundaries, I nRegions);
+
+				/**
+				 * Deconstructor. Releases all of the fields.
+				 */
+				~BenchmarkFieldStore();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Add a field of type T values
+				 *
+				 * @param name The name of the field. Names only need to be unique for a location.
+				 * @param location The entities the field holds values for
+				 * @param nComponents The number of values per entity
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The field was added
+				 * @retval cupcfd::error::E_ERROR A field with this name already exists at this location,
+				 * or the field could not be allocated
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes addScalarField(std::string name, BenchmarkFieldLocation location, I nComponents = 1);
+
+				/**
+				 * Add a field of 3D vectors
+				 *
+				 * @param name The name of the field. Names only need to be unique for a location.
+				 * @param location The entities the field holds values for
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The field was added
+				 * @retval cupcfd::error::E_ERROR A field with this name already exists at this location,
+				 * or the field could not be allocated
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes addVectorField(std::string name, BenchmarkFieldLocation location);
+
+				/**
+				 * Get the data of a field added with addScalarField
+				 *
+				 * @param name The name of the field
+				 * @param location The location of the field
+				 * @param data A pointer to the location where the address of the field data will be stored
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The field was found
+				 * @retval cupcfd::error::E_SEARCH_NOT_FOUND There is no scalar field with this name at this location
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getScalarField(std::string name, BenchmarkFieldLocation location, T ** data);
+
+				/**
+				 * Get the data of a field added with addVectorField
+				 *
+				 * @param name The name of the field
+				 * @param location The location of the field
+				 * @param data A pointer to the location where the address of the field data will be stored
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The field was found
+				 * @retval cupcfd::error::E_SEARCH_NOT_FOUND There is no vector field with this name at this location
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getVectorField(std::string name, BenchmarkFieldLocation location,
+													 cupcfd::geometry::euclidean::EuclideanVector<T,3> ** data);
+
+				/**
+				 * Fill every value of every field (including each vector component) with uniformly
+				 * distributed random values
+				 *
+				 * @param lower The lower bound of the values
+				 * @param upper The upper bound of the values
+				 */
+				void initialise(T lower, T upper);
+
+				/**
+				 * @return The number of entities of a location
+				 */
+				I getNEntities(BenchmarkFieldLocation location);
+
+				/**
+				 * @return The number of fields in the store
+				 */
+				I getNFields();
+
+				/**
+				 * @return The total size of the field data in bytes
+				 */
+				std::size_t getNBytes();
+
+			private:
+				/**
+				 * A stored field
+				 */
+				struct Field
+				{
+					/** The name of the field **/
+					std::string name;
+
+					/** The entities the field holds values for **/
+					BenchmarkFieldLocation location;
+
+					/** Whether the field holds EuclideanVector<T,3> (true) or T (false) values **/
+					bool isVector;
+
+					/** The number of elements of the field **/
+					std::size_t nEle;
+
+					/** The field data **/
+					void * data;
+				};
+
+				/** The number of entities of each location, indexed by BenchmarkFieldLocation **/
+				I nEntities[4];
+
+				/** The fields, in the order they were added **/
+				std::vector<Field> fields;
+
+				/**
+				 * Find a field
+				 *
+				 * @return The index of the field in fields, or -1 if there is no such field
+				 */
+				int findField(const std::string& name, BenchmarkFieldLocation location, bool isVector);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "BenchmarkFieldStore.ipp"
+
+#endif
@@ -0,0 +1,25 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the header level definitions for the BenchmarkFieldStore class.
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_FIELD_STORE_IPP_H
+#define CUPCFD_BENCHMARK_BENCHMARK_FIELD_STORE_IPP_H
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		// Currently includes nothing here.
+		// Left as a placeholder.
+	}
+}
+
+#endif
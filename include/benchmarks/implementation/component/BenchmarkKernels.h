@@ -17,6 +17,7 @@
 #include <memory>
 #include "UnstructuredMeshInterface.h"
 #include "EuclideanVector.h"
+#include "BenchmarkFieldStore.h"
 
 namespace cupcfd
 {
@@ -28,7 +29,10 @@ namespace cupcfd
 		 * This benchmark will benchmark the duration of running various
 		 * different kernels for a given mesh.
 		 *
-		 * Any required stateful data is generated.
+		 * Any required stateful data is generated. The field arrays used by the kernels are
+		 * held in a BenchmarkFieldStore that is created by setupBenchmark and reused by every
+		 * kernel and repetition. The fields are refilled with random values at the start of each
+		 * repetition, which is timed as a separate block from the kernels.
 		 */
 		template <class M, class I, class T, class L>
 		class BenchmarkKernels : public Benchmark<I,T>
@@ -38,6 +42,9 @@ namespace cupcfd
 
 				std::shared_ptr<cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>> meshPtr;
 
+				/** The field arrays used by the kernels. nullptr until setupBenchmark is called. **/
+				BenchmarkFieldStore<I,T> * fields;
+
 				// === Constructors/Deconstructors ===
 
 				/**
@@ -102,8 +109,21 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes calculateViscosityDolfynCellLoop2Benchmark();
 
+				/**
+				 * Benchmark the fused residual kernel r = b - Ax with its global norm, on the cell matrix
+				 * built from the mesh faces. A STREAM-style triad over arrays of the same total size as
+				 * the residual traffic is timed alongside it, and the achieved bandwidth of both is recorded
+				 * along with their ratio.
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes ResidualCSRBenchmark();
+
 				// === Overridden Inherited Methods ===
 
+				/**
+				 * Create the field store sized for the mesh and add all of the fields used by the kernels,
+				 * if it has not already been created. The store is left as nullptr if this fails.
+				 */
 				void setupBenchmark();
 
 				void recordParameters();
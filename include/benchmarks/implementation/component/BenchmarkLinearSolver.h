@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "SparseMatrix.h"
+#include "DistributedSparseMatrix.h"
 #include "LinearSolverInterface.h"
 
 namespace cupcfd
@@ -36,7 +37,7 @@ namespace cupcfd
 			public:
 				// === Members ===
 
-				/** Shared Pointer to the Matrix to use for solving during the benchmark **/
+				/** Shared Pointer to the Matrix to use for solving during the benchmark (nullptr if distributed) **/
 				std::shared_ptr<cupcfd::data_structures::SparseMatrix<C,I,T>> matrixPtr;
 
 				/**
@@ -55,6 +56,12 @@ namespace cupcfd
 				 **/
 				std::shared_ptr<std::vector<T>> solVectorPtr;
 
+				/**
+				 * Shared Pointer to the Distributed Matrix the solver system was built from, if any.
+				 * Held here so it remains valid for the lifetime of the solver system.
+				 **/
+				std::shared_ptr<cupcfd::data_structures::DistributedSparseMatrix<I,T>> distributedMatrixPtr;
+
 				/** Shared Pointer to the Linear Solver System to use for solving **/
 				std::shared_ptr<cupcfd::linearsolvers::LinearSolverInterface<C,I,T>> solverSystemPtr;
 
@@ -70,6 +77,18 @@ namespace cupcfd
 									  std::shared_ptr<std::vector<T>> solVectorPtr,
 									  std::shared_ptr<cupcfd::linearsolvers::LinearSolverInterface<C,I,T>> solverSystemPtr);
 
+				/**
+				 * Constructor:
+				 * For a solver system built from a distributed matrix, which must outlive the solver system.
+				 * The matrix values are set from the rows owned by this rank, so no global matrix is held,
+				 * and the vector values are for the owned rows in order.
+				 */
+				BenchmarkLinearSolver(std::string benchmarkName, I repetitions,
+									  std::shared_ptr<std::vector<T>> rhsVectorPtr,
+									  std::shared_ptr<std::vector<T>> solVectorPtr,
+									  std::shared_ptr<cupcfd::data_structures::DistributedSparseMatrix<I,T>> distributedMatrixPtr,
+									  std::shared_ptr<cupcfd::linearsolvers::LinearSolverInterface<C,I,T>> solverSystemPtr);
+
 				/**
 				 *
 				 */
@@ -0,0 +1,88 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the BenchmarkMatrixAssembly class.
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_MATRIX_ASSEMBLY_INCLUDE_H
+#define CUPCFD_BENCHMARK_BENCHMARK_MATRIX_ASSEMBLY_INCLUDE_H
+
+#include "Benchmark.h"
+
+#include <memory>
+#include <vector>
+
+#include "UnstructuredMeshInterface.h"
+#include "SparseMatrixCSR.h"
+#include "FaceMatrixAssembler.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		/**
+		 * Benchmarks the assembly of a cell-centred matrix from per-face coefficients
+		 * for a given mesh.
+		 *
+		 * Three blocks are timed:
+		 * MatrixAssemblySymbolic - The one-off build of the pattern, slot map and face colouring
+		 * MatrixAssemblyNumeric - Repeated scatter of the face coefficients via the slot map
+		 * MatrixAssemblySetElement - The same assembly performed with getElement/setElement for each
+		 * entry, as a baseline for the search cost removed by the slot map
+		 *
+		 * The face coefficients are generated with random values.
+		 *
+		 * @tparam M The implementing class of the UnstructuredMeshInterface
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The datatype of the matrix
+		 * @tparam L The label datatype of the unstructured mesh
+		 */
+		template <class M, class I, class T, class L>
+		class BenchmarkMatrixAssembly : public Benchmark<I,T>
+		{
+			public:
+				// === Members ===
+
+				/** The mesh to assemble the matrix for **/
+				std::shared_ptr<cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>> meshPtr;
+
+				/** Face coefficients, two per face **/
+				std::vector<T> rface;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Constructor
+				 *
+				 * @param benchmarkName The name of the benchmark, used for the top-level timer block
+				 * @param meshPtr The mesh to assemble the matrix for
+				 * @param repetitions The number of numeric assemblies to time
+				 */
+				BenchmarkMatrixAssembly(std::string benchmarkName,
+										std::shared_ptr<cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>> meshPtr,
+										I repetitions);
+
+				/**
+				 *
+				 */
+				~BenchmarkMatrixAssembly();
+
+				// === Inherited Overridden Methods ===
+				void setupBenchmark();
+				void recordParameters();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes runBenchmark();
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "BenchmarkMatrixAssembly.ipp"
+
+#endif
@@ -0,0 +1,117 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the BenchmarkSpMV class.
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_SPMV_INCLUDE_H
+#define CUPCFD_BENCHMARK_BENCHMARK_SPMV_INCLUDE_H
+
+#include "Benchmark.h"
+
+#include <memory>
+#include <vector>
+
+#include "SparseMatrixCOO.h"
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixSELL.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		/** Chunk height used for the SELL-C-sigma matrix in the SpMV benchmark **/
+		const int BENCH_SPMV_SELL_C = 8;
+
+		/** Sorting window used for the SELL-C-sigma matrix in the SpMV benchmark **/
+		const int BENCH_SPMV_SELL_SIGMA = 256;
+
+		/**
+		 * Benchmarks the sparse matrix-vector product y = Ax for the same matrix stored
+		 * in the CSR, SELL-C-sigma and COO formats.
+		 *
+		 * Each format is timed in its own block, and the achieved GFLOP/s and GB/s are
+		 * recorded as parameters of that block. The FLOP count is 2 * nnz per product. The byte
+		 * count is the minimum traffic for the format - every stored entry (including padding)
+		 * and index array is read once, x is read once and y is written once.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The datatype of the matrix
+		 */
+		template <class I, class T>
+		class BenchmarkSpMV : public Benchmark<I,T>
+		{
+			public:
+				// === Members ===
+
+				/** The matrix in CSR format **/
+				std::shared_ptr<cupcfd::data_structures::SparseMatrixCSR<I,T>> csrPtr;
+
+				/** The matrix in COO format **/
+				std::shared_ptr<cupcfd::data_structures::SparseMatrixCOO<I,T>> cooPtr;
+
+				/** The matrix in SELL-C-sigma format **/
+				std::shared_ptr<cupcfd::data_structures::SparseMatrixSELL<I,T,BENCH_SPMV_SELL_C,BENCH_SPMV_SELL_SIGMA>> sellPtr;
+
+				/** Vector to multiply by **/
+				std::vector<T> x;
+
+				/** Result Vector **/
+				std::vector<T> y;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Constructor:
+				 * All three matrices are expected to hold the same values.
+				 *
+				 * @param benchmarkName The name of the benchmark, used for the top-level timer block
+				 * @param repetitions The number of products to compute per format
+				 * @param csrPtr The matrix in CSR format
+				 * @param cooPtr The matrix in COO format
+				 * @param sellPtr The matrix in SELL-C-sigma format
+				 */
+				BenchmarkSpMV(std::string benchmarkName, I repetitions,
+							  std::shared_ptr<cupcfd::data_structures::SparseMatrixCSR<I,T>> csrPtr,
+							  std::shared_ptr<cupcfd::data_structures::SparseMatrixCOO<I,T>> cooPtr,
+							  std::shared_ptr<cupcfd::data_structures::SparseMatrixSELL<I,T,BENCH_SPMV_SELL_C,BENCH_SPMV_SELL_SIGMA>> sellPtr);
+
+				/**
+				 *
+				 */
+				~BenchmarkSpMV();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Record the achieved throughput of a timed block as parameters of the current block
+				 *
+				 * @param seconds The elapsed time for all repetitions
+				 * @param bytes The number of bytes moved by a single product
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The datatype of the matrix
+				 *
+				 * @return Nothing
+				 */
+				void recordThroughput(double seconds, double bytes);
+
+				// === Inherited Overridden Methods ===
+				void setupBenchmark();
+				void recordParameters();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes runBenchmark();
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "BenchmarkSpMV.ipp"
+
+#endif
@@ -0,0 +1,24 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Header level definitions for the BenchmarkSpMV class.
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_SPMV_IPP_H
+#define CUPCFD_BENCHMARK_BENCHMARK_SPMV_IPP_H
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+
+	}
+}
+
+#endif
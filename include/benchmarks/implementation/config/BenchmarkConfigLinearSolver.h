@@ -19,6 +19,8 @@
 #include "LinearSolverConfig.h"
 #include "BenchmarkLinearSolver.h"
 #include "VectorSourceConfig.h"
+#include "SparseMatrixSource.h"
+#include "UnstructuredMeshInterface.h"
 
 namespace cupcfd
 {
@@ -83,6 +85,40 @@ namespace cupcfd
 
 				// === Concrete Methods ===
 
+				/**
+				 * Build the benchmark for a matrix generated from a mesh.
+				 * If the matrix source is not generated from a mesh, this is the same as buildBenchmark(bench).
+				 *
+				 * When distributed, each rank holds the rows of the cells it owns in the mesh. When
+				 * concurrent, every rank must own the whole mesh (i.e. a single rank).
+				 *
+				 * @param bench A pointer to the location where the pointer of the new benchmark will be stored
+				 * @param mesh The finalized mesh to generate the matrix from
+				 *
+				 * @tparam M The implementing class of the UnstructuredMeshInterface
+				 * @tparam L The label datatype of the unstructured mesh
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The benchmark was built successfully
+				 */
+				template <class M, class L>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildBenchmark(BenchmarkLinearSolver<C,I,T> ** bench,
+													 cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh);
+
+				/**
+				 * Build the benchmark from a matrix source that has already been built.
+				 *
+				 * @param bench A pointer to the location where the pointer of the new benchmark will be stored
+				 * @param matrixSource The source of the matrix rows. Ownership is not taken.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The benchmark was built successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildBenchmarkFromSource(BenchmarkLinearSolver<C,I,T> ** bench,
+															   cupcfd::data_structures::SparseMatrixSource<I,T> * matrixSource);
+
 				// === Overloaded Inherited Methods ===
 
 				void operator=(const BenchmarkConfigLinearSolver<C,I,T>& source);
@@ -13,12 +13,36 @@
 #ifndef CUPCFD_BENCHMARK_BENCHMARK_CONFIG_LINEAR_SOLVERS_IPP_H
 #define CUPCFD_BENCHMARK_BENCHMARK_CONFIG_LINEAR_SOLVERS_IPP_H
 
+#include "SparseMatrixSourceMeshGenConfig.h"
+
 namespace cupcfd
 {
 	namespace benchmark
 	{
-		// Currently nothing included here.
-		// Left as a placeholder.
+		template <class C, class I, class T>
+		template <class M, class L>
+		cupcfd::error::eCodes BenchmarkConfigLinearSolver<C,I,T>::buildBenchmark(BenchmarkLinearSolver<C,I,T> ** bench,
+																				 cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh) {
+			cupcfd::error::eCodes status;
+			cupcfd::data_structures::SparseMatrixSource<I,T> * matrixSource;
+
+			cupcfd::data_structures::SparseMatrixSourceMeshGenConfig<I,T> * meshGenConfig =
+				dynamic_cast<cupcfd::data_structures::SparseMatrixSourceMeshGenConfig<I,T> *>(this->matrixSourceConfig);
+
+			// Sources that do not need the mesh
+			if(meshGenConfig == nullptr) {
+				return this->buildBenchmark(bench);
+			}
+
+			// Generate the rows of the locally owned cells
+			status = meshGenConfig->buildSparseMatrixSource(mesh, &matrixSource);
+			CHECK_ECODE(status)
+
+			status = this->buildBenchmarkFromSource(bench, matrixSource);
+			delete matrixSource;
+
+			return status;
+		}
 	}
 }
 
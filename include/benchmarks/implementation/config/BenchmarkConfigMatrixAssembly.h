@@ -0,0 +1,81 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the BenchmarkConfigMatrixAssembly class
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_CONFIG_MATRIX_ASSEMBLY_INCLUDE_H
+#define CUPCFD_BENCHMARK_BENCHMARK_CONFIG_MATRIX_ASSEMBLY_INCLUDE_H
+
+#include "Benchmark.h"
+#include "BenchmarkConfig.h"
+
+#include <memory>
+#include "UnstructuredMeshInterface.h"
+#include "BenchmarkMatrixAssembly.h"
+#include "CupCfdAoSMesh.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		/**
+		 * Configuration for a BenchmarkMatrixAssembly benchmark.
+		 * The mesh is provided when the benchmark is built.
+		 */
+		template <class I, class T>
+		class BenchmarkConfigMatrixAssembly
+		{
+			public:
+				// === Members ===
+
+				/** Benchmark Name **/
+				std::string benchmarkName;
+
+				/** Number of repetitions per benchmark time/run **/
+				I repetitions;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 *
+				 */
+				BenchmarkConfigMatrixAssembly(const std::string benchmarkName, const I repetitions);
+
+				/**
+				 *
+				 */
+				BenchmarkConfigMatrixAssembly(const BenchmarkConfigMatrixAssembly<I,T>& source);
+
+				/**
+				 *
+				 */
+				~BenchmarkConfigMatrixAssembly();
+
+				// === Concrete Methods ===
+
+				// === Overloaded Inherited Methods ===
+
+				void operator=(const BenchmarkConfigMatrixAssembly<I,T>& source);
+				
+				__attribute__((warn_unused_result))
+				BenchmarkConfigMatrixAssembly<I,T> * clone();
+
+				template <class M, class L>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildBenchmark(BenchmarkMatrixAssembly<M,I,T,L> ** bench,
+													std::shared_ptr<M> meshPtr);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "BenchmarkConfigMatrixAssembly.ipp"
+
+#endif
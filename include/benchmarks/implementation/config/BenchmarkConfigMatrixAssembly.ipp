@@ -0,0 +1,32 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the BenchmarkConfigMatrixAssembly class
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_CONFIG_MATRIX_ASSEMBLY_IPP_H
+#define CUPCFD_BENCHMARK_BENCHMARK_CONFIG_MATRIX_ASSEMBLY_IPP_H
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		template <class I, class T>
+		template <class M, class L>
+		cupcfd::error::eCodes BenchmarkConfigMatrixAssembly<I,T>::buildBenchmark(BenchmarkMatrixAssembly<M,I,T,L> ** bench,
+												  std::shared_ptr<M> meshPtr)
+		{
+			*bench = new BenchmarkMatrixAssembly<M,I,T,L>(this->benchmarkName, meshPtr, this->repetitions);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,83 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the BenchmarkConfigSpMV class
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_CONFIG_SPMV_INCLUDE_H
+#define CUPCFD_BENCHMARK_BENCHMARK_CONFIG_SPMV_INCLUDE_H
+
+#include "Benchmark.h"
+#include "SparseMatrixSourceConfig.h"
+#include "BenchmarkSpMV.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		/**
+		 * Configuration for a BenchmarkSpMV benchmark.
+		 *
+		 * Every rank loads a full copy of the matrix and runs the products independently.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The datatype of the matrix
+		 */
+		template <class I, class T>
+		class BenchmarkConfigSpMV
+		{
+			public:
+				// === Members ===
+
+				/** Benchmark Name **/
+				std::string benchmarkName;
+
+				/** Number of repetitions per benchmark time/run **/
+				I repetitions;
+
+				/** Configuration detailing where to find a data source for a Matrix **/
+				cupcfd::data_structures::SparseMatrixSourceConfig<I,T> * matrixSourceConfig;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 *
+				 */
+				BenchmarkConfigSpMV(std::string benchmarkName, I repetitions,
+									cupcfd::data_structures::SparseMatrixSourceConfig<I,T>& matrixSourceConfig);
+
+				/**
+				 *
+				 */
+				BenchmarkConfigSpMV(const BenchmarkConfigSpMV<I,T>& source);
+
+				/**
+				 *
+				 */
+				~BenchmarkConfigSpMV();
+
+				// === Concrete Methods ===
+
+				// === Overloaded Inherited Methods ===
+
+				void operator=(const BenchmarkConfigSpMV<I,T>& source);
+
+				__attribute__((warn_unused_result))
+				BenchmarkConfigSpMV<I,T> * clone();
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildBenchmark(BenchmarkSpMV<I,T> ** bench);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "BenchmarkConfigSpMV.ipp"
+
+#endif
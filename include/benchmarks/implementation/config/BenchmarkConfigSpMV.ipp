@@ -0,0 +1,25 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the BenchmarkConfigSpMV class
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_CONFIG_SPMV_IPP_H
+#define CUPCFD_BENCHMARK_BENCHMARK_CONFIG_SPMV_IPP_H
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		// Currently nothing included here.
+		// Left as a placeholder.
+	}
+}
+
+#endif
@@ -0,0 +1,24 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Header Level Definitions for the BenchmarkConfigMatrixAssemblyJSON class.
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_CONFIG_MATRIX_ASSEMBLY_JSON_IPP_H
+#define CUPCFD_BENCHMARK_BENCHMARK_CONFIG_MATRIX_ASSEMBLY_JSON_IPP_H
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		// Nothing included here for now
+	}
+}
+
+#endif
@@ -0,0 +1,122 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Declaration for the BenchmarkConfigSpMVJSON class.
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_CONFIG_SPMV_JSON_INCLUDE_H
+#define CUPCFD_BENCHMARK_BENCHMARK_CONFIG_SPMV_JSON_INCLUDE_H
+
+// C++ Std Lib
+#include <string>
+
+// Error Codes
+#include "Error.h"
+
+#include "BenchmarkConfigSpMV.h"
+
+#include "SparseMatrixSourceConfig.h"
+
+// JsonCPP - Supplied as standalone in include/io/jsoncpp
+#include "json.h"
+#include "json-forwards.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		/**
+		 * Defines a interface for accessing SpMV Benchmark configuration options from a JSON data source.
+		 *
+		 * === Fields ===
+		 *
+		 * Required:
+		 * BenchmarkName: String. Defines the benchmark name - also used for the overall benchmark timer identifier so
+		 * should be unique amongst benchmarks
+		 *
+		 * Repetitions: Integer. Defines the number of products to compute for each matrix format
+		 *
+		 * SparseMatrix: Contains a JSON record for a SparseMatrix source to use for benchmarking.
+		 * Accepted record field names:
+		 * "SparseMatrixFile" - Field name for a record that contains all fields needed to defines a
+		 * SparseMatrixSourceFileConfigJSON record (See SparseMatrixSourceFileConfigJSON.h)
+		 *
+		 * Optional Fields:
+		 * None
+		 *
+		 * Example JSON entry:
+		 *
+		 * {
+		 * "BenchmarkName" : "SpMVTest",
+		 * "Repetitions"	: 100,
+		 * "SparseMatrix"  : {
+		 *	 	"SparseMatrixFile" : {
+		 *			"FilePath" : "../Path/To/File/file.h5",
+		 *			"FileFormat" : "HDF5"
+		 *	 	}
+		 *	}
+		 * }
+		 *
+		 */
+		template <class I, class T>
+		class BenchmarkConfigSpMVJSON
+		{
+			public:
+				// === Members ===
+
+				/** Json Data Store containing fields for this JSON source **/
+				Json::Value configData;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Parse the JSON record provided for values belonging to a SpMV benchmark entry
+				 *
+				 * @param parseJSON The contents of a JSON record with the appropriate fields
+				 */
+				BenchmarkConfigSpMVJSON(Json::Value& parseJSON);
+
+				/**
+				 * Deconstructor
+				 */
+				~BenchmarkConfigSpMVJSON();
+
+				// === Concrete Methods ===
+
+				/**
+				 *
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getBenchmarkName(std::string& benchmarkName);
+
+				/**
+				 *
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getBenchmarkRepetitions(I * repetitions);
+
+				/**
+				 *
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getSparseMatrixSourceConfig(cupcfd::data_structures::SparseMatrixSourceConfig<I,T> ** matrixSourceConfig);
+
+				/**
+				 *
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildBenchmarkConfig(BenchmarkConfigSpMV<I,T> ** config);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "BenchmarkConfigSpMVJSON.ipp"
+
+#endif
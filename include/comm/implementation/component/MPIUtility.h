@@ -57,6 +57,15 @@ namespace cupcfd
 			 */
 			cupcfd::error::eCodes getMPIType(long dummy __attribute__((unused)), MPI_Datatype * mpiType);
 
+			/**
+			 * Gets the MPI Datatype for long longs.
+			 * Together with the long variant, this covers int64_t whichever of the two it is defined as.
+			 *
+			 * @param dummy A dummy variable. Value does not matter, it merely informs the type for specialised methods.
+			 * @param mpiType A pointer to where the retrieved MPI_Datatype will be stored.
+			 */
+			cupcfd::error::eCodes getMPIType(long long dummy __attribute__((unused)), MPI_Datatype * mpiType);
+
 			/**
 			 * Gets the MPI Datatype for booleans.
 			 *
@@ -133,6 +133,27 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes buildExchangePattern(ExchangePattern<T>** pattern, cupcfd::data_structures::DistributedAdjacencyList<I, N>& graph);
 
+				/**
+				 * Builds an ExchangePattern object as above, but only exchanging the ghost cells within the first
+				 * depth ghost layers of the graph. Deeper ghost layers are left unchanged by exchanges using the pattern.
+				 *
+				 * @param pattern A pointer to where the pointer for the newly created ExchangePattern will be stored.
+				 * @param graph The distributed graph to source the connectivity data from for ghost data.
+				 * @param depth The number of ghost layers to exchange. Values above the number of layers in the graph
+				 * exchange every layer.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the data to be exchanged.
+				 * @tparam N The type of the nodes in the graph
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_INVALID_INDEX The depth is less than 1
+				 */
+				template <class I, class T, class N>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildExchangePattern(ExchangePattern<T>** pattern, cupcfd::data_structures::DistributedAdjacencyList<I, N>& graph, I depth);
+
 				// === Pure Virtual Methods ===
 		};
 	}
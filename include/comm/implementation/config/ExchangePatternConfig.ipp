@@ -41,8 +41,19 @@ namespace cupcfd
 		template <class I, class T, class N>
 		cupcfd::error::eCodes ExchangePatternConfig::buildExchangePattern(ExchangePattern<T> ** pattern, 
 																			cupcfd::data_structures::DistributedAdjacencyList<I, N>& graph) {
+			return this->buildExchangePattern(pattern, graph, graph.nGhostLayers);
+		}
+
+		template <class I, class T, class N>
+		cupcfd::error::eCodes ExchangePatternConfig::buildExchangePattern(ExchangePattern<T> ** pattern,
+																			cupcfd::data_structures::DistributedAdjacencyList<I, N>& graph,
+																			I depth) {
 			cupcfd::error::eCodes status;
 
+			if(depth < 1) {
+				return cupcfd::error::E_INVALID_INDEX;
+			}
+
 			// Create a pattern of an appropriate type.
 			ExchangeMethod method = this->getExchangeMethod();
 
@@ -81,24 +92,32 @@ namespace cupcfd
 			// May wish to move that data/computation out to this drivers, since it is only needed for
 			// exchange patterns, so it could be wrapped into an exchange pattern object in graph instead.
 
-			I nTRanks = graph.sendGlobalIDsAdjncy.size();
-			I * tRanks = (I *) malloc(sizeof(I) * nTRanks);
+			// Only the nodes that lie within the requested depth on the receiving rank are sent
+			// (the receiving side of the pattern is derived from the sends)
+			I nSendGlobalIDs = cupcfd::utility::drivers::safeConvertSizeT<I>(graph.sendGlobalIDsAdjncy.size());
+			I * sendGIDs = (I *) malloc(sizeof(I) * nSendGlobalIDs);
+			I * tRanks = (I *) malloc(sizeof(I) * nSendGlobalIDs);
+			I nTRanks = 0;
 
 			I numSendGlobalIDsXAdj = cupcfd::utility::drivers::safeConvertSizeT<I>(graph.sendGlobalIDsXAdj.size());
 			for (I i = 0; i < numSendGlobalIDsXAdj-1; i++) {
-				for(I j = 0; j < graph.sendGlobalIDsXAdj[i+1] - graph.sendGlobalIDsXAdj[i]; j++) {
-					tRanks[graph.sendGlobalIDsXAdj[i] + j] = graph.sendRank[i];
+				for(I j = graph.sendGlobalIDsXAdj[i]; j < graph.sendGlobalIDsXAdj[i+1]; j++) {
+					if(graph.sendLayerAdjncy[j] <= depth) {
+						sendGIDs[nTRanks] = graph.sendGlobalIDsAdjncy[j];
+						tRanks[nTRanks] = graph.sendRank[i];
+						nTRanks = nTRanks + 1;
+					}
 				}
 			}
 
-
 			status = (*pattern)->init(*(graph.comm),
 								mapLocalToExchangeIDX, nMapLocalToExchangeIDX,
-								&(graph.sendGlobalIDsAdjncy[0]), graph.sendGlobalIDsAdjncy.size(),
+								sendGIDs, nTRanks,
 								tRanks, nTRanks);
 			CHECK_ECODE(status)
 
 			free(mapLocalToExchangeIDX);
+			free(sendGIDs);
 			free(tRanks);
 
 			return cupcfd::error::E_SUCCESS;
@@ -63,6 +63,11 @@ namespace cupcfd
 			// Allocate the space
 			*bRecv = (T *) malloc(sizeof(T) * *nBRecv);
 
+			// Every rank now knows the element count, so an empty broadcast can be skipped by all of them
+			if(*nBRecv == 0) {
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			status = Broadcast(bSend, nBSend, *bRecv, *nBRecv, sourcePID, myComm);
 			CHECK_ECODE(status)
 
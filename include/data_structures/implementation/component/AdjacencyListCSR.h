@@ -73,6 +73,21 @@ namespace cupcfd
 				template <class S>
 				void operator=(AdjacencyList<S,I,T>& source);
 
+				/**
+				 * Copy the edge and node data from a vector based adjacency list to this adjacency list.
+				 * The nodes keep their local indexes and the edges of each node keep their order, as for
+				 * the generic copy, but the CSR arrays are built in a single pass rather than one edge
+				 * insertion at a time.
+				 *
+				 * @param source The adjacency list to copy from
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return Nothing
+				 */
+				void operator=(AdjacencyListVector<I,T>& source);
+
 				// === CRTP Methods ===
 
 				void reset();
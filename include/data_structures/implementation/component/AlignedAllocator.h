@@ -0,0 +1,108 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the AlignedAllocator class
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_ALIGNED_ALLOCATOR_INCLUDE_H
+#define CUPCFD_DATA_STRUCTURES_ALIGNED_ALLOCATOR_INCLUDE_H
+
+#include <vector>
+#include <cstddef>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		/**
+		 * A standard library allocator that obtains its storage from cupcfd::utility::drivers::allocateAligned,
+		 * for the large arrays that are read by OpenMP kernels (e.g. the mesh stores).
+		 *
+		 * Storage is cache line or page aligned (or huge page aligned, see CUPCFD_ALIGNED_ALLOC_HUGE_PAGES),
+		 * and large blocks are first touched in parallel with a static schedule before the container
+		 * constructs the elements. With a first-touch NUMA policy, the pages of a vector that is sized
+		 * once (e.g. with resize, or shrink_to_fit once it is complete) are then spread across the nodes
+		 * in the same way the iterations of a schedule(static) loop over it are spread across the threads.
+		 *
+		 * This is a header-only template since it is used with many element types.
+		 *
+		 * @tparam X The type of the elements
+		 */
+		template <class X>
+		class AlignedAllocator
+		{
+			public:
+				/** The type of the elements **/
+				typedef X value_type;
+
+				/**
+				 * The same allocator for another element type
+				 */
+				template <class Y>
+				struct rebind
+				{
+					typedef AlignedAllocator<Y> other;
+				};
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Create an allocator. The allocator holds no state.
+				 */
+				AlignedAllocator();
+
+				/**
+				 * Create an allocator from an allocator for another element type
+				 */
+				template <class Y>
+				AlignedAllocator(const AlignedAllocator<Y>& source);
+
+				// === Concrete Methods ===
+
+				/**
+				 * Allocate uninitialised storage
+				 *
+				 * @param nEle The number of elements
+				 *
+				 * @throws std::bad_alloc if the storage cannot be allocated
+				 *
+				 * @return The storage
+				 */
+				X * allocate(std::size_t nEle);
+
+				/**
+				 * Release storage obtained from allocate
+				 *
+				 * @param data The storage
+				 * @param nEle The number of elements it was allocated with
+				 */
+				void deallocate(X * data, std::size_t nEle);
+		};
+
+		/**
+		 * All AlignedAllocators are interchangeable, since they hold no state
+		 */
+		template <class X, class Y>
+		bool operator==(const AlignedAllocator<X>& a, const AlignedAllocator<Y>& b);
+
+		template <class X, class Y>
+		bool operator!=(const AlignedAllocator<X>& a, const AlignedAllocator<Y>& b);
+
+		/**
+		 * A vector whose storage is aligned and first touched in parallel
+		 */
+		template <class X>
+		using AlignedVector = std::vector<X, AlignedAllocator<X>>;
+	}
+}
+
+// Include Header Level Definitions
+#include "AlignedAllocator.ipp"
+
+#endif
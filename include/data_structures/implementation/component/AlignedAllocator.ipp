@@ -0,0 +1,71 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the AlignedAllocator class
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_ALIGNED_ALLOCATOR_IPP_H
+#define CUPCFD_DATA_STRUCTURES_ALIGNED_ALLOCATOR_IPP_H
+
+#include <new>
+
+#include "MemoryDrivers.h"
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class X>
+		AlignedAllocator<X>::AlignedAllocator() {
+
+		}
+
+		template <class X>
+		template <class Y>
+		AlignedAllocator<X>::AlignedAllocator(const AlignedAllocator<Y>& source __attribute__((unused))) {
+
+		}
+
+		// === Concrete Methods ===
+
+		template <class X>
+		X * AlignedAllocator<X>::allocate(std::size_t nEle) {
+			if(nEle == 0) {
+				return nullptr;
+			}
+
+			X * data = cupcfd::utility::drivers::allocateAligned<X>(nEle);
+
+			if(data == nullptr) {
+				throw std::bad_alloc();
+			}
+
+			return data;
+		}
+
+		template <class X>
+		void AlignedAllocator<X>::deallocate(X * data, std::size_t nEle __attribute__((unused))) {
+			cupcfd::utility::drivers::freeAligned((void *) data);
+		}
+
+		template <class X, class Y>
+		bool operator==(const AlignedAllocator<X>& a __attribute__((unused)), const AlignedAllocator<Y>& b __attribute__((unused))) {
+			return true;
+		}
+
+		template <class X, class Y>
+		bool operator!=(const AlignedAllocator<X>& a __attribute__((unused)), const AlignedAllocator<Y>& b __attribute__((unused))) {
+			return false;
+		}
+	}
+}
+
+#endif
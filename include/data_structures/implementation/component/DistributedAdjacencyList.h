@@ -22,10 +22,12 @@
 #include "Communicator.h"
 #include "AdjacencyList.h"
 #include "AdjacencyListCSR.h"
+#include "FlatHashMap.h"
 #include "AdjacencyListVector.h"
 #include "Error.h"
 #include "ExchangePattern.h"
 #include "ExchangePatternTwoSidedNonBlocking.h"
+#include "SnapshotFile.h"
 
 namespace cupcfd
 {
@@ -50,6 +52,10 @@ namespace cupcfd
 		 * than any ghost nodes - i.e. the localID range is divided into [Locally Owned Nodes] | [Ghost Owned Nodes].
 		 * This is to help faciliate looping over local or ghost nodes by range.
 		 *
+		 * Ghost nodes may be added more than one edge away from the locally owned nodes (a multi-layer halo).
+		 * The ghost nodes are then further ordered by their layer - [Local] | [Layer 1] | [Layer 2] ... - so that
+		 * the nodes within a given halo depth also form a contiguous range (see getGhostLayerRange).
+		 *
 		 * In non-finalized graphs, this localID ordering is unknown/likely dependent on order of node addition,
 		 * but in non-finalized graphs any retrieved node data should be treated as unreliable/incorrect/subject to
 		 * change - functions that should depend on the graph being finalizsed should have a finalize check that
@@ -70,14 +76,14 @@ namespace cupcfd
 				/** Number of Local Edges **/
 				I nLEdges;
 
-				/** Number of Global (Distributed) Non-Ghost Nodes **/
-				I nGNodes;
+				/** Number of Global (Distributed) Non-Ghost Nodes. Of the node type, since the total may exceed the index type. **/
+				T nGNodes;
 
 				/** Number of Global (Distributed) Ghost Nodes **/
-				I nGGhNodes;
+				T nGGhNodes;
 
 				/** Number of Global Edges **/
-				I nGEdges;
+				T nGEdges;
 
 				/** Track whether the Distributed List is finalized (can no longer add nodes/edges) **/
 				bool finalized;
@@ -91,14 +97,13 @@ namespace cupcfd
 				/** Final Local Connectivity Graph **/
 				cupcfd::data_structures::AdjacencyListCSR<I, T> connGraph;
 
-				// ToDo: Make these unordered_maps for performance improvement
-				// May require changing the unit tests since the order from get functions would no longer be guaranteed.
+				// These are hash maps, so have no ordering - getLocalNodes and getGhostNodes sort their results.
 
 				/** Map node to a local/ghost type **/
-				std::map<T, nodeType> nodeDistType;
+				FlatHashMap<T, nodeType> nodeDistType;
 
 				/** Map node to the process that owns it **/
-				std::map<T, I> nodeOwner;
+				FlatHashMap<T, I> nodeOwner;
 
 				/** Track the neighbouring process ranks **/
 				std::vector<I> neighbourRanks;
@@ -138,14 +143,34 @@ namespace cupcfd
 				 */
 
 				/** Map a node (not the localID) to a global id. **/
-				std::map<T, I> nodeToGlobal;
+				FlatHashMap<T, I> nodeToGlobal;
 
 				/** Map a global id to a node (not the localID). **/
-				std::map<I, T> globalToNode;
+				FlatHashMap<I, T> globalToNode;
 
 				/** Store the number of graph nodes on a process - only valids after finalizing. **/
 				I * processNodeCounts;
 
+				/**
+				 * Map a ghost node to its ghost layer - the number of edges from the nearest locally owned node
+				 * (1 for ghosts adjacent to a local node, 2 for ghosts adjacent to those etc). Ghosts that are not
+				 * connected to any local node are treated as layer 1.
+				 **/
+				FlatHashMap<T, I> nodeGhostLayer;
+
+				/** The number of ghost layers - the maximum layer across all ranks (at least 1). Valid after finalizing. **/
+				I nGhostLayers;
+
+				/**
+				 * CSR style ranges of local indexes for each ghost layer, of size nGhostLayers + 1.
+				 * Ghost nodes are sorted by layer after finalizing, so layer l (1-based) occupies the local indexes
+				 * [ghostLayerXAdj[l-1], ghostLayerXAdj[l]). ghostLayerXAdj[0] is the number of locally owned nodes.
+				 **/
+				std::vector<I> ghostLayerXAdj;
+
+				/** The ghost layer that each node in sendGlobalIDsAdjncy occupies on the rank it is sent to **/
+				std::vector<I> sendLayerAdjncy;
+
 				// === Constructors/Deconstructors ===
 
 				/**
@@ -345,6 +370,7 @@ namespace cupcfd
 				 *
 				 * @return An error status indicating the success or failure of the operation
 				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_INVALID_INDEX The global node count exceeds the range of the global IDs (type I)
 				 */
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes finalize();
@@ -361,11 +387,43 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes sortNodesByLocal();
 
+				/**
+				 * Compute the ghost layer of each ghost node by a breadth first search of the edges from the
+				 * locally owned nodes, and agree the number of layers across all ranks.
+				 * Called as part of finalize.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes computeGhostLayers();
+
+				/**
+				 * Get the range of local indexes occupied by the ghost nodes of a layer in a finalized graph.
+				 *
+				 * @param layer The ghost layer (1 to nGhostLayers)
+				 * @param start A pointer to the location where the first local index of the layer will be stored
+				 * @param end A pointer to the location where one past the last local index of the layer will be stored
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_DISTGRAPH_UNFINALIZED The graph is not finalized
+				 * @retval cupcfd::error::E_INVALID_INDEX The layer is out of range
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getGhostLayerRange(I layer, I * start, I * end);
+
 				//template <class T>
 				//cupcfd::adjacency_list::eCodes getNodeOwner(DistributedAdjacencyList<I, T>& list, T node, int * process);
 
 				/**
-				 * Retrieve the node data of the ghost nodes on this rank
+				 * Retrieve the node data of the ghost nodes on this rank, in ascending order
 				 *
 				 * @param nodes The array to store the ghost node data
 				 * @param nNodes The size of nodes in the number of elements of type T
@@ -380,7 +438,7 @@ namespace cupcfd
 				cupcfd::error::eCodes getGhostNodes(T * nodes, I nNodes);
 
 				/**
-				 * Retrieve the node data of the locally owned nodes on this rank
+				 * Retrieve the node data of the locally owned nodes on this rank, in ascending order
 				 *
 				 * @param nodes The array to store the ghost node data
 				 * @param nNodes The size of nodes in the number of elements of type T
@@ -394,6 +452,17 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes getLocalNodes(T * nodes, I nNodes);
 
+				/**
+				 * Get the heap memory used by the node maps of this graph on this rank, including the
+				 * node/index maps of the local connectivity graph
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return The number of bytes used
+				 */
+				std::size_t getMapMemoryBytes() const;
+
 				/**
 				 * Populate the serial adjacency list with data from this distributed graph..
 				 * The data from the distributed list is gathered onto the specified rank and added to the serial adjacency list.
@@ -451,6 +520,65 @@ namespace cupcfd
 				template <class D>
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes buildExchangePattern(cupcfd::comm::ExchangePatternTwoSidedNonBlocking<D>** pattern);
+
+				/**
+				 * Builds an ExchangePattern object as above, but only exchanging the ghost nodes of the first
+				 * depth ghost layers. The ghost nodes of deeper layers are left unchanged by exchanges using this
+				 * pattern - e.g. a kernel may compute layer 1 redundantly from a depth 2 exchange, and so only
+				 * need to exchange every other step.
+				 *
+				 * @param pattern A pointer to where the pointer for the newly created ExchangePattern will be stored.
+				 * @param depth The number of ghost layers to exchange. Values above nGhostLayers exchange every layer.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam D The type of the data to be exchanged by the pattern
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_INVALID_INDEX The depth is less than 1
+				 */
+				template <class D>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildExchangePattern(cupcfd::comm::ExchangePatternTwoSidedNonBlocking<D>** pattern, I depth);
+
+				/**
+				 * Write the state of a finalized graph on this rank to a snapshot file, so that it can be
+				 * restored with readSnapshot without repeating the communication of finalize.
+				 *
+				 * The nodes are written in local index order, along with their type, owner and global ID,
+				 * followed by the local CSR connectivity, the exchange lists and the ghost layer ranges.
+				 *
+				 * @param file The snapshot file to write to, open for writing
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ADJACENCY_LIST_DISTRIBUTED_NOTFINALIZED The graph is not finalized
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes writeSnapshot(cupcfd::io::SnapshotFile& file);
+
+				/**
+				 * Restore this graph from the state written by writeSnapshot, replacing its contents.
+				 * The graph is finalized afterwards, with the same local indexes and global IDs as the graph
+				 * that was written. No communication takes place, so the snapshot must have been written by
+				 * the same rank of a communicator of the same size.
+				 *
+				 * @param file The snapshot file to read from, open for reading
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_INVALID_FILE_FORMAT The data in the file is inconsistent or was written for a
+				 * communicator of a different size
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes readSnapshot(cupcfd::io::SnapshotFile& file);
 		};
 	} // namespace data_structures
 } // namespace cupcfd
@@ -56,7 +56,7 @@ namespace cupcfd
 			T * recvNodes = nullptr;
 			
 			I nRecvNodeProcCount;
-			T * recvNodeProcCount = nullptr;
+			I * recvNodeProcCount = nullptr;
 
 			status = cupcfd::comm::GatherV(localNodes, nLocalNodes, 
 											&recvNodes, &nRecvNodes, 
@@ -79,13 +79,13 @@ namespace cupcfd
 			T * recvEdge1 = nullptr;
 			
 			I nRecvEdge1ProcCount;
-			T * recvEdge1ProcCount = nullptr;
+			I * recvEdge1ProcCount = nullptr;
 
 			I nRecvEdge2;
 			T * recvEdge2 = nullptr;
 			
 			I nRecvEdge2ProcCount;
-			T * recvEdge2ProcCount = nullptr;
+			I * recvEdge2ProcCount = nullptr;
 			
 			status = cupcfd::comm::GatherV(edgeNode1, nEdges, 
 										   &recvEdge1, &nRecvEdge1, 
@@ -137,8 +137,18 @@ namespace cupcfd
 		template <class I, class T>
 		template <class D>
 		cupcfd::error::eCodes DistributedAdjacencyList<I,T>::buildExchangePattern(cupcfd::comm::ExchangePatternTwoSidedNonBlocking<D>** pattern) {
+			return this->buildExchangePattern(pattern, this->nGhostLayers);
+		}
+
+		template <class I, class T>
+		template <class D>
+		cupcfd::error::eCodes DistributedAdjacencyList<I,T>::buildExchangePattern(cupcfd::comm::ExchangePatternTwoSidedNonBlocking<D>** pattern, I depth) {
 			cupcfd::error::eCodes status;
-			
+
+			if(depth < 1) {
+				return cupcfd::error::E_INVALID_INDEX;
+			}
+
 			*pattern = new cupcfd::comm::ExchangePatternTwoSidedNonBlocking<D>();
 
 			// Items needed to initialise the exchange pattern
@@ -168,24 +178,32 @@ namespace cupcfd
 			// May wish to move that data/computation out to this drivers, since it is only needed for
 			// exchange patterns, so it could be wrapped into an exchange pattern object in graph instead.
 
-			I nTRanks = this->sendGlobalIDsAdjncy.size();
-			I * tRanks = (I *) malloc(sizeof(I) * nTRanks);
-
-			I numSendGlobalIDsXAdj = cupcfd::utility::drivers::safeConvertSizeT<I>(this->sendGlobalIDsXAdj.size());
-			for(I i = 0; i < numSendGlobalIDsXAdj; i++) {
-				for(I j = 0; j < this->sendGlobalIDsXAdj[i+1] - this->sendGlobalIDsXAdj[i]; j++) {
-					tRanks[this->sendGlobalIDsXAdj[i] + j] = this->sendRank[i];
+			// Only the nodes that lie within the requested depth on the receiving rank are sent
+			// (the receiving side of the pattern is derived from the sends)
+			I nSendGlobalIDs = cupcfd::utility::drivers::safeConvertSizeT<I>(this->sendGlobalIDsAdjncy.size());
+			I * sendGIDs = (I *) malloc(sizeof(I) * nSendGlobalIDs);
+			I * tRanks = (I *) malloc(sizeof(I) * nSendGlobalIDs);
+			I nTRanks = 0;
+
+			I numSendRanks = cupcfd::utility::drivers::safeConvertSizeT<I>(this->sendRank.size());
+			for(I i = 0; i < numSendRanks; i++) {
+				for(I j = this->sendGlobalIDsXAdj[i]; j < this->sendGlobalIDsXAdj[i+1]; j++) {
+					if(this->sendLayerAdjncy[j] <= depth) {
+						sendGIDs[nTRanks] = this->sendGlobalIDsAdjncy[j];
+						tRanks[nTRanks] = this->sendRank[i];
+						nTRanks = nTRanks + 1;
+					}
 				}
 			}
 
-
 			status = (*pattern)->init(*(this->comm),
 								mapLocalToExchangeIDX, nMapLocalToExchangeIDX,
-								&(this->sendGlobalIDsAdjncy[0]), this->sendGlobalIDsAdjncy.size(),
+								sendGIDs, nTRanks,
 								tRanks, nTRanks);
 			CHECK_ECODE(status)
 
 			free(mapLocalToExchangeIDX);
+			free(sendGIDs);
 			free(tRanks);
 
 			return cupcfd::error::E_SUCCESS;
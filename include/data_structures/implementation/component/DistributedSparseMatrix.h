@@ -0,0 +1,232 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the DistributedSparseMatrix class
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_DISTRIBUTED_SPARSE_MATRIX_INCLUDE_H
+#define CUPCFD_DATA_STRUCTURES_DISTRIBUTED_SPARSE_MATRIX_INCLUDE_H
+
+#include <vector>
+
+#include "Communicator.h"
+#include "SparseMatrix.h"
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixSource.h"
+#include "ExchangePatternTwoSidedNonBlocking.h"
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		/**
+		 * Stores a square sparse matrix whose rows are split into contiguous blocks across ranks,
+		 * such as the rows of the cells owned by each rank of a partitioned mesh.
+		 *
+		 * Each rank only stores its own rows, in a CSR matrix that uses a compact local column numbering:
+		 * columns of rows owned by this rank come first (in global order), followed by the 'ghost' columns
+		 * of rows owned by other ranks (also in global order). A vector x that is multiplied by the matrix
+		 * is therefore stored locally as [Owned Entries] | [Ghost Entries], and the ghost entries are
+		 * updated from their owning ranks by an ExchangePattern before each product.
+		 *
+		 * Storage per rank is proportional to the number of non-zeroes in its rows, rather than to the
+		 * size of the global matrix.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The type of the stored node data
+		 */
+		template <class I, class T>
+		class DistributedSparseMatrix
+		{
+			public:
+				// === Members ===
+
+				/** Processes the matrix rows are spread across **/
+				cupcfd::comm::Communicator comm;
+
+				/** Number of rows (and columns) in the global matrix **/
+				I nGlobalRows;
+
+				/** Global index (base 0) of the first row owned by this rank **/
+				I rowStart;
+
+				/** Number of rows owned by this rank **/
+				I nOwnedRows;
+
+				/** Number of ghost columns - columns of rows owned by other ranks **/
+				I nGhosts;
+
+				/** Owned rows, with local columns (base 0). Size nOwnedRows x (nOwnedRows + nGhosts). **/
+				SparseMatrixCSR<I,T> local;
+
+				/** Global index of each ghost column, ascending (local column nOwnedRows + i is ghostGlobalIDs[i]) **/
+				std::vector<I> ghostGlobalIDs;
+
+				/** Global index of the first row of each rank (size number of ranks + 1) **/
+				std::vector<I> rankRowStart;
+
+				/** Local rows that only reference owned columns **/
+				std::vector<I> interiorRows;
+
+				/** Local rows that reference at least one ghost column **/
+				std::vector<I> boundaryRows;
+
+				/** Exchange of the ghost entries of a local vector. Not used on a single rank. **/
+				cupcfd::comm::ExchangePatternTwoSidedNonBlocking<T> * exchangePattern;
+
+				/** Whether the matrix has been built **/
+				bool built;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Create an empty distributed matrix - build must be called before use.
+				 *
+				 * @param comm The communicator of the ranks that will hold the rows
+				 */
+				DistributedSparseMatrix(cupcfd::comm::Communicator& comm);
+
+				/**
+				 * Deconstructor
+				 */
+				~DistributedSparseMatrix();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Build the local rows of the matrix from a source. This is a collective operation.
+				 *
+				 * The rows of the ranks must form contiguous blocks in rank order that cover the matrix,
+				 * such as the owned cells of a mesh, or an even split of the rows.
+				 *
+				 * @param source The source to read the rows from. Only the rows of this rank are read.
+				 * @param startRow The first row owned by this rank, using the base of the source
+				 * @param nRows The number of rows owned by this rank
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The matrix was built successfully
+				 * @retval cupcfd::error::E_MATRIX_ROW_OOB The row blocks of the ranks do not partition the matrix
+				 * @retval cupcfd::error::E_MATRIX_COL_OOB A row has a column outside of the matrix
+				 * @retval cupcfd::error::E_ERROR The source failed to provide a row on another rank. The ranks where it
+				 * failed return the error of the source.
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes build(SparseMatrixSource<I,T>& source, I startRow, I nRows);
+
+				/**
+				 * Get the global index (base 0) of a local column.
+				 *
+				 * @param localCol The local column index
+				 * @param globalCol A pointer to the location to store the global index
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The index was found
+				 * @retval cupcfd::error::E_INVALID_INDEX The local column does not exist
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getGlobalColumnIndex(I localCol, I * globalCol);
+
+				/**
+				 * Get the local index of a global column (base 0).
+				 *
+				 * @param globalCol The global column index
+				 * @param localCol A pointer to the location to store the local index
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The index was found
+				 * @retval cupcfd::error::E_INVALID_INDEX The column is neither owned nor a ghost on this rank
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getLocalColumnIndex(I globalCol, I * localCol);
+
+				/**
+				 * Update the ghost entries of a local vector from the ranks that own them.
+				 * This is a collective operation.
+				 *
+				 * @param x The local vector - owned entries followed by ghost entries
+				 * @param nX The size of x - must be nOwnedRows + nGhosts
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The ghost entries were updated
+				 * @retval cupcfd::error::E_UNFINALIZED The matrix has not been built
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The vector does not match the local columns
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes haloExchange(T * x, I nX);
+
+				/**
+				 * Start updating the ghost entries of a local vector. The owned entries of x may be read,
+				 * but the ghost entries must not be accessed until haloExchangeStop is called.
+				 *
+				 * @param x The local vector - owned entries followed by ghost entries
+				 * @param nX The size of x - must be nOwnedRows + nGhosts
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The exchange was started
+				 * @retval cupcfd::error::E_UNFINALIZED The matrix has not been built
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The vector does not match the local columns
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes haloExchangeStart(T * x, I nX);
+
+				/**
+				 * Complete an update of the ghost entries started by haloExchangeStart.
+				 *
+				 * @param x The local vector passed to haloExchangeStart
+				 * @param nX The size of x - must be nOwnedRows + nGhosts
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The ghost entries were updated
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes haloExchangeStop(T * x, I nX);
+
+				/**
+				 * Compute the owned rows of y = Ax. This is a collective operation.
+				 * The ghost entries of x are updated, and the rows that only use owned entries are
+				 * computed while the exchange is in progress.
+				 *
+				 * @param x The local vector - owned entries followed by ghost entries
+				 * @param nX The size of x - must be nOwnedRows + nGhosts
+				 * @param y The array to store the owned rows of the product in
+				 * @param nY The size of y - must be nOwnedRows
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The product was computed successfully
+				 * @retval cupcfd::error::E_UNFINALIZED The matrix has not been built
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The vector sizes do not match the local matrix
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes multiply(T * x, I nX, T * y, I nY);
+
+				/**
+				 * Copy the owned rows into a matrix that uses global indexing, for interfaces that take
+				 * the full matrix dimensions (e.g. PETSc). The matrix is resized to the global matrix
+				 * and only the rows owned by this rank are set.
+				 *
+				 * @param matrix The matrix to copy into. Its base index is preserved.
+				 *
+				 * @tparam C The implementation type of the sparse matrix
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The rows were copied successfully
+				 * @retval cupcfd::error::E_UNFINALIZED The matrix has not been built
+				 */
+				template <class C>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes copyToGlobal(SparseMatrix<C,I,T>& matrix);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "DistributedSparseMatrix.ipp"
+
+#endif
@@ -0,0 +1,61 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the DistributedSparseMatrix class
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_DISTRIBUTED_SPARSE_MATRIX_IPP_H
+#define CUPCFD_DATA_STRUCTURES_DISTRIBUTED_SPARSE_MATRIX_IPP_H
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		template <class I, class T>
+		template <class C>
+		cupcfd::error::eCodes DistributedSparseMatrix<I,T>::copyToGlobal(SparseMatrix<C,I,T>& matrix) {
+			cupcfd::error::eCodes status;
+
+			if(!this->built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
+			status = matrix.resize(this->nGlobalRows, this->nGlobalRows);
+			CHECK_ECODE(status)
+
+			I base = matrix.baseIndex;
+			I nnz = this->local.nnz;
+
+			std::vector<I> rows(nnz);
+			std::vector<I> cols(nnz);
+
+			for(I i = 0; i < this->nOwnedRows; i++) {
+				for(I k = this->local.IA[i]; k < this->local.IA[i + 1]; k++) {
+					I localCol = this->local.JA[k];
+
+					rows[k] = this->rowStart + i + base;
+
+					if(localCol < this->nOwnedRows) {
+						cols[k] = this->rowStart + localCol + base;
+					}
+					else {
+						cols[k] = this->ghostGlobalIDs[localCol - this->nOwnedRows] + base;
+					}
+				}
+			}
+
+			status = matrix.setElements(rows.data(), cols.data(), this->local.A.data(), nnz);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,193 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the FlatHashMap class
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_FLAT_HASH_MAP_INCLUDE_H
+#define CUPCFD_DATA_STRUCTURES_FLAT_HASH_MAP_INCLUDE_H
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <functional>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		/**
+		 * An open-addressing hash map that stores its entries in a single flat array, for use in
+		 * place of std::map when looking up build labels and node IDs.
+		 *
+		 * Entries are found by linear probing from a position computed by multiplicative (Fibonacci)
+		 * hashing, so an insert or lookup usually touches a single cache line, and inserting an entry
+		 * does not allocate unless the table needs to grow. Entries cannot be removed individually.
+		 *
+		 * The subset of the std::map interface used by this library is provided (find, operator[], at,
+		 * begin/end, size, clear), but unlike std::map the iteration order is unspecified.
+		 * Callers that need the keys in order must sort them.
+		 *
+		 * This is a header-only template since it is used with several key and value types.
+		 *
+		 * @tparam K The type of the keys. Must be supported by std::hash and operator==.
+		 * @tparam V The type of the values. Must be default constructible.
+		 */
+		template <class K, class V>
+		class FlatHashMap
+		{
+			public:
+				/** The type of the stored entries **/
+				typedef std::pair<K,V> value_type;
+
+				/**
+				 * Forward iterator over the occupied entries of the map
+				 */
+				class iterator
+				{
+					public:
+						iterator();
+						iterator(FlatHashMap<K,V> * map, std::size_t pos);
+
+						value_type& operator*() const;
+						value_type * operator->() const;
+						iterator& operator++();
+						iterator operator++(int);
+						bool operator==(const iterator& other) const;
+						bool operator!=(const iterator& other) const;
+
+					private:
+						FlatHashMap<K,V> * map;
+						std::size_t pos;
+				};
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Create an empty map
+				 */
+				FlatHashMap();
+
+				// No destructor is declared, so that the table storage is moved rather than copied
+				// when a map is moved.
+
+				// === Concrete Methods ===
+
+				/**
+				 * @return An iterator to the first entry of the map
+				 */
+				iterator begin();
+
+				/**
+				 * @return An iterator past the last entry of the map
+				 */
+				iterator end();
+
+				/**
+				 * Find the entry of a key
+				 *
+				 * @param key The key to find
+				 *
+				 * @return An iterator to the entry, or end() if the key is not stored
+				 */
+				iterator find(const K& key);
+
+				/**
+				 * Get the value of a key, inserting a default constructed value if the key is not stored
+				 *
+				 * @param key The key to find or insert
+				 *
+				 * @return A reference to the value of the key
+				 */
+				V& operator[](const K& key);
+
+				/**
+				 * Get the value of a key, which must already be stored
+				 *
+				 * @param key The key to find
+				 *
+				 * @throws std::out_of_range If the key is not stored
+				 *
+				 * @return A reference to the value of the key
+				 */
+				V& at(const K& key);
+
+				/**
+				 * @return The number of entries stored
+				 */
+				std::size_t size() const;
+
+				/**
+				 * @return Whether the map is empty
+				 */
+				bool empty() const;
+
+				/**
+				 * Remove all entries. The table storage is retained.
+				 */
+				void clear();
+
+				/**
+				 * Size the table so that at least nEntries can be stored without growing
+				 *
+				 * @param nEntries The number of entries to make space for
+				 */
+				void reserve(std::size_t nEntries);
+
+				/**
+				 * @return The number of bytes of heap memory used by the table
+				 */
+				std::size_t getMemoryBytes() const;
+
+			private:
+				/** The table - only the entries of occupied positions are valid **/
+				std::vector<value_type> entries;
+
+				/** Whether each position of the table is occupied **/
+				std::vector<unsigned char> occupied;
+
+				/** Number of occupied positions **/
+				std::size_t nEntries;
+
+				/** Shift that maps a 64-bit hash to a table position (64 - log2 of the table size) **/
+				unsigned int shift;
+
+				/**
+				 * Compute the first position of the table to probe for a key. The table must not be empty.
+				 *
+				 * @param key The key
+				 *
+				 * @return The position
+				 */
+				std::size_t getPosition(const K& key) const;
+
+				/**
+				 * Find the position of a key, or the empty position where it would be inserted.
+				 * The table must not be empty.
+				 *
+				 * @param key The key
+				 *
+				 * @return The position
+				 */
+				std::size_t probe(const K& key) const;
+
+				/**
+				 * Resize the table and reinsert the stored entries
+				 *
+				 * @param capacity The new table size - a power of two
+				 */
+				void rehash(std::size_t capacity);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "FlatHashMap.ipp"
+
+#endif
@@ -0,0 +1,239 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the FlatHashMap class
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_FLAT_HASH_MAP_IPP_H
+#define CUPCFD_DATA_STRUCTURES_FLAT_HASH_MAP_IPP_H
+
+#include <cstdint>
+#include <stdexcept>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		// === Iterator ===
+
+		template <class K, class V>
+		FlatHashMap<K,V>::iterator::iterator()
+		: map(nullptr),
+		  pos(0)
+		{
+
+		}
+
+		template <class K, class V>
+		FlatHashMap<K,V>::iterator::iterator(FlatHashMap<K,V> * map, std::size_t pos)
+		: map(map),
+		  pos(pos)
+		{
+
+		}
+
+		template <class K, class V>
+		typename FlatHashMap<K,V>::value_type& FlatHashMap<K,V>::iterator::operator*() const {
+			return this->map->entries[this->pos];
+		}
+
+		template <class K, class V>
+		typename FlatHashMap<K,V>::value_type * FlatHashMap<K,V>::iterator::operator->() const {
+			return &(this->map->entries[this->pos]);
+		}
+
+		template <class K, class V>
+		typename FlatHashMap<K,V>::iterator& FlatHashMap<K,V>::iterator::operator++() {
+			std::size_t capacity = this->map->occupied.size();
+
+			this->pos = this->pos + 1;
+			while(this->pos < capacity && !this->map->occupied[this->pos]) {
+				this->pos = this->pos + 1;
+			}
+
+			return *this;
+		}
+
+		template <class K, class V>
+		typename FlatHashMap<K,V>::iterator FlatHashMap<K,V>::iterator::operator++(int) {
+			iterator tmp = *this;
+			++(*this);
+			return tmp;
+		}
+
+		template <class K, class V>
+		bool FlatHashMap<K,V>::iterator::operator==(const iterator& other) const {
+			return (this->map == other.map) && (this->pos == other.pos);
+		}
+
+		template <class K, class V>
+		bool FlatHashMap<K,V>::iterator::operator!=(const iterator& other) const {
+			return !(*this == other);
+		}
+
+		// === Map ===
+
+		template <class K, class V>
+		FlatHashMap<K,V>::FlatHashMap()
+		: nEntries(0),
+		  shift(64)
+		{
+
+		}
+
+		template <class K, class V>
+		typename FlatHashMap<K,V>::iterator FlatHashMap<K,V>::begin() {
+			std::size_t pos = 0;
+
+			while(pos < this->occupied.size() && !this->occupied[pos]) {
+				pos = pos + 1;
+			}
+
+			return iterator(this, pos);
+		}
+
+		template <class K, class V>
+		typename FlatHashMap<K,V>::iterator FlatHashMap<K,V>::end() {
+			return iterator(this, this->occupied.size());
+		}
+
+		template <class K, class V>
+		typename FlatHashMap<K,V>::iterator FlatHashMap<K,V>::find(const K& key) {
+			if(this->nEntries == 0) {
+				return this->end();
+			}
+
+			std::size_t pos = this->probe(key);
+
+			if(!this->occupied[pos]) {
+				return this->end();
+			}
+
+			return iterator(this, pos);
+		}
+
+		template <class K, class V>
+		V& FlatHashMap<K,V>::operator[](const K& key) {
+			// An empty map has no table to probe yet
+			std::size_t pos = 0;
+
+			if(this->occupied.size() > 0) {
+				pos = this->probe(key);
+
+				// Lookups of stored keys never grow the table
+				if(this->occupied[pos]) {
+					return this->entries[pos].second;
+				}
+			}
+
+			// Inserting a new key - keep the load factor at or below 3/4 so probe sequences stay short.
+			// Growing moves every entry, so the key is probed again afterwards.
+			if(4 * (this->nEntries + 1) > 3 * this->occupied.size()) {
+				this->rehash(this->occupied.size() == 0 ? 16 : 2 * this->occupied.size());
+				pos = this->probe(key);
+			}
+
+			this->occupied[pos] = 1;
+			this->entries[pos].first = key;
+			this->entries[pos].second = V();
+			this->nEntries = this->nEntries + 1;
+
+			return this->entries[pos].second;
+		}
+
+		template <class K, class V>
+		V& FlatHashMap<K,V>::at(const K& key) {
+			iterator it = this->find(key);
+
+			if(it == this->end()) {
+				throw std::out_of_range("FlatHashMap::at: key is not stored");
+			}
+
+			return it->second;
+		}
+
+		template <class K, class V>
+		std::size_t FlatHashMap<K,V>::size() const {
+			return this->nEntries;
+		}
+
+		template <class K, class V>
+		bool FlatHashMap<K,V>::empty() const {
+			return this->nEntries == 0;
+		}
+
+		template <class K, class V>
+		void FlatHashMap<K,V>::clear() {
+			this->occupied.assign(this->occupied.size(), 0);
+			this->nEntries = 0;
+		}
+
+		template <class K, class V>
+		void FlatHashMap<K,V>::reserve(std::size_t nEntries) {
+			std::size_t capacity = 16;
+
+			while(3 * capacity < 4 * nEntries) {
+				capacity = 2 * capacity;
+			}
+
+			if(capacity > this->occupied.size()) {
+				this->rehash(capacity);
+			}
+		}
+
+		template <class K, class V>
+		std::size_t FlatHashMap<K,V>::getMemoryBytes() const {
+			return (this->entries.capacity() * sizeof(value_type)) + this->occupied.capacity();
+		}
+
+		template <class K, class V>
+		std::size_t FlatHashMap<K,V>::getPosition(const K& key) const {
+			// Fibonacci hashing - the multiply spreads the low bits of sequential integer keys
+			// (whose std::hash is typically the identity) across the high bits that select the position
+			uint64_t hash = (uint64_t) std::hash<K>()(key);
+			return (std::size_t) ((hash * UINT64_C(11400714819323198485)) >> this->shift);
+		}
+
+		template <class K, class V>
+		std::size_t FlatHashMap<K,V>::probe(const K& key) const {
+			std::size_t mask = this->occupied.size() - 1;
+			std::size_t pos = this->getPosition(key);
+
+			while(this->occupied[pos] && !(this->entries[pos].first == key)) {
+				pos = (pos + 1) & mask;
+			}
+
+			return pos;
+		}
+
+		template <class K, class V>
+		void FlatHashMap<K,V>::rehash(std::size_t capacity) {
+			std::vector<value_type> oldEntries(capacity);
+			std::vector<unsigned char> oldOccupied(capacity, 0);
+
+			oldEntries.swap(this->entries);
+			oldOccupied.swap(this->occupied);
+
+			this->shift = 64;
+			for(std::size_t c = capacity; c > 1; c = c / 2) {
+				this->shift = this->shift - 1;
+			}
+
+			for(std::size_t i = 0; i < oldOccupied.size(); i++) {
+				if(oldOccupied[i]) {
+					std::size_t pos = this->probe(oldEntries[i].first);
+					this->occupied[pos] = 1;
+					this->entries[pos] = oldEntries[i];
+				}
+			}
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,256 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the GraphColouring class
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_GRAPH_COLOURING_INCLUDE_H
+#define CUPCFD_DATA_STRUCTURES_GRAPH_COLOURING_INCLUDE_H
+
+#include <vector>
+
+#include "AdjacencyListCSR.h"
+#include "SnapshotFile.h"
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		/**
+		 * Computes a colouring of a set of items such that no two items of the same colour conflict.
+		 * Items of one colour can then be processed in parallel without races, with the colours
+		 * processed one after another.
+		 *
+		 * Two kinds of conflict are supported:
+		 * (a) Graph: The items are the nodes of a graph and conflict with their neighbours.
+		 * (b) Incidence: Each item touches a set of targets (e.g. a face touches its cells), and items
+		 *     conflict if they touch the same target.
+		 *
+		 * A distance-1 colouring only separates directly conflicting items. A distance-2 colouring
+		 * also separates items that are connected through a third item (e.g. for loops that also
+		 * read the neighbours of the items they write).
+		 *
+		 * The colouring is computed with a speculative parallel greedy algorithm (Gebremedhin-Manne):
+		 * each round, the items still to be coloured are tentatively given the smallest colour not used
+		 * by their neighbours in parallel. Two neighbours coloured at the same time may pick the same
+		 * colour, so these conflicts are detected afterwards and the item with the higher index is
+		 * coloured again in the next round. Small sets of items are coloured on a single thread,
+		 * which colours them in order and so gives the same result as a serial greedy colouring.
+		 *
+		 * Optionally, the colours can be balanced afterwards by moving items from colours that are
+		 * larger than average into smaller colours, where their neighbours permit it.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 */
+		template <class I>
+		class GraphColouring
+		{
+			public:
+				// === Members ===
+
+				/** Number of items coloured **/
+				I nItems;
+
+				/** Number of colours used **/
+				I nColours;
+
+				/** Colour of each item (base 0). Items excluded from the colouring are -1. **/
+				std::vector<I> colours;
+
+				/** Offsets into colourItems for the items of each colour (size nColours + 1) **/
+				std::vector<I> colourXAdj;
+
+				/** Item IDs (base 0) grouped by colour, ascending within each colour **/
+				std::vector<I> colourItems;
+
+				/** Number of speculative rounds needed to resolve all conflicts **/
+				I nRounds;
+
+				/** Size of the largest colour divided by the mean colour size (1.0 is perfectly balanced) **/
+				double imbalance;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Create an empty colouring
+				 */
+				GraphColouring();
+
+				/**
+				 * Deconstructor
+				 */
+				~GraphColouring();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Reset the colouring to contain no items
+				 */
+				void reset();
+
+				/**
+				 * Colour the nodes of a graph stored in CSR form, such that no two neighbouring
+				 * nodes share a colour (or no two nodes within two edges for a distance-2 colouring).
+				 *
+				 * Neighbours outside of the range of nodes (e.g. ghost nodes) are ignored, as are self-loops.
+				 * The neighbour lists do not need to be symmetric.
+				 *
+				 * @param xadj Offsets (base 0) into adjncy for the neighbours of each node (size nNodes + 1)
+				 * @param adjncy Neighbouring node IDs, using the index base 'base'
+				 * @param nNodes The number of nodes to colour
+				 * @param base The index base of the entries of adjncy
+				 * @param distance The colouring distance - 1 or 2
+				 * @param balance Whether to balance the size of the colours after colouring
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The graph was coloured successfully
+				 * @retval cupcfd::error::E_INVALID_INDEX The distance is not 1 or 2
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes colourGraph(const I * xadj, const I * adjncy, I nNodes, I base, I distance, bool balance);
+
+				/**
+				 * Colour the nodes of an adjacency list, such that no two neighbouring
+				 * nodes share a colour (or no two nodes within two edges for a distance-2 colouring).
+				 * Items are the local indexes of the nodes.
+				 *
+				 * @param graph The graph to colour
+				 * @param distance The colouring distance - 1 or 2
+				 * @param balance Whether to balance the size of the colours after colouring
+				 *
+				 * @tparam T The type of the graph node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The graph was coloured successfully
+				 * @retval cupcfd::error::E_INVALID_INDEX The distance is not 1 or 2
+				 */
+				template <class T>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes colourGraph(AdjacencyListCSR<I,T>& graph, I distance, bool balance);
+
+				/**
+				 * Colour a set of items that each touch a set of targets, such that no two items that touch
+				 * the same target share a colour. For a distance-2 colouring, items that touch two targets
+				 * which are touched by a common item are also separated.
+				 *
+				 * Targets that are negative or not less than nTargets (after removing the base) are ignored,
+				 * and items that touch no valid targets are left uncoloured (colour -1).
+				 *
+				 * @param xadj Offsets (base 0) into adjncy for the targets of each item (size nItems + 1)
+				 * @param adjncy Target IDs, using the index base 'base'
+				 * @param nItems The number of items to colour
+				 * @param nTargets The number of targets
+				 * @param base The index base of the entries of adjncy
+				 * @param distance The colouring distance - 1 or 2
+				 * @param balance Whether to balance the size of the colours after colouring
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The items were coloured successfully
+				 * @retval cupcfd::error::E_INVALID_INDEX The distance is not 1 or 2
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes colourIncidence(const I * xadj, const I * adjncy, I nItems, I nTargets,
+													  I base, I distance, bool balance);
+
+				/**
+				 * Check that no two neighbouring nodes of a graph share a colour at the given distance.
+				 *
+				 * @param xadj Offsets (base 0) into adjncy for the neighbours of each node (size nItems + 1)
+				 * @param adjncy Neighbouring node IDs, using the index base 'base'
+				 * @param base The index base of the entries of adjncy
+				 * @param distance The colouring distance - 1 or 2
+				 *
+				 * @return Whether the colouring is valid
+				 */
+				bool isValid(const I * xadj, const I * adjncy, I base, I distance);
+
+				/**
+				 * Write the colouring to a snapshot file
+				 *
+				 * @param file The snapshot file to write to, open for writing
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The colouring was written
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes writeSnapshot(cupcfd::io::SnapshotFile& file);
+
+				/**
+				 * Restore a colouring written by writeSnapshot, replacing this colouring
+				 *
+				 * @param file The snapshot file to read from, open for reading
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The colouring was restored
+				 * @retval cupcfd::error::E_INVALID_FILE_FORMAT The data in the file is inconsistent
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes readSnapshot(cupcfd::io::SnapshotFile& file);
+
+			private:
+				/**
+				 * Build the symmetric distance-1 conflict graph of a graph, with the self-loops,
+				 * duplicates and out of range neighbours removed.
+				 *
+				 * @param xadj Offsets (base 0) into adjncy for the neighbours of each node (size nNodes + 1)
+				 * @param adjncy Neighbouring node IDs, using the index base 'base'
+				 * @param nNodes The number of nodes
+				 * @param base The index base of the entries of adjncy
+				 * @param conflictXAdj The offsets of the conflicts of each node (resized)
+				 * @param conflictAdjncy The conflicting node IDs, base 0 (resized)
+				 */
+				void buildGraphConflicts(const I * xadj, const I * adjncy, I nNodes, I base,
+										 std::vector<I>& conflictXAdj, std::vector<I>& conflictAdjncy);
+
+				/**
+				 * Build the distance-2 conflict graph of a distance-1 conflict graph, where each item
+				 * conflicts with its neighbours and the neighbours of its neighbours.
+				 *
+				 * @param xadj Offsets into adjncy for the conflicts of each item (size nItems + 1)
+				 * @param adjncy Conflicting item IDs (base 0)
+				 * @param xadj2 The offsets of the distance-2 conflicts of each item (resized)
+				 * @param adjncy2 The distance-2 conflicting item IDs (resized)
+				 */
+				void expandDistance2(const std::vector<I>& xadj, const std::vector<I>& adjncy,
+									 std::vector<I>& xadj2, std::vector<I>& adjncy2);
+
+				/**
+				 * Colour the items of a conflict graph (base 0, no self-loops, symmetric) with the
+				 * speculative greedy algorithm, then balance and group the colours.
+				 *
+				 * @param xadj Offsets into adjncy for the conflicts of each item (size nItems + 1)
+				 * @param adjncy Conflicting item IDs (base 0)
+				 * @param active Whether each item should be coloured
+				 * @param balance Whether to balance the size of the colours after colouring
+				 */
+				void colourConflicts(const std::vector<I>& xadj, const std::vector<I>& adjncy,
+									 const std::vector<bool>& active, bool balance);
+
+				/**
+				 * Move items from oversized colours into the smallest colour permitted by their
+				 * neighbours that is below the mean colour size.
+				 *
+				 * @param xadj Offsets into adjncy for the conflicts of each item (size nItems + 1)
+				 * @param adjncy Conflicting item IDs (base 0)
+				 */
+				void balanceColours(const std::vector<I>& xadj, const std::vector<I>& adjncy);
+
+				/**
+				 * Group the items by colour and compute the colour imbalance
+				 */
+				void groupColours();
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "GraphColouring.ipp"
+
+#endif
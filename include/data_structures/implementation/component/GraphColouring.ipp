@@ -0,0 +1,33 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the GraphColouring class
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_GRAPH_COLOURING_IPP_H
+#define CUPCFD_DATA_STRUCTURES_GRAPH_COLOURING_IPP_H
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		template <class I>
+		template <class T>
+		cupcfd::error::eCodes GraphColouring<I>::colourGraph(AdjacencyListCSR<I,T>& graph, I distance, bool balance) {
+			cupcfd::error::eCodes status;
+
+			status = this->colourGraph(graph.xadj.data(), graph.adjncy.data(), graph.nNodes, (I) 0, distance, balance);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+#endif
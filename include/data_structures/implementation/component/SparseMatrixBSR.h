@@ -0,0 +1,314 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the SparseMatrixBSR class
+ *
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXBSR_INCLUDE_H
+#define CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXBSR_INCLUDE_H
+
+#include <vector>
+#include "SparseMatrix.h"
+#include "SparseMatrixSource.h"
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		/**
+		 * Stores Sparse Matrix data in a Block CSR (BSR) Format.
+		 *
+		 * The matrix is divided into dense B x B blocks, and the non-zero blocks are stored
+		 * in CSR fashion - one column index per block rather than per value. This suits
+		 * coupled systems where each cell pair contributes a dense block (e.g. 3x3 or 4x4 for
+		 * velocity/pressure), and lets the kernels operate on fixed-size blocks.
+		 *
+		 * The scalar (CRTP) interface behaves as for the other formats, using scalar row/column
+		 * indexes with the base index applied. Since whole blocks are stored, setting a value
+		 * in a new block stores the rest of that block as explicit zeroes, and these are
+		 * reported as part of the row structure (and counted in nnz).
+		 *
+		 * The block methods use 0-based block row/column indexes.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The type of the stored node data
+		 * @tparam B The block size (blocks are B x B)
+		 */
+		template <class I, class T, int B>
+		class SparseMatrixBSR : public SparseMatrix<SparseMatrixBSR<I,T,B>,I,T>
+		{
+			public:
+				// === Members ===
+
+				/** Number of block rows (m / B) **/
+				I mb;
+
+				/** Number of block columns (n / B) **/
+				I nb;
+
+				/** Index pointers into blockCol for each block row (size mb + 1) **/
+				std::vector<I> rowPtr;
+
+				/** Block column indexes (0-based), in ascending order within a block row **/
+				std::vector<I> blockCol;
+
+				/** Block values - B * B per block, each block stored row-major **/
+				std::vector<T> val;
+
+				/** Inverted diagonal blocks for block-Jacobi - B * B per block row **/
+				std::vector<T> invDiag;
+
+				/** Workspace for block-Jacobi sweeps **/
+				std::vector<T> work;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Construct a SparseMatrixBSR object.
+				 * Create a default matrix of a single block (size B, B) and a base index of 0
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam B The block size (blocks are B x B)
+				 */
+				SparseMatrixBSR();
+
+				/**
+				 * Create a sparse matrix BSR object of a specific size and
+				 * a base index of 0
+				 *
+				 * @param m Number of rows - must be a multiple of B
+				 * @param n Number of columns - must be a multiple of B
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam B The block size (blocks are B x B)
+				 */
+				SparseMatrixBSR(I m, I n);
+
+				/**
+				 * Create a sparse matrix BSR object of a specific size and
+				 * base index
+				 *
+				 * @param m Number of rows - must be a multiple of B
+				 * @param n Number of columns - must be a multiple of B
+				 * @param baseIndex The base index to use for the matrix indexing scheme
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam B The block size (blocks are B x B)
+				 */
+				SparseMatrixBSR(I m, I n, I baseIndex);
+
+				/**
+				 * Deconstructor for the SparseMatrixBSR object.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam B The block size (blocks are B x B)
+				 */
+				~SparseMatrixBSR();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Find where a block is stored.
+				 *
+				 * @param blockRow The 0-based block row index
+				 * @param blockColumn The 0-based block column index
+				 * @param index Set to the position of the block in blockCol (multiply by B * B for its offset in val),
+				 * or -1 if the block is not stored
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam B The block size (blocks are B x B)
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The search completed (whether or not the block was found)
+				 * @retval cupcfd::error::E_MATRIX_ROW_OOB The block row is outside the matrix
+				 * @retval cupcfd::error::E_MATRIX_COL_OOB The block column is outside the matrix
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getBlockIndex(I blockRow, I blockColumn, I * index);
+
+				/**
+				 * Set the values of a whole block, inserting the block if it does not exist.
+				 *
+				 * @param blockRow The 0-based block row index
+				 * @param blockColumn The 0-based block column index
+				 * @param block The B * B block values, row-major
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam B The block size (blocks are B x B)
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The block was set
+				 * @retval cupcfd::error::E_MATRIX_ROW_OOB The block row is outside the matrix
+				 * @retval cupcfd::error::E_MATRIX_COL_OOB The block column is outside the matrix
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setBlock(I blockRow, I blockColumn, const T * block);
+
+				/**
+				 * Get the values of a whole block. Blocks that are not stored are returned as zeroes.
+				 *
+				 * @param blockRow The 0-based block row index
+				 * @param blockColumn The 0-based block column index
+				 * @param block Array of size B * B to store the block values in, row-major
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam B The block size (blocks are B x B)
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The block was retrieved
+				 * @retval cupcfd::error::E_MATRIX_ROW_OOB The block row is outside the matrix
+				 * @retval cupcfd::error::E_MATRIX_COL_OOB The block column is outside the matrix
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getBlock(I blockRow, I blockColumn, T * block);
+
+				/**
+				 * Build the matrix from a scalar matrix source, such as one generated from the
+				 * cell connectivity of a mesh (SparseMatrixSourceMeshGen).
+				 *
+				 * The source provides the cell-level coupling, and each of its entries a(i,j) becomes
+				 * the block a(i,j) * Identity(B) - i.e. the resulting matrix is the Kronecker product of
+				 * the source matrix with the B x B identity. This gives the block structure of a
+				 * coupled system on the same mesh, with the components initially decoupled.
+				 * Any existing contents are discarded, and the base index is taken from the source.
+				 *
+				 * @param source The source of the cell-level matrix
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam B The block size (blocks are B x B)
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The matrix was built successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes fromSource(SparseMatrixSource<I,T>& source);
+
+				/**
+				 * Compute the sparse matrix-vector product y = Ax, one block row at a time.
+				 * Block rows are distributed across OpenMP threads.
+				 *
+				 * @param x The vector to multiply by, indexed from 0 by column
+				 * @param nX The size of x - must match the number of matrix columns
+				 * @param y The array to store the result in, indexed from 0 by row
+				 * @param nY The size of y - must match the number of matrix rows
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam B The block size (blocks are B x B)
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The product was computed successfully
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The vector sizes do not match the matrix dimensions
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes multiply(const T * x, I nX, T * y, I nY);
+
+				/**
+				 * Invert the diagonal blocks ready for block-Jacobi.
+				 * This must be called again whenever the values of the diagonal blocks change.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam B The block size (blocks are B x B)
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The diagonal blocks were inverted
+				 * @retval cupcfd::error::E_MATRIX_INVALID_ROW_SIZE The matrix is not square
+				 * @retval cupcfd::error::E_MATRIX_SINGULAR_BLOCK A diagonal block is missing or singular
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setupBlockJacobi();
+
+				/**
+				 * Apply the block-Jacobi preconditioner, z = D^-1 r, where D is the
+				 * block diagonal of the matrix.
+				 * setupBlockJacobi must have been called first.
+				 *
+				 * @param r The vector to precondition
+				 * @param nR The size of r - must match the number of matrix rows
+				 * @param z The array to store the result in
+				 * @param nZ The size of z - must match the number of matrix rows
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam B The block size (blocks are B x B)
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The preconditioner was applied
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The vector sizes do not match the matrix dimensions
+				 * @retval cupcfd::error::E_MATRIX_SINGULAR_BLOCK setupBlockJacobi has not been called
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes applyBlockJacobi(const T * r, I nR, T * z, I nZ);
+
+				/**
+				 * Perform block-Jacobi sweeps on Ax = b, x = x + D^-1 (b - Ax).
+				 * setupBlockJacobi must have been called first.
+				 *
+				 * @param b The right hand side vector
+				 * @param nB The size of b - must match the number of matrix rows
+				 * @param x The current solution, updated in place
+				 * @param nX The size of x - must match the number of matrix rows
+				 * @param nSweeps The number of sweeps to perform
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam B The block size (blocks are B x B)
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The sweeps were performed
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The vector sizes do not match the matrix dimensions
+				 * @retval cupcfd::error::E_MATRIX_SINGULAR_BLOCK setupBlockJacobi has not been called
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes blockJacobi(const T * b, I nB, T * x, I nX, I nSweeps);
+
+				// === CRTP Methods ===
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes resize(I rows, I columns);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes clear();
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setElement(I row, I col, T val);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setElements(const I * rows, const I * cols, const T * vals, I nVals);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getElement(I row, I col, T * val);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getNonZeroRowIndexes(I ** rowIndexes, I * nRowIndexes);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getRowColumnIndexes(I row, I ** columnIndexes, I * nColumnIndexes);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getRowNNZValues(I row, T ** nnzValues, I * nNNZValues);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "SparseMatrixBSR.ipp"
+
+#endif
@@ -0,0 +1,293 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the header level definitions for the SparseMatrixBSR class
+ *
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXBSR_IPP_H
+#define CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXBSR_IPP_H
+
+#include <cstdlib>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		template <class I, class T, int B>
+		inline cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::getBlockIndex(I blockRow, I blockColumn, I * index) {
+			if(blockRow < 0 || blockRow >= this->mb) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			if(blockColumn < 0 || blockColumn >= this->nb) {
+				return cupcfd::error::E_MATRIX_COL_OOB;
+			}
+
+			*index = -1;
+
+			// Block columns are sorted, so stop once past the target
+			for(I k = this->rowPtr[blockRow]; k < this->rowPtr[blockRow + 1]; k++) {
+				if(this->blockCol[k] == blockColumn) {
+					*index = k;
+					break;
+				}
+
+				if(this->blockCol[k] > blockColumn) {
+					break;
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		inline cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::setBlock(I blockRow, I blockColumn, const T * block) {
+			cupcfd::error::eCodes status;
+			I index;
+
+			status = this->getBlockIndex(blockRow, blockColumn, &index);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			if(index < 0) {
+				// Insert a new block at the sorted position within the block row.
+				// As with CSR this shifts all later blocks, so it is recommended to
+				// build the structure once (e.g. via fromSource) and then only update values.
+				index = this->rowPtr[blockRow + 1];
+				for(I k = this->rowPtr[blockRow]; k < this->rowPtr[blockRow + 1]; k++) {
+					if(this->blockCol[k] > blockColumn) {
+						index = k;
+						break;
+					}
+				}
+
+				this->blockCol.insert(this->blockCol.begin() + index, blockColumn);
+				this->val.insert(this->val.begin() + (index * B * B), B * B, T(0));
+
+				for(I i = blockRow + 1; i <= this->mb; i++) {
+					this->rowPtr[i] = this->rowPtr[i] + 1;
+				}
+
+				this->nnz = this->nnz + (B * B);
+			}
+
+			for(I i = 0; i < B * B; i++) {
+				this->val[(index * B * B) + i] = block[i];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		inline cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::getBlock(I blockRow, I blockColumn, T * block) {
+			cupcfd::error::eCodes status;
+			I index;
+
+			status = this->getBlockIndex(blockRow, blockColumn, &index);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			for(I i = 0; i < B * B; i++) {
+				if(index < 0) {
+					block[i] = T(0);
+				}
+				else {
+					block[i] = this->val[(index * B * B) + i];
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		inline cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::resize(I rows, I columns) {
+			cupcfd::error::eCodes status;
+
+			if(rows < 1 || (rows % B) != 0) return cupcfd::error::E_MATRIX_INVALID_ROW_SIZE;
+			if(columns < 1 || (columns % B) != 0) return cupcfd::error::E_MATRIX_INVALID_COL_SIZE;
+
+			// Update Max Capacity
+			this->m = rows;
+			this->n = columns;
+
+			status = this->clear();
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		inline cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::clear() {
+			this->mb = this->m / B;
+			this->nb = this->n / B;
+
+			// Reset to a structure with no stored blocks
+			this->rowPtr.assign(this->mb + 1, 0);
+			this->blockCol.clear();
+			this->val.clear();
+			this->invDiag.clear();
+
+			// Reset the number of non-zero values
+			this->nnz = 0;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		inline cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::setElement(I row, I col, T val) {
+			cupcfd::error::eCodes status;
+
+			// Error Check: Within Range -- Greater than baseIndex
+			if((row < this->baseIndex) || (row >= this->baseIndex + this->m)) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			if((col < this->baseIndex) || (col >= this->baseIndex + this->n)) {
+				return cupcfd::error::E_MATRIX_COL_OOB;
+			}
+
+			I r = row - this->baseIndex;
+			I c = col - this->baseIndex;
+			I index;
+
+			status = this->getBlockIndex(r / B, c / B, &index);
+			CHECK_ECODE(status)
+
+			if(index < 0) {
+				// Add a zero block to hold the value
+				T zero[B * B] = {};
+
+				status = this->setBlock(r / B, c / B, zero);
+				CHECK_ECODE(status)
+
+				status = this->getBlockIndex(r / B, c / B, &index);
+				CHECK_ECODE(status)
+			}
+
+			this->val[(index * B * B) + ((r % B) * B) + (c % B)] = val;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		inline cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::getElement(I row, I col, T * val) {
+			cupcfd::error::eCodes status;
+
+			// Error Check: Ensure we are within range
+			if((row < this->baseIndex) || (row >= this->baseIndex + this->m)) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			if((col < this->baseIndex) || (col >= this->baseIndex + this->n)) {
+				return cupcfd::error::E_MATRIX_COL_OOB;
+			}
+
+			I r = row - this->baseIndex;
+			I c = col - this->baseIndex;
+			I index;
+
+			status = this->getBlockIndex(r / B, c / B, &index);
+			CHECK_ECODE(status)
+
+			if(index < 0) {
+				// Not a non-zero value
+				*val = 0.0;
+			}
+			else {
+				*val = this->val[(index * B * B) + ((r % B) * B) + (c % B)];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		inline cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::getNonZeroRowIndexes(I ** rowIndexes, I * nRowIndexes) {
+			// First pass
+			// Count number of block rows with stored blocks - every scalar row in them is non-zero
+			I count = 0;
+			for(I i = 0; i < this->mb; i++) {
+				if((this->rowPtr[i+1] - this->rowPtr[i]) > 0) {
+					count = count + B;
+				}
+			}
+
+			// Allocate memory
+			*nRowIndexes = count;
+			*rowIndexes = (I *) malloc(sizeof(I) * count);
+
+			// Second pass
+			// Set the scalar row indexes, including any matrix index offset
+			count = 0;
+			for(I i = 0; i < this->mb; i++) {
+				if((this->rowPtr[i+1] - this->rowPtr[i]) > 0) {
+					for(I r = 0; r < B; r++) {
+						(*rowIndexes)[count] = (i * B) + r + this->baseIndex;
+						count = count + 1;
+					}
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		inline cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::getRowColumnIndexes(I row, I ** columnIndexes, I * nColumnIndexes) {
+			if((row - this->baseIndex) >= this->m || (row - this->baseIndex) < 0) {
+				// The row does not exist - error
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			I blockRow = (row - this->baseIndex) / B;
+			I start = this->rowPtr[blockRow];
+			I nBlocks = this->rowPtr[blockRow + 1] - start;
+
+			// Every column of each stored block in this block row
+			*nColumnIndexes = nBlocks * B;
+			*columnIndexes = (I *) malloc(sizeof(I) * nBlocks * B);
+
+			for(I k = 0; k < nBlocks; k++) {
+				for(I c = 0; c < B; c++) {
+					(*columnIndexes)[(k * B) + c] = (this->blockCol[start + k] * B) + c + this->baseIndex;
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		inline cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::getRowNNZValues(I row, T ** nnzValues, I * nNNZValues) {
+			if((row - this->baseIndex) >= this->m || (row - this->baseIndex) < 0) {
+				// The row does not exist - error
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			I blockRow = (row - this->baseIndex) / B;
+			I r = (row - this->baseIndex) % B;
+			I start = this->rowPtr[blockRow];
+			I nBlocks = this->rowPtr[blockRow + 1] - start;
+
+			// Row r of each stored block in this block row
+			*nNNZValues = nBlocks * B;
+			*nnzValues = (T *) malloc(sizeof(T) * nBlocks * B);
+
+			for(I k = 0; k < nBlocks; k++) {
+				for(I c = 0; c < B; c++) {
+					(*nnzValues)[(k * B) + c] = this->val[((start + k) * B * B) + (r * B) + c];
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+#endif
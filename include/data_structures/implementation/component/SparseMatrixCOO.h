@@ -22,6 +22,10 @@ namespace cupcfd
 {
 	namespace data_structures
 	{
+		// Forward declaration for conversion
+		template <class I, class T>
+		class SparseMatrixCSR;
+
 		/**
 		 * Stores Sparse Matrix data in a COO Format
 		 *
@@ -79,6 +83,16 @@ namespace cupcfd
 				 */
 				SparseMatrixCOO(I m, I n, I baseIndex);
 
+				/**
+				 * Create a sparse matrix COO object from a sparse matrix CSR object.
+				 * The size, base index and non-zero values are copied from the CSR matrix.
+				 *
+				 * @param matrix The CSR matrix to convert
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixCOO(SparseMatrixCSR<I,T>& matrix);
 
 				/**
 				 * Deconstructor for the SparseMatrixCOO object.
@@ -88,6 +102,27 @@ namespace cupcfd
 				 */
 				~SparseMatrixCOO();
 
+				// === Concrete Methods ===
+
+				/**
+				 * Compute the sparse matrix-vector product y = Ax.
+				 * Entries are accumulated serially in storage order.
+				 *
+				 * @param x The vector to multiply by, indexed from 0 by column
+				 * @param nX The size of x - must match the number of matrix columns
+				 * @param y The array to store the result in, indexed from 0 by row
+				 * @param nY The size of y - must match the number of matrix rows
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The product was computed successfully
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The vector sizes do not match the matrix dimensions
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes multiply(const T * x, I nX, T * y, I nY);
+
 				// === CRTP Methods ===
 
 				__attribute__((warn_unused_result))
@@ -99,6 +134,29 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				inline cupcfd::error::eCodes setElement(I row, I col, T val);
 
+				/**
+				 * Set a batch of elements in the matrix.
+				 * The batch is merged with the existing entries via a CSR build, rather than
+				 * a sorted insertion per element.
+				 * Entries that already exist in the matrix are overwritten. Where the batch contains
+				 * more than one value for the same index, the values are summed.
+				 *
+				 * @param rows The row indexes of the elements, starting from the matrix base index
+				 * @param cols The column indexes of the elements, starting from the matrix base index
+				 * @param vals The values of the elements
+				 * @param nVals The number of elements in the batch
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_MATRIX_ROW_OOB A row index is outside the matrix index range
+				 * @retval cupcfd::error::E_MATRIX_COL_OOB A column index is outside the matrix index range
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setElements(const I * rows, const I * cols, const T * vals, I nVals);
+
 				__attribute__((warn_unused_result))
 				inline cupcfd::error::eCodes getElement(I row, I col, T * val);
 
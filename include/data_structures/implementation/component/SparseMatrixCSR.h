@@ -22,6 +22,10 @@ namespace cupcfd
 {
 	namespace data_structures
 	{
+		// Forward declaration for conversion
+		template <class I, class T>
+		class SparseMatrixCOO;
+
 		/**
 		 * Stores Sparse Matrix data in a CSR Format
 		 *
@@ -81,6 +85,19 @@ namespace cupcfd
 				 */
 				SparseMatrixCSR(I m, I n, I baseIndex);
 
+				/**
+				 * Create a sparse matrix CSR object from a sparse matrix COO object.
+				 * The size, base index and non-zero values are copied from the COO matrix.
+				 *
+				 * This builds the CSR structure in a single pass via setElements, and
+				 * is the recommended way to construct a CSR matrix from unordered entries.
+				 *
+				 * @param matrix The COO matrix to convert
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixCSR(SparseMatrixCOO<I,T>& matrix);
 
 				/**
 				 * Deconstructor for the SparseMatrixCSR object.
@@ -90,6 +107,53 @@ namespace cupcfd
 				 */
 				~SparseMatrixCSR();
 
+				// === Concrete Methods ===
+
+				/**
+				 * Compute the sparse matrix-vector product y = Ax.
+				 * Rows are distributed across OpenMP threads.
+				 *
+				 * @param x The vector to multiply by, indexed from 0 by column
+				 * @param nX The size of x - must match the number of matrix columns
+				 * @param y The array to store the result in, indexed from 0 by row
+				 * @param nY The size of y - must match the number of matrix rows
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The product was computed successfully
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The vector sizes do not match the matrix dimensions
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes multiply(const T * x, I nX, T * y, I nY);
+
+				/**
+				 * Compute the residual r = b - Ax and the sum of its squared entries in a single
+				 * pass over the matrix. Rows are distributed across OpenMP threads, and the squared
+				 * sum is reduced across them.
+				 *
+				 * The squared sum is returned rather than the norm, so that it can be summed across
+				 * ranks before taking the square root when the rows are distributed.
+				 *
+				 * @param x The vector to multiply by, indexed from 0 by column
+				 * @param nX The size of x - must match the number of matrix columns
+				 * @param b The right-hand-side vector, indexed from 0 by row
+				 * @param nB The size of b - must match the number of matrix rows
+				 * @param r The array to store the residual in, indexed from 0 by row
+				 * @param nR The size of r - must match the number of matrix rows
+				 * @param rNormSq The location to store the sum of the squared residual entries
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The residual was computed successfully
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The vector sizes do not match the matrix dimensions
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes residual(const T * x, I nX, const T * b, I nB, T * r, I nR, T * rNormSq);
+
 				// === CRTP Methods ===
 
 				__attribute__((warn_unused_result))
@@ -101,6 +165,29 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes setElement(I row, I col, T val);
 
+				/**
+				 * Set a batch of elements in the matrix.
+				 * Entries are bucketed by row and each row is sorted by column in parallel, so the
+				 * matrix is built in O(nnz log nnz) rather than shifting the storage for every insertion.
+				 * Entries that already exist in the matrix are overwritten. Where the batch contains
+				 * more than one value for the same index, the values are summed.
+				 *
+				 * @param rows The row indexes of the elements, starting from the matrix base index
+				 * @param cols The column indexes of the elements, starting from the matrix base index
+				 * @param vals The values of the elements
+				 * @param nVals The number of elements in the batch
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_MATRIX_ROW_OOB A row index is outside the matrix index range
+				 * @retval cupcfd::error::E_MATRIX_COL_OOB A column index is outside the matrix index range
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setElements(const I * rows, const I * cols, const T * vals, I nVals);
+
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes getElement(I row, I col, T * val);
 
@@ -208,7 +208,7 @@ namespace cupcfd
 				// Done
 				return cupcfd::error::E_SUCCESS;
 			}
-			else if(status == cupcfd::error::E_SEARCH_SUCCESS) {
+			else if(status == cupcfd::error::E_SUCCESS) {
 				// Value already exists, so we just need to overwrite
 				this->A[start + colFoundIndex] = val;
 				return cupcfd::error::E_SUCCESS;
@@ -260,7 +260,7 @@ namespace cupcfd
 				*val = 0.0;
 				return cupcfd::error::E_SUCCESS;
 			}
-			else if(status == cupcfd::error::E_SEARCH_SUCCESS) {
+			else if(status == cupcfd::error::E_SUCCESS) {
 				// colFoundIndex should hold the offset where the non-zero value is stored since the column
 				// and nnz are stored at the same indexes in their respective vectors
 				*val = this->A[start + colFoundIndex];
@@ -0,0 +1,236 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the SparseMatrixSELL class
+ *
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXSELL_INCLUDE_H
+#define CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXSELL_INCLUDE_H
+
+#include <vector>
+#include "SparseMatrix.h"
+#include "SparseMatrixCSR.h"
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		/**
+		 * Stores Sparse Matrix data in a Sliced ELLPACK (SELL-C-sigma) Format.
+		 *
+		 * Rows are grouped into chunks of C consecutive rows. Each chunk is padded to the
+		 * length of its longest row and stored column-major, so that entry j of every row
+		 * in a chunk is contiguous in memory. This allows the SpMV kernel to process the C
+		 * rows of a chunk in SIMD lanes (C should be a multiple of the vector width, e.g.
+		 * 4 or 8 doubles for AVX2/AVX-512).
+		 *
+		 * To reduce the amount of padding, rows are sorted by descending length within
+		 * windows of S rows before being chunked. The permutation is recorded and undone
+		 * when results are written, so the sorting is not visible through the public interface.
+		 * S = 1 disables sorting.
+		 *
+		 * Column indexes are stored internally without the base index.
+		 *
+		 * Modifying the value of an existing non-zero is cheap, but inserting a new non-zero
+		 * requires a rebuild of the structure - it is recommended to build the matrix in a
+		 * different format (e.g. CSR) and convert once built.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The type of the stored node data
+		 * @tparam C The chunk height (number of rows per chunk)
+		 * @tparam S The sorting window size (sigma), in rows
+		 */
+		template <class I, class T, int C, int S>
+		class SparseMatrixSELL : public SparseMatrix<SparseMatrixSELL<I,T,C,S>,I,T>
+		{
+			public:
+				// === Members ===
+
+				/** Number of chunks **/
+				I nChunks;
+
+				/** Offsets into val/col for the start of each chunk (size nChunks + 1) **/
+				std::vector<I> chunkPtr;
+
+				/** Padded width (number of stored columns) of each chunk **/
+				std::vector<I> chunkWidth;
+
+				/** Matrix values, column-major within each chunk, zero-padded **/
+				std::vector<T> val;
+
+				/** Column indexes (without the base index), column-major within each chunk **/
+				std::vector<I> col;
+
+				/** Number of non-zeroes in each row, indexed by sorted position **/
+				std::vector<I> rowLength;
+
+				/** Maps a sorted row position to its original (0-based) row index **/
+				std::vector<I> perm;
+
+				/** Maps an original (0-based) row index to its sorted row position **/
+				std::vector<I> invPerm;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Construct a SparseMatrixSELL object.
+				 * Create a default matrix with a size of 1,1 and a base index of 0
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam C The chunk height (number of rows per chunk)
+				 * @tparam S The sorting window size (sigma), in rows
+				 */
+				SparseMatrixSELL();
+
+				/**
+				 * Create a sparse matrix SELL object of a specific size and
+				 * a base index of 0
+				 *
+				 * @param m Number of rows
+				 * @param n Number of columns
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam C The chunk height (number of rows per chunk)
+				 * @tparam S The sorting window size (sigma), in rows
+				 */
+				SparseMatrixSELL(I m, I n);
+
+				/**
+				 * Create a sparse matrix SELL object of a specific size and
+				 * base index
+				 *
+				 * @param m Number of rows
+				 * @param n Number of columns
+				 * @param baseIndex The base index to use for the matrix indexing scheme
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam C The chunk height (number of rows per chunk)
+				 * @tparam S The sorting window size (sigma), in rows
+				 */
+				SparseMatrixSELL(I m, I n, I baseIndex);
+
+				/**
+				 * Deconstructor for the SparseMatrixSELL object.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam C The chunk height (number of rows per chunk)
+				 * @tparam S The sorting window size (sigma), in rows
+				 */
+				~SparseMatrixSELL();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Replace the contents of this matrix with those of a CSR matrix.
+				 * The size, base index and non-zero structure are all taken from the source.
+				 *
+				 * @param source The CSR matrix to convert from
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam C The chunk height (number of rows per chunk)
+				 * @tparam S The sorting window size (sigma), in rows
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The matrix was converted successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes fromCSR(SparseMatrixCSR<I,T>& source);
+
+				/**
+				 * Copy the contents of this matrix into a CSR matrix.
+				 * Any existing contents of the destination are discarded.
+				 *
+				 * @param dest The CSR matrix to convert to
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam C The chunk height (number of rows per chunk)
+				 * @tparam S The sorting window size (sigma), in rows
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The matrix was converted successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes toCSR(SparseMatrixCSR<I,T>& dest);
+
+				/**
+				 * Compute the sparse matrix-vector product y = Ax.
+				 * Chunks are distributed across OpenMP threads, and the C rows of a chunk
+				 * are computed in SIMD lanes.
+				 *
+				 * @param x The vector to multiply by, indexed from 0 by column
+				 * @param nX The size of x - must match the number of matrix columns
+				 * @param y The array to store the result in, indexed from 0 by row
+				 * @param nY The size of y - must match the number of matrix rows
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam C The chunk height (number of rows per chunk)
+				 * @tparam S The sorting window size (sigma), in rows
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The product was computed successfully
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The vector sizes do not match the matrix dimensions
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes multiply(const T * x, I nX, T * y, I nY);
+
+				/**
+				 * Get the number of stored entries, including padding.
+				 * The ratio of this to the number of non-zeroes indicates the padding overhead.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 * @tparam C The chunk height (number of rows per chunk)
+				 * @tparam S The sorting window size (sigma), in rows
+				 *
+				 * @return The number of stored entries
+				 */
+				I getNStoredEntries();
+
+				// === CRTP Methods ===
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes resize(I rows, I columns);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes clear();
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setElement(I row, I col, T val);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setElements(const I * rows, const I * cols, const T * vals, I nVals);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getElement(I row, I col, T * val);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getNonZeroRowIndexes(I ** rowIndexes, I * nRowIndexes);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getRowColumnIndexes(I row, I ** columnIndexes, I * nColumnIndexes);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getRowNNZValues(I row, T ** nnzValues, I * nNNZValues);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "SparseMatrixSELL.ipp"
+
+#endif
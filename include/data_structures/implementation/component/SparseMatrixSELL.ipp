@@ -0,0 +1,231 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the header level definitions for the SparseMatrixSELL class
+ *
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXSELL_IPP_H
+#define CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXSELL_IPP_H
+
+#include <cstdlib>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		template <class I, class T, int C, int S>
+		inline I SparseMatrixSELL<I,T,C,S>::getNStoredEntries() {
+			return this->chunkPtr[this->nChunks];
+		}
+
+		template <class I, class T, int C, int S>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T,C,S>::resize(I rows, I columns) {
+			cupcfd::error::eCodes status;
+
+			if(rows < 1) return cupcfd::error::E_MATRIX_INVALID_ROW_SIZE;
+			if(columns < 1) return cupcfd::error::E_MATRIX_INVALID_COL_SIZE;
+
+			// Update Max Capacity
+			this->m = rows;
+			this->n = columns;
+
+			// Rebuild an empty structure for the new size
+			status = this->clear();
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int C, int S>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T,C,S>::clear() {
+			// Reset to a structure where every chunk has a width of zero
+			this->nChunks = (this->m + C - 1) / C;
+			this->chunkPtr.assign(this->nChunks + 1, 0);
+			this->chunkWidth.assign(this->nChunks, 0);
+			this->val.clear();
+			this->col.clear();
+			this->rowLength.assign(this->m, 0);
+
+			// With no entries, no sorting is required
+			this->perm.resize(this->m);
+			this->invPerm.resize(this->m);
+			for(I i = 0; i < this->m; i++) {
+				this->perm[i] = i;
+				this->invPerm[i] = i;
+			}
+
+			// Reset the number of non-zero values
+			this->nnz = 0;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int C, int S>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T,C,S>::setElement(I row, I col, T val) {
+			cupcfd::error::eCodes status;
+
+			// Error Check: Within Range -- Greater than baseIndex
+			if((row < this->baseIndex) || (row >= this->baseIndex + this->m)) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			if((col < this->baseIndex) || (col >= this->baseIndex + this->n)) {
+				return cupcfd::error::E_MATRIX_COL_OOB;
+			}
+
+			// Locate the row in the sorted ordering
+			I pos = this->invPerm[row - this->baseIndex];
+			I start = this->chunkPtr[pos / C] + (pos % C);
+
+			for(I j = 0; j < this->rowLength[pos]; j++) {
+				if(this->col[start + (j * C)] == (col - this->baseIndex)) {
+					// Value already exists, so we just need to overwrite
+					this->val[start + (j * C)] = val;
+					return cupcfd::error::E_SUCCESS;
+				}
+			}
+
+			// This is a new non-zero, which changes the row lengths (and possibly the sorting and
+			// chunk widths). Rather than shift the padded storage, rebuild it via CSR.
+			// This is expensive - the matrix should be built in another format and converted once built.
+			SparseMatrixCSR<I,T> csr(this->m, this->n, this->baseIndex);
+
+			status = this->toCSR(csr);
+			CHECK_ECODE(status)
+
+			status = csr.setElement(row, col, val);
+			CHECK_ECODE(status)
+
+			status = this->fromCSR(csr);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int C, int S>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T,C,S>::setElements(const I * rows, const I * cols, const T * vals, I nVals) {
+			cupcfd::error::eCodes status;
+
+			// Rebuild once via CSR for the whole batch rather than per new non-zero
+			SparseMatrixCSR<I,T> csr(this->m, this->n, this->baseIndex);
+
+			status = this->toCSR(csr);
+			CHECK_ECODE(status)
+
+			status = csr.setElements(rows, cols, vals, nVals);
+			CHECK_ECODE(status)
+
+			status = this->fromCSR(csr);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int C, int S>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T,C,S>::getElement(I row, I col, T * val) {
+			// Error Check: Ensure we are within range
+			if((row < this->baseIndex) || (row >= this->baseIndex + this->m)) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			if((col < this->baseIndex) || (col >= this->baseIndex + this->n)) {
+				return cupcfd::error::E_MATRIX_COL_OOB;
+			}
+
+			I pos = this->invPerm[row - this->baseIndex];
+			I start = this->chunkPtr[pos / C] + (pos % C);
+
+			for(I j = 0; j < this->rowLength[pos]; j++) {
+				if(this->col[start + (j * C)] == (col - this->baseIndex)) {
+					*val = this->val[start + (j * C)];
+					return cupcfd::error::E_SUCCESS;
+				}
+			}
+
+			// Not a non-zero value
+			*val = 0.0;
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int C, int S>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T,C,S>::getNonZeroRowIndexes(I ** rowIndexes, I * nRowIndexes) {
+			// First pass
+			// Count number of non-zero size rows
+			I count = 0;
+			for(I i = 0; i < this->m; i++) {
+				if(this->rowLength[this->invPerm[i]] > 0) {
+					count = count + 1;
+				}
+			}
+
+			// Allocate memory
+			*nRowIndexes = count;
+			*rowIndexes = (I *) malloc(sizeof(I) * count);
+
+			// Second pass
+			// Set the row indexes that are non-zero, in original row order
+			count = 0;
+			for(I i = 0; i < this->m; i++) {
+				if(this->rowLength[this->invPerm[i]] > 0) {
+					(*rowIndexes)[count] = i + this->baseIndex;
+					count = count + 1;
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int C, int S>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T,C,S>::getRowColumnIndexes(I row, I ** columnIndexes, I * nColumnIndexes) {
+			if((row - this->baseIndex) >= this->m || (row - this->baseIndex) < 0) {
+				// The row does not exist - error
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			I pos = this->invPerm[row - this->baseIndex];
+			I start = this->chunkPtr[pos / C] + (pos % C);
+			I nEle = this->rowLength[pos];
+
+			// Gather the strided entries, restoring the base index
+			*nColumnIndexes = nEle;
+			*columnIndexes = (I *) malloc(sizeof(I) * nEle);
+
+			for(I j = 0; j < nEle; j++) {
+				(*columnIndexes)[j] = this->col[start + (j * C)] + this->baseIndex;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int C, int S>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T,C,S>::getRowNNZValues(I row, T ** nnzValues, I * nNNZValues) {
+			if((row - this->baseIndex) >= this->m || (row - this->baseIndex) < 0) {
+				// The row does not exist - error
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			I pos = this->invPerm[row - this->baseIndex];
+			I start = this->chunkPtr[pos / C] + (pos % C);
+			I nEle = this->rowLength[pos];
+
+			// Gather the strided entries
+			*nNNZValues = nEle;
+			*nnzValues = (T *) malloc(sizeof(T) * nEle);
+
+			for(I j = 0; j < nEle; j++) {
+				(*nnzValues)[j] = this->val[start + (j * C)];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+#endif
@@ -25,13 +25,18 @@
 // Sparse Matrix Source
 #include "SparseMatrixSource.h"
 
+// Mesh
+#include "UnstructuredMeshInterface.h"
+
 namespace cupcfd
 {
 	namespace data_structures
 	{
 		/**
 		 * Specify configuration options required for building Sparse Matrix data
-		 * sources generated based on a mesh structure
+		 * sources generated based on a mesh structure.
+		 *
+		 * See SparseMatrixSourceMeshGen for how the parameters set the matrix values.
 		 */
 		template <class I, class T>
 		class SparseMatrixSourceMeshGenConfig : public SparseMatrixSourceConfig<I,T>
@@ -39,16 +44,22 @@ namespace cupcfd
 			public:
 				// === Members ===
 
+				/** Relative diagonal shift (delta) - used if conditionNumber is not greater than one **/
+				T diagonalDominance;
+
+				/** Target condition number estimate (kappa) - used if greater than one **/
+				T conditionNumber;
+
 				// === Constructor ===
 
 				/**
 				 * Constructor:
 				 * Set values to the parameters provided
 				 *
-				 * @param filePath The file path to where the data source is located
-				 * @param format The expected file format of the data source
+				 * @param diagonalDominance The relative diagonal shift delta (must be >= 0)
+				 * @param conditionNumber The target condition number estimate kappa
 				 */
-				SparseMatrixSourceMeshGenConfig();
+				SparseMatrixSourceMeshGenConfig(T diagonalDominance, T conditionNumber);
 
 				/**
 				 * Constructor:
@@ -65,6 +76,27 @@ namespace cupcfd
 
 				// === Concrete Methods ===
 
+				/**
+				 * Build a sparse matrix source from the cells of a mesh.
+				 * This is a collective operation across the ranks of the mesh communicator,
+				 * and each rank's source only holds the rows of the cells it owns.
+				 *
+				 * @param mesh The finalized mesh to generate the matrix from
+				 * @param matrixSource A pointer to the location where the pointer of the new source will be stored
+				 *
+				 * @tparam M The implementing class of the UnstructuredMeshInterface
+				 * @tparam L The label datatype of the unstructured mesh
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The source was built successfully
+				 * @retval cupcfd::error::E_UNFINALIZED The mesh is not finalized
+				 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The diagonal dominance is negative
+				 */
+				template <class M, class L>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildSparseMatrixSource(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+															  SparseMatrixSource<I,T> ** matrixSource);
+
 				// === Overridden Inherited Methods ===
 
 				void operator=(SparseMatrixSourceMeshGenConfig<I,T>& source);
@@ -72,6 +104,11 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				SparseMatrixSourceMeshGenConfig<I,T> * clone();
 
+				/**
+				 * Generated sources require a mesh - see the mesh overload of this method.
+				 *
+				 * @retval cupcfd::error::E_NOT_IMPLEMENTED A mesh was not provided
+				 */
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes buildSparseMatrixSource(SparseMatrixSource<I,T> ** matrixSource);
 		};
@@ -13,11 +13,31 @@
 #ifndef CUPCFD_DATA_STRUCTURES_SPARSE_MATRIX_SOURCE_MESH_GEN_CONFIG_IPP_H
 #define CUPCFD_DATA_STRUCTURES_SPARSE_MATRIX_SOURCE_MESH_GEN_CONFIG_IPP_H
 
+#include "SparseMatrixSourceMeshGen.h"
+
 namespace cupcfd
 {
 	namespace data_structures
 	{
+		template <class I, class T>
+		template <class M, class L>
+		cupcfd::error::eCodes SparseMatrixSourceMeshGenConfig<I,T>::buildSparseMatrixSource(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+																							 SparseMatrixSource<I,T> ** matrixSource)
+		{
+			cupcfd::error::eCodes status;
+
+			SparseMatrixSourceMeshGen<I,T> * source = new SparseMatrixSourceMeshGen<I,T>(this->diagonalDominance, this->conditionNumber);
+
+			status = source->generate(mesh);
+			if(status != cupcfd::error::E_SUCCESS) {
+				delete(source);
+				return status;
+			}
+
+			*matrixSource = source;
 
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
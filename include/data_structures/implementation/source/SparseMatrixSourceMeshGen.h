@@ -15,10 +15,14 @@
 
 // Library Functions/Objects
 #include <string>
+#include <vector>
 
 // Parent Class
 #include "SparseMatrixSource.h"
 
+// Mesh
+#include "UnstructuredMeshInterface.h"
+
 // Error Codes
 #include "Error.h"
 
@@ -27,7 +31,30 @@ namespace cupcfd
 	namespace data_structures
 	{
 		/**
-		 * Generate a matrix that uses a provided mesh as the basis for its structure
+		 * Generate a matrix that uses a provided mesh as the basis for its structure.
+		 *
+		 * There is one row and column per mesh cell, numbered by the global cell IDs of the
+		 * cell connectivity graph. Each row holds the cell and its face neighbours, with
+		 * Laplacian-like coefficients taken from the face geometry:
+		 *
+		 * c_f = area_f / |x_in - x_ip| for an interior face, and area_f / |x_f - x_ip| for a boundary face
+		 * A(ip,in) = -c_f for each interior face
+		 * A(i,i) = S_i + B_i + shift_i
+		 *
+		 * where S_i and B_i are the sums of c_f over the interior and boundary faces of cell i.
+		 * The matrix is symmetric and, from the Gershgorin bounds, every eigenvalue lies in
+		 * [B_i + shift_i, 2S_i + B_i + shift_i] for some row i. The shift is set by one of:
+		 *
+		 * (a) Diagonal Dominance: shift_i = delta * (S_i + B_i), so each row is dominant by a factor (1 + delta).
+		 * (b) Target Condition Number: a uniform shift = G / (kappa - 1), where G is the largest 2S_i + B_i
+		 * across all ranks, so that the Gershgorin estimate of the condition number is at most kappa.
+		 *
+		 * Generation is done in place on each rank - a rank only generates the rows of the cells
+		 * it owns in the mesh, so the full matrix is never held by a single process. Rows are
+		 * generated in parallel across OpenMP threads.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The type of the stored node data
 		 */
 		template <class I, class T>
 		class SparseMatrixSourceMeshGen : public SparseMatrixSource<I,T>
@@ -35,12 +62,44 @@ namespace cupcfd
 			public:
 				// === Members ===
 
+				/** Relative diagonal shift (delta) - used if conditionNumber is not set **/
+				T diagonalDominance;
+
+				/** Target condition number estimate (kappa) - used if greater than zero **/
+				T conditionNumber;
+
+				/** Gershgorin estimate of the condition number of the generated matrix (0 if not bounded) **/
+				T conditionEstimate;
+
+				/** Number of rows (and columns) in the global matrix **/
+				I nGlobalRows;
+
+				/** Number of non-zero values in the global matrix **/
+				I nGlobalNNZ;
+
+				/** Global index of the first row generated on this rank **/
+				I rowStart;
+
+				/** Offsets of each locally generated row in cols/vals (size local rows + 1) **/
+				std::vector<I> rowPtr;
+
+				/** Global column indexes of the locally generated rows, sorted within each row **/
+				std::vector<I> cols;
+
+				/** Values of the locally generated rows **/
+				std::vector<T> vals;
+
 				// === Constructor ===
 
 				/**
+				 * Constructor:
+				 * Set the coefficient parameters. No rows are held until generate is called.
 				 *
+				 * @param diagonalDominance The relative diagonal shift delta (must be >= 0)
+				 * @param conditionNumber The target condition number estimate kappa (must be > 1 to be used,
+				 * otherwise diagonalDominance is used)
 				 */
-				SparseMatrixSourceMeshGen();
+				SparseMatrixSourceMeshGen(T diagonalDominance, T conditionNumber);
 
 				/**
 				 * Deconstructor.
@@ -49,6 +108,37 @@ namespace cupcfd
 
 				// === Concrete Methods ===
 
+				/**
+				 * Generate the rows of the locally owned cells of a mesh.
+				 * This is a collective operation across the ranks of the mesh communicator.
+				 *
+				 * @param mesh The finalized mesh to generate the matrix from
+				 *
+				 * @tparam M The implementing class of the UnstructuredMeshInterface
+				 * @tparam L The label datatype of the unstructured mesh
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The rows were generated successfully
+				 * @retval cupcfd::error::E_UNFINALIZED The mesh is not finalized
+				 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The diagonal dominance is negative
+				 */
+				template <class M, class L>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes generate(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh);
+
+				/**
+				 * Get the range of global rows that were generated on this rank.
+				 *
+				 * @param startRow A pointer to the location to store the global index of the first row
+				 * (using the base of the source)
+				 * @param nRows A pointer to the location to store the number of rows
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getLocalRowRange(I * startRow, I * nRows);
+
 				// === Inherited Overloads ===
 
 				__attribute__((warn_unused_result))
@@ -63,12 +153,26 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes getMatrixIndicesBase(I * indicesBase);
 
+				/**
+				 * Get the number of non-zero values for every row in the matrix.
+				 * Rows generated on other ranks are reported as having no values.
+				 */
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes getNNZRows(I * rowIndices, I nRowIndices);
 
+				/**
+				 * Retrieve the column indexes of a row. Only rows generated on this rank are available.
+				 *
+				 * @retval cupcfd::error::E_MATRIX_ROW_OOB The row was not generated on this rank
+				 */
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes getRowColumnIndexes(I rowIndex, I ** columnIndexes, I * nColumnIndexes);
 
+				/**
+				 * Retrieve the non-zero values of a row. Only rows generated on this rank are available.
+				 *
+				 * @retval cupcfd::error::E_MATRIX_ROW_OOB The row was not generated on this rank
+				 */
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes getRowNNZValues(I rowIndex, T ** nnzValues, I * nNNZValues);
 
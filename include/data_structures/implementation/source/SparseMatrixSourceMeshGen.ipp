@@ -15,6 +15,10 @@
 
 // Library Functions/Objects
 #include <string>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <limits>
 
 // Parent Class
 #include "SparseMatrixSource.h"
@@ -22,11 +26,268 @@
 // Error Codes
 #include "Error.h"
 
+// Reductions across ranks
+#include "Reduce.h"
+
 namespace cupcfd
 {
 	namespace data_structures
 	{
-	
+		template <class I, class T>
+		template <class M, class L>
+		cupcfd::error::eCodes SparseMatrixSourceMeshGen<I,T>::generate(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh) {
+			cupcfd::error::eCodes status;
+
+			if(!mesh.finalized) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
+			if(this->diagonalDominance < T(0)) {
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			cupcfd::comm::Communicator& comm = *(mesh.cellConnGraph->comm);
+
+			I nOwnedCells = mesh.properties.lOCells;
+			I nCells = mesh.properties.lTCells;
+			I nFaces = mesh.properties.lFaces;
+
+			// Owned cells have a contiguous range of global IDs on each rank
+			this->rowStart = mesh.cellConnGraph->globalOwnedRangeMin;
+			this->nGlobalRows = (I) mesh.cellConnGraph->nGNodes;
+
+			// === Global IDs of all local cells (owned and ghost) ===
+			std::vector<I> globalID(nCells);
+
+			for(I i = 0; i < nCells; i++) {
+				L node;
+				status = mesh.cellConnGraph->connGraph.getLocalIndexNode(i, &node);
+				CHECK_ECODE(status)
+				globalID[i] = mesh.cellConnGraph->nodeToGlobal[node];
+			}
+
+			// === Face Coefficients ===
+			// Face area over the distance between the cell centres (or the face centre for a boundary face)
+			std::vector<T> faceCoeff(nFaces);
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < nFaces; i++) {
+				I ip = mesh.getFaceCell1ID(i);
+				cupcfd::geometry::euclidean::EuclideanPoint<T,3> xp = mesh.getCellCenter(ip);
+				cupcfd::geometry::euclidean::EuclideanPoint<T,3> xn;
+
+				if(mesh.getFaceIsBoundary(i)) {
+					xn = mesh.getFaceCenter(i);
+				}
+				else {
+					xn = mesh.getCellCenter(mesh.getFaceCell2ID(i));
+				}
+
+				cupcfd::geometry::euclidean::EuclideanVector<T,3> d = xn - xp;
+				faceCoeff[i] = mesh.getFaceArea(i) / T(d.length());
+			}
+
+			// === Faces of each owned cell (counting sort) ===
+			std::vector<I> cellFaceXAdj(nOwnedCells + 1, 0);
+
+			for(I i = 0; i < nFaces; i++) {
+				I ip = mesh.getFaceCell1ID(i);
+
+				if(ip < nOwnedCells) {
+					cellFaceXAdj[ip + 1] = cellFaceXAdj[ip + 1] + 1;
+				}
+
+				if(!mesh.getFaceIsBoundary(i)) {
+					I in = mesh.getFaceCell2ID(i);
+
+					if(in < nOwnedCells) {
+						cellFaceXAdj[in + 1] = cellFaceXAdj[in + 1] + 1;
+					}
+				}
+			}
+
+			for(I i = 0; i < nOwnedCells; i++) {
+				cellFaceXAdj[i + 1] = cellFaceXAdj[i + 1] + cellFaceXAdj[i];
+			}
+
+			std::vector<I> cellFaces(cellFaceXAdj[nOwnedCells]);
+			std::vector<I> ptr(cellFaceXAdj.begin(), cellFaceXAdj.end() - 1);
+
+			for(I i = 0; i < nFaces; i++) {
+				I ip = mesh.getFaceCell1ID(i);
+
+				if(ip < nOwnedCells) {
+					cellFaces[ptr[ip]] = i;
+					ptr[ip] = ptr[ip] + 1;
+				}
+
+				if(!mesh.getFaceIsBoundary(i)) {
+					I in = mesh.getFaceCell2ID(i);
+
+					if(in < nOwnedCells) {
+						cellFaces[ptr[in]] = i;
+						ptr[in] = ptr[in] + 1;
+					}
+				}
+			}
+
+			// === Row Sizes ===
+			// Rows are stored in global order, so the local row of an owned cell is its global ID less the range start.
+			// One entry per interior face, plus the diagonal.
+			this->rowPtr.assign(nOwnedCells + 1, 0);
+
+			#pragma omp parallel for schedule(static)
+			for(I c = 0; c < nOwnedCells; c++) {
+				I count = 1;
+
+				for(I k = cellFaceXAdj[c]; k < cellFaceXAdj[c + 1]; k++) {
+					if(!mesh.getFaceIsBoundary(cellFaces[k])) {
+						count = count + 1;
+					}
+				}
+
+				this->rowPtr[(globalID[c] - this->rowStart) + 1] = count;
+			}
+
+			for(I r = 0; r < nOwnedCells; r++) {
+				this->rowPtr[r + 1] = this->rowPtr[r + 1] + this->rowPtr[r];
+			}
+
+			I nnz = this->rowPtr[nOwnedCells];
+			this->cols.resize(nnz);
+			this->vals.resize(nnz);
+
+			// === Row Sums ===
+			// Interior (S) and boundary (B) coefficient sums of each owned cell
+			std::vector<T> interiorSum(nOwnedCells);
+			std::vector<T> boundarySum(nOwnedCells);
+			T maxSpread = T(0);
+
+			#pragma omp parallel for schedule(static) reduction(max:maxSpread)
+			for(I c = 0; c < nOwnedCells; c++) {
+				T s = T(0);
+				T b = T(0);
+
+				for(I k = cellFaceXAdj[c]; k < cellFaceXAdj[c + 1]; k++) {
+					if(mesh.getFaceIsBoundary(cellFaces[k])) {
+						b = b + faceCoeff[cellFaces[k]];
+					}
+					else {
+						s = s + faceCoeff[cellFaces[k]];
+					}
+				}
+
+				interiorSum[c] = s;
+				boundarySum[c] = b;
+				maxSpread = std::max(maxSpread, (T(2) * s) + b);
+			}
+
+			// === Diagonal Shift ===
+			bool useCondition = (this->conditionNumber > T(1));
+			T shift = T(0);
+
+			if(useCondition) {
+				T globalMaxSpread;
+				status = cupcfd::comm::allReduceMax(&maxSpread, 1, &globalMaxSpread, 1, comm);
+				CHECK_ECODE(status)
+
+				shift = globalMaxSpread / (this->conditionNumber - T(1));
+			}
+
+			// === Fill Rows ===
+			// Each row is written by a single thread, and sorted by global column
+			T upper = T(0);
+			T lower = T(0);
+			bool lowerSet = false;
+
+			#pragma omp parallel
+			{
+				std::vector<std::pair<I,T>> entries;
+				T threadUpper = T(0);
+				T threadLower = T(0);
+				bool threadLowerSet = false;
+
+				#pragma omp for schedule(static)
+				for(I c = 0; c < nOwnedCells; c++) {
+					I row = globalID[c] - this->rowStart;
+					T diag = interiorSum[c] + boundarySum[c];
+
+					if(useCondition) {
+						diag = diag + shift;
+					}
+					else {
+						diag = diag * (T(1) + this->diagonalDominance);
+					}
+
+					entries.clear();
+					entries.push_back(std::pair<I,T>(globalID[c], diag));
+
+					for(I k = cellFaceXAdj[c]; k < cellFaceXAdj[c + 1]; k++) {
+						I face = cellFaces[k];
+
+						if(!mesh.getFaceIsBoundary(face)) {
+							I ip = mesh.getFaceCell1ID(face);
+							I in = mesh.getFaceCell2ID(face);
+							I neighbour = (ip == c) ? in : ip;
+
+							entries.push_back(std::pair<I,T>(globalID[neighbour], -faceCoeff[face]));
+						}
+					}
+
+					std::sort(entries.begin(), entries.end());
+
+					for(std::size_t k = 0; k < entries.size(); k++) {
+						this->cols[this->rowPtr[row] + k] = entries[k].first;
+						this->vals[this->rowPtr[row] + k] = entries[k].second;
+					}
+
+					// Gershgorin bounds for this row
+					threadUpper = std::max(threadUpper, diag + interiorSum[c]);
+
+					if(!threadLowerSet || (diag - interiorSum[c]) < threadLower) {
+						threadLower = diag - interiorSum[c];
+						threadLowerSet = true;
+					}
+				}
+
+				#pragma omp critical
+				{
+					upper = std::max(upper, threadUpper);
+
+					if(threadLowerSet && (!lowerSet || threadLower < lower)) {
+						lower = threadLower;
+						lowerSet = true;
+					}
+				}
+			}
+
+			// === Global Values ===
+			status = cupcfd::comm::allReduceAdd(&nnz, 1, &(this->nGlobalNNZ), 1, comm);
+			CHECK_ECODE(status)
+
+			// Ranks without rows should not affect the lower bound, so cannot be the minimum
+			if(!lowerSet) {
+				lower = std::numeric_limits<T>::max();
+			}
+
+			T globalUpper;
+			T globalLower;
+
+			status = cupcfd::comm::allReduceMax(&upper, 1, &globalUpper, 1, comm);
+			CHECK_ECODE(status)
+
+			status = cupcfd::comm::allReduceMin(&lower, 1, &globalLower, 1, comm);
+			CHECK_ECODE(status)
+
+			if(globalLower > T(0)) {
+				this->conditionEstimate = globalUpper / globalLower;
+			}
+			else {
+				this->conditionEstimate = T(0);
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
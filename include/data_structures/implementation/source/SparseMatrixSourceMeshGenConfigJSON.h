@@ -28,7 +28,18 @@ namespace cupcfd
 	{
 		/**
 		 * Defines access for retrieving data from a JSON format for SparseMatrix Source Configurations
-		 * that are specific to file based SparseMatrixSources.
+		 * that are generated from the mesh.
+		 *
+		 * === Fields ===
+		 *
+		 * Required:
+		 * None
+		 *
+		 * Optional:
+		 * DiagonalDominance: Number >= 0. Each diagonal is scaled by (1 + DiagonalDominance). Defaults to 0.
+		 *
+		 * ConditionNumber: Number > 1. Apply a uniform diagonal shift such that the estimated condition
+		 * number of the matrix is at most this value. Overrides DiagonalDominance if set.
 		 */
 		template <class I, class T>
 		class SparseMatrixSourceMeshGenConfigJSON : public SparseMatrixSourceMeshGenConfigSource<I,T>
@@ -38,12 +49,12 @@ namespace cupcfd
 
 				/**
 				 * Define the nested fields to look under for the JSON data in the source file.
-				 * The field "FixedDistribution" is always appended to this.
+				 * The field "SparseMatrixMeshGen" is always appended to this.
 				 *
 				 * E.g. If the contents are "FieldA", "FieldB", then
 				 * any JSON data lookup for "FieldC" in other methods is done
-				 * using [FieldA][FieldB][FixedDistribution] as the root (i.e. the data lookup would
-				 * be [FieldA][FieldB][FixedDistribution][FieldC]
+				 * using [FieldA][FieldB][SparseMatrixMeshGen] as the root (i.e. the data lookup would
+				 * be [FieldA][FieldB][SparseMatrixMeshGen][FieldC]
 				 */
 				std::vector<std::string> topLevel;
 
@@ -63,7 +74,7 @@ namespace cupcfd
 				SparseMatrixSourceMeshGenConfigJSON(std::string configFilePath, std::string * topLevel, int nTopLevel);
 
 				/**
-				 * Parse the JSON record provided for values belonging to a FixedDistribution entry
+				 * Parse the JSON record provided for values belonging to a SparseMatrixMeshGen entry
 				 *
 				 * @param parseJSON The contents of a JSON record with the appropriate fields
 				 */
@@ -88,6 +99,12 @@ namespace cupcfd
 
 				// === Overloaded Methods ===
 
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getDiagonalDominance(T * diagonalDominance);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getConditionNumber(T * conditionNumber);
+
 				void operator=(const SparseMatrixSourceMeshGenConfigJSON<I,T>& source);
 
 				__attribute__((warn_unused_result))
@@ -13,7 +13,9 @@
 #ifndef CUPCFD_DATA_STRUCTURES_ADJACENCY_LIST_INCLUDE_H
 #define CUPCFD_DATA_STRUCTURES_ADJACENCY_LIST_INCLUDE_H
 
-#include <map>
+#include <vector>
+
+#include "FlatHashMap.h"
 #include "Error.h"
 
 namespace cupcfd
@@ -48,10 +50,10 @@ namespace cupcfd
 				// unit testing, so will use two maps as an alternative.
 
 				/** Map Nodes to an internal Index **/
-				std::map<T,I> nodeToIDX;
+				FlatHashMap<T,I> nodeToIDX;
 
-				/** Map Internal Index to Nodes **/
-				std::map<I,T> IDXToNode;
+				/** Map Internal Index to Nodes - the indexes are dense (0 to nNodes-1), so a vector is used **/
+				std::vector<T> IDXToNode;
 
 				// Constructors/Deconstructors
 
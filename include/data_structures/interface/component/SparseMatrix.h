@@ -160,6 +160,30 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				inline cupcfd::error::eCodes setElement(I row, I col, T val);
 
+				/**
+				 * Set a batch of elements in the matrix.
+				 * Entries that already exist in the matrix are overwritten. Where the batch contains
+				 * more than one value for the same index, the values are summed.
+				 *
+				 * @param rows The row indexes of the elements, starting from the matrix base index
+				 * @param cols The column indexes of the elements, starting from the matrix base index
+				 * @param vals The values of the elements
+				 * @param nVals The number of elements in the batch
+				 *
+				 * @tparam C The type of the implementation class for the SparseMatrix.
+				 * This must inherit from this class passing itself as template parameter C, as well as
+				 * providing implementation for the CRTP methods to passthrough to.
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_MATRIX_ROW_OOB A row index is outside the matrix index range
+				 * @retval cupcfd::error::E_MATRIX_COL_OOB A column index is outside the matrix index range
+				 */
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes setElements(const I * rows, const I * cols, const T * vals, I nVals);
+
 				/**
 				 * Retrieve the element stored in the matrix at a specific index
 				 *
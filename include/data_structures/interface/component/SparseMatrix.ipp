@@ -75,6 +75,12 @@ namespace cupcfd
 		{
 			return static_cast<C*>(this)->setElement(row, col, val);
 		}
+
+		template <class C, class I, class T>
+		inline cupcfd::error::eCodes SparseMatrix<C,I,T>::setElements(const I * rows, const I * cols, const T * vals, I nVals)
+		{
+			return static_cast<C*>(this)->setElements(rows, cols, vals, nVals);
+		}
 		
 		template <class C, class I, class T>
 		inline cupcfd::error::eCodes SparseMatrix<C,I,T>::getElement(I row, I col, T * val)
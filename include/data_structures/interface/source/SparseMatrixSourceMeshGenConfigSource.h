@@ -62,6 +62,18 @@ namespace cupcfd
 
 				// === Virtual Methods ===
 
+				/**
+				 * Get the relative diagonal shift (delta) of the generated matrix
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes getDiagonalDominance(T * diagonalDominance) = 0;
+
+				/**
+				 * Get the target condition number estimate (kappa) of the generated matrix
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes getConditionNumber(T * conditionNumber) = 0;
+
 				__attribute__((warn_unused_result))
 				virtual SparseMatrixSourceMeshGenConfigSource<I,T> * clone() = 0;
 				
@@ -80,6 +80,7 @@ namespace cupcfd
 			E_MATRIX_ROW_OOB,
 			E_MATRIX_INVALID_COL_SIZE,
 			E_MATRIX_INVALID_ROW_SIZE,
+			E_MATRIX_SINGULAR_BLOCK,
 			E_PARMETIS_INVALID_NCON,
 			E_PARMETIS_INVALID_NPARTS,
 			E_PARMETIS_INVALID_WORK_ARRAY,
@@ -97,6 +98,8 @@ namespace cupcfd
 			E_LINEARSOLVER_INVALID_COMM,
 			E_LINEARSOLVER_INVALID_VECTOR,
 			E_LINEARSOLVER_INVALID_MATRIX,
+			E_LINEARSOLVER_ZERO_PIVOT,
+			E_LINEARSOLVER_INVALID_PRECONDITIONER,
 			E_ARRAY_INCORRECT_SIZE,
 			E_ARRAY_MISMATCH_SIZE,
 			E_INVALID_INDEX,
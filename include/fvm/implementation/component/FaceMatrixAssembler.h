@@ -0,0 +1,158 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the FaceMatrixAssembler class
+ */
+
+#ifndef CUPCFD_FVM_FACE_MATRIX_ASSEMBLER_INCLUDE_H
+#define CUPCFD_FVM_FACE_MATRIX_ASSEMBLER_INCLUDE_H
+
+#include <vector>
+
+#include "UnstructuredMeshInterface.h"
+#include "SparseMatrixCSR.h"
+#include "GraphColouring.h"
+#include "ArrayDrivers.h"
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace fvm
+	{
+		/**
+		 * Assembles a cell-centred matrix from per-face coefficients, such as the
+		 * rface array produced by FluxMassDolfynFaceLoop.
+		 *
+		 * Assembly is split into two phases, since the sparsity of the matrix is fixed
+		 * by the mesh and does not change between steps:
+		 *
+		 * (1) Symbolic - run once per mesh. Builds the CSR pattern of the matrix from the face->cell
+		 * connectivity (the diagonal of each owned cell, plus one entry per neighbouring cell) and records,
+		 * for every face, the positions in the CSR value array of its (ip,in), (in,ip), (ip,ip) and (in,in)
+		 * entries. The faces are also coloured such that no two faces of the same colour share a cell.
+		 *
+		 * (2) Numeric - run every step. Scatters the face coefficients directly into the value array via
+		 * the recorded positions, with no searching. Each colour is processed in parallel across OpenMP threads
+		 * without atomics.
+		 *
+		 * For face i with coefficients rface[2i] and rface[2i+1], the contributions are:
+		 * A(ip,in) += rface[2i], A(ip,ip) -= rface[2i], A(in,ip) += rface[2i+1], A(in,in) -= rface[2i+1]
+		 *
+		 * The matrix rows are the locally owned cells and the columns are all local cells (owned and ghost),
+		 * both using the local cell IDs of the mesh. Contributions to the rows of ghost cells are not stored,
+		 * since they are assembled by the rank that owns the cell.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The datatype of the matrix
+		 */
+		template <class I, class T>
+		class FaceMatrixAssembler
+		{
+			public:
+				// === Members ===
+
+				/** Number of faces the slot map was built for **/
+				I nFaces;
+
+				/** Number of non-zero values in the matrix pattern built by the symbolic phase **/
+				I nnz;
+
+				/**
+				 * Positions in the CSR value array for each face - four per face, for the
+				 * (ip,in), (in,ip), (ip,ip) and (in,in) entries in that order.
+				 * Set to -1 where the entry is not stored locally (boundary faces, ghost rows).
+				 **/
+				std::vector<I> faceSlots;
+
+				/** Number of face colours **/
+				I nColours;
+
+				/** Offsets into colourFaces for the faces of each colour (size nColours + 1) **/
+				std::vector<I> colourXAdj;
+
+				/** Face IDs grouped by colour. Only faces that contribute to the local matrix are included. **/
+				std::vector<I> colourFaces;
+
+				/** Size of the largest colour divided by the mean colour size **/
+				double colourImbalance;
+
+				/** Whether the symbolic phase has been run **/
+				bool symbolicBuilt;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Create an assembler with no pattern - the symbolic phase must be run before
+				 * any numeric assembly.
+				 */
+				FaceMatrixAssembler();
+
+				/**
+				 * Deconstructor
+				 */
+				~FaceMatrixAssembler();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Symbolic Phase: Build the matrix pattern and face slot map for a mesh.
+				 * The matrix is resized to (owned cells x local cells) and its values are set to zero.
+				 *
+				 * @param mesh The finalized mesh to build the pattern for
+				 * @param matrix The matrix to build the pattern in. Its base index is preserved.
+				 *
+				 * @tparam M The implementing class of the UnstructuredMeshInterface
+				 * @tparam L The label datatype of the unstructured mesh
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The pattern was built successfully
+				 * @retval cupcfd::error::E_UNFINALIZED The mesh has not been finalized
+				 */
+				template <class M, class L>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes symbolic(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+											   cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix);
+
+				/**
+				 * Numeric Phase: Zero the matrix values and scatter the face coefficients into them.
+				 *
+				 * @param rface The face coefficients, two per face
+				 * @param nRFace The size of rface - must be twice the number of faces
+				 * @param matrix The matrix whose pattern was built by the symbolic phase
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The values were assembled successfully
+				 * @retval cupcfd::error::E_UNFINALIZED The symbolic phase has not been run
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE rface or the matrix pattern does not match the symbolic phase
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes numeric(const T * rface, I nRFace, cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix);
+
+				/**
+				 * Group the faces that contribute to the local matrix by colour, such that no two faces
+				 * of the same colour share a cell. The face colouring cached on the mesh by finalize is
+				 * reused, with any colours that contain no contributing faces removed.
+				 *
+				 * @param mesh The mesh the slot map was built for
+				 *
+				 * @tparam M The implementing class of the UnstructuredMeshInterface
+				 * @tparam L The label datatype of the unstructured mesh
+				 *
+				 * @return Nothing
+				 */
+				template <class M, class L>
+				void buildFaceColouring(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "FaceMatrixAssembler.ipp"
+
+#endif
@@ -0,0 +1,250 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the FaceMatrixAssembler class
+ */
+
+#ifndef CUPCFD_FVM_FACE_MATRIX_ASSEMBLER_IPP_H
+#define CUPCFD_FVM_FACE_MATRIX_ASSEMBLER_IPP_H
+
+#include <algorithm>
+
+namespace cupcfd
+{
+	namespace fvm
+	{
+		template <class I, class T>
+		FaceMatrixAssembler<I,T>::FaceMatrixAssembler()
+		: nFaces(0),
+		  nnz(0),
+		  nColours(0),
+		  colourImbalance(1.0),
+		  symbolicBuilt(false)
+		{
+
+		}
+
+		template <class I, class T>
+		FaceMatrixAssembler<I,T>::~FaceMatrixAssembler()
+		{
+			// Nothing to do currently, vectors will cleanup themselves on destructor call
+		}
+
+		template <class I, class T>
+		template <class M, class L>
+		cupcfd::error::eCodes FaceMatrixAssembler<I,T>::symbolic(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+																 cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix) {
+			cupcfd::error::eCodes status;
+
+			if(!mesh.finalized) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
+			this->symbolicBuilt = false;
+
+			I nOwnedCells = mesh.properties.lOCells;
+			I nCells = mesh.properties.lTCells;
+			I base = matrix.baseIndex;
+			this->nFaces = mesh.properties.lFaces;
+
+			status = matrix.resize(nOwnedCells, nCells);
+			CHECK_ECODE(status)
+
+			// === Pattern ===
+			// Diagonal for every owned cell, plus the coupling to the neighbouring cell of each
+			// interior face. Built in a single batch, since the entries arrive in face order.
+			std::vector<I> rows;
+			std::vector<I> cols;
+
+			rows.reserve(nOwnedCells + (2 * this->nFaces));
+			cols.reserve(nOwnedCells + (2 * this->nFaces));
+
+			for(I i = 0; i < nOwnedCells; i++) {
+				rows.push_back(i + base);
+				cols.push_back(i + base);
+			}
+
+			for(I i = 0; i < this->nFaces; i++) {
+				if(!mesh.getFaceIsBoundary(i)) {
+					I ip = mesh.getFaceCell1ID(i);
+					I in = mesh.getFaceCell2ID(i);
+
+					if(ip < nOwnedCells) {
+						rows.push_back(ip + base);
+						cols.push_back(in + base);
+					}
+
+					if(in < nOwnedCells) {
+						rows.push_back(in + base);
+						cols.push_back(ip + base);
+					}
+				}
+			}
+
+			std::vector<T> vals(rows.size(), T(0));
+			status = matrix.setElements(rows.data(), cols.data(), vals.data(), cupcfd::utility::drivers::safeConvertSizeT<I>(vals.size()));
+			CHECK_ECODE(status)
+
+			this->nnz = matrix.nnz;
+
+			// === Slot Map ===
+			// Columns are sorted within each row, so each slot is found by a binary search.
+			// This is the only point where searching is required.
+			this->faceSlots.assign(4 * this->nFaces, -1);
+
+			const I * IA = matrix.IA.data();
+			const I * JA = matrix.JA.data();
+
+			for(I i = 0; i < this->nFaces; i++) {
+				if(!mesh.getFaceIsBoundary(i)) {
+					I ip = mesh.getFaceCell1ID(i);
+					I in = mesh.getFaceCell2ID(i);
+
+					if(ip < nOwnedCells) {
+						this->faceSlots[(4 * i)] = std::lower_bound(JA + IA[ip], JA + IA[ip + 1], in + base) - JA;
+						this->faceSlots[(4 * i) + 2] = std::lower_bound(JA + IA[ip], JA + IA[ip + 1], ip + base) - JA;
+					}
+
+					if(in < nOwnedCells) {
+						this->faceSlots[(4 * i) + 1] = std::lower_bound(JA + IA[in], JA + IA[in + 1], ip + base) - JA;
+						this->faceSlots[(4 * i) + 3] = std::lower_bound(JA + IA[in], JA + IA[in + 1], in + base) - JA;
+					}
+				}
+			}
+
+			// === Colouring ===
+			this->buildFaceColouring(mesh);
+
+			this->symbolicBuilt = true;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		template <class M, class L>
+		void FaceMatrixAssembler<I,T>::buildFaceColouring(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh) {
+			const cupcfd::data_structures::GraphColouring<I>& meshColouring = mesh.faceColouring;
+
+			// Renumber the mesh colours that contain a contributing face, preserving their order
+			std::vector<I> colourMap(meshColouring.nColours, -1);
+			std::vector<I> faceColour(this->nFaces, -1);
+
+			this->nColours = 0;
+
+			for(I c = 0; c < meshColouring.nColours; c++) {
+				for(I k = meshColouring.colourXAdj[c]; k < meshColouring.colourXAdj[c + 1]; k++) {
+					I i = meshColouring.colourItems[k];
+
+					// Only faces that write to the local matrix need a colour
+					if(this->faceSlots[(4 * i)] < 0 && this->faceSlots[(4 * i) + 1] < 0) {
+						continue;
+					}
+
+					if(colourMap[c] < 0) {
+						colourMap[c] = this->nColours;
+						this->nColours = this->nColours + 1;
+					}
+
+					faceColour[i] = colourMap[c];
+				}
+			}
+
+			// Group the faces by colour
+			this->colourXAdj.assign(this->nColours + 1, 0);
+
+			for(I i = 0; i < this->nFaces; i++) {
+				if(faceColour[i] >= 0) {
+					this->colourXAdj[faceColour[i] + 1] = this->colourXAdj[faceColour[i] + 1] + 1;
+				}
+			}
+
+			for(I c = 0; c < this->nColours; c++) {
+				this->colourXAdj[c + 1] = this->colourXAdj[c + 1] + this->colourXAdj[c];
+			}
+
+			this->colourFaces.resize(this->colourXAdj[this->nColours]);
+			std::vector<I> ptr(this->colourXAdj.begin(), this->colourXAdj.end() - 1);
+
+			for(I i = 0; i < this->nFaces; i++) {
+				if(faceColour[i] >= 0) {
+					this->colourFaces[ptr[faceColour[i]]] = i;
+					ptr[faceColour[i]] = ptr[faceColour[i]] + 1;
+				}
+			}
+
+			I maxSize = 0;
+
+			for(I c = 0; c < this->nColours; c++) {
+				maxSize = std::max(maxSize, this->colourXAdj[c + 1] - this->colourXAdj[c]);
+			}
+
+			if(this->nColours > 0) {
+				this->colourImbalance = ((double) maxSize * this->nColours) / ((double) this->colourXAdj[this->nColours]);
+			}
+			else {
+				this->colourImbalance = 1.0;
+			}
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes FaceMatrixAssembler<I,T>::numeric(const T * rface, I nRFace, cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix) {
+			if(!this->symbolicBuilt) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
+			if(nRFace != (2 * this->nFaces)) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			// The pattern must not have changed since the symbolic phase
+			if(matrix.nnz != this->nnz || cupcfd::utility::drivers::safeConvertSizeT<I>(matrix.A.size()) != this->nnz) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			T * A = matrix.A.data();
+			const I * faceSlots = this->faceSlots.data();
+			const I * colourXAdj = this->colourXAdj.data();
+			const I * colourFaces = this->colourFaces.data();
+			I nnz = this->nnz;
+			I nColours = this->nColours;
+
+			#pragma omp parallel
+			{
+				#pragma omp for schedule(static)
+				for(I k = 0; k < nnz; k++) {
+					A[k] = T(0);
+				}
+
+				// Faces of the same colour share no cells, so their writes never overlap.
+				// The implicit barrier at the end of each loop separates the colours.
+				for(I c = 0; c < nColours; c++) {
+					#pragma omp for schedule(static)
+					for(I k = colourXAdj[c]; k < colourXAdj[c + 1]; k++) {
+						I i = colourFaces[k];
+						const I * slot = faceSlots + (4 * i);
+
+						if(slot[0] >= 0) {
+							A[slot[0]] = A[slot[0]] + rface[(2 * i)];
+							A[slot[2]] = A[slot[2]] - rface[(2 * i)];
+						}
+
+						if(slot[1] >= 0) {
+							A[slot[1]] = A[slot[1]] + rface[(2 * i) + 1];
+							A[slot[3]] = A[slot[3]] - rface[(2 * i) + 1];
+						}
+					}
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+#endif
@@ -30,6 +30,7 @@
 
 #include "EuclideanVector.h"
 #include "UnstructuredMeshInterface.h"
+#include "CupCfdAoSoAMesh.h"
 #include "Error.h"
 
 namespace cupcfd
@@ -52,6 +53,26 @@ namespace cupcfd
 													T * phiBoundary, I nPhiBoundary,
 													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell, I nDPhidxCell,
 													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell, I nDPhidxoCell);
+
+		/**
+		 * Compute the gradient of the cell by interpolating at the faces.
+		 * Kernel taken from Dolfyn.
+		 *
+		 * Tile-aware version for the AoSoA mesh, which walks the face data a tile at a time rather than
+		 * locating the tile and lane of each face. The results are identical to the generic version.
+		 *
+		 * @tparam I The datatype of the indexing scheme
+		 * @tparam T The datatype of computation/mesh/stateful data
+		 * @tparam L The label datatype of the unstructured mesh
+		 * @tparam W The tile width of the mesh
+		 */
+		template <class I, class T, class L, int W>
+		__attribute__((warn_unused_result))
+		cupcfd::error::eCodes GradientPhiGaussDolfyn(cupcfd::geometry::mesh::CupCfdAoSoAMesh<I,T,L,W>& mesh, I nGradient,
+													T * phiCell, I nPhiCell,
+													T * phiBoundary, I nPhiBoundary,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell, I nDPhidxCell,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell, I nDPhidxoCell);
 	}
 }
 
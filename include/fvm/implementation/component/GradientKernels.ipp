@@ -133,6 +133,110 @@ namespace cupcfd
 			
 			return cupcfd::error::E_SUCCESS;
 		}
+
+		template <class I, class T, class L, int W>
+		cupcfd::error::eCodes GradientPhiGaussDolfyn(cupcfd::geometry::mesh::CupCfdAoSoAMesh<I,T,L,W>& mesh, I nGradient,
+													T * phiCell, I nPhiCell,
+													T * phiBoundary, I nPhiBoundary,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell, I nDPhidxCell,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell, I nDPhidxoCell) {
+			T facn, facp, fact;
+			T phiFace, vol;
+			I ip, ib, in;
+
+			cupcfd::geometry::euclidean::EuclideanPoint<T,3> xac;
+			cupcfd::geometry::euclidean::EuclideanPoint<T,3> faceCenter;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> faceNorm;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> dPhidxac;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> corrTmp;
+
+			I nFac = mesh.properties.lFaces;
+			I nTiles = mesh.getNFaceTiles();
+
+			// Zero Cell Values
+			for (I i = 0; i < nDPhidxoCell; i++) {
+				dPhidxoCell[i].cmp[0] = (T) 0;
+				dPhidxoCell[i].cmp[1] = (T) 0;
+				dPhidxoCell[i].cmp[2] = (T) 0;
+			}
+
+			// Gradient Loop
+			for(I iGrad = 0; iGrad < nGradient; iGrad++) {
+				// Reset
+				for (I i = 0; i < nDPhidxCell; i++) {
+					dPhidxCell[i].cmp[0] = (T) 0;
+					dPhidxCell[i].cmp[1] = (T) 0;
+					dPhidxCell[i].cmp[2] = (T) 0;
+				}
+
+				// Face Loop, a tile at a time. Only the last tile can be partially filled.
+				for(I t = 0; t < nTiles; t++) {
+					const cupcfd::geometry::mesh::CupCfdAoSoAMeshFaceTile<I,T,W>& tile = mesh.getFaceTile(t);
+					I nLanes = (nFac - (t * W) < W) ? nFac - (t * W) : W;
+
+					for(I lane = 0; lane < nLanes; lane++) {
+						ip = tile.cell1ID[lane];
+						in = tile.cell2ID[lane];
+
+						faceNorm.cmp[0] = tile.norm[0][lane];
+						faceNorm.cmp[1] = tile.norm[1][lane];
+						faceNorm.cmp[2] = tile.norm[2][lane];
+
+						if(tile.boundaryID[lane] < 0) {
+							facn = tile.lambda[lane];
+							facp = 1.0 - facn;
+
+							xac = (mesh.getCellCenter(in) * facn) + (mesh.getCellCenter(ip) * facp);
+
+							dPhidxac = (dPhidxoCell[in] * facn) + (dPhidxoCell[ip] * facp);
+
+							#ifdef DEBUG
+								if (ip >= nPhiCell || in >= nPhiCell) {
+									return cupcfd::error::E_INVALID_INDEX;
+								}
+							#endif
+							phiFace = (phiCell[in] * facn) + (phiCell[ip] * facp);
+
+							faceCenter.cmp[0] = tile.center[0][lane];
+							faceCenter.cmp[1] = tile.center[1][lane];
+							faceCenter.cmp[2] = tile.center[2][lane];
+
+							corrTmp = faceCenter - xac;
+
+							phiFace += dPhidxac.dotProduct(corrTmp);
+
+							dPhidxCell[ip] += (phiFace * faceNorm);
+							dPhidxCell[in] += (phiFace * faceNorm);
+						}
+						else {
+							ib = tile.boundaryID[lane];
+							#ifdef DEBUG
+								if (ib >= nPhiBoundary) {
+									return cupcfd::error::E_INVALID_INDEX;
+								}
+							#endif
+							phiFace = phiBoundary[ib];
+
+							dPhidxCell[ip] += (phiFace * faceNorm);
+						}
+					}
+				}
+
+				// Cell Loop
+				for(I i = 0; i < mesh.properties.lTCells; i++) {
+					mesh.getCellVolume(i, &vol);
+					fact = 1.0/vol;
+					dPhidxCell[i] *= fact;
+				}
+
+				// Copy
+				for(I i = 0; i < nDPhidxoCell; i++) {
+					dPhidxoCell[i] = dPhidxCell[i];
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
@@ -31,6 +31,7 @@
 #define CUPCFD_FVM_MASS_INCLUDE_H
 
 #include "UnstructuredMeshInterface.h"
+#include "CupCfdAoSoAMesh.h"
 #include "EuclideanVector.h"
 
 namespace cupcfd
@@ -80,6 +81,50 @@ namespace cupcfd
 													T * tCell, I nTCell,
 													T * tBoundary, I nTBoundary);
 
+		/**
+		 * Tile-aware version for the AoSoA mesh, which reads the face data a tile at a time rather than
+		 * locating the tile and lane of each face. The results are identical to the generic version.
+		 *
+		 * @tparam I The datatype of the indexing scheme
+		 * @tparam T The datatype of computation/mesh/stateful data
+		 * @tparam L The label datatype of the unstructured mesh
+		 * @tparam W The tile width of the mesh
+		 */
+		template <class I, class T, class L, int W>
+		__attribute__((warn_unused_result))
+		cupcfd::error::eCodes FluxMassDolfynFaceLoop(cupcfd::geometry::mesh::CupCfdAoSoAMesh<I,T,L,W>& mesh,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx, I nDudx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx, I nDvdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx, I nDwdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dpdx, I nDpdx,
+													T * denCell, I nDenCell,
+													T * denBoundary, I nDenBoundary,
+													T * uCell, I nUCell,
+													T * vCell, I nVCell,
+													T * wCell, I nWCell,
+													T * massFlux, I nMassFlux,
+													T * p, I nP,
+													T * ar, I nAr,
+													T * su, I nSu,
+													T * rface, I nRFace,
+													T small,
+													I * icinl,
+													I * icout,
+													I * icsym,
+													I * icwal,
+													bool solveTurbEnergy,
+													bool solveTurbDiss,
+													bool solveVisc,
+													bool solveEnthalpy,
+													T * teCell, I nTeCell,
+													T * teBoundary, I nTeBoundary,
+													T * edCell, I nEdCell,
+													T * edBoundary, I nEdBoundary,
+													T * viseffCell, I nViseffCell,
+													T * viseffBoundary, I nViseffBoundary,
+													T * tCell, I nTCell,
+													T * tBoundary, I nTBoundary);
+
 		/**
 		 *
 		 * @tparam M The implementing class of the UnstructuredMeshInterface
@@ -308,6 +308,303 @@ namespace cupcfd
 			return cupcfd::error::E_SUCCESS;
 		}
 
+		template <class I, class T, class L, int W>
+		cupcfd::error::eCodes FluxMassDolfynFaceLoop(cupcfd::geometry::mesh::CupCfdAoSoAMesh<I,T,L,W>& mesh,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx, I nDudx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx, I nDvdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx, I nDwdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dpdx, I nDpdx,
+													T * denCell, I nDenCell,
+													T * denBoundary, I nDenBoundary,
+													T * uCell, I nUCell,
+													T * vCell, I nVCell,
+													T * wCell, I nWCell,
+													T * massFlux, I nMassFlux,
+													T * p, I nP,
+													T * ar, I nAr,
+													T * su, I nSu,
+													T * rface, I nRFace,
+													T small,
+													I * icinl,
+													I * icout,
+													I * icsym,
+													I * icwal,
+													bool solveTurbEnergy,
+													bool solveTurbDiss,
+													bool solveVisc,
+													bool solveEnthalpy,
+													T * teCell, I nTeCell,
+													T * teBoundary, I nTeBoundary,
+													T * edCell, I nEdCell,
+													T * edBoundary, I nEdBoundary,
+													T * viseffCell, I nViseffCell,
+													T * viseffBoundary, I nViseffBoundary,
+													T * tCell, I nTCell,
+													T * tBoundary, I nTBoundary) {
+			I ip, in, ib, ir;
+			T facn, facp;
+			T denf;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> dudxac;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> dvdxac;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> dwdxac;
+			cupcfd::geometry::euclidean::EuclideanPoint<T,3> xface;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> delta;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> xnorm;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> xpn;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> xpn2;
+			cupcfd::geometry::mesh::RType it;
+			cupcfd::geometry::euclidean::EuclideanPoint<T,3> xac;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> uIn;
+			cupcfd::geometry::euclidean::EuclideanPoint<T,3> xpac;
+			cupcfd::geometry::euclidean::EuclideanPoint<T,3> xnac;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> delp;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> deln;
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> norm;
+
+			T uFace, vFace, wFace;
+			T pip, pin;
+			T apv1, apv2, apv, fact, factv;
+			T dpx, dpy, dpz;
+			T dens;
+
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> faceNorm;
+			cupcfd::geometry::euclidean::EuclideanPoint<T,3> faceCenter;
+
+			I nFac = mesh.properties.lFaces;
+			I nTiles = mesh.getNFaceTiles();
+
+			// Face Loop, a tile at a time. Only the last tile can be partially filled.
+			for(I t = 0; t < nTiles; t++) {
+				const cupcfd::geometry::mesh::CupCfdAoSoAMeshFaceTile<I,T,W>& tile = mesh.getFaceTile(t);
+				I nLanes = (nFac - (t * W) < W) ? nFac - (t * W) : W;
+
+				for(I lane = 0; lane < nLanes; lane++) {
+					I i = (t * W) + lane;
+
+					faceNorm.cmp[0] = tile.norm[0][lane];
+					faceNorm.cmp[1] = tile.norm[1][lane];
+					faceNorm.cmp[2] = tile.norm[2][lane];
+
+					faceCenter.cmp[0] = tile.center[0][lane];
+					faceCenter.cmp[1] = tile.center[1][lane];
+					faceCenter.cmp[2] = tile.center[2][lane];
+
+					ip = tile.cell1ID[lane];
+					in = tile.cell2ID[lane];
+
+					bool isBoundary = (tile.boundaryID[lane] > -1);
+
+					#ifdef DEBUG
+						if (i >= nMassFlux) {
+							return cupcfd::error::E_INVALID_INDEX;
+						}
+					#endif
+					if(!isBoundary) {
+						#ifdef DEBUG
+							if (in >= nDudx || ip >= nDudx) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (in >= nDvdx || ip >= nDvdx) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (in >= nDwdx || ip >= nDwdx) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (in >= nDpdx || ip >= nDpdx) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (in >= nDenCell || ip >= nDenCell) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (in >= nUCell || ip >= nUCell) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (in >= nVCell || ip >= nVCell) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (in >= nWCell || ip >= nWCell) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (in >= nP || ip >= nP) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (in >= nAr || ip >= nAr) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+						#endif
+
+						facn = tile.lambda[lane];
+						facp = 1.0 - facn;
+						dudxac = dudx[in] * facn + dudx[ip] * facp;
+						dvdxac = dvdx[in] * facn + dvdx[ip] * facp;
+						dwdxac = dwdx[in] * facn + dwdx[ip] * facp;
+
+						denf = denCell[in] * facn + denCell[ip] * facp;
+						xac = mesh.getCellCenter(in) * facn + mesh.getCellCenter(ip) * facp;
+						xface = faceCenter;
+						delta = xface - xac;
+
+						uFace = uCell[in]*facn + uCell[ip]*facp + dudxac.dotProduct(delta);
+						vFace = vCell[in]*facn + vCell[ip]*facp + dvdxac.dotProduct(delta);
+						wFace = wCell[in]*facn + wCell[ip]*facp + dwdxac.dotProduct(delta);
+
+						massFlux[i] = denf * (uFace * faceNorm.cmp[0] +
+											vFace * faceNorm.cmp[1] +
+											wFace * faceNorm.cmp[2]);
+
+						xnorm = faceNorm;
+						xnorm.normalise();
+
+						xpac = cupcfd::geometry::euclidean::EuclideanPoint<T,3>(tile.xpac[0][lane], tile.xpac[1][lane], tile.xpac[2][lane]);
+						xnac = cupcfd::geometry::euclidean::EuclideanPoint<T,3>(tile.xnac[0][lane], tile.xnac[1][lane], tile.xnac[2][lane]);
+
+						delp = xpac - mesh.getCellCenter(ip);
+						pip = p[ip] + dpdx[ip].dotProduct(delp);
+
+						deln = xpac - mesh.getCellCenter(in);
+						pin = p[in] + dpdx[ip].dotProduct(deln);
+
+						xpn = xnac - xpac;
+						xpn2 = mesh.getCellCenter(in) - mesh.getCellCenter(ip);
+
+						apv1 = denCell[ip] * ar[ip];
+						apv2 = denCell[in] * ar[in];
+						apv = apv2 * facn + apv1 * facp;
+
+						factv = mesh.getCellVolume(in) * facn + mesh.getCellVolume(ip) * facp;
+						apv *= tile.area[lane] * factv/xpn2.dotProduct(xnorm);
+
+						dpx = (dpdx[in].cmp[0] * facn + dpdx[ip].cmp[0] * facp) * xpn.cmp[0];
+						dpy = (dpdx[in].cmp[1] * facn + dpdx[ip].cmp[1] * facp) * xpn.cmp[1];
+						dpz = (dpdx[in].cmp[2] * facn + dpdx[ip].cmp[2] * facp) * xpn.cmp[2];
+
+						fact = apv;
+
+						#ifdef DEBUG
+							if ( ((i*2)+1) >= nRFace) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+						#endif
+						rface[(i*2)] = -fact;
+						rface[(i*2)+1] = -fact;
+
+						massFlux[i] = massFlux[i] - fact * ((pin-pip) - dpx - dpy - dpz);
+					}
+					else {
+						ip = tile.cell1ID[lane];
+						ib = tile.boundaryID[lane];
+						ir = mesh.getBoundaryRegionID(ib);
+						it = mesh.getRegionType(ir);
+
+						#ifdef DEBUG
+							if (ip >= nSu) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (ip >= nUCell) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (ip >= nVCell) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (ip >= nWCell) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (ip >= nDenCell) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (ib >= nDenBoundary) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (ib >= nTeBoundary) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (ib >= nTeCell) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (ib >= nEdBoundary) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (ib >= nViseffBoundary) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (ib >= nTBoundary) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (ip >= nEdCell) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (ip >= nViseffCell) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+							if (ip >= nTCell) {
+								return cupcfd::error::E_INVALID_INDEX;
+							}
+						#endif
+
+						if(it == cupcfd::geometry::mesh::RTYPE_INLET) {
+							*icinl = *icinl + 1;
+							xac = faceCenter;
+
+							// Ignoring User Option
+							uIn = mesh.getRegionUVW(ir);
+							dens = mesh.getRegionDen(ir);
+
+							norm = faceNorm;
+							massFlux[i] = dens * uIn.dotProduct(norm);
+							su[ip] = su[ip] - massFlux[i];
+						}
+						else if(it == cupcfd::geometry::mesh::RTYPE_OUTLET) {
+							*icout = *icout + 1;
+							delta = faceCenter - mesh.getCellCenter(ip);
+							uFace = uCell[ip];
+							vFace = vCell[ip];
+							wFace = wCell[ip];
+
+							denf = denCell[ip];
+							denBoundary[ib] = denf;
+
+							norm = faceNorm;
+							massFlux[i] = denf * (uFace * norm.cmp[0] +
+												 vFace * norm.cmp[1] +
+												 wFace * norm.cmp[2]);
+
+							if(massFlux[i] < 0.0) {
+								massFlux[i] = small;
+
+								if(solveTurbEnergy) {
+									teBoundary[ib] = teCell[ip];
+								}
+
+								if(solveTurbDiss) {
+									edBoundary[ib] = edCell[ip];
+								}
+
+								if(solveVisc) {
+									viseffBoundary[ib] = viseffCell[ip];
+								}
+
+								if(solveEnthalpy) {
+									tBoundary[ib] = tCell[ip];
+								}
+
+								// Skip SolveScalars
+							}
+						}
+						else if(it == cupcfd::geometry::mesh::RTYPE_SYMP) {
+							*icsym = *icsym + 1;
+							massFlux[i] = 0.0;
+						}
+						else if(it == cupcfd::geometry::mesh::RTYPE_WALL) {
+							*icwal = *icwal + 1;
+							massFlux[i] = 0.0;
+						}
+					}
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
 		template <class M, class I, class T, class L>
 		cupcfd::error::eCodes FluxMassDolfynBoundaryLoop1(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
 														 T * massFlux, I nMassFlux,
@@ -0,0 +1,64 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the Residual Kernels Operations
+ */
+
+#ifndef CUPCFD_FVM_RESIDUAL_INCLUDE_H
+#define CUPCFD_FVM_RESIDUAL_INCLUDE_H
+
+#include "Communicator.h"
+#include "SparseMatrixCSR.h"
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace fvm
+	{
+		/**
+		 * Compute the residual r = b - Ax of a linear system whose rows are distributed
+		 * across the ranks of a communicator, along with the global 2-norm of r.
+		 *
+		 * Each rank stores the rows of its owned cells, with the columns in local numbering
+		 * (owned cells followed by ghost cells), such as the matrix built by FaceMatrixAssembler.
+		 * The residual and the local part of the norm are computed in a single threaded pass over
+		 * the matrix, and the local parts are then summed across ranks.
+		 *
+		 * @param comm The communicator the rows are distributed across
+		 * @param matrix The local rows of the matrix
+		 * @param x The local solution vector - owned and ghost values. The ghost values must be up to date.
+		 * @param nX The size of x - must match the number of matrix columns
+		 * @param b The local right-hand-side vector
+		 * @param nB The size of b - must match the number of matrix rows
+		 * @param r The array to store the local residual in
+		 * @param nR The size of r - must match the number of matrix rows
+		 * @param rNorm The location to store the global 2-norm of the residual, on every rank
+		 *
+		 * @tparam I The datatype of the indexing scheme
+		 * @tparam T The datatype of computation/stateful data
+		 *
+		 * @return An error status indicating the success or failure of the operation
+		 * @retval cupcfd::error::E_SUCCESS The residual was computed successfully
+		 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The vector sizes do not match the matrix dimensions
+		 */
+		template <class I, class T>
+		__attribute__((warn_unused_result))
+		cupcfd::error::eCodes ResidualCSR(cupcfd::comm::Communicator& comm,
+										  cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix,
+										  const T * x, I nX,
+										  const T * b, I nB,
+										  T * r, I nR,
+										  T * rNorm);
+	}
+}
+
+// Include Header Level Definitions
+#include "ResidualKernels.ipp"
+
+#endif
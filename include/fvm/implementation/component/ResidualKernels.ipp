@@ -0,0 +1,51 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the Residual Kernels Operations
+ */
+
+#ifndef CUPCFD_FVM_RESIDUAL_IPP_H
+#define CUPCFD_FVM_RESIDUAL_IPP_H
+
+#include <cmath>
+
+#include "Reduce.h"
+
+namespace cupcfd
+{
+	namespace fvm
+	{
+		template <class I, class T>
+		cupcfd::error::eCodes ResidualCSR(cupcfd::comm::Communicator& comm,
+										  cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix,
+										  const T * x, I nX,
+										  const T * b, I nB,
+										  T * r, I nR,
+										  T * rNorm) {
+			cupcfd::error::eCodes status;
+			T localNormSq;
+			T globalNormSq;
+
+			// Mismatched array sizes are returned to the caller
+			status = matrix.residual(x, nX, b, nB, r, nR, &localNormSq);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			status = cupcfd::comm::allReduceAdd(&localNormSq, 1, &globalNormSq, 1, comm);
+			CHECK_ECODE(status)
+
+			*rNorm = sqrt(globalNormSq);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+#endif
@@ -31,6 +31,7 @@
 
 #include "EuclideanVector.h"
 #include "UnstructuredMeshInterface.h"
+#include "CupCfdAoSoAMesh.h"
 
 namespace cupcfd
 {
@@ -65,6 +66,37 @@ namespace cupcfd
 														int ivar, int VarT, T Sigma_T, T Prandtl,
 														int VarTE, T Sigma_k, int VarED, T Sigma_e,
 														T Sigma_s, T Schmidt, T GammaBlend, T Small, T Large, T TMCmu);
+
+		/**
+		 * Tile-aware version for the AoSoA mesh, which reads the face data a tile at a time rather than
+		 * locating the tile and lane of each face. The results are identical to the generic version.
+		 *
+		 * @tparam I The datatype of the indexing scheme
+		 * @tparam T The datatype of computation/mesh/stateful data
+		 * @tparam L The label datatype of the unstructured mesh
+		 * @tparam W The tile width of the mesh
+		 */
+		template <class I, class T, class L, int W>
+		__attribute__((warn_unused_result))
+		cupcfd::error::eCodes FluxScalarDolfynFaceLoop(cupcfd::geometry::mesh::CupCfdAoSoAMesh<I,T,L,W>& mesh,
+														T * PhiCell, I nPhiCell,
+														T * PhiBoundary, I nPhiBoundary,
+														T * VisEff, I nVisEff,
+														T * Au, I nAu,
+														T * Su, I nSu,
+														T * Den, I nDen,
+														T * MassFlux, I nMassFlux,
+														T * TE, I nTE,
+														T * CpBoundary, I nCpBoundary,
+														T * visEffBoundary, I nVisEffBoundary,
+														T * RFace, I nRFace,
+														cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidx, int ndPhidx,
+														bool SolveTurb, bool SolveEnthalpy,
+														// T sigma, T sigma2, 
+														T vislam,
+														int ivar, int VarT, T Sigma_T, T Prandtl,
+														int VarTE, T Sigma_k, int VarED, T Sigma_e,
+														T Sigma_s, T Schmidt, T GammaBlend, T Small, T Large, T TMCmu);
 	}
 }
 
@@ -72,7 +72,9 @@
 			// T uac, vac, wac;
 			T visac;
 			T visFace;
-			T uFace, vFace, wFace;
+			// These are set by SelectDiffSchemeVector in the original, which is not ported yet. Start from zero so that
+			// interior faces before the first boundary face do not read uninitialised values.
+			T uFace = 0.0, vFace = 0.0, wFace = 0.0;
 			T fuce, fvce, fwce;
 			T sx, sy, sz;
 			T fude1, fvde1, fwde1;
@@ -42,12 +42,14 @@
 #include "CupCfdAoSMeshRegion.h"
 #include "CupCfdAoSMeshVertex.h"
 
+// Build Label Maps
+#include "FlatHashMap.h"
+
 // Error Codes
 #include "Error.h"
 
 // C++ Library
 #include <vector>
-#include <map>
 
 namespace euc = cupcfd::geometry::euclidean;
 
@@ -86,6 +88,17 @@ namespace cupcfd
 					/** Vertices Data **/
 					std::vector<CupCfdAoSMeshVertex<T>> vertices;
 
+					#if !CUPCFD_MESH_FIXED_FACE_VERTICES
+						// With the CSR vertex layout, face and boundary vertices are stored here
+						// rather than in the face and boundary structures, since their size varies
+
+						/** Boundary -> Vertex Data **/
+						CupCfdMeshFaceVertices<I> boundaryVertices;
+
+						/** Face -> Vertex Data **/
+						CupCfdMeshFaceVertices<I> faceVertices;
+					#endif
+
 					// === Cell->Face Mappings ===
 					// These two menbers are used for mapping Cells to Faces. Done here as CSR rather than
 					// in the Cell structure to avoid inflating the size of Cell structs/classes for
@@ -97,6 +110,13 @@ namespace cupcfd
 					/** Cell -> Face CSR Lookup Data - Adj - Face Indexes **/
 					std::vector<I> cellFaceMapCSRAdj;
 
+					/**
+					 * Number of faces per cell in cellFaceMapCSRAdj when every cell has the same fixed type
+					 * (see packCellFaceMap). The faces of cell i then start at i * cellFaceStride, and
+					 * cellFaceMapCSRXAdj is empty. If 0, the faces of cell i start at cellFaceMapCSRXAdj[i].
+					 **/
+					I cellFaceStride = 0;
+
 					/** Storage for number of faces per cell globally across mesh, indexed by local ID **/
 					std::vector<I> cellNGFaces;
 
@@ -126,35 +146,35 @@ namespace cupcfd
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> vertexBuildIDToLocalID;
+					cupcfd::data_structures::FlatHashMap<L, I> vertexBuildIDToLocalID;
 
 					/**
 					 * Scratch Space - Map Scheme Build Boundary Label to Local ID
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> boundaryBuildIDToLocalID;
+					cupcfd::data_structures::FlatHashMap<L, I> boundaryBuildIDToLocalID;
 
 					/**
 					 * Scratch Space - Map Scheme Build Region Label to Local ID
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> regionBuildIDToLocalID;
+					cupcfd::data_structures::FlatHashMap<L, I> regionBuildIDToLocalID;
 
 					/**
 					 * Scratch Space - Map Scheme Build Cell Label to Local ID
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> cellBuildIDToLocalID;
+					cupcfd::data_structures::FlatHashMap<L, I> cellBuildIDToLocalID;
 
 					/**
 					 * Scratch Space - Map Scheme Build Face Label to Local ID
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> faceBuildIDToLocalID;
+					cupcfd::data_structures::FlatHashMap<L, I> faceBuildIDToLocalID;
 
 					// === Constructors/Deconstructors ===
 
@@ -224,6 +244,13 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes addCell(L cellLabel, bool isLocal);
 
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addCells(L * cellLabels,
+													euc::EuclideanPoint<T,3> * centers,
+													T * vols,
+													I nCells,
+													bool isLocal);
+
 					void getCellID(L cellLabel, I * cellID);
 
 					__attribute__((warn_unused_result))
@@ -302,6 +329,21 @@ namespace cupcfd
 													bool isBoundary,
 													L * vertexLabels, I nVertexLabels);
 
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addFaces(L * faceLabels,
+													L * cell1Labels,
+													L * cell2OrBoundaryLabels,
+													bool * isBoundary,
+													T * lambda,
+													euc::EuclideanVector3D<T> * norm,
+													I * vertexXAdj, L * vertexLabels,
+													euc::EuclideanPoint<T,3> * center,
+													euc::EuclideanPoint<T,3> * xpac,
+													euc::EuclideanPoint<T,3> * xnac,
+													T * rlencos,
+													T * area,
+													I nFaces);
+
 
 					void getFaceID(L faceLabel, I * faceID);
 					__attribute__((warn_unused_result))
@@ -312,6 +354,8 @@ namespace cupcfd
 					inline void getBoundaryFaceID(I boundaryID, I * faceID);
 					__attribute__((warn_unused_result))
 					inline I getBoundaryFaceID(I boundaryID);
+					__attribute__((warn_unused_result))
+					inline I getBoundaryNVertices(I boundaryID);
 					inline void getBoundaryVertex(I boundaryID, I boundaryVertexID, I * vertexID);
 					__attribute__((warn_unused_result))
 					inline I getBoundaryVertex(I boundaryID, I boundaryVertexID);
@@ -361,6 +405,13 @@ namespace cupcfd
 													L regionLabel,
 													L * vertexLabels, I nVertexLabels);
 
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addBoundaries(L * boundaryLabels,
+													L * regionLabels,
+													I * vertexXAdj, L * vertexLabels,
+													T * distance,
+													I nBoundaries);
+
 					void getBoundaryID(L boundaryLabel, I * boundaryID);
 					__attribute__((warn_unused_result))
 					I getBoundaryID(L boundaryLabel);
@@ -464,6 +515,8 @@ namespace cupcfd
 					inline void setVertexPos(I vertexID, euc::EuclideanPoint<T,3>& pos);
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes addVertex(L vertexLabel, euc::EuclideanPoint<T,3>& pos);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addVertices(L * vertexLabels, euc::EuclideanPoint<T,3> * pos, I nVertices);
 					inline void getVertexID(L vertexLabel, I * vertexID);
 					__attribute__((warn_unused_result))
 					inline I getVertexID(L vertexLabel);
@@ -504,6 +557,19 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes updateCellFaceMap();
 
+					/**
+					 * If every cell on this rank has the same fixed type (properties.cellType), repack the cell->face
+					 * mapping built by updateCellFaceMap with a fixed stride of the number of faces of that type, so
+					 * that looking up a face of a cell does not need the CSR offsets. Ghost cells only store the faces
+					 * that adjoin a local cell, so their remaining entries are set to -1.
+					 *
+					 * If the cell type is not known, the CSR mapping is left in place.
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 */
+					void packCellFaceMap();
+
 					/**
 					 *
 					 */
@@ -516,6 +582,51 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes exchangeCellGlobalNFaces();
 
+					/**
+					 * Count the pages of the mesh stores held on each NUMA node, using a query-only move_pages
+					 * call (see cupcfd::utility::drivers::getPageNodes).
+					 *
+					 * @param nodePages The number of pages on each node, indexed by node (added to)
+					 * @param nUnplaced A pointer to a count that is increased by the number of untouched pages
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_ERROR Page placement cannot be queried on this system
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getPagePlacement(std::vector<std::size_t>& nodePages, std::size_t * nUnplaced);
+
+					/**
+					 * @return The number of bytes of heap memory used by the maps from build IDs to local IDs
+					 */
+					std::size_t getBuildMapMemoryBytes() const;
+
+					/**
+					 * Append the data stores of this mesh implementation to a snapshot.
+					 * Called by writeSnapshot after the common mesh data has been written.
+					 *
+					 * @param file The snapshot file, open for writing
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_ERROR The write failed
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes writeSnapshotData(cupcfd::io::SnapshotFile& file);
+
+					/**
+					 * Restore the data stores of this mesh implementation from a snapshot written by writeSnapshotData.
+					 * Called by readSnapshot after the common mesh data has been read.
+					 *
+					 * @param file The snapshot file, open for reading
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_INVALID_FILE_FORMAT The sections are missing or do not match the mesh properties
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes readSnapshotData(cupcfd::io::SnapshotFile& file);
+
 					// === Pure Methods ===
 			};
 		}
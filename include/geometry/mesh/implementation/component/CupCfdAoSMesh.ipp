@@ -99,15 +99,18 @@ namespace cupcfd
 
 			template <class I, class T, class L>
 			inline void CupCfdAoSMesh<I,T,L>::getCellFaceID(I cellID, I cellFaceID, I * faceID) {
-				// I index = this->cellFaceMapCSRXAdj[cellID] + cellFaceID;
-				I index = DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRXAdj, cellID) + cellFaceID;
+				I index = (this->cellFaceStride > 0) ? (cellID * this->cellFaceStride) :
+														DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRXAdj, cellID);
+				index = index + cellFaceID;
 				// *faceID = this->cellFaceMapCSRAdj[index];
 				*faceID = DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRAdj, index);
 			}
 
 			template <class I, class T, class L>
 			inline I CupCfdAoSMesh<I,T,L>::getCellFaceID(I cellID, I cellFaceID) {
-				I index = DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRXAdj, cellID) + cellFaceID;
+				I index = (this->cellFaceStride > 0) ? (cellID * this->cellFaceStride) :
+														DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRXAdj, cellID);
+				index = index + cellFaceID;
 				return DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRAdj, index);
 			}
 
@@ -138,12 +141,15 @@ namespace cupcfd
 			
 			template <class I, class T, class L>
 			inline I CupCfdAoSMesh<I,T,L>::getFaceNVertices(I faceID) {
-				// Currently we can only have three or four vertices max per face
-				if(DBG_SAFE_VECTOR_LOOKUP(this->faces, faceID).verticesID[3] == -1) {
-					return 3;
-				} else {
-					return 4;
-				}
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					if(DBG_SAFE_VECTOR_LOOKUP(this->faces, faceID).verticesID[3] == -1) {
+						return 3;
+					} else {
+						return 4;
+					}
+				#else
+					return this->faceVertices.getNVertices(faceID);
+				#endif
 			}
 			
 			template <class I, class T, class L>
@@ -188,12 +194,20 @@ namespace cupcfd
 
 			template <class I, class T, class L>
 			inline void CupCfdAoSMesh<I,T,L>::getFaceVertex(I faceID, I faceVertexID, I * vertexID) {
-				*vertexID = DBG_SAFE_VECTOR_LOOKUP(this->faces, faceID).verticesID[faceVertexID];
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					*vertexID = DBG_SAFE_VECTOR_LOOKUP(this->faces, faceID).verticesID[faceVertexID];
+				#else
+					*vertexID = this->faceVertices.getVertex(faceID, faceVertexID);
+				#endif
 			}
 
 			template <class I, class T, class L>
 			inline I CupCfdAoSMesh<I,T,L>::getFaceVertex(I faceID, I faceVertexID) {
-				return DBG_SAFE_VECTOR_LOOKUP(this->faces, faceID).verticesID[faceVertexID];
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					return DBG_SAFE_VECTOR_LOOKUP(this->faces, faceID).verticesID[faceVertexID];
+				#else
+					return this->faceVertices.getVertex(faceID, faceVertexID);
+				#endif
 			}
 
 			template <class I, class T, class L>
@@ -295,7 +309,11 @@ namespace cupcfd
 
 			template <class I, class T, class L>
 			inline void CupCfdAoSMesh<I,T,L>::setFaceVertex(I faceID, I faceVertexID, I vertexID) {
-				DBG_SAFE_VECTOR_LOOKUP(this->faces, faceID).verticesID[faceVertexID] = vertexID;
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					DBG_SAFE_VECTOR_LOOKUP(this->faces, faceID).verticesID[faceVertexID] = vertexID;
+				#else
+					this->faceVertices.setVertex(faceID, faceVertexID, vertexID);
+				#endif
 			}
 
 			template <class I, class T, class L>
@@ -348,14 +366,35 @@ namespace cupcfd
 				return DBG_SAFE_VECTOR_LOOKUP(this->boundaries, boundaryID).faceID;
 			}
 
+			template <class I, class T, class L>
+			inline I CupCfdAoSMesh<I,T,L>::getBoundaryNVertices(I boundaryID) {
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					if(DBG_SAFE_VECTOR_LOOKUP(this->boundaries, boundaryID).verticesID[3] == -1) {
+						return 3;
+					} else {
+						return 4;
+					}
+				#else
+					return this->boundaryVertices.getNVertices(boundaryID);
+				#endif
+			}
+
 			template <class I, class T, class L>
 			inline void CupCfdAoSMesh<I,T,L>::getBoundaryVertex(I boundaryID, I boundaryVertexID, I * vertexID) {
-				*vertexID = DBG_SAFE_VECTOR_LOOKUP(this->boundaries, boundaryID).verticesID[boundaryVertexID];
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					*vertexID = DBG_SAFE_VECTOR_LOOKUP(this->boundaries, boundaryID).verticesID[boundaryVertexID];
+				#else
+					*vertexID = this->boundaryVertices.getVertex(boundaryID, boundaryVertexID);
+				#endif
 			}
 
 			template <class I, class T, class L>
 			inline I CupCfdAoSMesh<I,T,L>::getBoundaryVertex(I boundaryID, I boundaryVertexID) {
-				return DBG_SAFE_VECTOR_LOOKUP(this->boundaries, boundaryID).verticesID[boundaryVertexID];
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					return DBG_SAFE_VECTOR_LOOKUP(this->boundaries, boundaryID).verticesID[boundaryVertexID];
+				#else
+					return this->boundaryVertices.getVertex(boundaryID, boundaryVertexID);
+				#endif
 			}
 
 			template <class I, class T, class L>
@@ -445,7 +484,11 @@ namespace cupcfd
 
 			template <class I, class T, class L>
 			inline void CupCfdAoSMesh<I,T,L>::setBoundaryVertex(I boundaryID, I boundaryVertexID, I vertexID) {
-				DBG_SAFE_VECTOR_LOOKUP(this->boundaries, boundaryID).verticesID[boundaryVertexID] = vertexID;
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					DBG_SAFE_VECTOR_LOOKUP(this->boundaries, boundaryID).verticesID[boundaryVertexID] = vertexID;
+				#else
+					this->boundaryVertices.setVertex(boundaryID, boundaryVertexID, vertexID);
+				#endif
 			}
 
 			template <class I, class T, class L>
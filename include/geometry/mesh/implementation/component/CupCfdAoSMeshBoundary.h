@@ -30,6 +30,7 @@
 #define CUPCFD_GEOMETRY_MESH_CUPCFD_AOS_MESH_BOUNDARY_INCLUDE_H
 
 #include "CupCfdAoSMeshFace.h"
+#include "CupCfdMeshFaceVertices.h"
 #include "EuclideanVector.h"
 
 // Use to pad the class to a certain size (though this may depend on compiler behaviours and padding etc)
@@ -61,8 +62,11 @@ namespace cupcfd
 					/** Face that this boundary is associated with. A -1 indicates no association **/
 					I faceID;
 
-					/** Vertices that this boundary is associated with. A -1 indicates no association **/
-					I verticesID[4];
+					#if CUPCFD_MESH_FIXED_FACE_VERTICES
+						/** Vertices that this boundary is associated with. A -1 indicates no association.
+						 *  With the CSR vertex layout, these are stored in the mesh instead. **/
+						I verticesID[4];
+					#endif
 
 					/** The region that this boundary is assocaited with. A -1 indicates no association **/
 					I regionID;
@@ -110,6 +114,38 @@ namespace cupcfd
 					 */
 					~CupCfdAoSMeshBoundary();
 
+					/**
+					 * Deep copies the boundary components from the source to this object
+					 *
+					 * @param source The source boundary to copy from
+					 *
+					 * @tparam I The type of the indexing system
+					 * @tparam T The type of the data store
+					 *
+					 * @return Nothing
+					 */
+					inline void operator=(const CupCfdAoSMeshBoundary<I,T>& source)
+					{
+						this->faceID = source.faceID;
+
+						#if CUPCFD_MESH_FIXED_FACE_VERTICES
+							for(int i = 0; i < 4; i++) {
+								this->verticesID[i] = source.verticesID[i];
+							}
+						#endif
+
+						this->regionID = source.regionID;
+						this->distance = source.distance;
+						this->yplus = source.yplus;
+						this->uplus = source.uplus;
+						this->shear = source.shear;
+						this->q = source.q;
+						this->h = source.h;
+						this->t = source.t;
+
+						// We don't care about the contents of padding, it is used for space, not valid data
+					}
+
 					// === Concrete Methods ===
 
 					// === Pure Virtual Methods ===
@@ -35,6 +35,7 @@
 #endif
 
 #include "CupCfdAoSMeshBoundary.h"
+#include "CupCfdMeshFaceVertices.h"
 #include "EuclideanPoint.h"
 #include "EuclideanVector.h"
 
@@ -68,7 +69,9 @@ namespace cupcfd
 					 *  (e.g.  verticesID[0] > -1, verticesID[1] > -1, verticesID[2] > -1, verticesID[3] == -1 indicates only three vertices,
 					 *  a triangular boundary).
 					 **/
-					I verticesID[4];
+					#if CUPCFD_MESH_FIXED_FACE_VERTICES
+						I verticesID[4];
+					#endif
 
 					/** The boundary lambda value **/
 					T lambda;
@@ -112,6 +115,39 @@ namespace cupcfd
 					 */
 					~CupCfdAoSMeshFace();
 
+					/**
+					 * Deep copies the face components from the source to this object
+					 *
+					 * @param source The source face to copy from
+					 *
+					 * @tparam I The type of the indexing system
+					 * @tparam T The type of the data store
+					 *
+					 * @return Nothing
+					 */
+					inline void operator=(const CupCfdAoSMeshFace<I,T>& source)
+					{
+						this->bndID = source.bndID;
+						this->cell1ID = source.cell1ID;
+						this->cell2ID = source.cell2ID;
+
+						#if CUPCFD_MESH_FIXED_FACE_VERTICES
+							for(int i = 0; i < 4; i++) {
+								this->verticesID[i] = source.verticesID[i];
+							}
+						#endif
+
+						this->lambda = source.lambda;
+						this->rlencos = source.rlencos;
+						this->area = source.area;
+						this->center = source.center;
+						this->norm = source.norm;
+						this->xpac = source.xpac;
+						this->xnac = source.xnac;
+
+						// We don't care about the contents of padding, it is used for space, not valid data
+					}
+
 					// === Concrete Methods ===
 
 					// === Pure Virtual Methods ===
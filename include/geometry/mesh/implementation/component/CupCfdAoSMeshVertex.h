@@ -78,6 +78,22 @@ namespace cupcfd
 					 */
 					~CupCfdAoSMeshVertex();
 
+					/**
+					 * Deep copies the vertex components from the source to this object
+					 *
+					 * @param source The source vertex to copy from
+					 *
+					 * @tparam T The type of the data store
+					 *
+					 * @return Nothing
+					 */
+					inline void operator=(const CupCfdAoSMeshVertex<T>& source)
+					{
+						this->pos = source.pos;
+
+						// We don't care about the contents of padding, it is used for space, not valid data
+					}
+
 					// === Concrete Methods ===
 
 					// === Pure Virtual Methods ===
@@ -0,0 +1,785 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ * This implementation was coded from scratch, but the original basis for the
+ * data structure was derived from Dolfyn:
+ * Copyright 2003-2009 Henk Krus, Cyclone Fluid Dynamics BV
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.dolfyn.net/license.html
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the CupCfdAoSoAMesh Class
+ */
+
+#ifndef CUPCFD_GEOMETRY_MESH_CUPCFD_AOSOA_MESH_INCLUDE_H
+#define CUPCFD_GEOMETRY_MESH_CUPCFD_AOSOA_MESH_INCLUDE_H
+
+// Select the number of faces/cells stored in each tile of a CupCfdAoSoAMesh (default 8).
+// Must be 4, 8 or 16. This sets the mesh used for the "MiniAoSoA" mesh data type - the mesh class
+// itself is instantiated for all three widths.
+#ifndef CUPCFD_AOSOA_MESH_TILE_WIDTH
+#define CUPCFD_AOSOA_MESH_TILE_WIDTH 8
+#endif
+
+// Interface/Base Class
+#include "UnstructuredMeshInterface.h"
+
+// Mesh Size Data
+#include "UnstructuredMeshProperties.h"
+
+// Build Label Maps
+#include "FlatHashMap.h"
+
+// Face/Boundary Vertex Storage
+#include "CupCfdMeshFaceVertices.h"
+
+// Aligned, Parallel First-Touch Storage
+#include "AlignedAllocator.h"
+
+// Error Codes
+#include "Error.h"
+
+// C++ Library
+#include <vector>
+
+namespace euc = cupcfd::geometry::euclidean;
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			static_assert(CUPCFD_AOSOA_MESH_TILE_WIDTH == 4 || CUPCFD_AOSOA_MESH_TILE_WIDTH == 8 || CUPCFD_AOSOA_MESH_TILE_WIDTH == 16,
+						  "CUPCFD_AOSOA_MESH_TILE_WIDTH must be 4, 8 or 16");
+
+			/**
+			 * The face data of W consecutive faces of a CupCfdAoSoAMesh.
+			 * Each field is stored contiguously for the faces of the tile, with vector quantities
+			 * split into their x, y and z components.
+			 *
+			 * Only plain arrays are stored, so a tile can be copied as a block.
+			 *
+			 * @tparam I The type of the indexing scheme
+			 * @tparam T The type of the stored array data
+			 * @tparam W The number of faces in a tile
+			 */
+			template <class I, class T, int W>
+			struct alignas(64) CupCfdAoSoAMeshFaceTile
+			{
+				I cell1ID[W];
+				I cell2ID[W];
+				I boundaryID[W];
+				T lambda[W];
+				T rlencos[W];
+				T area[W];
+				T norm[3][W];
+				T center[3][W];
+				T xpac[3][W];
+				T xnac[3][W];
+			};
+
+			/**
+			 * The geometry data of W consecutive cells of a CupCfdAoSoAMesh.
+			 *
+			 * @tparam T The type of the stored array data
+			 * @tparam W The number of cells in a tile
+			 */
+			template <class T, int W>
+			struct alignas(64) CupCfdAoSoAMeshCellTile
+			{
+				T center[3][W];
+				T volume[W];
+			};
+
+			/**
+			 * Unstructure Mesh Data Storage Format.
+			 *
+			 * This format is an AoSoA (tiled) format: the face and cell geometry data is stored
+			 * in tiles of W faces/cells, where each field is contiguous within a tile. Face i is
+			 * stored in lane i % W of tile i / W. A loop over the faces of a tile can therefore be
+			 * vectorised across the lanes, while the fields of a face remain close together in memory.
+			 * The boundary, region and vertex data is stored as in the SoA format.
+			 *
+			 * @tparam I The type of the indexing scheme
+			 * @tparam T The type of the stored array data
+			 * @tparam L The type of the build labels
+			 * @tparam W The number of faces/cells per tile (4, 8 or 16)
+			 */
+			template <class I, class T, class L, int W>
+			class CupCfdAoSoAMesh : public UnstructuredMeshInterface<CupCfdAoSoAMesh<I,T,L,W>,I,T,L>
+			{
+				static_assert(W == 4 || W == 8 || W == 16, "The tile width of a CupCfdAoSoAMesh must be 4, 8 or 16");
+
+				public:
+					// === Members ===
+
+					// Mesh Data
+
+					// ToDo: Think vectors are usually contiguous, but are they guaranteed to be?
+					// Worst case is copy across to an array once the finalize step is triggered.
+
+					/** Boundary Data **/
+					cupcfd::data_structures::AlignedVector<I> boundaryFaceID;
+					CupCfdMeshFaceVertices<I> boundaryVertexID;
+					cupcfd::data_structures::AlignedVector<T> boundaryDistance;
+					cupcfd::data_structures::AlignedVector<T> boundaryYPlus;
+					cupcfd::data_structures::AlignedVector<T> boundaryUPlus;
+					cupcfd::data_structures::AlignedVector<I> boundaryRegionID;
+					cupcfd::data_structures::AlignedVector<euc::EuclideanVector<T,3>> boundaryShear;
+					cupcfd::data_structures::AlignedVector<T> boundaryQ;
+					cupcfd::data_structures::AlignedVector<T> boundaryH;
+					cupcfd::data_structures::AlignedVector<T> boundaryT;
+
+					/** Cell Data - the centers and volumes of each cell, in tiles of W cells **/
+					cupcfd::data_structures::AlignedVector<CupCfdAoSoAMeshCellTile<T,W>> cellTiles;
+
+					/** The number of cells stored in cellTiles **/
+					I nCellRecords;
+
+					/** Storage for number of faces per cell globally across mesh, indexed by local ID **/
+					cupcfd::data_structures::AlignedVector<I> cellNGFaces;
+
+					/**
+					 * Storage for number of faces per cell stored on this mesh, indexed by local ID
+					 * (primarily different for ghost cells, where not all faces are stored).
+					 *
+					 **/
+					cupcfd::data_structures::AlignedVector<I> cellNFaces;
+
+
+					/**
+					 * Storage for number of vertices per cell globally across mesh, indexed by local ID
+					 * - i.e. for ghost cells this stores the actual value and not just what is stored
+					 * locally.
+					 **/
+					cupcfd::data_structures::AlignedVector<I> cellNGVertices;
+
+					/**
+					 * Storage for number of vertices per cell stored on this mesh, indexed by local ID
+					 * - i.e. for ghost cells this stores the actual value and not just what is stored
+					 * locally.
+					 **/
+					cupcfd::data_structures::AlignedVector<I> cellNVertices;
+
+					// These two menbers are used for mapping Cells to Faces. Done here as CSR rather than
+					// in the Cell structure to avoid inflating the size of Cell structs/classes for
+					// proxy reasons
+
+					/** Cell -> Face CSR Lookup Data - XAdj - Cell->A Start Index Lookup **/
+					cupcfd::data_structures::AlignedVector<I> cellFaceMapCSRXAdj;
+
+					/** Cell -> Face CSR Lookup Data - Adj - Face Indexes **/
+					cupcfd::data_structures::AlignedVector<I> cellFaceMapCSRAdj;
+
+					/**
+					 * Number of faces per cell in cellFaceMapCSRAdj when every cell has the same fixed type
+					 * (see packCellFaceMap). The faces of cell i then start at i * cellFaceStride, and
+					 * cellFaceMapCSRXAdj is empty. If 0, the faces of cell i start at cellFaceMapCSRXAdj[i].
+					 **/
+					I cellFaceStride = 0;
+
+
+					/** Face Data - in tiles of W faces **/
+					cupcfd::data_structures::AlignedVector<CupCfdAoSoAMeshFaceTile<I,T,W>> faceTiles;
+
+					/** The number of faces stored in faceTiles **/
+					I nFaceRecords;
+
+					// Fixed 4 vertex slots, or CSR (see CUPCFD_MESH_FIXED_FACE_VERTICES)
+					CupCfdMeshFaceVertices<I> faceVertexID;
+
+
+					/** Region Data **/
+					std::vector<RType> regionType;
+					std::vector<bool> regionStd;
+					std::vector<T> regionYLog;
+					std::vector<T> regionELog;
+					std::vector<T> regionDensity;
+					std::vector<T> regionTurbKE;
+					std::vector<T> regionTurbDiss;
+					std::vector<T> regionSplvl;
+					std::vector<T> regionDen;
+					std::vector<euc::EuclideanVector<T,3>> regionForceTangent;
+					std::vector<euc::EuclideanVector<T,3>> regionUVW;
+					std::vector<std::string> regionName;
+					std::vector<bool> regionFlux;
+					std::vector<bool> regionAdiab;
+					std::vector<T> regionR;
+					std::vector<T> regionT;
+
+					/** Vertices Data **/
+					cupcfd::data_structures::AlignedVector<euc::EuclideanPoint<T,3>> verticesPos;
+
+
+					/**
+					 * Scratch Space - Map Scheme Build Vertex Label to Local ID
+					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
+					 * from the global ID of the index scheme used to build the mesh.
+					 */
+					cupcfd::data_structures::FlatHashMap<L, I> vertexBuildIDToLocalID;
+
+					/**
+					 * Scratch Space - Map Scheme Build Boundary Label to Local ID
+					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
+					 * from the global ID of the index scheme used to build the mesh.
+					 */
+					cupcfd::data_structures::FlatHashMap<L, I> boundaryBuildIDToLocalID;
+
+					/**
+					 * Scratch Space - Map Scheme Build Region Label to Local ID
+					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
+					 * from the global ID of the index scheme used to build the mesh.
+					 */
+					cupcfd::data_structures::FlatHashMap<L, I> regionBuildIDToLocalID;
+
+					/**
+					 * Scratch Space - Map Scheme Build Cell Label to Local ID
+					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
+					 * from the global ID of the index scheme used to build the mesh.
+					 */
+					cupcfd::data_structures::FlatHashMap<L, I> cellBuildIDToLocalID;
+
+					/**
+					 * Scratch Space - Map Scheme Build Face Label to Local ID
+					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
+					 * from the global ID of the index scheme used to build the mesh.
+					 */
+					cupcfd::data_structures::FlatHashMap<L, I> faceBuildIDToLocalID;
+
+					// === Constructors/Deconstructors ===
+
+					/**
+					 * Default constructor:
+					 * Creates an empty CupCfdAoSMesh with no cells or other components,
+					 * and counts set to zero.
+					 */
+					CupCfdAoSoAMesh(cupcfd::comm::Communicator& comm);
+
+					/**
+					 * Deconstructor.
+					 */
+					~CupCfdAoSoAMesh();
+
+					// === Concrete Methods ===
+					void reset();
+
+					// === Inherited Method Overloads ===
+
+					// =========================== Cell Operators ===========================
+
+					inline void getCellCenter(I cellID, euc::EuclideanPoint<T,3>& center);
+
+					__attribute__((warn_unused_result))
+					inline euc::EuclideanPoint<T,3> getCellCenter(I cellID);
+
+					inline void getCellVolume(I cellID, T * vol);
+
+					__attribute__((warn_unused_result))
+					inline T getCellVolume(I cellID);
+
+					inline void getCellNFaces(I cellID, I * nFaces);
+
+					__attribute__((warn_unused_result))
+					inline I getCellNFaces(I cellID);
+
+					inline void getCellStoredNFaces(I cellID, I * nFaces);
+
+					__attribute__((warn_unused_result))
+					inline I getCellStoredNFaces(I cellID);
+
+					inline void getCellNVertices(I cellID, int * nVertices);
+
+					int getCellNVertices(I cellID);
+
+					inline void getCellStoredNVertices(I cellID, I * nVertices);
+
+					I getCellStoredNVertices(I cellID);
+
+					inline void getCellFaceID(I cellID, I cellFaceID, I * faceID);
+
+					__attribute__((warn_unused_result))
+					inline I getCellFaceID(I cellID, I cellFaceID);
+
+					inline void setCellCenter(I cellID, euc::EuclideanPoint<T,3>& center);
+
+					inline void setCellVolume(I cellID, T vol);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addCell(L cellLabel,
+													euc::EuclideanPoint<T,3>& center,
+													T vol,
+													bool isLocal);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addCell(L cellLabel, bool isLocal);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addCells(L * cellLabels,
+													euc::EuclideanPoint<T,3> * centers,
+													T * vols,
+													I nCells,
+													bool isLocal);
+
+					void getCellID(L cellLabel, I * cellID);
+
+					__attribute__((warn_unused_result))
+					I getCellID(L cellLabel);
+
+					// =========================== Face Operators ===========================
+
+					inline void getFaceNVertices(I faceID, I * nVertices);
+					__attribute__((warn_unused_result))
+					inline I getFaceNVertices(I faceID);
+					inline void getFaceCell1ID(I faceID, I * cellID);
+					__attribute__((warn_unused_result))
+					inline I getFaceCell1ID(I faceID);
+					inline void getFaceCell2ID(I faceID, I * cellID);
+					__attribute__((warn_unused_result))
+					inline I getFaceCell2ID(I faceID);
+					inline void getFaceLambda(I faceID, T * lambda);
+					__attribute__((warn_unused_result))
+					inline T getFaceLambda(I faceID);
+					inline void getFaceNorm(I faceID, euc::EuclideanVector<T,3>& norm);
+					__attribute__((warn_unused_result))
+					inline euc::EuclideanVector<T,3> getFaceNorm(I faceID);
+					inline void getFaceVertex(I faceID, I faceVertexID, I * vertexID);
+					__attribute__((warn_unused_result))
+					inline I getFaceVertex(I faceID, I faceVertexID);
+					inline void getFaceCenter(I faceID, euc::EuclideanPoint<T,3>& center);
+					__attribute__((warn_unused_result))
+					inline euc::EuclideanPoint<T,3> getFaceCenter(I faceID);
+					inline void getFaceRLencos(I faceID, T * rlencos);
+					__attribute__((warn_unused_result))
+					inline T getFaceRLencos(I faceID);
+					inline void getFaceArea(I faceID, T * area);
+					__attribute__((warn_unused_result))
+					inline T getFaceArea(I faceID);
+					inline void getFaceXpac(I faceID, euc::EuclideanPoint<T,3>& xpac);
+					__attribute__((warn_unused_result))
+					inline euc::EuclideanPoint<T,3> getFaceXpac(I faceID);
+					inline void getFaceXnac(I faceID, euc::EuclideanPoint<T,3>& xnac);
+					__attribute__((warn_unused_result))
+					inline euc::EuclideanPoint<T,3> getFaceXnac(I faceID);
+					inline void getFaceIsBoundary(I faceID, bool * result);
+					__attribute__((warn_unused_result))
+					inline bool getFaceIsBoundary(I faceID);
+					inline void getFaceBoundaryID(I faceID, I * boundaryID);
+					__attribute__((warn_unused_result))
+					inline I getFaceBoundaryID(I faceID);
+					inline void setFaceCell1ID(I faceID, I cellID);
+					inline void setFaceCell2ID(I faceID, I cellID);
+					inline void setFaceLambda(I faceID, T lambda);
+					inline void setFaceNorm(I faceID, euc::EuclideanVector<T,3>& norm);
+					inline void setFaceVertex(I faceID, I faceVertexID, I vertexID);
+					inline void setFaceCenter(I faceID, euc::EuclideanPoint<T,3>& center);
+					inline void setFaceRLencos(I faceID, T rlencos);
+					inline void setFaceArea(I faceID, T area);
+					inline void setFaceXpac(I faceID, euc::EuclideanPoint<T,3>& xpac);
+					inline void setFaceXnac(I faceID, euc::EuclideanPoint<T,3>& xnac);
+					inline void setFaceBoundaryID(I faceID, I boundaryID);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addFace(L faceLabel,
+													L cell1Label,
+													L cell2OrBoundaryLabel,
+													bool isBoundary,
+													T lambda,
+													euc::EuclideanVector<T,3>& norm,
+													L * vertexLabels, I nVertexLabels,
+													euc::EuclideanPoint<T,3>& center,
+													euc::EuclideanPoint<T,3>& xpac,
+													euc::EuclideanPoint<T,3>& xnac,
+													T rlencos,
+													T area);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addFace(L faceLabel,
+													L cell1Label,
+													L cell2OrBoundaryLabel,
+													bool isBoundary,
+													L * vertexLabels, I nVertexLabels);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addFaces(L * faceLabels,
+													L * cell1Labels,
+													L * cell2OrBoundaryLabels,
+													bool * isBoundary,
+													T * lambda,
+													euc::EuclideanVector3D<T> * norm,
+													I * vertexXAdj, L * vertexLabels,
+													euc::EuclideanPoint<T,3> * center,
+													euc::EuclideanPoint<T,3> * xpac,
+													euc::EuclideanPoint<T,3> * xnac,
+													T * rlencos,
+													T * area,
+													I nFaces);
+
+
+					void getFaceID(L faceLabel, I * faceID);
+					__attribute__((warn_unused_result))
+					I getFaceID(L faceLabel);
+
+					// =========================== Boundary Operators ===========================
+
+					inline void getBoundaryFaceID(I boundaryID, I * faceID);
+					__attribute__((warn_unused_result))
+					inline I getBoundaryFaceID(I boundaryID);
+					__attribute__((warn_unused_result))
+					inline I getBoundaryNVertices(I boundaryID);
+					inline void getBoundaryVertex(I boundaryID, I boundaryVertexID, I * vertexID);
+					__attribute__((warn_unused_result))
+					inline I getBoundaryVertex(I boundaryID, I boundaryVertexID);
+					inline void getBoundaryDistance(I boundaryID, T * distance);
+					__attribute__((warn_unused_result))
+					inline T getBoundaryDistance(I boundaryID);
+					inline void getBoundaryYPlus(I boundaryID, T * yPlus);
+					__attribute__((warn_unused_result))
+					inline T getBoundaryYPlus(I boundaryID);
+					inline void getBoundaryUPlus(I boundaryID, T * uPlus);
+					__attribute__((warn_unused_result))
+					inline T getBoundaryUPlus(I boundaryID);
+					inline void getBoundaryRegionID(I boundaryID, I * regionID);
+					__attribute__((warn_unused_result))
+					inline I getBoundaryRegionID(I boundaryID);
+					inline void getBoundaryShear(I boundaryID, euc::EuclideanVector<T,3>& shear);
+					__attribute__((warn_unused_result))
+					inline euc::EuclideanVector<T,3> getBoundaryShear(I boundaryID);
+					inline void getBoundaryQ(I boundaryID, T * q);
+					__attribute__((warn_unused_result))
+					inline T getBoundaryQ(I boundaryID);
+					inline void getBoundaryH(I boundaryID, T * h);
+					__attribute__((warn_unused_result))
+					inline T getBoundaryH(I boundaryID);
+					inline void getBoundaryT(I boundaryID, T * t);
+					__attribute__((warn_unused_result))
+					inline T getBoundaryT(I boundaryID);
+					inline void setBoundaryFaceID(I boundaryID, I faceID);
+					inline void setBoundaryVertex(I boundaryID, I boundaryVertexID, I vertexID);
+					inline void setBoundaryDistance(I boundaryID, T distance);
+					inline void setBoundaryYPlus(I boundaryID, T yPlus);
+					inline void setBoundaryUPlus(I boundaryID, T uPlus);
+					inline void setBoundaryRegionID(I boundaryID, I regionID);
+					inline void setBoundaryShear(I boundaryID, euc::EuclideanVector<T,3>& shear);
+					inline void setBoundaryQ(I boundaryID, T q);
+					inline void setBoundaryH(I boundaryID, T h);
+					inline void setBoundaryT(I boundaryID, T t);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addBoundary(L boundaryLabel,
+													L regionLabel,
+													L * vertexLabels, I nVertexLabels,
+													T distance);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addBoundary(L boundaryLabel,
+													L regionLabel,
+													L * vertexLabels, I nVertexLabels);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addBoundaries(L * boundaryLabels,
+													L * regionLabels,
+													I * vertexXAdj, L * vertexLabels,
+													T * distance,
+													I nBoundaries);
+
+					void getBoundaryID(L boundaryLabel, I * boundaryID);
+					__attribute__((warn_unused_result))
+					I getBoundaryID(L boundaryLabel);
+
+					// =========================== Region Operators ===========================
+
+					inline void getRegionType(I regionID, RType * type);
+					__attribute__((warn_unused_result))
+					inline RType getRegionType(I regionID);
+					inline void getRegionStd(I regionID, bool * std);
+					__attribute__((warn_unused_result))
+					inline bool getRegionStd(I regionID);
+					inline void getRegionYLog(I regionID, T * yLog);
+					__attribute__((warn_unused_result))
+					inline T getRegionYLog(I regionID);
+					inline void getRegionELog(I regionID, T * eLog);
+					__attribute__((warn_unused_result))
+					inline T getRegionELog(I regionID);
+					inline void getRegionDensity(I regionID, T * density);
+					__attribute__((warn_unused_result))
+					inline T getRegionDensity(I regionID);
+					inline void getRegionTurbKE(I regionID, T * turbKE);
+					__attribute__((warn_unused_result))
+					inline T getRegionTurbKE(I regionID);
+					inline void getRegionTurbDiss(I regionID, T * turbDiss);
+					__attribute__((warn_unused_result))
+					inline T getRegionTurbDiss(I regionID);
+					inline void getRegionSplvl(I regionID, T * splvl);
+					__attribute__((warn_unused_result))
+					inline T getRegionSplvl(I regionID);
+					inline void getRegionDen(I regionID, T * den);
+					__attribute__((warn_unused_result))
+					inline T getRegionDen(I regionID);
+					inline void getRegionForceTangent(I regionID, euc::EuclideanVector<T,3>& forceTangent);
+					__attribute__((warn_unused_result))
+					inline euc::EuclideanVector<T,3> getRegionForceTangent(I regionID);
+					inline void getRegionUVW(I regionID, euc::EuclideanVector<T,3>& uvw);
+					__attribute__((warn_unused_result))
+					inline euc::EuclideanVector<T,3> getRegionUVW(I regionID);
+					inline void getRegionName(I regionID, std::string& regionName);
+					__attribute__((warn_unused_result))
+					inline std::string getRegionName(I regionID);
+					inline void getRegionFlux(I regionID, bool * flux);
+					__attribute__((warn_unused_result))
+					inline bool getRegionFlux(I regionID);
+					inline void getRegionAdiab(I regionID, bool * adiab);
+					__attribute__((warn_unused_result))
+					inline bool getRegionAdiab(I regionID);
+					inline void getRegionR(I regionID, T * r);
+					__attribute__((warn_unused_result))
+					inline T getRegionR(I regionID);
+					inline void getRegionT(I regionID, T * t);
+					__attribute__((warn_unused_result))
+					inline T getRegionT(I regionID);
+					inline void setRegionType(I regionID, RType type);
+					inline void setRegionStd(I regionID, bool std);
+					inline void setRegionYLog(I regionID, T yLog);
+					inline void setRegionELog(I regionID, T eLog);
+					inline void setRegionDensity(I regionID, T density);
+					inline void setRegionTurbKE(I regionID, T turbKE);
+					inline void setRegionTurbDiss(I regionID, T turbDiss);
+					inline void setRegionSplvl(I regionID, T splvl);
+					inline void setRegionDen(I regionID, T den);
+					inline void setRegionForceTangent(I regionID, euc::EuclideanVector<T,3>& forceTangent);
+					inline void setRegionUVW(I regionID, euc::EuclideanVector<T,3>& uvw);
+					inline void setRegionName(I regionID, std::string& regionName);
+					inline void setRegionFlux(I regionID, bool flux);
+					inline void setRegionAdiab(I regionID, bool adiab);
+					inline void setRegionR(I regionID, T r);
+					inline void setRegionT(I regionID, T t);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addRegion(L regionLabel,
+													RType type,
+													bool std,
+													bool flux,
+													bool adiab,
+													T ylog,
+													T elog,
+													T density,
+													T turbKE,
+													T turbDiss,
+													T splvl,
+													T den,
+													T r,
+													T t,
+													euc::EuclideanVector<T,3>& forceTangent,
+													euc::EuclideanVector<T,3>& uvw,
+													std::string& regionName);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addRegion(L regionLabel,
+													std::string& regionName);
+
+					void getRegionID(L regionLabel, I * regionID);
+					__attribute__((warn_unused_result))
+					I getRegionID(L regionLabel);
+
+					// =========================== Vertex Operators ===========================
+
+					inline void getVertexPos(I vertexID, euc::EuclideanPoint<T,3>& pos);
+					__attribute__((warn_unused_result))
+					inline euc::EuclideanPoint<T,3> getVertexPos(I vertexID);
+					inline void setVertexPos(I vertexID, euc::EuclideanPoint<T,3>& pos);
+					cupcfd::error::eCodes addVertex(L vertexLabel, euc::EuclideanPoint<T,3>& pos);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addVertices(L * vertexLabels, euc::EuclideanPoint<T,3> * pos, I nVertices);
+					inline void getVertexID(L vertexLabel, I * vertexID);
+					__attribute__((warn_unused_result))
+					inline I getVertexID(L vertexLabel);
+
+					// === Other ===
+
+					/**
+					 * The finalize step of CupCfdAoSMesh does the following:
+					 * (1) Refreshes the Cell -> Face Mapping based on the set Face(Cell1) and Face(Cell2) values
+					 * (2) Updates the mesh properties values based on the currently stored data
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes finalize();
+
+					// === CupCfdAoSMesh Specific Concrete Methods ===
+
+					/**
+					 *
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes updateCellLocalIndexes();
+
+					/**
+					 * This updates the internal CSR members responsible for storing the cell->face mappings,
+					 * as well as the number of stored faces and vertices per cell.
+					 * This mapping is not updated upon adding a new face, since it would result in O(m * n) operations
+					 * (Lookup indexes for O(n) cells would have to be updated each time a face was added)
+					 *
+					 * Instead, this function does a single pass to build the CSR data structure using the currently stored face
+					 * and cell data.
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_ARRAY_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes updateCellFaceMap();
+
+					/**
+					 * If every cell on this rank has the same fixed type (properties.cellType), repack the cell->face
+					 * mapping built by updateCellFaceMap with a fixed stride of the number of faces of that type, so
+					 * that looking up a face of a cell does not need the CSR offsets. Ghost cells only store the faces
+					 * that adjoin a local cell, so their remaining entries are set to -1.
+					 *
+					 * If the cell type is not known, the CSR mapping is left in place.
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 */
+					void packCellFaceMap();
+
+					/**
+					 *
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes exchangeCellGlobalNVertices();
+
+					/**
+					 *
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes exchangeCellGlobalNFaces();
+
+					/**
+					 * Release the spare capacity left in the stores by adding elements, so that each store is held
+					 * in a single allocation of the exact size, first touched in parallel with a static schedule
+					 * (see AlignedAllocator). Stores that are already exactly sized (e.g. filled by a single
+					 * bulk add) are left in place. Called as part of the finalize step.
+					 */
+					void shrinkStores();
+
+					/**
+					 * Count the pages of the mesh stores held on each NUMA node, using a query-only move_pages
+					 * call (see cupcfd::utility::drivers::getPageNodes).
+					 *
+					 * @param nodePages The number of pages on each node, indexed by node (added to)
+					 * @param nUnplaced A pointer to a count that is increased by the number of untouched pages
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_ERROR Page placement cannot be queried on this system
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getPagePlacement(std::vector<std::size_t>& nodePages, std::size_t * nUnplaced);
+
+					/**
+					 * @return The number of bytes of heap memory used by the maps from build IDs to local IDs
+					 */
+					std::size_t getBuildMapMemoryBytes() const;
+
+					/**
+					 * Append the data stores of this mesh implementation to a snapshot.
+					 * Called by writeSnapshot after the common mesh data has been written.
+					 *
+					 * @param file The snapshot file, open for writing
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_ERROR The write failed
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes writeSnapshotData(cupcfd::io::SnapshotFile& file);
+
+					/**
+					 * Restore the data stores of this mesh implementation from a snapshot written by writeSnapshotData.
+					 * Called by readSnapshot after the common mesh data has been read.
+					 *
+					 * @param file The snapshot file, open for reading
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_INVALID_FILE_FORMAT The sections are missing or do not match the mesh properties
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes readSnapshotData(cupcfd::io::SnapshotFile& file);
+
+					// === CupCfdAoSoAMesh Specific Concrete Methods ===
+
+					/**
+					 * @return The number of face tiles in use. The last tile may be partially filled.
+					 */
+					__attribute__((warn_unused_result))
+					inline I getNFaceTiles();
+
+					/**
+					 * Get the tile storing faces tileID * W to (tileID * W) + W - 1, for loops that process the
+					 * faces a tile at a time. Lanes past the last face of the mesh are zeroed.
+					 *
+					 * @param tileID The index of the tile
+					 *
+					 * @return A reference to the tile
+					 */
+					__attribute__((warn_unused_result))
+					inline const CupCfdAoSoAMeshFaceTile<I,T,W>& getFaceTile(I tileID);
+
+					/**
+					 * @return The number of cell tiles in use. The last tile may be partially filled.
+					 */
+					__attribute__((warn_unused_result))
+					inline I getNCellTiles();
+
+					/**
+					 * Get the tile storing cells tileID * W to (tileID * W) + W - 1.
+					 * Lanes past the last cell of the mesh are zeroed.
+					 *
+					 * @param tileID The index of the tile
+					 *
+					 * @return A reference to the tile
+					 */
+					__attribute__((warn_unused_result))
+					inline const CupCfdAoSoAMeshCellTile<T,W>& getCellTile(I tileID);
+
+					/**
+					 * Change the number of stored faces, adding zeroed tiles as needed.
+					 *
+					 * @param nFaces The new number of faces
+					 */
+					void resizeFaceTiles(I nFaces);
+
+					/**
+					 * Change the number of stored cells, adding zeroed tiles as needed.
+					 *
+					 * @param nCells The new number of cells
+					 */
+					void resizeCellTiles(I nCells);
+
+					// === Pure Methods ===
+			};
+		}
+	}
+}
+
+// Include Header Level Definitions
+#include "CupCfdAoSoAMesh.ipp"
+
+#endif
@@ -0,0 +1,875 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ * This implementation was coded from scratch, but the original basis for the
+ * data structure was derived from Dolfyn:
+ * Copyright 2003-2009 Henk Krus, Cyclone Fluid Dynamics BV
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.dolfyn.net/license.html
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the CupCfdAoSoAMesh Class
+ */
+
+#ifndef CUPCFD_GEOMETRY_MESH_CUPCFD_AOSOA_MESH_IPP_H
+#define CUPCFD_GEOMETRY_MESH_CUPCFD_AOSOA_MESH_IPP_H
+
+namespace euc = cupcfd::geometry::euclidean;
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getCellCenter(I cellID, euc::EuclideanPoint<T,3>& center) {
+				const CupCfdAoSoAMeshCellTile<T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->cellTiles, cellID / W);
+				I lane = cellID % W;
+
+				center.cmp[0] = tile.center[0][lane];
+				center.cmp[1] = tile.center[1][lane];
+				center.cmp[2] = tile.center[2][lane];
+			}
+			
+			template <class I, class T, class L, int W>
+			inline euc::EuclideanPoint<T,3> CupCfdAoSoAMesh<I,T,L,W>::getCellCenter(I cellID) {
+				const CupCfdAoSoAMeshCellTile<T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->cellTiles, cellID / W);
+				I lane = cellID % W;
+
+				return euc::EuclideanPoint<T,3>(tile.center[0][lane], tile.center[1][lane], tile.center[2][lane]);
+			}
+			
+			
+			
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getCellVolume(I cellID, T * vol) {
+				*vol = DBG_SAFE_VECTOR_LOOKUP(this->cellTiles, cellID / W).volume[cellID % W];
+			}
+			
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getCellVolume(I cellID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->cellTiles, cellID / W).volume[cellID % W];
+			}
+			
+			
+			
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getCellNFaces(I cellID, I * nFaces) {
+				*nFaces = DBG_SAFE_VECTOR_LOOKUP(this->cellNGFaces, cellID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getCellNFaces(I cellID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->cellNGFaces, cellID);
+			}
+
+
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getCellStoredNFaces(I cellID, I * nFaces) {
+				*nFaces = DBG_SAFE_VECTOR_LOOKUP(this->cellNFaces, cellID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getCellStoredNFaces(I cellID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->cellNFaces, cellID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getCellNVertices(I cellID, int * nVertices) {
+				*nVertices = DBG_SAFE_VECTOR_LOOKUP(this->cellNGVertices, cellID);
+			}
+
+			template <class I, class T, class L, int W>
+			int CupCfdAoSoAMesh<I,T,L,W>::getCellNVertices(I cellID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->cellNGVertices, cellID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getCellStoredNVertices(I cellID, I * nVertices) {
+				*nVertices = DBG_SAFE_VECTOR_LOOKUP(this->cellNVertices, cellID);
+			}
+
+			template <class I, class T, class L, int W>
+			I CupCfdAoSoAMesh<I,T,L,W>::getCellStoredNVertices(I cellID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->cellNVertices, cellID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getCellFaceID(I cellID, I cellFaceID, I * faceID) {
+				I index = (this->cellFaceStride > 0) ? (cellID * this->cellFaceStride) :
+														DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRXAdj, cellID);
+				index = index + cellFaceID;
+				*faceID = DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRAdj, index);
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getCellFaceID(I cellID, I cellFaceID) {
+				I index = (this->cellFaceStride > 0) ? (cellID * this->cellFaceStride) :
+														DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRXAdj, cellID);
+				index = index + cellFaceID;
+				return DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRAdj, index);
+			}
+
+
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setCellCenter(I cellID, euc::EuclideanPoint<T,3>& center) {
+				CupCfdAoSoAMeshCellTile<T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->cellTiles, cellID / W);
+				I lane = cellID % W;
+
+				tile.center[0][lane] = center.cmp[0];
+				tile.center[1][lane] = center.cmp[1];
+				tile.center[2][lane] = center.cmp[2];
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setCellVolume(I cellID, T vol) {
+				DBG_SAFE_VECTOR_LOOKUP(this->cellTiles, cellID / W).volume[cellID % W] = vol;
+			}
+			
+			
+			template <class I, class T, class L, int W>
+			void CupCfdAoSoAMesh<I,T,L,W>::getCellID(L cellLabel, I * cellID) {
+				*cellID = DBG_SAFE_VECTOR_LOOKUP(this->cellBuildIDToLocalID, cellLabel);
+			}
+			
+			template <class I, class T, class L, int W>
+			I CupCfdAoSoAMesh<I,T,L,W>::getCellID(L cellLabel) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->cellBuildIDToLocalID, cellLabel);
+			}
+			
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getFaceNVertices(I faceID, I * nVertices) {
+				*nVertices = this->getFaceNVertices(faceID);
+			}
+			
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getFaceNVertices(I faceID) {
+				return this->faceVertexID.getNVertices(faceID);
+			}
+			
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getFaceCell1ID(I faceID, I * cellID) {
+				*cellID = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).cell1ID[faceID % W];
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getFaceCell1ID(I faceID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).cell1ID[faceID % W];
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getFaceCell2ID(I faceID, I * cellID) {
+				*cellID = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).cell2ID[faceID % W];
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getFaceCell2ID(I faceID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).cell2ID[faceID % W];
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getFaceLambda(I faceID, T * lambda) {
+				*lambda = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).lambda[faceID % W];
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getFaceLambda(I faceID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).lambda[faceID % W];
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getFaceNorm(I faceID, euc::EuclideanVector<T,3>& norm) {
+				const CupCfdAoSoAMeshFaceTile<I,T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W);
+				I lane = faceID % W;
+
+				norm.cmp[0] = tile.norm[0][lane];
+				norm.cmp[1] = tile.norm[1][lane];
+				norm.cmp[2] = tile.norm[2][lane];
+			}
+
+			template <class I, class T, class L, int W>
+			inline euc::EuclideanVector<T,3> CupCfdAoSoAMesh<I,T,L,W>::getFaceNorm(I faceID) {
+				const CupCfdAoSoAMeshFaceTile<I,T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W);
+				I lane = faceID % W;
+
+				return euc::EuclideanVector<T,3>(tile.norm[0][lane], tile.norm[1][lane], tile.norm[2][lane]);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getFaceVertex(I faceID, I faceVertexID, I * vertexID) {
+				*vertexID = this->faceVertexID.getVertex(faceID, faceVertexID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getFaceVertex(I faceID, I faceVertexID) {
+				return this->faceVertexID.getVertex(faceID, faceVertexID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getFaceCenter(I faceID, euc::EuclideanPoint<T,3>& center) {
+				const CupCfdAoSoAMeshFaceTile<I,T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W);
+				I lane = faceID % W;
+
+				center.cmp[0] = tile.center[0][lane];
+				center.cmp[1] = tile.center[1][lane];
+				center.cmp[2] = tile.center[2][lane];
+			}
+
+			template <class I, class T, class L, int W>
+			inline euc::EuclideanPoint<T,3> CupCfdAoSoAMesh<I,T,L,W>::getFaceCenter(I faceID) {
+				const CupCfdAoSoAMeshFaceTile<I,T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W);
+				I lane = faceID % W;
+
+				return euc::EuclideanPoint<T,3>(tile.center[0][lane], tile.center[1][lane], tile.center[2][lane]);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getFaceRLencos(I faceID, T * rlencos) {
+				*rlencos = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).rlencos[faceID % W];
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getFaceRLencos(I faceID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).rlencos[faceID % W];
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getFaceArea(I faceID, T * area) {
+				*area = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).area[faceID % W];
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getFaceArea(I faceID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).area[faceID % W];
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getFaceXpac(I faceID, euc::EuclideanPoint<T,3>& xpac) {
+				const CupCfdAoSoAMeshFaceTile<I,T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W);
+				I lane = faceID % W;
+
+				xpac.cmp[0] = tile.xpac[0][lane];
+				xpac.cmp[1] = tile.xpac[1][lane];
+				xpac.cmp[2] = tile.xpac[2][lane];
+			}
+
+			template <class I, class T, class L, int W>
+			inline euc::EuclideanPoint<T,3> CupCfdAoSoAMesh<I,T,L,W>::getFaceXpac(I faceID) {
+				const CupCfdAoSoAMeshFaceTile<I,T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W);
+				I lane = faceID % W;
+
+				return euc::EuclideanPoint<T,3>(tile.xpac[0][lane], tile.xpac[1][lane], tile.xpac[2][lane]);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getFaceXnac(I faceID, euc::EuclideanPoint<T,3>& xnac) {
+				const CupCfdAoSoAMeshFaceTile<I,T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W);
+				I lane = faceID % W;
+
+				xnac.cmp[0] = tile.xnac[0][lane];
+				xnac.cmp[1] = tile.xnac[1][lane];
+				xnac.cmp[2] = tile.xnac[2][lane];
+			}
+
+			template <class I, class T, class L, int W>
+			inline euc::EuclideanPoint<T,3> CupCfdAoSoAMesh<I,T,L,W>::getFaceXnac(I faceID) {
+				const CupCfdAoSoAMeshFaceTile<I,T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W);
+				I lane = faceID % W;
+
+				return euc::EuclideanPoint<T,3>(tile.xnac[0][lane], tile.xnac[1][lane], tile.xnac[2][lane]);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getFaceIsBoundary(I faceID, bool * result) {
+				if(DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).boundaryID[faceID % W] > -1) {
+					*result = true;
+				} else {
+					*result = false;
+				}
+			}
+
+			template <class I, class T, class L, int W>
+			inline bool CupCfdAoSoAMesh<I,T,L,W>::getFaceIsBoundary(I faceID) {
+				if(DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).boundaryID[faceID % W] > -1) {
+					return true;
+				}
+				return false;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getFaceBoundaryID(I faceID, I * boundaryID) {
+				*boundaryID = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).boundaryID[faceID % W];
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getFaceBoundaryID(I faceID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).boundaryID[faceID % W];
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setFaceCell1ID(I faceID, I cellID) {
+				DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).cell1ID[faceID % W] = cellID;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setFaceCell2ID(I faceID, I cellID) {
+				DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).cell2ID[faceID % W] = cellID;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setFaceLambda(I faceID, T lambda) {
+				DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).lambda[faceID % W] = lambda;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setFaceNorm(I faceID, euc::EuclideanVector<T,3>& norm) {
+				CupCfdAoSoAMeshFaceTile<I,T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W);
+				I lane = faceID % W;
+
+				tile.norm[0][lane] = norm.cmp[0];
+				tile.norm[1][lane] = norm.cmp[1];
+				tile.norm[2][lane] = norm.cmp[2];
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setFaceVertex(I faceID, I faceVertexID, I vertexID) {
+				this->faceVertexID.setVertex(faceID, faceVertexID, vertexID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setFaceCenter(I faceID, euc::EuclideanPoint<T,3>& center) {
+				CupCfdAoSoAMeshFaceTile<I,T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W);
+				I lane = faceID % W;
+
+				tile.center[0][lane] = center.cmp[0];
+				tile.center[1][lane] = center.cmp[1];
+				tile.center[2][lane] = center.cmp[2];
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setFaceRLencos(I faceID, T rlencos) {
+				DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).rlencos[faceID % W] = rlencos;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setFaceArea(I faceID, T area) {
+				DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).area[faceID % W] = area;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setFaceXpac(I faceID, euc::EuclideanPoint<T,3>& xpac) {
+				CupCfdAoSoAMeshFaceTile<I,T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W);
+				I lane = faceID % W;
+
+				tile.xpac[0][lane] = xpac.cmp[0];
+				tile.xpac[1][lane] = xpac.cmp[1];
+				tile.xpac[2][lane] = xpac.cmp[2];
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setFaceXnac(I faceID, euc::EuclideanPoint<T,3>& xnac) {
+				CupCfdAoSoAMeshFaceTile<I,T,W>& tile = DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W);
+				I lane = faceID % W;
+
+				tile.xnac[0][lane] = xnac.cmp[0];
+				tile.xnac[1][lane] = xnac.cmp[1];
+				tile.xnac[2][lane] = xnac.cmp[2];
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setFaceBoundaryID(I faceID, I boundaryID) {
+				DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, faceID / W).boundaryID[faceID % W] = boundaryID;
+			}
+			
+			template <class I, class T, class L, int W>
+			void CupCfdAoSoAMesh<I,T,L,W>::getFaceID(L faceLabel, I * faceID) {
+				*faceID = DBG_SAFE_VECTOR_LOOKUP(this->faceBuildIDToLocalID, faceLabel);
+			}
+
+			template <class I, class T, class L, int W>
+			I CupCfdAoSoAMesh<I,T,L,W>::getFaceID(L faceLabel) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->faceBuildIDToLocalID, faceLabel);
+			}
+			
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getBoundaryFaceID(I boundaryID, I * faceID) {
+				*faceID = DBG_SAFE_VECTOR_LOOKUP(this->boundaryFaceID, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getBoundaryFaceID(I boundaryID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->boundaryFaceID, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getBoundaryNVertices(I boundaryID) {
+				return this->boundaryVertexID.getNVertices(boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getBoundaryVertex(I boundaryID, I boundaryVertexID, I * vertexID) {
+				*vertexID = this->boundaryVertexID.getVertex(boundaryID, boundaryVertexID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getBoundaryVertex(I boundaryID, I boundaryVertexID) {
+				return this->boundaryVertexID.getVertex(boundaryID, boundaryVertexID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getBoundaryDistance(I boundaryID, T * distance) {
+				*distance = DBG_SAFE_VECTOR_LOOKUP(this->boundaryDistance, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getBoundaryDistance(I boundaryID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->boundaryDistance, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getBoundaryYPlus(I boundaryID, T * yPlus) {
+				*yPlus = DBG_SAFE_VECTOR_LOOKUP(this->boundaryYPlus, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getBoundaryYPlus(I boundaryID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->boundaryYPlus, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getBoundaryUPlus(I boundaryID, T * uPlus) {
+				*uPlus = DBG_SAFE_VECTOR_LOOKUP(this->boundaryUPlus, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getBoundaryUPlus(I boundaryID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->boundaryUPlus, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getBoundaryRegionID(I boundaryID, I * regionID) {
+				*regionID = DBG_SAFE_VECTOR_LOOKUP(this->boundaryRegionID, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getBoundaryRegionID(I boundaryID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->boundaryRegionID, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getBoundaryShear(I boundaryID, euc::EuclideanVector<T,3>& shear) {
+				shear = DBG_SAFE_VECTOR_LOOKUP(this->boundaryShear, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline euc::EuclideanVector<T,3> CupCfdAoSoAMesh<I,T,L,W>::getBoundaryShear(I boundaryID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->boundaryShear, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getBoundaryQ(I boundaryID, T * q) {
+				*q = DBG_SAFE_VECTOR_LOOKUP(this->boundaryQ, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getBoundaryQ(I boundaryID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->boundaryQ, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getBoundaryH(I boundaryID, T * h) {
+				*h = DBG_SAFE_VECTOR_LOOKUP(this->boundaryH, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getBoundaryH(I boundaryID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->boundaryH, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getBoundaryT(I boundaryID, T * t) {
+				*t = DBG_SAFE_VECTOR_LOOKUP(this->boundaryT, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getBoundaryT(I boundaryID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->boundaryT, boundaryID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setBoundaryFaceID(I boundaryID, I faceID) {
+				DBG_SAFE_VECTOR_LOOKUP(this->boundaryFaceID, boundaryID) = faceID;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setBoundaryVertex(I boundaryID, I boundaryVertexID, I vertexID) {
+				this->boundaryVertexID.setVertex(boundaryID, boundaryVertexID, vertexID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setBoundaryDistance(I boundaryID, T distance) {
+				DBG_SAFE_VECTOR_LOOKUP(this->boundaryDistance, boundaryID) = distance;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setBoundaryYPlus(I boundaryID, T yPlus) {
+				DBG_SAFE_VECTOR_LOOKUP(this->boundaryYPlus, boundaryID) = yPlus;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setBoundaryUPlus(I boundaryID, T uPlus) {
+				DBG_SAFE_VECTOR_LOOKUP(this->boundaryUPlus, boundaryID) = uPlus;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setBoundaryRegionID(I boundaryID, I regionID) {
+				DBG_SAFE_VECTOR_LOOKUP(this->boundaryRegionID, boundaryID) = regionID;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setBoundaryShear(I boundaryID, euc::EuclideanVector<T,3>& shear) {
+				DBG_SAFE_VECTOR_LOOKUP(this->boundaryShear, boundaryID) = shear;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setBoundaryQ(I boundaryID, T q) {
+				DBG_SAFE_VECTOR_LOOKUP(this->boundaryQ, boundaryID) = q;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setBoundaryH(I boundaryID, T h) {
+				DBG_SAFE_VECTOR_LOOKUP(this->boundaryH, boundaryID) = h;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setBoundaryT(I boundaryID, T t) {
+				DBG_SAFE_VECTOR_LOOKUP(this->boundaryT, boundaryID) = t;
+			}
+			
+			template <class I, class T, class L, int W>
+			void CupCfdAoSoAMesh<I,T,L,W>::getBoundaryID(L boundaryLabel, I * boundaryID) {
+				*boundaryID = DBG_SAFE_VECTOR_LOOKUP(this->boundaryBuildIDToLocalID, boundaryLabel);
+			}
+
+			template <class I, class T, class L, int W>
+			I CupCfdAoSoAMesh<I,T,L,W>::getBoundaryID(L boundaryLabel) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->boundaryBuildIDToLocalID, boundaryLabel);
+			}
+			
+			template <class I, class T, class L, int W>			
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionType(I regionID, RType * type) {
+				*type = DBG_SAFE_VECTOR_LOOKUP(this->regionType, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline RType CupCfdAoSoAMesh<I,T,L,W>::getRegionType(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionType, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionStd(I regionID, bool * std) {
+				*std = DBG_SAFE_VECTOR_LOOKUP(this->regionStd, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline bool CupCfdAoSoAMesh<I,T,L,W>::getRegionStd(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionStd, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionYLog(I regionID, T * yLog) {
+				*yLog = DBG_SAFE_VECTOR_LOOKUP(this->regionYLog, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getRegionYLog(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionYLog, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionELog(I regionID, T * eLog) {
+				*eLog = DBG_SAFE_VECTOR_LOOKUP(this->regionELog, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getRegionELog(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionELog, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionDensity(I regionID, T * density) {
+				*density = DBG_SAFE_VECTOR_LOOKUP(this->regionDensity, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getRegionDensity(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionDensity, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionTurbKE(I regionID, T * turbKE) {
+				*turbKE = DBG_SAFE_VECTOR_LOOKUP(this->regionTurbKE, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getRegionTurbKE(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionTurbKE, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionTurbDiss(I regionID, T * turbDiss) {
+				*turbDiss = DBG_SAFE_VECTOR_LOOKUP(this->regionTurbDiss, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getRegionTurbDiss(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionTurbDiss, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionSplvl(I regionID, T * splvl) {
+				*splvl = DBG_SAFE_VECTOR_LOOKUP(this->regionSplvl, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getRegionSplvl(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionSplvl, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionDen(I regionID, T * den) {
+				*den = DBG_SAFE_VECTOR_LOOKUP(this->regionDen, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getRegionDen(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionDen, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionForceTangent(I regionID, euc::EuclideanVector<T,3>& forceTangent) {
+				forceTangent = DBG_SAFE_VECTOR_LOOKUP(this->regionForceTangent, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline euc::EuclideanVector<T,3> CupCfdAoSoAMesh<I,T,L,W>::getRegionForceTangent(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionForceTangent, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionUVW(I regionID, euc::EuclideanVector<T,3>& uvw) {
+				uvw = DBG_SAFE_VECTOR_LOOKUP(this->regionUVW, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline euc::EuclideanVector<T,3> CupCfdAoSoAMesh<I,T,L,W>::getRegionUVW(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionUVW, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionName(I regionID, std::string& regionName) {
+				regionName = DBG_SAFE_VECTOR_LOOKUP(this->regionName, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline std::string CupCfdAoSoAMesh<I,T,L,W>::getRegionName(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionName, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionFlux(I regionID, bool * flux) {
+				*flux = DBG_SAFE_VECTOR_LOOKUP(this->regionFlux, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline bool CupCfdAoSoAMesh<I,T,L,W>::getRegionFlux(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionFlux, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionAdiab(I regionID, bool * adiab) {
+				*adiab = DBG_SAFE_VECTOR_LOOKUP(this->regionAdiab, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline bool CupCfdAoSoAMesh<I,T,L,W>::getRegionAdiab(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionAdiab, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionR(I regionID, T * r) {
+				*r = DBG_SAFE_VECTOR_LOOKUP(this->regionR, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getRegionR(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionR, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getRegionT(I regionID, T * t) {
+				*t = DBG_SAFE_VECTOR_LOOKUP(this->regionT, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline T CupCfdAoSoAMesh<I,T,L,W>::getRegionT(I regionID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionT, regionID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionType(I regionID, RType type) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionType, regionID) = type;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionStd(I regionID, bool std) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionStd, regionID) = std;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionYLog(I regionID, T yLog) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionYLog, regionID) = yLog;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionELog(I regionID, T eLog) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionELog, regionID) = eLog;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionDensity(I regionID, T density) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionDensity, regionID) = density;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionTurbKE(I regionID, T turbKE) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionTurbKE, regionID) = turbKE;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionTurbDiss(I regionID, T turbDiss) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionTurbDiss, regionID) = turbDiss;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionSplvl(I regionID, T splvl) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionSplvl, regionID) = splvl;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionDen(I regionID, T den) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionDen, regionID) = den;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionForceTangent(I regionID, euc::EuclideanVector<T,3>& forceTangent) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionForceTangent, regionID) = forceTangent;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionUVW(I regionID, euc::EuclideanVector<T,3>& uvw) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionUVW, regionID) = uvw;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionName(I regionID, std::string& regionName) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionName, regionID) = regionName;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionFlux(I regionID, bool flux) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionFlux, regionID) = flux;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionAdiab(I regionID, bool adiab) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionAdiab, regionID) = adiab;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionR(I regionID, T r) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionR, regionID) = r;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setRegionT(I regionID, T t) {
+				DBG_SAFE_VECTOR_LOOKUP(this->regionT, regionID) = t;
+			}
+			
+			template <class I, class T, class L, int W>
+			void CupCfdAoSoAMesh<I,T,L,W>::getRegionID(L regionLabel, I * regionID) {
+				*regionID = DBG_SAFE_VECTOR_LOOKUP(this->regionBuildIDToLocalID, regionLabel);;
+			}
+
+			template <class I, class T, class L, int W>
+			I CupCfdAoSoAMesh<I,T,L,W>::getRegionID(L regionLabel) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->regionBuildIDToLocalID, regionLabel);
+			}
+			
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getVertexPos(I vertexID, euc::EuclideanPoint<T,3>& pos) {
+				pos = DBG_SAFE_VECTOR_LOOKUP(this->verticesPos, vertexID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline euc::EuclideanPoint<T,3> CupCfdAoSoAMesh<I,T,L,W>::getVertexPos(I vertexID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->verticesPos, vertexID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::setVertexPos(I vertexID, euc::EuclideanPoint<T,3>& pos) {
+				DBG_SAFE_VECTOR_LOOKUP(this->verticesPos, vertexID) = pos;
+			}
+
+			template <class I, class T, class L, int W>
+			inline void CupCfdAoSoAMesh<I,T,L,W>::getVertexID(L vertexLabel, I * vertexID) {
+				*vertexID = DBG_SAFE_VECTOR_LOOKUP(this->vertexBuildIDToLocalID, vertexLabel);
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getVertexID(L vertexLabel) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->vertexBuildIDToLocalID, vertexLabel);
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getNFaceTiles() {
+				return (this->nFaceRecords + W - 1) / W;
+			}
+
+			template <class I, class T, class L, int W>
+			inline const CupCfdAoSoAMeshFaceTile<I,T,W>& CupCfdAoSoAMesh<I,T,L,W>::getFaceTile(I tileID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->faceTiles, tileID);
+			}
+
+			template <class I, class T, class L, int W>
+			inline I CupCfdAoSoAMesh<I,T,L,W>::getNCellTiles() {
+				return (this->nCellRecords + W - 1) / W;
+			}
+
+			template <class I, class T, class L, int W>
+			inline const CupCfdAoSoAMeshCellTile<T,W>& CupCfdAoSoAMesh<I,T,L,W>::getCellTile(I tileID) {
+				return DBG_SAFE_VECTOR_LOOKUP(this->cellTiles, tileID);
+			}
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,199 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the CupCfdMeshFaceVertices Class
+ */
+
+#ifndef CUPCFD_GEOMETRY_MESH_CUPCFD_MESH_FACE_VERTICES_INCLUDE_H
+#define CUPCFD_GEOMETRY_MESH_CUPCFD_MESH_FACE_VERTICES_INCLUDE_H
+
+// Select the layout of the face/boundary vertex stores of the meshes.
+// 1: Fixed layout of 4 vertex slots per face - only triangular and quadrilateral faces are supported.
+// 0: CSR layout - faces may have any number of vertices (at least 3), for polyhedral meshes.
+#ifndef CUPCFD_MESH_FIXED_FACE_VERTICES
+#define CUPCFD_MESH_FIXED_FACE_VERTICES 1
+#endif
+
+#include <vector>
+#include <array>
+
+#include "SnapshotFile.h"
+#include "AlignedAllocator.h"
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			/**
+			 * Stores the local vertex IDs of each face (or boundary) of a mesh.
+			 *
+			 * With CUPCFD_MESH_FIXED_FACE_VERTICES set (the default), each face has 4 vertex slots,
+			 * where a -1 in the last slot marks a triangular face. This keeps lookups to a single
+			 * indexed load, but limits faces to 3 or 4 vertices.
+			 *
+			 * Otherwise, the vertices are stored in CSR form, where the vertices of face i are
+			 * adj[xadj[i]] to adj[xadj[i+1] - 1], so faces may have any number of vertices.
+			 *
+			 * @tparam I The type of the indexing scheme
+			 */
+			template <class I>
+			class CupCfdMeshFaceVertices
+			{
+				public:
+					// === Members ===
+
+					#if CUPCFD_MESH_FIXED_FACE_VERTICES
+						/** Vertex IDs of each face. A -1 indicates no association. **/
+						cupcfd::data_structures::AlignedVector<std::array<I,4>> vertexID;
+					#else
+						/** Offsets into adj for the vertices of each face (size nFaces + 1) **/
+						cupcfd::data_structures::AlignedVector<I> xadj;
+
+						/** Vertex IDs of each face, stored face by face **/
+						cupcfd::data_structures::AlignedVector<I> adj;
+					#endif
+
+					// === Constructors/Deconstructors ===
+
+					/**
+					 * Create an empty store
+					 */
+					CupCfdMeshFaceVertices();
+
+					/**
+					 * Deconstructor
+					 */
+					~CupCfdMeshFaceVertices();
+
+					// === Concrete Methods ===
+
+					/**
+					 * @return The number of faces stored
+					 */
+					inline I size() const;
+
+					/**
+					 * Check whether a face with the given number of vertices can be stored
+					 *
+					 * @param nVertices The number of vertices
+					 *
+					 * @return Whether the vertex count is supported by the layout
+					 */
+					static inline bool isValidCount(I nVertices);
+
+					/**
+					 * @param faceID The local ID of the face
+					 *
+					 * @return The number of vertices of the face
+					 */
+					inline I getNVertices(I faceID) const;
+
+					/**
+					 * @param faceID The local ID of the face
+					 * @param faceVertexID The position of the vertex within the face
+					 *
+					 * @return The local vertex ID
+					 */
+					inline I getVertex(I faceID, I faceVertexID) const;
+
+					/**
+					 * @param faceID The local ID of the face
+					 * @param faceVertexID The position of the vertex within the face
+					 * @param vertexID The local vertex ID to set
+					 */
+					inline void setVertex(I faceID, I faceVertexID, I vertexID);
+
+					/**
+					 * Append a face with nVertices vertices, all set to -1.
+					 * The vertex count must be valid for the layout.
+					 *
+					 * @param nVertices The number of vertices of the face
+					 */
+					void append(I nVertices);
+
+					/**
+					 * Append nFaces faces, all vertices set to -1. Face i has
+					 * vertexXAdj[i+1] - vertexXAdj[i] vertices.
+					 *
+					 * The vertices of the new faces can then be set in parallel.
+					 * Invalid vertex counts are not checked here, but are sized as if valid
+					 * (where possible) so that the store can be truncated afterwards.
+					 *
+					 * @param vertexXAdj The vertex offsets of the new faces (size nFaces + 1)
+					 * @param nFaces The number of faces to append
+					 */
+					void append(const I * vertexXAdj, I nFaces);
+
+					/**
+					 * Remove all faces from nFaces onwards
+					 *
+					 * @param nFaces The number of faces to keep
+					 */
+					void truncate(I nFaces);
+
+					/**
+					 * Remove all faces
+					 */
+					void clear();
+
+					/**
+					 * Release any spare capacity left by appending, so that the store is held in a
+					 * single allocation of the exact size (first touched in parallel, see AlignedAllocator).
+					 */
+					void shrinkToFit();
+
+					/**
+					 * Count the pages of the store held on each NUMA node
+					 * (see cupcfd::utility::drivers::getPageNodes)
+					 *
+					 * @param nodePages The number of pages on each node, indexed by node (added to)
+					 * @param nUnplaced A pointer to a count that is increased by the number of untouched pages
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS The pages were counted
+					 * @retval cupcfd::error::E_ERROR Page placement cannot be queried on this system
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getPagePlacement(std::vector<std::size_t>& nodePages, std::size_t * nUnplaced);
+
+					/**
+					 * Write the stored vertices to a snapshot file
+					 *
+					 * @param file The snapshot file to write to, open for writing
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS The vertices were written
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes writeSnapshot(cupcfd::io::SnapshotFile& file);
+
+					/**
+					 * Restore the vertices written by writeSnapshot, replacing the stored faces.
+					 * The snapshot must have been written with the same vertex layout.
+					 *
+					 * @param file The snapshot file to read from, open for reading
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS The vertices were restored
+					 * @retval cupcfd::error::E_INVALID_FILE_FORMAT The data in the file is inconsistent
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes readSnapshot(cupcfd::io::SnapshotFile& file);
+			};
+		}
+	}
+}
+
+// Include Header Level Definitions
+#include "CupCfdMeshFaceVertices.ipp"
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the CupCfdMeshFaceVertices Class
+ */
+
+#ifndef CUPCFD_GEOMETRY_MESH_CUPCFD_MESH_FACE_VERTICES_IPP_H
+#define CUPCFD_GEOMETRY_MESH_CUPCFD_MESH_FACE_VERTICES_IPP_H
+
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I>
+			inline I CupCfdMeshFaceVertices<I>::size() const {
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					return (I) this->vertexID.size();
+				#else
+					return (I) (this->xadj.size() - 1);
+				#endif
+			}
+
+			template <class I>
+			inline bool CupCfdMeshFaceVertices<I>::isValidCount(I nVertices) {
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					return (nVertices >= 3) && (nVertices <= 4);
+				#else
+					return (nVertices >= 3);
+				#endif
+			}
+
+			template <class I>
+			inline I CupCfdMeshFaceVertices<I>::getNVertices(I faceID) const {
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					if(DBG_SAFE_VECTOR_LOOKUP(this->vertexID, faceID)[3] == -1) {
+						return 3;
+					}
+
+					return 4;
+				#else
+					return DBG_SAFE_VECTOR_LOOKUP(this->xadj, faceID + 1) - DBG_SAFE_VECTOR_LOOKUP(this->xadj, faceID);
+				#endif
+			}
+
+			template <class I>
+			inline I CupCfdMeshFaceVertices<I>::getVertex(I faceID, I faceVertexID) const {
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					return DBG_SAFE_VECTOR_LOOKUP(this->vertexID, faceID)[faceVertexID];
+				#else
+					return DBG_SAFE_VECTOR_LOOKUP(this->adj, DBG_SAFE_VECTOR_LOOKUP(this->xadj, faceID) + faceVertexID);
+				#endif
+			}
+
+			template <class I>
+			inline void CupCfdMeshFaceVertices<I>::setVertex(I faceID, I faceVertexID, I vertexID) {
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					DBG_SAFE_VECTOR_LOOKUP(this->vertexID, faceID)[faceVertexID] = vertexID;
+				#else
+					DBG_SAFE_VECTOR_LOOKUP(this->adj, DBG_SAFE_VECTOR_LOOKUP(this->xadj, faceID) + faceVertexID) = vertexID;
+				#endif
+			}
+		}
+	}
+}
+
+#endif
@@ -35,12 +35,20 @@
 // Mesh Size Data
 #include "UnstructuredMeshProperties.h"
 
+// Build Label Maps
+#include "FlatHashMap.h"
+
+// Face/Boundary Vertex Storage
+#include "CupCfdMeshFaceVertices.h"
+
+// Aligned, Parallel First-Touch Storage
+#include "AlignedAllocator.h"
+
 // Error Codes
 #include "Error.h"
 
 // C++ Library
 #include <vector>
-#include <map>
 
 namespace euc = cupcfd::geometry::euclidean;
 
@@ -68,30 +76,30 @@ namespace cupcfd
 					// Worst case is copy across to an array once the finalize step is triggered.
 
 					/** Boundary Data **/
-					std::vector<I> boundaryFaceID;
-					std::vector<std::array<I,4>> boundaryVertexID;
-					std::vector<T> boundaryDistance;
-					std::vector<T> boundaryYPlus;
-					std::vector<T> boundaryUPlus;
-					std::vector<I> boundaryRegionID;
-					std::vector<euc::EuclideanVector<T,3>> boundaryShear;
-					std::vector<T> boundaryQ;
-					std::vector<T> boundaryH;
-					std::vector<T> boundaryT;
+					cupcfd::data_structures::AlignedVector<I> boundaryFaceID;
+					CupCfdMeshFaceVertices<I> boundaryVertexID;
+					cupcfd::data_structures::AlignedVector<T> boundaryDistance;
+					cupcfd::data_structures::AlignedVector<T> boundaryYPlus;
+					cupcfd::data_structures::AlignedVector<T> boundaryUPlus;
+					cupcfd::data_structures::AlignedVector<I> boundaryRegionID;
+					cupcfd::data_structures::AlignedVector<euc::EuclideanVector<T,3>> boundaryShear;
+					cupcfd::data_structures::AlignedVector<T> boundaryQ;
+					cupcfd::data_structures::AlignedVector<T> boundaryH;
+					cupcfd::data_structures::AlignedVector<T> boundaryT;
 
 					/** Cell Data **/
-					std::vector<euc::EuclideanPoint<T,3>> cellCenter;
-					std::vector<T> cellVolume;
+					cupcfd::data_structures::AlignedVector<euc::EuclideanPoint<T,3>> cellCenter;
+					cupcfd::data_structures::AlignedVector<T> cellVolume;
 
 					/** Storage for number of faces per cell globally across mesh, indexed by local ID **/
-					std::vector<I> cellNGFaces;
+					cupcfd::data_structures::AlignedVector<I> cellNGFaces;
 
 					/**
 					 * Storage for number of faces per cell stored on this mesh, indexed by local ID
 					 * (primarily different for ghost cells, where not all faces are stored).
 					 *
 					 **/
-					std::vector<I> cellNFaces;
+					cupcfd::data_structures::AlignedVector<I> cellNFaces;
 
 
 					/**
@@ -99,40 +107,47 @@ namespace cupcfd
 					 * - i.e. for ghost cells this stores the actual value and not just what is stored
 					 * locally.
 					 **/
-					std::vector<I> cellNGVertices;
+					cupcfd::data_structures::AlignedVector<I> cellNGVertices;
 
 					/**
 					 * Storage for number of vertices per cell stored on this mesh, indexed by local ID
 					 * - i.e. for ghost cells this stores the actual value and not just what is stored
 					 * locally.
 					 **/
-					std::vector<I> cellNVertices;
+					cupcfd::data_structures::AlignedVector<I> cellNVertices;
 
 					// These two menbers are used for mapping Cells to Faces. Done here as CSR rather than
 					// in the Cell structure to avoid inflating the size of Cell structs/classes for
 					// proxy reasons
 
 					/** Cell -> Face CSR Lookup Data - XAdj - Cell->A Start Index Lookup **/
-					std::vector<I> cellFaceMapCSRXAdj;
+					cupcfd::data_structures::AlignedVector<I> cellFaceMapCSRXAdj;
 
 					/** Cell -> Face CSR Lookup Data - Adj - Face Indexes **/
-					std::vector<I> cellFaceMapCSRAdj;
+					cupcfd::data_structures::AlignedVector<I> cellFaceMapCSRAdj;
+
+					/**
+					 * Number of faces per cell in cellFaceMapCSRAdj when every cell has the same fixed type
+					 * (see packCellFaceMap). The faces of cell i then start at i * cellFaceStride, and
+					 * cellFaceMapCSRXAdj is empty. If 0, the faces of cell i start at cellFaceMapCSRXAdj[i].
+					 **/
+					I cellFaceStride = 0;
 
 
 					/** Face Data **/
-					std::vector<I> faceCell1ID;
-					std::vector<I> faceCell2ID;
-					std::vector<T> faceLambda;
-					std::vector<euc::EuclideanVector<T,3>> faceNorm;
-					std::vector<euc::EuclideanPoint<T,3>> faceCenter;
-					std::vector<T> faceRLencos;
-					std::vector<T> faceArea;
-					std::vector<euc::EuclideanPoint<T,3>> faceXpac;
-					std::vector<euc::EuclideanPoint<T,3>> faceXnac;
-					std::vector<I> faceBoundaryID;
+					cupcfd::data_structures::AlignedVector<I> faceCell1ID;
+					cupcfd::data_structures::AlignedVector<I> faceCell2ID;
+					cupcfd::data_structures::AlignedVector<T> faceLambda;
+					cupcfd::data_structures::AlignedVector<euc::EuclideanVector<T,3>> faceNorm;
+					cupcfd::data_structures::AlignedVector<euc::EuclideanPoint<T,3>> faceCenter;
+					cupcfd::data_structures::AlignedVector<T> faceRLencos;
+					cupcfd::data_structures::AlignedVector<T> faceArea;
+					cupcfd::data_structures::AlignedVector<euc::EuclideanPoint<T,3>> faceXpac;
+					cupcfd::data_structures::AlignedVector<euc::EuclideanPoint<T,3>> faceXnac;
+					cupcfd::data_structures::AlignedVector<I> faceBoundaryID;
 
-					// Currently hard-coded to 4 vertices max.
-					std::vector<std::array<I,4>> faceVertexID;
+					// Fixed 4 vertex slots, or CSR (see CUPCFD_MESH_FIXED_FACE_VERTICES)
+					CupCfdMeshFaceVertices<I> faceVertexID;
 
 
 					/** Region Data **/
@@ -154,7 +169,7 @@ namespace cupcfd
 					std::vector<T> regionT;
 
 					/** Vertices Data **/
-					std::vector<euc::EuclideanPoint<T,3>> verticesPos;
+					cupcfd::data_structures::AlignedVector<euc::EuclideanPoint<T,3>> verticesPos;
 
 
 					/**
@@ -162,35 +177,35 @@ namespace cupcfd
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> vertexBuildIDToLocalID;
+					cupcfd::data_structures::FlatHashMap<L, I> vertexBuildIDToLocalID;
 
 					/**
 					 * Scratch Space - Map Scheme Build Boundary Label to Local ID
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> boundaryBuildIDToLocalID;
+					cupcfd::data_structures::FlatHashMap<L, I> boundaryBuildIDToLocalID;
 
 					/**
 					 * Scratch Space - Map Scheme Build Region Label to Local ID
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> regionBuildIDToLocalID;
+					cupcfd::data_structures::FlatHashMap<L, I> regionBuildIDToLocalID;
 
 					/**
 					 * Scratch Space - Map Scheme Build Cell Label to Local ID
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> cellBuildIDToLocalID;
+					cupcfd::data_structures::FlatHashMap<L, I> cellBuildIDToLocalID;
 
 					/**
 					 * Scratch Space - Map Scheme Build Face Label to Local ID
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> faceBuildIDToLocalID;
+					cupcfd::data_structures::FlatHashMap<L, I> faceBuildIDToLocalID;
 
 					// === Constructors/Deconstructors ===
 
@@ -259,6 +274,13 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes addCell(L cellLabel, bool isLocal);
 
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addCells(L * cellLabels,
+													euc::EuclideanPoint<T,3> * centers,
+													T * vols,
+													I nCells,
+													bool isLocal);
+
 					void getCellID(L cellLabel, I * cellID);
 
 					__attribute__((warn_unused_result))
@@ -338,6 +360,21 @@ namespace cupcfd
 													bool isBoundary,
 													L * vertexLabels, I nVertexLabels);
 
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addFaces(L * faceLabels,
+													L * cell1Labels,
+													L * cell2OrBoundaryLabels,
+													bool * isBoundary,
+													T * lambda,
+													euc::EuclideanVector3D<T> * norm,
+													I * vertexXAdj, L * vertexLabels,
+													euc::EuclideanPoint<T,3> * center,
+													euc::EuclideanPoint<T,3> * xpac,
+													euc::EuclideanPoint<T,3> * xnac,
+													T * rlencos,
+													T * area,
+													I nFaces);
+
 
 					void getFaceID(L faceLabel, I * faceID);
 					__attribute__((warn_unused_result))
@@ -348,6 +385,8 @@ namespace cupcfd
 					inline void getBoundaryFaceID(I boundaryID, I * faceID);
 					__attribute__((warn_unused_result))
 					inline I getBoundaryFaceID(I boundaryID);
+					__attribute__((warn_unused_result))
+					inline I getBoundaryNVertices(I boundaryID);
 					inline void getBoundaryVertex(I boundaryID, I boundaryVertexID, I * vertexID);
 					__attribute__((warn_unused_result))
 					inline I getBoundaryVertex(I boundaryID, I boundaryVertexID);
@@ -397,6 +436,13 @@ namespace cupcfd
 													L regionLabel,
 													L * vertexLabels, I nVertexLabels);
 
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addBoundaries(L * boundaryLabels,
+													L * regionLabels,
+													I * vertexXAdj, L * vertexLabels,
+													T * distance,
+													I nBoundaries);
+
 					void getBoundaryID(L boundaryLabel, I * boundaryID);
 					__attribute__((warn_unused_result))
 					I getBoundaryID(L boundaryLabel);
@@ -502,6 +548,8 @@ namespace cupcfd
 					inline euc::EuclideanPoint<T,3> getVertexPos(I vertexID);
 					inline void setVertexPos(I vertexID, euc::EuclideanPoint<T,3>& pos);
 					cupcfd::error::eCodes addVertex(L vertexLabel, euc::EuclideanPoint<T,3>& pos);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addVertices(L * vertexLabels, euc::EuclideanPoint<T,3> * pos, I nVertices);
 					inline void getVertexID(L vertexLabel, I * vertexID);
 					__attribute__((warn_unused_result))
 					inline I getVertexID(L vertexLabel);
@@ -542,6 +590,19 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes updateCellFaceMap();
 
+					/**
+					 * If every cell on this rank has the same fixed type (properties.cellType), repack the cell->face
+					 * mapping built by updateCellFaceMap with a fixed stride of the number of faces of that type, so
+					 * that looking up a face of a cell does not need the CSR offsets. Ghost cells only store the faces
+					 * that adjoin a local cell, so their remaining entries are set to -1.
+					 *
+					 * If the cell type is not known, the CSR mapping is left in place.
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 */
+					void packCellFaceMap();
+
 					/**
 					 *
 					 */
@@ -554,6 +615,59 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes exchangeCellGlobalNFaces();
 
+					/**
+					 * Release the spare capacity left in the stores by adding elements, so that each store is held
+					 * in a single allocation of the exact size, first touched in parallel with a static schedule
+					 * (see AlignedAllocator). Stores that are already exactly sized (e.g. filled by a single
+					 * bulk add) are left in place. Called as part of the finalize step.
+					 */
+					void shrinkStores();
+
+					/**
+					 * Count the pages of the mesh stores held on each NUMA node, using a query-only move_pages
+					 * call (see cupcfd::utility::drivers::getPageNodes).
+					 *
+					 * @param nodePages The number of pages on each node, indexed by node (added to)
+					 * @param nUnplaced A pointer to a count that is increased by the number of untouched pages
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_ERROR Page placement cannot be queried on this system
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getPagePlacement(std::vector<std::size_t>& nodePages, std::size_t * nUnplaced);
+
+					/**
+					 * @return The number of bytes of heap memory used by the maps from build IDs to local IDs
+					 */
+					std::size_t getBuildMapMemoryBytes() const;
+
+					/**
+					 * Append the data stores of this mesh implementation to a snapshot.
+					 * Called by writeSnapshot after the common mesh data has been written.
+					 *
+					 * @param file The snapshot file, open for writing
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_ERROR The write failed
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes writeSnapshotData(cupcfd::io::SnapshotFile& file);
+
+					/**
+					 * Restore the data stores of this mesh implementation from a snapshot written by writeSnapshotData.
+					 * Called by readSnapshot after the common mesh data has been read.
+					 *
+					 * @param file The snapshot file, open for reading
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_INVALID_FILE_FORMAT The sections are missing or do not match the mesh properties
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes readSnapshotData(cupcfd::io::SnapshotFile& file);
+
 					// === Pure Methods ===
 			};
 		}
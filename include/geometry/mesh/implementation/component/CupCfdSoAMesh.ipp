@@ -105,13 +105,17 @@ namespace cupcfd
 
 			template <class I, class T, class L>
 			inline void CupCfdSoAMesh<I,T,L>::getCellFaceID(I cellID, I cellFaceID, I * faceID) {
-				I index = DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRXAdj, cellID) + cellFaceID;
+				I index = (this->cellFaceStride > 0) ? (cellID * this->cellFaceStride) :
+														DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRXAdj, cellID);
+				index = index + cellFaceID;
 				*faceID = DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRAdj, index);
 			}
 
 			template <class I, class T, class L>
 			inline I CupCfdSoAMesh<I,T,L>::getCellFaceID(I cellID, I cellFaceID) {
-				I index = DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRXAdj, cellID) + cellFaceID;
+				I index = (this->cellFaceStride > 0) ? (cellID * this->cellFaceStride) :
+														DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRXAdj, cellID);
+				index = index + cellFaceID;
 				return DBG_SAFE_VECTOR_LOOKUP(this->cellFaceMapCSRAdj, index);
 			}
 
@@ -145,12 +149,7 @@ namespace cupcfd
 			
 			template <class I, class T, class L>
 			inline I CupCfdSoAMesh<I,T,L>::getFaceNVertices(I faceID) {
-				// Currently we can only have three or four vertices max per face
-				if(DBG_SAFE_VECTOR_LOOKUP(this->faceVertexID, faceID)[3] == -1) {
-					return 3;
-				} else {
-					return 4;
-				}
+				return this->faceVertexID.getNVertices(faceID);
 			}
 			
 			template <class I, class T, class L>
@@ -195,12 +194,12 @@ namespace cupcfd
 
 			template <class I, class T, class L>
 			inline void CupCfdSoAMesh<I,T,L>::getFaceVertex(I faceID, I faceVertexID, I * vertexID) {
-				*vertexID = DBG_SAFE_VECTOR_LOOKUP(this->faceVertexID, faceID)[faceVertexID];
+				*vertexID = this->faceVertexID.getVertex(faceID, faceVertexID);
 			}
 
 			template <class I, class T, class L>
 			inline I CupCfdSoAMesh<I,T,L>::getFaceVertex(I faceID, I faceVertexID) {
-				return DBG_SAFE_VECTOR_LOOKUP(this->faceVertexID, faceID)[faceVertexID];
+				return this->faceVertexID.getVertex(faceID, faceVertexID);
 			}
 
 			template <class I, class T, class L>
@@ -302,7 +301,7 @@ namespace cupcfd
 
 			template <class I, class T, class L>
 			inline void CupCfdSoAMesh<I,T,L>::setFaceVertex(I faceID, I faceVertexID, I vertexID) {
-				DBG_SAFE_VECTOR_LOOKUP(this->faceVertexID, faceID)[faceVertexID] = vertexID;
+				this->faceVertexID.setVertex(faceID, faceVertexID, vertexID);
 			}
 
 			template <class I, class T, class L>
@@ -355,14 +354,19 @@ namespace cupcfd
 				return DBG_SAFE_VECTOR_LOOKUP(this->boundaryFaceID, boundaryID);
 			}
 
+			template <class I, class T, class L>
+			inline I CupCfdSoAMesh<I,T,L>::getBoundaryNVertices(I boundaryID) {
+				return this->boundaryVertexID.getNVertices(boundaryID);
+			}
+
 			template <class I, class T, class L>
 			inline void CupCfdSoAMesh<I,T,L>::getBoundaryVertex(I boundaryID, I boundaryVertexID, I * vertexID) {
-				*vertexID = DBG_SAFE_VECTOR_LOOKUP(this->boundaryVertexID, boundaryID)[boundaryVertexID];
+				*vertexID = this->boundaryVertexID.getVertex(boundaryID, boundaryVertexID);
 			}
 
 			template <class I, class T, class L>
 			inline I CupCfdSoAMesh<I,T,L>::getBoundaryVertex(I boundaryID, I boundaryVertexID) {
-				return DBG_SAFE_VECTOR_LOOKUP(this->boundaryVertexID, boundaryID)[boundaryVertexID];
+				return this->boundaryVertexID.getVertex(boundaryID, boundaryVertexID);
 			}
 
 			template <class I, class T, class L>
@@ -452,7 +456,7 @@ namespace cupcfd
 
 			template <class I, class T, class L>
 			inline void CupCfdSoAMesh<I,T,L>::setBoundaryVertex(I boundaryID, I boundaryVertexID, I vertexID) {
-				DBG_SAFE_VECTOR_LOOKUP(this->boundaryVertexID, boundaryID)[boundaryVertexID] = vertexID;
+				this->boundaryVertexID.setVertex(boundaryID, boundaryVertexID, vertexID);
 			}
 
 			template <class I, class T, class L>
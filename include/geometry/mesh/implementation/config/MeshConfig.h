@@ -16,6 +16,8 @@
 // Error Codes
 #include "Error.h"
 
+#include <string>
+
 // Partitioner Configuration Objects
 #include "PartitionerConfig.h"
 #include "MeshSourceConfig.h"
@@ -49,11 +51,34 @@ namespace cupcfd
 
 					/** Stores the configuration for partitioning the mesh. **/
 					// Note this uses the same type as the indexing for node labels
-					cupcfd::partitioner::PartitionerConfig<I,I> * partConfig;
+					cupcfd::partitioner::PartitionerConfig<I,L> * partConfig;
 
 					/** Stores the mesh data source configuration**/
 					MeshSourceConfig<I,T,L> * meshSourceConfig;
 
+					/**
+					 * The number of cells/faces/boundaries/vertices to read from the mesh source per batch
+					 * while building the mesh. 0 reads all of them at once.
+					 **/
+					I buildChunkSize;
+
+					/**
+					 * The number of layers of ghost cells to build around the cells owned by each rank. 1 by default.
+					 **/
+					I haloDepth;
+
+					/**
+					 * The number of times the mesh is uniformly refined after it is built. 0 by default.
+					 **/
+					I refinementLevels;
+
+					/**
+					 * The directory used to store mesh snapshots. If set, the mesh is restored from a snapshot
+					 * built with the same configuration where one exists, and a snapshot is stored after
+					 * building it otherwise. Empty disables snapshots.
+					 **/
+					std::string snapshotPath;
+
 					// === Constructor/Deconstructor ===
 
 					/**
@@ -62,7 +87,7 @@ namespace cupcfd
 					 *
 					 * @param partConfig Partitioner Configuration
 					 */
-					MeshConfig(cupcfd::partitioner::PartitionerConfig<I,I>& partConfig,
+					MeshConfig(cupcfd::partitioner::PartitionerConfig<I,L>& partConfig,
 							   MeshSourceConfig<I,T,L>& meshSourceConfig);
 
 					/**
@@ -86,7 +111,7 @@ namespace cupcfd
 					 * @return The partitioner configuration stored for this mesh configuration.
 					 */
 					__attribute__((warn_unused_result))
-					inline cupcfd::partitioner::PartitionerConfig<I,I> * getPartitionerConfig();
+					inline cupcfd::partitioner::PartitionerConfig<I,L> * getPartitionerConfig();
 
 					/**
 					 * Set the partitioner configuration.
@@ -95,7 +120,7 @@ namespace cupcfd
 					 *
 					 * @return Nothing
 					 */
-					inline void setPartitionerConfig(cupcfd::partitioner::PartitionerConfig<I,I>& partConfig);
+					inline void setPartitionerConfig(cupcfd::partitioner::PartitionerConfig<I,L>& partConfig);
 
 					/**
 					 * Get a cloned copy of the mesh source configuration
@@ -114,6 +139,78 @@ namespace cupcfd
 					 */
 					inline void setMeshSourceConfig(MeshSourceConfig<I,T,L>& meshSourceConfig);
 
+					/**
+					 * Get the number of elements read from the mesh source per batch when building the mesh
+					 *
+					 * @return The build chunk size. 0 if the data is read in a single batch.
+					 */
+					inline I getBuildChunkSize();
+
+					/**
+					 * Set the number of elements read from the mesh source per batch when building the mesh.
+					 * Smaller batches reduce the memory used during construction.
+					 *
+					 * @param buildChunkSize The build chunk size. 0 or less reads the data in a single batch.
+					 *
+					 * @return Nothing
+					 */
+					inline void setBuildChunkSize(I buildChunkSize);
+
+					/**
+					 * Get the number of layers of ghost cells built around the cells owned by each rank
+					 *
+					 * @return The halo depth
+					 */
+					inline I getHaloDepth();
+
+					/**
+					 * Set the number of layers of ghost cells built around the cells owned by each rank.
+					 * Deeper halos allow kernels to compute the inner ghost layers redundantly rather than
+					 * exchanging them on every step, at the cost of more ghost cells and faces.
+					 *
+					 * @param haloDepth The halo depth. Values below 1 are treated as 1.
+					 *
+					 * @return Nothing
+					 */
+					inline void setHaloDepth(I haloDepth);
+
+					/**
+					 * Get the number of times the mesh is uniformly refined after it is built
+					 *
+					 * @return The number of refinement levels
+					 */
+					inline I getRefinementLevels();
+
+					/**
+					 * Set the number of times the mesh is uniformly refined after it is built. Each level splits
+					 * every cell into 8 on the rank that owns it (see UnstructuredMeshInterface::refine), so large
+					 * meshes can be generated from a small mesh source without repartitioning. Refinement cannot be
+					 * combined with a halo depth above 1.
+					 *
+					 * @param refinementLevels The number of refinement levels. Values below 0 are treated as 0.
+					 *
+					 * @return Nothing
+					 */
+					inline void setRefinementLevels(I refinementLevels);
+
+					/**
+					 * Get the directory used to store mesh snapshots
+					 *
+					 * @return The snapshot directory. Empty if snapshots are disabled.
+					 */
+					inline std::string getSnapshotPath();
+
+					/**
+					 * Set the directory used to store mesh snapshots. Each rank stores its own part of the mesh
+					 * in a separate file, named from a hash of the mesh source, partitioner and mesh type.
+					 * The directory must already exist.
+					 *
+					 * @param snapshotPath The snapshot directory. Empty disables snapshots.
+					 *
+					 * @return Nothing
+					 */
+					inline void setSnapshotPath(std::string snapshotPath);
+
 					/**
 					 * Deep copy from source to this configuration
 					 *
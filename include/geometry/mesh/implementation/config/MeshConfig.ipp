@@ -14,6 +14,12 @@
 #define CUPCFD_CONFIG_MESH_CONFIG_IPP_H
 
 #include <iostream>
+#include <sstream>
+#include <cstring>
+#include <typeinfo>
+
+#include "SnapshotFile.h"
+#include "Reduce.h"
 
 namespace euc = cupcfd::geometry::euclidean;
 
@@ -24,12 +30,12 @@ namespace cupcfd
 		namespace mesh
 		{
 			template <class I, class T, class L>
-			inline cupcfd::partitioner::PartitionerConfig<I,I> * MeshConfig<I,T,L>::getPartitionerConfig() {
+			inline cupcfd::partitioner::PartitionerConfig<I,L> * MeshConfig<I,T,L>::getPartitionerConfig() {
 				return this->partConfig->clone();
 			}
 
 			template <class I, class T, class L>
-			inline void MeshConfig<I,T,L>::setPartitionerConfig(cupcfd::partitioner::PartitionerConfig<I,I>& partConfig) {
+			inline void MeshConfig<I,T,L>::setPartitionerConfig(cupcfd::partitioner::PartitionerConfig<I,L>& partConfig) {
 				// Cleanup old, clone new.
 				if(this->partConfig != nullptr) {
 					delete this->partConfig;
@@ -52,10 +58,54 @@ namespace cupcfd
 				this->meshSourceConfig = meshSourceConfig.clone();
 			}
 					
+			template <class I, class T, class L>
+			inline I MeshConfig<I,T,L>::getBuildChunkSize() {
+				return this->buildChunkSize;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshConfig<I,T,L>::setBuildChunkSize(I buildChunkSize) {
+				this->buildChunkSize = (buildChunkSize > 0) ? buildChunkSize : 0;
+			}
+
+			template <class I, class T, class L>
+			inline I MeshConfig<I,T,L>::getHaloDepth() {
+				return this->haloDepth;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshConfig<I,T,L>::setHaloDepth(I haloDepth) {
+				this->haloDepth = (haloDepth > 1) ? haloDepth : 1;
+			}
+
+			template <class I, class T, class L>
+			inline I MeshConfig<I,T,L>::getRefinementLevels() {
+				return this->refinementLevels;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshConfig<I,T,L>::setRefinementLevels(I refinementLevels) {
+				this->refinementLevels = (refinementLevels > 0) ? refinementLevels : 0;
+			}
+
+			template <class I, class T, class L>
+			inline std::string MeshConfig<I,T,L>::getSnapshotPath() {
+				return this->snapshotPath;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshConfig<I,T,L>::setSnapshotPath(std::string snapshotPath) {
+				this->snapshotPath = snapshotPath;
+			}
+
 			template <class I, class T, class L>
 			inline void MeshConfig<I,T,L>::operator=(const MeshConfig<I,T,L>& source) {				
 				this->setPartitionerConfig(*(source.partConfig));
 				this->setMeshSourceConfig(*(source.meshSourceConfig));
+				this->buildChunkSize = source.buildChunkSize;
+				this->haloDepth = source.haloDepth;
+				this->refinementLevels = source.refinementLevels;
+				this->snapshotPath = source.snapshotPath;
 			}
 			
 			// ToDo: Might wish to consider splitting this up and putting parts of it in MeshSource so that a
@@ -70,6 +120,54 @@ namespace cupcfd
 																			  cupcfd::comm::Communicator& comm) {
 				cupcfd::error::eCodes status;
 
+				// The refined mesh only has a single layer of ghost cells
+				if(this->refinementLevels > 0 && this->haloDepth > 1) {
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+
+				// ==========================================================
+				// (0) Restore the mesh from a snapshot, if one matches
+				// ==========================================================
+
+				uint64_t configHash = 0;
+				std::string snapshotFile;
+
+				if(!this->snapshotPath.empty()) {
+					// The snapshot must come from the same source data, partitioner, mesh type, halo depth and
+					// number of refinement levels.
+					// The rank count, rank and type sizes are checked against the snapshot keys.
+					const char * meshType = typeid(M).name();
+					uint64_t partHash;
+
+					status = this->meshSourceConfig->getSourceHash(&configHash);
+					CHECK_ECODE(status)
+					status = this->partConfig->getConfigHash(&partHash);
+					CHECK_ECODE(status)
+					configHash = cupcfd::io::SnapshotFile::hashBytes(&partHash, sizeof(partHash), configHash);
+					configHash = cupcfd::io::SnapshotFile::hashBytes(meshType, std::strlen(meshType), configHash);
+					configHash = cupcfd::io::SnapshotFile::hashBytes(&(this->haloDepth), sizeof(I), configHash);
+					configHash = cupcfd::io::SnapshotFile::hashBytes(&(this->refinementLevels), sizeof(I), configHash);
+
+					std::stringstream fileName;
+					fileName << this->snapshotPath << "/mesh_" << std::hex << configHash << std::dec << "_" << comm.rank << ".snap";
+					snapshotFile = fileName.str();
+
+					// Only use the snapshots if every rank has a valid one, otherwise all ranks rebuild
+					*mesh = new M(comm);
+					int loaded = ((*mesh)->readSnapshot(snapshotFile, configHash) == cupcfd::error::E_SUCCESS) ? 1 : 0;
+					int allLoaded;
+
+					status = cupcfd::comm::allReduceMin(&loaded, 1, &allLoaded, 1, comm);
+					CHECK_ECODE(status)
+
+					if(allLoaded == 1) {
+						return cupcfd::error::E_SUCCESS;
+					}
+
+					delete *mesh;
+					*mesh = nullptr;
+				}
+
 				// ==========================================================
 				// (1) Setup Stage: Identify which cells this process 'owns'
 				// ==========================================================
@@ -80,12 +178,12 @@ namespace cupcfd
 				CHECK_ECODE(status)
 
 				// (2) Build a naive connectivity graph
-				cupcfd::data_structures::DistributedAdjacencyList<I,I> * naiveConnGraph;
+				cupcfd::data_structures::DistributedAdjacencyList<I,L> * naiveConnGraph;
 				status = source->buildDistributedAdjacencyList(&naiveConnGraph, comm);
 				CHECK_ECODE(status)
 				
 				// (3) Use the partitioner config to build a partitioner
-				cupcfd::partitioner::PartitionerInterface<I,I> * partitioner;
+				cupcfd::partitioner::PartitionerInterface<I,L> * partitioner;
 				status = this->partConfig->buildPartitioner(&partitioner, *naiveConnGraph);
 				CHECK_ECODE(status)
 				
@@ -94,8 +192,8 @@ namespace cupcfd
 				status = partitioner->partition();
 				CHECK_ECODE(status)
 
-				// I * assignedCellLabels;
-				I * assignedCellLabels = NULL;
+				// L * assignedCellLabels;
+				L * assignedCellLabels = NULL;
 				I nAssignedCellLabels;
 
 				// ToDo: The use of comm inside the partitioner for this alongside the nparts
@@ -103,21 +201,39 @@ namespace cupcfd
 				status = partitioner->assignRankNodes(&assignedCellLabels, &nAssignedCellLabels);
 				CHECK_ECODE(status)
 
+				// The naive graph and partitioner are no longer needed, so release them before the mesh is built
+				delete naiveConnGraph;
+				delete partitioner;
+
 				// (5) Create the Mesh using the MeshSource and the assigned labels
 				// Create the Mesh Object based on the template type M
 				// This should inherit from UnstructuredMeshInterface so the type constraint is satisfied
 				*mesh = new M(comm);
-				status = (*mesh)->addData(*source, assignedCellLabels, nAssignedCellLabels);
+				status = (*mesh)->addData(*source, assignedCellLabels, nAssignedCellLabels, this->buildChunkSize, this->haloDepth);
 				CHECK_ECODE(status)
 				status = (*mesh)->finalize();
 				CHECK_ECODE(status)
 				
 				// Cleanup
-				delete naiveConnGraph;
-				delete partitioner;
 				delete source;
 				free(assignedCellLabels);
 
+				// (6) Refine the mesh in place on each rank, replacing it with the refined mesh at each level
+				for(I level = 0; level < this->refinementLevels; level++) {
+					M * refinedMesh;
+					status = (*mesh)->refine(&refinedMesh);
+					CHECK_ECODE(status)
+
+					delete *mesh;
+					*mesh = refinedMesh;
+				}
+
+				// Store a snapshot so that later runs with the same configuration can skip the build
+				if(!this->snapshotPath.empty()) {
+					status = (*mesh)->writeSnapshot(snapshotFile, configHash);
+					CHECK_ECODE(status)
+				}
+
 				return cupcfd::error::E_SUCCESS;
 			}
 		}
@@ -40,8 +40,8 @@ namespace cupcfd
 			 */
 			// ToDo: The Label type probably shouldn't be hard-coded to I here. Correct for HDF5, could
 			// be different for other formats.
-			template <class I, class T>
-			class MeshSourceFileConfig : public MeshSourceConfig<I,T,I>
+			template <class I, class T, class L>
+			class MeshSourceFileConfig : public MeshSourceConfig<I,T,L>
 			{
 				public:
 					// === Members ===
@@ -69,7 +69,7 @@ namespace cupcfd
 					 *
 					 * @param source The configuration to copy
 					 */
-					MeshSourceFileConfig(MeshSourceFileConfig<I,T>& source);
+					MeshSourceFileConfig(MeshSourceFileConfig<I,T,L>& source);
 
 					/**
 					 * Deconstructor.
@@ -115,13 +115,16 @@ namespace cupcfd
 
 					// === Overloaded Methods ===
 
-					inline void operator=(const MeshSourceFileConfig<I,T>& source);
+					inline void operator=(const MeshSourceFileConfig<I,T,L>& source);
 
 					__attribute__((warn_unused_result))
-					MeshSourceFileConfig<I,T> * clone();
+					MeshSourceFileConfig<I,T,L> * clone();
 					
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes buildMeshSource(MeshSource<I,T,I> ** source);
+					cupcfd::error::eCodes buildMeshSource(MeshSource<I,T,L> ** source);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getSourceHash(uint64_t * hash);
 			};
 		}
 	}
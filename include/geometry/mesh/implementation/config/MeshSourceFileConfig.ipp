@@ -15,8 +15,10 @@
 
 // C++ Library
 #include <fstream>
+#include <sys/stat.h>
 
 #include "MeshHDF5Source.h"
+#include "SnapshotFile.h"
 
 namespace cupcfd
 {
@@ -26,42 +28,42 @@ namespace cupcfd
 		{
 			// === Concrete Methods ===
 
-			template <class I, class T>
-			inline MeshFileFormat MeshSourceFileConfig<I,T>::getFileFormat()
+			template <class I, class T, class L>
+			inline MeshFileFormat MeshSourceFileConfig<I,T,L>::getFileFormat()
 			{
 				return this->fileFormat;
 			}
 
-			template <class I, class T>
-			inline void MeshSourceFileConfig<I,T>::setFileFormat(MeshFileFormat format)
+			template <class I, class T, class L>
+			inline void MeshSourceFileConfig<I,T,L>::setFileFormat(MeshFileFormat format)
 			{
 				this->fileFormat = format;
 			}
 
-			template <class I, class T>
-			inline std::string MeshSourceFileConfig<I,T>::getSourceFilePath()
+			template <class I, class T, class L>
+			inline std::string MeshSourceFileConfig<I,T,L>::getSourceFilePath()
 			{
 				return this->sourceFilePath;
 			}
 
-			template <class I, class T>
-			inline void MeshSourceFileConfig<I,T>::setSourceFilePath(std::string sourceFilePath)
+			template <class I, class T, class L>
+			inline void MeshSourceFileConfig<I,T,L>::setSourceFilePath(std::string sourceFilePath)
 			{
 				this->sourceFilePath = sourceFilePath;
 			}
 						
 			// === Overloaded Inherited Methods ===
 			
-			template <class I, class T>
-			inline void MeshSourceFileConfig<I,T>::operator=(const MeshSourceFileConfig<I,T>& source)
+			template <class I, class T, class L>
+			inline void MeshSourceFileConfig<I,T,L>::operator=(const MeshSourceFileConfig<I,T,L>& source)
 			{
 				// Derived Members Copy
 				this->setFileFormat(source.fileFormat);
 				this->setSourceFilePath(source.sourceFilePath);
 			}
 			
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceFileConfig<I,T>::buildMeshSource(MeshSource<I,T,I> ** source)
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceFileConfig<I,T,L>::buildMeshSource(MeshSource<I,T,L> ** source)
 			{
 				std::string filePath;
 				cupcfd::geometry::mesh::MeshFileFormat fileFormat;
@@ -87,7 +89,7 @@ namespace cupcfd
 				// via the use of the constructor (though we'll put a error catch just in case)
 				if(fileFormat == cupcfd::geometry::mesh::MESH_FILE_FORMAT_HDF5)
 				{
-					*source = new cupcfd::geometry::mesh::MeshHDF5Source<I,T>(filePath);
+					*source = new cupcfd::geometry::mesh::MeshHDF5Source<I,T,L>(filePath);
 				}
 				else
 				{
@@ -99,6 +101,28 @@ namespace cupcfd
 
 				return cupcfd::error::E_SUCCESS;
 			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceFileConfig<I,T,L>::getSourceHash(uint64_t * hash)
+			{
+				struct stat fileStat;
+
+				if(stat(this->sourceFilePath.c_str(), &fileStat) != 0)
+				{
+					return cupcfd::error::E_FILE_MISSING;
+				}
+
+				// The size and modification time of the file stand in for its contents, which would be
+				// too expensive to hash
+				uint64_t fileDetails[3] = {(uint64_t) this->fileFormat,
+										   (uint64_t) fileStat.st_size,
+										   (uint64_t) fileStat.st_mtime};
+
+				*hash = cupcfd::io::SnapshotFile::hashBytes(this->sourceFilePath.c_str(), this->sourceFilePath.size());
+				*hash = cupcfd::io::SnapshotFile::hashBytes(fileDetails, sizeof(fileDetails), *hash);
+
+				return cupcfd::error::E_SUCCESS;
+			}
 		}
 	}
 }
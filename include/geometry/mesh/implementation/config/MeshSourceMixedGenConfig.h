@@ -0,0 +1,471 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Declaration of the MeshSourceMixedGenConfig class
+ */
+
+#ifndef CUPCFD_GEOMETRY_MESH_MESH_SOURCE_MIXED_GEN_CONFIG_INCLUDE_H
+#define CUPCFD_GEOMETRY_MESH_MESH_SOURCE_MIXED_GEN_CONFIG_INCLUDE_H
+
+#include "MeshSourceConfig.h"
+
+#include <cstdint>
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			/**
+			 * Stores Mesh Configuration for generating an unstructured mesh of tetrahedra,
+			 * triangular prisms, pyramids and hexahedra from a fixed size grid of blocks.
+			 * See MeshMixedGenSource for the layout of the generated mesh.
+			 *
+			 * @tparam I The type of the indexing scheme/ cell labels
+			 * @tparam T The type of the stored array data
+			 */
+			template <class I, class T, class L>
+			class MeshSourceMixedGenConfig : public MeshSourceConfig<I,T,L>
+			{
+				public:
+					// === Members ===
+
+					/** Number of cells in the X dimension**/
+					I cellX;
+
+					/** Numbers of cells in the Y dimension **/
+					I cellY;
+
+					/** Number of cells in the Z dimension **/
+					I cellZ;
+
+					/** Minimum spatial position in the X dimension **/
+					T sMinX;
+
+					/** Maximum spatial position in the X dimension **/
+					T sMaxX;
+
+					/** Minimum spatial position in the Y dimension **/
+					T sMinY;
+
+					/** Maximum spatial position in the Y dimension **/
+					T sMaxY;
+
+					/** Minimum spatial position in the Z dimension **/
+					T sMinZ;
+
+					/** Maximum spatial position in the Z dimension **/
+					T sMaxZ;
+
+					/** Fraction of the blocks to split into tetrahedra **/
+					T tetFraction;
+
+					/** Fraction of the blocks to split into triangular prisms **/
+					T prismFraction;
+
+					/** Largest random displacement of an interior vertex, as a fraction of the block size **/
+					T jitter;
+
+					/** Whether to randomly permute the cell labels **/
+					bool shuffleCellLabels;
+
+					/** Seed of the random choices made by the generator **/
+					uint64_t seed;
+
+
+					// === Constructors/Deconstructors ===
+
+					/**
+					 * Constructor:
+					 * Initialise parameters to those provided
+					 *
+					 * @param cellX The number of cells in the X dimension.
+					 * @param cellY The number of cells in the Y dimension.
+					 * @param celLZ The number of cells in the Z dimension.
+					 * @param sMinX The minimum value in the spatial domain of the X dimension.
+					 * @param sMaxX The maximum value in the spatial domain of the X dimension.
+					 * @param sMinY The minimum value in the spatial domain of the Y dimension.
+					 * @param sMaxY The maximum value in the spatial domain of the Y dimension.
+					 * @param sMinZ The minimum value in the spatial domain of the Z dimension.
+					 * @param sMaxZ The maximum value in the spatial domain of the Z dimension.
+					 * @param tetFraction The fraction of the blocks to split into tetrahedra.
+					 * @param prismFraction The fraction of the blocks to split into triangular prisms.
+					 * @param jitter The largest random displacement of an interior vertex, as a fraction of the block size.
+					 * @param shuffleCellLabels Whether to randomly permute the cell labels.
+					 * @param seed The seed of the random choices made by the generator.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 */
+					MeshSourceMixedGenConfig(I cellX, I cellY, I cellZ,
+									    T sMinX, T sMaxX, T sMinY, T sMaxY, T sMinZ, T sMaxZ,
+									    T tetFraction, T prismFraction, T jitter, bool shuffleCellLabels, uint64_t seed);
+
+					/**
+					 * Constructor:
+					 * Copy the configuration stored in a source object to this object.
+					 *
+					 * @param source The object to copy the configuration from.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 */
+					MeshSourceMixedGenConfig(MeshSourceMixedGenConfig<I,T,L>& source);
+
+					/**
+					 * Deconstructor.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 */
+					~MeshSourceMixedGenConfig();
+
+					// === Concrete Methods ===
+
+					/**
+					 * Get the number of cells in the X dimension.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Number of cells in the X dimension.
+					 */
+					__attribute__((warn_unused_result))
+					inline I getCellX();
+
+					/**
+					 * Set the number of cells in the X dimension.
+					 *
+					 * @param cellX Number of cells in the X dimension.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setCellX(I cellX);
+
+					/**
+					 * Get the number of cells in the Y dimension.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Number of cells in the Y dimension.
+					 */
+					__attribute__((warn_unused_result))
+					inline I getCellY();
+
+					/**
+					 * Set the number of cells in the Y dimension.
+					 *
+					 * @param cellY Number of cells in the Y dimension.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setCellY(I cellY);
+
+					/**
+					 * Get the number of cells in the Z dimension.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Number of cells in the Z dimension.
+					 */
+					__attribute__((warn_unused_result))
+					inline I getCellZ();
+
+					/**
+					 * Set the number of cells in the Z dimension.
+					 *
+					 * @param cellZ Number of cells in the Z dimension.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setCellZ(I cellZ);
+
+					/**
+					 * Get the minimum spatial position in the X dimension
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Minimum spatial position in the X dimension.
+					 */
+					__attribute__((warn_unused_result))
+					inline T getSpatialMinX();
+
+					/**
+					 * Set the minimum position in the spatial domain of the X dimension.
+					 *
+					 * @param sMinX The minimum position in the X dimension.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setSpatialMinX(T sMinX);
+
+					/**
+					 * Get the minimum spatial position in the Y dimension
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Minimum spatial position in the Y dimension.
+					 */
+					__attribute__((warn_unused_result))
+					inline T getSpatialMinY();
+
+					/**
+					 * Set the minimum position in the spatial domain of the Y dimension.
+					 *
+					 * @param sMinY The minimum position in the Y dimension.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setSpatialMinY(T sMinY);
+
+					/**
+					 * Get the minimum spatial position in the Z dimension
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Minimum spatial position in the Z dimension.
+					 */
+					__attribute__((warn_unused_result))
+					inline T getSpatialMinZ();
+
+					/**
+					 * Set the minimum position in the spatial domain of the Z dimension.
+					 *
+					 * @param sMinZ The minimum position in the Z dimension.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setSpatialMinZ(T sMinZ);
+
+					/**
+					 * Get the maximum spatial position in the X dimension
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Maximum spatial position in the X dimension.
+					 */
+					__attribute__((warn_unused_result))
+					inline T getSpatialMaxX();
+
+					/**
+					 * Set the maximum position in the spatial domain of the X dimension.
+					 *
+					 * @param sMaxX The maximum position in the X dimension.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setSpatialMaxX(T sMaxX);
+
+					/**
+					 * Get the maximum spatial position in the Y dimension
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Maximum spatial position in the Y dimension.
+					 */
+					__attribute__((warn_unused_result))
+					inline T getSpatialMaxY();
+
+					/**
+					 * Set the maximum position in the spatial domain of the Y dimension.
+					 *
+					 * @param sMaxY The maximum position in the Y dimension.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setSpatialMaxY(T sMaxY);
+
+					/**
+					 * Get the maximum spatial position in the Z dimension
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Maximum spatial position in the Z dimension.
+					 */
+					__attribute__((warn_unused_result))
+					inline T getSpatialMaxZ();
+
+					/**
+					 * Set the maximum position in the spatial domain of the Z dimension.
+					 *
+					 * @param sMaxZ The maximum position in the Z dimension.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setSpatialMaxZ(T sMaxZ);
+
+					/**
+					 * Get the fraction of the blocks to split into tetrahedra.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return The fraction of the blocks to split into tetrahedra.
+					 */
+					__attribute__((warn_unused_result))
+					inline T getTetFraction();
+
+					/**
+					 * Set the fraction of the blocks to split into tetrahedra.
+					 *
+					 * @param tetFraction The fraction of the blocks to split into tetrahedra.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setTetFraction(T tetFraction);
+
+					/**
+					 * Get the fraction of the blocks to split into triangular prisms.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return The fraction of the blocks to split into triangular prisms.
+					 */
+					__attribute__((warn_unused_result))
+					inline T getPrismFraction();
+
+					/**
+					 * Set the fraction of the blocks to split into triangular prisms.
+					 *
+					 * @param prismFraction The fraction of the blocks to split into triangular prisms.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setPrismFraction(T prismFraction);
+
+					/**
+					 * Get the largest random displacement of an interior vertex, as a fraction of the block size.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return The largest random displacement of an interior vertex, as a fraction of the block size.
+					 */
+					__attribute__((warn_unused_result))
+					inline T getJitter();
+
+					/**
+					 * Set the largest random displacement of an interior vertex, as a fraction of the block size.
+					 *
+					 * @param jitter The largest random displacement of an interior vertex, as a fraction of the block size.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setJitter(T jitter);
+
+					/**
+					 * Get the setting for whether to randomly permute the cell labels.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return The setting for whether to randomly permute the cell labels.
+					 */
+					__attribute__((warn_unused_result))
+					inline bool getShuffleCellLabels();
+
+					/**
+					 * Set the setting for whether to randomly permute the cell labels.
+					 *
+					 * @param shuffleCellLabels The setting for whether to randomly permute the cell labels.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setShuffleCellLabels(bool shuffleCellLabels);
+
+					/**
+					 * Get the seed of the random choices made by the generator.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return The seed of the random choices made by the generator.
+					 */
+					__attribute__((warn_unused_result))
+					inline uint64_t getSeed();
+
+					/**
+					 * Set the seed of the random choices made by the generator.
+					 *
+					 * @param seed The seed of the random choices made by the generator.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setSeed(uint64_t seed);
+
+					// === Overloaded Methods ===
+
+					inline void operator=(const MeshSourceMixedGenConfig<I,T,L>& source);
+					MeshSourceMixedGenConfig<I,T,L> * clone();
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes buildMeshSource(MeshSource<I,T,L> ** source);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getSourceHash(uint64_t * hash);
+			};
+		} // namespace mesh
+	} // namespace geometry
+} // namespace cupcfd
+
+// Include Header Level Definitions
+#include "MeshSourceMixedGenConfig.ipp"
+
+#endif
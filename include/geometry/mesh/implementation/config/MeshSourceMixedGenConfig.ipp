@@ -0,0 +1,284 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Header-Level Definitions of the MeshSourceMixedGenConfig class
+ */
+
+#ifndef CUPCFD_GEOMETRY_MESH_MESH_SOURCE_MIXED_GEN_CONFIG_IPP_H
+#define CUPCFD_GEOMETRY_MESH_MESH_SOURCE_MIXED_GEN_CONFIG_IPP_H
+
+#include "MeshMixedGenSource.h"
+#include "SnapshotFile.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I, class T, class L>
+			inline I MeshSourceMixedGenConfig<I,T,L>::getCellX()
+			{
+				return this->cellX;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setCellX(I cellX)
+			{
+				this->cellX = cellX;
+			}
+
+			template <class I, class T, class L>
+			inline I MeshSourceMixedGenConfig<I,T,L>::getCellY()
+			{
+				return this->cellY;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setCellY(I cellY)
+			{
+				this->cellY = cellY;
+			}
+
+			template <class I, class T, class L>
+			inline I MeshSourceMixedGenConfig<I,T,L>::getCellZ()
+			{
+				return this->cellZ;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setCellZ(I cellZ)
+			{
+				this->cellZ = cellZ;
+			}
+
+			template <class I, class T, class L>
+			inline T MeshSourceMixedGenConfig<I,T,L>::getSpatialMinX()
+			{
+				return this->sMinX;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setSpatialMinX(T sMinX)
+			{
+				this->sMinX = sMinX;
+			}
+
+			template <class I, class T, class L>
+			inline T MeshSourceMixedGenConfig<I,T,L>::getSpatialMinY()
+			{
+				return this->sMinY;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setSpatialMinY(T sMinY)
+			{
+				this->sMinY = sMinY;
+			}
+
+			template <class I, class T, class L>
+			inline T MeshSourceMixedGenConfig<I,T,L>::getSpatialMinZ()
+			{
+				return this->sMinZ;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setSpatialMinZ(T sMinZ)
+			{
+				this->sMinZ = sMinZ;
+			}
+
+			template <class I, class T, class L>
+			inline T MeshSourceMixedGenConfig<I,T,L>::getSpatialMaxX()
+			{
+				return this->sMaxX;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setSpatialMaxX(T sMaxX)
+			{
+				this->sMaxX = sMaxX;
+			}
+
+			template <class I, class T, class L>
+			inline T MeshSourceMixedGenConfig<I,T,L>::getSpatialMaxY()
+			{
+				return this->sMaxY;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setSpatialMaxY(T sMaxY)
+			{
+				this->sMaxY = sMaxY;
+			}
+
+			template <class I, class T, class L>
+			inline T MeshSourceMixedGenConfig<I,T,L>::getSpatialMaxZ()
+			{
+				return this->sMaxZ;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setSpatialMaxZ(T sMaxZ)
+			{
+				this->sMaxZ = sMaxZ;
+			}
+
+			template <class I, class T, class L>
+			inline T MeshSourceMixedGenConfig<I,T,L>::getTetFraction()
+			{
+				return this->tetFraction;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setTetFraction(T tetFraction)
+			{
+				this->tetFraction = tetFraction;
+			}
+
+			template <class I, class T, class L>
+			inline T MeshSourceMixedGenConfig<I,T,L>::getPrismFraction()
+			{
+				return this->prismFraction;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setPrismFraction(T prismFraction)
+			{
+				this->prismFraction = prismFraction;
+			}
+
+			template <class I, class T, class L>
+			inline T MeshSourceMixedGenConfig<I,T,L>::getJitter()
+			{
+				return this->jitter;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setJitter(T jitter)
+			{
+				this->jitter = jitter;
+			}
+
+			template <class I, class T, class L>
+			inline bool MeshSourceMixedGenConfig<I,T,L>::getShuffleCellLabels()
+			{
+				return this->shuffleCellLabels;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setShuffleCellLabels(bool shuffleCellLabels)
+			{
+				this->shuffleCellLabels = shuffleCellLabels;
+			}
+
+			template <class I, class T, class L>
+			inline uint64_t MeshSourceMixedGenConfig<I,T,L>::getSeed()
+			{
+				return this->seed;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::setSeed(uint64_t seed)
+			{
+				this->seed = seed;
+			}
+
+			// === Overridden Inherited Methods ===
+			
+			template <class I, class T, class L>
+			inline void MeshSourceMixedGenConfig<I,T,L>::operator=(const MeshSourceMixedGenConfig<I,T,L>& source)
+			{
+				// Parent copy
+				MeshSourceConfig<I,T,L>::operator=(source);
+
+				// Derived Members Copy
+				this->cellX = source.cellX;
+				this->cellY = source.cellY;
+				this->cellZ = source.cellZ;
+				this->sMinX = source.sMinX;
+				this->sMinY = source.sMinY;
+				this->sMinZ = source.sMinZ;
+				this->sMaxX = source.sMaxX;
+				this->sMaxY = source.sMaxY;
+				this->sMaxZ = source.sMaxZ;
+				this->tetFraction = source.tetFraction;
+				this->prismFraction = source.prismFraction;
+				this->jitter = source.jitter;
+				this->shuffleCellLabels = source.shuffleCellLabels;
+				this->seed = source.seed;
+			}
+			
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfig<I,T,L>::buildMeshSource(MeshSource<I,T,L> ** source)
+			{
+				I nX, nY, nZ;
+				T sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ;
+				T tetFraction, prismFraction, jitter;
+
+				// === Read Options From Config ===
+				nX = this->getCellX();
+				nY = this->getCellY();
+				nZ = this->getCellZ();
+
+				sMinX = this->getSpatialMinX();
+				sMaxX = this->getSpatialMaxX();
+				sMinY = this->getSpatialMinY();
+				sMaxY = this->getSpatialMaxY();
+				sMinZ = this->getSpatialMinZ();
+				sMaxZ = this->getSpatialMaxZ();
+
+				tetFraction = this->getTetFraction();
+				prismFraction = this->getPrismFraction();
+				jitter = this->getJitter();
+
+				// === Check the Options are Valid ===
+				if(nX < 1 || nY < 1 || nZ < 1) {
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+
+				if(tetFraction < T(0) || prismFraction < T(0) || tetFraction + prismFraction > T(1)) {
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+
+				// Larger displacements could fold the cells next to a vertex inside out
+				if(jitter < T(0) || jitter > T(0.25)) {
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+
+				*source = new cupcfd::geometry::mesh::MeshMixedGenSource<I,T,L>(nX, nY, nZ, sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ,
+																				 tetFraction, prismFraction, jitter, this->getShuffleCellLabels(), this->getSeed());
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfig<I,T,L>::getSourceHash(uint64_t * hash)
+			{
+				// The generated mesh is entirely determined by its dimensions, bounds and random choices
+				const char sourceType[] = "MixedGen";
+				I dims[3] = {this->cellX, this->cellY, this->cellZ};
+				T bounds[6] = {this->sMinX, this->sMaxX, this->sMinY, this->sMaxY, this->sMinZ, this->sMaxZ};
+				T mix[3] = {this->tetFraction, this->prismFraction, this->jitter};
+				uint64_t random[2] = {uint64_t(this->shuffleCellLabels), this->seed};
+
+				*hash = cupcfd::io::SnapshotFile::hashBytes(sourceType, sizeof(sourceType));
+				*hash = cupcfd::io::SnapshotFile::hashBytes(dims, sizeof(dims), *hash);
+				*hash = cupcfd::io::SnapshotFile::hashBytes(bounds, sizeof(bounds), *hash);
+				*hash = cupcfd::io::SnapshotFile::hashBytes(mix, sizeof(mix), *hash);
+				*hash = cupcfd::io::SnapshotFile::hashBytes(random, sizeof(random), *hash);
+
+				return cupcfd::error::E_SUCCESS;
+			}
+			
+		} // namespace mesh
+	} // namespace geometry
+} // namespace cupcfd
+
+#endif
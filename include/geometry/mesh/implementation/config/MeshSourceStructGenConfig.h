@@ -28,8 +28,8 @@ namespace cupcfd
 			 * @tparam I The type of the indexing scheme/ cell labels
 			 * @tparam T The type of the stored array data
 			 */
-			template <class I, class T>
-			class MeshSourceStructGenConfig : public MeshSourceConfig<I,T,I>
+			template <class I, class T, class L>
+			class MeshSourceStructGenConfig : public MeshSourceConfig<I,T,L>
 			{
 				public:
 					// === Members ===
@@ -93,7 +93,7 @@ namespace cupcfd
 					 * @tparam I The type of the indexing scheme/ cell labels
 					 * @tparam T The type of the stored array data
 					 */
-					MeshSourceStructGenConfig(MeshSourceStructGenConfig<I,T>& source);
+					MeshSourceStructGenConfig(MeshSourceStructGenConfig<I,T,L>& source);
 
 					/**
 					 * Deconstructor.
@@ -314,10 +314,13 @@ namespace cupcfd
 
 					// === Overloaded Methods ===
 
-					inline void operator=(const MeshSourceStructGenConfig<I,T>& source);
-					MeshSourceStructGenConfig<I,T> * clone();
+					inline void operator=(const MeshSourceStructGenConfig<I,T,L>& source);
+					MeshSourceStructGenConfig<I,T,L> * clone();
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes buildMeshSource(MeshSource<I,T,I> ** source);
+					cupcfd::error::eCodes buildMeshSource(MeshSource<I,T,L> ** source);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getSourceHash(uint64_t * hash);
 			};
 		} // namespace mesh
 	} // namespace geometry
@@ -14,6 +14,7 @@
 #define CUPCFD_GEOMETRY_MESH_MESH_SOURCE_STRUCT_GEN_CONFIG_IPP_H
 
 #include "MeshStructGenSource.h"
+#include "SnapshotFile.h"
 
 namespace cupcfd
 {
@@ -21,121 +22,121 @@ namespace cupcfd
 	{
 		namespace mesh
 		{
-			template <class I, class T>
-			inline I MeshSourceStructGenConfig<I,T>::getCellX()
+			template <class I, class T, class L>
+			inline I MeshSourceStructGenConfig<I,T,L>::getCellX()
 			{
 				return this->cellX;
 			}
 
-			template <class I, class T>
-			inline void MeshSourceStructGenConfig<I,T>::setCellX(I cellX)
+			template <class I, class T, class L>
+			inline void MeshSourceStructGenConfig<I,T,L>::setCellX(I cellX)
 			{
 				this->cellX = cellX;
 			}
 
-			template <class I, class T>
-			inline I MeshSourceStructGenConfig<I,T>::getCellY()
+			template <class I, class T, class L>
+			inline I MeshSourceStructGenConfig<I,T,L>::getCellY()
 			{
 				return this->cellY;
 			}
 
-			template <class I, class T>
-			inline void MeshSourceStructGenConfig<I,T>::setCellY(I cellY)
+			template <class I, class T, class L>
+			inline void MeshSourceStructGenConfig<I,T,L>::setCellY(I cellY)
 			{
 				this->cellY = cellY;
 			}
 
-			template <class I, class T>
-			inline I MeshSourceStructGenConfig<I,T>::getCellZ()
+			template <class I, class T, class L>
+			inline I MeshSourceStructGenConfig<I,T,L>::getCellZ()
 			{
 				return this->cellZ;
 			}
 
-			template <class I, class T>
-			inline void MeshSourceStructGenConfig<I,T>::setCellZ(I cellZ)
+			template <class I, class T, class L>
+			inline void MeshSourceStructGenConfig<I,T,L>::setCellZ(I cellZ)
 			{
 				this->cellZ = cellZ;
 			}
 
-			template <class I, class T>
-			inline T MeshSourceStructGenConfig<I,T>::getSpatialMinX()
+			template <class I, class T, class L>
+			inline T MeshSourceStructGenConfig<I,T,L>::getSpatialMinX()
 			{
 				return this->sMinX;
 			}
 
-			template <class I, class T>
-			inline void MeshSourceStructGenConfig<I,T>::setSpatialMinX(T sMinX)
+			template <class I, class T, class L>
+			inline void MeshSourceStructGenConfig<I,T,L>::setSpatialMinX(T sMinX)
 			{
 				this->sMinX = sMinX;
 			}
 
-			template <class I, class T>
-			inline T MeshSourceStructGenConfig<I,T>::getSpatialMinY()
+			template <class I, class T, class L>
+			inline T MeshSourceStructGenConfig<I,T,L>::getSpatialMinY()
 			{
 				return this->sMinY;
 			}
 
-			template <class I, class T>
-			inline void MeshSourceStructGenConfig<I,T>::setSpatialMinY(T sMinY)
+			template <class I, class T, class L>
+			inline void MeshSourceStructGenConfig<I,T,L>::setSpatialMinY(T sMinY)
 			{
 				this->sMinY = sMinY;
 			}
 
-			template <class I, class T>
-			inline T MeshSourceStructGenConfig<I,T>::getSpatialMinZ()
+			template <class I, class T, class L>
+			inline T MeshSourceStructGenConfig<I,T,L>::getSpatialMinZ()
 			{
 				return this->sMinZ;
 			}
 
-			template <class I, class T>
-			inline void MeshSourceStructGenConfig<I,T>::setSpatialMinZ(T sMinZ)
+			template <class I, class T, class L>
+			inline void MeshSourceStructGenConfig<I,T,L>::setSpatialMinZ(T sMinZ)
 			{
 				this->sMinZ = sMinZ;
 			}
 
-			template <class I, class T>
-			inline T MeshSourceStructGenConfig<I,T>::getSpatialMaxX()
+			template <class I, class T, class L>
+			inline T MeshSourceStructGenConfig<I,T,L>::getSpatialMaxX()
 			{
 				return this->sMaxX;
 			}
 
-			template <class I, class T>
-			inline void MeshSourceStructGenConfig<I,T>::setSpatialMaxX(T sMaxX)
+			template <class I, class T, class L>
+			inline void MeshSourceStructGenConfig<I,T,L>::setSpatialMaxX(T sMaxX)
 			{
 				this->sMaxX = sMaxX;
 			}
 
-			template <class I, class T>
-			inline T MeshSourceStructGenConfig<I,T>::getSpatialMaxY()
+			template <class I, class T, class L>
+			inline T MeshSourceStructGenConfig<I,T,L>::getSpatialMaxY()
 			{
 				return this->sMaxY;
 			}
 
-			template <class I, class T>
-			inline void MeshSourceStructGenConfig<I,T>::setSpatialMaxY(T sMaxY)
+			template <class I, class T, class L>
+			inline void MeshSourceStructGenConfig<I,T,L>::setSpatialMaxY(T sMaxY)
 			{
 				this->sMaxY = sMaxY;
 			}
 
-			template <class I, class T>
-			inline T MeshSourceStructGenConfig<I,T>::getSpatialMaxZ()
+			template <class I, class T, class L>
+			inline T MeshSourceStructGenConfig<I,T,L>::getSpatialMaxZ()
 			{
 				return this->sMaxZ;
 			}
 
-			template <class I, class T>
-			inline void MeshSourceStructGenConfig<I,T>::setSpatialMaxZ(T sMaxZ)
+			template <class I, class T, class L>
+			inline void MeshSourceStructGenConfig<I,T,L>::setSpatialMaxZ(T sMaxZ)
 			{
 				this->sMaxZ = sMaxZ;
 			}
 
 			// === Overridden Inherited Methods ===
 			
-			template <class I, class T>
-			inline void MeshSourceStructGenConfig<I,T>::operator=(const MeshSourceStructGenConfig<I,T>& source)
+			template <class I, class T, class L>
+			inline void MeshSourceStructGenConfig<I,T,L>::operator=(const MeshSourceStructGenConfig<I,T,L>& source)
 			{
 				// Parent copy
-				MeshSourceConfig<I,T,I>::operator=(source);
+				MeshSourceConfig<I,T,L>::operator=(source);
 
 				// Derived Members Copy
 				this->cellX = source.cellX;
@@ -149,8 +150,8 @@ namespace cupcfd
 				this->sMaxZ = source.sMaxZ;
 			}
 			
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceStructGenConfig<I,T>::buildMeshSource(MeshSource<I,T,I> ** source)
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceStructGenConfig<I,T,L>::buildMeshSource(MeshSource<I,T,L> ** source)
 			{
 				I nX, nY, nZ;
 				T sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ;
@@ -167,7 +168,22 @@ namespace cupcfd
 				sMinZ = this->getSpatialMinZ();
 				sMaxZ = this->getSpatialMaxZ();
 
-				*source = new cupcfd::geometry::mesh::MeshStructGenSource<I,T>(nX, nY, nZ, sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ);
+				*source = new cupcfd::geometry::mesh::MeshStructGenSource<I,T,L>(nX, nY, nZ, sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ);
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceStructGenConfig<I,T,L>::getSourceHash(uint64_t * hash)
+			{
+				// The generated mesh is entirely determined by its dimensions and bounds
+				const char sourceType[] = "StructGen";
+				I dims[3] = {this->cellX, this->cellY, this->cellZ};
+				T bounds[6] = {this->sMinX, this->sMaxX, this->sMinY, this->sMaxY, this->sMinZ, this->sMaxZ};
+
+				*hash = cupcfd::io::SnapshotFile::hashBytes(sourceType, sizeof(sourceType));
+				*hash = cupcfd::io::SnapshotFile::hashBytes(dims, sizeof(dims), *hash);
+				*hash = cupcfd::io::SnapshotFile::hashBytes(bounds, sizeof(bounds), *hash);
 
 				return cupcfd::error::E_SUCCESS;
 			}
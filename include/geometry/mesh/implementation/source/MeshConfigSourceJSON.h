@@ -121,7 +121,7 @@ namespace cupcfd
 					 * Retrieve and create a dynamically allocated Partitioner Configuration
 					 */
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getPartitionerConfig(cupcfd::partitioner::PartitionerConfig<I,I> ** partConfig);
+					cupcfd::error::eCodes getPartitionerConfig(cupcfd::partitioner::PartitionerConfig<I,L> ** partConfig);
 
 					/**
 					 * Retrieve and create a dynamically allocated MeshSource Configuration
@@ -130,6 +130,60 @@ namespace cupcfd
 					// MeshSourceConfig<I,T,L> * getMeshSourceConfig();
 					cupcfd::error::eCodes getMeshSourceConfig(MeshSourceConfig<I,T,L>** config);
 
+					/**
+					 * Retrieve the number of elements to read from the mesh source per batch
+					 * when building the mesh (the optional "BuildChunkSize" field)
+					 *
+					 * @param buildChunkSize A pointer to where the chunk size will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The field was not found
+					 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The field is negative
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBuildChunkSize(I * buildChunkSize);
+
+					/**
+					 * Retrieve the number of layers of ghost cells to build around the cells of each rank
+					 * (the optional "HaloDepth" field)
+					 *
+					 * @param haloDepth A pointer to where the halo depth will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The field was not found
+					 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The field is less than 1
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getHaloDepth(I * haloDepth);
+
+					/**
+					 * Retrieve the number of times the mesh is uniformly refined after it is built
+					 * (the optional "RefinementLevels" field)
+					 *
+					 * @param refinementLevels A pointer to where the number of refinement levels will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The field was not found
+					 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The field is less than 0
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getRefinementLevels(I * refinementLevels);
+
+					/**
+					 * Retrieve the directory used to store mesh snapshots (the optional "SnapshotPath" field)
+					 *
+					 * @param snapshotPath A pointer to where the directory will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The field was not found
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getSnapshotPath(std::string * snapshotPath);
+
 					/**
 					 *
 					 */
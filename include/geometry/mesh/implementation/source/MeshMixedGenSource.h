@@ -0,0 +1,427 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the MeshMixedGenSource class
+ */
+
+#ifndef CUPCFD_GEOMETRY_MESH_MESH_MIXED_GEN_SOURCE_INCLUDE_H
+#define CUPCFD_GEOMETRY_MESH_MESH_MIXED_GEN_SOURCE_INCLUDE_H
+
+// Parent Class
+#include "MeshSource.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace euc = cupcfd::geometry::euclidean;
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			/**
+			 * The ways in which a block of the generated grid can be split into cells
+			 */
+			enum MixedGenBlockSplit
+			{
+				MIXED_GEN_SPLIT_HEXAHEDRON,
+				MIXED_GEN_SPLIT_TRIPRISM,
+				MIXED_GEN_SPLIT_CENTER
+			};
+
+			/**
+			 * This class uses the provided parameters to generate an unstructured mesh of
+			 * tetrahedra, pyramids, triangular prisms and hexahedra that fills a box.
+			 *
+			 * The box is divided into a regular grid of nX * nY * nZ blocks, as for MeshStructGenSource.
+			 * Each block is randomly chosen to be split into tetrahedra (with probability tetFraction),
+			 * into two triangular prisms (with probability prismFraction), or to be kept as a single hexahedron.
+			 * The faces of the grid are either kept as quadrilaterals or split into two triangles along the diagonal
+			 * from their lowest corner, so that the cells either side of them always match:
+			 * - A tetrahedral block splits all of its faces.
+			 * - A prism block splits the faces at its bottom and top (in the Z dimension), and is divided into two prisms
+			 *   along the same diagonal.
+			 * - A hexahedral block splits none of its faces.
+			 * A face is only split if both of the blocks either side of it split it. A tetrahedral block, or a prism block
+			 * that could not keep its split bottom or top faces, is divided into cells that each join one face of the
+			 * block to a vertex added at its center - a pyramid for a quadrilateral face, or two tetrahedra for a split face.
+			 *
+			 * The vertices can optionally be moved by a random amount of up to jitter times the block size
+			 * in each dimension (the faces of the box are kept flat), and the cell labels can optionally be shuffled,
+			 * such that the cells that are close in the mesh are no longer close in the label order and thus in
+			 * the order they are stored in a mesh.
+			 *
+			 * All random values are computed from a hash of the seed and of the position of the cell or vertex they
+			 * belong to, so every rank derives the same mesh without communication, and nothing is generated until it
+			 * is asked for. The cell indexes run through the blocks in order of X, then Y, then Z, so dividing the cell
+			 * indexes evenly between the ranks (as buildDistributedAdjacencyList does) gives each rank a slab of the box,
+			 * and each rank only generates the cells of its own slab and their neighbours.
+			 * A few bytes per block are kept on every rank to map indexes to labels.
+			 *
+			 * Labels are computed from the block a cell, face or vertex belongs to, and so are not contiguous:
+			 * - Cell label 12 * block + n for the n'th cell of a block (before shuffling)
+			 * - Face label 2 * gridFace + n for the n'th triangle (or the quadrilateral) of a grid face, where gridFace
+			 *   is the MeshStructGenSource face label, followed by 18 labels for the faces inside each block
+			 * - Vertex label as for MeshStructGenSource for the grid vertices, followed by one label per block for the
+			 *   vertices at the block centers
+			 * - The boundary label of a boundary face is its face label
+			 * Labels that are not used by the mesh are invalid.
+			 *
+			 * @tparam I The type of the indexing scheme
+			 * @tparam T The type of the mesh geometry data
+			 * @tparam L The type of the labels
+			 */
+			template <class I, class T, class L>
+			class MeshMixedGenSource : public MeshSource<I,T,L>
+			{
+				public:
+					// === Members ===
+
+					/** The number of blocks in the X dimension **/
+					I nX;
+
+					/** The number of blocks in the Y dimension **/
+					I nY;
+
+					/** The number of blocks in the Z dimension **/
+					I nZ;
+
+					/** The minimum spatial size in the X dimension **/
+					T sMinX;
+
+					/** The minimum spatial size in the Y dimension **/
+					T sMinY;
+
+					/** The minimum spatial size in the Z dimension **/
+					T sMinZ;
+
+					/** The maximum spatial size in the X dimension **/
+					T sMaxX;
+
+					/** The maximum spatial size in the Y dimension **/
+					T sMaxY;
+
+					/** The maximum spatial size in the Z dimension **/
+					T sMaxZ;
+
+					/** X Spatial Divisions **/
+					T dSx;
+
+					/** Y Spatial Divisions **/
+					T dSy;
+
+					/** Z Spatial Divisions **/
+					T dSz;
+
+					/** The probability of a block being split into tetrahedra **/
+					T tetFraction;
+
+					/** The probability of a block being split into triangular prisms **/
+					T prismFraction;
+
+					/** The largest distance a vertex is moved, as a fraction of the block size **/
+					T jitter;
+
+					/** Whether the cell labels are shuffled **/
+					bool shuffleCells;
+
+					/** The seed of the random choices **/
+					uint64_t seed;
+
+					// === Constructors/Deconstructors ===
+
+					/**
+					 * Set up the generator and choose how each block is split.
+					 *
+					 * @param nX The number of blocks in the X dimension
+					 * @param nY The number of blocks in the Y dimension
+					 * @param nZ The number of blocks in the Z dimension
+					 * @param sMinX The minimum spatial size in the X dimension
+					 * @param sMaxX The maximum spatial size in the X dimension
+					 * @param sMinY The minimum spatial size in the Y dimension
+					 * @param sMaxY The maximum spatial size in the Y dimension
+					 * @param sMinZ The minimum spatial size in the Z dimension
+					 * @param sMaxZ The maximum spatial size in the Z dimension
+					 * @param tetFraction The probability of a block being split into tetrahedra
+					 * @param prismFraction The probability of a block being split into triangular prisms.
+					 * The remaining blocks are hexahedra.
+					 * @param jitter The largest distance a vertex is moved, as a fraction of the block size.
+					 * Should be below 0.25 to keep every cell valid.
+					 * @param shuffleCells Whether to shuffle the cell labels
+					 * @param seed The seed of the random choices
+					 */
+					MeshMixedGenSource(I nX, I nY, I nZ, T sMinX, T sMaxX, T sMinY, T sMaxY, T sMinZ, T sMaxZ,
+									   T tetFraction, T prismFraction, T jitter, bool shuffleCells, uint64_t seed);
+
+					/**
+					 * Deconstructor.
+					 */
+					~MeshMixedGenSource();
+
+					// === Overloaded Inherited Virtual Methods ===
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellLabels(L * labels, I nLabels, I * indexes, I nIndexes);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceLabels(L * labels, I nLabels, I * indexes, I nIndexes);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getVertexLabels(L * labels, I nLabels, I * indexes, I nIndexes);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryLabels(L * labels, I nLabels, I * indexes, I nIndexes);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getRegionLabels(L * labels, I nLabels, I * indexes, I nIndexes);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellCount(L * cellCount);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceCount(L * faceCount);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryCount(L * boundaryCount);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getRegionCount(I * regionCount);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getVertexCount(L * vertexCount);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getMaxFaceCount(I * maxFaceCount);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getMaxVertexCount(I * maxVertexCount);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellNFaces(I * nFaces, I nNFaces, L * cellLabels, I nCellLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellVolume(T * cellVol, I nCellVol, L * cellLabels, I nCellLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellCenter(euc::EuclideanPoint<T,3> * cellCenter, I nCellCenter, L * cellLabels, I nCellLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellFaceLabels(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData, L * cellLabels, I nCellLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceIsBoundary(bool * isBoundary, I nIsBoundary, L * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceNVertices(I * nVertices, I nNVertices, L * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceBoundaryLabels(L * faceBoundaryLabels, I nFaceBoundaryLabels, L * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceCell1Labels(L * faceCell1Labels, I nFaceCell1Labels, L * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceCell2Labels(L * faceCell2Labels, I nFaceCell2Labels, L * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceLambda(T * faceLambda, I nFaceLambda, L * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceArea(T * faceArea, I nFaceArea, L * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceNormal(euc::EuclideanVector<T,3> * faceNormal, I nFaceNormal, L * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceCenter(euc::EuclideanPoint<T,3> * faceCenter, I nFaceCenter, L * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceVerticesLabelsCSR(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData,  L * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getVertexCoords(euc::EuclideanPoint<T,3> * vertCoords, I nVertCoords, L * vertexLabels, I nVertexLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryFaceLabels(L * boundaryFaceLabels, I nBoundaryFaceLabels, L * boundaryLabels, I nBoundaryLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryNVertices(I * nVertices, I nNVertices, L * boundaryLabels, I nBoundaryLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryRegionLabels(L * boundaryRegionLabels, I nBoundaryRegionLabels, L * boundaryLabels, I nBoundaryLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryVerticesLabelsCSR(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData,  L * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryDistance(T * boundaryDistance, I nBoundaryDistance, L * boundaryLabels, I nBoundaryLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getRegionName(std::string * names, I nNames, L * regionLabels, I nRegionLabels);
+
+				private:
+					// === Members ===
+
+					/** The number of grid faces normal to each dimension **/
+					I nGridFaces[3];
+
+					/** The number of grid vertices **/
+					I nGridVertices;
+
+					/** The split of each block (bits 6-7) and which of its six faces are split into triangles (bits 0-5) **/
+					std::vector<unsigned char> blockLayout;
+
+					/** The index of the first cell of each block, with the total count at the end **/
+					std::vector<I> cellOffset;
+
+					/** The index of the first face owned by each block, with the total count at the end **/
+					std::vector<I> faceOffset;
+
+					/** The index of the first boundary owned by each block, with the total count at the end **/
+					std::vector<I> boundaryOffset;
+
+					/** The index of the center vertex of each block, less the number of grid vertices **/
+					std::vector<I> centerOffset;
+
+					/** The number of bits of the block cipher used to shuffle the cell labels **/
+					int shuffleBits;
+
+					// === Concrete Methods ===
+
+					/**
+					 * Compute a 64-bit hash of the seed, a stream and a key.
+					 *
+					 * @param stream Separates the random values used for different purposes
+					 * @param key The position the random value belongs to
+					 *
+					 * @return The hash
+					 */
+					uint64_t getHash(uint64_t stream, uint64_t key);
+
+					/**
+					 * Compute a random value between 0 and 1 from the seed, a stream and a key.
+					 *
+					 * @param stream Separates the random values used for different purposes
+					 * @param key The position the random value belongs to
+					 *
+					 * @return The random value in the range [0, 1)
+					 */
+					T getRandom(uint64_t stream, uint64_t key);
+
+					/**
+					 * Map a cell slot (12 * block + n) to its label, or a label back to its slot.
+					 * Uses a small Feistel cipher that is restricted to the number of slots,
+					 * so the mapping is a permutation.
+					 *
+					 * @param slot The slot or label to map
+					 * @param inverse Map a label back to its slot
+					 *
+					 * @return The mapped value
+					 */
+					uint64_t shuffleCellSlot(uint64_t slot, bool inverse);
+
+					/**
+					 * Get the label of the n'th cell slot of a block
+					 */
+					L getCellLabel(I block, I n);
+
+					/**
+					 * Get the block and the slot in the block of a cell label
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+					 * @retval cupcfd::error::E_INVALID_INDEX The cell label is out of range
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellBlock(L label, I * block, I * n);
+
+					/**
+					 * Get the slot of the cell of a block that lies against a face of the block.
+					 *
+					 * @param block The block
+					 * @param face The face of the block (0/1: low/high X, 2/3: low/high Y, 4/5: low/high Z)
+					 * @param triangle The triangle of the face, if it is split
+					 *
+					 * @return The slot of the cell
+					 */
+					I getFaceCellSlot(I block, I face, I triangle);
+
+					/**
+					 * Get the label of a face on the surface of a block.
+					 *
+					 * @param block The block
+					 * @param face The face of the block (0/1: low/high X, 2/3: low/high Y, 4/5: low/high Z)
+					 * @param triangle The triangle of the face, if it is split
+					 *
+					 * @return The face label
+					 */
+					L getGridFaceLabel(I block, I face, I triangle);
+
+					/**
+					 * Get the corner of a block at a corner of one of its faces.
+					 * The corners of a face are ordered around the face starting from its lowest corner.
+					 *
+					 * @param face The face of the block
+					 * @param corner The corner of the face (0-3)
+					 *
+					 * @return The corner of the block (x + 2y + 4z)
+					 */
+					static int getFaceCorner(int face, int corner);
+
+					/**
+					 * Get the vertex label of a corner of a block
+					 */
+					L getCornerLabel(I block, int corner);
+
+					/**
+					 * Get the internal face of a block between its center and one of its edges.
+					 *
+					 * @param face A face of the block
+					 * @param edge The edge of the face (0-3), from corner edge to corner edge + 1
+					 *
+					 * @return The slot of the internal face (0-11)
+					 */
+					static int getEdgeSlot(int face, int edge);
+
+					/**
+					 * Get the labels of the faces of a cell
+					 *
+					 * @param cellLabel The cell label
+					 * @param faceLabels Where the face labels are stored (at least 6)
+					 * @param nFaces Where the number of faces is stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+					 * @retval cupcfd::error::E_INVALID_INDEX The cell label is not used by the mesh
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellFaces(L cellLabel, L * faceLabels, I * nFaces);
+
+					/**
+					 * Get the labels of the faces owned by a block - the faces inside it, its faces in the lower
+					 * X, Y and Z directions, and its faces in the upper directions on the surface of the box.
+					 *
+					 * @param block The block
+					 * @param faceLabels Where the face labels are stored (at least 30)
+					 * @param boundaryOnly Only include the faces on the surface of the box
+					 *
+					 * @return The number of faces
+					 */
+					I getBlockFaces(I block, L * faceLabels, bool boundaryOnly);
+
+					/**
+					 * Get the vertex labels and the cells of a face.
+					 *
+					 * @param faceLabel The face label
+					 * @param vertexLabels Where the vertex labels are stored (at least 4), in order around the face
+					 * @param nVertices Where the number of vertices is stored
+					 * @param cell1 Where the label of the first cell is stored
+					 * @param cell2 Where the label of the second cell is stored, or -1 for a boundary face
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+					 * @retval cupcfd::error::E_INVALID_INDEX The face label is not used by the mesh
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFace(L faceLabel, L * vertexLabels, I * nVertices, L * cell1, L * cell2);
+
+					/**
+					 * Get the position of a vertex.
+					 */
+					euc::EuclideanPoint<T,3> getVertexPos(L vertexLabel);
+
+					/**
+					 * Compute the area, unit normal (out of cell 1) and center of a face.
+					 * The face is split into a fan of triangles about its first vertex, as the meshes do.
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes computeFaceGeometry(L faceLabel, T * area, euc::EuclideanVector<T,3> * normal, euc::EuclideanPoint<T,3> * center);
+
+					/**
+					 * Compute the volume and center of a cell from the tetrahedra between its faces and a point inside it.
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes computeCellGeometry(L cellLabel, T * volume, euc::EuclideanPoint<T,3> * center);
+			};
+		} // namespace mesh
+	} // namespace geometry
+} // namespace cupcfd
+
+#endif
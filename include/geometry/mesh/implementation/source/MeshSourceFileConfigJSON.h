@@ -35,8 +35,8 @@ namespace cupcfd
 			/**
 			 *
 			 */
-			template <class I, class T>
-			class MeshSourceFileConfigJSON : public MeshSourceConfigSource<I,T,I>
+			template <class I, class T, class L>
+			class MeshSourceFileConfigJSON : public MeshSourceConfigSource<I,T,L>
 			{
 				public:
 					// === Members ===
@@ -76,7 +76,7 @@ namespace cupcfd
 					 * Constructor.
 					 * Copies data from source to this object.
 					 */
-					MeshSourceFileConfigJSON(MeshSourceFileConfigJSON<I,T>& source);
+					MeshSourceFileConfigJSON(MeshSourceFileConfigJSON<I,T,L>& source);
 
 					/**
 					 * Deconstructor.
@@ -98,7 +98,7 @@ namespace cupcfd
 					 *
 					 * @return Nothing.
 					 */
-					void operator=(MeshSourceFileConfigJSON<I,T>& source);
+					void operator=(MeshSourceFileConfigJSON<I,T,L>& source);
 
 					/**
 					 * Return a pointer to a clone of this object.
@@ -111,7 +111,7 @@ namespace cupcfd
 					 * @return A pointer to a cloned copy of this object.
 					 */
 					__attribute__((warn_unused_result))
-					MeshSourceFileConfigJSON<I,T> * clone();
+					MeshSourceFileConfigJSON<I,T,L> * clone();
 
 					/**
 					 *
@@ -130,7 +130,7 @@ namespace cupcfd
 					 *
 					 */
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes buildMeshSourceConfig(MeshSourceConfig<I,T,I> ** meshSourceConfig);
+					cupcfd::error::eCodes buildMeshSourceConfig(MeshSourceConfig<I,T,L> ** meshSourceConfig);
 			};
 		}
 	}
@@ -35,8 +35,8 @@ namespace cupcfd
 			/**
 			 *
 			 */
-			template <class I, class T>
-			class MeshSourceStructGenConfigJSON : public MeshSourceConfigSource<I,T,I>
+			template <class I, class T, class L>
+			class MeshSourceStructGenConfigJSON : public MeshSourceConfigSource<I,T,L>
 			{
 				public:
 					// === Members ===
@@ -62,7 +62,7 @@ namespace cupcfd
 					 * Constructor.
 					 * Copies data from source to this object.
 					 */
-					MeshSourceStructGenConfigJSON(MeshSourceStructGenConfigJSON<I,T>& source);
+					MeshSourceStructGenConfigJSON(MeshSourceStructGenConfigJSON<I,T,L>& source);
 
 					/**
 					 * Deconstructor.
@@ -84,7 +84,7 @@ namespace cupcfd
 					 *
 					 * @return Nothing.
 					 */
-					void operator=(MeshSourceStructGenConfigJSON<I,T>& source);
+					void operator=(MeshSourceStructGenConfigJSON<I,T,L>& source);
 
 					/**
 					 * Return a pointer to a clone of this object.
@@ -97,7 +97,7 @@ namespace cupcfd
 					 * @return A pointer to a cloned copy of this object.
 					 */
 					__attribute__((warn_unused_result))
-					MeshSourceStructGenConfigJSON<I,T> * clone();
+					MeshSourceStructGenConfigJSON<I,T,L> * clone();
 
 
 					__attribute__((warn_unused_result))
@@ -131,7 +131,7 @@ namespace cupcfd
 					 *
 					 */
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes buildMeshSourceConfig(MeshSourceConfig<I,T,I> ** meshSourceConfig);
+					cupcfd::error::eCodes buildMeshSourceConfig(MeshSourceConfig<I,T,L> ** meshSourceConfig);
 			};
 		}
 	}
@@ -45,10 +45,14 @@ namespace cupcfd
 			 * traversing through the x dimension, then y, then x.
 			 * The positional coordinates used for these are node center and face center respectively.
 			 *
-			 * Uses the same type as the indexing scheme for the labelling scheme.
+			 * Labels are computed from the positional coordinates and returned as type L.
+			 *
+			 * @tparam I The type of the indexing scheme
+			 * @tparam T The type of the mesh geometry data
+			 * @tparam L The type of the labels
 			 */
-			template <class I, class T>
-			class MeshStructGenSource : public MeshSource<I,T,I>
+			template <class I, class T, class L>
+			class MeshStructGenSource : public MeshSource<I,T,L>
 			{
 				public:
 					// === Members ===
@@ -178,72 +182,72 @@ namespace cupcfd
 					// === Overloaded Inherited Virtual Methods ===
 
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getCellLabels(I * labels, I nLabels, I * indexes, I nIndexes);
+					cupcfd::error::eCodes getCellLabels(L * labels, I nLabels, I * indexes, I nIndexes);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getFaceLabels(I * labels, I nLabels, I * indexes, I nIndexes);
+					cupcfd::error::eCodes getFaceLabels(L * labels, I nLabels, I * indexes, I nIndexes);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getVertexLabels(I * labels, I nLabels, I * indexes, I nIndexes);
+					cupcfd::error::eCodes getVertexLabels(L * labels, I nLabels, I * indexes, I nIndexes);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getBoundaryLabels(I * labels, I nLabels, I * indexes, I nIndexes);
+					cupcfd::error::eCodes getBoundaryLabels(L * labels, I nLabels, I * indexes, I nIndexes);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getRegionLabels(I * labels, I nLabels, I * indexes, I nIndexes);
+					cupcfd::error::eCodes getRegionLabels(L * labels, I nLabels, I * indexes, I nIndexes);
 
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getCellCount(I * cellCount);
+					cupcfd::error::eCodes getCellCount(L * cellCount);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getFaceCount(I * faceCount);
+					cupcfd::error::eCodes getFaceCount(L * faceCount);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getBoundaryCount(I * boundaryCount);
+					cupcfd::error::eCodes getBoundaryCount(L * boundaryCount);
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes getRegionCount(I * regionCount);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getVertexCount(I * vertexCount);
+					cupcfd::error::eCodes getVertexCount(L * vertexCount);
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes getMaxFaceCount(I * maxFaceCount);
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes getMaxVertexCount(I * maxVertexCount);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getCellNFaces(I * nFaces, I nNFaces, I * cellLabels, I nCellLabels);
+					cupcfd::error::eCodes getCellNFaces(I * nFaces, I nNFaces, L * cellLabels, I nCellLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getCellVolume(T * cellVol, I nCellVol, I * cellLabels, I nCellLabels);
+					cupcfd::error::eCodes getCellVolume(T * cellVol, I nCellVol, L * cellLabels, I nCellLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getCellCenter(euc::EuclideanPoint<T,3> * cellCenter, I nCellCenter, I * cellLabels, I nCellLabels);
+					cupcfd::error::eCodes getCellCenter(euc::EuclideanPoint<T,3> * cellCenter, I nCellCenter, L * cellLabels, I nCellLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getCellFaceLabels(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData, I * cellLabels, I nCellLabels);
+					cupcfd::error::eCodes getCellFaceLabels(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData, L * cellLabels, I nCellLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getFaceIsBoundary(bool * isBoundary, I nIsBoundary, I * faceLabels, I nFaceLabels);
+					cupcfd::error::eCodes getFaceIsBoundary(bool * isBoundary, I nIsBoundary, L * faceLabels, I nFaceLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getFaceNVertices(I * nVertices, I nNVertices, I * faceLabels, I nFaceLabels);
+					cupcfd::error::eCodes getFaceNVertices(I * nVertices, I nNVertices, L * faceLabels, I nFaceLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getFaceBoundaryLabels(I * faceBoundaryLabels, I nFaceBoundaryLabels, I * faceLabels, I nFaceLabels);
+					cupcfd::error::eCodes getFaceBoundaryLabels(L * faceBoundaryLabels, I nFaceBoundaryLabels, L * faceLabels, I nFaceLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getFaceCell1Labels(I * faceCell1Labels, I nFaceCell1Labels, I * faceLabels, I nFaceLabels);
+					cupcfd::error::eCodes getFaceCell1Labels(L * faceCell1Labels, I nFaceCell1Labels, L * faceLabels, I nFaceLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getFaceCell2Labels(I * faceCell2Labels, I nFaceCell2Labels, I * faceLabels, I nFaceLabels);
+					cupcfd::error::eCodes getFaceCell2Labels(L * faceCell2Labels, I nFaceCell2Labels, L * faceLabels, I nFaceLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getFaceLambda(T * faceLambda, I nFaceLambda, I * faceLabels, I nFaceLabels);
+					cupcfd::error::eCodes getFaceLambda(T * faceLambda, I nFaceLambda, L * faceLabels, I nFaceLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getFaceArea(T * faceArea, I nFaceArea, I * faceLabels, I nFaceLabels);
+					cupcfd::error::eCodes getFaceArea(T * faceArea, I nFaceArea, L * faceLabels, I nFaceLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getFaceNormal(euc::EuclideanVector<T,3> * faceNormal, I nFaceNormal, I * faceLabels, I nFaceLabels);
+					cupcfd::error::eCodes getFaceNormal(euc::EuclideanVector<T,3> * faceNormal, I nFaceNormal, L * faceLabels, I nFaceLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getFaceCenter(euc::EuclideanPoint<T,3> * faceCenter, I nFaceCenter, I * faceLabels, I nFaceLabels);
+					cupcfd::error::eCodes getFaceCenter(euc::EuclideanPoint<T,3> * faceCenter, I nFaceCenter, L * faceLabels, I nFaceLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getFaceVerticesLabelsCSR(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData,  I * faceLabels, I nFaceLabels);
+					cupcfd::error::eCodes getFaceVerticesLabelsCSR(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData,  L * faceLabels, I nFaceLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getVertexCoords(euc::EuclideanPoint<T,3> * vertCoords, I nVertCoords, I * vertexLabels, I nVertexLabels);
+					cupcfd::error::eCodes getVertexCoords(euc::EuclideanPoint<T,3> * vertCoords, I nVertCoords, L * vertexLabels, I nVertexLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getBoundaryFaceLabels(I * boundaryFaceLabels, I nBoundaryFaceLabels, I * boundaryLabels, I nBoundaryLabels);
+					cupcfd::error::eCodes getBoundaryFaceLabels(L * boundaryFaceLabels, I nBoundaryFaceLabels, L * boundaryLabels, I nBoundaryLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getBoundaryNVertices(I * nVertices, I nNVertices, I * boundaryLabels, I nBoundaryLabels);
+					cupcfd::error::eCodes getBoundaryNVertices(I * nVertices, I nNVertices, L * boundaryLabels, I nBoundaryLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getBoundaryRegionLabels(I * boundaryRegionLabels, I nBoundaryRegionLabels, I * boundaryLabels, I nBoundaryLabels);
+					cupcfd::error::eCodes getBoundaryRegionLabels(L * boundaryRegionLabels, I nBoundaryRegionLabels, L * boundaryLabels, I nBoundaryLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getBoundaryVerticesLabelsCSR(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData,  I * faceLabels, I nFaceLabels);
+					cupcfd::error::eCodes getBoundaryVerticesLabelsCSR(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData,  L * faceLabels, I nFaceLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getBoundaryDistance(T * boundaryDistance, I nBoundaryDistance, I * boundaryLabels, I nBoundaryLabels);
+					cupcfd::error::eCodes getBoundaryDistance(T * boundaryDistance, I nBoundaryDistance, L * boundaryLabels, I nBoundaryLabels);
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes getRegionName(std::string * names, I nNames, I * regionLabels, I nRegionLabels);
+					cupcfd::error::eCodes getRegionName(std::string * names, I nNames, L * regionLabels, I nRegionLabels);
 			};
 		} // namespace mesh
 	} // namespace geometry
@@ -30,11 +30,16 @@
 #define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_INTERFACE_INCLUDE_H
 
 #include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
 
 #include "Error.h"
 #include "UnstructuredMeshProperties.h"
 #include "Communicator.h"
 #include "DistributedAdjacencyList.h"
+#include "GraphColouring.h"
+#include "SnapshotFile.h"
 #include "EuclideanVector.h"
 #include "EuclideanVector3D.h"
 #include "EuclideanPoint.h"
@@ -44,6 +49,7 @@
 #include "TriPrism.h"
 #include "QuadPyramid.h"
 #include "Hexahedron.h"
+#include "GeneralPolyhedron.h"
 
 namespace euc = cupcfd::geometry::euclidean;
 namespace shapes = cupcfd::geometry::shapes;
@@ -125,14 +131,14 @@ namespace cupcfd
 					// === Members ===
 
 					/** Stores properties of the mesh, such as sizes etc **/
-					UnstructuredMeshProperties<I,T> properties;
+					UnstructuredMeshProperties<I,T,L> properties;
 
 					/**
 					 * Stores the cell->cell connectivity graph.
 					 * Edges are equivalent to faces.
 					 * Does not track boundary conditions.
 					 **/
-					cupcfd::data_structures::DistributedAdjacencyList<I, I> * cellConnGraph;
+					cupcfd::data_structures::DistributedAdjacencyList<I, L> * cellConnGraph;
 
 					/**
 					 * Track whether the mesh has been finalized (i.e. any setup comms are done)
@@ -140,6 +146,31 @@ namespace cupcfd
 					 **/
 					bool finalized;
 
+					/**
+					 * Distance-1 colouring of the locally owned cells, such that no two neighbouring
+					 * cells share a colour. Built by finalize.
+					 **/
+					cupcfd::data_structures::GraphColouring<I> cellColouring;
+
+					/**
+					 * Distance-1 colouring of the local faces, such that no two faces that adjoin the same
+					 * cell (locally owned or ghost) share a colour. Built by finalize.
+					 **/
+					cupcfd::data_structures::GraphColouring<I> faceColouring;
+
+					/**
+					 * The largest resident set size (in bytes) of this process that was observed while
+					 * the mesh was being built by addData. Sampled after each batch of data is read, so
+					 * short-lived peaks between samples may be missed. 0 if addData has not been used.
+					 **/
+					std::size_t buildPeakRSS;
+
+					/**
+					 * The time (in seconds) taken on this rank by the last call of computeFaceGeometry.
+					 * 0 if the face geometry has not been computed.
+					 **/
+					double faceGeometryTime;
+
 					// === Constructors/Deconstructors
 
 					/**
@@ -494,6 +525,34 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes addCell(L cellLabel, bool isLocal);
 
+					/**
+					 * Add a set of cells to the mesh on this rank in a single operation.
+					 *
+					 * This has the same effect as calling addCell for each cell in turn, but the storage is
+					 * sized once and the labels are checked for duplicates with a single sort. All of the cells
+					 * are checked before any are added, so on error the mesh is left unchanged.
+					 *
+					 * @param cellLabels The unique labels of the cells to add
+					 * @param centers The center of each cell
+					 * @param vols The volume of each cell
+					 * @param nCells The number of cells to add
+					 * @param isLocal Indicate whether the cells are locally owned or ghost cells
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_FINALIZED The mesh has already been finalized
+					 * @retval cupcfd::error::E_MESH_EXISTING_CELL A label is repeated or already exists in the mesh
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addCells(L * cellLabels,
+												   euc::EuclideanPoint<T,3> * centers,
+												   T * vols,
+												   I nCells,
+												   bool isLocal);
+
 					/**
 					 * Retrieve the local cell ID on this MPI rank for the given cell label.
 					 * Note: The function can be used before finalize, but the value returned
@@ -1118,6 +1177,61 @@ namespace cupcfd
 								bool isBoundary,
 								L * vertexLabels, I nVertexLabels);
 
+					/**
+					 * Add a set of faces to the mesh on this rank in a single operation.
+					 *
+					 * This has the same effect as calling addFace for each face in turn, but the storage is
+					 * sized once, the face labels and cell pairs are checked for duplicates with a single sort each,
+					 * and the labels are resolved in parallel. All of the faces are checked before any are added,
+					 * so on error the mesh is left unchanged.
+					 *
+					 * @param faceLabels The unique labels of the faces to add
+					 * @param cell1Labels The existing label of the first cell of each face
+					 * @param cell2OrBoundaryLabels The existing label of the second cell of each face, or
+					 * of its boundary if it is a boundary face
+					 * @param isBoundary Whether each face is a boundary face
+					 * @param lambda The lambda of each face
+					 * @param norm The normal of each face
+					 * @param vertexXAdj Offsets into vertexLabels for the vertices of each face (size nFaces + 1)
+					 * @param vertexLabels The existing labels of the vertices of each face, listed in order of
+					 * connecting edges as for addFace
+					 * @param center The center of each face
+					 * @param xpac The xpac value of each face. If nullptr, these are set to 0.
+					 * @param xnac The xnac value of each face. If nullptr, these are set to 0.
+					 * @param rlencos The rlencos value of each face. If nullptr, these are set to 0.
+					 * @param area The area of each face
+					 * @param nFaces The number of faces to add
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_FINALIZED The mesh has already been finalized
+					 * @retval cupcfd::error::E_MESH_EXISTING_FACE A face label is repeated or already exists in the mesh
+					 * @retval cupcfd::error::E_MESH_INVALID_CELL_LABEL A cell label does not exist
+					 * @retval cupcfd::error::E_MESH_INVALID_BOUNDARY_LABEL A boundary label does not exist
+					 * @retval cupcfd::error::E_MESH_INVALID_VERTEX_LABEL A vertex label does not exist
+					 * @retval cupcfd::error::E_MESH_INVALID_VERTEX_COUNT A face does not have 3 or 4 vertices
+					 * @retval cupcfd::error::E_MESH_INVALID_FACE A face is between two ghost cells, and the halo depth is 1
+					 * @retval cupcfd::error::E_MESH_FACE_EDGE_EXISTS Two faces are between the same pair of cells
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addFaces(
+								L * faceLabels,
+								L * cell1Labels,
+								L * cell2OrBoundaryLabels,
+								bool * isBoundary,
+								T * lambda,
+								euc::EuclideanVector3D<T> * norm,
+								I * vertexXAdj, L * vertexLabels,
+								euc::EuclideanPoint<T,3> * center,
+								euc::EuclideanPoint<T,3> * xpac,
+								euc::EuclideanPoint<T,3> * xnac,
+								T * rlencos,
+								T * area,
+								I nFaces);
+
 
 					/**
 					 * Retrieve the local face ID on this MPI rank for the given face label.
@@ -1181,6 +1295,19 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					I getBoundaryFaceID(I boundaryID);
 
+					/**
+					 * Get the number of vertices associated with a boundary
+					 *
+					 * @param boundaryID The local boundary ID in the mesh to get the value from
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return The number of vertices
+					 */
+					__attribute__((warn_unused_result))
+					I getBoundaryNVertices(I boundaryID);
+
 					/**
 					 * Get the local vertex ID in the mesh of a vertex associated with the boundary
 					 *
@@ -1614,6 +1741,41 @@ namespace cupcfd
 							L regionLabel,
 							L * vertexLabels, I nVertexLabels);
 
+					/**
+					 * Add a set of boundaries to the mesh on this rank in a single operation.
+					 *
+					 * This has the same effect as calling addBoundary for each boundary in turn, but the storage is
+					 * sized once, the labels are checked for duplicates with a single sort, and the labels are
+					 * resolved in parallel. All of the boundaries are checked before any are added, so on error the
+					 * mesh is left unchanged.
+					 *
+					 * @param boundaryLabels The unique labels of the boundaries to add
+					 * @param regionLabels The existing label of the region of each boundary
+					 * @param vertexXAdj Offsets into vertexLabels for the vertices of each boundary (size nBoundaries + 1)
+					 * @param vertexLabels The existing labels of the vertices of each boundary, listed in order of
+					 * connecting edges as for addBoundary
+					 * @param distance The distance of each boundary
+					 * @param nBoundaries The number of boundaries to add
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_FINALIZED The mesh has already been finalized
+					 * @retval cupcfd::error::E_MESH_EXISTING_BOUNDARY A label is repeated or already exists in the mesh
+					 * @retval cupcfd::error::E_MESH_INVALID_REGION_LABEL A region label does not exist
+					 * @retval cupcfd::error::E_MESH_INVALID_VERTEX_LABEL A vertex label does not exist
+					 * @retval cupcfd::error::E_MESH_INVALID_VERTEX_COUNT A boundary does not have 3 or 4 vertices
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addBoundaries(
+							L * boundaryLabels,
+							L * regionLabels,
+							I * vertexXAdj, L * vertexLabels,
+							T * distance,
+							I nBoundaries);
+
 
 					/**
 					 * Retrieve the local boundary ID on this MPI rank for the given boundary label.
@@ -2451,6 +2613,28 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes addVertex(L vertexLabel, euc::EuclideanPoint<T,3>& pos);
 
+					/**
+					 * Add a set of vertices to the mesh on this rank in a single operation.
+					 *
+					 * This has the same effect as calling addVertex for each vertex in turn, but the storage is
+					 * sized once and the labels are checked for duplicates with a single sort. All of the vertices
+					 * are checked before any are added, so on error the mesh is left unchanged.
+					 *
+					 * @param vertexLabels The unique labels of the vertices to add
+					 * @param pos The position of each vertex
+					 * @param nVertices The number of vertices to add
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_FINALIZED The mesh has already been finalized
+					 * @retval cupcfd::error::E_MESH_EXISTING_VERTEX A label is repeated or already exists in the mesh
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addVertices(L * vertexLabels, euc::EuclideanPoint<T,3> * pos, I nVertices);
+
 
 					/**
 					 * Retrieve the local vertex ID on this MPI rank for the given vertex label.
@@ -2491,17 +2675,39 @@ namespace cupcfd
 					 * Utility: Get the cell Polyhedron type.
 					 *
 					 * Used to discover which polyhedron type should be used for buildPolyhedron().
+					 * Cells with a face of more than 4 vertices, or whose vertex and face counts do not
+					 * match one of the fixed types, are identified as general polyhedra.
 					 *
 					 * Can be used for ghost cells too (since the geometry number of vertices and faces
 					 * are known) but since some of the geometry data may not be stored locally, it is
 					 * not guaranteed that ghost cells can be built into Polyhedron objects.
 					 *
+					 * If every cell on this rank has the same fixed type (see detectCellType), this is returned
+					 * directly without examining the cell.
+					 *
 					 * @param localID Cell Local ID
 					 *
 					 * @return An identifier for the Polyhedron type
 					 */
 					shapes::PolyhedronType getCellPolyhedronType(I cellID);
 
+					/**
+					 * Determine whether every cell on this rank, including the ghost cells, has the same fixed
+					 * (tetrahedron, quad pyramid, triprism or hexahedron) polyhedron type, and store the result in
+					 * properties.cellType. If not, properties.cellType is set to POLYHEDRON_UNKNOWN.
+					 *
+					 * When the type is known, every cell has the same number of faces, so the mesh implementations
+					 * store the cell->face mapping with a fixed stride instead of CSR offsets, getCellPolyhedronType
+					 * does not need to examine each cell, and findCellID runs a loop specialised for the cell type.
+					 *
+					 * This is called by finalize once the global face and vertex counts of the ghost cells are
+					 * known, and before the cell->face mapping is fixed.
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 */
+					void detectCellType();
+
 					/**
 					 * Builds a TriPrism Polyhedron object from a local cell ID.
 					 *
@@ -2637,6 +2843,32 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes buildPolyhedronV2(I cellID, shapes::Hexahedron<T> ** shape);
 
+					/**
+					 * Builds a GeneralPolyhedron object from a local cell ID, from the vertices of each of
+					 * the cell's faces. Faces may have any number of vertices.
+					 *
+					 * Unlike the fixed polyhedron types, this can be used for a cell of any type, though
+					 * the fixed types are more efficient where they apply.
+					 *
+					 * Caveats:
+					 *
+					 * (a) Can only be done for locally owned cells (we are likely missing some geometry data
+					 * for ghost cells if it doesn't connect to a local cell)
+					 *
+					 * (b) The faces are stored in the order of the cell's stored faces, with their vertices
+					 * in the stored order. The orientation of each face is not adjusted.
+					 *
+					 * @param cellID The local ID for the cell
+					 * @param shape A pointer to where the pointer for the newly created object will be stored.
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_GEOMETRY_NFACE_MISMATCH The cell has too few faces to enclose a volume
+					 * @retval cupcfd::error::E_GEOMETRY_NVERT_MISMATCH A face of the cell has less than 3 vertices
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes buildPolyhedron(I cellID, shapes::GeneralPolyhedron<T> ** shape);
+
 					/**
 					 * Sets up a mesh and populates it with data from a source of mesh data.
 					 *
@@ -2652,6 +2884,60 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes addData(MeshSource<I,T,L>& data, L * assignedCellLabels, I nAssignedCellLabels);
 
+					/**
+					 * Populates the mesh with data from a source of mesh data, reading and adding the data
+					 * in batches of at most chunkSize cells, faces, boundaries or vertices at a time.
+					 *
+					 * Only the labels of the faces, boundaries and vertices of this rank, plus a single batch
+					 * of their data, are held outside of the mesh storage at any one time, which bounds the
+					 * extra memory used during construction. The mesh that is built is the same for any
+					 * chunk size.
+					 *
+					 * The largest resident set size observed during construction is stored in buildPeakRSS.
+					 *
+					 * @param data The souce of mesh data to load into the unstructured mesh
+					 * @param assignedCellLabels The labels to load from the data source on this rank
+					 * @param nAssignedCellLabels The number of elements of type L in cellLabels
+					 * @param chunkSize The maximum number of elements to read per batch.
+					 * If this is 0 or less, each type of element is read in a single batch.
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addData(MeshSource<I,T,L>& data, L * assignedCellLabels, I nAssignedCellLabels,
+												  I chunkSize);
+
+					/**
+					 * Populates the mesh with data from a source of mesh data as above, with haloDepth layers of
+					 * ghost cells rather than one.
+					 *
+					 * The faces of the local cells and of every ghost layer except the outermost are loaded, so
+					 * the mesh includes faces between ghost cells when haloDepth is greater than 1. The ghost cells
+					 * are ordered by layer once the mesh is finalized, so a kernel can loop over the local cells and
+					 * the inner layers as a single range (see getGhostLayerRange of the cell connectivity graph).
+					 *
+					 * @param data The souce of mesh data to load into the unstructured mesh
+					 * @param assignedCellLabels The labels to load from the data source on this rank
+					 * @param nAssignedCellLabels The number of elements of type L in cellLabels
+					 * @param chunkSize The maximum number of elements to read per batch.
+					 * If this is 0 or less, each type of element is read in a single batch.
+					 * @param haloDepth The number of layers of ghost cells (at least 1)
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_INVALID_INDEX The halo depth is less than 1
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes addData(MeshSource<I,T,L>& data, L * assignedCellLabels, I nAssignedCellLabels,
+												  I chunkSize, I haloDepth);
+
 					/**
 					 * Finalize the construction of the mesh structure.
 					 * This may trigger numerous internal computations and/or restructuring, and is required before the use
@@ -2670,6 +2956,165 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes finalize();
 
+					/**
+					 * Compute the cell and face colourings of the mesh, so that loops over cells or faces that
+					 * scatter to neighbouring cells can be run in parallel one colour at a time without races.
+					 *
+					 * This is called by finalize once the cell local indexes are fixed, but may be called again
+					 * to recompute the colourings with balanced colour sizes.
+					 *
+					 * @param balance Whether to balance the number of cells/faces in each colour
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes buildColourings(bool balance);
+
+					/**
+					 * Derive the geometry of every face from the positions of its vertices and the
+					 * centres of the cells either side of it, overwriting the stored values:
+					 *
+					 * (a) Center: The area weighted centroid of the face polygon
+					 * (b) Area: The area of the face polygon
+					 * (c) Norm: The normal of the face, facing out of cell 1 and scaled by the area
+					 * (d) Xpac/Xnac: The projections of the centres of cell 1 and cell 2 onto the line through
+					 *     the face center along the normal. For boundary faces, Xnac is the face center.
+					 * (e) Lambda: The distance from Xpac to the face center as a fraction of the distance from
+					 *     Xpac to Xnac, i.e. the interpolation weight of cell 2. Boundary faces are left unchanged.
+					 * (f) RLencos: The area of the face divided by the distance from Xpac to Xnac
+					 *
+					 * The vertex and cell positions are first gathered into flat arrays so that the geometry itself is
+					 * computed by a loop of plain arithmetic over the faces, which is run in parallel. The values only
+					 * depend on the stored vertices and cell centres, so are the same for every mesh implementation.
+					 *
+					 * This is called by finalize once the cell local indexes are fixed. The time it takes is stored in
+					 * faceGeometryTime.
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_MESH_INVALID_VERTEX_COUNT A face has fewer than 3 vertices
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes computeFaceGeometry();
+
+					/**
+					 * Write the finalized mesh on this rank to a binary snapshot file, so that later runs with the
+					 * same configuration and number of ranks can restore it with readSnapshot instead of reading
+					 * the mesh source, partitioning and finalizing again.
+					 *
+					 * The snapshot contains the mesh properties, the cell connectivity graph (including the ghost
+					 * exchange lists), the cell and face colourings and the stored arrays of the mesh
+					 * implementation, each as a contiguous section. The header records a hash of the configuration
+					 * the mesh was built from, the rank and number of ranks, and the type sizes, which are all
+					 * checked by readSnapshot.
+					 *
+					 * Each rank writes its own file, and no communication takes place.
+					 *
+					 * @param fileName The path of the snapshot file for this rank
+					 * @param configHash A hash identifying the mesh source and partitioning the mesh was built with
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_UNFINALIZED The mesh is not finalized
+					 * @retval cupcfd::error::E_FILE_MISSING The file could not be created
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes writeSnapshot(std::string fileName, uint64_t configHash);
+
+					/**
+					 * Restore a mesh written by writeSnapshot into this (empty) mesh. The file is mapped into memory
+					 * and its sections copied into the mesh storage, and the mesh is finalized afterwards.
+					 *
+					 * Each rank reads its own file, and no communication takes place. If any rank fails to read its
+					 * snapshot, the caller should discard the mesh on every rank and build it again.
+					 *
+					 * @param fileName The path of the snapshot file for this rank
+					 * @param configHash The hash of the configuration the snapshot must have been built with
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_FINALIZED The mesh is already finalized
+					 * @retval cupcfd::error::E_FILE_MISSING There is no snapshot file
+					 * @retval cupcfd::error::E_INVALID_FILE_FORMAT The file is not a snapshot of this mesh type, or was
+					 * written for a different configuration, rank or number of ranks
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes readSnapshot(std::string fileName, uint64_t configHash);
+
+					/**
+					 * Build a new mesh by uniformly refining every cell of this finalized mesh. Each tetrahedron,
+					 * triangular prism and hexahedron is split into 8 children of the same type by adding a vertex
+					 * at the midpoint of each edge, at the centre of each quadrilateral face and, for hexahedra, at
+					 * the centre of the cell. Each face is split into 4.
+					 *
+					 * The children of a cell stay on the rank that owns it, so the mesh is not repartitioned. Each
+					 * rank refines its own cells, along with the faces between its cells and its ghost cells, and
+					 * the new cells are labelled from the label of their parent and the positions of its vertices,
+					 * so that ranks agree on them without further communication. The only communication is an
+					 * exchange of the vertex positions of the ghost cells, a reduction of the label ranges, and the
+					 * exchange of the new ghost cell geometry once the refined mesh is finalized. The refined mesh
+					 * has a single layer of ghost cells.
+					 *
+					 * The labels of new vertices at the midpoints of edges are only unique on the rank that creates
+					 * them, since vertices are only referenced locally.
+					 *
+					 * @param refinedMesh A pointer to where the pointer to the new, finalized mesh will be stored.
+					 * The caller takes ownership of the mesh.
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_UNFINALIZED The mesh is not finalized
+					 * @retval cupcfd::error::E_UNKNOWN_CELL_TYPE A cell on some rank is not a tetrahedron, triangular
+					 * prism or hexahedron
+					 * @retval cupcfd::error::E_INVALID_INDEX The labels of the refined mesh would not fit in type L
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes refine(M ** refinedMesh);
+
+					/**
+					 * Count the pages of the stored mesh arrays held on each NUMA node of this rank, to check
+					 * where first-touch placement has put them. Pages are located with the query form of the
+					 * move_pages system call, so no pages are moved and numactl/libnuma are not needed.
+					 *
+					 * @param nodePages The number of pages on each node, indexed by node (added to)
+					 * @param nUnplaced A pointer to a count that is increased by the number of pages that have
+					 * not been touched yet
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_ERROR Page placement cannot be queried on this system
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getPagePlacement(std::vector<std::size_t>& nodePages, std::size_t * nUnplaced);
+
+					/**
+					 * Get the heap memory used by the maps from the build IDs of the cells, faces, vertices,
+					 * boundaries and regions to their local IDs. These maps are kept after finalize, so this
+					 * is part of the resident cost of the mesh.
+					 *
+					 * @return The number of bytes used on this rank
+					 */
+					std::size_t getBuildMapMemoryBytes() const;
+
 					/**
 					 * Find the local and global cell IDs that contain the coordinates defined by point.
 					 *
@@ -2698,6 +3143,129 @@ namespace cupcfd
 					 */
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes findCellID(euc::EuclideanPoint<T,3>& point,  I * localCellID, I * globalCellID);
+
+				private:
+					/**
+					 * Test whether a point is inside a locally owned cell, building the cell as a polyhedron of
+					 * type S.
+					 *
+					 * @param cellID The local ID of the cell
+					 * @param point The point to test
+					 * @param inside A pointer to where the result will be stored
+					 *
+					 * @tparam S The polyhedron class of the cell
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_GEOMETRY_POLYHEDRON_MISMATCH The cell is not of type S
+					 */
+					template <class S>
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes isPointInsideCell(I cellID, euc::EuclideanPoint<T,3>& point, bool * inside);
+
+					/**
+					 * Find the first locally owned cell that contains a point, where every cell is known to be
+					 * of type S. This avoids determining the type of each cell in turn.
+					 *
+					 * @param point The point to find the cell for
+					 * @param localCellID A pointer to where the local ID of the cell will be stored, or -1 if none
+					 * contain the point
+					 *
+					 * @tparam S The polyhedron class of every cell
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 */
+					template <class S>
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes findCellIDOfType(euc::EuclideanPoint<T,3>& point, I * localCellID);
+
+					/**
+					 * Merge a set of labels into a sorted list of distinct labels, keeping it sorted and distinct.
+					 *
+					 * @param labels The sorted list of distinct labels to merge into
+					 * @param add The labels to merge. May be unsorted and contain repeats.
+					 * @param nAdd The number of elements of type L in add
+					 */
+					void mergeDistinctLabels(std::vector<L>& labels, L * add, I nAdd);
+
+					/**
+					 * Sample the resident set size of this process, and update buildPeakRSS if it is larger
+					 */
+					void updateBuildPeakRSS();
+
+					/**
+					 * Get the vertices of a cell in the order used by refine. For a tetrahedron these are the base
+					 * triangle followed by the apex, ordered so that the shortest diagonal of the inner octahedron
+					 * joins the midpoints of edges (0,1) and (2,3). For a prism or hexahedron these are a base face
+					 * followed by the vertex joined to each base vertex by an edge, in the same order.
+					 *
+					 * @param cellID The local ID of the cell
+					 * @param vertices The array the local vertex IDs will be stored in. Must hold 8 IDs.
+					 * @param nVertices A pointer to where the number of vertices will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_UNKNOWN_CELL_TYPE The cell is not a tetrahedron, prism or hexahedron
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getRefinementVertices(I cellID, I * vertices, I * nVertices);
+
+					/**
+					 * Get the local ID of the face of a cell that contains three given vertices.
+					 *
+					 * @param cellID The local ID of the cell
+					 * @param vertex0 The local ID of the first vertex
+					 * @param vertex1 The local ID of the second vertex
+					 * @param vertex2 The local ID of the third vertex
+					 *
+					 * @return The local ID of the face, or -1 if the cell has no such face
+					 */
+					I getRefinementCellFace(I cellID, I vertex0, I vertex1, I vertex2);
+
+					/**
+					 * Get the number of points that come before a point, ordering points by their x, then y, then z
+					 * coordinates.
+					 *
+					 * @param points The coordinates of the points, 3 per point
+					 * @param nPoints The number of points
+					 * @param point The coordinates of the point
+					 *
+					 * @return The number of points before the point
+					 */
+					static I getRefinementPointRank(const T * points, I nPoints, const T * point);
+
+					/**
+					 * Get the index (0-7) of a child of a refined cell. The index only depends on the positions of
+					 * the vertices of the cell, so every rank holding a copy of the cell derives the same index.
+					 *
+					 * @param cellPoints The coordinates of the vertices of the cell, 3 per vertex, in any order
+					 * @param nVertices The number of vertices of the cell
+					 * @param cornerPoints The coordinates of the vertices of the cell, in the order given by
+					 * getRefinementVertices
+					 * @param key The corner of the cell the child contains (>= 0), or for the inner children of
+					 * tetrahedra and prisms, -1 minus the corner the inner child is associated with
+					 *
+					 * @return The index of the child
+					 */
+					static I getRefinedChildIndex(const T * cellPoints, I nVertices, const T * cornerPoints, int key);
+
+					/**
+					 * Get the index (0-7) of the child of a refined cell that a sub-face of one of its faces belongs
+					 * to. This matches the index given by getRefinedChildIndex.
+					 *
+					 * @param cellPoints The coordinates of the vertices of the cell, 3 per vertex, in any order
+					 * @param nVertices The number of vertices of the cell
+					 * @param facePoints The coordinates of the vertices of the face, 3 per vertex, in order around
+					 * the face
+					 * @param nFaceVertices The number of vertices of the face
+					 * @param subFace The sub-face, given by the face vertex it contains, or nFaceVertices for the
+					 * central sub-face of a triangle
+					 *
+					 * @return The index of the child
+					 */
+					static I getRefinedFaceChildIndex(const T * cellPoints, I nVertices,
+													  const T * facePoints, I nFaceVertices, I subFace);
 			};
 		}
 	}
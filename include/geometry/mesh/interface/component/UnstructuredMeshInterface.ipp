@@ -30,10 +30,25 @@
 #define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_INTERFACE_IPP_H
 
 #include <vector>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <typeinfo>
+#include <cstring>
+#include <utility>
+#include "MemoryDrivers.h"
 #include "TriPrism.h"
 #include "Tetrahedron.h"
 #include "QuadPyramid.h"
 #include "Hexahedron.h"
+#include "GeneralPolyhedron.h"
+#include "CupCfdMeshFaceVertices.h"
+#include "Reduce.h"
+#include "ExchangePatternConfig.h"
+
+// Version of the layout of the mesh snapshot sections. Increment if the sections
+// written by writeSnapshot or the mesh implementations change.
+#define CUPCFD_MESH_SNAPSHOT_VERSION 4
 
 namespace euc = cupcfd::geometry::euclidean;
 namespace shapes = cupcfd::geometry::shapes;
@@ -49,10 +64,13 @@ namespace cupcfd
 			:properties()
 			{
 				// Setup an empty cell conectivity graph
-				this->cellConnGraph = new cupcfd::data_structures::DistributedAdjacencyList<I, I>(comm);
+				this->cellConnGraph = new cupcfd::data_structures::DistributedAdjacencyList<I, L>(comm);
 
 				// Initially unfinalized
 				this->finalized = false;
+
+				this->buildPeakRSS = 0;
+				this->faceGeometryTime = 0.0;
 			}
 					
 			template <class M, class I, class T, class L>
@@ -156,6 +174,15 @@ namespace cupcfd
 				return static_cast<M*>(this)->addCell(cellLabel, isLocal);
 			}
 
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::addCells(L * cellLabels,
+																			   euc::EuclideanPoint<T,3> * centers,
+																			   T * vols,
+																			   I nCells,
+																			   bool isLocal) {
+				return static_cast<M*>(this)->addCells(cellLabels, centers, vols, nCells, isLocal);
+			}
+
 			template <class M, class I, class T, class L>
 			void UnstructuredMeshInterface<M,I,T,L>::getCellID(L cellLabel, I * cellID) {
 				static_cast<M*>(this)->getCellID(cellLabel, cellID);
@@ -379,6 +406,25 @@ namespace cupcfd
 				return static_cast<M*>(this)->addFace(faceLabel, cell1Label, cell2OrBoundaryLabel, isBoundary, vertexLabels, nVertexLabels);
 			}
 
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::addFaces(
+						L * faceLabels,
+						L * cell1Labels,
+						L * cell2OrBoundaryLabels,
+						bool * isBoundary,
+						T * lambda,
+						euc::EuclideanVector3D<T> * norm,
+						I * vertexXAdj, L * vertexLabels,
+						euc::EuclideanPoint<T,3> * center,
+						euc::EuclideanPoint<T,3> * xpac,
+						euc::EuclideanPoint<T,3> * xnac,
+						T * rlencos,
+						T * area,
+						I nFaces) {
+				return static_cast<M*>(this)->addFaces(faceLabels, cell1Labels, cell2OrBoundaryLabels, isBoundary, lambda, norm,
+													   vertexXAdj, vertexLabels, center, xpac, xnac, rlencos, area, nFaces);
+			}
+
 			template <class M, class I, class T, class L>
 			void UnstructuredMeshInterface<M,I,T,L>::getFaceID(L faceLabel, I * faceID) {
 				static_cast<M*>(this)->getFaceID(faceLabel, faceID);
@@ -399,6 +445,11 @@ namespace cupcfd
 				return static_cast<M*>(this)->getBoundaryFaceID(boundaryID);
 			}
 
+			template <class M, class I, class T, class L>
+			I UnstructuredMeshInterface<M,I,T,L>::getBoundaryNVertices(I boundaryID) {
+				return static_cast<M*>(this)->getBoundaryNVertices(boundaryID);
+			}
+
 			template <class M, class I, class T, class L>
 			void UnstructuredMeshInterface<M,I,T,L>::getBoundaryVertex(I boundaryID, I boundaryVertexID, I * vertexID) {
 				static_cast<M*>(this)->getBoundaryVertex(boundaryID, boundaryVertexID, vertexID);
@@ -556,6 +607,16 @@ namespace cupcfd
 				return static_cast<M*>(this)->addBoundary(boundaryLabel, regionLabel, vertexLabels, nVertexLabels);
 			}
 
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::addBoundaries(
+					L * boundaryLabels,
+					L * regionLabels,
+					I * vertexXAdj, L * vertexLabels,
+					T * distance,
+					I nBoundaries) {
+				return static_cast<M*>(this)->addBoundaries(boundaryLabels, regionLabels, vertexXAdj, vertexLabels, distance, nBoundaries);
+			}
+
 			template <class M, class I, class T, class L>
 			void UnstructuredMeshInterface<M,I,T,L>::getBoundaryID(L boundaryLabel, I * boundaryID) {
 				static_cast<M*>(this)->getBoundaryID(boundaryLabel, boundaryID);
@@ -866,6 +927,11 @@ namespace cupcfd
 				return static_cast<M*>(this)->addVertex(vertexLabel, pos);
 			}
 
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::addVertices(L * vertexLabels, euc::EuclideanPoint<T,3> * pos, I nVertices) {
+				return static_cast<M*>(this)->addVertices(vertexLabels, pos, nVertices);
+			}
+
 			template <class M, class I, class T, class L>
 			void UnstructuredMeshInterface<M,I,T,L>::getVertexID(L vertexLabel, I * vertexID) {
 				static_cast<M*>(this)->getVertexID(vertexLabel, vertexID);
@@ -878,11 +944,60 @@ namespace cupcfd
 
 			template <class M, class I, class T, class L>
 			shapes::PolyhedronType UnstructuredMeshInterface<M,I,T,L>::getCellPolyhedronType(I cellID) {
+				// Every cell has the same type, so there is no need to examine this one
+				if(this->properties.cellType != shapes::POLYHEDRON_UNKNOWN) {
+					return this->properties.cellType;
+				}
+
 				I nVertices = this->getCellNVertices(cellID);
 				I nFaces = this->getCellNFaces(cellID);
 
+				// Find the largest face, since faces of more than 4 vertices
+				// only belong to general polyhedra
+				I maxFaceNVertices = 0;
+				for(I i = 0; i < nFaces; i++) {
+					maxFaceNVertices = std::max(maxFaceNVertices, this->getFaceNVertices(this->getCellFaceID(cellID, i)));
+				}
+
 				// Get the Cell Type
-				return shapes::findPolyhedronType(nVertices, nFaces);
+				return shapes::findPolyhedronType(nVertices, nFaces, maxFaceNVertices);
+			}
+
+			template <class M, class I, class T, class L>
+			void UnstructuredMeshInterface<M,I,T,L>::detectCellType() {
+				// Clear any previous result, so that each cell is examined
+				this->properties.cellType = shapes::POLYHEDRON_UNKNOWN;
+
+				I nOCells = this->cellConnGraph->nLONodes;
+				I nCells = nOCells + this->cellConnGraph->nLGhNodes;
+
+				if(nOCells == 0) {
+					return;
+				}
+
+				// (a) Every locally owned cell must be the same fixed type as the first
+				shapes::PolyhedronType type = this->getCellPolyhedronType(0);
+				I nFaces = (I) shapes::getPolyhedronNFaces(type);
+				I nVertices = (I) shapes::getPolyhedronNVertices(type);
+
+				if(nFaces == 0) {
+					return;
+				}
+
+				for(I i = 1; i < nOCells; i++) {
+					if(this->getCellPolyhedronType(i) != type) {
+						return;
+					}
+				}
+
+				// (b) Only some of the faces of a ghost cell are stored, so use the global face and vertex counts
+				for(I i = nOCells; i < nCells; i++) {
+					if((this->getCellNFaces(i) != nFaces) || (this->getCellNVertices(i) != nVertices)) {
+						return;
+					}
+				}
+
+				this->properties.cellType = type;
 			}
 			
 
@@ -1298,7 +1413,7 @@ namespace cupcfd
 				baseID = cellLocalFaceID[0];
 				
 				// Number of vertices including duplicates
-				const I nVertDup = 13; // (3 + 3 + 3 + 4)
+				const I nVertDup = 12; // (3 + 3 + 3 + 3)
 				
 				// Get the vertex IDs for each face
 				I faceVertexIDs[nVertDup];
@@ -1460,21 +1575,80 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 			
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::buildPolyhedron(I cellID, shapes::GeneralPolyhedron<T> ** shape) {
+				I nFaces = this->getCellNFaces(cellID);
+				if(nFaces < 4) {
+					return cupcfd::error::E_GEOMETRY_NFACE_MISMATCH;
+				}
+
+				// Gather the positions of the vertices of each face, face by face
+				std::vector<int> faceXAdj(nFaces + 1);
+				std::vector<euc::EuclideanPoint<T,3>> facePoints;
+
+				faceXAdj[0] = 0;
+				for(I i = 0; i < nFaces; i++) {
+					I faceID = this->getCellFaceID(cellID, i);
+					I faceNVertices = this->getFaceNVertices(faceID);
+
+					if(faceNVertices < 3) {
+						return cupcfd::error::E_GEOMETRY_NVERT_MISMATCH;
+					}
+
+					for(I j = 0; j < faceNVertices; j++) {
+						facePoints.push_back(this->getVertexPos(this->getFaceVertex(faceID, j)));
+					}
+
+					faceXAdj[i+1] = (int) facePoints.size();
+				}
+
+				*shape = new shapes::GeneralPolyhedron<T>(facePoints.data(), faceXAdj.data(), (int) nFaces);
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			template <class M, class I, class T, class L>
 			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::addData(MeshSource<I,T,L>& data, L * assignedCellLabels, I nAssignedCellLabels) {
+				return this->addData(data, assignedCellLabels, nAssignedCellLabels, (I) 0);
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::addData(MeshSource<I,T,L>& data, L * assignedCellLabels, I nAssignedCellLabels,
+																			  I chunkSize) {
+				return this->addData(data, assignedCellLabels, nAssignedCellLabels, chunkSize, (I) 1);
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::addData(MeshSource<I,T,L>& data, L * assignedCellLabels, I nAssignedCellLabels,
+																			  I chunkSize, I haloDepth) {
 				cupcfd::error::eCodes status;
 
+				if(haloDepth < 1) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				// Faces between ghost cells are accepted from here on if there is more than one layer
+				this->properties.haloDepth = haloDepth;
+
+				this->buildPeakRSS = 0;
+				this->updateBuildPeakRSS();
+
+				// The data of the cells, faces, boundaries and vertices is read from the source and added to the mesh
+				// in batches of at most chunk elements, so that only one batch of it is held outside of the mesh at a time.
+				// Only the labels are gathered in full.
+				I chunk = (chunkSize > 0) ? chunkSize : std::numeric_limits<I>::max();
+
 				// =================================
 				// (1)  Data Label Stage
 				// =================================
 				
 				// (a) Build a new connectivity graph using the allocated cells so we are
 				// aware of the edges and ghost cells that are also needed
-				cupcfd::data_structures::DistributedAdjacencyList<I,I> * partGraph;
+				cupcfd::data_structures::DistributedAdjacencyList<I,L> * partGraph;
 				
 				// Reuse the same communicator as the distributed graph, since all members of the comm associated with this
 				// mesh must participate
-				status = data.buildDistributedAdjacencyList(&partGraph, *(this->cellConnGraph->comm), assignedCellLabels, nAssignedCellLabels);
+				status = data.buildDistributedAdjacencyList(&partGraph, *(this->cellConnGraph->comm), assignedCellLabels, nAssignedCellLabels, haloDepth);
 				CHECK_ECODE(status)
 
 				//(b) Get the labels of local + ghost cells for this rank
@@ -1484,133 +1658,148 @@ namespace cupcfd
 					
 				if(lCells > 0) {
 					// (c) Get the labels from the partition graph
-					I * cellLabels = (I *) malloc(sizeof(I) * nCells);
-					status = partGraph->getLocalNodes(cellLabels, lCells);
-					CHECK_ECODE(status)
-					status = partGraph->getGhostNodes(cellLabels + lCells, ghCells);
-					CHECK_ECODE(status)
-
-					// (d) Get the labels of all faces associated with only *local* cells - faces that are between local-> ghost will be caught in this.
-
-					// (di) Get number of faces per cell
-					I nCellFacesSum;
-					I * nCellFaces = (I *) malloc(sizeof(I) * lCells);
-					status = data.getCellNFaces(nCellFaces, lCells, cellLabels, lCells);
-					CHECK_ECODE(status)
-
-					// (dii) Summed number of faces per cell - needed for CSR sizes
-					cupcfd::utility::drivers::sum(nCellFaces, lCells, &nCellFacesSum);
-
-					// d(iii) Get Face Labels for each Cell in CSR Format - this will omit the non-existant faces when the faces per cell is below max faces
-					I * cellFaceLabelInd = (I *) malloc(sizeof(I) * (lCells+1));
-					I * cellFaceLabelData = (I *) malloc(sizeof(I) * nCellFacesSum);
-					status = data.getCellFaceLabels(cellFaceLabelInd, lCells+1, cellFaceLabelData, nCellFacesSum, cellLabels, lCells);
+					std::vector<L> cellLabels(nCells);
+					status = partGraph->getLocalNodes(cellLabels.data(), lCells);
 					CHECK_ECODE(status)
-
-					// (div) Remove duplicate face labels from where cells share faces
-					// This leaves a single label per each face that is attached to a local cell
-					I * faceLabelsDistinct;
-					I nFaceLabelsDistinct;
-					status = cupcfd::utility::drivers::distinctArray(cellFaceLabelData, nCellFacesSum, &faceLabelsDistinct, &nFaceLabelsDistinct);
-					CHECK_ECODE(status)
-
-					// (e) Get the labels of any boundaries associated with these faces
-					// (ei) Reduce down to only faces that are boundaries
-					bool * faceLabelIsBoundary = (bool *) malloc(sizeof(bool) * nFaceLabelsDistinct);
-					status = data.getFaceIsBoundary(faceLabelIsBoundary, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
+					status = partGraph->getGhostNodes(cellLabels.data() + lCells, ghCells);
 					CHECK_ECODE(status)
 
-					int nFaceBoundaries = 0;
-					for(int i = 0; i < nFaceLabelsDistinct; i++) {
-						if(faceLabelIsBoundary[i] == true) {
-							nFaceBoundaries++;
+					// With more than one ghost layer, take the ghost cells in the order of the partition graph instead,
+					// which groups them by layer
+					if(partGraph->nGhostLayers > 1) {
+						for(I i = 0; i < ghCells; i++) {
+							cellLabels[lCells + i] = partGraph->connGraph.IDXToNode[lCells + i];
 						}
 					}
-					
-					I * faceWithBoundary = (I *) malloc(sizeof(I) * nFaceBoundaries);
 
-					I nFaceWithoutBoundary = nFaceLabelsDistinct - nFaceBoundaries;
-					I * faceWithoutBoundary = (I *) malloc(sizeof(I) * nFaceWithoutBoundary);
+					// The faces of the local cells, and of the ghost cells short of the outermost layer are needed.
+					// These are the first nFaceCells cells.
+					I nFaceCells = partGraph->ghostLayerXAdj[std::min(haloDepth - 1, partGraph->nGhostLayers)];
+
+					// The partition graph is no longer needed
+					delete partGraph;
+					this->updateBuildPeakRSS();
+
+					// Per batch read buffers, reused between batches
+					std::vector<I> nEleCount;
+					std::vector<I> eleCSRInd;
+					std::vector<L> eleCSRData;
+					std::vector<L> batchLabels;
+					std::vector<L> batchLabels2;
+
+					// (d) Get the distinct labels of all faces associated with only *local* cells - faces that are between
+					// local-> ghost will be caught in this. Cells that share a face will both list it, so repeats are removed.
+					// With a deeper halo, the faces of the inner ghost layers are included as well.
+					std::vector<L> faceLabels;
+
+					for(I start = 0; start < nFaceCells;) {
+						I n = std::min(chunk, nFaceCells - start);
+
+						// (di) Get number of faces per cell, summed to get the CSR size
+						I nCellFacesSum;
+						nEleCount.resize(n);
+						status = data.getCellNFaces(nEleCount.data(), n, cellLabels.data() + start, n);
+						CHECK_ECODE(status)
+						cupcfd::utility::drivers::sum(nEleCount.data(), n, &nCellFacesSum);
+
+						// (dii) Get Face Labels for each Cell in CSR Format - this will omit the non-existant faces when the
+						// faces per cell is below max faces
+						eleCSRInd.resize(n + 1);
+						eleCSRData.resize(nCellFacesSum);
+						status = data.getCellFaceLabels(eleCSRInd.data(), n + 1, eleCSRData.data(), nCellFacesSum,
+														cellLabels.data() + start, n);
+						CHECK_ECODE(status)
 
-					I ptr = 0;
-					I ptr2 = 0;
-					for(int i = 0; i < nFaceLabelsDistinct; i++) {
-						if(faceLabelIsBoundary[i] == true) {
-							faceWithBoundary[ptr] = faceLabelsDistinct[i];
-							ptr++;
-						}
-						else {
-							faceWithoutBoundary[ptr2] = faceLabelsDistinct[i];
-							ptr2++;
-						}
+						this->mergeDistinctLabels(faceLabels, eleCSRData.data(), nCellFacesSum);
+						this->updateBuildPeakRSS();
+						start = start + n;
 					}
-					
-					// (eii) Get the boundary labels for these faces
-					I nBoundaryLabels = nFaceBoundaries;
-					I * boundaryLabels = (I *) malloc(sizeof(I) * nBoundaryLabels);
-					status = data.getFaceBoundaryLabels(boundaryLabels, nBoundaryLabels, faceWithBoundary, nFaceBoundaries);
-					CHECK_ECODE(status)
 
-					// (eiii) Boundary faces should be unique, but as a precaution remove repeats
-					I * boundaryLabelsDistinct;
-					I nBoundaryLabelsDistinct;
-					status = cupcfd::utility::drivers::distinctArray(boundaryLabels, nBoundaryLabels, &boundaryLabelsDistinct, &nBoundaryLabelsDistinct);
-					CHECK_ECODE(status)
+					I nFaces = (I) faceLabels.size();
+					I faceBatch = std::min(chunk, nFaces);
+					bool * fIsBoundary = (bool *) malloc(sizeof(bool) * faceBatch);
 
-					// (f) Get the distinct labels of any vertexes associated with the retrieved faces and boundaries
+					// (e) Get the distinct labels of any boundaries and vertexes associated with these faces
+					std::vector<L> boundaryLabels;
+					std::vector<L> vertexLabels;
+					std::vector<L> faceWithBoundary;
+					std::vector<L> faceWithoutBoundary;
 
-					// (fi) Get the number of vertices per face and sum to get the CSR size
-					I * faceVerticesCount = (I *) malloc(sizeof(I) * nFaceLabelsDistinct);
+					for(I start = 0; start < nFaces;) {
+						I n = std::min(chunk, nFaces - start);
+						L * labels = faceLabels.data() + start;
 
-					status = data.getFaceNVertices(faceVerticesCount, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+						// (ei) Reduce down to only faces that are boundaries
+						status = data.getFaceIsBoundary(fIsBoundary, n, labels, n);
+						CHECK_ECODE(status)
 
-					I faceVerticesCountTotal;
-					cupcfd::utility::drivers::sum(faceVerticesCount, nFaceLabelsDistinct, &faceVerticesCountTotal);
+						faceWithBoundary.clear();
+						for(I i = 0; i < n; i++) {
+							if(fIsBoundary[i]) {
+								faceWithBoundary.push_back(labels[i]);
+							}
+						}
 
-					// (fii) Get the number of vertices per boundary and sum to get the CSR size
-					I * boundaryVerticesCount = (I *) malloc(sizeof(I) * nBoundaryLabelsDistinct);
+						// (eii) Get the boundary labels for these faces.
+						// Boundary faces should be unique, but as a precaution remove repeats
+						I nFaceBoundaries = (I) faceWithBoundary.size();
+						if(nFaceBoundaries > 0) {
+							batchLabels.resize(nFaceBoundaries);
+							status = data.getFaceBoundaryLabels(batchLabels.data(), nFaceBoundaries, faceWithBoundary.data(), nFaceBoundaries);
+							CHECK_ECODE(status)
+							this->mergeDistinctLabels(boundaryLabels, batchLabels.data(), nFaceBoundaries);
+						}
 
-					status = data.getFaceNVertices(boundaryVerticesCount, nBoundaryLabelsDistinct, boundaryLabelsDistinct, nBoundaryLabelsDistinct);
-					CHECK_ECODE(status)
+						// (eiii) Get the vertex labels of the faces
+						I nVerticesSum;
+						nEleCount.resize(n);
+						status = data.getFaceNVertices(nEleCount.data(), n, labels, n);
+						CHECK_ECODE(status)
+						cupcfd::utility::drivers::sum(nEleCount.data(), n, &nVerticesSum);
 
-					I boundaryVerticesCountTotal;
-					cupcfd::utility::drivers::sum(boundaryVerticesCount, nBoundaryLabelsDistinct, &boundaryVerticesCountTotal);
+						eleCSRInd.resize(n + 1);
+						eleCSRData.resize(nVerticesSum);
+						status = data.getFaceVerticesLabelsCSR(eleCSRInd.data(), n + 1, eleCSRData.data(), nVerticesSum, labels, n);
+						CHECK_ECODE(status)
 
-					// (fiii) Get the vertex labels for the face and boundary lists - CSR format.
-					// Store the vertices labels in a combined array for both.
+						this->mergeDistinctLabels(vertexLabels, eleCSRData.data(), nVerticesSum);
+						this->updateBuildPeakRSS();
+						start = start + n;
+					}
 
-					I * vertLabelData = (I *) malloc(sizeof(I) * (faceVerticesCountTotal + boundaryVerticesCountTotal));
+					// (f) Add the distinct labels of any vertexes associated with the boundaries
+					I nBoundaries = (I) boundaryLabels.size();
 
-					I * faceVertLabelCSRInd = (I *) malloc(sizeof(I) * (nFaceLabelsDistinct+1));
+					for(I start = 0; start < nBoundaries;) {
+						I n = std::min(chunk, nBoundaries - start);
+						L * labels = boundaryLabels.data() + start;
 
-					status = data.getFaceVerticesLabelsCSR(faceVertLabelCSRInd, nFaceLabelsDistinct+1,
-															  vertLabelData, faceVerticesCountTotal,
-															  faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+						I nVerticesSum;
+						nEleCount.resize(n);
+						status = data.getFaceNVertices(nEleCount.data(), n, labels, n);
+						CHECK_ECODE(status)
+						cupcfd::utility::drivers::sum(nEleCount.data(), n, &nVerticesSum);
 
-					I * bndVertLabelCSRInd = (I *) malloc(sizeof(I) * (nBoundaryLabelsDistinct+1));
+						eleCSRInd.resize(n + 1);
+						eleCSRData.resize(nVerticesSum);
+						status = data.getFaceVerticesLabelsCSR(eleCSRInd.data(), n + 1, eleCSRData.data(), nVerticesSum, labels, n);
+						CHECK_ECODE(status)
 
-					status = data.getFaceVerticesLabelsCSR(bndVertLabelCSRInd, nBoundaryLabelsDistinct+1,
-															  vertLabelData + faceVerticesCountTotal, boundaryVerticesCountTotal,
-															  boundaryLabelsDistinct, nBoundaryLabelsDistinct);
-					CHECK_ECODE(status)
+						this->mergeDistinctLabels(vertexLabels, eleCSRData.data(), nVerticesSum);
+						this->updateBuildPeakRSS();
+						start = start + n;
+					}
 
-					// (fiv) Get distinct vertex labels
-					I * vertexLabelsDistinct;
-					I nVertexLabelsDistinct;
-					status = cupcfd::utility::drivers::distinctArray(vertLabelData, faceVerticesCountTotal + boundaryVerticesCountTotal,
-																	&vertexLabelsDistinct, &nVertexLabelsDistinct);
-					CHECK_ECODE(status)
+					I nVertices = (I) vertexLabels.size();
 
-					// (f) Get the labels of any regions associated with the boundaries
+					// (g) Get the labels of any regions associated with the boundaries
 					//  Since we're loading all regions, just make an label list of 0->regionCount-1 since we'll just read all since
 					// their numbers are typically far far fewer
 					I nRegions;
 					status = data.getRegionCount(&nRegions);
 					CHECK_ECODE(status)
 					I * regionIndices = (I *) malloc(sizeof(I) * nRegions);
-					I * regionLabels = (I *) malloc(sizeof(I) * nRegions);
+					L * regionLabels = (L *) malloc(sizeof(L) * nRegions);
 
 					for(I i = 0; i < nRegions; i++) {
 						regionIndices[i] = i;
@@ -1627,23 +1816,29 @@ namespace cupcfd
 					// Order should be in that of least dependancy - i.e.:
 					// (i) Vertices
 					// (ii) Regions
-					// (iii) Cells
-					// (iv) Boundaries (Need vertices)
+					// (iii) Boundaries (Need vertices)
+					// (iv) Cells
 					// (v) Faces (Needs vertices, cells, boundaries)
 
+					std::vector<euc::EuclideanPoint<T,3>> batchPoints;
+					std::vector<T> batchScalars;
+
 					// === Read Vertices Data ===
-					//Final Vertices Labels are stored in vertexLabelsDistinct
-					euc::EuclideanPoint<T,3> * pointTmpStore = (euc::EuclideanPoint<T,3> *) malloc(sizeof(euc::EuclideanPoint<T,3>) * nVertexLabelsDistinct);
-					status = data.getVertexCoords(pointTmpStore, nVertexLabelsDistinct, vertexLabelsDistinct, nVertexLabelsDistinct);
-					CHECK_ECODE(status)
+					for(I start = 0; start < nVertices;) {
+						I n = std::min(chunk, nVertices - start);
+						L * labels = vertexLabels.data() + start;
 
-					// Add Vertices to Mesh
-					for(I i = 0; i < nVertexLabelsDistinct; i++) {
-						status = this->addVertex(vertexLabelsDistinct[i], pointTmpStore[i]);
+						batchPoints.resize(n);
+						status = data.getVertexCoords(batchPoints.data(), n, labels, n);
+						CHECK_ECODE(status)
+
+						// Add Vertices to Mesh
+						status = this->addVertices(labels, batchPoints.data(), n);
 						CHECK_ECODE(status)
-					}
 
-					free(pointTmpStore);
+						this->updateBuildPeakRSS();
+						start = start + n;
+					}
 
 					// === Read Region Data ===
 					// ToDo: Read Region Names - Needs fixing of reading strings from HDF5
@@ -1655,184 +1850,184 @@ namespace cupcfd
 						status = this->addRegion(regionLabels[i], name);
 						CHECK_ECODE(status)
 					}
+
+					free(regionLabels);
 					
 					// === Read Boundary Data ===
-					// Final labels in boundaryLabelsDistinct
-
-					// Region Labels
-					I nBoundaryRegionLabels = nBoundaryLabelsDistinct;
-					I * boundaryRegionLabels = (I *) malloc(sizeof(I) * nBoundaryRegionLabels);
-					status = data.getBoundaryRegionLabels(boundaryRegionLabels, nBoundaryRegionLabels, boundaryLabelsDistinct, nBoundaryLabelsDistinct);
-					CHECK_ECODE(status)
+					for(I start = 0; start < nBoundaries;) {
+						I n = std::min(chunk, nBoundaries - start);
+						L * labels = boundaryLabels.data() + start;
 
-					// Vertices Labels
-					// Can reuse previous read starting at vertLabelData[faceVerticesCountTotal]
+						// Region Labels
+						batchLabels.resize(n);
+						status = data.getBoundaryRegionLabels(batchLabels.data(), n, labels, n);
+						CHECK_ECODE(status)
 
-					// Boundary Distance
-					T * bDistance = (T *) malloc(sizeof(T) * nBoundaryLabelsDistinct);
-					status = data.getBoundaryDistance(bDistance, nBoundaryLabelsDistinct, boundaryLabelsDistinct, nBoundaryLabelsDistinct);
-					CHECK_ECODE(status)
+						// Boundary Distance
+						batchScalars.resize(n);
+						status = data.getBoundaryDistance(batchScalars.data(), n, labels, n);
+						CHECK_ECODE(status)
 
-					// Add Boundaries to Mesh
-					for(I i = 0; i < nBoundaryLabelsDistinct; i++) {
-						I bLabel = boundaryLabelsDistinct[i];
-						I rLabel = boundaryRegionLabels[i];
+						// Vertices Labels
+						I nVerticesSum;
+						nEleCount.resize(n);
+						status = data.getFaceNVertices(nEleCount.data(), n, labels, n);
+						CHECK_ECODE(status)
+						cupcfd::utility::drivers::sum(nEleCount.data(), n, &nVerticesSum);
 
-						I vertDataPtr = faceVerticesCountTotal + bndVertLabelCSRInd[i];
-						I rangeSize = bndVertLabelCSRInd[i+1] - bndVertLabelCSRInd[i];
+						eleCSRInd.resize(n + 1);
+						eleCSRData.resize(nVerticesSum);
+						status = data.getFaceVerticesLabelsCSR(eleCSRInd.data(), n + 1, eleCSRData.data(), nVerticesSum, labels, n);
+						CHECK_ECODE(status)
 
-						status = this->addBoundary(bLabel, rLabel, vertLabelData + vertDataPtr, rangeSize, bDistance[i]);
+						// Add Boundaries to Mesh
+						status = this->addBoundaries(labels, batchLabels.data(), eleCSRInd.data(), eleCSRData.data(),
+													 batchScalars.data(), n);
 						CHECK_ECODE(status)
-					}
 
-					free(bDistance);
+						this->updateBuildPeakRSS();
+						start = start + n;
+					}
 					
 					// === Read Cell Data ===
 					// Read Cell Data for local *and* ghost cells
-					// Final labels in cellLabels: Segmented into [local|Ghost cells] for 0->lCells-1 and lCells->lCells+ghCells-1
-					pointTmpStore = (euc::EuclideanPoint<T,3> *) malloc(sizeof(euc::EuclideanPoint<T,3>) * nCells);
-					T * cellVol = (T *) malloc(sizeof(T) * nCells);
-
-					// Read Cell Center
-					status = data.getCellCenter(pointTmpStore, nCells, cellLabels, nCells);
-					CHECK_ECODE(status)
-
-					// Read Cell Volume
-					status = data.getCellVolume(cellVol, nCells, cellLabels, nCells);
-					CHECK_ECODE(status)
+					// Labels in cellLabels: Segmented into [local|Ghost cells] for 0->lCells-1 and lCells->lCells+ghCells-1
+					// Batches do not cross from the local to the ghost cells.
+					for(I start = 0; start < nCells;) {
+						bool isLocal = start < lCells;
+						I n = std::min(chunk, (isLocal ? lCells : nCells) - start);
+						L * labels = cellLabels.data() + start;
+
+						// Read Cell Center
+						batchPoints.resize(n);
+						status = data.getCellCenter(batchPoints.data(), n, labels, n);
+						CHECK_ECODE(status)
 
-					// Add Cells to Mesh
-					// Local Cells
-					for(I i = 0; i < lCells; i++) {
-						status = this->addCell(cellLabels[i], pointTmpStore[i], cellVol[i], true);
+						// Read Cell Volume
+						batchScalars.resize(n);
+						status = data.getCellVolume(batchScalars.data(), n, labels, n);
 						CHECK_ECODE(status)
-					}
 
-					// Ghost Cells
-					for(I i = lCells; i < (lCells + ghCells); i++) {
-						status = this->addCell(cellLabels[i], pointTmpStore[i], cellVol[i], false);
+						// Add Cells to Mesh
+						status = this->addCells(labels, batchPoints.data(), batchScalars.data(), n, isLocal);
 						CHECK_ECODE(status)
-					}
 
-					free(pointTmpStore);
-					free(cellVol);
+						this->updateBuildPeakRSS();
+						start = start + n;
+					}
 
 					// === Read Face Data ===
-					// Final Face Labels in faceLabelsDistinct
-
-					// Cell 1 Labels
-					// For boundary and non-boundary faces
-					I * fCell1Labels = (I *) malloc(sizeof(I) * nFaceLabelsDistinct);
-					status = data.getFaceCell1Labels(fCell1Labels, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
-
-					// Cell 2 Labels
-					// For non-boundary faces only
-					I * fCell2Labels = (I *) malloc(sizeof(I) * nFaceWithoutBoundary);
-					status = data.getFaceCell2Labels(fCell2Labels, nFaceWithoutBoundary, faceWithoutBoundary, nFaceWithoutBoundary);
-					CHECK_ECODE(status)
-
-					// Vertex Labels
-					// Reuse previously read values
-
-					// Boundary Labels
-					// Boundary faces only
-					I * fBndLabels = (I *) malloc(sizeof(I) * nFaceBoundaries);
-					status = data.getFaceBoundaryLabels(fBndLabels, nFaceBoundaries, faceWithBoundary, nFaceBoundaries);
-					CHECK_ECODE(status)
-
-					// Is Boundary
-					bool * fIsBoundary = (bool *) malloc(sizeof(bool) * nFaceLabelsDistinct);
-					status = data.getFaceIsBoundary(fIsBoundary, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+					L * fCell1Labels = (L *) malloc(sizeof(L) * faceBatch);
+					L * fCell2OrBoundLabels = (L *) malloc(sizeof(L) * faceBatch);
+					T * fLambda = (T *) malloc(sizeof(T) * faceBatch);
+					T * fArea = (T *) malloc(sizeof(T) * faceBatch);
+					euc::EuclideanVector3D<T> * fNorm = (euc::EuclideanVector3D<T> *) malloc(sizeof(euc::EuclideanVector3D<T>) * faceBatch);
+
+					for(I start = 0; start < nFaces;) {
+						I n = std::min(chunk, nFaces - start);
+						L * labels = faceLabels.data() + start;
+
+						// Cell 1 Labels
+						// For boundary and non-boundary faces
+						status = data.getFaceCell1Labels(fCell1Labels, n, labels, n);
+						CHECK_ECODE(status)
 
-					// Face Lambda
-					T * fLambda = (T *) malloc(sizeof(T) * nFaceLabelsDistinct);
-					status = data.getFaceLambda(fLambda, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+						// Is Boundary
+						status = data.getFaceIsBoundary(fIsBoundary, n, labels, n);
+						CHECK_ECODE(status)
 
-					// Face Area
-					T * fArea = (T *) malloc(sizeof(T) * nFaceLabelsDistinct);
-					status = data.getFaceArea(fArea, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+						// Split the labels into boundary and non-boundary faces
+						faceWithBoundary.clear();
+						faceWithoutBoundary.clear();
+						for(I i = 0; i < n; i++) {
+							if(fIsBoundary[i]) {
+								faceWithBoundary.push_back(labels[i]);
+							}
+							else {
+								faceWithoutBoundary.push_back(labels[i]);
+							}
+						}
 
-					// Face Center
-					euc::EuclideanPoint<T,3> * fCenter = (euc::EuclideanPoint<T,3> *) malloc(sizeof(euc::EuclideanPoint<T,3>) * nFaceLabelsDistinct);
-					status = data.getFaceCenter(fCenter, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+						// Boundary Labels
+						// Boundary faces only
+						I nFaceBoundaries = (I) faceWithBoundary.size();
+						batchLabels.resize(nFaceBoundaries);
+						if(nFaceBoundaries > 0) {
+							status = data.getFaceBoundaryLabels(batchLabels.data(), nFaceBoundaries, faceWithBoundary.data(), nFaceBoundaries);
+							CHECK_ECODE(status)
+						}
 
-					// Face Normal
-					euc::EuclideanVector3D<T> * fNorm = (euc::EuclideanVector3D<T> *) malloc(sizeof(euc::EuclideanVector3D<T>) * nFaceLabelsDistinct);
-					status = data.getFaceNormal(fNorm, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+						// Cell 2 Labels
+						// For non-boundary faces only
+						I nFaceWithoutBoundary = (I) faceWithoutBoundary.size();
+						batchLabels2.resize(nFaceWithoutBoundary);
+						if(nFaceWithoutBoundary > 0) {
+							status = data.getFaceCell2Labels(batchLabels2.data(), nFaceWithoutBoundary, faceWithoutBoundary.data(), nFaceWithoutBoundary);
+							CHECK_ECODE(status)
+						}
 
-					// Add Face Data
-					ptr = 0;
-					ptr2 = 0;
-					for(I i = 0; i < nFaceLabelsDistinct; i++) {
-						euc::EuclideanPoint<T,3> xpac(T(0), T(0), T(0));
-						euc::EuclideanPoint<T,3> xnac(T(0), T(0), T(0));
-						T rlencos = 0.0;
+						// Merge the cell 2 and boundary labels into a single label per face
+						I ptr = 0;
+						I ptr2 = 0;
+						for(I i = 0; i < n; i++) {
+							if(fIsBoundary[i]) {
+								fCell2OrBoundLabels[i] = batchLabels[ptr];
+								ptr++;
+							}
+							else {
+								fCell2OrBoundLabels[i] = batchLabels2[ptr2];
+								ptr2++;
+							}
+						}
 
-						// Vertex Index Pointer into VertLabelData
-						I vertDataPtr = faceVertLabelCSRInd[i];
+						// Face Lambda
+						status = data.getFaceLambda(fLambda, n, labels, n);
+						CHECK_ECODE(status)
 
-						// Number of vertices
-						I rangeSize = faceVertLabelCSRInd[i+1] - faceVertLabelCSRInd[i];
+						// Face Area
+						status = data.getFaceArea(fArea, n, labels, n);
+						CHECK_ECODE(status)
 
-						I fCell2OrBoundLabel;
+						// Face Center
+						batchPoints.resize(n);
+						status = data.getFaceCenter(batchPoints.data(), n, labels, n);
+						CHECK_ECODE(status)
 
-						if(fIsBoundary[i]) {
-							// Sanity check to make sure we're on the right label
-							if(faceWithBoundary[ptr] != faceLabelsDistinct[i]) {
-								return cupcfd::error::E_ERROR;
-							}
+						// Face Normal
+						status = data.getFaceNormal(fNorm, n, labels, n);
+						CHECK_ECODE(status)
 
-							fCell2OrBoundLabel = fBndLabels[ptr];
-							ptr++;
-						}
-						else {
-							// Sanity check to make sure we're on the right label
-							if(faceWithoutBoundary[ptr2] != faceLabelsDistinct[i]) {
-								return cupcfd::error::E_ERROR;
-							}
+						// Vertex Labels
+						I nVerticesSum;
+						nEleCount.resize(n);
+						status = data.getFaceNVertices(nEleCount.data(), n, labels, n);
+						CHECK_ECODE(status)
+						cupcfd::utility::drivers::sum(nEleCount.data(), n, &nVerticesSum);
 
-							fCell2OrBoundLabel = fCell2Labels[ptr2];
-							ptr2++;
-						}
+						eleCSRInd.resize(n + 1);
+						eleCSRData.resize(nVerticesSum);
+						status = data.getFaceVerticesLabelsCSR(eleCSRInd.data(), n + 1, eleCSRData.data(), nVerticesSum, labels, n);
+						CHECK_ECODE(status)
 
-						status = this->addFace(faceLabelsDistinct[i], fCell1Labels[i], fCell2OrBoundLabel, fIsBoundary[i], fLambda[i], fNorm[i],
-												  vertLabelData + vertDataPtr, rangeSize, fCenter[i], xpac, xnac, rlencos, fArea[i]);
+						// Add Face Data
+						// xpac, xnac and rlencos are not read, so are left as 0
+						status = this->addFaces(labels, fCell1Labels, fCell2OrBoundLabels, fIsBoundary, fLambda, fNorm,
+												eleCSRInd.data(), eleCSRData.data(), batchPoints.data(), nullptr, nullptr, nullptr, fArea, n);
 						CHECK_ECODE(status)
+
+						this->updateBuildPeakRSS();
+						start = start + n;
 					}
 
 					// =================================
 					// Cleanup
 					// =================================
 
-					free(cellLabels);
-					free(boundaryLabels);
-					free(regionLabels);
-
-					free(cellFaceLabelInd);
-					free(cellFaceLabelData);
-					free(faceVertLabelCSRInd);
-					free(bndVertLabelCSRInd);
-					free(vertLabelData);
-
-					free(boundaryLabelsDistinct);
-					free(vertexLabelsDistinct);
-					free(faceLabelsDistinct);
-					free(faceWithBoundary);
-					free(faceWithoutBoundary);
-
-					free(fCell1Labels);
-					free(fCell2Labels);
-					free(fBndLabels);
 					free(fIsBoundary);
+					free(fCell1Labels);
+					free(fCell2OrBoundLabels);
 					free(fLambda);
 					free(fArea);
-					free(fCenter);
 					free(fNorm);
 					
 					return cupcfd::error::E_SUCCESS;
@@ -1841,17 +2036,8 @@ namespace cupcfd
 				// =================================
 				// (3)  Finalisation
 				// =================================
-				// Some Mesh structures will need the finalisation stage to ensure that some properties are correct.
-				// E.g. Data is stored for mappings from face->other, but we may also need cell->face etc, so these will
-				// be computed as part of the finalisation stage.
-				// It is also the case that some data may be insufficient - e.g. ghost cells only store faces that adjoin
-				// locally owned cells so we may need to retrieve data from the process that owns it locally to find out how many
-				// faces, vertices etc it has. Additionally, if a mesh file format does not contain certain data, such as volumes,
-				// areas etc, we will need to compute it here to ensure the mesh properties are correct, and then also ensure that
-				// data is also propagated to any ghost cells that are unable to compute it locally (e.g. due to insufficient face data)
-
-				status = this->finalize();
-				CHECK_ECODE(status)
+				// A rank that owns no cells has no data to add. As with ranks that do own cells, finalisation is left
+				// to the caller, since it is collective across the mesh communicator and every rank must enter it together.
 
 				// Cleanup any temporary structures/space outside of the mesh
 				delete partGraph;
@@ -1859,101 +2045,1558 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 			
+			template <class M, class I, class T, class L>
+			void UnstructuredMeshInterface<M,I,T,L>::mergeDistinctLabels(std::vector<L>& labels, L * add, I nAdd) {
+				std::size_t nOld = labels.size();
+
+				labels.insert(labels.end(), add, add + nAdd);
+				std::sort(labels.begin() + nOld, labels.end());
+				std::inplace_merge(labels.begin(), labels.begin() + nOld, labels.end());
+				labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+			}
+
+			template <class M, class I, class T, class L>
+			void UnstructuredMeshInterface<M,I,T,L>::updateBuildPeakRSS() {
+				this->buildPeakRSS = std::max(this->buildPeakRSS, cupcfd::utility::drivers::getCurrentRSS());
+			}
+
 			template <class M, class I, class T, class L>
 			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::finalize() {
 				return static_cast<M*>(this)->finalize();
 			}
-			
+
 			template <class M, class I, class T, class L>
-			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::findCellID(euc::EuclideanPoint<T,3>& point, 
-																					  I * localCellID,
-																					  I * globalCellID) {
-				// Loop over and test each locally owned cell until we find the cell the point is located in (if any on this rank)
-				// For each cell:
-				// (a) Get the number of vertices and faces each cell has
-				// (b) Determine the type of cell
-				// (c) Test whether the position of the source is inside the cell
-				// (ci) If so, updated the local and global cell IDs
-				// (cii) If not, continue until no cells left to test
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::getPagePlacement(std::vector<std::size_t>& nodePages, std::size_t * nUnplaced) {
+				return static_cast<M*>(this)->getPagePlacement(nodePages, nUnplaced);
+			}
+
+			template <class M, class I, class T, class L>
+			std::size_t UnstructuredMeshInterface<M,I,T,L>::getBuildMapMemoryBytes() const {
+				return static_cast<const M*>(this)->getBuildMapMemoryBytes();
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::buildColourings(bool balance) {
 				cupcfd::error::eCodes status;
-	
-				// Part (a)
-				I nCells = this->properties.lOCells;
-	
-				// Mesh should be sorted into local, then global cells so loop over the initial range for local cells
-				for(I i = 0; i < nCells; i++) {
-					// Part (b)
-					// Get the number of vertices
-					I nVertices = this->getCellNVertices(i);
-	
-					// Get the number of faces
-					I nFaces = this->getCellNFaces(i);
-	
-					// Get the Cell Type
-					shapes::PolyhedronType pType = shapes::findPolyhedronType(nVertices, nFaces);
-	
-					bool inside;
-					
-					if(pType == shapes::POLYHEDRON_TETRAHEDRON) {
-						shapes::Tetrahedron<T> * shape1;
-						status = this->buildPolyhedron(i, &shape1);
-						CHECK_ECODE(status)
-						inside = shape1->isPointInside(point);
-						delete shape1;
+
+				// Cells: The locally owned cells occupy the first local indexes of the connectivity graph,
+				// and the ghost cells that follow are ignored as out of range
+				status = this->cellColouring.colourGraph(this->cellConnGraph->connGraph.xadj.data(),
+														 this->cellConnGraph->connGraph.adjncy.data(),
+														 this->properties.lOCells, (I) 0, (I) 1, balance);
+				CHECK_ECODE(status)
+
+				// Faces: Each face adjoins cell1, and cell2 if it is not a boundary face
+				I nFaces = this->properties.lFaces;
+				std::vector<I> faceXAdj(nFaces + 1, 0);
+				std::vector<I> faceCells;
+				faceCells.reserve(2 * nFaces);
+
+				for(I i = 0; i < nFaces; i++) {
+					faceCells.push_back(this->getFaceCell1ID(i));
+
+					if(!this->getFaceIsBoundary(i)) {
+						faceCells.push_back(this->getFaceCell2ID(i));
 					}
-					else if(pType == shapes::POLYHEDRON_QUADPYRAMID) {
-						shapes::QuadPyramid<T> * shape2;
-						status = this->buildPolyhedron(i, &shape2);
-						CHECK_ECODE(status)
-						inside = shape2->isPointInside(point);
-						delete shape2;
+
+					faceXAdj[i + 1] = (I) faceCells.size();
+				}
+
+				status = this->faceColouring.colourIncidence(faceXAdj.data(), faceCells.data(), nFaces,
+															 this->properties.lTCells, (I) 0, (I) 1, balance);
+				CHECK_ECODE(status)
+
+				return cupcfd::error::E_SUCCESS;
+			}
+			
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::computeFaceGeometry() {
+				double tStart = MPI_Wtime();
+
+				I nFaces = this->properties.lFaces;
+
+				// (1) Offsets of the vertices of each face in the gathered arrays
+				std::vector<I> xadj(nFaces + 1);
+				xadj[0] = 0;
+
+				for(I i = 0; i < nFaces; i++) {
+					I nVertices = this->getFaceNVertices(i);
+
+					if(nVertices < 3) {
+						return cupcfd::error::E_MESH_INVALID_VERTEX_COUNT;
 					}
-					else if(pType == shapes::POLYHEDRON_TRIPRISM) {
-						shapes::TriPrism<T> * shape3;
-						status = this->buildPolyhedron(i, &shape3);
-						CHECK_ECODE(status)
-						inside = shape3->isPointInside(point);
-						delete shape3;
+
+					xadj[i + 1] = xadj[i] + nVertices;
+				}
+
+				// (2) Gather the vertex positions of each face, and the centres of the cells either side of it,
+				// into flat arrays
+				std::vector<T> vx(xadj[nFaces]), vy(xadj[nFaces]), vz(xadj[nFaces]);
+				std::vector<T> p(3 * nFaces);
+				std::vector<T> n(3 * nFaces);
+				std::vector<char> boundary(nFaces);
+
+				#pragma omp parallel for
+				for(I i = 0; i < nFaces; i++) {
+					for(I j = xadj[i]; j < xadj[i + 1]; j++) {
+						euc::EuclideanPoint<T,3> pos = this->getVertexPos(this->getFaceVertex(i, j - xadj[i]));
+						vx[j] = pos.cmp[0];
+						vy[j] = pos.cmp[1];
+						vz[j] = pos.cmp[2];
 					}
-					else if(pType == shapes::POLYHEDRON_HEXAHEDRON) {
-						shapes::Hexahedron<T> * shape4;
-						status = this->buildPolyhedron(i, &shape4);
-						CHECK_ECODE(status)
-						inside = shape4->isPointInside(point);						
-						delete shape4;
+
+					euc::EuclideanPoint<T,3> center = this->getCellCenter(this->getFaceCell1ID(i));
+					p[3*i] = center.cmp[0];
+					p[3*i + 1] = center.cmp[1];
+					p[3*i + 2] = center.cmp[2];
+
+					boundary[i] = this->getFaceIsBoundary(i);
+
+					if(!boundary[i]) {
+						center = this->getCellCenter(this->getFaceCell2ID(i));
+					}
+
+					n[3*i] = center.cmp[0];
+					n[3*i + 1] = center.cmp[1];
+					n[3*i + 2] = center.cmp[2];
+				}
+
+				// (3) Compute the face geometry. Each face is split into a fan of triangles about its first vertex.
+				std::vector<T> area(nFaces);
+				std::vector<T> lambda(nFaces);
+				std::vector<T> rlencos(nFaces);
+				std::vector<T> norm(3 * nFaces);
+				std::vector<T> center(3 * nFaces);
+				std::vector<T> xpac(3 * nFaces);
+				std::vector<T> xnac(3 * nFaces);
+
+				#pragma omp parallel for
+				for(I i = 0; i < nFaces; i++) {
+					I j0 = xadj[i];
+					I j1 = xadj[i + 1];
+
+					// Sum of the (twice) vector areas of the triangles
+					T sx = T(0);
+					T sy = T(0);
+					T sz = T(0);
+
+					for(I j = j0 + 1; j < j1 - 1; j++) {
+						T ax = vx[j] - vx[j0];
+						T ay = vy[j] - vy[j0];
+						T az = vz[j] - vz[j0];
+						T bx = vx[j + 1] - vx[j0];
+						T by = vy[j + 1] - vy[j0];
+						T bz = vz[j + 1] - vz[j0];
+
+						sx += ay * bz - az * by;
+						sy += az * bx - ax * bz;
+						sz += ax * by - ay * bx;
 					}
-					else if(pType == shapes::POLYHEDRON_UNKNOWN) {
-						return cupcfd::error::E_ERROR;
+
+					// Centroid - the triangle centroids are weighted by their area in the plane of the face,
+					// which is also correct for non-convex faces
+					T cx = T(0);
+					T cy = T(0);
+					T cz = T(0);
+					T weight = T(0);
+
+					for(I j = j0 + 1; j < j1 - 1; j++) {
+						T ax = vx[j] - vx[j0];
+						T ay = vy[j] - vy[j0];
+						T az = vz[j] - vz[j0];
+						T bx = vx[j + 1] - vx[j0];
+						T by = vy[j + 1] - vy[j0];
+						T bz = vz[j + 1] - vz[j0];
+
+						T w = (ay * bz - az * by) * sx + (az * bx - ax * bz) * sy + (ax * by - ay * bx) * sz;
+
+						cx += w * (ax + bx);
+						cy += w * (ay + by);
+						cz += w * (az + bz);
+						weight += w;
+					}
+
+					if(weight > T(0)) {
+						cx = vx[j0] + cx / (T(3) * weight);
+						cy = vy[j0] + cy / (T(3) * weight);
+						cz = vz[j0] + cz / (T(3) * weight);
 					}
 					else {
-						return cupcfd::error::E_ERROR;
+						cx = vx[j0];
+						cy = vy[j0];
+						cz = vz[j0];
 					}
-		
-					// (c) Test whether the position point is inside the cell - stored in 'inside'
-					// (ci) If so, update cell ID and stop
-					if(inside) {
-						// Local ID is just position in loop
-						*localCellID = i;
-	
-						// Need to retrieve global ID from the connectivity graph
-						// Get the Node for the localID
-						L node;
-						status = this->cellConnGraph->connGraph.getLocalIndexNode(i, &node);
-						CHECK_ECODE(status)
-						*globalCellID = this->cellConnGraph->nodeToGlobal[node];
-	
-						// Exit Loop by exiting function
-						return cupcfd::error::E_SUCCESS;
+
+					T a = T(0.5) * std::sqrt(sx * sx + sy * sy + sz * sz);
+
+					// Orient the normal out of cell 1
+					T scale = T(0.5);
+					if((sx * (cx - p[3*i]) + sy * (cy - p[3*i + 1]) + sz * (cz - p[3*i + 2])) < T(0)) {
+						scale = T(-0.5);
+					}
+
+					T nx = scale * sx;
+					T ny = scale * sy;
+					T nz = scale * sz;
+
+					// Unit normal
+					T ux = T(0);
+					T uy = T(0);
+					T uz = T(0);
+
+					if(a > T(0)) {
+						ux = nx / a;
+						uy = ny / a;
+						uz = nz / a;
+					}
+
+					// For boundary faces the cell 2 centre is the face centre
+					if(boundary[i]) {
+						n[3*i] = cx;
+						n[3*i + 1] = cy;
+						n[3*i + 2] = cz;
 					}
-	
-					// (cii) If not, let loops continue
+
+					// Signed distances along the normal from the face centre to the cell centres
+					T dP = (p[3*i] - cx) * ux + (p[3*i + 1] - cy) * uy + (p[3*i + 2] - cz) * uz;
+					T dN = (n[3*i] - cx) * ux + (n[3*i + 1] - cy) * uy + (n[3*i + 2] - cz) * uz;
+					T d = dN - dP;
+
+					area[i] = a;
+					norm[3*i] = nx;
+					norm[3*i + 1] = ny;
+					norm[3*i + 2] = nz;
+					center[3*i] = cx;
+					center[3*i + 1] = cy;
+					center[3*i + 2] = cz;
+					xpac[3*i] = cx + dP * ux;
+					xpac[3*i + 1] = cy + dP * uy;
+					xpac[3*i + 2] = cz + dP * uz;
+					xnac[3*i] = cx + dN * ux;
+					xnac[3*i + 1] = cy + dN * uy;
+					xnac[3*i + 2] = cz + dN * uz;
+					lambda[i] = (d > T(0)) ? -dP / d : T(0.5);
+					rlencos[i] = (d > T(0)) ? a / d : T(0);
 				}
-	
-				// ToDo: Corner cases (point on edge, point on vertex)
-	
-				// No suitable cell was found in the loop
-				return cupcfd::error::E_GEOMETRY_NO_VALID_CELL;
-				
+
+				// (4) Store the results
+				#pragma omp parallel for
+				for(I i = 0; i < nFaces; i++) {
+					euc::EuclideanVector3D<T> faceNorm(norm[3*i], norm[3*i + 1], norm[3*i + 2]);
+					euc::EuclideanPoint<T,3> faceCenter(center[3*i], center[3*i + 1], center[3*i + 2]);
+					euc::EuclideanPoint<T,3> faceXpac(xpac[3*i], xpac[3*i + 1], xpac[3*i + 2]);
+					euc::EuclideanPoint<T,3> faceXnac(xnac[3*i], xnac[3*i + 1], xnac[3*i + 2]);
+
+					this->setFaceArea(i, area[i]);
+					this->setFaceNorm(i, faceNorm);
+					this->setFaceCenter(i, faceCenter);
+					this->setFaceXpac(i, faceXpac);
+					this->setFaceXnac(i, faceXnac);
+					this->setFaceRLencos(i, rlencos[i]);
+
+					if(!boundary[i]) {
+						this->setFaceLambda(i, lambda[i]);
+					}
+				}
+
+				this->faceGeometryTime = MPI_Wtime() - tStart;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::writeSnapshot(std::string fileName, uint64_t configHash) {
+				cupcfd::error::eCodes status;
+
+				if(!this->finalized) {
+					return cupcfd::error::E_UNFINALIZED;
+				}
+
+				cupcfd::io::SnapshotFile file;
+				status = file.openWrite(fileName);
+				CHECK_ECODE(status)
+
+				L globalProps[5] = {this->properties.nCells, this->properties.nFaces, this->properties.nVertices,
+									this->properties.nBoundaries, this->properties.nRegions};
+
+				I props[10] = {this->properties.nMaxFaces,
+							   this->properties.lOCells, this->properties.lGhCells, this->properties.lTCells,
+							   this->properties.lFaces, this->properties.lVertices, this->properties.lBoundaries,
+							   this->properties.lRegions, this->properties.haloDepth, (I) this->properties.cellType};
+
+				status = file.writeArray(globalProps, 5);
+				CHECK_ECODE(status)
+				status = file.writeArray(props, 10);
+				CHECK_ECODE(status)
+				status = file.writeArray(&(this->properties.scaleFactor), 1);
+				CHECK_ECODE(status)
+
+				status = this->cellConnGraph->writeSnapshot(file);
+				CHECK_ECODE(status)
+				status = this->cellColouring.writeSnapshot(file);
+				CHECK_ECODE(status)
+				status = this->faceColouring.writeSnapshot(file);
+				CHECK_ECODE(status)
+
+				status = static_cast<M*>(this)->writeSnapshotData(file);
+				CHECK_ECODE(status)
+
+				// The mesh type name identifies the layout of the implementation's sections
+				const char * meshType = typeid(M).name();
+
+				file.keys[0] = configHash;
+				file.keys[1] = (uint64_t) this->cellConnGraph->comm->rank;
+				file.keys[2] = (uint64_t) this->cellConnGraph->comm->size;
+				file.keys[3] = ((uint64_t) sizeof(I)) | (((uint64_t) sizeof(T)) << 8) | (((uint64_t) sizeof(L)) << 16) |
+							   (((uint64_t) CUPCFD_MESH_FIXED_FACE_VERTICES) << 24);
+				file.keys[4] = cupcfd::io::SnapshotFile::hashBytes(meshType, std::strlen(meshType));
+				file.keys[5] = CUPCFD_MESH_SNAPSHOT_VERSION;
+
+				status = file.closeWrite();
+				CHECK_ECODE(status)
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::readSnapshot(std::string fileName, uint64_t configHash) {
+				cupcfd::error::eCodes status;
+
+				if(this->finalized) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				// A missing or mismatched snapshot is expected (e.g. on the first run), so it is returned
+				// to the caller rather than treated as an error
+				cupcfd::io::SnapshotFile file;
+				status = file.openRead(fileName);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				const char * meshType = typeid(M).name();
+
+				if((file.keys[0] != configHash) ||
+				   (file.keys[1] != (uint64_t) this->cellConnGraph->comm->rank) ||
+				   (file.keys[2] != (uint64_t) this->cellConnGraph->comm->size) ||
+				   (file.keys[3] != (((uint64_t) sizeof(I)) | (((uint64_t) sizeof(T)) << 8) | (((uint64_t) sizeof(L)) << 16) |
+								   (((uint64_t) CUPCFD_MESH_FIXED_FACE_VERTICES) << 24))) ||
+				   (file.keys[4] != cupcfd::io::SnapshotFile::hashBytes(meshType, std::strlen(meshType))) ||
+				   (file.keys[5] != CUPCFD_MESH_SNAPSHOT_VERSION)) {
+					return cupcfd::error::E_INVALID_FILE_FORMAT;
+				}
+
+				L globalProps[5];
+				status = file.readArray(globalProps, 5);
+				CHECK_ECODE(status)
+
+				I props[10];
+				status = file.readArray(props, 10);
+				CHECK_ECODE(status)
+				status = file.readArray(&(this->properties.scaleFactor), 1);
+				CHECK_ECODE(status)
+
+				this->properties.nCells = globalProps[0];
+				this->properties.nFaces = globalProps[1];
+				this->properties.nVertices = globalProps[2];
+				this->properties.nBoundaries = globalProps[3];
+				this->properties.nRegions = globalProps[4];
+				this->properties.nMaxFaces = props[0];
+				this->properties.lOCells = props[1];
+				this->properties.lGhCells = props[2];
+				this->properties.lTCells = props[3];
+				this->properties.lFaces = props[4];
+				this->properties.lVertices = props[5];
+				this->properties.lBoundaries = props[6];
+				this->properties.lRegions = props[7];
+				this->properties.haloDepth = props[8];
+				this->properties.cellType = (shapes::PolyhedronType) props[9];
+
+				status = this->cellConnGraph->readSnapshot(file);
+				CHECK_ECODE(status)
+				status = this->cellColouring.readSnapshot(file);
+				CHECK_ECODE(status)
+				status = this->faceColouring.readSnapshot(file);
+				CHECK_ECODE(status)
+
+				status = static_cast<M*>(this)->readSnapshotData(file);
+				CHECK_ECODE(status)
+
+				this->finalized = true;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// === Uniform refinement patterns ===
+			// Each cell type is refined by a fixed pattern, given in terms of the cell vertices in the order from
+			// getRefinementVertices. The Points tables list the vertices averaged to give each point of the refined
+			// cell (an original vertex, the midpoint of an edge, the centre of a quadrilateral face or the centre of
+			// the cell). The Children tables give the points of each child, in the same vertex order as its parent
+			// type, followed by the key passed to getRefinedChildIndex. The Faces tables give the points of each
+			// face inside the cell (-1 padded for triangles), followed by the two children either side of it.
+
+			/** Points of a refined tetrahedron: the 4 vertices, then the midpoints of its 6 edges **/
+			static const int refineTetPoints[10][8] = {
+				{ 0, -1, -1, -1, -1, -1, -1, -1},
+				{ 1, -1, -1, -1, -1, -1, -1, -1},
+				{ 2, -1, -1, -1, -1, -1, -1, -1},
+				{ 3, -1, -1, -1, -1, -1, -1, -1},
+				{ 0,  1, -1, -1, -1, -1, -1, -1},
+				{ 0,  2, -1, -1, -1, -1, -1, -1},
+				{ 0,  3, -1, -1, -1, -1, -1, -1},
+				{ 1,  2, -1, -1, -1, -1, -1, -1},
+				{ 1,  3, -1, -1, -1, -1, -1, -1},
+				{ 2,  3, -1, -1, -1, -1, -1, -1}
+			};
+
+			/** Children of a refined tetrahedron: 4 corner tetrahedra, and the inner octahedron split along the (0,1)-(2,3) diagonal **/
+			static const int refineTetChildren[8][9] = {
+				{ 0,  4,  5,  6, -1, -1, -1, -1,  0},
+				{ 1,  4,  7,  8, -1, -1, -1, -1,  1},
+				{ 2,  5,  7,  9, -1, -1, -1, -1,  2},
+				{ 3,  6,  8,  9, -1, -1, -1, -1,  3},
+				{ 7,  8,  9,  4, -1, -1, -1, -1, -1},
+				{ 5,  6,  9,  4, -1, -1, -1, -1, -2},
+				{ 4,  6,  8,  9, -1, -1, -1, -1, -3},
+				{ 4,  5,  7,  9, -1, -1, -1, -1, -4}
+			};
+
+			/** Inner faces of a refined tetrahedron **/
+			static const int refineTetFaces[8][6] = {
+				{ 4,  5,  6, -1,  0,  5},
+				{ 4,  7,  8, -1,  1,  4},
+				{ 5,  7,  9, -1,  2,  7},
+				{ 6,  8,  9, -1,  3,  6},
+				{ 4,  9,  5, -1,  5,  7},
+				{ 4,  9,  6, -1,  5,  6},
+				{ 4,  9,  7, -1,  4,  7},
+				{ 4,  9,  8, -1,  4,  6}
+			};
+
+			/** Points of a refined prism, in three layers of 6: base, middle and top **/
+			static const int refinePrismPoints[18][8] = {
+				{ 0, -1, -1, -1, -1, -1, -1, -1},
+				{ 1, -1, -1, -1, -1, -1, -1, -1},
+				{ 2, -1, -1, -1, -1, -1, -1, -1},
+				{ 0,  1, -1, -1, -1, -1, -1, -1},
+				{ 1,  2, -1, -1, -1, -1, -1, -1},
+				{ 2,  0, -1, -1, -1, -1, -1, -1},
+				{ 0,  3, -1, -1, -1, -1, -1, -1},
+				{ 1,  4, -1, -1, -1, -1, -1, -1},
+				{ 2,  5, -1, -1, -1, -1, -1, -1},
+				{ 0,  1,  4,  3, -1, -1, -1, -1},
+				{ 1,  2,  5,  4, -1, -1, -1, -1},
+				{ 2,  0,  3,  5, -1, -1, -1, -1},
+				{ 3, -1, -1, -1, -1, -1, -1, -1},
+				{ 4, -1, -1, -1, -1, -1, -1, -1},
+				{ 5, -1, -1, -1, -1, -1, -1, -1},
+				{ 3,  4, -1, -1, -1, -1, -1, -1},
+				{ 4,  5, -1, -1, -1, -1, -1, -1},
+				{ 5,  3, -1, -1, -1, -1, -1, -1}
+			};
+
+			/** Children of a refined prism: the base triangle split into 4, in two layers **/
+			static const int refinePrismChildren[8][9] = {
+				{ 0,  3,  5,  6,  9, 11, -1, -1,  0},
+				{ 1,  4,  3,  7, 10,  9, -1, -1,  1},
+				{ 2,  5,  4,  8, 11, 10, -1, -1,  2},
+				{ 3,  4,  5,  9, 10, 11, -1, -1, -1},
+				{ 6,  9, 11, 12, 15, 17, -1, -1,  3},
+				{ 7, 10,  9, 13, 16, 15, -1, -1,  4},
+				{ 8, 11, 10, 14, 17, 16, -1, -1,  5},
+				{ 9, 10, 11, 15, 16, 17, -1, -1, -4}
+			};
+
+			/** Inner faces of a refined prism **/
+			static const int refinePrismFaces[10][6] = {
+				{ 3,  5, 11,  9,  0,  3},
+				{ 4,  3,  9, 10,  1,  3},
+				{ 5,  4, 10, 11,  2,  3},
+				{ 9, 11, 17, 15,  4,  7},
+				{10,  9, 15, 16,  5,  7},
+				{11, 10, 16, 17,  6,  7},
+				{ 6,  9, 11, -1,  0,  4},
+				{ 7, 10,  9, -1,  1,  5},
+				{ 8, 11, 10, -1,  2,  6},
+				{ 9, 10, 11, -1,  3,  7}
+			};
+
+			/** Points of a refined hexahedron, on a 3x3x3 lattice (i + 3j + 9k) **/
+			static const int refineHexPoints[27][8] = {
+				{ 0, -1, -1, -1, -1, -1, -1, -1},
+				{ 0,  1, -1, -1, -1, -1, -1, -1},
+				{ 1, -1, -1, -1, -1, -1, -1, -1},
+				{ 0,  3, -1, -1, -1, -1, -1, -1},
+				{ 0,  1,  2,  3, -1, -1, -1, -1},
+				{ 1,  2, -1, -1, -1, -1, -1, -1},
+				{ 3, -1, -1, -1, -1, -1, -1, -1},
+				{ 2,  3, -1, -1, -1, -1, -1, -1},
+				{ 2, -1, -1, -1, -1, -1, -1, -1},
+				{ 0,  4, -1, -1, -1, -1, -1, -1},
+				{ 0,  1,  4,  5, -1, -1, -1, -1},
+				{ 1,  5, -1, -1, -1, -1, -1, -1},
+				{ 0,  3,  4,  7, -1, -1, -1, -1},
+				{ 0,  1,  2,  3,  4,  5,  6,  7},
+				{ 1,  2,  5,  6, -1, -1, -1, -1},
+				{ 3,  7, -1, -1, -1, -1, -1, -1},
+				{ 2,  3,  6,  7, -1, -1, -1, -1},
+				{ 2,  6, -1, -1, -1, -1, -1, -1},
+				{ 4, -1, -1, -1, -1, -1, -1, -1},
+				{ 4,  5, -1, -1, -1, -1, -1, -1},
+				{ 5, -1, -1, -1, -1, -1, -1, -1},
+				{ 4,  7, -1, -1, -1, -1, -1, -1},
+				{ 4,  5,  6,  7, -1, -1, -1, -1},
+				{ 5,  6, -1, -1, -1, -1, -1, -1},
+				{ 7, -1, -1, -1, -1, -1, -1, -1},
+				{ 6,  7, -1, -1, -1, -1, -1, -1},
+				{ 6, -1, -1, -1, -1, -1, -1, -1}
+			};
+
+			/** Children of a refined hexahedron, one at each corner **/
+			static const int refineHexChildren[8][9] = {
+				{ 0,  1,  4,  3,  9, 10, 13, 12,  0},
+				{ 1,  2,  5,  4, 10, 11, 14, 13,  1},
+				{ 3,  4,  7,  6, 12, 13, 16, 15,  3},
+				{ 4,  5,  8,  7, 13, 14, 17, 16,  2},
+				{ 9, 10, 13, 12, 18, 19, 22, 21,  4},
+				{10, 11, 14, 13, 19, 20, 23, 22,  5},
+				{12, 13, 16, 15, 21, 22, 25, 24,  7},
+				{13, 14, 17, 16, 22, 23, 26, 25,  6}
+			};
+
+			/** Inner faces of a refined hexahedron **/
+			static const int refineHexFaces[12][6] = {
+				{ 9, 10, 13, 12,  0,  4},
+				{10, 11, 14, 13,  1,  5},
+				{12, 13, 16, 15,  2,  6},
+				{13, 14, 17, 16,  3,  7},
+				{ 1,  4, 13, 10,  0,  1},
+				{ 4,  7, 16, 13,  2,  3},
+				{10, 13, 22, 19,  4,  5},
+				{13, 16, 25, 22,  6,  7},
+				{ 3,  4, 13, 12,  0,  2},
+				{ 4,  5, 14, 13,  1,  3},
+				{12, 13, 22, 21,  4,  6},
+				{13, 14, 23, 22,  5,  7}
+			};
+
+			/** Faces of a tetrahedron, prism and hexahedron (-1 padded), in terms of their vertex order **/
+			static const int refineTetShape[4][4] = {{0, 1, 2, -1}, {0, 1, 3, -1}, {1, 2, 3, -1}, {0, 2, 3, -1}};
+			static const int refinePrismShape[5][4] = {{0, 1, 2, -1}, {3, 4, 5, -1}, {0, 1, 4, 3}, {1, 2, 5, 4}, {2, 0, 3, 5}};
+			static const int refineHexShape[6][4] = {{0, 1, 2, 3}, {4, 5, 6, 7}, {0, 1, 5, 4}, {1, 2, 6, 5}, {2, 3, 7, 6}, {3, 0, 4, 7}};
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::getRefinementVertices(I cellID, I * vertices, I * nVertices) {
+				I nFaces = this->getCellNFaces(cellID);
+				I nTri = 0;
+				I nQuad = 0;
+
+				for(I i = 0; i < nFaces; i++) {
+					I nFaceVertices = this->getFaceNVertices(this->getCellFaceID(cellID, i));
+
+					if(nFaceVertices == 3) {
+						nTri++;
+					}
+					else if(nFaceVertices == 4) {
+						nQuad++;
+					}
+				}
+
+				I nBase;
+				if(nFaces == 4 && nTri == 4) {
+					nBase = 3;
+				}
+				else if(nFaces == 5 && nTri == 2 && nQuad == 3) {
+					nBase = 3;
+				}
+				else if(nFaces == 6 && nQuad == 6) {
+					nBase = 4;
+				}
+				else {
+					return cupcfd::error::E_UNKNOWN_CELL_TYPE;
+				}
+
+				// The base is the first triangle of a tetrahedron or prism, or the first face of a hexahedron
+				I baseFace = -1;
+				for(I i = 0; i < nFaces && baseFace < 0; i++) {
+					if(this->getFaceNVertices(this->getCellFaceID(cellID, i)) == nBase) {
+						baseFace = this->getCellFaceID(cellID, i);
+					}
+				}
+
+				for(I j = 0; j < nBase; j++) {
+					vertices[j] = this->getFaceVertex(baseFace, j);
+				}
+
+				if(nFaces == 4) {
+					// The apex is the vertex of any other face that is not in the base
+					I face = this->getCellFaceID(cellID, 0);
+					if(face == baseFace) {
+						face = this->getCellFaceID(cellID, 1);
+					}
+
+					for(I j = 0; j < 3; j++) {
+						I vertex = this->getFaceVertex(face, j);
+						if(vertex != vertices[0] && vertex != vertices[1] && vertex != vertices[2]) {
+							vertices[3] = vertex;
+						}
+					}
+
+					// Choose the shortest of the three diagonals of the inner octahedron, between the midpoints of
+					// opposite edges, and reorder so that it joins the midpoints of edges (0,1) and (2,3)
+					static const int order[3][4] = {{0, 1, 2, 3}, {0, 2, 1, 3}, {0, 3, 1, 2}};
+
+					euc::EuclideanPoint<T,3> pos[4];
+					for(I j = 0; j < 4; j++) {
+						pos[j] = this->getVertexPos(vertices[j]);
+					}
+
+					int best = 0;
+					T bestLength = T(0);
+
+					for(int k = 0; k < 3; k++) {
+						T length = T(0);
+						for(int d = 0; d < 3; d++) {
+							T diff = (pos[order[k][0]].cmp[d] + pos[order[k][1]].cmp[d]) - (pos[order[k][2]].cmp[d] + pos[order[k][3]].cmp[d]);
+							length += diff * diff;
+						}
+
+						if(k == 0 || length < bestLength) {
+							best = k;
+							bestLength = length;
+						}
+					}
+
+					I tmp[4] = {vertices[0], vertices[1], vertices[2], vertices[3]};
+					for(I j = 0; j < 4; j++) {
+						vertices[j] = tmp[order[best][j]];
+					}
+
+					*nVertices = 4;
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Each base vertex is joined by an edge of a side face to the vertex above it
+				for(I j = 0; j < nBase; j++) {
+					vertices[nBase + j] = -1;
+
+					for(I i = 0; i < nFaces && vertices[nBase + j] < 0; i++) {
+						I face = this->getCellFaceID(cellID, i);
+						if(face == baseFace) {
+							continue;
+						}
+
+						I nFaceVertices = this->getFaceNVertices(face);
+						for(I k = 0; k < nFaceVertices; k++) {
+							if(this->getFaceVertex(face, k) != vertices[j]) {
+								continue;
+							}
+
+							I adjacent[2] = {this->getFaceVertex(face, (k + 1) % nFaceVertices),
+											 this->getFaceVertex(face, (k + nFaceVertices - 1) % nFaceVertices)};
+
+							for(I a = 0; a < 2; a++) {
+								bool inBase = false;
+								for(I b = 0; b < nBase; b++) {
+									inBase = inBase || (adjacent[a] == vertices[b]);
+								}
+
+								if(!inBase) {
+									vertices[nBase + j] = adjacent[a];
+								}
+							}
+						}
+					}
+
+					if(vertices[nBase + j] < 0) {
+						return cupcfd::error::E_UNKNOWN_CELL_TYPE;
+					}
+				}
+
+				*nVertices = 2 * nBase;
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class M, class I, class T, class L>
+			I UnstructuredMeshInterface<M,I,T,L>::getRefinementCellFace(I cellID, I vertex0, I vertex1, I vertex2) {
+				I nFaces = this->getCellNFaces(cellID);
+
+				for(I i = 0; i < nFaces; i++) {
+					I face = this->getCellFaceID(cellID, i);
+					I nFaceVertices = this->getFaceNVertices(face);
+					I nFound = 0;
+
+					for(I j = 0; j < nFaceVertices; j++) {
+						I vertex = this->getFaceVertex(face, j);
+						if(vertex == vertex0 || vertex == vertex1 || vertex == vertex2) {
+							nFound++;
+						}
+					}
+
+					if(nFound == 3) {
+						return face;
+					}
+				}
+
+				return -1;
+			}
+
+			template <class M, class I, class T, class L>
+			I UnstructuredMeshInterface<M,I,T,L>::getRefinementPointRank(const T * points, I nPoints, const T * point) {
+				I rank = 0;
+
+				for(I j = 0; j < nPoints; j++) {
+					const T * other = points + 3 * j;
+
+					if(other[0] < point[0] ||
+					   (other[0] == point[0] && (other[1] < point[1] || (other[1] == point[1] && other[2] < point[2])))) {
+						rank++;
+					}
+				}
+
+				return rank;
+			}
+
+			template <class M, class I, class T, class L>
+			I UnstructuredMeshInterface<M,I,T,L>::getRefinedChildIndex(const T * cellPoints, I nVertices, const T * cornerPoints, int key) {
+				// Children at a corner are numbered by the rank of the corner
+				if(key >= 0) {
+					return getRefinementPointRank(cellPoints, nVertices, cornerPoints + 3 * key);
+				}
+
+				I corner = -key - 1;
+
+				// The inner children of a tetrahedron follow the corner opposite the face they touch
+				if(nVertices == 4) {
+					return 4 + getRefinementPointRank(cellPoints, nVertices, cornerPoints + 3 * corner);
+				}
+
+				// The inner children of a prism are ordered by whether their triangle holds the first vertex
+				for(I j = 0; j < 3; j++) {
+					if(getRefinementPointRank(cellPoints, nVertices, cornerPoints + 3 * (corner + j)) == 0) {
+						return 6;
+					}
+				}
+
+				return 7;
+			}
+
+			template <class M, class I, class T, class L>
+			I UnstructuredMeshInterface<M,I,T,L>::getRefinedFaceChildIndex(const T * cellPoints, I nVertices,
+																		   const T * facePoints, I nFaceVertices, I subFace) {
+				if(subFace < nFaceVertices) {
+					return getRefinementPointRank(cellPoints, nVertices, facePoints + 3 * subFace);
+				}
+
+				// The central sub-face of a tetrahedron's face belongs to the inner child of the opposite corner
+				if(nVertices == 4) {
+					for(I k = 0; k < 4; k++) {
+						bool inFace = false;
+						for(I j = 0; j < 3; j++) {
+							inFace = inFace || (cellPoints[3*k] == facePoints[3*j] && cellPoints[3*k + 1] == facePoints[3*j + 1] &&
+												cellPoints[3*k + 2] == facePoints[3*j + 2]);
+						}
+
+						if(!inFace) {
+							return 4 + getRefinementPointRank(cellPoints, nVertices, cellPoints + 3 * k);
+						}
+					}
+				}
+
+				for(I j = 0; j < 3; j++) {
+					if(getRefinementPointRank(cellPoints, nVertices, facePoints + 3 * j) == 0) {
+						return 6;
+					}
+				}
+
+				return 7;
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::refine(M ** refinedMesh) {
+				cupcfd::error::eCodes status;
+
+				if(!this->finalized) {
+					return cupcfd::error::E_UNFINALIZED;
+				}
+
+				M * mesh = static_cast<M*>(this);
+				cupcfd::comm::Communicator& comm = *(this->cellConnGraph->comm);
+
+				I nLCells = this->properties.lOCells;
+				I nTCells = this->properties.lTCells;
+				I nFaces = this->properties.lFaces;
+				I nVertices = this->properties.lVertices;
+				I nBoundaries = this->properties.lBoundaries;
+				I nRegions = this->properties.lRegions;
+
+				// =====================================
+				// (1) Labels of the stored elements
+				// =====================================
+
+				std::vector<L> cellLabels(nTCells);
+				for(I i = 0; i < nTCells; i++) {
+					status = this->cellConnGraph->connGraph.getLocalIndexNode(i, &(cellLabels[i]));
+					CHECK_ECODE(status)
+				}
+
+				std::vector<L> faceLabels(nFaces);
+				for(typename cupcfd::data_structures::FlatHashMap<L,I>::iterator it = mesh->faceBuildIDToLocalID.begin(); it != mesh->faceBuildIDToLocalID.end(); ++it) {
+					faceLabels[it->second] = it->first;
+				}
+
+				std::vector<L> vertexLabels(nVertices);
+				for(typename cupcfd::data_structures::FlatHashMap<L,I>::iterator it = mesh->vertexBuildIDToLocalID.begin(); it != mesh->vertexBuildIDToLocalID.end(); ++it) {
+					vertexLabels[it->second] = it->first;
+				}
+
+				std::vector<L> boundaryLabels(nBoundaries);
+				for(typename cupcfd::data_structures::FlatHashMap<L,I>::iterator it = mesh->boundaryBuildIDToLocalID.begin(); it != mesh->boundaryBuildIDToLocalID.end(); ++it) {
+					boundaryLabels[it->second] = it->first;
+				}
+
+				std::vector<L> regionLabels(nRegions);
+				for(typename cupcfd::data_structures::FlatHashMap<L,I>::iterator it = mesh->regionBuildIDToLocalID.begin(); it != mesh->regionBuildIDToLocalID.end(); ++it) {
+					regionLabels[it->second] = it->first;
+				}
+
+				// =====================================
+				// (2) Vertices of each local cell in the order of its refinement pattern
+				// =====================================
+
+				std::vector<I> cellVertices(8 * nLCells, -1);
+				std::vector<I> cellNVertices(nLCells, 0);
+				int invalidCell = 0;
+
+				#pragma omp parallel for reduction(max:invalidCell)
+				for(I i = 0; i < nLCells; i++) {
+					if(this->getRefinementVertices(i, cellVertices.data() + 8 * i, &(cellNVertices[i])) != cupcfd::error::E_SUCCESS) {
+						invalidCell = 1;
+					}
+				}
+
+				// The children of a cell are numbered from the positions of its vertices, which are the same on
+				// every rank. Those of the ghost cells are exchanged, one coordinate at a time, so that the children
+				// of a ghost cell are numbered as on its owner.
+				std::vector<T> cellPoints(24 * nTCells, T(0));
+				std::vector<I> cellNPoints(nTCells, 0);
+
+				for(I i = 0; i < nLCells; i++) {
+					for(I j = 0; j < cellNVertices[i]; j++) {
+						euc::EuclideanPoint<T,3> pos = this->getVertexPos(cellVertices[8 * i + j]);
+						cellPoints[24 * i + 3 * j] = pos.cmp[0];
+						cellPoints[24 * i + 3 * j + 1] = pos.cmp[1];
+						cellPoints[24 * i + 3 * j + 2] = pos.cmp[2];
+					}
+
+					cellNPoints[i] = cellNVertices[i];
+				}
+
+				cupcfd::comm::ExchangePatternConfig exchangePatternConfig(cupcfd::comm::EXCHANGE_NONBLOCKING_ONE_SIDED);
+				cupcfd::comm::ExchangePattern<T> * pointPattern;
+				status = exchangePatternConfig.buildExchangePattern(&pointPattern, *(this->cellConnGraph));
+				CHECK_ECODE(status)
+
+				std::vector<T> values(nTCells);
+				for(I k = 0; k < 25; k++) {
+					for(I i = 0; i < nLCells; i++) {
+						values[i] = (k < 24) ? cellPoints[24 * i + k] : T(cellNPoints[i]);
+					}
+
+					status = pointPattern->exchangeStart(values.data(), nTCells);
+					CHECK_ECODE(status)
+					status = pointPattern->exchangeStop(values.data(), nTCells);
+					CHECK_ECODE(status)
+
+					for(I i = nLCells; i < nTCells; i++) {
+						if(k < 24) {
+							cellPoints[24 * i + k] = values[i];
+						}
+						else {
+							cellNPoints[i] = (I) values[i];
+						}
+					}
+				}
+
+				delete pointPattern;
+
+				// =====================================
+				// (3) The faces and edges that are refined on this rank: those of faces with a local cell on
+				// at least one side
+				// =====================================
+
+				std::vector<I> usedFaces;
+				std::vector<char> vertexUsed(nVertices, 0);
+				std::vector<uint64_t> edgeKeys;
+
+				for(I i = 0; i < nFaces; i++) {
+					bool isBoundary = this->getFaceIsBoundary(i);
+
+					if(this->getFaceCell1ID(i) < nLCells || (!isBoundary && this->getFaceCell2ID(i) < nLCells)) {
+						usedFaces.push_back(i);
+
+						I nFaceVertices = this->getFaceNVertices(i);
+						for(I j = 0; j < nFaceVertices; j++) {
+							I vertex0 = this->getFaceVertex(i, j);
+							I vertex1 = this->getFaceVertex(i, (j + 1) % nFaceVertices);
+							vertexUsed[vertex0] = 1;
+							edgeKeys.push_back(((uint64_t) std::min(vertex0, vertex1)) * ((uint64_t) nVertices) + ((uint64_t) std::max(vertex0, vertex1)));
+						}
+					}
+				}
+
+				std::sort(edgeKeys.begin(), edgeKeys.end());
+				edgeKeys.erase(std::unique(edgeKeys.begin(), edgeKeys.end()), edgeKeys.end());
+
+				I nUsedFaces = (I) usedFaces.size();
+				I nEdges = (I) edgeKeys.size();
+
+				// =====================================
+				// (4) Label ranges. New labels are placed above the largest label of each element type on any rank.
+				// =====================================
+
+				L localMax[6] = {-1, -1, -1, -1, (L) nEdges, (L) invalidCell};
+				for(I i = 0; i < nTCells; i++) {
+					localMax[0] = std::max(localMax[0], cellLabels[i]);
+				}
+				for(I i = 0; i < nFaces; i++) {
+					localMax[1] = std::max(localMax[1], faceLabels[i]);
+				}
+				for(I i = 0; i < nVertices; i++) {
+					localMax[2] = std::max(localMax[2], vertexLabels[i]);
+				}
+				for(I i = 0; i < nBoundaries; i++) {
+					localMax[3] = std::max(localMax[3], boundaryLabels[i]);
+				}
+
+				L globalMax[6];
+				status = cupcfd::comm::allReduceMax(localMax, 6, globalMax, 6, comm);
+				CHECK_ECODE(status)
+
+				if(globalMax[5] > 0) {
+					return cupcfd::error::E_UNKNOWN_CELL_TYPE;
+				}
+
+				// The largest new labels are 8x the cell labels, 4x the face labels plus 12x the cell labels, and the
+				// sum of the vertex, face, cell and edge ranges
+				L labelLimit = std::numeric_limits<L>::max() / 24;
+				for(I k = 0; k < 5; k++) {
+					if(globalMax[k] + 1 > labelLimit) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+				}
+
+				L nCellLabels = globalMax[0] + 1;
+				L nFaceLabels = globalMax[1] + 1;
+				L nVertexLabels = globalMax[2] + 1;
+				L faceCentreBase = nVertexLabels;
+				L cellCentreBase = faceCentreBase + nFaceLabels;
+				L edgeBase = cellCentreBase + nCellLabels;
+				L innerFaceBase = 4 * nFaceLabels;
+
+				// =====================================
+				// (5) Vertices of the refined mesh
+				// =====================================
+
+				std::vector<euc::EuclideanPoint<T,3>> faceCentres(nFaces);
+				std::vector<euc::EuclideanPoint<T,3>> cellCentres(nLCells);
+
+				#pragma omp parallel for
+				for(I i = 0; i < nUsedFaces; i++) {
+					I face = usedFaces[i];
+					I nFaceVertices = this->getFaceNVertices(face);
+					euc::EuclideanPoint<T,3> centre(T(0), T(0), T(0));
+
+					for(I j = 0; j < nFaceVertices; j++) {
+						centre = centre + this->getVertexPos(this->getFaceVertex(face, j));
+					}
+
+					faceCentres[face] = centre * (T(1) / T(nFaceVertices));
+				}
+
+				#pragma omp parallel for
+				for(I i = 0; i < nLCells; i++) {
+					euc::EuclideanPoint<T,3> centre(T(0), T(0), T(0));
+
+					for(I j = 0; j < cellNVertices[i]; j++) {
+						centre = centre + this->getVertexPos(cellVertices[8 * i + j]);
+					}
+
+					cellCentres[i] = centre * (T(1) / T(cellNVertices[i]));
+				}
+
+				std::vector<L> newVertexLabels;
+				std::vector<euc::EuclideanPoint<T,3>> newVertexPos;
+
+				for(I i = 0; i < nVertices; i++) {
+					if(vertexUsed[i]) {
+						newVertexLabels.push_back(vertexLabels[i]);
+						newVertexPos.push_back(this->getVertexPos(i));
+					}
+				}
+
+				for(I i = 0; i < nEdges; i++) {
+					I vertex0 = (I) (edgeKeys[i] / ((uint64_t) nVertices));
+					I vertex1 = (I) (edgeKeys[i] % ((uint64_t) nVertices));
+					newVertexLabels.push_back(edgeBase + i);
+					newVertexPos.push_back((this->getVertexPos(vertex0) + this->getVertexPos(vertex1)) * T(0.5));
+				}
+
+				for(I i = 0; i < nUsedFaces; i++) {
+					if(this->getFaceNVertices(usedFaces[i]) == 4) {
+						newVertexLabels.push_back(faceCentreBase + faceLabels[usedFaces[i]]);
+						newVertexPos.push_back(faceCentres[usedFaces[i]]);
+					}
+				}
+
+				for(I i = 0; i < nLCells; i++) {
+					if(cellNVertices[i] == 8) {
+						newVertexLabels.push_back(cellCentreBase + cellLabels[i]);
+						newVertexPos.push_back(cellCentres[i]);
+					}
+				}
+
+				// =====================================
+				// (6) Sub-faces of the refined faces. Sub-faces keep the orientation of their parent, and
+				// the children either side of them are numbered from the vertex positions of the parent cells.
+				// =====================================
+
+				// The points of each face: its vertices, the midpoints of its edges, and the centre of quadrilaterals
+				std::vector<L> facePoints(9 * nFaces, -1);
+
+				#pragma omp parallel for
+				for(I i = 0; i < nUsedFaces; i++) {
+					I face = usedFaces[i];
+					I nFaceVertices = this->getFaceNVertices(face);
+
+					for(I j = 0; j < nFaceVertices; j++) {
+						I vertex0 = this->getFaceVertex(face, j);
+						I vertex1 = this->getFaceVertex(face, (j + 1) % nFaceVertices);
+						uint64_t key = ((uint64_t) std::min(vertex0, vertex1)) * ((uint64_t) nVertices) + ((uint64_t) std::max(vertex0, vertex1));
+
+						facePoints[9 * face + j] = vertexLabels[vertex0];
+						facePoints[9 * face + nFaceVertices + j] = edgeBase + (L) (std::lower_bound(edgeKeys.begin(), edgeKeys.end(), key) - edgeKeys.begin());
+					}
+
+					if(nFaceVertices == 4) {
+						facePoints[9 * face + 8] = faceCentreBase + faceLabels[face];
+					}
+				}
+
+				// Each face of the refined mesh has up to 4 vertices, stored at a fixed stride until they are compacted
+				std::vector<I> cellInnerXAdj(nLCells + 1);
+				cellInnerXAdj[0] = 0;
+				for(I i = 0; i < nLCells; i++) {
+					cellInnerXAdj[i + 1] = cellInnerXAdj[i] + (cellNVertices[i] == 4 ? 8 : (cellNVertices[i] == 6 ? 10 : 12));
+				}
+
+				I nSubFaces = 4 * nUsedFaces;
+				I nNewFaces = nSubFaces + cellInnerXAdj[nLCells];
+
+				std::vector<L> newFaceLabels(nNewFaces);
+				std::vector<L> newFaceCell1(nNewFaces);
+				std::vector<L> newFaceCell2(nNewFaces);
+				std::vector<T> newFaceLambda(nNewFaces);
+				std::vector<L> newFaceVertices(4 * nNewFaces, -1);
+				std::vector<I> newFaceNVertices(nNewFaces);
+				bool * newFaceIsBoundary = (bool *) malloc(sizeof(bool) * nNewFaces);
+
+				#pragma omp parallel for
+				for(I i = 0; i < nUsedFaces; i++) {
+					I face = usedFaces[i];
+					I nFaceVertices = this->getFaceNVertices(face);
+					const L * points = facePoints.data() + 9 * face;
+					bool isBoundary = this->getFaceIsBoundary(face);
+					I cell1 = this->getFaceCell1ID(face);
+					I cell2 = isBoundary ? -1 : this->getFaceCell2ID(face);
+
+					T positions[12];
+					for(I j = 0; j < nFaceVertices; j++) {
+						euc::EuclideanPoint<T,3> pos = this->getVertexPos(this->getFaceVertex(face, j));
+						positions[3 * j] = pos.cmp[0];
+						positions[3 * j + 1] = pos.cmp[1];
+						positions[3 * j + 2] = pos.cmp[2];
+					}
+
+					for(I s = 0; s < 4; s++) {
+						I j = 4 * i + s;
+						I subFace = std::min(s, nFaceVertices);
+
+						newFaceLabels[j] = 4 * faceLabels[face] + s;
+						newFaceIsBoundary[j] = isBoundary;
+						newFaceCell1[j] = 8 * cellLabels[cell1] + getRefinedFaceChildIndex(cellPoints.data() + 24 * cell1, cellNPoints[cell1],
+																						   positions, nFaceVertices, subFace);
+
+						if(isBoundary) {
+							newFaceCell2[j] = 4 * boundaryLabels[this->getFaceBoundaryID(face)] + s;
+							newFaceLambda[j] = this->getFaceLambda(face);
+						}
+						else {
+							newFaceCell2[j] = 8 * cellLabels[cell2] + getRefinedFaceChildIndex(cellPoints.data() + 24 * cell2, cellNPoints[cell2],
+																							   positions, nFaceVertices, subFace);
+							newFaceLambda[j] = T(0.5);
+						}
+
+						// Vertices, in the same winding as the parent: a corner with the midpoints of the edges either
+						// side of it (and the centre of a quadrilateral), or the three midpoints of a triangle
+						L * vertices = newFaceVertices.data() + 4 * j;
+						I prev = (subFace + nFaceVertices - 1) % nFaceVertices;
+
+						if(subFace == nFaceVertices) {
+							vertices[0] = points[3];
+							vertices[1] = points[4];
+							vertices[2] = points[5];
+							newFaceNVertices[j] = 3;
+						}
+						else if(nFaceVertices == 3) {
+							vertices[0] = points[subFace];
+							vertices[1] = points[3 + subFace];
+							vertices[2] = points[3 + prev];
+							newFaceNVertices[j] = 3;
+						}
+						else {
+							vertices[0] = points[subFace];
+							vertices[1] = points[4 + subFace];
+							vertices[2] = points[8];
+							vertices[3] = points[4 + prev];
+							newFaceNVertices[j] = 4;
+						}
+					}
+				}
+
+				// =====================================
+				// (7) Children of the local cells, and the faces between them
+				// =====================================
+
+				std::vector<L> childLabels(8 * nLCells);
+				std::vector<euc::EuclideanPoint<T,3>> childCentres(8 * nLCells);
+				std::vector<T> childVolumes(8 * nLCells);
+
+				#pragma omp parallel for
+				for(I i = 0; i < nLCells; i++) {
+					const I * vertices = cellVertices.data() + 8 * i;
+					I nCellVertices = cellNVertices[i];
+
+					const int (*points)[8];
+					const int (*children)[9];
+					const int (*innerFaces)[6];
+					const int (*shape)[4];
+					int nPoints;
+					int nShapeFaces;
+
+					if(nCellVertices == 4) {
+						points = refineTetPoints;
+						children = refineTetChildren;
+						innerFaces = refineTetFaces;
+						shape = refineTetShape;
+						nPoints = 10;
+						nShapeFaces = 4;
+					}
+					else if(nCellVertices == 6) {
+						points = refinePrismPoints;
+						children = refinePrismChildren;
+						innerFaces = refinePrismFaces;
+						shape = refinePrismShape;
+						nPoints = 18;
+						nShapeFaces = 5;
+					}
+					else {
+						points = refineHexPoints;
+						children = refineHexChildren;
+						innerFaces = refineHexFaces;
+						shape = refineHexShape;
+						nPoints = 27;
+						nShapeFaces = 6;
+					}
+
+					L cornerLabels[8];
+					for(I j = 0; j < nCellVertices; j++) {
+						cornerLabels[j] = vertexLabels[vertices[j]];
+					}
+
+					// Labels and positions of the points of the refined cell
+					L pointLabels[27];
+					euc::EuclideanPoint<T,3> pointPos[27];
+
+					for(int p = 0; p < nPoints; p++) {
+						int nCorners = 0;
+						while(nCorners < 8 && points[p][nCorners] >= 0) {
+							nCorners++;
+						}
+
+						if(nCorners == 1) {
+							pointLabels[p] = cornerLabels[points[p][0]];
+							pointPos[p] = this->getVertexPos(vertices[points[p][0]]);
+						}
+						else if(nCorners == 2) {
+							I vertex0 = vertices[points[p][0]];
+							I vertex1 = vertices[points[p][1]];
+							uint64_t key = ((uint64_t) std::min(vertex0, vertex1)) * ((uint64_t) nVertices) + ((uint64_t) std::max(vertex0, vertex1));
+							pointLabels[p] = edgeBase + (L) (std::lower_bound(edgeKeys.begin(), edgeKeys.end(), key) - edgeKeys.begin());
+							pointPos[p] = (this->getVertexPos(vertex0) + this->getVertexPos(vertex1)) * T(0.5);
+						}
+						else if(nCorners == 4) {
+							I face = this->getRefinementCellFace(i, vertices[points[p][0]], vertices[points[p][1]], vertices[points[p][2]]);
+							pointLabels[p] = faceCentreBase + faceLabels[face];
+							pointPos[p] = faceCentres[face];
+						}
+						else {
+							pointLabels[p] = cellCentreBase + cellLabels[i];
+							pointPos[p] = cellCentres[i];
+						}
+					}
+
+					// Children, with their volume and centroid computed from their faces
+					L localChildLabels[8];
+
+					for(int c = 0; c < 8; c++) {
+						euc::EuclideanPoint<T,3> shapePoints[24];
+						int shapeXAdj[7];
+						shapeXAdj[0] = 0;
+
+						for(int f = 0; f < nShapeFaces; f++) {
+							int nShapeVertices = (shape[f][3] < 0) ? 3 : 4;
+							for(int k = 0; k < nShapeVertices; k++) {
+								shapePoints[shapeXAdj[f] + k] = pointPos[children[c][shape[f][k]]];
+							}
+							shapeXAdj[f + 1] = shapeXAdj[f] + nShapeVertices;
+						}
+
+						shapes::GeneralPolyhedron<T> child(shapePoints, shapeXAdj, nShapeFaces);
+
+						localChildLabels[c] = 8 * cellLabels[i] + getRefinedChildIndex(cellPoints.data() + 24 * i, nCellVertices,
+																					   cellPoints.data() + 24 * i, children[c][8]);
+						childLabels[8 * i + c] = localChildLabels[c];
+						childVolumes[8 * i + c] = child.getVolume();
+						childCentres[8 * i + c] = child.getCentroid();
+					}
+
+					// Faces between the children
+					for(I k = 0; k < cellInnerXAdj[i + 1] - cellInnerXAdj[i]; k++) {
+						I j = nSubFaces + cellInnerXAdj[i] + k;
+
+						newFaceLabels[j] = innerFaceBase + 12 * cellLabels[i] + k;
+						newFaceCell1[j] = localChildLabels[innerFaces[k][4]];
+						newFaceCell2[j] = localChildLabels[innerFaces[k][5]];
+						newFaceIsBoundary[j] = false;
+						newFaceLambda[j] = T(0.5);
+						newFaceNVertices[j] = (innerFaces[k][3] < 0) ? 3 : 4;
+
+						for(I v = 0; v < newFaceNVertices[j]; v++) {
+							newFaceVertices[4 * j + v] = pointLabels[innerFaces[k][v]];
+						}
+					}
+				}
+
+				// =====================================
+				// (8) Build the refined mesh
+				// =====================================
+
+				*refinedMesh = new M(comm);
+				M& fine = **refinedMesh;
+				fine.properties.scaleFactor = this->properties.scaleFactor;
+
+				status = fine.addVertices(newVertexLabels.data(), newVertexPos.data(), (I) newVertexLabels.size());
+				CHECK_ECODE(status)
+
+				for(I i = 0; i < nRegions; i++) {
+					euc::EuclideanVector<T,3> forceTangent;
+					euc::EuclideanVector<T,3> uvw;
+					std::string regionName;
+
+					this->getRegionForceTangent(i, forceTangent);
+					this->getRegionUVW(i, uvw);
+					this->getRegionName(i, regionName);
+
+					status = fine.addRegion(regionLabels[i], this->getRegionType(i), this->getRegionStd(i), this->getRegionFlux(i),
+											this->getRegionAdiab(i), this->getRegionYLog(i), this->getRegionELog(i),
+											this->getRegionDensity(i), this->getRegionTurbKE(i), this->getRegionTurbDiss(i),
+											this->getRegionSplvl(i), this->getRegionDen(i), this->getRegionR(i), this->getRegionT(i),
+											forceTangent, uvw, regionName);
+					CHECK_ECODE(status)
+				}
+
+				// Each boundary is split with its face, and keeps its region. The distance to the wall halves.
+				std::vector<L> newBoundaryLabels;
+				std::vector<L> newBoundaryRegions;
+				std::vector<I> newBoundaryXAdj(1, 0);
+				std::vector<L> newBoundaryVertices;
+				std::vector<T> newBoundaryDistance;
+
+				for(I i = 0; i < nUsedFaces; i++) {
+					I face = usedFaces[i];
+
+					if(this->getFaceIsBoundary(face)) {
+						I boundary = this->getFaceBoundaryID(face);
+
+						for(I s = 0; s < 4; s++) {
+							I j = 4 * i + s;
+							newBoundaryLabels.push_back(newFaceCell2[j]);
+							newBoundaryRegions.push_back(regionLabels[this->getBoundaryRegionID(boundary)]);
+							newBoundaryVertices.insert(newBoundaryVertices.end(), newFaceVertices.begin() + 4 * j,
+													   newFaceVertices.begin() + 4 * j + newFaceNVertices[j]);
+							newBoundaryXAdj.push_back((I) newBoundaryVertices.size());
+							newBoundaryDistance.push_back(T(0.5) * this->getBoundaryDistance(boundary));
+						}
+					}
+				}
+
+				status = fine.addBoundaries(newBoundaryLabels.data(), newBoundaryRegions.data(), newBoundaryXAdj.data(),
+											newBoundaryVertices.data(), newBoundaryDistance.data(), (I) newBoundaryLabels.size());
+				CHECK_ECODE(status)
+
+				status = fine.addCells(childLabels.data(), childCentres.data(), childVolumes.data(), 8 * nLCells, true);
+				CHECK_ECODE(status)
+
+				// The ghost cells are the children of ghost cells that share a sub-face with a local child. Their
+				// geometry is exchanged once the refined mesh is finalized.
+				std::vector<std::pair<L,I>> ghostChildren;
+
+				for(I i = 0; i < nUsedFaces; i++) {
+					I face = usedFaces[i];
+
+					if(this->getFaceIsBoundary(face)) {
+						continue;
+					}
+
+					I cell1 = this->getFaceCell1ID(face);
+					I cell2 = this->getFaceCell2ID(face);
+
+					for(I s = 0; s < 4; s++) {
+						if(cell1 >= nLCells) {
+							ghostChildren.push_back(std::pair<L,I>(newFaceCell1[4 * i + s], cell1));
+						}
+						else if(cell2 >= nLCells) {
+							ghostChildren.push_back(std::pair<L,I>(newFaceCell2[4 * i + s], cell2));
+						}
+					}
+				}
+
+				std::sort(ghostChildren.begin(), ghostChildren.end());
+				ghostChildren.erase(std::unique(ghostChildren.begin(), ghostChildren.end()), ghostChildren.end());
+
+				I nGhostChildren = (I) ghostChildren.size();
+				std::vector<L> ghostLabels(nGhostChildren);
+				std::vector<euc::EuclideanPoint<T,3>> ghostCentres(nGhostChildren);
+				std::vector<T> ghostVolumes(nGhostChildren);
+
+				for(I i = 0; i < nGhostChildren; i++) {
+					ghostLabels[i] = ghostChildren[i].first;
+					ghostCentres[i] = this->getCellCenter(ghostChildren[i].second);
+					ghostVolumes[i] = this->getCellVolume(ghostChildren[i].second) / T(8);
+				}
+
+				status = fine.addCells(ghostLabels.data(), ghostCentres.data(), ghostVolumes.data(), nGhostChildren, false);
+				CHECK_ECODE(status)
+
+				// Compact the face vertices. The face geometry is computed when the mesh is finalized.
+				std::vector<I> newFaceXAdj(nNewFaces + 1);
+				std::vector<L> newFaceVertexLabels;
+				newFaceVertexLabels.reserve(4 * nNewFaces);
+				newFaceXAdj[0] = 0;
+
+				for(I j = 0; j < nNewFaces; j++) {
+					newFaceVertexLabels.insert(newFaceVertexLabels.end(), newFaceVertices.begin() + 4 * j,
+											   newFaceVertices.begin() + 4 * j + newFaceNVertices[j]);
+					newFaceXAdj[j + 1] = (I) newFaceVertexLabels.size();
+				}
+
+				std::vector<euc::EuclideanVector3D<T>> newFaceNorm(nNewFaces, euc::EuclideanVector3D<T>(T(0), T(0), T(0)));
+				std::vector<euc::EuclideanPoint<T,3>> newFaceCentre(nNewFaces, euc::EuclideanPoint<T,3>(T(0), T(0), T(0)));
+				std::vector<T> newFaceArea(nNewFaces, T(0));
+
+				status = fine.addFaces(newFaceLabels.data(), newFaceCell1.data(), newFaceCell2.data(), newFaceIsBoundary,
+									   newFaceLambda.data(), newFaceNorm.data(), newFaceXAdj.data(), newFaceVertexLabels.data(),
+									   newFaceCentre.data(), nullptr, nullptr, nullptr, newFaceArea.data(), nNewFaces);
+				free(newFaceIsBoundary);
+				CHECK_ECODE(status)
+
+				status = fine.finalize();
+				CHECK_ECODE(status)
+
+				// =====================================
+				// (9) Exchange the volume and centre of the new ghost cells, and recompute the face geometry
+				// that depends on them
+				// =====================================
+
+				cupcfd::comm::ExchangePattern<T> * geometryPattern;
+				status = exchangePatternConfig.buildExchangePattern(&geometryPattern, *(fine.cellConnGraph));
+				CHECK_ECODE(status)
+
+				I nFineLCells = fine.properties.lOCells;
+				I nFineTCells = fine.properties.lTCells;
+				std::vector<euc::EuclideanPoint<T,3>> fineCentres(nFineTCells);
+				values.resize(nFineTCells);
+
+				for(I i = 0; i < nFineTCells; i++) {
+					fineCentres[i] = fine.getCellCenter(i);
+					values[i] = fine.getCellVolume(i);
+				}
+
+				status = geometryPattern->exchangeStart(values.data(), nFineTCells);
+				CHECK_ECODE(status)
+				status = geometryPattern->exchangeStop(values.data(), nFineTCells);
+				CHECK_ECODE(status)
+
+				for(I i = nFineLCells; i < nFineTCells; i++) {
+					fine.setCellVolume(i, values[i]);
+				}
+
+				for(I d = 0; d < 3; d++) {
+					for(I i = 0; i < nFineTCells; i++) {
+						values[i] = fineCentres[i].cmp[d];
+					}
+
+					status = geometryPattern->exchangeStart(values.data(), nFineTCells);
+					CHECK_ECODE(status)
+					status = geometryPattern->exchangeStop(values.data(), nFineTCells);
+					CHECK_ECODE(status)
+
+					for(I i = nFineLCells; i < nFineTCells; i++) {
+						fineCentres[i].cmp[d] = values[i];
+					}
+				}
+
+				delete geometryPattern;
+
+				for(I i = nFineLCells; i < nFineTCells; i++) {
+					fine.setCellCenter(i, fineCentres[i]);
+				}
+
+				status = fine.computeFaceGeometry();
+				CHECK_ECODE(status)
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class M, class I, class T, class L>
+			template <class S>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::isPointInsideCell(I cellID,
+																						 euc::EuclideanPoint<T,3>& point,
+																						 bool * inside) {
+				cupcfd::error::eCodes status;
+
+				S * shape;
+				status = this->buildPolyhedron(cellID, &shape);
+				CHECK_ECODE(status)
+				*inside = shape->isPointInside(point);
+				delete shape;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class M, class I, class T, class L>
+			template <class S>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::findCellIDOfType(euc::EuclideanPoint<T,3>& point,
+																						I * localCellID) {
+				cupcfd::error::eCodes status;
+				I nCells = this->properties.lOCells;
+
+				for(I i = 0; i < nCells; i++) {
+					bool inside;
+					status = this->template isPointInsideCell<S>(i, point, &inside);
+					CHECK_ECODE(status)
+
+					if(inside) {
+						*localCellID = i;
+						return cupcfd::error::E_SUCCESS;
+					}
+				}
+
+				*localCellID = -1;
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::findCellID(euc::EuclideanPoint<T,3>& point, 
+																					  I * localCellID,
+																					  I * globalCellID) {
+				// Loop over and test each locally owned cell until we find the cell the point is located in (if any on this rank)
+				// For each cell:
+				// (a) Determine the type of cell. If every cell has the same type, this is done once
+				// for the whole loop.
+				// (b) Test whether the position of the source is inside the cell
+				// (bi) If so, updated the local and global cell IDs
+				// (bii) If not, continue until no cells left to test
+				cupcfd::error::eCodes status;
+				I cellID = -1;
+
+				switch(this->properties.cellType) {
+					case shapes::POLYHEDRON_TETRAHEDRON:
+						status = this->template findCellIDOfType<shapes::Tetrahedron<T>>(point, &cellID);
+						CHECK_ECODE(status)
+						break;
+					case shapes::POLYHEDRON_QUADPYRAMID:
+						status = this->template findCellIDOfType<shapes::QuadPyramid<T>>(point, &cellID);
+						CHECK_ECODE(status)
+						break;
+					case shapes::POLYHEDRON_TRIPRISM:
+						status = this->template findCellIDOfType<shapes::TriPrism<T>>(point, &cellID);
+						CHECK_ECODE(status)
+						break;
+					case shapes::POLYHEDRON_HEXAHEDRON:
+						status = this->template findCellIDOfType<shapes::Hexahedron<T>>(point, &cellID);
+						CHECK_ECODE(status)
+						break;
+					default:
+						// Mixed cell types
+						// Mesh should be sorted into local, then global cells so loop over the initial range for local cells
+						I nCells = this->properties.lOCells;
+
+						for(I i = 0; i < nCells && cellID < 0; i++) {
+							// Part (a)
+							// Get the Cell Type from the number of vertices and faces
+							shapes::PolyhedronType pType = this->getCellPolyhedronType(i);
+
+							bool inside;
+
+							if(pType == shapes::POLYHEDRON_TETRAHEDRON) {
+								status = this->template isPointInsideCell<shapes::Tetrahedron<T>>(i, point, &inside);
+							}
+							else if(pType == shapes::POLYHEDRON_QUADPYRAMID) {
+								status = this->template isPointInsideCell<shapes::QuadPyramid<T>>(i, point, &inside);
+							}
+							else if(pType == shapes::POLYHEDRON_TRIPRISM) {
+								status = this->template isPointInsideCell<shapes::TriPrism<T>>(i, point, &inside);
+							}
+							else if(pType == shapes::POLYHEDRON_HEXAHEDRON) {
+								status = this->template isPointInsideCell<shapes::Hexahedron<T>>(i, point, &inside);
+							}
+							else if(pType == shapes::POLYHEDRON_GENERAL) {
+								status = this->template isPointInsideCell<shapes::GeneralPolyhedron<T>>(i, point, &inside);
+							}
+							else {
+								return cupcfd::error::E_ERROR;
+							}
+							CHECK_ECODE(status)
+
+							// (b) Test whether the position point is inside the cell - stored in 'inside'
+							// (bi) If so, the local ID is just position in loop
+							// (bii) If not, let loops continue
+							if(inside) {
+								cellID = i;
+							}
+						}
+						break;
+				}
+
+				// ToDo: Corner cases (point on edge, point on vertex)
+
+				if(cellID < 0) {
+					// No suitable cell was found in the loop
+					return cupcfd::error::E_GEOMETRY_NO_VALID_CELL;
+				}
+
+				*localCellID = cellID;
+
+				// Need to retrieve global ID from the connectivity graph
+				// Get the Node for the localID
+				L node;
+				status = this->cellConnGraph->connGraph.getLocalIndexNode(cellID, &node);
+				CHECK_ECODE(status)
+				*globalCellID = this->cellConnGraph->nodeToGlobal[node];
+
+				return cupcfd::error::E_SUCCESS;
 			}
 		
 		}
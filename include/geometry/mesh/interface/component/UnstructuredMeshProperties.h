@@ -30,6 +30,9 @@
 #define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_PROPERTIES_INCLUDE_H
 
 #include "Error.h"
+#include "Polyhedron.h"
+
+namespace shapes = cupcfd::geometry::shapes;
 
 namespace cupcfd
 {
@@ -41,29 +44,33 @@ namespace cupcfd
 			 * This class stores the general structural properties of
 			 * an unstructured mesh.
 			 *
+			 * The global counts are of the label type, since a mesh can have more faces or
+			 * vertices in total than the index type can count, even if each process does not.
+			 *
 			 * @tparam I Type of mesh index scheme
 			 * @tparam T Type of mesh euclidean space
+			 * @tparam L Type of mesh labels
 			 */
-			template <class I, class T>
+			template <class I, class T, class L>
 			class UnstructuredMeshProperties
 			{
 				public:
 					// === Members ===
 
 					/** Global Number of Cells in Mesh **/
-					I nCells;
+					L nCells;
 
 					/** Global Number of Faces in Mesh **/
-					I nFaces;
+					L nFaces;
 
 					/** Global Number of Vertices in Mesh **/
-					I nVertices;
+					L nVertices;
 
 					/** Global Number of Boundaries in Mesh **/
-					I nBoundaries;
+					L nBoundaries;
 
 					/** Global Number of Regions in Mesh **/
-					I nRegions;
+					L nRegions;
 
 					/** Maximum number of faces per cell **/
 					I nMaxFaces;
@@ -92,13 +99,27 @@ namespace cupcfd
 					/** Number of Local Regions on this process **/
 					I lRegions;
 
+					/**
+					 * Number of layers of ghost cells on this process. Faces between two ghost cells
+					 * are only permitted when this is greater than 1.
+					 **/
+					I haloDepth;
+
+					/**
+					 * The type of every cell on this process, if they are all the same fixed (non-general)
+					 * polyhedron type. Otherwise, this is POLYHEDRON_UNKNOWN.
+					 * This is set when the mesh is finalized.
+					 **/
+					shapes::PolyhedronType cellType;
+
 					// === Constructor/Deconstructors ===
 
 					/**
-					 * Default constructor. Sets up all properties to be zero.
+					 * Default constructor. Sets up all properties to be zero, with a halo depth of 1 and an unknown cell type.
 					 *
 					 * @tparam I Type of mesh index scheme
 					 * @tparam T Type of mesh euclidean space
+					 * @tparam L Type of mesh labels
 					 */
 					UnstructuredMeshProperties();
 
@@ -111,8 +132,9 @@ namespace cupcfd
 					 *
 					 * @tparam I Type of mesh index scheme
 					 * @tparam T Type of mesh euclidean space
+					 * @tparam L Type of mesh labels
 					 */
-					UnstructuredMeshProperties(UnstructuredMeshProperties<I,T>& source);
+					UnstructuredMeshProperties(UnstructuredMeshProperties<I,T,L>& source);
 
 					/**
 					 * Creates and initialises the values of the UnstructuredMeshProperties
@@ -133,11 +155,14 @@ namespace cupcfd
 					 * @param lBoundaries Number of local boundaries
 					 * @param lRegions Number of local regions
 					 *
+					 * The halo depth is set to 1.
+					 *
 					 * @tparam I Type of mesh index scheme
 					 * @tparam T Type of mesh euclidean space
+					 * @tparam L Type of mesh labels
 					 */
-					UnstructuredMeshProperties(I nCells, I nFaces, I nVertices, I nBoundaries,
-								   I nRegions, I nMaxFaces, T scaleFactor,
+					UnstructuredMeshProperties(L nCells, L nFaces, L nVertices, L nBoundaries,
+								   L nRegions, I nMaxFaces, T scaleFactor,
 								   I lOCells, I lGhCells, I lTCells, I lFaces,
 								   I lVertices, I lBoundaries, I lRegions);
 
@@ -146,6 +171,7 @@ namespace cupcfd
 					 *
 					 * @tparam I Type of mesh index scheme
 					 * @tparam T Type of mesh euclidean space
+					 * @tparam L Type of mesh labels
 					 */
 					~UnstructuredMeshProperties();
 
@@ -153,10 +179,11 @@ namespace cupcfd
 
 					/**
 					 * Reset the Mesh Properties Object to default values.
-					 * The default values for all variables is 0.
+					 * The default values for all variables is 0, other than the halo depth which is 1.
 					 *
 					 * @tparam I Type of mesh index scheme
 					 * @tparam T Type of mesh euclidean space
+					 * @tparam L Type of mesh labels
 					 */
 					void reset();
 
@@ -167,19 +194,21 @@ namespace cupcfd
 					 *
 					 * @tparam I Type of mesh index scheme
 					 * @tparam T Type of mesh euclidean space
+					 * @tparam L Type of mesh labels
 					 */
-					virtual void operator=(UnstructuredMeshProperties<I,T>& source);
+					virtual void operator=(UnstructuredMeshProperties<I,T,L>& source);
 
 					/**
 					 * Clone this object, creating a new object with the same values
 					 *
 					 * @tparam I Type of mesh index scheme
 					 * @tparam T Type of mesh euclidean space
+					 * @tparam L Type of mesh labels
 					 *
 					 * @return A pointer to the cloned object
 					 */
 					__attribute__((warn_unused_result))
-					virtual UnstructuredMeshProperties<I,T> * clone();
+					virtual UnstructuredMeshProperties<I,T,L> * clone();
 
 					// ToDo: Getters and setters
 			};
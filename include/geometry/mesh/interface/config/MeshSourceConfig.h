@@ -13,6 +13,8 @@
 #ifndef CUPCFD_CONFIG_MESH_SOURCE_CONFIG_INCLUDE_H
 #define CUPCFD_CONFIG_MESH_SOURCE_CONFIG_INCLUDE_H
 
+#include <cstdint>
+
 // Mesh Sources
 #include "MeshSource.h"
 
@@ -75,6 +77,19 @@ namespace cupcfd
 					 */
 					__attribute__((warn_unused_result))
 					virtual cupcfd::error::eCodes buildMeshSource(MeshSource<I,T,L> ** source) = 0;
+
+					/**
+					 * Compute a hash that identifies the mesh data this configuration describes, such that
+					 * a change to the configuration or to the data it refers to changes the hash.
+					 * Used to check whether a stored mesh snapshot was built from the same source.
+					 *
+					 * @param hash A pointer to where the hash will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @return cupcfd::error::E_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					virtual cupcfd::error::eCodes getSourceHash(uint64_t * hash) = 0;
 			};
 		}
 	}
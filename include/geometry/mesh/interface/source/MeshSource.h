@@ -44,6 +44,13 @@ namespace cupcfd
 			 * The remainder of the functions are designed around accessing, where available, data about
 			 * the mesh and its connections.
 			 *
+			 * Labels (including the cell, face, vertex, boundary and region labels returned for
+			 * connectivity data) and the total cell, face, boundary and vertex counts are of type L, while
+			 * counts and positions within the requested data are of type I. L can therefore be wider than I
+			 * (e.g. long) for meshes with more faces or vertices than a 32-bit label can address, while each
+			 * rank only handles a 32-bit sized portion. Cells are numbered globally with type I, so the total
+			 * cell count must still fit I.
+			 *
 			 * @tparam I The type of the indexing scheme
 			 * @tparam T The type of the mesh geometry data
 			 * @tparam L The type of the labels in the mesh source
@@ -147,7 +154,8 @@ namespace cupcfd
 					virtual cupcfd::error::eCodes getRegionLabels(L * labels, I nLabels, I * indexes, I nIndexes) = 0;
 
 					/**
-					 * Get the total number of cells in the mesh source
+					 * Get the total number of cells in the mesh source.
+					 * This is of the label type, since the total may exceed the index type.
 					 *
 					 * @param cellCount A pointer to the location where the cell count will be stored
 					 *
@@ -159,10 +167,11 @@ namespace cupcfd
 					 * @retval cupcfd::error::E_SOURCE_MISSING This data is missing from the source
 					 */
 					__attribute__((warn_unused_result))
-					virtual cupcfd::error::eCodes getCellCount(I * cellCount) = 0;
+					virtual cupcfd::error::eCodes getCellCount(L * cellCount) = 0;
 
 					/**
-					 * Get the total number of faces in the mesh source
+					 * Get the total number of faces in the mesh source.
+					 * This is of the label type, since the total may exceed the index type.
 					 *
 					 * @param faceCount A pointer to the location where the face count will be stored
 					 *
@@ -174,10 +183,11 @@ namespace cupcfd
 					 * @retval cupcfd::error::E_SOURCE_MISSING This data is missing from the source
 					 */
 					__attribute__((warn_unused_result))
-					virtual cupcfd::error::eCodes getFaceCount(I * faceCount) = 0;
+					virtual cupcfd::error::eCodes getFaceCount(L * faceCount) = 0;
 
 					/**
-					 * Get the total number of boundaries in the mesh source
+					 * Get the total number of boundaries in the mesh source.
+					 * This is of the label type, since the total may exceed the index type.
 					 *
 					 * @param boundaryCount A pointer to the location where the face count will be stored
 					 *
@@ -189,7 +199,7 @@ namespace cupcfd
 					 * @retval cupcfd::error::E_SOURCE_MISSING This data is missing from the source
 					 */
 					__attribute__((warn_unused_result))
-					virtual cupcfd::error::eCodes getBoundaryCount(I * boundaryCount) = 0;
+					virtual cupcfd::error::eCodes getBoundaryCount(L * boundaryCount) = 0;
 
 					/**
 					 * Get the total number of regions in the mesh source
@@ -207,7 +217,8 @@ namespace cupcfd
 					virtual cupcfd::error::eCodes getRegionCount(I * regionCount) = 0;
 
 					/**
-					 * Get the total number of vertices in the mesh source
+					 * Get the total number of vertices in the mesh source.
+					 * This is of the label type, since the total may exceed the index type.
 					 *
 					 * @param vertexCount A pointer to the location where the vertex count will be stored
 					 *
@@ -219,7 +230,7 @@ namespace cupcfd
 					 * @retval cupcfd::error::E_SOURCE_MISSING This data is missing from the source
 					 */
 					__attribute__((warn_unused_result))
-					virtual cupcfd::error::eCodes getVertexCount(I * vertexCount) = 0;
+					virtual cupcfd::error::eCodes getVertexCount(L * vertexCount) = 0;
 
 					/**
 					 * Get the maximum number of faces per cell stored in this mesh file
@@ -342,7 +353,7 @@ namespace cupcfd
 					 * @retval cupcfd::error::E_SOURCE_MISSING This data is missing from the source
 					 */
 					__attribute__((warn_unused_result))
-					virtual cupcfd::error::eCodes getCellFaceLabels(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData, L * cellLabels, I nCellLabels) = 0;
+					virtual cupcfd::error::eCodes getCellFaceLabels(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData, L * cellLabels, I nCellLabels) = 0;
 
 					/**
 					 * Determine whether the faces with the provided face labels are boundary faces.
@@ -390,7 +401,7 @@ namespace cupcfd
 					 * @retval cupcfd::error::E_ERROR One or more faces are not boundaries
 					 */
 					__attribute__((warn_unused_result))
-					virtual cupcfd::error::eCodes getFaceBoundaryLabels(I * faceBoundaryLabels, I nFaceBoundaryLabels, L * faceLabels, I nFaceLabels) = 0;
+					virtual cupcfd::error::eCodes getFaceBoundaryLabels(L * faceBoundaryLabels, I nFaceBoundaryLabels, L * faceLabels, I nFaceLabels) = 0;
 
 					/**
 					 * Get the cell label for the first cell attached to the faces with the provided face labels.
@@ -408,7 +419,7 @@ namespace cupcfd
 					 * @retval cupcfd::error::E_SOURCE_MISSING This data is missing from the source
 					 */
 					__attribute__((warn_unused_result))
-					virtual cupcfd::error::eCodes getFaceCell1Labels(I * faceCell1Labels, I nFaceCell1Labels, L * faceLabels, I nFaceLabels) = 0;
+					virtual cupcfd::error::eCodes getFaceCell1Labels(L * faceCell1Labels, I nFaceCell1Labels, L * faceLabels, I nFaceLabels) = 0;
 
 					/**
 					 * Get the cell labels for the 2nd cell attached to each face with a provided face label.
@@ -432,7 +443,7 @@ namespace cupcfd
 					 * @retval cupcfd::error::E_SOURCE_MISSING This data is missing from the source
 					 */
 					__attribute__((warn_unused_result))
-					virtual cupcfd::error::eCodes getFaceCell2Labels(I * faceCell2Labels, I nFaceCell2Labels, L * faceLabels, I nFaceLabels) = 0;
+					virtual cupcfd::error::eCodes getFaceCell2Labels(L * faceCell2Labels, I nFaceCell2Labels, L * faceLabels, I nFaceLabels) = 0;
 
 					/**
 					 * Retrieve the lambda for the faces with the provided labels.
@@ -509,7 +520,7 @@ namespace cupcfd
 					 * The vertices should be ordered such that is a an edge going from vertex[0] - > vertex[1], vertex[1]->vertex[2]... vertex[n-1]->vertex[0].
 					 */
 					__attribute__((warn_unused_result))
-					virtual cupcfd::error::eCodes getFaceVerticesLabelsCSR(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData,  L * faceLabels, I nFaceLabels) = 0;
+					virtual cupcfd::error::eCodes getFaceVerticesLabelsCSR(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData,  L * faceLabels, I nFaceLabels) = 0;
 
 					/**
 					 *
@@ -543,7 +554,7 @@ namespace cupcfd
 					 * @retval cupcfd::error::E_SOURCE_MISSING This data is missing from the source
 					 */
 					__attribute__((warn_unused_result))
-					virtual cupcfd::error::eCodes getBoundaryFaceLabels(I * boundaryFaceLabels, I nBoundaryFaceLabels, L * boundaryLabels, I nBoundaryLabels) = 0;
+					virtual cupcfd::error::eCodes getBoundaryFaceLabels(L * boundaryFaceLabels, I nBoundaryFaceLabels, L * boundaryLabels, I nBoundaryLabels) = 0;
 
 					/**
 					 *
@@ -566,14 +577,14 @@ namespace cupcfd
 					 * @retval cupcfd::error::E_SOURCE_MISSING This data is missing from the source
 					 */
 					__attribute__((warn_unused_result))
-					virtual cupcfd::error::eCodes getBoundaryRegionLabels(I * boundaryRegionLabels, I nBoundaryRegionLabels, L * boundaryLabels, I nBoundaryLabels) = 0;
+					virtual cupcfd::error::eCodes getBoundaryRegionLabels(L * boundaryRegionLabels, I nBoundaryRegionLabels, L * boundaryLabels, I nBoundaryLabels) = 0;
 
 					/**
 					 * Get the vertex labels associated with a face in a CSR format.
 					 * The vertices should be ordered such that is a an edge going from vertex[0] - > vertex[1], vertex[1]->vertex[2]... vertex[n-1]->vertex[0].
 					 */
 					__attribute__((warn_unused_result))
-					virtual cupcfd::error::eCodes getBoundaryVerticesLabelsCSR(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData,  L * faceLabels, I nFaceLabels) = 0;
+					virtual cupcfd::error::eCodes getBoundaryVerticesLabelsCSR(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData,  L * faceLabels, I nFaceLabels) = 0;
 
 					/**
 					 *
@@ -643,17 +654,48 @@ namespace cupcfd
 					 * mesh source
 					 * @param nCellLabels The size of cellLabels in the number of elements of type I
 					 *
-					 * @tparam I The type of the indexing scheme/node labels
+					 * @tparam I The type of the indexing scheme
 					 * @tparam T The type of the stored mesh data
+					 * @tparam L The type of the node labels
 					 *
 					 * @return An error status indicating the success or failure of the operation
 					 * @retval cupcfd::error::E_SUCCESS The method completed successfully
 					 */
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,I> ** graph,
+					cupcfd::error::eCodes buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,L> ** graph,
 																		cupcfd::comm::Communicator& comm,
 																		L * cellLabels, I nCellLabels);
 
+					/**
+					 * Build a Distributed Adjacency List Connectivity Graph from a Mesh Source as above,
+					 * but with a ghost halo that is haloDepth cells deep.
+					 *
+					 * The first layer of ghost cells are those that share a face with a cell owned by this rank,
+					 * the second layer are those that share a face with the first layer, and so on. Edges are added
+					 * between the cells of each layer and the cells of the next, but not between the cells of the outermost
+					 * layer. The ghost nodes of a finalized graph are stored in order of their layer, so the cells of a layer
+					 * occupy a contiguous range of local indexes.
+					 *
+					 * @param graph A pointer to where the newly created graph object pointer will be stored.
+					 * @param comm The communicator of all processes that will be members of the distributed graph
+					 * @param cellLabels The labels of the cells to be assigned to this process rank from the
+					 * mesh source
+					 * @param nCellLabels The size of cellLabels in the number of elements of type I
+					 * @param haloDepth The number of ghost cell layers (at least 1)
+					 *
+					 * @tparam I The type of the indexing scheme
+					 * @tparam T The type of the stored mesh data
+					 * @tparam L The type of the node labels
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+					 * @retval cupcfd::error::E_INVALID_INDEX The halo depth is less than 1
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,L> ** graph,
+																		cupcfd::comm::Communicator& comm,
+																		L * cellLabels, I nCellLabels, I haloDepth);
+
 					/**
 					 * Build a Distributed Adjacency List Connectivity Graph from a Mesh Source
 					 * that uses mesh cells as nodes and mesh faces as undirected edges.
@@ -683,14 +725,16 @@ namespace cupcfd
 					 * @param comm The communicator of all processes that will be members of the distributed graph
 					 * @param source The source of the mesh data that contains the connectivity information.
 					 *
-					 * @tparam I The type of the indexing scheme/node labels
+					 * @tparam I The type of the indexing scheme
 					 * @tparam T The type of the stored mesh data
+					 * @tparam L The type of the node labels
 					 *
 					 * @return An error status indicating the success or failure of the operation
 					 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+					 * @retval cupcfd::error::E_INVALID_INDEX The cell count of the source exceeds the range of the index type
 					 */
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,I> ** graph,
+					cupcfd::error::eCodes buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,L> ** graph,
 																		cupcfd::comm::Communicator& comm);
 			};
 		}
@@ -13,6 +13,8 @@
 #ifndef CUPCFD_GEOMETRY_MESH_SOURCE_IPP_H
 #define CUPCFD_GEOMETRY_MESH_SOURCE_IPP_H
 
+#include <limits>
+
 namespace cupcfd
 {
 	namespace geometry
@@ -20,9 +22,17 @@ namespace cupcfd
 		namespace mesh
 		{
 			template <class I, class T, class L>
-			cupcfd::error::eCodes MeshSource<I,T,L>::buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,I> ** graph,
+			cupcfd::error::eCodes MeshSource<I,T,L>::buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,L> ** graph,
 																					cupcfd::comm::Communicator& comm,
 																					L * cellLabels, I nCellLabels)
+			{
+				return this->buildDistributedAdjacencyList(graph, comm, cellLabels, nCellLabels, 1);
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSource<I,T,L>::buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,L> ** graph,
+																					cupcfd::comm::Communicator& comm,
+																					L * cellLabels, I nCellLabels, I haloDepth)
 			{
 				// This function builds a connectivity graph.
 				// The cell labels provided are the ones allocated to this process rank.
@@ -32,103 +42,132 @@ namespace cupcfd
 
 				cupcfd::error::eCodes status;
 
+				if(haloDepth < 1) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
 				// (1) Get Number of Cells
 				// In this case, the number of cells we are interested in is the portion stated by nCellLabels
 				I cellCount = nCellLabels;
 
-				*graph = new cupcfd::data_structures::DistributedAdjacencyList<I,I>(comm);
+				*graph = new cupcfd::data_structures::DistributedAdjacencyList<I,L>(comm);
 
 				// Only add cells if the number is greater than 0
 				if(cellCount > 0) {
 					// Let us ensure that the cells are added in a sorted order
-					I * sortedCellLabels = (I *) malloc(sizeof(I) * nCellLabels);
+					L * sortedCellLabels = (L *) malloc(sizeof(L) * nCellLabels);
 					status = cupcfd::utility::drivers::merge_sort(cellLabels, sortedCellLabels, nCellLabels);
 					CHECK_ECODE(status)
 
-					// (2) To get the face indexes, we need to know the number of adjacent faces
-					//     This is found from the sum of the adjacent face count for each cell listed (nFaces)
-					I * nFaces = (I *) malloc(sizeof(I) * cellCount);
-					status = this->getCellNFaces(nFaces, cellCount, sortedCellLabels, nCellLabels);
-					CHECK_ECODE(status)
+					// Add Local Nodes
+					for(I i = 0; i < cellCount; i++) {
+						status = (*graph)->addLocalNode(sortedCellLabels[i]);
+						CHECK_ECODE(status)
+					}
 
-					I numEdges;
-					cupcfd::utility::drivers::sum(nFaces, cellCount, &numEdges);
+					// The cells whose faces are added as edges in each pass - the local cells, then each layer of ghost cells
+					// short of the outermost layer. Track every cell seen so far so that the next layer only holds new cells.
+					std::vector<L> frontier(sortedCellLabels, sortedCellLabels + cellCount);
+					cupcfd::data_structures::FlatHashMap<L, bool> visited;
+					visited.reserve(cellCount);
 
-					// Free this now we no longerbuildDistributedAdjacencyList need it.
-					free(nFaces);
+					for(I i = 0; i < cellCount; i++) {
+						visited[sortedCellLabels[i]] = true;
+					}
 
-					// (3) Get Face Indexes, but only for the cells we are interested in.
-					// This should give us them in a CSR format
-					I * pos = (I *) malloc(sizeof(I) * (cellCount + 1));
-					I * data = (I *) malloc(sizeof(I) * numEdges);
-					status = this->getCellFaceLabels(pos, cellCount + 1, data, numEdges, sortedCellLabels, nCellLabels);
-					CHECK_ECODE(status)
+					free(sortedCellLabels);
 
-					// (4) We now need to find which cells are adjacent for the graph.
-					//     To do this, we need the cell1 and cell2 data from the face data,
-					//	   which details the global cell indexes either side of the face.
+					for(I layer = 0; layer < haloDepth && frontier.size() > 0; layer++) {
+						I frontierCount = cupcfd::utility::drivers::safeConvertSizeT<I>(frontier.size());
 
-					// We only need the face data for the faces attached to the requested cell data
-					// However, using the data array, there will be duplicates.
-					// We could remove them at this stage, but then we would have to update indexes so
-					// for the time being we will just load duplicates.
-					I * faceCell1 = (I *) malloc(sizeof(I) * numEdges);
-					I * faceCell2 = (I *) malloc(sizeof(I) * numEdges);
-					bool * faceIsBoundary = (bool *) malloc(sizeof(bool) * numEdges);
+						// (2) To get the face indexes, we need to know the number of adjacent faces
+						//     This is found from the sum of the adjacent face count for each cell listed (nFaces)
+						I * nFaces = (I *) malloc(sizeof(I) * frontierCount);
+						status = this->getCellNFaces(nFaces, frontierCount, &(frontier[0]), frontierCount);
+						CHECK_ECODE(status)
 
-					status = this->getFaceCell1Labels(faceCell1, numEdges, data, numEdges);
-					CHECK_ECODE(status)
+						I numEdges;
+						cupcfd::utility::drivers::sum(nFaces, frontierCount, &numEdges);
 
-					status = this->getFaceCell2Labels(faceCell2, numEdges, data, numEdges);
-					CHECK_ECODE(status)
+						// Free this now we no longer need it.
+						free(nFaces);
 
-					status = this->getFaceIsBoundary(faceIsBoundary, numEdges, data, numEdges);
-					CHECK_ECODE(status)
+						// (3) Get Face Indexes, but only for the cells we are interested in.
+						// This should give us them in a CSR format
+						I * pos = (I *) malloc(sizeof(I) * (frontierCount + 1));
+						L * data = (L *) malloc(sizeof(L) * numEdges);
+						status = this->getCellFaceLabels(pos, frontierCount + 1, data, numEdges, &(frontier[0]), frontierCount);
+						CHECK_ECODE(status)
 
-					// (5) Now we can start building the graph
-					// (a) First, we add the nodes (since this is the full dataset, it is just
-					//     a sequence from the base to the max index (in this file format, base index 1)
-					// (b) For each node, look up the attached faces, and then cross-reference with the
-					//     face cell1, cell2 data to find out what the other face is.
+						// (4) We now need to find which cells are adjacent for the graph.
+						//     To do this, we need the cell1 and cell2 data from the face data,
+						//	   which details the global cell indexes either side of the face.
 
-					// Add Local Nodes
-					for(I i = 0; i < cellCount; i++) {
-						status = (*graph)->addLocalNode(sortedCellLabels[i]);
+						// We only need the face data for the faces attached to the requested cell data
+						// However, using the data array, there will be duplicates.
+						// We could remove them at this stage, but then we would have to update indexes so
+						// for the time being we will just load duplicates.
+						L * faceCell1 = (L *) malloc(sizeof(L) * numEdges);
+						L * faceCell2 = (L *) malloc(sizeof(L) * numEdges);
+						bool * faceIsBoundary = (bool *) malloc(sizeof(bool) * numEdges);
+
+						status = this->getFaceCell1Labels(faceCell1, numEdges, data, numEdges);
+						CHECK_ECODE(status)
+
+						status = this->getFaceCell2Labels(faceCell2, numEdges, data, numEdges);
+						CHECK_ECODE(status)
+
+						status = this->getFaceIsBoundary(faceIsBoundary, numEdges, data, numEdges);
 						CHECK_ECODE(status)
-					}
 
-					// Add Edges
-					// Since we stored duplicate face data, the position of the face data in the faceCell1, faceCell2
-					// arrays is the same as the position in the 'data' array for cell face indexes
-					// I.e. we can loop over the faces instead of cells and just keep adding edges (at most we would try
-					// to add the same undirected edge twice)
-					// If we removed duplicate data to only store every face once, then we would have to store face indexes
-					// alongside and do a suitable search/lookup mechanism for every cell - this would use less memory but
-					// makes for more complex lookups. Since this is a distributed function, the extra memory overhead
-					// shouldn't be too much of an issue).
-
-					for(I i = 0; i < numEdges; i++) {
-						if(!(faceIsBoundary[i])) {
-							// Shouldn't matter if edge already exists, will just cause an error to be thrown without adding
-							// the edge again.
-							// If a node/cell is missing (i.e. not added as a local), the functionality of this method
-							// will add the node as a ghost node.
-							// ToDo: If this changes in the future we will need to revisit this.
-							status = (*graph)->addUndirectedEdge(faceCell1[i], faceCell2[i]);
-							if (status == cupcfd::error::E_SUCCESS || status == cupcfd::error::E_ADJACENCY_LIST_EDGE_EXISTS) {
-								continue;
-							} else {
-								CHECK_ECODE(status)
+						// (5) Now we can add the edges
+						// Since we stored duplicate face data, the position of the face data in the faceCell1, faceCell2
+						// arrays is the same as the position in the 'data' array for cell face indexes
+						// I.e. we can loop over the faces instead of cells and just keep adding edges (at most we would try
+						// to add the same undirected edge twice)
+						// If we removed duplicate data to only store every face once, then we would have to store face indexes
+						// alongside and do a suitable search/lookup mechanism for every cell - this would use less memory but
+						// makes for more complex lookups. Since this is a distributed function, the extra memory overhead
+						// shouldn't be too much of an issue).
+						std::vector<L> nextFrontier;
+
+						for(I i = 0; i < numEdges; i++) {
+							if(!(faceIsBoundary[i])) {
+								// Any cell not seen before belongs to the next layer
+								if(visited.find(faceCell1[i]) == visited.end()) {
+									visited[faceCell1[i]] = true;
+									nextFrontier.push_back(faceCell1[i]);
+								}
+
+								if(visited.find(faceCell2[i]) == visited.end()) {
+									visited[faceCell2[i]] = true;
+									nextFrontier.push_back(faceCell2[i]);
+								}
+
+								// Shouldn't matter if edge already exists, will just cause an error to be thrown without adding
+								// the edge again.
+								// If a node/cell is missing (i.e. not added as a local), the functionality of this method
+								// will add the node as a ghost node.
+								// ToDo: If this changes in the future we will need to revisit this.
+								status = (*graph)->addUndirectedEdge(faceCell1[i], faceCell2[i]);
+								if (status == cupcfd::error::E_SUCCESS || status == cupcfd::error::E_ADJACENCY_LIST_EDGE_EXISTS) {
+									continue;
+								} else {
+									CHECK_ECODE(status)
+								}
 							}
 						}
-					}
 
-					// Free up remaining temporary storage
-					free(faceCell1);
-					free(faceCell2);
-					free(faceIsBoundary);
-					free(pos);
-					free(data);
+						// Free up remaining temporary storage
+						free(faceCell1);
+						free(faceCell2);
+						free(faceIsBoundary);
+						free(pos);
+						free(data);
+
+						std::sort(nextFrontier.begin(), nextFrontier.end());
+						frontier.swap(nextFrontier);
+					}
 				}
 
 				// Finalize the Distributed Adjacency Graph so everyone is aware of their neighbours
@@ -139,7 +178,7 @@ namespace cupcfd
 			}
 
 			template <class I, class T, class L>
-			cupcfd::error::eCodes MeshSource<I,T,L>::buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,I> ** graph,
+			cupcfd::error::eCodes MeshSource<I,T,L>::buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,L> ** graph,
 																					cupcfd::comm::Communicator& comm)
 			{
 				cupcfd::error::eCodes status;
@@ -149,11 +188,19 @@ namespace cupcfd
 				// (a) Divide the mesh file evenly across the processes that make up the partitioner
 				// This likely won't make for a good edge allocation, but this function makes no promises
 				// about the setup.
+				L nGCellLabels;
 				I nGCells, nLCells, r;
 
-				status = this->getCellCount(&nGCells);
+				status = this->getCellCount(&nGCellLabels);
 				CHECK_ECODE(status)
 
+				// Cells are selected from the source by index, so the cell count must fit the index type
+				if(nGCellLabels > (L) std::numeric_limits<I>::max()) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				nGCells = (I) nGCellLabels;
+
 				// (b) Get the connectivity graph for this 'even' distribution
 				r = nGCells % comm.size;
 
@@ -183,7 +230,7 @@ namespace cupcfd
 				}
 
 				// Convert these cell indices into cell labels from the source
-				I * cellLabels = (I *) malloc(sizeof(I) * nLCells);
+				L * cellLabels = (L *) malloc(sizeof(L) * nLCells);
 				status = this->getCellLabels(cellLabels, nLCells, naiveLocalCells, nLCells);
 				CHECK_ECODE(status)
 
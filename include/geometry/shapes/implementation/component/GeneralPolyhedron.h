@@ -0,0 +1,152 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Declarations for the GeneralPolyhedron class
+ *
+ */
+
+#ifndef CUPCFD_GEOMETRY_SHAPES_GENERAL_POLYHEDRON_INCLUDE_H
+#define CUPCFD_GEOMETRY_SHAPES_GENERAL_POLYHEDRON_INCLUDE_H
+
+#include <vector>
+
+#include "Polygon3D.h"
+#include "Polyhedron.h"
+#include "EuclideanPoint.h"
+#include "EuclideanVector3D.h"
+
+namespace euc = cupcfd::geometry::euclidean;
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace shapes
+		{
+			/**
+			 * Stores geometry data for a polyhedron with any number of faces, where each face
+			 * may have any number of vertices (at least 3).
+			 *
+			 * This is used for cells that are not one of the fixed polyhedron types, such as
+			 * the cells of a polyhedral mesh. The faces are stored as the positions of their vertices,
+			 * face by face, in order of connecting edges. The orientation of each face is not important.
+			 *
+			 * The volume and centroid are computed by decomposing the polyhedron into tetrahedrons, each
+			 * formed from one edge of a face, the face centroid and the average of the face vertices.
+			 * This is exact for polyhedrons that are star-shaped about that average (including all
+			 * convex polyhedrons) with planar faces.
+			 *
+			 * @tparam T The numerical type
+			 */
+			template <class T>
+			class GeneralPolyhedron : public Polyhedron<GeneralPolyhedron<T>,T>
+			{
+				public:
+					// === Members ===
+
+					/** Positions of the vertices of each face, stored face by face **/
+					std::vector<euc::EuclideanPoint<T,3>> facePoints;
+
+					/** Offsets into facePoints for the vertices of each face (size nFaces + 1) **/
+					std::vector<int> faceXAdj;
+
+					// === Constructors/Deconstructors ===
+
+					/**
+					 * Construct a polyhedron from the vertex positions of its faces.
+					 *
+					 * @param facePoints The positions of the vertices of each face, face by face,
+					 * in order of connecting edges within each face
+					 * @param faceXAdj Offsets into facePoints for the vertices of each face (size nFaces + 1)
+					 * @param nFaces The number of faces
+					 */
+					GeneralPolyhedron(const euc::EuclideanPoint<T,3> * facePoints, const int * faceXAdj, int nFaces);
+
+					/**
+					 *
+					 */
+					~GeneralPolyhedron();
+
+					// === Concrete Methods ===
+
+					/**
+					 * @return The number of faces of the polyhedron
+					 */
+					inline int getNFaces() const;
+
+					/**
+					 * @param faceID The face (base 0)
+					 *
+					 * @return The number of vertices of the face
+					 */
+					inline int getFaceNVertices(int faceID) const;
+
+					/**
+					 * Return volume of the polyhedron, calculating if not known
+					 *
+					 * @return Polyhedron volume
+					 */
+					__attribute__((warn_unused_result))
+					T getVolume();
+
+					/**
+					 * Return centroid of the polyhedron, calculating if not known
+					 *
+					 * @return Polyhedron centroid
+					 */
+					__attribute__((warn_unused_result))
+					euc::EuclideanPoint<T,3> getCentroid();
+
+					/**
+					 * Determine whether the provided point is inside the polyhedron.
+					 * Edges/Faces/Vertices are treated as inside the polyhedron for this purpose.
+					 *
+					 * The point is tested against the plane of each face, so this is only exact
+					 * for convex polyhedrons.
+					 *
+					 * @param point The point to test
+					 *
+					 * @return Return true if the point exists inside this polyhedron
+					 */
+					__attribute__((warn_unused_result))
+					bool isPointInside(const euc::EuclideanPoint<T,3>& point);
+
+				protected:
+					/**
+					 * Compute the average of the face vertex positions, used as the apex of the
+					 * tetrahedron decomposition
+					 *
+					 * @return The average position
+					 */
+					euc::EuclideanPoint<T,3> computeVertexAverage();
+
+					/**
+					 * Compute the volume of this polyhedron
+					 *
+					 * @return The computed volume
+					 */
+					__attribute__((warn_unused_result))
+					T computeVolume();
+
+					/**
+					 * Compute the centroid of this polyhedron
+					 *
+					 * @return The computed centroid
+					 */
+					__attribute__((warn_unused_result))
+					euc::EuclideanPoint<T,3> computeCentroid();
+			};
+		}
+	}
+}
+
+// Include Header Level Definitions
+#include "GeneralPolyhedron.ipp"
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Header Level Definitions for the GeneralPolyhedron class
+ *
+ */
+
+#ifndef CUPCFD_GEOMETRY_SHAPES_GENERAL_POLYHEDRON_IPP_H
+#define CUPCFD_GEOMETRY_SHAPES_GENERAL_POLYHEDRON_IPP_H
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace shapes
+		{
+			// === Concrete Methods ===
+
+			template <class T>
+			inline int GeneralPolyhedron<T>::getNFaces() const {
+				return ((int) this->faceXAdj.size()) - 1;
+			}
+
+			template <class T>
+			inline int GeneralPolyhedron<T>::getFaceNVertices(int faceID) const {
+				return this->faceXAdj[faceID + 1] - this->faceXAdj[faceID];
+			}
+		}
+	}
+}
+
+#endif
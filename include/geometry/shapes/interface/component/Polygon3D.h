@@ -162,6 +162,53 @@ namespace cupcfd
 			template <class T>
 			__attribute__((warn_unused_result))
 			bool isVertexOrderClockwise(const euc::EuclideanPoint<T,3>& observation, euc::EuclideanPoint<T,3> * points, int nPoints);
+
+			/**
+			 * Compute the area of a planar polygon with any number of vertices, by summing the
+			 * triangles of a fan from the first vertex. Suitable for convex polygons, such as the
+			 * faces of a polyhedral mesh.
+			 *
+			 * @param points An array of the vertices of the polygon, in order of connecting edges.
+			 * Must be at least three vertices.
+			 * @param nPoints Number of points in points
+			 *
+			 * @return The area of the polygon
+			 */
+			template <class T>
+			__attribute__((warn_unused_result))
+			T computePolygonArea(const euc::EuclideanPoint<T,3> * points, int nPoints);
+
+			/**
+			 * Compute the centroid of a planar polygon with any number of vertices,
+			 * as the area-weighted average of the centroids of a fan of triangles from the first vertex.
+			 *
+			 * @param points An array of the vertices of the polygon, in order of connecting edges.
+			 * Must be at least three vertices.
+			 * @param nPoints Number of points in points
+			 *
+			 * @return The centroid of the polygon
+			 */
+			template <class T>
+			__attribute__((warn_unused_result))
+			euc::EuclideanPoint<T,3> computePolygonCentroid(const euc::EuclideanPoint<T,3> * points, int nPoints);
+
+			/**
+			 * Compute the unit normal of a polygon with any number of vertices using Newell's method,
+			 * which uses every vertex and so is robust to nearly collinear leading vertices and to
+			 * slightly non-planar polygons.
+			 *
+			 * The normal follows the right-hand rule for the vertex ordering, matching the
+			 * direction of the normal computed from the first three vertices for planar polygons.
+			 *
+			 * @param points An array of the vertices of the polygon, in order of connecting edges.
+			 * Must be at least three vertices.
+			 * @param nPoints Number of points in points
+			 *
+			 * @return The unit normal of the polygon
+			 */
+			template <class T>
+			__attribute__((warn_unused_result))
+			euc::EuclideanVector3D<T> computePolygonNormal(const euc::EuclideanPoint<T,3> * points, int nPoints);
 		}
 	}
 }
@@ -42,6 +42,7 @@ namespace cupcfd
 				POLYHEDRON_QUADPYRAMID,
 				POLYHEDRON_TRIPRISM,
 				POLYHEDRON_HEXAHEDRON,
+				POLYHEDRON_GENERAL,
 				POLYHEDRON_UNKNOWN
 			};
 
@@ -111,6 +112,44 @@ namespace cupcfd
 			 */
 			__attribute__((warn_unused_result))
 			inline PolyhedronType findPolyhedronType(int nVertices, int nFaces);
+
+			/**
+			 * Get an identifier for what type of polyhedron has the specified
+			 * number of vertices and faces, and the specified largest number of vertices
+			 * on any one face.
+			 *
+			 * Cells that do not match one of the fixed types (including any cell with a face
+			 * of more than 4 vertices) are identified as general polyhedra, as long as they
+			 * have enough vertices and faces to enclose a volume.
+			 *
+			 * @param nVertices The number of vertices of the polyhedron
+			 * @param nFaces The number of faces of the polyhedron
+			 * @param maxFaceNVertices The largest number of vertices on a face of the polyhedron
+			 *
+			 * @return An indentifier for the type of Polyhedron
+			 */
+			__attribute__((warn_unused_result))
+			inline PolyhedronType findPolyhedronType(int nVertices, int nFaces, int maxFaceNVertices);
+
+			/**
+			 * Get the number of faces of a fixed polyhedron type
+			 *
+			 * @param type The type of polyhedron
+			 *
+			 * @return The number of faces, or 0 if the type does not have a fixed number of faces
+			 */
+			__attribute__((warn_unused_result))
+			inline int getPolyhedronNFaces(PolyhedronType type);
+
+			/**
+			 * Get the number of vertices of a fixed polyhedron type
+			 *
+			 * @param type The type of polyhedron
+			 *
+			 * @return The number of vertices, or 0 if the type does not have a fixed number of vertices
+			 */
+			__attribute__((warn_unused_result))
+			inline int getPolyhedronNVertices(PolyhedronType type);
 		}
 	}
 }
@@ -84,6 +84,44 @@ namespace cupcfd
 					return POLYHEDRON_UNKNOWN;
 				}
 			}
+
+			inline PolyhedronType findPolyhedronType(int nVertices, int nFaces, int maxFaceNVertices) {
+				// The fixed types only have triangular or quadrilateral faces
+				if(maxFaceNVertices <= 4) {
+					PolyhedronType type = findPolyhedronType(nVertices, nFaces);
+
+					if(type != POLYHEDRON_UNKNOWN) {
+						return type;
+					}
+				}
+
+				// Anything else that can enclose a volume is treated as a general polyhedron
+				if(nVertices >= 4 && nFaces >= 4 && maxFaceNVertices >= 3) {
+					return POLYHEDRON_GENERAL;
+				}
+
+				return POLYHEDRON_UNKNOWN;
+			}
+
+			inline int getPolyhedronNFaces(PolyhedronType type) {
+				switch(type) {
+					case POLYHEDRON_TETRAHEDRON: return 4;
+					case POLYHEDRON_QUADPYRAMID: return 5;
+					case POLYHEDRON_TRIPRISM: return 5;
+					case POLYHEDRON_HEXAHEDRON: return 6;
+					default: return 0;
+				}
+			}
+
+			inline int getPolyhedronNVertices(PolyhedronType type) {
+				switch(type) {
+					case POLYHEDRON_TETRAHEDRON: return 4;
+					case POLYHEDRON_QUADPYRAMID: return 5;
+					case POLYHEDRON_TRIPRISM: return 6;
+					case POLYHEDRON_HEXAHEDRON: return 8;
+					default: return 0;
+				}
+			}
 		}
 	}
 }
@@ -123,6 +123,21 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes readData(int * sink);
 
+					/**
+					 * Read all data stored in the tracked HDF5Record into an array - long integer variant.
+					 *
+					 * Integer records stored with a narrower type are widened by HDF5 as they are read.
+					 *
+					 * Records that are 2D or greater will be flattened into a 1D array.
+					 *
+					 * @param sink The data array to store the data in.
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Operation was successful
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes readData(long * sink);
+
 					/**
 					 * Read all data stored in the tracked HDF5Record into an array - float variant.
 					 *
@@ -167,6 +182,26 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes readData(int * sink, HDF5Properties& properties);
 
+					/**
+					 * Read all data stored in the tracked HDF5Record into an array - long integer variant.
+					 *
+					 * Integer records stored with a narrower type are widened by HDF5 as they are read.
+					 *
+					 * Records that are 2D or greater will be flattened into a 1D array.
+					 *
+					 * This function restricts the data retrieved from the record to those indexes
+					 * specified in the properties object.
+					 *
+					 * @param sink The data array to store the data in.
+					 * @param properties A properties object for the record, specifying which
+					 * indexes to load
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Operation was successful
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes readData(long * sink, HDF5Properties& properties);
+
 					/**
 					 * Read all data stored in the tracked HDF5Record into an array - float variant.
 					 *
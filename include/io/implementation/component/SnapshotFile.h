@@ -0,0 +1,333 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the SnapshotFile class
+ */
+
+#ifndef CUPCFD_IO_SNAPSHOT_FILE_INCLUDE_H
+#define CUPCFD_IO_SNAPSHOT_FILE_INCLUDE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "FlatHashMap.h"
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace io
+	{
+		/**
+		 * Reads and writes a binary snapshot file - a sequence of arrays (sections) stored back to back,
+		 * intended for saving the state of a single rank so that it can be restored without rebuilding it.
+		 *
+		 * Layout:
+		 * (a) A fixed size header, containing a magic string, a format version, a set of keys supplied by
+		 *     the writer (e.g. a hash of the configuration the data was built from, the rank and the
+		 *     type sizes) and the location of the section table.
+		 * (b) The sections, in the order they were written. Each starts on a 64 byte boundary, so the
+		 *     arrays are suitably aligned for any element type once the file is mapped into memory.
+		 * (c) The section table - the offset and size in bytes of each section.
+		 *
+		 * Sections are read back in the order they were written. The reader maps the file into memory with
+		 * mmap rather than reading it, so only the pages that are used are loaded (from the page cache where
+		 * the file was read recently), and a section can be accessed in place without copying it.
+		 *
+		 * The arrays are stored in the native byte order and type sizes, so a snapshot can only be read
+		 * by a build with the same types - the writer should include the type sizes in the keys.
+		 *
+		 * The data is written to a temporary file which is renamed on closing, so a reader will never see
+		 * a partially written snapshot.
+		 */
+		class SnapshotFile
+		{
+			public:
+				// === Members ===
+
+				/** The number of keys stored in the header **/
+				static const int nKeys = 8;
+
+				/** The keys stored in the header. Set before closing a file for writing. **/
+				uint64_t keys[nKeys];
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Create a snapshot object with no file open
+				 */
+				SnapshotFile();
+
+				/**
+				 * Deconstructor. Closes (and discards) a file that is open for writing, and unmaps a
+				 * file that is open for reading.
+				 */
+				~SnapshotFile();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Open a snapshot file for writing. Nothing is visible at the path until closeWrite is called.
+				 *
+				 * @param fileName The path of the snapshot file
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The file was opened
+				 * @retval cupcfd::error::E_FILE_MISSING The file could not be created
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes openWrite(std::string fileName);
+
+				/**
+				 * Append a section to a file that is open for writing
+				 *
+				 * @param data The data of the section
+				 * @param nBytes The size of the section in bytes
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The section was written
+				 * @retval cupcfd::error::E_ERROR The file is not open for writing, or the write failed
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes writeSection(const void * data, std::size_t nBytes);
+
+				/**
+				 * Append an array as a section
+				 *
+				 * @param data The array
+				 * @param nEle The number of elements of type X in data
+				 *
+				 * @tparam X The element type. Must hold no pointers other than a vtable pointer.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The section was written
+				 * @retval cupcfd::error::E_ERROR The file is not open for writing, or the write failed
+				 */
+				template <class X>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes writeArray(const X * data, std::size_t nEle);
+
+				/**
+				 * Append the contents of a vector as a section
+				 *
+				 * @param data The vector
+				 *
+				 * @tparam X The element type. Must hold no pointers other than a vtable pointer.
+				 * @tparam A The allocator type of the vector
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The section was written
+				 * @retval cupcfd::error::E_ERROR The file is not open for writing, or the write failed
+				 */
+				template <class X, class A>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes writeVector(const std::vector<X,A>& data);
+
+				/**
+				 * Append the entries of a map as two sections - the keys, then the values
+				 *
+				 * @param data The map
+				 *
+				 * @tparam K The key type. Must have no pointers or virtual methods.
+				 * @tparam V The value type. Must have no pointers or virtual methods.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The sections were written
+				 * @retval cupcfd::error::E_ERROR The file is not open for writing, or the write failed
+				 */
+				template <class K, class V>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes writeMap(cupcfd::data_structures::FlatHashMap<K,V>& data);
+
+				/**
+				 * Append a set of strings as two sections - the offsets of each string, then their characters
+				 *
+				 * @param data The strings
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The sections were written
+				 * @retval cupcfd::error::E_ERROR The file is not open for writing, or the write failed
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes writeStrings(const std::vector<std::string>& data);
+
+				/**
+				 * Write the section table and header, and move the file into place at the path it was opened with.
+				 * The keys should be set before this is called.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The file was written
+				 * @retval cupcfd::error::E_ERROR The file is not open for writing, or the write failed
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes closeWrite();
+
+				/**
+				 * Open a snapshot file for reading, by mapping it into memory.
+				 * The keys are loaded from the header.
+				 *
+				 * @param fileName The path of the snapshot file
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The file was opened
+				 * @retval cupcfd::error::E_FILE_MISSING The file does not exist or could not be mapped
+				 * @retval cupcfd::error::E_INVALID_FILE_FORMAT The file is not a snapshot of a supported version,
+				 * or is truncated
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes openRead(std::string fileName);
+
+				/**
+				 * Get the next section of a file that is open for reading, without copying it.
+				 * The data remains valid until the file is closed.
+				 *
+				 * @param data A pointer to the location where the address of the section will be stored
+				 * @param nBytes A pointer to the location where the size of the section in bytes will be stored
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The section was found
+				 * @retval cupcfd::error::E_INVALID_FILE_FORMAT There are no more sections, or the file is not open
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes readSection(const void ** data, std::size_t * nBytes);
+
+				/**
+				 * Copy the next section into an array of known size
+				 *
+				 * @param data The array to copy into
+				 * @param nEle The number of elements of type X in data - must match the section
+				 *
+				 * @tparam X The element type
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The section was copied
+				 * @retval cupcfd::error::E_INVALID_FILE_FORMAT There are no more sections, or the size of the section
+				 * does not match
+				 */
+				template <class X>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes readArray(X * data, std::size_t nEle);
+
+				/**
+				 * Copy the next section into a vector, which is resized to the size of the section
+				 *
+				 * @param data The vector to copy into
+				 *
+				 * @tparam X The element type. Must be default constructible.
+				 * @tparam A The allocator type of the vector
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The section was copied
+				 * @retval cupcfd::error::E_INVALID_FILE_FORMAT There are no more sections, or the size of the section
+				 * is not a multiple of the element size
+				 */
+				template <class X, class A>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes readVector(std::vector<X,A>& data);
+
+				/**
+				 * Read a map written by writeMap, replacing the contents of data
+				 *
+				 * @param data The map to store the entries in
+				 *
+				 * @tparam K The key type
+				 * @tparam V The value type
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The map was read
+				 * @retval cupcfd::error::E_INVALID_FILE_FORMAT The sections are missing or do not match
+				 */
+				template <class K, class V>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes readMap(cupcfd::data_structures::FlatHashMap<K,V>& data);
+
+				/**
+				 * Read a set of strings written by writeStrings
+				 *
+				 * @param data The vector to store the strings in (resized)
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The strings were read
+				 * @retval cupcfd::error::E_INVALID_FILE_FORMAT The sections are missing or do not match
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes readStrings(std::vector<std::string>& data);
+
+				/**
+				 * Unmap a file that is open for reading. Sections that were accessed in place are no longer valid.
+				 */
+				void closeRead();
+
+				/**
+				 * @return The total size in bytes of the file that is open, including the header and table
+				 */
+				std::size_t getFileSize();
+
+				/**
+				 * Compute a 64-bit FNV-1a hash of a block of memory, e.g. for building the keys.
+				 * Hashes of several blocks can be combined by passing the previous hash as the seed.
+				 *
+				 * @param data The data to hash
+				 * @param nBytes The size of data in bytes
+				 * @param seed The hash to continue from
+				 *
+				 * @return The hash
+				 */
+				static uint64_t hashBytes(const void * data, std::size_t nBytes, uint64_t seed = UINT64_C(14695981039346656037));
+
+			private:
+				/** The path of the file **/
+				std::string fileName;
+
+				/** The file being written, nullptr if not writing **/
+				FILE * writeFile;
+
+				/** The offset and size of each section (2 entries per section) **/
+				std::vector<uint64_t> table;
+
+				/** The current size of the file being written, or the size of the mapped file **/
+				std::size_t fileSize;
+
+				/** The start of the mapped file, nullptr if not reading **/
+				char * mapped;
+
+				/** The index of the next section to read **/
+				std::size_t nextSection;
+
+				/**
+				 * Pad the file being written with zeros up to the next 64 byte boundary
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes pad();
+
+				/**
+				 * Copy elements out of a mapped section. Trivially copyable types are copied as a block,
+				 * other types are assigned element by element so that the destination objects keep their
+				 * own vtable pointers.
+				 *
+				 * @param dest The elements to copy into (already constructed)
+				 * @param source The elements in the mapped section
+				 * @param nEle The number of elements
+				 *
+				 * @tparam X The element type. Assignment must only copy data members.
+				 */
+				template <class X>
+				void copySection(X * dest, const X * source, std::size_t nEle);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "SnapshotFile.ipp"
+
+#endif
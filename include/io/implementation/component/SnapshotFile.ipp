@@ -0,0 +1,146 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the SnapshotFile class
+ */
+
+#ifndef CUPCFD_IO_SNAPSHOT_FILE_IPP_H
+#define CUPCFD_IO_SNAPSHOT_FILE_IPP_H
+
+#include <cstring>
+#include <type_traits>
+
+namespace cupcfd
+{
+	namespace io
+	{
+		template <class X>
+		cupcfd::error::eCodes SnapshotFile::writeArray(const X * data, std::size_t nEle) {
+			return this->writeSection((const void *) data, nEle * sizeof(X));
+		}
+
+		template <class X, class A>
+		cupcfd::error::eCodes SnapshotFile::writeVector(const std::vector<X,A>& data) {
+			return this->writeSection((const void *) data.data(), data.size() * sizeof(X));
+		}
+
+		template <class K, class V>
+		cupcfd::error::eCodes SnapshotFile::writeMap(cupcfd::data_structures::FlatHashMap<K,V>& data) {
+			cupcfd::error::eCodes status;
+
+			std::vector<K> mapKeys;
+			std::vector<V> mapValues;
+			mapKeys.reserve(data.size());
+			mapValues.reserve(data.size());
+
+			for(typename cupcfd::data_structures::FlatHashMap<K,V>::iterator it = data.begin(); it != data.end(); ++it) {
+				mapKeys.push_back(it->first);
+				mapValues.push_back(it->second);
+			}
+
+			status = this->writeVector(mapKeys);
+			CHECK_ECODE(status)
+
+			status = this->writeVector(mapValues);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class X>
+		cupcfd::error::eCodes SnapshotFile::readArray(X * data, std::size_t nEle) {
+			cupcfd::error::eCodes status;
+
+			const void * section;
+			std::size_t nBytes;
+
+			status = this->readSection(&section, &nBytes);
+			CHECK_ECODE(status)
+
+			if(nBytes != nEle * sizeof(X)) {
+				return cupcfd::error::E_INVALID_FILE_FORMAT;
+			}
+
+			this->copySection(data, (const X *) section, nEle);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class X, class A>
+		cupcfd::error::eCodes SnapshotFile::readVector(std::vector<X,A>& data) {
+			cupcfd::error::eCodes status;
+
+			const void * section;
+			std::size_t nBytes;
+
+			status = this->readSection(&section, &nBytes);
+			CHECK_ECODE(status)
+
+			if(nBytes % sizeof(X) != 0) {
+				return cupcfd::error::E_INVALID_FILE_FORMAT;
+			}
+
+			data.resize(nBytes / sizeof(X));
+			this->copySection(data.data(), (const X *) section, data.size());
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class X>
+		void SnapshotFile::copySection(X * dest, const X * source, std::size_t nEle) {
+			if(std::is_trivially_copyable<X>::value) {
+				std::memcpy((void *) dest, (const void *) source, nEle * sizeof(X));
+			}
+			else {
+				// The stored bytes include the vtable pointers of the writing process (e.g. for the
+				// CustomMPIType based Euclidean types), so only the data members are copied across
+				for(std::size_t i = 0; i < nEle; i++) {
+					dest[i] = source[i];
+				}
+			}
+		}
+
+		template <class K, class V>
+		cupcfd::error::eCodes SnapshotFile::readMap(cupcfd::data_structures::FlatHashMap<K,V>& data) {
+			cupcfd::error::eCodes status;
+
+			const void * keySection;
+			const void * valueSection;
+			std::size_t nKeyBytes;
+			std::size_t nValueBytes;
+
+			status = this->readSection(&keySection, &nKeyBytes);
+			CHECK_ECODE(status)
+
+			status = this->readSection(&valueSection, &nValueBytes);
+			CHECK_ECODE(status)
+
+			std::size_t nEntries = nKeyBytes / sizeof(K);
+
+			if(nKeyBytes % sizeof(K) != 0 || nValueBytes != nEntries * sizeof(V)) {
+				return cupcfd::error::E_INVALID_FILE_FORMAT;
+			}
+
+			// Sections start on a 64 byte boundary, so the entries can be read in place
+			const K * mapKeys = (const K *) keySection;
+			const V * mapValues = (const V *) valueSection;
+
+			data.clear();
+			data.reserve(nEntries);
+
+			for(std::size_t i = 0; i < nEntries; i++) {
+				data[mapKeys[i]] = mapValues[i];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+#endif
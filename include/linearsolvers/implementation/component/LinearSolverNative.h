@@ -0,0 +1,509 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the LinearSolverNative class
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_NATIVE_INCLUDE_H
+#define CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_NATIVE_INCLUDE_H
+
+#include <vector>
+
+// Base Class
+#include "LinearSolverInterface.h"
+
+// Data Structures
+#include "SparseMatrix.h"
+#include "SparseMatrixCSR.h"
+#include "DistributedSparseMatrix.h"
+
+// Error Codes
+#include "Error.h"
+
+// Parallel Communicator
+#include "Communicator.h"
+
+// Preconditioners
+#include "Preconditioner.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		/**
+		 * The selection of iterative methods available to the native solver.
+		 *
+		 * NATIVE_KSP_CG: Preconditioned Conjugate Gradient. Requires a symmetric positive definite matrix.
+		 * NATIVE_KSP_RICHARDSON: Preconditioned Richardson iteration - i.e. the preconditioner is used
+		 * standalone as a stationary iterative method/smoother.
+		 */
+		enum NativeAlgorithm
+		{
+			NATIVE_KSP_CG,
+			NATIVE_KSP_RICHARDSON
+		};
+
+		/**
+		 * The selection of preconditioners available to the native solver.
+		 */
+		enum NativePreconditioner
+		{
+			NATIVE_PC_NONE,
+			NATIVE_PC_SGS_MULTICOLOUR,
+			NATIVE_PC_ILU0
+		};
+
+		/**
+		 * Linear Solver that runs entirely within this library, without
+		 * any third-party solver dependencies.
+		 *
+		 * The matrix is copied into an internal SparseMatrixCSR, and the solve is threaded
+		 * across the cores available to a rank. When built from a SparseMatrix the solver is serial
+		 * per communicator (i.e. the communicator must be of size 1), and as such is suited to the
+		 * concurrent solver benchmarks where each rank solves its own copy of a system.
+		 *
+		 * When built from a DistributedSparseMatrix each rank only holds its own rows, using the local
+		 * column numbering of that matrix, and the system is solved in parallel across the communicator.
+		 * The ghost entries of the vectors are exchanged before each matrix product, dot products are
+		 * reduced across ranks, and the preconditioner is applied to the owned block of each rank
+		 * (i.e. block Jacobi). Mixed precision is not available in this mode.
+		 *
+		 * @tparam C The implementation class of the Sparse Matrix
+		 * @tparam I The type of the indexing system
+		 * @tparam T The data type of the matrix non-zero data
+		 */
+		template <class C, class I, class T>
+		class LinearSolverNative : public LinearSolverInterface<C,I,T>
+		{
+			public:
+				// === Members ===
+
+				/** Internal copy of the matrix, using a base index of zero **/
+				cupcfd::data_structures::SparseMatrixCSR<I,T> a;
+
+				/** Solution Vector **/
+				std::vector<T> x;
+
+				/** RHS Vector **/
+				std::vector<T> b;
+
+				/** Identify which iterative method to use **/
+				NativeAlgorithm algorithm;
+
+				/** Identify which preconditioner to use **/
+				NativePreconditioner preconType;
+
+				/** Preconditioner Object - nullptr if no preconditioner is in use **/
+				Preconditioner<I,T> * precon;
+
+				/** Relative tolerance (to the norm of b) of the residual norm **/
+				T rTol;
+
+				/** Absolute tolerance of the residual norm **/
+				T eTol;
+
+				/** Maximum number of iterations **/
+				I maxIterations;
+
+				/** Whether the matrix values have changed since the preconditioner was last updated **/
+				bool preconStale;
+
+				/** Number of iterations taken by the most recent solve **/
+				I iterations;
+
+				/** Residual norm at the end of the most recent solve **/
+				T residualNorm;
+
+				/** Workspace Vectors **/
+				std::vector<T> r, z, p, q;
+
+				/** Block workspace vectors, stored interleaved by row (i.e. entry (i, k) at i * nRHS + k) **/
+				std::vector<T> xBlock, bBlock, rBlock, zBlock, pBlock, qBlock;
+
+				/** Whether to solve by mixed-precision iterative refinement **/
+				bool mixedPrecision;
+
+				/** Maximum number of outer refinement steps when using mixed precision **/
+				I maxRefinements;
+
+				/** Relative tolerance of each single precision inner solve **/
+				T innerRTol;
+
+				/** Number of outer refinement steps taken by the most recent solve **/
+				I refinementSteps;
+
+				/**
+				 * Single precision solver used for the inner solves of mixed-precision refinement.
+				 * This holds the float copy of the matrix values, and is nullptr if mixed precision is not in use.
+				 **/
+				LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<I,float>, I, float> * inner;
+
+				/**
+				 * Distributed matrix that provides the row ownership and ghost columns of this rank.
+				 * This is not owned by the solver, and is nullptr if the solver holds the whole matrix.
+				 **/
+				cupcfd::data_structures::DistributedSparseMatrix<I,T> * distributed;
+
+				/** Number of rows held on this rank **/
+				I nLocalRows;
+
+				/** Number of columns held on this rank - owned entries followed by any ghost entries **/
+				I nLocalCols;
+
+				/** Global index (base 0) of the first row held on this rank **/
+				I rowStart;
+
+				/** Owned column block of the internal matrix, used by the preconditioner when distributed **/
+				cupcfd::data_structures::SparseMatrixCSR<I,T> aOwned;
+
+				/** Position in the internal matrix of each entry of the owned column block **/
+				std::vector<I> aOwnedEntries;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Create the linear solver object and setup the internal data structures (but not the data contents)
+				 *
+				 * The provided matrix is used to define the non-zero structure - its data contents are not transferred.
+				 * Subsequent matrices used to set values should possess the same non-zero structure.
+				 *
+				 * @param comm The communicator to be used for the linear solve. Must be of size 1.
+				 * @param algorithm The iterative method to use
+				 * @param preconType The preconditioner to use
+				 * @param rTol The relative tolerance to use
+				 * @param eTol The absolute tolerance to use
+				 * @param maxIterations The maximum number of iterations to use
+				 * @param matrix The matrix used to inform the non-zero data structure
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 */
+				LinearSolverNative(cupcfd::comm::Communicator& comm, NativeAlgorithm algorithm, NativePreconditioner preconType,
+								   T rTol, T eTol, I maxIterations,
+								   cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
+
+				/**
+				 * Create the linear solver object and setup the internal data structures (but not the data contents),
+				 * optionally using mixed-precision iterative refinement.
+				 *
+				 * In mixed-precision mode the residual and correction are computed in the precision T, while
+				 * the iterative method and preconditioner are run in single precision against a float copy
+				 * of the matrix values. This roughly halves the memory traffic of the inner iterations.
+				 *
+				 * @param comm The communicator to be used for the linear solve. Must be of size 1.
+				 * @param algorithm The iterative method to use for the (inner) solves
+				 * @param preconType The preconditioner to use for the (inner) solves
+				 * @param rTol The relative tolerance to use
+				 * @param eTol The absolute tolerance to use
+				 * @param maxIterations The maximum number of iterations to use per (inner) solve
+				 * @param mixedPrecision Whether to use mixed-precision iterative refinement
+				 * @param maxRefinements The maximum number of outer refinement steps
+				 * @param innerRTol The relative tolerance of each inner single precision solve
+				 * @param matrix The matrix used to inform the non-zero data structure
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 */
+				LinearSolverNative(cupcfd::comm::Communicator& comm, NativeAlgorithm algorithm, NativePreconditioner preconType,
+								   T rTol, T eTol, I maxIterations,
+								   bool mixedPrecision, I maxRefinements, T innerRTol,
+								   cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
+
+				/**
+				 * Create a linear solver object that solves in parallel across the ranks of a distributed matrix,
+				 * and setup the internal data structures (but not the data contents).
+				 *
+				 * Each rank holds the rows it owns in the distributed matrix. Vector indexes passed to the solver
+				 * remain global, but only the rows owned by this rank may be set or retrieved. The distributed
+				 * matrix must remain valid for as long as the solver is in use. Every rank must own at least one row.
+				 *
+				 * @param comm The communicator to be used for the linear solve. Must match the ranks of the matrix.
+				 * @param algorithm The iterative method to use
+				 * @param preconType The preconditioner to use, applied to the owned block of each rank
+				 * @param rTol The relative tolerance to use
+				 * @param eTol The absolute tolerance to use
+				 * @param maxIterations The maximum number of iterations to use
+				 * @param matrix The built distributed matrix used to inform the non-zero data structure
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 */
+				LinearSolverNative(cupcfd::comm::Communicator& comm, NativeAlgorithm algorithm, NativePreconditioner preconType,
+								   T rTol, T eTol, I maxIterations,
+								   cupcfd::data_structures::DistributedSparseMatrix<I,T>& matrix);
+
+				/**
+				 * Deconstructor
+				 */
+				~LinearSolverNative();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Compute y = Ax using the internal matrix
+				 *
+				 * @param xVec The vector to multiply
+				 * @param yVec The vector to store the result in
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 */
+				void multiply(const T * xVec, T * yVec);
+
+				/**
+				 * Compute y = Ax using the internal matrix, first updating the ghost entries of x if the
+				 * matrix is distributed. Rows that only use owned entries are computed while the exchange
+				 * is in progress.
+				 *
+				 * @param xVec The vector to multiply - sized to the local columns
+				 * @param yVec The vector to store the result in - sized to the local rows
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes multiplyExchange(T * xVec, T * yVec);
+
+				/**
+				 * Compute the residual r = b - Ax of the current solution and its norm across all ranks
+				 *
+				 * @param rNorm A pointer to the location to store the residual norm
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes computeResidual(T * rNorm);
+
+				/**
+				 * Compute Y = AX for a block of nVec vectors stored interleaved by row.
+				 * Each matrix entry is read once for all of the vectors.
+				 *
+				 * @param xBlk The block of vectors to multiply
+				 * @param yBlk The block of vectors to store the result in
+				 * @param nVec The number of vectors in each block
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 */
+				void multiplyBlock(const T * xBlk, T * yBlk, I nVec);
+
+				/**
+				 * Compute the dot product of two vectors sized to the number of rows, summed across ranks if distributed
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return The dot product
+				 */
+				T dot(const T * v1, const T * v2);
+
+				/**
+				 * Compute the dot products of matching columns of two blocks of nVec vectors stored interleaved by row
+				 *
+				 * @param uBlk The first block of vectors
+				 * @param vBlk The second block of vectors
+				 * @param nVec The number of vectors in each block
+				 * @param result An array of size nVec to store the dot product of each column pair in
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 */
+				void dotBlock(const T * uBlk, const T * vBlk, I nVec, T * result);
+
+				/**
+				 * Apply the preconditioner to each active column of a block of vectors stored interleaved by row
+				 *
+				 * @param rBlk The block of vectors to precondition
+				 * @param zBlk The block of vectors to store the result in
+				 * @param nVec The number of vectors in each block
+				 * @param active Which columns to apply the preconditioner to
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes applyPreconditionerBlock(T * rBlk, T * zBlk, I nVec, std::vector<bool>& active);
+
+				/**
+				 * Apply the preconditioner (or copy if no preconditioner is in use), z = M^-1 r
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes applyPreconditioner(T * rVec, T * zVec);
+
+				/**
+				 * Run the Preconditioned Conjugate Gradient method using the current x as the initial guess
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes solveCG();
+
+				/**
+				 * Run the Preconditioned Richardson method using the current x as the initial guess
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes solveRichardson();
+
+				/**
+				 * Run mixed-precision iterative refinement using the current x as the initial guess.
+				 *
+				 * Each step computes r = b - Ax in precision T, solves Ad = r in single precision
+				 * using the configured algorithm and preconditioner, and applies x = x + d in precision T.
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes solveMixedPrecision();
+
+				/**
+				 * Run the Preconditioned Conjugate Gradient method simultaneously for each right-hand-side of the
+				 * block, using the block X as the initial guesses. Each right-hand-side keeps its own
+				 * step lengths and convergence test, but the matrix products are shared.
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes solveMultiCG();
+
+				/**
+				 * Create the preconditioner object for the selected preconditioner type
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 */
+				void buildPreconditioner();
+
+				/**
+				 * Setup the non-zero structure of the internal matrix from the rows of the distributed matrix
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setupMatrixADistributed();
+
+				/**
+				 * Refresh the owned block and the single precision copy of the internal matrix
+				 * after its values have changed, and mark the preconditioners as stale.
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 */
+				void refreshMatrixA();
+
+				// === Overloaded Inherited Methods ===
+				void reset();
+				void resetVectorX();
+				void resetVectorB();
+				void resetMatrixA();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setupVectorX();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setupVectorB();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setupMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setup(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValuesVectorX(T scalar);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValuesVectorX(T * scalars, I nScalars, I * indexes, I nIndexes, I indexBase);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValuesVectorB(T scalar);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValuesVectorB(T * scalars, I nScalars, I * indexes, I nIndexes, I indexBase);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValuesMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValuesMatrixA(cupcfd::data_structures::DistributedSparseMatrix<I,T>& matrix);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getValuesVectorX(T ** result, I * nResult);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getValuesVectorX(T ** result, I * nResult, I * indexes, I nIndexes, I indexBase);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getValuesVectorB(T ** result, I * nResult);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getValuesVectorB(T ** result, I * nResult, I * indexes, I nIndexes, I indexBase);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getValuesMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes clearVectorX();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes clearVectorB();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes clearMatrixA();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes solve();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getSolveStatistics(I * iterations, I * refinementSteps);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes solveMulti();
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "LinearSolverNative.ipp"
+
+#endif
@@ -160,6 +160,8 @@ namespace cupcfd
 				cupcfd::error::eCodes clearMatrixA();
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes solve();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getSolveStatistics(I * iterations, I * refinementSteps);
 		};
 	}
 }
@@ -0,0 +1,136 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the PreconditionerILU0 class
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_PRECONDITIONER_ILU0_INCLUDE_H
+#define CUPCFD_LINEARSOLVERS_PRECONDITIONER_ILU0_INCLUDE_H
+
+#include <vector>
+
+#include "Error.h"
+#include "Preconditioner.h"
+#include "SparseMatrixCSR.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		/**
+		 * Incomplete LU factorisation with zero fill-in (ILU(0)), using level scheduling
+		 * for both the factorisation and the triangular solves.
+		 *
+		 * The factors L (unit lower) and U share the non-zero structure of the matrix, and
+		 * are stored together in a single value array. Rows are grouped into levels such that
+		 * a row only depends on rows in earlier levels - all rows in a level can then be
+		 * processed concurrently. Separate level schedules are kept for the lower (forward)
+		 * and upper (backward) dependencies.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The data type of the matrix non-zero data
+		 */
+		template <class I, class T>
+		class PreconditionerILU0 : public Preconditioner<I,T>
+		{
+			public:
+				// === Members ===
+
+				/** Combined L/U factor values, using the non-zero structure of the matrix **/
+				std::vector<T> LU;
+
+				/** Index into the LU array of the diagonal entry of each row **/
+				std::vector<I> diagIndex;
+
+				/** Number of levels in the lower triangular schedule **/
+				I nLowerLevels;
+
+				/** Offsets into lowerLevelRows for the rows in each lower level (size nLowerLevels + 1) **/
+				std::vector<I> lowerLevelXAdj;
+
+				/** Row indexes grouped by lower level **/
+				std::vector<I> lowerLevelRows;
+
+				/** Number of levels in the upper triangular schedule **/
+				I nUpperLevels;
+
+				/** Offsets into upperLevelRows for the rows in each upper level (size nUpperLevels + 1) **/
+				std::vector<I> upperLevelXAdj;
+
+				/** Row indexes grouped by upper level **/
+				std::vector<I> upperLevelRows;
+
+				/** Workspace for residuals when used as a smoother **/
+				std::vector<T> work;
+
+				/** Workspace for corrections when used as a smoother **/
+				std::vector<T> correction;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Constructor.
+				 *
+				 * Creates a preconditioner that is not yet setup against a matrix.
+				 */
+				PreconditionerILU0();
+
+				/**
+				 * Deconstructor
+				 */
+				~PreconditionerILU0();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Solve (LU)z = r using the current factors and level schedules.
+				 *
+				 * @param r The right-hand side
+				 * @param z The vector to store the result in. May not alias r.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The data type of the matrix non-zero data
+				 */
+				void triangularSolve(T * r, T * z);
+
+				// === Overridden Inherited Methods ===
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setup(cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes update();
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes apply(T * r, I nR, T * z, I nZ);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes smooth(T * b, I nB, T * x, I nX, I nSweeps);
+		};
+
+		/**
+		 * Group rows into levels from a per-row level number using a counting sort.
+		 *
+		 * @param levels The level of each row
+		 * @param nRows The number of rows
+		 * @param nLevels The number of levels
+		 * @param levelXAdj The vector to store the offsets of each level in (resized to nLevels + 1)
+		 * @param levelRows The vector to store the rows grouped by level in (resized to nRows)
+		 *
+		 * @tparam I The type of the indexing scheme
+		 */
+		template <class I>
+		void buildLevelSchedule(const I * levels, I nRows, I nLevels, std::vector<I>& levelXAdj, std::vector<I>& levelRows);
+	}
+}
+
+// Include Header Level Definitions
+#include "PreconditionerILU0.ipp"
+
+#endif
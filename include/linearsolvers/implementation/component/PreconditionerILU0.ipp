@@ -0,0 +1,43 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the header level definitions for the PreconditionerILU0 class
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_PRECONDITIONER_ILU0_IPP_H
+#define CUPCFD_LINEARSOLVERS_PRECONDITIONER_ILU0_IPP_H
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		template <class I>
+		void buildLevelSchedule(const I * levels, I nRows, I nLevels, std::vector<I>& levelXAdj, std::vector<I>& levelRows) {
+			levelXAdj.assign(nLevels + 1, 0);
+
+			for(I i = 0; i < nRows; i++) {
+				levelXAdj[levels[i] + 1] = levelXAdj[levels[i] + 1] + 1;
+			}
+
+			for(I l = 0; l < nLevels; l++) {
+				levelXAdj[l + 1] = levelXAdj[l + 1] + levelXAdj[l];
+			}
+
+			std::vector<I> insertPos(levelXAdj.begin(), levelXAdj.end() - 1);
+			levelRows.resize(nRows);
+
+			for(I i = 0; i < nRows; i++) {
+				levelRows[insertPos[levels[i]]] = i;
+				insertPos[levels[i]] = insertPos[levels[i]] + 1;
+			}
+		}
+	}
+}
+
+#endif
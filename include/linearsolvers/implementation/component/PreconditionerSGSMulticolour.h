@@ -0,0 +1,156 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the PreconditionerSGSMulticolour class
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_PRECONDITIONER_SGS_MULTICOLOUR_INCLUDE_H
+#define CUPCFD_LINEARSOLVERS_PRECONDITIONER_SGS_MULTICOLOUR_INCLUDE_H
+
+#include <vector>
+
+#include "Error.h"
+#include "Preconditioner.h"
+#include "SparseMatrixCSR.h"
+#include "DistributedAdjacencyList.h"
+#include "GraphColouring.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		/**
+		 * Multicolour Symmetric Gauss-Seidel preconditioner/smoother.
+		 *
+		 * Rows are grouped into colours such that no two rows of the same colour are
+		 * coupled by a non-zero entry. Each colour can then be relaxed concurrently, with
+		 * a forward sweep over the colours followed by a backward sweep.
+		 *
+		 * The colouring can either be provided directly, derived from the cell connectivity
+		 * graph of a DistributedAdjacencyList (where matrix rows match the local node indexes of
+		 * the locally owned nodes), or if neither is provided it is computed from the
+		 * non-zero structure of the matrix during setup.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The data type of the matrix non-zero data
+		 */
+		template <class I, class T>
+		class PreconditionerSGSMulticolour : public Preconditioner<I,T>
+		{
+			public:
+				// === Members ===
+
+				/** Number of colours in the current colouring **/
+				I nColours;
+
+				/** Offsets into colourRows for the rows of each colour (size nColours + 1) **/
+				std::vector<I> colourXAdj;
+
+				/** Row indexes (base zero) grouped by colour **/
+				std::vector<I> colourRows;
+
+				/** Index into the matrix A array of the diagonal entry of each row **/
+				std::vector<I> diagIndex;
+
+				/** Inverse of the diagonal entry of each row **/
+				std::vector<T> invDiag;
+
+				/** Whether the colouring was provided externally (and so should not be recomputed during setup) **/
+				bool userColouring;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Constructor.
+				 *
+				 * Creates a preconditioner with no colouring - unless one is provided prior to setup,
+				 * a colouring will be computed from the structure of the matrix.
+				 */
+				PreconditionerSGSMulticolour();
+
+				/**
+				 * Deconstructor
+				 */
+				~PreconditionerSGSMulticolour();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Set the colouring to use from an array of colours, one per row.
+				 * It is the responsibility of the caller to ensure that rows of the same
+				 * colour are not coupled in the matrix.
+				 *
+				 * @param colours The colour of each row (base zero). Colours must lie in the range 0 to nColours-1.
+				 * @param nRowColours The size of the colours array - the number of rows
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_INVALID_INDEX A colour was negative
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setColouring(I * colours, I nRowColours);
+
+				/**
+				 * Set the colouring using the connectivity of the locally owned nodes of a finalized
+				 * distributed graph (e.g. the cell graph of a mesh). Matrix rows are expected to
+				 * follow the local index ordering of the graph.
+				 *
+				 * Edges to ghost nodes are ignored, since these do not couple rows of the local matrix.
+				 *
+				 * @param graph The finalized distributed graph
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The data type of the matrix non-zero data
+				 * @tparam L The type of the node labels in the graph
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_DISTGRAPH_UNFINALIZED The graph has not been finalized
+				 */
+				template <class L>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setColouring(cupcfd::data_structures::DistributedAdjacencyList<I,L>& graph);
+
+				/**
+				 * Apply a single relaxation sweep over the colours in the order given.
+				 *
+				 * @param b The right-hand side vector
+				 * @param x The solution approximation, updated in place
+				 * @param forward Sweep the colours in ascending order if true, else descending order
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The data type of the matrix non-zero data
+				 */
+				void sweep(T * b, T * x, bool forward);
+
+				// === Overridden Inherited Methods ===
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setup(cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes update();
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes apply(T * r, I nR, T * z, I nZ);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes smooth(T * b, I nB, T * x, I nX, I nSweeps);
+		};
+
+	}
+}
+
+// Include Header Level Definitions
+#include "PreconditionerSGSMulticolour.ipp"
+
+#endif
@@ -0,0 +1,46 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the header level definitions for the PreconditionerSGSMulticolour class
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_PRECONDITIONER_SGS_MULTICOLOUR_IPP_H
+#define CUPCFD_LINEARSOLVERS_PRECONDITIONER_SGS_MULTICOLOUR_IPP_H
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		template <class I, class T>
+		template <class L>
+		cupcfd::error::eCodes PreconditionerSGSMulticolour<I,T>::setColouring(cupcfd::data_structures::DistributedAdjacencyList<I,L>& graph) {
+			cupcfd::error::eCodes status;
+
+			if(!graph.finalized) {
+				return cupcfd::error::E_DISTGRAPH_UNFINALIZED;
+			}
+
+			// Once finalized, the locally owned nodes occupy the first nLONodes local indexes
+			// of the connectivity graph, and the ghost nodes follow. Ghost nodes do not form rows
+			// in the local matrix, so restrict the colouring to the owned nodes.
+			I nNodes = graph.nLONodes;
+			cupcfd::data_structures::GraphColouring<I> colouring;
+
+			status = colouring.colourGraph(&(graph.connGraph.xadj[0]), &(graph.connGraph.adjncy[0]), nNodes, (I) 0, (I) 1, false);
+			CHECK_ECODE(status)
+
+			status = this->setColouring(colouring.colours.data(), nNodes);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,119 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the LinearSolverConfigNative class
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_CONFIG_NATIVE_INCLUDE_H
+#define CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_CONFIG_NATIVE_INCLUDE_H
+
+#include "Error.h"
+#include "LinearSolverNative.h"
+#include "SparseMatrix.h"
+
+#include "LinearSolverConfig.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		/**
+		 * Configuration for building a LinearSolverNative object
+		 */
+		template <class C, class I, class T>
+		class LinearSolverConfigNative : public LinearSolverConfig<C,I,T>
+		{
+			public:
+				// === Members ===
+
+				/** Identify which iterative method to use **/
+				NativeAlgorithm solverAlg;
+
+				/** Identify which preconditioner to use **/
+				NativePreconditioner preconType;
+
+				/** Relative tolerance **/
+				T rTol;
+
+				/** Absolute tolerance **/
+				T eTol;
+
+				/** Maximum number of iterations **/
+				I maxIterations;
+
+				/** Whether to use mixed-precision iterative refinement **/
+				bool mixedPrecision;
+
+				/** Maximum number of outer refinement steps **/
+				I maxRefinements;
+
+				/** Relative tolerance of each inner single precision solve **/
+				T innerRTol;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Create a configuration for a native linear solver
+				 *
+				 * @param solverAlg The iterative method to use
+				 * @param preconType The preconditioner to use
+				 * @param eTol The absolute tolerance
+				 * @param rTol The relative tolerance
+				 * @param maxIterations The maximum number of iterations
+				 */
+				LinearSolverConfigNative(NativeAlgorithm solverAlg, NativePreconditioner preconType, T eTol, T rTol, I maxIterations);
+
+				/**
+				 * Create a configuration for a native linear solver using mixed-precision iterative refinement
+				 *
+				 * @param solverAlg The iterative method to use for the inner solves
+				 * @param preconType The preconditioner to use for the inner solves
+				 * @param eTol The absolute tolerance
+				 * @param rTol The relative tolerance
+				 * @param maxIterations The maximum number of iterations per inner solve
+				 * @param mixedPrecision Whether to use mixed-precision iterative refinement
+				 * @param maxRefinements The maximum number of outer refinement steps
+				 * @param innerRTol The relative tolerance of each inner single precision solve
+				 */
+				LinearSolverConfigNative(NativeAlgorithm solverAlg, NativePreconditioner preconType, T eTol, T rTol, I maxIterations,
+										 bool mixedPrecision, I maxRefinements, T innerRTol);
+
+				/**
+				 * Copy Constructor
+				 */
+				LinearSolverConfigNative(const LinearSolverConfigNative<C,I,T>& source);
+
+				/**
+				 * Deconstructor
+				 */
+				~LinearSolverConfigNative();
+
+				// === Methods ===
+
+				void operator=(const LinearSolverConfigNative<C,I,T>& source);
+				__attribute__((warn_unused_result))
+				LinearSolverConfigNative<C,I,T> * clone();
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildLinearSolver(LinearSolverInterface<C,I,T> ** solverSystem,
+															 cupcfd::data_structures::SparseMatrix<C,I,T>& matrix,
+															 cupcfd::comm::Communicator& solverComm);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildLinearSolver(LinearSolverInterface<C,I,T> ** solverSystem,
+															 cupcfd::data_structures::DistributedSparseMatrix<I,T>& matrix);
+
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "LinearSolverConfigNative.ipp"
+
+#endif
@@ -70,6 +70,10 @@ namespace cupcfd
 															 cupcfd::data_structures::SparseMatrix<C,I,T>& matrix,
 															 cupcfd::comm::Communicator& solverComm);
 
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildLinearSolver(LinearSolverInterface<C,I,T> ** solverSystem,
+															 cupcfd::data_structures::DistributedSparseMatrix<I,T>& matrix);
+
 		};
 	}
 }
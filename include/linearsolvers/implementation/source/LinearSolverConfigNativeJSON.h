@@ -0,0 +1,142 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Declaration for the LinearSolverConfigNativeJSON class.
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_SOURCE_LINEAR_SOLVER_CONFIG_NATIVE_SOURCE_JSON_INCLUDE_H
+#define CUPCFD_LINEARSOLVERS_SOURCE_LINEAR_SOLVER_CONFIG_NATIVE_SOURCE_JSON_INCLUDE_H
+
+// C++ Std Lib
+#include <string>
+#include <vector>
+
+// Error Codes
+#include "Error.h"
+
+#include "LinearSolverConfigNative.h"
+#include "LinearSolverNative.h"
+
+#include "LinearSolverConfigSource.h"
+
+// JsonCPP - Supplied as standalone in include/io/jsoncpp
+#include "json.h"
+#include "json-forwards.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		/**
+		 * Defines a interface for accessing native linear solver configuration
+		 * options from a JSON data source.
+		 *
+		 * === Fields ===
+		 *
+		 * Required:
+		 * Algorithm: String. Accepted Values: "CG" , "Richardson"
+		 * Defines the iterative method to use for the linear solve
+		 * CG: Preconditioned Conjugate Gradient
+		 * Richardson: Preconditioned Richardson iteration (i.e. the preconditioner as a smoother)
+		 *
+		 * eTol: Floating Point Number.
+		 * Define the value of the eTolerance to use for the solve.
+		 *
+		 * rTol: Floating point Number
+		 * Define the value of the rTolerance to use for the solve.
+		 *
+		 * Optional:
+		 * Preconditioner: String. Accepted Values: "None", "SGSMulticolour", "ILU0"
+		 * Defaults to "None".
+		 *
+		 * MaxIterations: Integer.
+		 * Defaults to 10000. When using mixed precision this is the limit per inner solve.
+		 *
+		 * MixedPrecision: Boolean.
+		 * Solve by mixed-precision iterative refinement - the Algorithm and Preconditioner are run
+		 * in single precision, with the residual and correction computed in double precision.
+		 * Defaults to false.
+		 *
+		 * MaxRefinements: Integer.
+		 * The maximum number of outer refinement steps. Defaults to 50.
+		 *
+		 * InnerRTol: Floating Point Number.
+		 * The relative tolerance of each inner single precision solve. Defaults to 1e-4.
+		 */
+		template <class C, class I, class T>
+		class LinearSolverConfigNativeJSON : public LinearSolverConfigSource<C,I,T>
+		{
+			public:
+				// === Members ===
+
+				/** Json Data Store containing fields for this JSON source **/
+				Json::Value configData;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Parse the JSON record provided for values belonging to a Native Linear Solver entry
+				 *
+				 * @param parseJSON The contents of a JSON record with the appropriate fields
+				 */
+				LinearSolverConfigNativeJSON(Json::Value& parseJSON);
+
+				/**
+				 * Deconstructor
+				 */
+				~LinearSolverConfigNativeJSON();
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getNativeAlgorithm(NativeAlgorithm * solverAlg);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getNativePreconditioner(NativePreconditioner * preconType);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getETol(T * eTol);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getRTol(T * rTol);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getMaxIterations(I * maxIterations);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getMixedPrecision(bool * mixedPrecision);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getMaxRefinements(I * maxRefinements);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getInnerRTol(T * innerRTol);
+
+				// === Concrete Methods ===
+
+				/**
+				 * Build a LinearSolverConfigNative object from the JSON record
+				 *
+				 * @param linearSolverConfig A pointer to the location to store the pointer of the new config object
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND A required field is missing
+				 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE A field has an unrecognised value
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildLinearSolverConfig(LinearSolverConfig<C,I,T> ** linearSolverConfig);
+
+				// === Pure Virtual Methods ===
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "LinearSolverConfigNativeJSON.ipp"
+
+#endif
@@ -0,0 +1,24 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Header level definitions for the LinearSolverConfigNativeJSON class.
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_SOURCE_LINEAR_SOLVER_CONFIG_NATIVE_SOURCE_JSON_IPP_H
+#define CUPCFD_LINEARSOLVERS_SOURCE_LINEAR_SOLVER_CONFIG_NATIVE_SOURCE_JSON_IPP_H
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+	
+	}
+}
+
+#endif
@@ -13,8 +13,11 @@
 #ifndef CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_INTERFACE_INCLUDE_H
 #define CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_INTERFACE_INCLUDE_H
 
+#include <vector>
+
 #include "Error.h"
 #include "SparseMatrix.h"
+#include "DistributedSparseMatrix.h"
 #include "Communicator.h"
 
 namespace cupcfd
@@ -44,6 +47,21 @@ namespace cupcfd
 				/** Number of expected global columns in the matrix **/
 				I nGlobal;
 
+				/** Number of right-hand-sides currently set for a block solve **/
+				I nRHS;
+
+				/** Right-hand-sides of a block solve, stored per right-hand-side in the order of multiIndexes **/
+				std::vector<std::vector<T>> multiB;
+
+				/** Solutions of a block solve, stored per right-hand-side in the order of multiIndexes **/
+				std::vector<std::vector<T>> multiX;
+
+				/** Global row indexes of the values stored in multiB/multiX **/
+				std::vector<I> multiIndexes;
+
+				/** Base of the indexing scheme used in multiIndexes **/
+				I multiIndexBase;
+
 				// === Constructors/Deconstructors ===
 
 				/**
@@ -100,6 +118,113 @@ namespace cupcfd
 				 */
 				//cupcfd::error::eCodes resetTolerances();
 
+				/**
+				 * Set the right-hand-sides of a block solve against the current Matrix A.
+				 *
+				 * If the number of right-hand-sides or rows differs from the previous block, the
+				 * stored solutions are reset to zero for use as the initial guess.
+				 *
+				 * @param scalars An array of nRHS arrays, each holding nScalars values for one right-hand-side
+				 * @param nRHS The number of right-hand-sides
+				 * @param nScalars The size of each array in scalars
+				 * @param indexes The array of global indexes, detailing which rows each value belongs to
+				 * @param nIndexes The size of the indexes array
+				 * @param indexBase The base of the indexing scheme used in indexes (e.g indexed from 0 or 1)
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE nScalars and nIndexes differ
+				 * @retval cupcfd::error::E_INVALID_INDEX nRHS is not positive
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValuesVectorsB(T ** scalars, I nRHS, I nScalars, I * indexes, I nIndexes, I indexBase);
+
+				/**
+				 * Set the initial guesses of a block solve. The right-hand-sides must have been set first,
+				 * using the same rows.
+				 *
+				 * @param scalars An array of nRHS arrays, each holding nScalars values for one solution
+				 * @param nRHS The number of right-hand-sides
+				 * @param nScalars The size of each array in scalars
+				 * @param indexes The array of global indexes, detailing which rows each value belongs to
+				 * @param nIndexes The size of the indexes array
+				 * @param indexBase The base of the indexing scheme used in indexes (e.g indexed from 0 or 1)
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The sizes do not match the right-hand-sides
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR The rows do not match the right-hand-sides
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValuesVectorsX(T ** scalars, I nRHS, I nScalars, I * indexes, I nIndexes, I indexBase);
+
+				/**
+				 * Retrieve the solutions of the most recent block solve, in the row order used
+				 * when setting the right-hand-sides.
+				 *
+				 * @param results An array of nRHS pointers. Each is set to a newly allocated array of the
+				 * solution values for one right-hand-side, which the caller must free.
+				 * @param nRHS The size of the results array
+				 * @param nResult A pointer to the location to store the size of each result array
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE nRHS does not match the right-hand-sides
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getValuesVectorsX(T ** results, I nRHS, I * nResult);
+
+				/**
+				 * Solve for each of the right-hand-sides set by setValuesVectorsB against the current Matrix A.
+				 *
+				 * The default implementation solves each right-hand-side in turn through the vectors X and B,
+				 * overwriting their contents. Implementations may override this to share matrix accesses
+				 * between the right-hand-sides.
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR No right-hand-sides have been set
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes solveMulti();
+
+				/**
+				 * Set values in the internal matrix structure for the linear solver from the rows of a distributed
+				 * matrix owned by this rank.
+				 *
+				 * The default implementation copies the owned rows into a temporary matrix of the global size
+				 * using global indexes, and passes it to setValuesMatrixA. Implementations that hold the
+				 * distributed structure may override this to copy the local rows directly.
+				 *
+				 * @param matrix The built distributed matrix where values for the linear solver are sourced
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_UNFINALIZED The distributed matrix has not been built
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes setValuesMatrixA(cupcfd::data_structures::DistributedSparseMatrix<I,T>& matrix);
+
 				// === Pure Virtual Methods ===
 
 				/**
@@ -470,6 +595,24 @@ namespace cupcfd
 				 */
 				__attribute__((warn_unused_result))
 				virtual cupcfd::error::eCodes solve() = 0;
+
+				/**
+				 * Retrieve statistics about the most recent call to solve.
+				 *
+				 * @param iterations A pointer to the location to store the number of iterations
+				 * taken by the most recent solve (summed across all inner solves where refinement is used)
+				 * @param refinementSteps A pointer to the location to store the number of outer
+				 * refinement steps taken by the most recent solve (zero if refinement is not in use)
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes getSolveStatistics(I * iterations, I * refinementSteps) = 0;
 		};
 	}
 }
@@ -0,0 +1,149 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the Preconditioner class
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_PRECONDITIONER_INCLUDE_H
+#define CUPCFD_LINEARSOLVERS_PRECONDITIONER_INCLUDE_H
+
+#include "Error.h"
+#include "SparseMatrixCSR.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		/**
+		 * Interface for preconditioners that operate on a rank-local SparseMatrixCSR.
+		 *
+		 * A preconditioner is setup in two stages:
+		 * (a) setup - any work that depends only on the non-zero structure of the matrix
+		 * (e.g. colourings, level schedules, factor patterns). This only needs to be repeated
+		 * if the non-zero structure changes.
+		 * (b) update - any work that depends on the matrix values (e.g. inverse diagonals,
+		 * numeric factorisation). This must be repeated whenever the values of the matrix change.
+		 *
+		 * Once setup and updated, the preconditioner may be applied as z = M^-1 r, or used as
+		 * a smoother to improve an existing approximation to the solution of Ax = b.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The data type of the matrix non-zero data
+		 */
+		template <class I, class T>
+		class Preconditioner
+		{
+			public:
+				// === Members ===
+
+				/**
+				 * The matrix the preconditioner was last setup against.
+				 * This is not owned by the preconditioner, and must remain valid for as long
+				 * as the preconditioner is in use.
+				 */
+				cupcfd::data_structures::SparseMatrixCSR<I,T> * matrix;
+
+				/** Number of rows (and columns) of the square matrix the preconditioner was setup for **/
+				I nRows;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Constructor.
+				 *
+				 * Creates a preconditioner that is not yet setup against any matrix.
+				 */
+				Preconditioner();
+
+				/**
+				 * Deconstructor.
+				 */
+				virtual ~Preconditioner();
+
+				// === Pure Virtual Methods ===
+
+				/**
+				 * Build any internal data structures that depend upon the non-zero structure of the matrix.
+				 *
+				 * @param matrix The square matrix to precondition. A pointer to this matrix is retained
+				 * by the preconditioner.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX The matrix is not square or is missing
+				 * non-zero diagonal entries in its structure
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes setup(cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix) = 0;
+
+				/**
+				 * Recompute any internal data that depends upon the values of the matrix the preconditioner
+				 * was setup against. The non-zero structure of the matrix must not have changed since setup.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_PRECONDITIONER The preconditioner has not been setup
+				 * @retval cupcfd::error::E_LINEARSOLVER_ZERO_PIVOT A zero diagonal/pivot was encountered
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes update() = 0;
+
+				/**
+				 * Apply the preconditioner to a vector, computing z = M^-1 r.
+				 *
+				 * @param r The vector to precondition
+				 * @param nR The size of r. Must match the number of rows.
+				 * @param z The vector to store the result in
+				 * @param nZ The size of z. Must match the number of rows.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The vectors are not sized to the number of rows
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_PRECONDITIONER The preconditioner has not been setup
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes apply(T * r, I nR, T * z, I nZ) = 0;
+
+				/**
+				 * Use the preconditioner as a smoother, applying a number of sweeps to improve the
+				 * approximation x to the solution of Ax = b. x is used as the initial guess.
+				 *
+				 * @param b The right-hand side vector
+				 * @param nB The size of b. Must match the number of rows.
+				 * @param x The current approximation to the solution, updated in place
+				 * @param nX The size of x. Must match the number of rows.
+				 * @param nSweeps The number of smoothing sweeps to apply
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The data type of the matrix non-zero data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The vectors are not sized to the number of rows
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_PRECONDITIONER The preconditioner has not been setup
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes smooth(T * b, I nB, T * x, I nX, I nSweeps) = 0;
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "Preconditioner.ipp"
+
+#endif
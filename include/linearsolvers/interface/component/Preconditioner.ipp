@@ -0,0 +1,24 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the header level definitions for the Preconditioner class
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_PRECONDITIONER_IPP_H
+#define CUPCFD_LINEARSOLVERS_PRECONDITIONER_IPP_H
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+
+	}
+}
+
+#endif
@@ -15,6 +15,7 @@
 
 #include "Error.h"
 #include "SparseMatrix.h"
+#include "DistributedSparseMatrix.h"
 #include "LinearSolverInterface.h"
 #include "Communicator.h"
 
@@ -58,6 +59,21 @@ namespace cupcfd
 															 cupcfd::data_structures::SparseMatrix<C,I,T>& matrix,
 															 cupcfd::comm::Communicator& solverComm) = 0;
 
+				/**
+				 * Build a linear solver that solves in parallel across the ranks of a distributed matrix.
+				 * The communicator of the matrix is used for the solve.
+				 *
+				 * @param solverSystem A pointer to the location to store the new solver object
+				 * @param matrix The built distributed matrix used to inform the non-zero data structure.
+				 * Depending on the solver, this may need to remain valid for as long as the solver is in use.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The solver was built successfully
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes buildLinearSolver(LinearSolverInterface<C,I,T> ** solverSystem,
+															 cupcfd::data_structures::DistributedSparseMatrix<I,T>& matrix) = 0;
+
 		};
 	}
 }
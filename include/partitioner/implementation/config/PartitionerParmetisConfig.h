@@ -59,6 +59,8 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes buildPartitioner(PartitionerInterface<I,T> ** part,
 														cupcfd::data_structures::DistributedAdjacencyList<I,T>& partGraph);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getConfigHash(uint64_t * hash);
 		};
 	}
 }
@@ -13,6 +13,8 @@
 #ifndef CUPCFD_CONFIG_PARTITIONER_CONFIG_INCLUDE_H
 #define CUPCFD_CONFIG_PARTITIONER_CONFIG_INCLUDE_H
 
+#include <cstdint>
+
 #include "DistributedAdjacencyList.h"
 #include "PartitionerInterface.h"
 #include "PartitionerMethodConfig.h"
@@ -101,6 +103,25 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				virtual cupcfd::error::eCodes buildPartitioner(PartitionerInterface<I,T> ** part,
 																cupcfd::data_structures::DistributedAdjacencyList<I,T>& partGraph) = 0;
+
+				/**
+				 * Compute a hash that identifies the partitioner and the settings it is built with, such that
+				 * a change to the partitioning method or its settings changes the hash.
+				 * Used to check whether a stored mesh snapshot was partitioned in the same way.
+				 *
+				 * The number of parts is not included, since it is set by the size of the communicator
+				 * of the graph being partitioned.
+				 *
+				 * @param hash A pointer to where the hash will be stored
+				 *
+				 * @tparam I The indexing scheme of the partitioner.
+				 * @tparam T The datatype of the partitioner nodes.
+				 *
+				 * @return An error status indicating the success or failure of the operation.
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully.
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes getConfigHash(uint64_t * hash) = 0;
 		};
 	}
 }
@@ -35,7 +35,14 @@ namespace cupcfd
 	enum meshDataType
 	{
 		MESH_DATATYPE_MINIAOS,
-		MESH_DATATYPE_MINISOA
+		MESH_DATATYPE_MINISOA,
+		MESH_DATATYPE_MINIAOSOA
+	};
+
+	enum labelDataType
+	{
+		LABEL_DATATYPE_INT,
+		LABEL_DATATYPE_LONG
 	};
 
 	/**
@@ -73,6 +80,9 @@ namespace cupcfd
 
 			__attribute__((warn_unused_result))
 			cupcfd::error::eCodes getMeshSpecialisationType(meshDataType * dataType);
+
+			__attribute__((warn_unused_result))
+			cupcfd::error::eCodes getLabelDataType(labelDataType * dataType);
 	};
 }
 
@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the drivers of
+ * the process memory usage utility functions.
+ */
+
+#ifndef CUPCFD_UTILITY_MEMORY_DRIVERS_INCLUDE_H
+#define CUPCFD_UTILITY_MEMORY_DRIVERS_INCLUDE_H
+
+// Back large aligned allocations with transparent huge pages where the kernel supports them (default 0).
+#ifndef CUPCFD_ALIGNED_ALLOC_HUGE_PAGES
+#define CUPCFD_ALIGNED_ALLOC_HUGE_PAGES 0
+#endif
+
+#include <cstddef>
+#include <vector>
+
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace utility
+	{
+		namespace drivers
+		{
+			/**
+			 * Get the current resident set size (RSS) of this process, i.e. the amount of its
+			 * memory that is currently held in physical memory.
+			 *
+			 * This is read from /proc/self/statm, so is only available on Linux.
+			 *
+			 * @return The resident set size in bytes, or 0 if it could not be read
+			 */
+			inline std::size_t getCurrentRSS();
+
+			/**
+			 * Get the peak resident set size (RSS) of this process since it started (its high water mark).
+			 *
+			 * @return The peak resident set size in bytes, or 0 if it could not be read
+			 */
+			inline std::size_t getPeakRSS();
+
+			/**
+			 * Allocate uninitialised storage for an array, for use by kernels that are threaded with a
+			 * static OpenMP schedule.
+			 *
+			 * Allocations smaller than a page are aligned to a 64 byte cache line, larger ones to a page.
+			 * If CUPCFD_ALIGNED_ALLOC_HUGE_PAGES is set, allocations of at least a huge page (2MiB) are
+			 * aligned to one and marked as eligible for transparent huge pages.
+			 *
+			 * Allocations of at least a page are first touched in parallel, where element i is touched
+			 * by the thread that a schedule(static) loop over the nEle elements assigns it to. With a
+			 * first-touch NUMA policy, each page is then placed on the node of the thread that will use it.
+			 *
+			 * @param nEle The number of elements of type X
+			 *
+			 * @tparam X The element type
+			 *
+			 * @return The storage, which must be released with freeAligned, or nullptr if the allocation failed
+			 * (or nEle is 0)
+			 */
+			template <class X>
+			inline X * allocateAligned(std::size_t nEle);
+
+			/**
+			 * Release storage allocated by allocateAligned
+			 *
+			 * @param data The storage (may be nullptr)
+			 */
+			inline void freeAligned(void * data);
+
+			/**
+			 * Find the NUMA node that holds each page of a block of memory, using the query form of the
+			 * move_pages system call (no pages are moved, and libnuma/numactl are not required).
+			 *
+			 * @param data The start of the block
+			 * @param nBytes The size of the block in bytes
+			 * @param nodePages The number of pages of the block on each node, indexed by node (resized
+			 * as needed, and added to rather than overwritten, so that several blocks can be counted)
+			 * @param nUnplaced A pointer to a count that is increased by the number of pages of the block
+			 * that have not been touched yet, so are not on any node
+			 *
+			 * @return An error status indicating the success or failure of the operation
+			 * @retval cupcfd::error::E_SUCCESS The pages were counted
+			 * @retval cupcfd::error::E_ERROR The system call is not available (e.g. on a kernel without NUMA support)
+			 */
+			__attribute__((warn_unused_result))
+			inline cupcfd::error::eCodes getPageNodes(const void * data, std::size_t nBytes,
+														 std::vector<std::size_t>& nodePages, std::size_t * nUnplaced);
+
+			/**
+			 * Find the NUMA node that holds each page of the storage of a vector
+			 * (see getPageNodes(const void *, std::size_t, std::vector<std::size_t>&, std::size_t *)).
+			 *
+			 * @param data The vector
+			 * @param nodePages The number of pages on each node, indexed by node (added to)
+			 * @param nUnplaced A pointer to a count that is increased by the number of untouched pages
+			 *
+			 * @tparam X The element type
+			 * @tparam A The allocator type
+			 *
+			 * @return An error status indicating the success or failure of the operation
+			 * @retval cupcfd::error::E_SUCCESS The pages were counted
+			 * @retval cupcfd::error::E_ERROR The system call is not available
+			 */
+			template <class X, class A>
+			__attribute__((warn_unused_result))
+			inline cupcfd::error::eCodes getPageNodes(const std::vector<X,A>& data,
+														 std::vector<std::size_t>& nodePages, std::size_t * nUnplaced);
+		}
+	}
+}
+
+// Include Header Level Definitions
+#include "MemoryDrivers.ipp"
+
+#endif
@@ -0,0 +1,195 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ * Contains the definitions for the drivers of the
+ * process memory usage utility functions at a header level.
+ */
+
+#ifndef CUPCFD_UTILITY_MEMORY_DRIVERS_TPP_H
+#define CUPCFD_UTILITY_MEMORY_DRIVERS_TPP_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <cerrno>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+namespace cupcfd
+{
+	namespace utility
+	{
+		namespace drivers
+		{
+			inline std::size_t getCurrentRSS() {
+				FILE * file = fopen("/proc/self/statm", "r");
+
+				if(file == nullptr) {
+					return 0;
+				}
+
+				// The second field is the number of resident pages
+				long totalPages;
+				long residentPages;
+				int nRead = fscanf(file, "%ld %ld", &totalPages, &residentPages);
+				fclose(file);
+
+				long pageSize = sysconf(_SC_PAGESIZE);
+
+				if(nRead != 2 || residentPages < 0 || pageSize <= 0) {
+					return 0;
+				}
+
+				return ((std::size_t) residentPages) * ((std::size_t) pageSize);
+			}
+
+			inline std::size_t getPeakRSS() {
+				// Prefer the high water mark from /proc/self/status, since it is measured in the same way
+				// as getCurrentRSS
+				FILE * file = fopen("/proc/self/status", "r");
+
+				if(file != nullptr) {
+					char line[256];
+					long peakKB = -1;
+
+					while(fgets(line, sizeof(line), file) != nullptr) {
+						if(sscanf(line, "VmHWM: %ld kB", &peakKB) == 1) {
+							break;
+						}
+					}
+
+					fclose(file);
+
+					if(peakKB >= 0) {
+						return ((std::size_t) peakKB) * 1024;
+					}
+				}
+
+				struct rusage usage;
+
+				if(getrusage(RUSAGE_SELF, &usage) != 0 || usage.ru_maxrss < 0) {
+					return 0;
+				}
+
+				// Linux reports the peak in kilobytes
+				return ((std::size_t) usage.ru_maxrss) * 1024;
+			}
+
+			template <class X>
+			inline X * allocateAligned(std::size_t nEle) {
+				std::size_t nBytes = nEle * sizeof(X);
+
+				if(nBytes == 0) {
+					return nullptr;
+				}
+
+				std::size_t pageSize = (std::size_t) sysconf(_SC_PAGESIZE);
+				std::size_t hugePageSize = 2 * 1024 * 1024;
+				std::size_t alignment = 64;
+
+				if(nBytes >= pageSize) {
+					alignment = pageSize;
+				}
+
+				if(CUPCFD_ALIGNED_ALLOC_HUGE_PAGES && nBytes >= hugePageSize) {
+					alignment = hugePageSize;
+				}
+
+				if(alignment < alignof(X)) {
+					alignment = alignof(X);
+				}
+
+				void * data;
+
+				if(posix_memalign(&data, alignment, nBytes) != 0) {
+					return nullptr;
+				}
+
+				#ifdef MADV_HUGEPAGE
+					if(CUPCFD_ALIGNED_ALLOC_HUGE_PAGES && nBytes >= hugePageSize) {
+						// Advisory only, so a failure (e.g. THP disabled) is not an error
+						madvise(data, nBytes - (nBytes % hugePageSize), MADV_HUGEPAGE);
+					}
+				#endif
+
+				if(nBytes >= pageSize) {
+					// First touch with the same static schedule as the kernels. Touching one byte of each
+					// element is enough to place every page that the element spans.
+					volatile char * bytes = (volatile char *) data;
+
+					#pragma omp parallel for schedule(static)
+					for(std::size_t i = 0; i < nEle; i++) {
+						bytes[i * sizeof(X)] = 0;
+					}
+				}
+
+				return (X *) data;
+			}
+
+			inline void freeAligned(void * data) {
+				free(data);
+			}
+
+			inline cupcfd::error::eCodes getPageNodes(const void * data, std::size_t nBytes,
+														 std::vector<std::size_t>& nodePages, std::size_t * nUnplaced) {
+				if(data == nullptr || nBytes == 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				std::size_t pageSize = (std::size_t) sysconf(_SC_PAGESIZE);
+				std::size_t start = ((std::size_t) data) - (((std::size_t) data) % pageSize);
+				std::size_t end = ((std::size_t) data) + nBytes;
+				std::size_t nPages = (end - start + pageSize - 1) / pageSize;
+
+				// Query in batches to bound the size of the request
+				const std::size_t batchSize = 4096;
+				std::vector<void *> pages(batchSize);
+				std::vector<int> status(batchSize);
+
+				for(std::size_t batchStart = 0; batchStart < nPages; batchStart += batchSize) {
+					std::size_t nBatch = (nPages - batchStart < batchSize) ? nPages - batchStart : batchSize;
+
+					for(std::size_t i = 0; i < nBatch; i++) {
+						pages[i] = (void *) (start + ((batchStart + i) * pageSize));
+					}
+
+					// A null list of target nodes only reports the current node of each page
+					long err = syscall(SYS_move_pages, 0, (unsigned long) nBatch, pages.data(), NULL, status.data(), 0);
+
+					if(err != 0) {
+						return cupcfd::error::E_ERROR;
+					}
+
+					for(std::size_t i = 0; i < nBatch; i++) {
+						if(status[i] < 0) {
+							*nUnplaced = *nUnplaced + 1;
+						}
+						else {
+							if((std::size_t) status[i] >= nodePages.size()) {
+								nodePages.resize(status[i] + 1, 0);
+							}
+
+							nodePages[status[i]] = nodePages[status[i]] + 1;
+						}
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class X, class A>
+			inline cupcfd::error::eCodes getPageNodes(const std::vector<X,A>& data,
+														 std::vector<std::size_t>& nodePages, std::size_t * nUnplaced) {
+				return getPageNodes((const void *) data.data(), data.size() * sizeof(X), nodePages, nUnplaced);
+			}
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,195 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the BenchmarkFieldStore class.
+ */
+
+#include "BenchmarkFieldStore.h"
+
+#include <new>
+
+#include "ArrayKernels.h"
+#include "MemoryDrivers.h"
+
+namespace euc = cupcfd::geometry::euclidean;
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		template <class I, class T>
+		BenchmarkFieldStore<I,T>::BenchmarkFieldStore(I nCells, I nFaces, I nBoundaries, I nRegions) {
+			this->nEntities[FIELD_CELL] = nCells;
+			this->nEntities[FIELD_FACE] = nFaces;
+			this->nEntities[FIELD_BOUNDARY] = nBoundaries;
+			this->nEntities[FIELD_REGION] = nRegions;
+		}
+
+		template <class I, class T>
+		BenchmarkFieldStore<I,T>::~BenchmarkFieldStore() {
+			for(std::size_t i = 0; i < this->fields.size(); i++) {
+				if(this->fields[i].isVector) {
+					euc::EuclideanVector<T,3> * data = (euc::EuclideanVector<T,3> *) this->fields[i].data;
+
+					for(std::size_t j = 0; j < this->fields[i].nEle; j++) {
+						data[j].~EuclideanVector<T,3>();
+					}
+				}
+
+				cupcfd::utility::drivers::freeAligned(this->fields[i].data);
+			}
+		}
+
+		template <class I, class T>
+		int BenchmarkFieldStore<I,T>::findField(const std::string& name, BenchmarkFieldLocation location, bool isVector) {
+			for(std::size_t i = 0; i < this->fields.size(); i++) {
+				if(this->fields[i].location == location && this->fields[i].isVector == isVector && this->fields[i].name == name) {
+					return (int) i;
+				}
+			}
+
+			return -1;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkFieldStore<I,T>::addScalarField(std::string name, BenchmarkFieldLocation location, I nComponents) {
+			if(this->findField(name, location, false) >= 0 || this->findField(name, location, true) >= 0) {
+				return cupcfd::error::E_ERROR;
+			}
+
+			Field field;
+			field.name = name;
+			field.location = location;
+			field.isVector = false;
+			field.nEle = ((std::size_t) this->nEntities[location]) * ((std::size_t) nComponents);
+			field.data = (void *) cupcfd::utility::drivers::allocateAligned<T>(field.nEle);
+
+			if(field.data == nullptr && field.nEle > 0) {
+				return cupcfd::error::E_ERROR;
+			}
+
+			this->fields.push_back(field);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkFieldStore<I,T>::addVectorField(std::string name, BenchmarkFieldLocation location) {
+			if(this->findField(name, location, false) >= 0 || this->findField(name, location, true) >= 0) {
+				return cupcfd::error::E_ERROR;
+			}
+
+			Field field;
+			field.name = name;
+			field.location = location;
+			field.isVector = true;
+			field.nEle = (std::size_t) this->nEntities[location];
+
+			euc::EuclideanVector<T,3> * data = cupcfd::utility::drivers::allocateAligned<euc::EuclideanVector<T,3>>(field.nEle);
+
+			if(data == nullptr && field.nEle > 0) {
+				return cupcfd::error::E_ERROR;
+			}
+
+			// Construct the vectors in place, with the same schedule as the first touch
+			#pragma omp parallel for schedule(static)
+			for(std::size_t i = 0; i < field.nEle; i++) {
+				new (&data[i]) euc::EuclideanVector<T,3>();
+			}
+
+			field.data = (void *) data;
+			this->fields.push_back(field);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkFieldStore<I,T>::getScalarField(std::string name, BenchmarkFieldLocation location, T ** data) {
+			int index = this->findField(name, location, false);
+
+			if(index < 0) {
+				return cupcfd::error::E_SEARCH_NOT_FOUND;
+			}
+
+			*data = (T *) this->fields[index].data;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkFieldStore<I,T>::getVectorField(std::string name, BenchmarkFieldLocation location,
+																		euc::EuclideanVector<T,3> ** data) {
+			int index = this->findField(name, location, true);
+
+			if(index < 0) {
+				return cupcfd::error::E_SEARCH_NOT_FOUND;
+			}
+
+			*data = (euc::EuclideanVector<T,3> *) this->fields[index].data;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		void BenchmarkFieldStore<I,T>::initialise(T lower, T upper) {
+			std::vector<T> components;
+
+			for(std::size_t i = 0; i < this->fields.size(); i++) {
+				std::size_t nEle = this->fields[i].nEle;
+
+				if(this->fields[i].isVector) {
+					euc::EuclideanVector<T,3> * data = (euc::EuclideanVector<T,3> *) this->fields[i].data;
+
+					components.resize(3 * nEle);
+					cupcfd::utility::kernels::randomUniform(components.data(), 3 * nEle, lower, upper);
+
+					#pragma omp parallel for schedule(static)
+					for(std::size_t j = 0; j < nEle; j++) {
+						data[j].cmp[0] = components[3 * j];
+						data[j].cmp[1] = components[(3 * j) + 1];
+						data[j].cmp[2] = components[(3 * j) + 2];
+					}
+				}
+				else {
+					cupcfd::utility::kernels::randomUniform((T *) this->fields[i].data, nEle, lower, upper);
+				}
+			}
+		}
+
+		template <class I, class T>
+		I BenchmarkFieldStore<I,T>::getNEntities(BenchmarkFieldLocation location) {
+			return this->nEntities[location];
+		}
+
+		template <class I, class T>
+		I BenchmarkFieldStore<I,T>::getNFields() {
+			return (I) this->fields.size();
+		}
+
+		template <class I, class T>
+		std::size_t BenchmarkFieldStore<I,T>::getNBytes() {
+			std::size_t nBytes = 0;
+
+			for(std::size_t i = 0; i < this->fields.size(); i++) {
+				if(this->fields[i].isVector) {
+					nBytes = nBytes + (this->fields[i].nEle * sizeof(euc::EuclideanVector<T,3>));
+				}
+				else {
+					nBytes = nBytes + (this->fields[i].nEle * sizeof(T));
+				}
+			}
+
+			return nBytes;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::benchmark::BenchmarkFieldStore<int, float>;
+template class cupcfd::benchmark::BenchmarkFieldStore<int, double>;
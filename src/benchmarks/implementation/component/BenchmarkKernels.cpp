@@ -15,8 +15,11 @@
 #include "tt_interface_c.h"
 #include "CupCfdAoSMesh.h"
 #include "CupCfdSoAMesh.h"
+#include "CupCfdAoSoAMesh.h"
 
 #include <cstdlib>
+#include <algorithm>
+#include <limits>
 
 #include "ArrayKernels.h"
 
@@ -26,6 +29,13 @@
 #include "ScalarKernels.h"
 #include "UVWKernels.h"
 #include "ViscosityKernels.h"
+#include "ResidualKernels.h"
+
+#include "FaceMatrixAssembler.h"
+#include "SparseMatrixCSR.h"
+
+#include "mpi.h"
+#include "MemoryDrivers.h"
 
 namespace cupcfd
 {
@@ -36,19 +46,70 @@ namespace cupcfd
 																			std::shared_ptr<cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>> meshPtr,
 																			I repetitions)
 		: Benchmark<I,T>(benchmarkName, repetitions),
-		  meshPtr(meshPtr)
+		  meshPtr(meshPtr),
+		  fields(nullptr)
 		{
 
 		}
 
 		template <class M, class I, class T, class L>
 		BenchmarkKernels<M,I,T,L>::~BenchmarkKernels() {
-
+			delete this->fields;
 		}
 
 		template <class M, class I, class T, class L>
 		void BenchmarkKernels<M,I,T,L>::setupBenchmark() {
-			// Nothing to currently do here
+			cupcfd::error::eCodes status;
+
+			if(this->fields != nullptr) {
+				return;
+			}
+
+			this->fields = new BenchmarkFieldStore<I,T>(meshPtr->properties.lTCells,
+														meshPtr->properties.lFaces,
+														meshPtr->properties.lBoundaries,
+														meshPtr->properties.lRegions);
+
+			// Fields used by the kernels, by location
+			const char * cellScalars[] = {"Phi", "Den", "U", "V", "W", "P", "Ar", "Su", "Sv", "Sw", "Au", "Av", "Aw",
+										  "TE", "ED", "VisEff", "T", "X", "B", "R"};
+			const char * cellVectors[] = {"dPhidx", "dPhidxo", "dUdx", "dVdx", "dWdx", "dPdx"};
+			const char * boundaryScalars[] = {"Phi", "Den", "U", "V", "W", "TE", "ED", "VisEff", "T", "Cp"};
+			const char * regionScalars[] = {"FlowRegion", "FlowFact"};
+
+			bool failed = false;
+
+			for(std::size_t i = 0; i < sizeof(cellScalars) / sizeof(cellScalars[0]); i++) {
+				status = this->fields->addScalarField(cellScalars[i], FIELD_CELL);
+				failed = failed || (status != cupcfd::error::E_SUCCESS);
+			}
+
+			for(std::size_t i = 0; i < sizeof(cellVectors) / sizeof(cellVectors[0]); i++) {
+				status = this->fields->addVectorField(cellVectors[i], FIELD_CELL);
+				failed = failed || (status != cupcfd::error::E_SUCCESS);
+			}
+
+			for(std::size_t i = 0; i < sizeof(boundaryScalars) / sizeof(boundaryScalars[0]); i++) {
+				status = this->fields->addScalarField(boundaryScalars[i], FIELD_BOUNDARY);
+				failed = failed || (status != cupcfd::error::E_SUCCESS);
+			}
+
+			for(std::size_t i = 0; i < sizeof(regionScalars) / sizeof(regionScalars[0]); i++) {
+				status = this->fields->addScalarField(regionScalars[i], FIELD_REGION);
+				failed = failed || (status != cupcfd::error::E_SUCCESS);
+			}
+
+			status = this->fields->addScalarField("MassFlux", FIELD_FACE);
+			failed = failed || (status != cupcfd::error::E_SUCCESS);
+
+			// Two interpolation factors per face
+			status = this->fields->addScalarField("RFace", FIELD_FACE, 2);
+			failed = failed || (status != cupcfd::error::E_SUCCESS);
+
+			if(failed) {
+				delete this->fields;
+				this->fields = nullptr;
+			}
 		}
 
 		template <class M, class I, class T, class L>
@@ -61,7 +122,28 @@ namespace cupcfd
 			// Track Number of Repetitions
 			TreeTimerLogParameterInt("Repetitions", this->repetitions);
 
+			// Allocate the fields once, outside of the kernel timings
+			TreeTimerEnterBlockMethod("KernelFieldAllocation");
+			this->setupBenchmark();
+
+			if(this->fields != nullptr) {
+				TreeTimerLogParameterInt("FieldCount", this->fields->getNFields());
+				TreeTimerLogParameterDouble("FieldBytes", (double) this->fields->getNBytes());
+			}
+
+			TreeTimerExitBlock("KernelFieldAllocation");
+
+			if(this->fields == nullptr) {
+				this->stopBenchmarkBlock(this->benchmarkName);
+				return cupcfd::error::E_ERROR;
+			}
+
 			for(int i = 0; i < this->repetitions; i++) {
+				// Refill the fields, timed separately from the kernels that use them
+				TreeTimerEnterBlockMethod("KernelFieldInitialisation");
+				this->fields->initialise((T) 1E-6, (T) 1E-2);
+				TreeTimerExitBlock("KernelFieldInitialisation");
+
 				// Run each individual kernel benchmark
 				status = this->GradientPhiGaussDolfynBenchmark();
 				CHECK_ECODE(status)
@@ -107,6 +189,9 @@ namespace cupcfd
 
 				status = this->calculateViscosityDolfynCellLoop2Benchmark();
 				CHECK_ECODE(status)
+
+				status = this->ResidualCSRBenchmark();
+				CHECK_ECODE(status)
 			}
 
 			this->stopBenchmarkBlock(this->benchmarkName);
@@ -145,22 +230,24 @@ namespace cupcfd
 			I nGradient = 1;
 
 			// Create Random Phi Data for Cells
-			T * phiCell = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(phiCell, nCells, (T) 1E-6 , (T) 1E-2);
+			T * phiCell;
+			status = this->fields->getScalarField("Phi", FIELD_CELL, &phiCell);
+			CHECK_ECODE(status)
 
 			// Create RandomPhi Data for Boundaries
-			T * phiBoundaries = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(phiBoundaries, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * phiBoundaries;
+			status = this->fields->getScalarField("Phi", FIELD_BOUNDARY, &phiBoundaries);
+			CHECK_ECODE(status)
 
 			// Kernel will zero these arrays regardless of contents
-			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell =
-					(cupcfd::geometry::euclidean::EuclideanVector<T,3> *)
-					malloc(sizeof(cupcfd::geometry::euclidean::EuclideanVector<T,3>) * nCells);
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell;
+			status = this->fields->getVectorField("dPhidx", FIELD_CELL, &dPhidxCell);
+			CHECK_ECODE(status)
 
 			// Kernel will zero these arrays regardless of contents
-			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell =
-					(cupcfd::geometry::euclidean::EuclideanVector<T,3> *)
-					malloc(sizeof(cupcfd::geometry::euclidean::EuclideanVector<T,3>) * nCells);
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell;
+			status = this->fields->getVectorField("dPhidxo", FIELD_CELL, &dPhidxoCell);
+			CHECK_ECODE(status)
 
 			// Start Timer
 			TreeTimerEnterBlockMethod("GradientPhiGaussDolfynBenchmark");
@@ -175,7 +262,8 @@ namespace cupcfd
 
 			// ToDo: Should add a configuration option to repeat the kernel X times per timing
 			// to reduce impact of overheads at small cell/face counts
-			status = cupcfd::fvm::GradientPhiGaussDolfyn(*meshPtr, nGradient,
+			// Pass the concrete mesh type, so that a mesh specific version of the kernel is used where one exists
+			status = cupcfd::fvm::GradientPhiGaussDolfyn(static_cast<M&>(*meshPtr), nGradient,
 														phiCell, nCells,
 														phiBoundaries, nBnds,
 														dPhidxCell, nCells,
@@ -185,10 +273,6 @@ namespace cupcfd
 			// Stop Timer
 			TreeTimerExitBlock("GradientPhiGaussDolfynBenchmark");
 
-			free(phiCell);
-			free(phiBoundaries);
-			free(dPhidxCell);
-			free(dPhidxoCell);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -204,46 +288,61 @@ namespace cupcfd
 			I nFaces = meshPtr->properties.lFaces;
 			I nRegions = meshPtr->properties.lRegions;
 
-			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx =
-					(cupcfd::geometry::euclidean::EuclideanVector<T,3> *) malloc(sizeof(cupcfd::geometry::euclidean::EuclideanVector<T,3>) * nCells);
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx;
+			status = this->fields->getVectorField("dUdx", FIELD_CELL, &dudx);
+			CHECK_ECODE(status)
 
-			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx =
-					(cupcfd::geometry::euclidean::EuclideanVector<T,3> *) malloc(sizeof(cupcfd::geometry::euclidean::EuclideanVector<T,3>) * nCells);
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx;
+			status = this->fields->getVectorField("dVdx", FIELD_CELL, &dvdx);
+			CHECK_ECODE(status)
 
-			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx =
-					(cupcfd::geometry::euclidean::EuclideanVector<T,3> *) malloc(sizeof(cupcfd::geometry::euclidean::EuclideanVector<T,3>) * nCells);
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx;
+			status = this->fields->getVectorField("dWdx", FIELD_CELL, &dwdx);
+			CHECK_ECODE(status)
 
-			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dpdx =
-					(cupcfd::geometry::euclidean::EuclideanVector<T,3> *) malloc(sizeof(cupcfd::geometry::euclidean::EuclideanVector<T,3>) * nCells);
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dpdx;
+			status = this->fields->getVectorField("dPdx", FIELD_CELL, &dpdx);
+			CHECK_ECODE(status)
 
-			T * denCell = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(denCell, nCells, (T) 1E-6 , (T) 1E-2);
+			T * denCell;
+			status = this->fields->getScalarField("Den", FIELD_CELL, &denCell);
+			CHECK_ECODE(status)
 
-			T * denBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(denBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * denBoundary;
+			status = this->fields->getScalarField("Den", FIELD_BOUNDARY, &denBoundary);
+			CHECK_ECODE(status)
 
-			T * uCell = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(uCell, nCells, (T) 1E-6 , (T) 1E-2);
+			T * uCell;
+			status = this->fields->getScalarField("U", FIELD_CELL, &uCell);
+			CHECK_ECODE(status)
 
-			T * vCell = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(vCell, nCells, (T) 1E-6 , (T) 1E-2);
+			T * vCell;
+			status = this->fields->getScalarField("V", FIELD_CELL, &vCell);
+			CHECK_ECODE(status)
 
-			T * wCell = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(wCell, nCells, (T) 1E-6 , (T) 1E-2);
+			T * wCell;
+			status = this->fields->getScalarField("W", FIELD_CELL, &wCell);
+			CHECK_ECODE(status)
 
-			T * massFlux = (T *) malloc(sizeof(T) * nFaces);
-			cupcfd::utility::kernels::randomUniform(massFlux, nFaces, (T) 1E-6 , (T) 1E-2);
+			T * massFlux;
+			status = this->fields->getScalarField("MassFlux", FIELD_FACE, &massFlux);
+			CHECK_ECODE(status)
 
-			T * p = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(p, nCells, (T) 1E-6 , (T) 1E-2);
+			T * p;
+			status = this->fields->getScalarField("P", FIELD_CELL, &p);
+			CHECK_ECODE(status)
 
-			T * ar = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(ar, nCells, (T) 1E-6 , (T) 1E-2);
+			T * ar;
+			status = this->fields->getScalarField("Ar", FIELD_CELL, &ar);
+			CHECK_ECODE(status)
 
-			T * su = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(su, nCells, (T) 1E-6 , (T) 1E-2);
+			T * su;
+			status = this->fields->getScalarField("Su", FIELD_CELL, &su);
+			CHECK_ECODE(status)
 
-			T * rface = (T *) malloc(sizeof(T) * nFaces * 2);
+			T * rface;
+			status = this->fields->getScalarField("RFace", FIELD_FACE, &rface);
+			CHECK_ECODE(status)
 
 			T small = 1E-18;
 			I icinl;
@@ -255,14 +354,30 @@ namespace cupcfd
 			bool solveVisc = true;
 			bool solveEnthalpy = false;
 
-			T * teCell = (T *) malloc(sizeof(T) * nCells);
-			T * teBoundary = (T *) malloc(sizeof(T) * nBnds);
-			T * edCell = (T *) malloc(sizeof(T) * nCells);
-			T * edBoundary = (T *) malloc(sizeof(T) * nBnds);
-			T * viseffCell = (T *) malloc(sizeof(T) * nCells);
-			T * viseffBoundary = (T *) malloc(sizeof(T) * nBnds);
-			T * tCell = (T *) malloc(sizeof(T) * nCells);
-			T * tBoundary = (T *) malloc(sizeof(T) * nBnds);
+			T * teCell;
+			status = this->fields->getScalarField("TE", FIELD_CELL, &teCell);
+			CHECK_ECODE(status)
+			T * teBoundary;
+			status = this->fields->getScalarField("TE", FIELD_BOUNDARY, &teBoundary);
+			CHECK_ECODE(status)
+			T * edCell;
+			status = this->fields->getScalarField("ED", FIELD_CELL, &edCell);
+			CHECK_ECODE(status)
+			T * edBoundary;
+			status = this->fields->getScalarField("ED", FIELD_BOUNDARY, &edBoundary);
+			CHECK_ECODE(status)
+			T * viseffCell;
+			status = this->fields->getScalarField("VisEff", FIELD_CELL, &viseffCell);
+			CHECK_ECODE(status)
+			T * viseffBoundary;
+			status = this->fields->getScalarField("VisEff", FIELD_BOUNDARY, &viseffBoundary);
+			CHECK_ECODE(status)
+			T * tCell;
+			status = this->fields->getScalarField("T", FIELD_CELL, &tCell);
+			CHECK_ECODE(status)
+			T * tBoundary;
+			status = this->fields->getScalarField("T", FIELD_BOUNDARY, &tBoundary);
+			CHECK_ECODE(status)
 
 			// Start Timer
 			TreeTimerEnterBlockMethod("FluxMassDolfynFaceLoopBenchmark");
@@ -277,7 +392,7 @@ namespace cupcfd
 
 			// ToDo: Should add a configuration option to repeat the kernel X times per timing
 			// to reduce impact of overheads at small cell/face counts
-			status = cupcfd::fvm::FluxMassDolfynFaceLoop(*meshPtr,
+			status = cupcfd::fvm::FluxMassDolfynFaceLoop(static_cast<M&>(*meshPtr),
 						dudx, nCells,
 						dvdx, nCells,
 						dwdx, nCells,
@@ -307,20 +422,6 @@ namespace cupcfd
 			// Stop Timer
 			TreeTimerExitBlock("FluxMassDolfynFaceLoopBenchmark");
 
-			free(dudx);
-			free(dvdx);
-			free(dwdx);
-			free(dpdx);
-			free(denCell);
-			free(denBoundary);
-			free(uCell);
-			free(vCell);
-			free(wCell);
-			free(massFlux);
-			free(p);
-			free(ar);
-			free(su);
-			free(rface);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -336,8 +437,9 @@ namespace cupcfd
 			I nFaces = meshPtr->properties.lFaces;
 			I nRegions = meshPtr->properties.lRegions;
 
-			 T * massFlux = (T *) malloc(sizeof(T) * nFaces);
-			 cupcfd::utility::kernels::randomUniform(massFlux, nFaces, (T) 1E-6 , (T) 1E-2);
+			T * massFlux;
+			status = this->fields->getScalarField("MassFlux", FIELD_FACE, &massFlux);
+			CHECK_ECODE(status)
 
 			 T flowin;
 
@@ -360,7 +462,6 @@ namespace cupcfd
 			// Stop Timer
 			TreeTimerExitBlock("FluxMassDolfynBoundaryLoop1Benchmark");
 
-			free(massFlux);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -376,11 +477,13 @@ namespace cupcfd
 			I nFaces = meshPtr->properties.lFaces;
 			I nRegions = meshPtr->properties.lRegions;
 
-			T * massFlux = (T *) malloc(sizeof(T) * nFaces);
-			cupcfd::utility::kernels::randomUniform(massFlux, nFaces, (T) 1E-6 , (T) 1E-2);
+			T * massFlux;
+			status = this->fields->getScalarField("MassFlux", FIELD_FACE, &massFlux);
+			CHECK_ECODE(status)
 
-			T * flowRegion = (T *) malloc(sizeof(T) * nRegions);
-			cupcfd::utility::kernels::randomUniform(flowRegion, nRegions, (T) 1E-6 , (T) 1E-2);
+			T * flowRegion;
+			status = this->fields->getScalarField("FlowRegion", FIELD_REGION, &flowRegion);
+			CHECK_ECODE(status)
 
 			T flowout;
 
@@ -403,8 +506,6 @@ namespace cupcfd
 			// Stop Timer
 			TreeTimerExitBlock("FluxMassDolfynBoundaryLoop2Benchmark");
 
-			free(massFlux);
-			free(flowRegion);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -456,20 +557,25 @@ namespace cupcfd
 			I nFaces = meshPtr->properties.lFaces;
 			I nRegions = meshPtr->properties.lRegions;
 
-			T * massFlux = (T *) malloc(sizeof(T) * nFaces);
-			cupcfd::utility::kernels::randomUniform(massFlux, nFaces, (T) 1E-6 , (T) 1E-2);
+			T * massFlux;
+			status = this->fields->getScalarField("MassFlux", FIELD_FACE, &massFlux);
+			CHECK_ECODE(status)
 
-			T * uBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(uBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * uBoundary;
+			status = this->fields->getScalarField("U", FIELD_BOUNDARY, &uBoundary);
+			CHECK_ECODE(status)
 
-			T * vBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(vBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * vBoundary;
+			status = this->fields->getScalarField("V", FIELD_BOUNDARY, &vBoundary);
+			CHECK_ECODE(status)
 
-			T * wBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(wBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * wBoundary;
+			status = this->fields->getScalarField("W", FIELD_BOUNDARY, &wBoundary);
+			CHECK_ECODE(status)
 
-			T * denBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(denBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * denBoundary;
+			status = this->fields->getScalarField("Den", FIELD_BOUNDARY, &denBoundary);
+			CHECK_ECODE(status)
 
 			T ratearea = 1.0;
 			T flowout;
@@ -499,11 +605,6 @@ namespace cupcfd
 			// Stop Timer
 			TreeTimerExitBlock("FluxMassDolfynBoundaryLoop4Benchmark");
 
-			free(massFlux);
-			free(uBoundary);
-			free(vBoundary);
-			free(wBoundary);
-			free(denBoundary);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -519,27 +620,34 @@ namespace cupcfd
 			I nFaces = meshPtr->properties.lFaces;
 			I nRegions = meshPtr->properties.lRegions;
 
-			T * massFlux = (T *) malloc(sizeof(T) * nFaces);
-			cupcfd::utility::kernels::randomUniform(massFlux, nFaces, (T) 1E-6 , (T) 1E-2);
+			T * massFlux;
+			status = this->fields->getScalarField("MassFlux", FIELD_FACE, &massFlux);
+			CHECK_ECODE(status)
 
-			T * su = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(su, nCells, (T) 1E-6 , (T) 1E-2);
+			T * su;
+			status = this->fields->getScalarField("Su", FIELD_CELL, &su);
+			CHECK_ECODE(status)
 
-			T * uBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(uBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * uBoundary;
+			status = this->fields->getScalarField("U", FIELD_BOUNDARY, &uBoundary);
+			CHECK_ECODE(status)
 
-			T * vBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(vBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * vBoundary;
+			status = this->fields->getScalarField("V", FIELD_BOUNDARY, &vBoundary);
+			CHECK_ECODE(status)
 
-			T * wBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(wBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * wBoundary;
+			status = this->fields->getScalarField("W", FIELD_BOUNDARY, &wBoundary);
+			CHECK_ECODE(status)
 
 			T fact = 1.1;
 			bool solveU = true;
 			bool solveV = true;
 			bool solveW = true;
 
-			T * flowFact = (T *) malloc(sizeof(T) * nRegions);
+			T * flowFact;
+			status = this->fields->getScalarField("FlowFact", FIELD_REGION, &flowFact);
+			CHECK_ECODE(status)
 			T flowout2;
 
 			// Start Timer
@@ -570,11 +678,6 @@ namespace cupcfd
 			// Stop Timer
 			TreeTimerExitBlock("FluxMassDolfynBoundaryLoop5Benchmark");
 
-			free(massFlux);
-			free(su);
-			free(uBoundary);
-			free(vBoundary);
-			free(wBoundary);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -590,11 +693,13 @@ namespace cupcfd
 			I nFaces = meshPtr->properties.lFaces;
 			I nRegions = meshPtr->properties.lRegions;
 
-			T * flowFact = (T *) malloc(sizeof(T) * nRegions);
-			cupcfd::utility::kernels::randomUniform(flowFact, nRegions, (T) 1E-6 , (T) 1E-2);
+			T * flowFact;
+			status = this->fields->getScalarField("FlowFact", FIELD_REGION, &flowFact);
+			CHECK_ECODE(status)
 
-			T * flowRegion = (T *) malloc(sizeof(T) * nRegions);
-			cupcfd::utility::kernels::randomUniform(flowRegion, nRegions, (T) 1E-6 , (T) 1E-2);
+			T * flowRegion;
+			status = this->fields->getScalarField("FlowRegion", FIELD_REGION, &flowRegion);
+			CHECK_ECODE(status)
 
 			T flowIn = 0.0;
 
@@ -621,8 +726,6 @@ namespace cupcfd
 			// Stop Timer
 			TreeTimerExitBlock("FluxMassDolfynRegionLoopBenchmark");
 
-			free(flowFact);
-			free(flowRegion);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -638,41 +741,53 @@ namespace cupcfd
 			I nFaces = meshPtr->properties.lFaces;
 			I nRegions = meshPtr->properties.lRegions;
 
-			T * PhiCell = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(PhiCell, nCells, (T) 1E-6 , (T) 1E-2);
+			T * PhiCell;
+			status = this->fields->getScalarField("Phi", FIELD_CELL, &PhiCell);
+			CHECK_ECODE(status)
 
-			T * VisEff = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(VisEff, nCells, (T) 1E-6 , (T) 1E-2);
+			T * VisEff;
+			status = this->fields->getScalarField("VisEff", FIELD_CELL, &VisEff);
+			CHECK_ECODE(status)
 
-			T * Au = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(Au, nCells, (T) 1E-6 , (T) 1E-2);
+			T * Au;
+			status = this->fields->getScalarField("Au", FIELD_CELL, &Au);
+			CHECK_ECODE(status)
 
-			T * Su = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(Su, nCells, (T) 1E-6 , (T) 1E-2);
+			T * Su;
+			status = this->fields->getScalarField("Su", FIELD_CELL, &Su);
+			CHECK_ECODE(status)
 
-			T * Den = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(Den, nCells, (T) 1E-6 , (T) 1E-2);
+			T * Den;
+			status = this->fields->getScalarField("Den", FIELD_CELL, &Den);
+			CHECK_ECODE(status)
 
-			T * MassFlux = (T *) malloc(sizeof(T) * nFaces);
-			cupcfd::utility::kernels::randomUniform(MassFlux, nFaces, (T) 1E-6 , (T) 1E-2);
+			T * MassFlux;
+			status = this->fields->getScalarField("MassFlux", FIELD_FACE, &MassFlux);
+			CHECK_ECODE(status)
 
-			T * TE = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(TE, nCells, (T) 1E-6 , (T) 1E-2);
+			T * TE;
+			status = this->fields->getScalarField("TE", FIELD_CELL, &TE);
+			CHECK_ECODE(status)
 
-			T * PhiBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(PhiBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * PhiBoundary;
+			status = this->fields->getScalarField("Phi", FIELD_BOUNDARY, &PhiBoundary);
+			CHECK_ECODE(status)
 
-			T * CpBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(CpBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * CpBoundary;
+			status = this->fields->getScalarField("Cp", FIELD_BOUNDARY, &CpBoundary);
+			CHECK_ECODE(status)
 
-			T * visEffBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(visEffBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * visEffBoundary;
+			status = this->fields->getScalarField("VisEff", FIELD_BOUNDARY, &visEffBoundary);
+			CHECK_ECODE(status)
 
-			T * RFace = (T *) malloc(sizeof(T) * nFaces * 2);
+			T * RFace;
+			status = this->fields->getScalarField("RFace", FIELD_FACE, &RFace);
+			CHECK_ECODE(status)
 
-			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidx =
-				(cupcfd::geometry::euclidean::EuclideanVector<T,3> *)
-				malloc(sizeof(cupcfd::geometry::euclidean::EuclideanVector<T,3>) * nCells);
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidx;
+			status = this->fields->getVectorField("dPhidx", FIELD_CELL, &dPhidx);
+			CHECK_ECODE(status)
 
 			bool SolveTurb = true;
 			bool SolveEnthalpy = false;
@@ -707,7 +822,7 @@ namespace cupcfd
 
 			// ToDo: Should add a configuration option to repeat the kernel X times per timing
 			// to reduce impact of overheads at small cell/face counts
-			status = cupcfd::fvm::FluxScalarDolfynFaceLoop(*(this->meshPtr),
+			status = cupcfd::fvm::FluxScalarDolfynFaceLoop(static_cast<M&>(*(this->meshPtr)),
 														PhiCell, nCells,
 														PhiBoundary, nBnds,
 														VisEff, nCells,
@@ -732,17 +847,6 @@ namespace cupcfd
 			// Stop Timer
 			TreeTimerExitBlock("FluxScalarDolfynFaceLoopBenchmark");
 
-			free(PhiCell);
-			free(VisEff);
-			free(Au);
-			free(Su);
-			free(Den);
-			free(MassFlux);
-			free(TE);
-			free(CpBoundary);
-			free(visEffBoundary);
-			free(RFace);
-			free(dPhidx);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -762,62 +866,82 @@ namespace cupcfd
 			T small = 1E-18;
 			// T large = 1E+18;
 
-			T * uCell = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(uCell, nCells, (T) 1E-6 , (T) 1E-2);
+			T * uCell;
+			status = this->fields->getScalarField("U", FIELD_CELL, &uCell);
+			CHECK_ECODE(status)
 
-			T * vCell = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(vCell, nCells, (T) 1E-6 , (T) 1E-2);
+			T * vCell;
+			status = this->fields->getScalarField("V", FIELD_CELL, &vCell);
+			CHECK_ECODE(status)
 
-			T * wCell = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(wCell, nCells, (T) 1E-6 , (T) 1E-2);
+			T * wCell;
+			status = this->fields->getScalarField("W", FIELD_CELL, &wCell);
+			CHECK_ECODE(status)
 
-			T * visEffCell = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(visEffCell, nCells, (T) 1E-6 , (T) 1E-2);
+			T * visEffCell;
+			status = this->fields->getScalarField("VisEff", FIELD_CELL, &visEffCell);
+			CHECK_ECODE(status)
 
-			T * massFlux = (T *) malloc(sizeof(T) * nFaces);
-			cupcfd::utility::kernels::randomUniform(massFlux, nFaces, (T) 1E-6 , (T) 1E-2);
+			T * massFlux;
+			status = this->fields->getScalarField("MassFlux", FIELD_FACE, &massFlux);
+			CHECK_ECODE(status)
 
-			T * su = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(su, nCells, (T) 1E-6 , (T) 1E-2);
+			T * su;
+			status = this->fields->getScalarField("Su", FIELD_CELL, &su);
+			CHECK_ECODE(status)
 
-			T * sv = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(sv, nCells, (T) 1E-6 , (T) 1E-2);
+			T * sv;
+			status = this->fields->getScalarField("Sv", FIELD_CELL, &sv);
+			CHECK_ECODE(status)
 
-			T * sw = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(sw, nCells, (T) 1E-6 , (T) 1E-2);
+			T * sw;
+			status = this->fields->getScalarField("Sw", FIELD_CELL, &sw);
+			CHECK_ECODE(status)
 
-			T * au = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(au, nCells, (T) 1E-6 , (T) 1E-2);
+			T * au;
+			status = this->fields->getScalarField("Au", FIELD_CELL, &au);
+			CHECK_ECODE(status)
 
-			T * av = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(av, nCells, (T) 1E-6 , (T) 1E-2);
+			T * av;
+			status = this->fields->getScalarField("Av", FIELD_CELL, &av);
+			CHECK_ECODE(status)
 
-			T * aw = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(aw, nCells, (T) 1E-6 , (T) 1E-2);
+			T * aw;
+			status = this->fields->getScalarField("Aw", FIELD_CELL, &aw);
+			CHECK_ECODE(status)
 
-			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx =
-					(cupcfd::geometry::euclidean::EuclideanVector<T,3> *) malloc(sizeof(cupcfd::geometry::euclidean::EuclideanVector<T,3>) * nCells);
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx;
+			status = this->fields->getVectorField("dUdx", FIELD_CELL, &dudx);
+			CHECK_ECODE(status)
 
-			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx =
-					(cupcfd::geometry::euclidean::EuclideanVector<T,3> *) malloc(sizeof(cupcfd::geometry::euclidean::EuclideanVector<T,3>) * nCells);
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx;
+			status = this->fields->getVectorField("dVdx", FIELD_CELL, &dvdx);
+			CHECK_ECODE(status)
 
-			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx =
-					(cupcfd::geometry::euclidean::EuclideanVector<T,3> *) malloc(sizeof(cupcfd::geometry::euclidean::EuclideanVector<T,3>) * nCells);
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx;
+			status = this->fields->getVectorField("dWdx", FIELD_CELL, &dwdx);
+			CHECK_ECODE(status)
 
-			T * uBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(uBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * uBoundary;
+			status = this->fields->getScalarField("U", FIELD_BOUNDARY, &uBoundary);
+			CHECK_ECODE(status)
 
-			T * vBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(vBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * vBoundary;
+			status = this->fields->getScalarField("V", FIELD_BOUNDARY, &vBoundary);
+			CHECK_ECODE(status)
 
-			T * wBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(wBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * wBoundary;
+			status = this->fields->getScalarField("W", FIELD_BOUNDARY, &wBoundary);
+			CHECK_ECODE(status)
 
-			T * visEffBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(visEffBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * visEffBoundary;
+			status = this->fields->getScalarField("VisEff", FIELD_BOUNDARY, &visEffBoundary);
+			CHECK_ECODE(status)
 
 			// [nfaces][2]
-			T * rFace = (T *) malloc(sizeof(T) * nFaces * 2);
+			T * rFace;
+			status = this->fields->getScalarField("RFace", FIELD_FACE, &rFace);
+			CHECK_ECODE(status)
 
 			// Start Timer
 			TreeTimerEnterBlockMethod("FluxUVWDolfynFaceLoop1Benchmark");
@@ -858,25 +982,6 @@ namespace cupcfd
 			// Stop Timer
 			TreeTimerExitBlock("FluxUVWDolfynFaceLoop1Benchmark");
 
-			free(uCell);
-			free(vCell);
-			free(wCell);
-			free(visEffCell);
-			free(massFlux);
-			free(su);
-			free(sv);
-			free(sw);
-			free(au);
-			free(av);
-			free(aw);
-			free(dudx);
-			free(dvdx);
-			free(dwdx);
-			free(uBoundary);
-			free(vBoundary);
-			free(wBoundary);
-			free(visEffBoundary);
-			free(rFace);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -954,17 +1059,21 @@ namespace cupcfd
 			T visURF = 0.232;
 			T visLam = 0.00547;
 
-			T * TE = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(TE, nCells, (T) 1E-6 , (T) 1E-2);
+			T * TE;
+			status = this->fields->getScalarField("TE", FIELD_CELL, &TE);
+			CHECK_ECODE(status)
 
-			T * ED = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(ED, nCells, (T) 1E-6 , (T) 1E-2);
+			T * ED;
+			status = this->fields->getScalarField("ED", FIELD_CELL, &ED);
+			CHECK_ECODE(status)
 
-			T * den = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(den, nCells, (T) 1E-6 , (T) 1E-2);
+			T * den;
+			status = this->fields->getScalarField("Den", FIELD_CELL, &den);
+			CHECK_ECODE(status)
 
-			T * visEff = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(visEff, nCells, (T) 1E-6 , (T) 1E-2);
+			T * visEff;
+			status = this->fields->getScalarField("VisEff", FIELD_CELL, &visEff);
+			CHECK_ECODE(status)
 
 
 			// Start Timer
@@ -990,10 +1099,6 @@ namespace cupcfd
 			// Stop Timer
 			TreeTimerExitBlock("calculateViscosityDolfynCellLoop1Benchmark");
 
-			free(TE);
-			free(ED);
-			free(den);
-			free(visEff);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -1045,10 +1150,18 @@ namespace cupcfd
 			T kappa = 1.1;
 			T visLam = 1.2;
 
-			T * TE = (T *) malloc(sizeof(T) * nCells);
-			T * den = (T *) malloc(sizeof(T) * nCells);
-			T * visEffCell = (T *) malloc(sizeof(T) * nCells);
-			T * visEffBoundary = (T *) malloc(sizeof(T) * nBnds);
+			T * TE;
+			status = this->fields->getScalarField("TE", FIELD_CELL, &TE);
+			CHECK_ECODE(status)
+			T * den;
+			status = this->fields->getScalarField("Den", FIELD_CELL, &den);
+			CHECK_ECODE(status)
+			T * visEffCell;
+			status = this->fields->getScalarField("VisEff", FIELD_CELL, &visEffCell);
+			CHECK_ECODE(status)
+			T * visEffBoundary;
+			status = this->fields->getScalarField("VisEff", FIELD_BOUNDARY, &visEffBoundary);
+			CHECK_ECODE(status)
 
 			// Start Timer
 			TreeTimerEnterBlockMethod("calculateViscosityDolfynBoundaryLoopBenchmark");
@@ -1074,10 +1187,6 @@ namespace cupcfd
 			// Stop Timer
 			TreeTimerExitBlock("calculateViscosityDolfynBoundaryLoopBenchmark");
 
-			free(TE);
-			free(den);
-			free(visEffCell);
-			free(visEffBoundary);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -1094,11 +1203,13 @@ namespace cupcfd
 			I nRegions = meshPtr->properties.lRegions;
 
 			T visLam = 1.1;
-			T * visEffCell = (T *) malloc(sizeof(T) * nCells);
-			cupcfd::utility::kernels::randomUniform(visEffCell, nCells, (T) 1E-6 , (T) 1E-2);
+			T * visEffCell;
+			status = this->fields->getScalarField("VisEff", FIELD_CELL, &visEffCell);
+			CHECK_ECODE(status)
 
-			T * visEffBoundary = (T *) malloc(sizeof(T) * nBnds);
-			cupcfd::utility::kernels::randomUniform(visEffBoundary, nBnds, (T) 1E-6 , (T) 1E-2);
+			T * visEffBoundary;
+			status = this->fields->getScalarField("VisEff", FIELD_BOUNDARY, &visEffBoundary);
+			CHECK_ECODE(status)
 
 			// Start Timer
 			TreeTimerEnterBlockMethod("calculateViscosityDolfynCellLoop2Benchmark");
@@ -1122,8 +1233,119 @@ namespace cupcfd
 			// Stop Timer
 			TreeTimerExitBlock("calculateViscosityDolfynCellLoop2Benchmark");
 
-			free(visEffCell);
-			free(visEffBoundary);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes BenchmarkKernels<M,I,T,L>::ResidualCSRBenchmark() {
+			cupcfd::error::eCodes status;
+			double tStart;
+			double tResidual;
+			double tTriad;
+
+			I nCells = meshPtr->properties.lTCells;
+			I nOwnedCells = meshPtr->properties.lOCells;
+			I nFaces = meshPtr->properties.lFaces;
+
+			// Build the cell matrix from random face coefficients
+			cupcfd::fvm::FaceMatrixAssembler<I,T> assembler;
+			cupcfd::data_structures::SparseMatrixCSR<I,T> matrix(1, 1, 0);
+
+			status = assembler.symbolic(*(this->meshPtr), matrix);
+			CHECK_ECODE(status)
+
+			T * rface;
+			status = this->fields->getScalarField("RFace", FIELD_FACE, &rface);
+			CHECK_ECODE(status)
+
+			status = assembler.numeric(rface, nFaces * 2, matrix);
+			CHECK_ECODE(status)
+
+			T * x;
+			status = this->fields->getScalarField("X", FIELD_CELL, &x);
+			CHECK_ECODE(status)
+
+			T * b;
+			status = this->fields->getScalarField("B", FIELD_CELL, &b);
+			CHECK_ECODE(status)
+
+			T * r;
+			status = this->fields->getScalarField("R", FIELD_CELL, &r);
+			CHECK_ECODE(status)
+			T rNorm;
+			T localNormSq;
+
+			// Number of timed sweeps - the fastest is reported, as for STREAM
+			I nSweeps = 10;
+
+			// Minimum traffic: values and column indexes per non-zero, the row pointers,
+			// x and b read once and r written once
+			double residualBytes = ((double) matrix.nnz * (sizeof(T) + sizeof(I))) + ((double) (nOwnedCells + 1) * sizeof(I))
+								 + ((double) (nCells + (2 * nOwnedCells)) * sizeof(T));
+
+			// Triad arrays sized so the triad moves the same number of bytes (two reads, one write)
+			I nTriad = (I) (residualBytes / (3.0 * sizeof(T))) + 1;
+			T * ta = cupcfd::utility::drivers::allocateAligned<T>(nTriad);
+			T * tb = cupcfd::utility::drivers::allocateAligned<T>(nTriad);
+			T * tc = cupcfd::utility::drivers::allocateAligned<T>(nTriad);
+			T scalar = (T) 3.0;
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < nTriad; i++) {
+				ta[i] = T(0);
+				tb[i] = T(1);
+				tc[i] = T(2);
+			}
+
+			// Start Timer
+			TreeTimerEnterBlockMethod("ResidualCSRBenchmark");
+
+			// Track some parameters
+			TreeTimerLogParameterInt("LocalCells", nCells);
+			TreeTimerLogParameterInt("LocalOwnedCells", nOwnedCells);
+			TreeTimerLogParameterInt("LocalFaces", nFaces);
+			TreeTimerLogParameterInt("NNZ", matrix.nnz);
+
+			TreeTimerLogParameterInt("Sweeps", nSweeps);
+
+			// Untimed first sweep, including the global norm. This also touches the residual
+			// array, so page faults are not part of the timed sweeps.
+			status = cupcfd::fvm::ResidualCSR(*(this->meshPtr->cellConnGraph->comm), matrix,
+											  x, nCells, b, nOwnedCells, r, nOwnedCells, &rNorm);
+			CHECK_ECODE(status)
+
+			// Only the local residual is timed - the reduction of the norm is latency bound
+			tResidual = std::numeric_limits<double>::max();
+			for(I k = 0; k < nSweeps; k++) {
+				tStart = MPI_Wtime();
+				status = matrix.residual(x, nCells, b, nOwnedCells, r, nOwnedCells, &localNormSq);
+				CHECK_ECODE(status)
+				tResidual = std::min(tResidual, MPI_Wtime() - tStart);
+			}
+
+			// STREAM-style baseline
+			tTriad = std::numeric_limits<double>::max();
+			for(I k = 0; k < nSweeps; k++) {
+				tStart = MPI_Wtime();
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < nTriad; i++) {
+					ta[i] = tb[i] + (scalar * tc[i]);
+				}
+				tTriad = std::min(tTriad, MPI_Wtime() - tStart);
+			}
+
+			TreeTimerLogParameterDouble("ResidualNorm", (double) rNorm);
+			TreeTimerLogParameterDouble("ResidualGBs", residualBytes / (tResidual * 1.0e9));
+			TreeTimerLogParameterDouble("TriadGBs", (3.0 * nTriad * sizeof(T)) / (tTriad * 1.0e9));
+			TreeTimerLogParameterDouble("BandwidthEfficiency", (residualBytes / tResidual) / ((3.0 * nTriad * sizeof(T)) / tTriad));
+
+			// Stop Timer
+			TreeTimerExitBlock("ResidualCSRBenchmark");
+
+			cupcfd::utility::drivers::freeAligned(ta);
+			cupcfd::utility::drivers::freeAligned(tb);
+			cupcfd::utility::drivers::freeAligned(tc);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -1136,3 +1358,11 @@ template class cupcfd::benchmark::BenchmarkKernels<cupcfd::geometry::mesh::CupCf
 
 template class cupcfd::benchmark::BenchmarkKernels<cupcfd::geometry::mesh::CupCfdSoAMesh<int, float, int>, int, float, int>;
 template class cupcfd::benchmark::BenchmarkKernels<cupcfd::geometry::mesh::CupCfdSoAMesh<int, double, int>, int, double, int>;
+template class cupcfd::benchmark::BenchmarkKernels<cupcfd::geometry::mesh::CupCfdAoSoAMesh<int, float, int, CUPCFD_AOSOA_MESH_TILE_WIDTH>, int, float, int>;
+template class cupcfd::benchmark::BenchmarkKernels<cupcfd::geometry::mesh::CupCfdAoSoAMesh<int, double, int, CUPCFD_AOSOA_MESH_TILE_WIDTH>, int, double, int>;
+
+template class cupcfd::benchmark::BenchmarkKernels<cupcfd::geometry::mesh::CupCfdAoSMesh<int, float, long>, int, float, long>;
+template class cupcfd::benchmark::BenchmarkKernels<cupcfd::geometry::mesh::CupCfdAoSMesh<int, double, long>, int, double, long>;
+
+template class cupcfd::benchmark::BenchmarkKernels<cupcfd::geometry::mesh::CupCfdSoAMesh<int, float, long>, int, float, long>;
+template class cupcfd::benchmark::BenchmarkKernels<cupcfd::geometry::mesh::CupCfdSoAMesh<int, double, long>, int, double, long>;
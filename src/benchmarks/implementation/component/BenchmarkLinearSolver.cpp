@@ -39,6 +39,22 @@ namespace cupcfd
 
 		}
 
+		template <class C, class I, class T>
+		BenchmarkLinearSolver<C,I,T>::BenchmarkLinearSolver(std::string benchmarkName, I repetitions,
+														  std::shared_ptr<std::vector<T>> rhsVectorPtr,
+														  std::shared_ptr<std::vector<T>> solVectorPtr,
+														  std::shared_ptr<cupcfd::data_structures::DistributedSparseMatrix<I,T>> distributedMatrixPtr,
+														  std::shared_ptr<cupcfd::linearsolvers::LinearSolverInterface<C,I,T>> solverSystemPtr)
+		: Benchmark<I,T>(benchmarkName, repetitions),
+		  matrixPtr(nullptr),
+		  rhsVectorPtr(rhsVectorPtr),
+		  solVectorPtr(solVectorPtr),
+		  distributedMatrixPtr(distributedMatrixPtr),
+		  solverSystemPtr(solverSystemPtr)
+		{
+
+		}
+
 		template <class C, class I, class T>
 		BenchmarkLinearSolver<C,I,T>::~BenchmarkLinearSolver() {
 			// Shared Pointer will cleanup after itself as object is destroyed
@@ -61,8 +77,23 @@ namespace cupcfd
 			// Get the non-zero rows assigned to this rank
 			I * rowIndexes;
 			I nRowIndexes;
-			status = matrixPtr->getNonZeroRowIndexes(&rowIndexes, &nRowIndexes);
-			CHECK_ECODE(status)
+			I indexBase;
+
+			if(this->distributedMatrixPtr != nullptr) {
+				// Each rank sets the rows it owns, in base zero
+				nRowIndexes = this->distributedMatrixPtr->nOwnedRows;
+				rowIndexes = (I *) malloc(sizeof(I) * nRowIndexes);
+				indexBase = 0;
+
+				for(I i = 0; i < nRowIndexes; i++) {
+					rowIndexes[i] = this->distributedMatrixPtr->rowStart + i;
+				}
+			}
+			else {
+				status = matrixPtr->getNonZeroRowIndexes(&rowIndexes, &nRowIndexes);
+				CHECK_ECODE(status)
+				indexBase = matrixPtr->baseIndex;
+			}
 
 			// Start tracking parameters/time for this block
 			this->startBenchmarkBlock(this->benchmarkName);
@@ -91,20 +122,25 @@ namespace cupcfd
 
 				// Set Vector B Values
 				this->startBenchmarkBlock("SetValuesVectorB");
-				status = this->solverSystemPtr->setValuesVectorB(&((*(this->rhsVectorPtr.get()))[0]), this->rhsVectorPtr->size(), rowIndexes, nRowIndexes, matrixPtr->baseIndex);
+				status = this->solverSystemPtr->setValuesVectorB(&((*(this->rhsVectorPtr.get()))[0]), this->rhsVectorPtr->size(), rowIndexes, nRowIndexes, indexBase);
 				CHECK_ECODE(status)
 				this->stopBenchmarkBlock("SetValuesVectorB");
 
 				// Set Vector X Values
 				this->startBenchmarkBlock("SetValuesVectorX");
-				status = this->solverSystemPtr->setValuesVectorX(&((*(this->solVectorPtr.get()))[0]), this->solVectorPtr->size(), rowIndexes, nRowIndexes, matrixPtr->baseIndex);
+				status = this->solverSystemPtr->setValuesVectorX(&((*(this->solVectorPtr.get()))[0]), this->solVectorPtr->size(), rowIndexes, nRowIndexes, indexBase);
 				CHECK_ECODE(status)
 				this->stopBenchmarkBlock("SetValuesVectorX");
 
 				// Set Matrix A Values/Build Matrix A (Structures already set inside setup)
 				// Matrix must have same structures as one used during setup
 				this->startBenchmarkBlock("SetValuesMatrixA");
-				status = this->solverSystemPtr->setValuesMatrixA(*matrixPtr);
+				if(this->distributedMatrixPtr != nullptr) {
+					status = this->solverSystemPtr->setValuesMatrixA(*distributedMatrixPtr);
+				}
+				else {
+					status = this->solverSystemPtr->setValuesMatrixA(*matrixPtr);
+				}
 				CHECK_ECODE(status)
 				this->stopBenchmarkBlock("SetValuesMatrixA");
 
@@ -112,6 +148,12 @@ namespace cupcfd
 				this->startBenchmarkBlock("Solve");
 				status = this->solverSystemPtr->solve();
 				CHECK_ECODE(status)
+
+				I iterations, refinementSteps;
+				status = this->solverSystemPtr->getSolveStatistics(&iterations, &refinementSteps);
+				CHECK_ECODE(status)
+				TreeTimerLogParameterInt("Iterations", iterations);
+				TreeTimerLogParameterInt("RefinementSteps", refinementSteps);
 				this->stopBenchmarkBlock("Solve");
 			}
 
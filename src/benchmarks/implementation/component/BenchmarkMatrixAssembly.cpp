@@ -0,0 +1,170 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the BenchmarkMatrixAssembly class.
+ */
+
+#include "BenchmarkMatrixAssembly.h"
+
+#include "tt_interface_c.h"
+#include "CupCfdAoSMesh.h"
+#include "CupCfdSoAMesh.h"
+#include "CupCfdAoSoAMesh.h"
+
+#include "ArrayKernels.h"
+
+#include "mpi.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		template <class M, class I, class T, class L>
+		BenchmarkMatrixAssembly<M,I,T,L>::BenchmarkMatrixAssembly(std::string benchmarkName,
+																  std::shared_ptr<cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>> meshPtr,
+																  I repetitions)
+		: Benchmark<I,T>(benchmarkName, repetitions),
+		  meshPtr(meshPtr)
+		{
+
+		}
+
+		template <class M, class I, class T, class L>
+		BenchmarkMatrixAssembly<M,I,T,L>::~BenchmarkMatrixAssembly() {
+			// Shared Pointer will cleanup after itself as object is destroyed
+		}
+
+		template <class M, class I, class T, class L>
+		void BenchmarkMatrixAssembly<M,I,T,L>::setupBenchmark() {
+			I nFaces = this->meshPtr->properties.lFaces;
+
+			this->rface.resize(2 * nFaces);
+			cupcfd::utility::kernels::randomUniform(&(this->rface[0]), 2 * nFaces, (T) 1E-6, (T) 1E-2);
+		}
+
+		template <class M, class I, class T, class L>
+		void BenchmarkMatrixAssembly<M,I,T,L>::recordParameters() {
+			TreeTimerLogParameterInt("LocalCells", this->meshPtr->properties.lTCells);
+			TreeTimerLogParameterInt("LocalOwnedCells", this->meshPtr->properties.lOCells);
+			TreeTimerLogParameterInt("LocalGhostCells", this->meshPtr->properties.lGhCells);
+			TreeTimerLogParameterInt("LocalFaces", this->meshPtr->properties.lFaces);
+			TreeTimerLogParameterInt("CellColours", this->meshPtr->cellColouring.nColours);
+			TreeTimerLogParameterDouble("CellColourImbalance", this->meshPtr->cellColouring.imbalance);
+			TreeTimerLogParameterInt("FaceColours", this->meshPtr->faceColouring.nColours);
+			TreeTimerLogParameterDouble("FaceColourImbalance", this->meshPtr->faceColouring.imbalance);
+		}
+
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes BenchmarkMatrixAssembly<M,I,T,L>::runBenchmark() {
+			cupcfd::error::eCodes status;
+			double tStart;
+
+			I nOwnedCells = this->meshPtr->properties.lOCells;
+			I nFaces = this->meshPtr->properties.lFaces;
+
+			cupcfd::fvm::FaceMatrixAssembler<I,T> assembler;
+			cupcfd::data_structures::SparseMatrixCSR<I,T> matrix(1, 1, 0);
+
+			// Generate the face coefficients outside of the timed region
+			this->setupBenchmark();
+
+			// Start tracking parameters/time for this block
+			this->startBenchmarkBlock(this->benchmarkName);
+			TreeTimerLogParameterInt("Repetitions", this->repetitions);
+
+			this->recordParameters();
+
+			// === Symbolic ===
+			// Run once per mesh
+			this->startBenchmarkBlock("MatrixAssemblySymbolic");
+			tStart = MPI_Wtime();
+			status = assembler.symbolic(*(this->meshPtr), matrix);
+			CHECK_ECODE(status)
+			TreeTimerLogParameterDouble("Seconds", MPI_Wtime() - tStart);
+			TreeTimerLogParameterInt("NNZ", matrix.nnz);
+			TreeTimerLogParameterInt("Colours", assembler.nColours);
+			TreeTimerLogParameterDouble("ColourImbalance", assembler.colourImbalance);
+			this->stopBenchmarkBlock("MatrixAssemblySymbolic");
+
+			// === Numeric ===
+			this->startBenchmarkBlock("MatrixAssemblyNumeric");
+			tStart = MPI_Wtime();
+			for(I i = 0; i < this->repetitions; i++) {
+				status = assembler.numeric(&(this->rface[0]), 2 * nFaces, matrix);
+				CHECK_ECODE(status)
+			}
+			TreeTimerLogParameterDouble("SecondsPerAssembly", (MPI_Wtime() - tStart) / this->repetitions);
+			this->stopBenchmarkBlock("MatrixAssemblyNumeric");
+
+			// === Baseline ===
+			// Search for and update each entry individually, serially, on the same pattern
+			this->startBenchmarkBlock("MatrixAssemblySetElement");
+			tStart = MPI_Wtime();
+			for(I i = 0; i < this->repetitions; i++) {
+				for(I k = 0; k < matrix.nnz; k++) {
+					matrix.A[k] = T(0);
+				}
+
+				for(I j = 0; j < nFaces; j++) {
+					if(!this->meshPtr->getFaceIsBoundary(j)) {
+						I ip = this->meshPtr->getFaceCell1ID(j);
+						I in = this->meshPtr->getFaceCell2ID(j);
+						T val;
+
+						if(ip < nOwnedCells) {
+							status = matrix.getElement(ip, in, &val);
+							CHECK_ECODE(status)
+							status = matrix.setElement(ip, in, val + this->rface[2 * j]);
+							CHECK_ECODE(status)
+
+							status = matrix.getElement(ip, ip, &val);
+							CHECK_ECODE(status)
+							status = matrix.setElement(ip, ip, val - this->rface[2 * j]);
+							CHECK_ECODE(status)
+						}
+
+						if(in < nOwnedCells) {
+							status = matrix.getElement(in, ip, &val);
+							CHECK_ECODE(status)
+							status = matrix.setElement(in, ip, val + this->rface[(2 * j) + 1]);
+							CHECK_ECODE(status)
+
+							status = matrix.getElement(in, in, &val);
+							CHECK_ECODE(status)
+							status = matrix.setElement(in, in, val - this->rface[(2 * j) + 1]);
+							CHECK_ECODE(status)
+						}
+					}
+				}
+			}
+			TreeTimerLogParameterDouble("SecondsPerAssembly", (MPI_Wtime() - tStart) / this->repetitions);
+			this->stopBenchmarkBlock("MatrixAssemblySetElement");
+
+			// Stop tracking parameters/time for this block
+			this->stopBenchmarkBlock(this->benchmarkName);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::benchmark::BenchmarkMatrixAssembly<cupcfd::geometry::mesh::CupCfdAoSMesh<int, float, int>, int, float, int>;
+template class cupcfd::benchmark::BenchmarkMatrixAssembly<cupcfd::geometry::mesh::CupCfdAoSMesh<int, double, int>, int, double, int>;
+
+template class cupcfd::benchmark::BenchmarkMatrixAssembly<cupcfd::geometry::mesh::CupCfdSoAMesh<int, float, int>, int, float, int>;
+template class cupcfd::benchmark::BenchmarkMatrixAssembly<cupcfd::geometry::mesh::CupCfdSoAMesh<int, double, int>, int, double, int>;
+template class cupcfd::benchmark::BenchmarkMatrixAssembly<cupcfd::geometry::mesh::CupCfdAoSoAMesh<int, float, int, CUPCFD_AOSOA_MESH_TILE_WIDTH>, int, float, int>;
+template class cupcfd::benchmark::BenchmarkMatrixAssembly<cupcfd::geometry::mesh::CupCfdAoSoAMesh<int, double, int, CUPCFD_AOSOA_MESH_TILE_WIDTH>, int, double, int>;
+
+template class cupcfd::benchmark::BenchmarkMatrixAssembly<cupcfd::geometry::mesh::CupCfdAoSMesh<int, float, long>, int, float, long>;
+template class cupcfd::benchmark::BenchmarkMatrixAssembly<cupcfd::geometry::mesh::CupCfdAoSMesh<int, double, long>, int, double, long>;
+
+template class cupcfd::benchmark::BenchmarkMatrixAssembly<cupcfd::geometry::mesh::CupCfdSoAMesh<int, float, long>, int, float, long>;
+template class cupcfd::benchmark::BenchmarkMatrixAssembly<cupcfd::geometry::mesh::CupCfdSoAMesh<int, double, long>, int, double, long>;
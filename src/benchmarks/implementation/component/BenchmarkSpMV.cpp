@@ -0,0 +1,152 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the BenchmarkSpMV class.
+ */
+
+#include "BenchmarkSpMV.h"
+
+#include "tt_interface_c.h"
+
+#include "mpi.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		template <class I, class T>
+		BenchmarkSpMV<I,T>::BenchmarkSpMV(std::string benchmarkName, I repetitions,
+										  std::shared_ptr<cupcfd::data_structures::SparseMatrixCSR<I,T>> csrPtr,
+										  std::shared_ptr<cupcfd::data_structures::SparseMatrixCOO<I,T>> cooPtr,
+										  std::shared_ptr<cupcfd::data_structures::SparseMatrixSELL<I,T,BENCH_SPMV_SELL_C,BENCH_SPMV_SELL_SIGMA>> sellPtr)
+		: Benchmark<I,T>(benchmarkName, repetitions),
+		  csrPtr(csrPtr),
+		  cooPtr(cooPtr),
+		  sellPtr(sellPtr)
+		{
+
+		}
+
+		template <class I, class T>
+		BenchmarkSpMV<I,T>::~BenchmarkSpMV() {
+			// Shared Pointer will cleanup after itself as object is destroyed
+		}
+
+		template <class I, class T>
+		void BenchmarkSpMV<I,T>::recordThroughput(double seconds, double bytes) {
+			double flops = 2.0 * this->csrPtr->nnz;
+
+			TreeTimerLogParameterDouble("GFLOPS", (flops * this->repetitions) / (seconds * 1.0e9));
+			TreeTimerLogParameterDouble("GBs", (bytes * this->repetitions) / (seconds * 1.0e9));
+		}
+
+		template <class I, class T>
+		void BenchmarkSpMV<I,T>::setupBenchmark() {
+			// Use a vector of ones - the values do not affect the cost of the product.
+			// The vectors are first touched here in parallel so their pages are spread
+			// across threads in the same pattern as the products access them.
+			I m = this->csrPtr->m;
+			I n = this->csrPtr->n;
+
+			this->x.resize(n);
+			this->y.resize(m);
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < n; i++) {
+				this->x[i] = T(1);
+			}
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < m; i++) {
+				this->y[i] = T(0);
+			}
+		}
+
+		template <class I, class T>
+		void BenchmarkSpMV<I,T>::recordParameters() {
+			TreeTimerLogParameterInt("Rows", this->csrPtr->m);
+			TreeTimerLogParameterInt("Columns", this->csrPtr->n);
+			TreeTimerLogParameterInt("NNZ", this->csrPtr->nnz);
+			TreeTimerLogParameterInt("SELLChunkHeight", BENCH_SPMV_SELL_C);
+			TreeTimerLogParameterInt("SELLSortWindow", BENCH_SPMV_SELL_SIGMA);
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkSpMV<I,T>::runBenchmark() {
+			cupcfd::error::eCodes status;
+			double tStart;
+			double bytes;
+
+			I m = this->csrPtr->m;
+			I n = this->csrPtr->n;
+			I nnz = this->csrPtr->nnz;
+
+			// Vector traffic common to all formats: x read once, y written once
+			double vectorBytes = (double) sizeof(T) * (n + m);
+
+			// Prepare the vectors outside of the timed region
+			this->setupBenchmark();
+
+			// Start tracking parameters/time for this block
+			this->startBenchmarkBlock(this->benchmarkName);
+			TreeTimerLogParameterInt("Repetitions", this->repetitions);
+
+			this->recordParameters();
+
+			// === CSR ===
+			// Values and column indexes per non-zero, plus the row pointers
+			this->startBenchmarkBlock("SpMVCSR");
+			tStart = MPI_Wtime();
+			for(I i = 0; i < this->repetitions; i++) {
+				status = this->csrPtr->multiply(&(this->x[0]), n, &(this->y[0]), m);
+				CHECK_ECODE(status)
+			}
+			bytes = ((double) nnz * (sizeof(T) + sizeof(I))) + ((double) (m + 1) * sizeof(I)) + vectorBytes;
+			this->recordThroughput(MPI_Wtime() - tStart, bytes);
+			this->stopBenchmarkBlock("SpMVCSR");
+
+			// === SELL-C-sigma ===
+			// Values and column indexes per stored entry (including padding), plus the chunk
+			// offsets/widths and the row permutation
+			this->startBenchmarkBlock("SpMVSELL");
+			tStart = MPI_Wtime();
+			for(I i = 0; i < this->repetitions; i++) {
+				status = this->sellPtr->multiply(&(this->x[0]), n, &(this->y[0]), m);
+				CHECK_ECODE(status)
+			}
+			bytes = ((double) this->sellPtr->getNStoredEntries() * (sizeof(T) + sizeof(I)))
+					+ ((double) ((2 * this->sellPtr->nChunks) + 1 + m) * sizeof(I)) + vectorBytes;
+			this->recordThroughput(MPI_Wtime() - tStart, bytes);
+			TreeTimerLogParameterDouble("FillRatio", (double) this->sellPtr->getNStoredEntries() / (double) nnz);
+			this->stopBenchmarkBlock("SpMVSELL");
+
+			// === COO ===
+			// Values, row and column indexes per non-zero. y is zeroed before accumulation,
+			// so it is counted as read and written.
+			this->startBenchmarkBlock("SpMVCOO");
+			tStart = MPI_Wtime();
+			for(I i = 0; i < this->repetitions; i++) {
+				status = this->cooPtr->multiply(&(this->x[0]), n, &(this->y[0]), m);
+				CHECK_ECODE(status)
+			}
+			bytes = ((double) nnz * (sizeof(T) + (2 * sizeof(I)))) + ((double) m * sizeof(T)) + vectorBytes;
+			this->recordThroughput(MPI_Wtime() - tStart, bytes);
+			this->stopBenchmarkBlock("SpMVCOO");
+
+			// Stop tracking parameters/time for this block
+			this->stopBenchmarkBlock(this->benchmarkName);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::benchmark::BenchmarkSpMV<int, float>;
+template class cupcfd::benchmark::BenchmarkSpMV<int, double>;
@@ -18,6 +18,8 @@
 #include <vector>
 #include <cstdlib>
 #include "VectorSource.h"
+#include "SparseMatrixSourceMeshGen.h"
+#include "DistributedSparseMatrix.h"
 
 namespace cupcfd
 {
@@ -72,17 +74,24 @@ namespace cupcfd
 		cupcfd::error::eCodes BenchmarkConfigLinearSolver<C,I,T>::buildBenchmark(BenchmarkLinearSolver<C,I,T> ** bench) {
 			cupcfd::error::eCodes status;
 			cupcfd::data_structures::SparseMatrixSource<I,T> * matrixSource;
-			cupcfd::linearsolvers::LinearSolverInterface<C,I,T> * solverSystem;
 
 			// Build the Matrix Source
 			status = this->matrixSourceConfig->buildSparseMatrixSource(&matrixSource);
 			CHECK_ECODE(status)
 
-			// Build the Matrix, distributing the data as established prior
+			status = this->buildBenchmarkFromSource(bench, matrixSource);
+			delete matrixSource;
+
+			return status;
+		}
 
-			// ToDo: For now since not Mesh Gen Source, just evenly divide the matrix between ranks...
-			// Will likely need to pass through a graph pointer at some point to get an idea of the connectivity
-			// and distribution of data
+		template <class C, class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigLinearSolver<C,I,T>::buildBenchmarkFromSource(BenchmarkLinearSolver<C,I,T> ** bench,
+																						  cupcfd::data_structures::SparseMatrixSource<I,T> * matrixSource) {
+			cupcfd::error::eCodes status;
+			cupcfd::linearsolvers::LinearSolverInterface<C,I,T> * solverSystem;
+
+			// Build the Matrix, distributing the data as established prior
 
 			// Get Matrix Size From Source
 			I rows, cols, base;
@@ -96,12 +105,25 @@ namespace cupcfd
 			status = matrixSource->getMatrixIndicesBase(&base);
 			CHECK_ECODE(status)
 
-			// Make the new matrix with a base of 0
-			std::shared_ptr<C> matrix = std::make_shared<C>(rows, cols, 0);
+			// Concurrent solves hold the full matrix on each rank, with a base of 0
+			std::shared_ptr<C> matrix;
+
+			// Distributed solves only hold the rows of this rank, in local form
+			std::shared_ptr<cupcfd::data_structures::DistributedSparseMatrix<I,T>> distributedMatrix;
+
+			// The rows assigned to this rank, with a base of 0
+			I * rowIndexes;
+			I nRowIndexes;
+
+			// Loaded entries, gathered so the matrix can be built in one batch
+			std::vector<I> rowEntries;
+			std::vector<I> colEntries;
+			std::vector<T> valEntries;
 
 			// ToDo: Could move this into SparseMatrixSource class
 			if(this->distType == BENCH_SOLVER_DIST_CONCURRENT) {
 				// Load Full Matrix
+				matrix = std::make_shared<C>(rows, cols, 0);
 
 				// Row Indexes
 
@@ -120,72 +142,76 @@ namespace cupcfd
 					CHECK_ECODE(status)
 
 					for( I j = 0; j < nColumnIndexes; j++) {
-						// ToDo: Element by Element call is likely v.slow
-						status = matrix->setElement(i, columnIndexes[j] - base, nnzValues[j]);
-						CHECK_ECODE(status)
+						rowEntries.push_back(i);
+						colEntries.push_back(columnIndexes[j] - base);
+						valEntries.push_back(nnzValues[j]);
 					}
 
 					free(columnIndexes);
 					free(nnzValues);
 				}
 
+				// Insert all loaded entries as a single batch
+				status = matrix->setElements(rowEntries.data(), colEntries.data(), valEntries.data(), cupcfd::utility::drivers::safeConvertSizeT<I>(valEntries.size()));
+				CHECK_ECODE(status)
+
 				// Perform the initial setup for a linear solver system
 				// All ranks are solving the same matrix independently
 				cupcfd::comm::Communicator solverComm(MPI_COMM_SELF);
 				status = this->linearSolverConfig->buildLinearSolver(&solverSystem, *matrix, solverComm);
 				CHECK_ECODE(status)
 
+				status = matrix->getNonZeroRowIndexes(&rowIndexes, &nRowIndexes);
+				CHECK_ECODE(status)
 			}
 			else if(this->distType == BENCH_SOLVER_DIST_DISTRIBUTED) {
-				// For now, we will split the rows evenly across all communicators - this may not be representative
-				// of a mesh decomposition however
 				cupcfd::comm::Communicator solverComm(MPI_COMM_WORLD);
 
-				I baseSize = (rows / solverComm.size);
-				if(solverComm.rank < (rows % solverComm.size)) {
-					baseSize = baseSize + 1;
-				}
-
+				I baseSize;
 				I startRow;
 
-				if(solverComm.rank <= (rows % solverComm.size)) {
-					startRow = ((rows / solverComm.size) + 1) * solverComm.rank;
-				}
-				else {
-					startRow = (((rows / solverComm.size) + 1) * (rows % solverComm.size)) + ((rows / solverComm.size) * (solverComm.rank - (rows % solverComm.size)));
-				}
+				cupcfd::data_structures::SparseMatrixSourceMeshGen<I,T> * meshGenSource = dynamic_cast<cupcfd::data_structures::SparseMatrixSourceMeshGen<I,T> *>(matrixSource);
 
-				// Row Indexes
-				for(I i = startRow; i < (startRow + baseSize); i++) {
-					I rowIndex = i + base;
-
-					I * columnIndexes;
-					I nColumnIndexes;
-
-					T * nnzValues;
-					I nNNZValues;
-
-					status = matrixSource->getRowColumnIndexes(rowIndex, &columnIndexes, &nColumnIndexes);
-					CHECK_ECODE(status)
-					status = matrixSource->getRowNNZValues(rowIndex, &nnzValues, &nNNZValues);
+				if(meshGenSource != nullptr) {
+					// Generated sources follow the mesh decomposition - use the rows generated on this rank
+					status = meshGenSource->getLocalRowRange(&startRow, &baseSize);
 					CHECK_ECODE(status)
-
-					for( I j = 0; j < nColumnIndexes; j++) {
-						// ToDo: Element by Element call is likely v.slow
-						status = matrix->setElement(i, columnIndexes[j] - base, nnzValues[j]);
-						CHECK_ECODE(status)
+					startRow = startRow - base;
+				}
+				else {
+					// For now, we will split the rows evenly across all communicators - this may not be representative
+					// of a mesh decomposition however
+					baseSize = (rows / solverComm.size);
+					if(solverComm.rank < (rows % solverComm.size)) {
+						baseSize = baseSize + 1;
 					}
 
-					free(columnIndexes);
-					free(nnzValues);
+					if(solverComm.rank <= (rows % solverComm.size)) {
+						startRow = ((rows / solverComm.size) + 1) * solverComm.rank;
+					}
+					else {
+						startRow = (((rows / solverComm.size) + 1) * (rows % solverComm.size)) + ((rows / solverComm.size) * (solverComm.rank - (rows % solverComm.size)));
+					}
 				}
 
+				// Only the rows of this rank are held, with a local column numbering and a ghost exchange
+				distributedMatrix = std::make_shared<cupcfd::data_structures::DistributedSparseMatrix<I,T>>(solverComm);
+				status = distributedMatrix->build(*matrixSource, startRow + base, baseSize);
+				CHECK_ECODE(status)
+
 				// Perform the initial setup for a linear solver system
-				// Matrix should be distributed (i.e. each rank has different rows)
+				// Matrix is distributed (i.e. each rank has different rows)
 				// This requires a parallel solver, and thus a non-serial communicator.
-
-				status = this->linearSolverConfig->buildLinearSolver(&solverSystem, *matrix, solverComm);
+				status = this->linearSolverConfig->buildLinearSolver(&solverSystem, *distributedMatrix);
 				CHECK_ECODE(status)
+
+				// No globally sized matrix is built - the vectors only cover the owned rows
+				nRowIndexes = distributedMatrix->nOwnedRows;
+				rowIndexes = (I *) malloc(sizeof(I) * nRowIndexes);
+
+				for(I i = 0; i < nRowIndexes; i++) {
+					rowIndexes[i] = distributedMatrix->rowStart + i;
+				}
 			}
 			else {
 				return cupcfd::error::E_ERROR;
@@ -201,19 +227,13 @@ namespace cupcfd
 			status = this->rhsSourceConfig->buildVectorSource(&solSource);
 			CHECK_ECODE(status)
 
-			// Get the non-zero rows assigned to this rank
-			I * rowIndexes;
-			I nRowIndexes;
-			status = matrix->getNonZeroRowIndexes(&rowIndexes, &nRowIndexes);
-			CHECK_ECODE(status)
-
 			// Setup a data array
 			T nData = nRowIndexes;
 			T * data = (T *) malloc(sizeof(T) * nData);
 
 			// Populate RHS Vector
 			std::shared_ptr<std::vector<T>> rhsVectorPtr = std::make_shared<std::vector<T>>();
-			status = rhsSource->getData(data, nData, rowIndexes, nRowIndexes, matrix->baseIndex);
+			status = rhsSource->getData(data, nData, rowIndexes, nRowIndexes, 0);
 			CHECK_ECODE(status)
 			for(I i = 0; i < nRowIndexes; i++) {
 				rhsVectorPtr->push_back(data[i]);
@@ -221,7 +241,7 @@ namespace cupcfd
 
 			// Populate Sol Vector
 			std::shared_ptr<std::vector<T>> solVectorPtr = std::make_shared<std::vector<T>>();
-			status = solSource->getData(data, nData, rowIndexes, nRowIndexes, matrix->baseIndex);
+			status = solSource->getData(data, nData, rowIndexes, nRowIndexes, 0);
 			CHECK_ECODE(status)
 			for(I i = 0; i < nRowIndexes; i++) {
 				solVectorPtr->push_back(data[i]);
@@ -238,9 +258,12 @@ namespace cupcfd
 			std::shared_ptr<cupcfd::linearsolvers::LinearSolverInterface<C,I,T>> solverSystemSharedPtr(solverSystem);
 
 			// Build Benchmark Object
-			*bench = new BenchmarkLinearSolver<C,I,T>(this->benchmarkName, this->repetitions, matrix, rhsVectorPtr, solVectorPtr, solverSystemSharedPtr);
-
-			delete matrixSource;
+			if(this->distType == BENCH_SOLVER_DIST_DISTRIBUTED) {
+				*bench = new BenchmarkLinearSolver<C,I,T>(this->benchmarkName, this->repetitions, rhsVectorPtr, solVectorPtr, distributedMatrix, solverSystemSharedPtr);
+			}
+			else {
+				*bench = new BenchmarkLinearSolver<C,I,T>(this->benchmarkName, this->repetitions, matrix, rhsVectorPtr, solVectorPtr, solverSystemSharedPtr);
+			}
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -0,0 +1,64 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the BenchmarkConfigMatrixAssembly class
+ */
+
+#include "BenchmarkConfigMatrixAssembly.h"
+
+#include "BenchmarkMatrixAssembly.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		BenchmarkConfigMatrixAssembly<I,T>::BenchmarkConfigMatrixAssembly(const std::string benchmarkName, const I repetitions)
+		: benchmarkName(benchmarkName),
+		  repetitions(repetitions)
+		{
+
+		}
+
+		template <class I, class T>
+		BenchmarkConfigMatrixAssembly<I,T>::BenchmarkConfigMatrixAssembly(const BenchmarkConfigMatrixAssembly<I,T>& source)
+		{
+			*this = source;
+		}
+
+		template <class I, class T>
+		BenchmarkConfigMatrixAssembly<I,T>::~BenchmarkConfigMatrixAssembly()
+		{
+
+		}
+
+		// === Concrete Methods ===
+
+		// === Overloaded Inherited Methods ===
+
+		template <class I, class T>
+		void BenchmarkConfigMatrixAssembly<I,T>::operator=(const BenchmarkConfigMatrixAssembly<I,T>& source)
+		{
+			this->benchmarkName = source.benchmarkName;
+			this->repetitions = source.repetitions;
+		}
+
+		template <class I, class T>
+		BenchmarkConfigMatrixAssembly<I,T> * BenchmarkConfigMatrixAssembly<I,T>::clone()
+		{
+			return new BenchmarkConfigMatrixAssembly<I,T>(*this);
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::benchmark::BenchmarkConfigMatrixAssembly<int, float>;
+template class cupcfd::benchmark::BenchmarkConfigMatrixAssembly<int, double>;
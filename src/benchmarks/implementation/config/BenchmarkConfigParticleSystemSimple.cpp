@@ -13,6 +13,7 @@
 #include "BenchmarkConfigParticleSystemSimple.h"
 #include "CupCfdAoSMesh.h"
 #include "CupCfdSoAMesh.h"
+#include "CupCfdAoSoAMesh.h"
 #include <memory>
 
 namespace cupcfd
@@ -96,3 +97,5 @@ template class cupcfd::benchmark::BenchmarkConfigParticleSystemSimple<cupcfd::ge
 
 template class cupcfd::benchmark::BenchmarkConfigParticleSystemSimple<cupcfd::geometry::mesh::CupCfdSoAMesh<int,float,int>,int,float,int>;
 template class cupcfd::benchmark::BenchmarkConfigParticleSystemSimple<cupcfd::geometry::mesh::CupCfdSoAMesh<int,double,int>,int,double,int>;
+template class cupcfd::benchmark::BenchmarkConfigParticleSystemSimple<cupcfd::geometry::mesh::CupCfdAoSoAMesh<int,float,int,CUPCFD_AOSOA_MESH_TILE_WIDTH>,int,float,int>;
+template class cupcfd::benchmark::BenchmarkConfigParticleSystemSimple<cupcfd::geometry::mesh::CupCfdAoSoAMesh<int,double,int,CUPCFD_AOSOA_MESH_TILE_WIDTH>,int,double,int>;
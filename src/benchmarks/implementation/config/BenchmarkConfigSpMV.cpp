@@ -0,0 +1,138 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the BenchmarkConfigSpMV class
+ */
+
+#include "BenchmarkConfigSpMV.h"
+#include "SparseMatrixSource.h"
+#include <memory>
+#include <cstdlib>
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		// === Constructors/Deconstructors ===
+		template <class I, class T>
+		BenchmarkConfigSpMV<I,T>::BenchmarkConfigSpMV(std::string benchmarkName, I repetitions,
+													  cupcfd::data_structures::SparseMatrixSourceConfig<I,T>& matrixSourceConfig)
+		: benchmarkName(benchmarkName),
+		  repetitions(repetitions)
+		{
+			this->matrixSourceConfig = matrixSourceConfig.clone();
+		}
+
+		template <class I, class T>
+		BenchmarkConfigSpMV<I,T>::BenchmarkConfigSpMV(const BenchmarkConfigSpMV<I,T>& source)
+		: matrixSourceConfig(nullptr)
+		{
+			*this = source;
+		}
+
+		template <class I, class T>
+		BenchmarkConfigSpMV<I,T>::~BenchmarkConfigSpMV()
+		{
+			delete(this->matrixSourceConfig);
+		}
+
+		// === Overloaded Inherited Methods ===
+
+		template <class I, class T>
+		void BenchmarkConfigSpMV<I,T>::operator=(const BenchmarkConfigSpMV<I,T>& source) {
+			this->benchmarkName = source.benchmarkName;
+			this->repetitions = source.repetitions;
+
+			delete(this->matrixSourceConfig);
+			this->matrixSourceConfig = source.matrixSourceConfig->clone();
+		}
+
+		template <class I, class T>
+		BenchmarkConfigSpMV<I,T> * BenchmarkConfigSpMV<I,T>::clone() {
+			return new BenchmarkConfigSpMV<I,T>(*this);
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMV<I,T>::buildBenchmark(BenchmarkSpMV<I,T> ** bench) {
+			cupcfd::error::eCodes status;
+			cupcfd::data_structures::SparseMatrixSource<I,T> * matrixSource;
+
+			// Build the Matrix Source
+			status = this->matrixSourceConfig->buildSparseMatrixSource(&matrixSource);
+			CHECK_ECODE(status)
+
+			// Get Matrix Size From Source
+			I rows, cols, base;
+
+			status = matrixSource->getNRows(&rows);
+			CHECK_ECODE(status)
+
+			status = matrixSource->getNCols(&cols);
+			CHECK_ECODE(status)
+
+			status = matrixSource->getMatrixIndicesBase(&base);
+			CHECK_ECODE(status)
+
+			// Make the new matrices with a base of 0
+			std::shared_ptr<cupcfd::data_structures::SparseMatrixCSR<I,T>> csr = std::make_shared<cupcfd::data_structures::SparseMatrixCSR<I,T>>(rows, cols, 0);
+			std::shared_ptr<cupcfd::data_structures::SparseMatrixCOO<I,T>> coo = std::make_shared<cupcfd::data_structures::SparseMatrixCOO<I,T>>(rows, cols, 0);
+			std::shared_ptr<cupcfd::data_structures::SparseMatrixSELL<I,T,BENCH_SPMV_SELL_C,BENCH_SPMV_SELL_SIGMA>> sell = std::make_shared<cupcfd::data_structures::SparseMatrixSELL<I,T,BENCH_SPMV_SELL_C,BENCH_SPMV_SELL_SIGMA>>(rows, cols, 0);
+
+			// Load the full matrix. The source provides complete rows in row order, so the
+			// CSR and COO stores can be appended to directly rather than via element-by-element
+			// insertion.
+			for(I i = 0; i < rows; i++) {
+				I rowIndex = i + base;
+
+				I * columnIndexes;
+				I nColumnIndexes;
+
+				T * nnzValues;
+				I nNNZValues;
+
+				status = matrixSource->getRowColumnIndexes(rowIndex, &columnIndexes, &nColumnIndexes);
+				CHECK_ECODE(status)
+				status = matrixSource->getRowNNZValues(rowIndex, &nnzValues, &nNNZValues);
+				CHECK_ECODE(status)
+
+				for(I j = 0; j < nColumnIndexes; j++) {
+					csr->JA.push_back(columnIndexes[j] - base);
+					csr->A.push_back(nnzValues[j]);
+
+					coo->row.push_back(i);
+					coo->col.push_back(columnIndexes[j] - base);
+					coo->val.push_back(nnzValues[j]);
+				}
+
+				csr->IA[i + 1] = csr->IA[i] + nColumnIndexes;
+
+				free(columnIndexes);
+				free(nnzValues);
+			}
+
+			csr->nnz = csr->IA[rows];
+			coo->nnz = csr->IA[rows];
+
+			// Build the SELL-C-sigma copy from the CSR structure
+			status = sell->fromCSR(*csr);
+			CHECK_ECODE(status)
+
+			// Build Benchmark Object
+			*bench = new BenchmarkSpMV<I,T>(this->benchmarkName, this->repetitions, csr, coo, sell);
+
+			delete matrixSource;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::benchmark::BenchmarkConfigSpMV<int, float>;
+template class cupcfd::benchmark::BenchmarkConfigSpMV<int, double>;
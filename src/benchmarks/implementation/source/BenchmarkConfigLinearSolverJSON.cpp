@@ -20,8 +20,10 @@
 #include "SparseMatrixCSR.h"
 
 #include "LinearSolverConfigPETScJSON.h"
+#include "LinearSolverConfigNativeJSON.h"
 
 #include "SparseMatrixSourceFileConfigJSON.h"
+#include "SparseMatrixSourceMeshGenConfigJSON.h"
 #include "VectorSourceFileConfigJSON.h"
 
 namespace cupcfd
@@ -98,6 +100,13 @@ namespace cupcfd
 					return status;
 				}
 
+				// Option 2 - Native Linear Solver
+				if(this->configData["LinearSolver"].isMember("LinearSolverNative")) {
+					cupcfd::linearsolvers::LinearSolverConfigNativeJSON<C,I,T> solverConfig(this->configData["LinearSolver"]["LinearSolverNative"]);
+					status = solverConfig.buildLinearSolverConfig(solverSystemConfig);
+					return status;
+				}
+
 				// Field not found
 				return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
 			}
@@ -112,12 +121,17 @@ namespace cupcfd
 
 			if(this->configData.isMember("SparseMatrix")) {
 				// Option 1 - Sparse Matrix from a File
-				// ToDo: Option 2: Add Matrix Gen From a MeshGenConfig
 				if(this->configData["SparseMatrix"].isMember("SparseMatrixFile")) {
 					cupcfd::data_structures::SparseMatrixSourceFileConfigJSON<I,T> configSource1(this->configData["SparseMatrix"]["SparseMatrixFile"]);
 					status = configSource1.buildSparseMatrixSourceConfig(matrixSourceConfig);
 					return status;
 				}
+				// Option 2 - Sparse Matrix generated from the mesh
+				else if(this->configData["SparseMatrix"].isMember("SparseMatrixMeshGen")) {
+					cupcfd::data_structures::SparseMatrixSourceMeshGenConfigJSON<I,T> configSource2(this->configData["SparseMatrix"]["SparseMatrixMeshGen"]);
+					status = configSource2.buildSparseMatrixSourceConfig(matrixSourceConfig);
+					return status;
+				}
 				else {
 					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
 				}
@@ -14,6 +14,7 @@
 
 #include "CupCfdAoSMesh.h"
 #include "CupCfdSoAMesh.h"
+#include "CupCfdAoSoAMesh.h"
 
 #include "DistributionConfigSourceFixedJSON.h"
 #include "DistributionConfigSourceNormalJSON.h"
@@ -223,3 +224,5 @@ template class cupcfd::benchmark::BenchmarkConfigParticleSystemSimpleJSON<cupcfd
 
 template class cupcfd::benchmark::BenchmarkConfigParticleSystemSimpleJSON<cupcfd::geometry::mesh::CupCfdSoAMesh<int,float,int>, int, float, int>;
 template class cupcfd::benchmark::BenchmarkConfigParticleSystemSimpleJSON<cupcfd::geometry::mesh::CupCfdSoAMesh<int,double,int>, int, double, int>;
+template class cupcfd::benchmark::BenchmarkConfigParticleSystemSimpleJSON<cupcfd::geometry::mesh::CupCfdAoSoAMesh<int,float,int,CUPCFD_AOSOA_MESH_TILE_WIDTH>, int, float, int>;
+template class cupcfd::benchmark::BenchmarkConfigParticleSystemSimpleJSON<cupcfd::geometry::mesh::CupCfdAoSoAMesh<int,double,int,CUPCFD_AOSOA_MESH_TILE_WIDTH>, int, double, int>;
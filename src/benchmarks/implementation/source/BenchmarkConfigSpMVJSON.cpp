@@ -0,0 +1,122 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Definition for the BenchmarkConfigSpMVJSON class.
+ */
+
+// Header for this class
+#include "BenchmarkConfigSpMVJSON.h"
+
+#include "SparseMatrixSourceFileConfigJSON.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		BenchmarkConfigSpMVJSON<I,T>::BenchmarkConfigSpMVJSON(Json::Value& parseJSON)
+		{
+			this->configData = parseJSON;
+		}
+
+		template <class I, class T>
+		BenchmarkConfigSpMVJSON<I,T>::~BenchmarkConfigSpMVJSON()
+		{
+			// Nothing to do currently
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMVJSON<I,T>::getBenchmarkName(std::string& benchmarkName) {
+			if(this->configData.isMember("BenchmarkName")) {
+				const Json::Value dataSourceType = this->configData["BenchmarkName"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					benchmarkName = dataSourceType.asString();
+					return cupcfd::error::E_SUCCESS;
+				}
+			}
+
+			// Field not found
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMVJSON<I,T>::getBenchmarkRepetitions(I * repetitions) {
+			if(this->configData.isMember("Repetitions")) {
+				const Json::Value dataSourceType = this->configData["Repetitions"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					*repetitions = dataSourceType.asLargestInt();
+					return cupcfd::error::E_SUCCESS;
+				}
+			}
+
+			// Field not found
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMVJSON<I,T>::getSparseMatrixSourceConfig(cupcfd::data_structures::SparseMatrixSourceConfig<I,T> ** matrixSourceConfig) {
+			cupcfd::error::eCodes status;
+
+			if(this->configData.isMember("SparseMatrix")) {
+				// Option 1 - Sparse Matrix from a File
+				if(this->configData["SparseMatrix"].isMember("SparseMatrixFile")) {
+					cupcfd::data_structures::SparseMatrixSourceFileConfigJSON<I,T> configSource1(this->configData["SparseMatrix"]["SparseMatrixFile"]);
+					status = configSource1.buildSparseMatrixSourceConfig(matrixSourceConfig);
+					return status;
+				}
+				else {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+			}
+
+			// Field not found
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMVJSON<I,T>::buildBenchmarkConfig(BenchmarkConfigSpMV<I,T> ** config) {
+			cupcfd::error::eCodes status;
+
+			// Get Benchmark Name
+			std::string benchmarkName;
+			status = this->getBenchmarkName(benchmarkName);
+			CHECK_ECODE(status)
+
+			// Get Repetitions
+			I repetitions;
+			status = this->getBenchmarkRepetitions(&repetitions);
+			CHECK_ECODE(status)
+
+			// Matrix Source Config
+			cupcfd::data_structures::SparseMatrixSourceConfig<I,T> * matrixSourceConfig;
+			status = this->getSparseMatrixSourceConfig(&matrixSourceConfig);
+			CHECK_ECODE(status)
+
+			*config = new BenchmarkConfigSpMV<I,T>(benchmarkName, repetitions, *matrixSourceConfig);
+
+			delete(matrixSourceConfig);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::benchmark::BenchmarkConfigSpMVJSON<int, float>;
+template class cupcfd::benchmark::BenchmarkConfigSpMVJSON<int, double>;
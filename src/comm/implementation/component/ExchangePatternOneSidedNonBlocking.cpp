@@ -205,10 +205,8 @@ namespace cupcfd
 
 		template <class T>
 		cupcfd::error::eCodes ExchangePatternOneSidedNonBlocking<T>::exchangeStart(T * sourceData, int nData) {
-			if (nData == 0) {
-				return cupcfd::error::E_NO_DATA;
-			}
-
+			// Note: A rank with no data (e.g. one that owns no cells) still opens and closes its epoch, but its
+			// send and receive groups are empty so it does not wait on any other rank.
 			cupcfd::error::eCodes status;
 
 			// Get MPI DataType
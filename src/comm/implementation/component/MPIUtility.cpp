@@ -38,6 +38,11 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			cupcfd::error::eCodes getMPIType(long long dummy __attribute__((unused)), MPI_Datatype * mpiType) {
+				*mpiType = MPI_LONG_LONG;
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			cupcfd::error::eCodes getMPIType(bool dummy __attribute__((unused)), MPI_Datatype * mpiType) {
 				*mpiType = MPI_CXX_BOOL;
 				return cupcfd::error::E_SUCCESS;
@@ -46,12 +46,36 @@ namespace cupcfd
 			this->xadj[0] = 0;
 
 			// Reset Maps to Empty Objects
-			this->nodeToIDX = std::map<T,I>();
-			this->IDXToNode = std::map<I,T>();
+			this->nodeToIDX = FlatHashMap<T,I>();
+			this->IDXToNode = std::vector<T>();
 		}
 
 		// === Concrete Methods ===
 
+		template <class I, class T>
+		void AdjacencyListCSR<I,T>::operator=(AdjacencyListVector<I,T>& source) {
+			this->reset();
+
+			// The local indexes are assigned in the same order, so the mappings can be copied as they are
+			this->nNodes = source.nNodes;
+			this->nEdges = source.nEdges;
+			this->nodeToIDX = source.nodeToIDX;
+			this->IDXToNode = source.IDXToNode;
+
+			this->xadj.resize(this->nNodes + 1);
+			this->xadj[0] = 0;
+
+			for(I i = 0; i < this->nNodes; i++) {
+				this->xadj[i+1] = this->xadj[i] + cupcfd::utility::drivers::safeConvertSizeT<I>(source.adjacencies[i].size());
+			}
+
+			this->adjncy.reserve(this->nEdges);
+
+			for(I i = 0; i < this->nNodes; i++) {
+				this->adjncy.insert(this->adjncy.end(), source.adjacencies[i].begin(), source.adjacencies[i].end());
+			}
+		}
+
 		// === CRTP Methods ===
 
 		template <class I, class T>
@@ -69,8 +93,8 @@ namespace cupcfd
 			this->xadj[0] = 0;
 
 			// Reset Maps to Empty Objects
-			this->nodeToIDX = std::map<T,I>();
-			this->IDXToNode = std::map<I,T>();
+			this->nodeToIDX = FlatHashMap<T,I>();
+			this->IDXToNode = std::vector<T>();
 		}
 
 		template <class I, class T>
@@ -83,7 +107,7 @@ namespace cupcfd
 
 				// Update Mappings
 				this->nodeToIDX[node] = nodeLocalIDX;
-				this->IDXToNode[nodeLocalIDX] = node;
+				this->IDXToNode.push_back(node);
 
 				// Add node, but as yet it does not have any adjacent elements, so the index it
 				// points to is the same as the one below.
@@ -258,5 +282,6 @@ namespace cupcfd
 // Explicit Instantiation
 
 template class cupcfd::data_structures::AdjacencyListCSR<int, int>;
+template class cupcfd::data_structures::AdjacencyListCSR<int, long>;
 template class cupcfd::data_structures::AdjacencyListCSR<int, float>;
 template class cupcfd::data_structures::AdjacencyListCSR<int, double>;
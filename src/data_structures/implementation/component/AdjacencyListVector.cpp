@@ -30,8 +30,8 @@ namespace cupcfd
 			this->nEdges = 0;
 
 			// Reset Maps to Empty Objects
-			this->nodeToIDX = std::map<T,I>();
-			this->IDXToNode = std::map<I,T>();
+			this->nodeToIDX = FlatHashMap<T,I>();
+			this->IDXToNode = std::vector<T>();
 
 			// Reset the vector object
 			this->adjacencies.clear();
@@ -45,8 +45,8 @@ namespace cupcfd
 			this->nEdges = 0;
 
 			// Reset Maps to Empty Objects
-			this->nodeToIDX = std::map<T,I>();
-			this->IDXToNode = std::map<I,T>();
+			this->nodeToIDX = FlatHashMap<T,I>();
+			this->IDXToNode = std::vector<T>();
 
 			// Reset the vector object
 			this->adjacencies.clear();
@@ -62,8 +62,8 @@ namespace cupcfd
 			this->nEdges = 0;
 
 			// Reset Maps to Empty Objects
-			this->nodeToIDX = std::map<T,I>();
-			this->IDXToNode = std::map<I,T>();
+			this->nodeToIDX = FlatHashMap<T,I>();
+			this->IDXToNode = std::vector<T>();
 
 			// Reset the vector object
 			this->adjacencies.clear();
@@ -81,7 +81,7 @@ namespace cupcfd
 
 				// Update Mappings
 				this->nodeToIDX[node] = nodeLocalIDX;
-				this->IDXToNode[nodeLocalIDX] = node;
+				this->IDXToNode.push_back(node);
 
 				// Add a new empty vector to the adjacencies list
 				this->adjacencies.push_back(std::vector<I>());
@@ -209,5 +209,6 @@ namespace cupcfd
 
 // Explicit Instantiation
 template class cupcfd::data_structures::AdjacencyListVector<int, int>;
+template class cupcfd::data_structures::AdjacencyListVector<int, long>;
 template class cupcfd::data_structures::AdjacencyListVector<int, float>;
 template class cupcfd::data_structures::AdjacencyListVector<int, double>;
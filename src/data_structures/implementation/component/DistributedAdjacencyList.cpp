@@ -12,6 +12,7 @@
 
 #include "DistributedAdjacencyList.h"
 #include <iostream>
+#include <limits>
 
 #include "Broadcast.h"
 #include "Barrier.h"
@@ -81,8 +82,13 @@ namespace cupcfd
 
 			this->finalized = false;
 
-			this->nodeDistType = std::map<T, nodeType>();
-			this->nodeOwner = std::map<T, I>();
+			this->nodeDistType.clear();
+			this->nodeOwner.clear();
+
+			this->nodeGhostLayer.clear();
+			this->nGhostLayers = 1;
+			this->ghostLayerXAdj.clear();
+			this->sendLayerAdjncy.clear();
 
 			// ToDo: Should some form of blocking barrier here be placed here to enforce consistency across processes?
 		}
@@ -134,6 +140,11 @@ namespace cupcfd
 			this->nodeToGlobal = source.nodeToGlobal;
 			this->globalToNode = source.globalToNode;
 
+			this->nodeGhostLayer = source.nodeGhostLayer;
+			this->nGhostLayers = source.nGhostLayers;
+			this->ghostLayerXAdj = source.ghostLayerXAdj;
+			this->sendLayerAdjncy = source.sendLayerAdjncy;
+
 			// this->processNodeCounts = (I *) malloc(sizeof(I) * this->comm->size);
 			// status = cupcfd::utility::drivers::copy(source.processNodeCounts, source.comm->size, this->processNodeCounts, this->comm->size);
 			// HARD_CHECK_ECODE(status)
@@ -332,12 +343,26 @@ namespace cupcfd
 			// (3) Update the global stats component of the graph
 			// =========================================================================================================
 
+			// The global counts are summed in the node type, which may be wider than the index type
+			T nLGhNodesSum = (T) this->nLGhNodes;
+			T nLONodesSum = (T) this->nLONodes;
+
 			// (3a) Allreduce on number of local ghost cells
-			status = cupcfd::comm::allReduceAdd(&(this->nLGhNodes), 1, &(this->nGGhNodes), 1, *(this->comm));
+			status = cupcfd::comm::allReduceAdd(&nLGhNodesSum, 1, &(this->nGGhNodes), 1, *(this->comm));
 			CHECK_ECODE(status)
 
 			// (3b) Allreduce on number of owned cells to total number of owned cells (assuming everything is correct)
-			status = cupcfd::comm::allReduceAdd(&(this->nLONodes), 1, &(this->nGNodes), 1, *(this->comm));
+			status = cupcfd::comm::allReduceAdd(&nLONodesSum, 1, &(this->nGNodes), 1, *(this->comm));
+			CHECK_ECODE(status)
+
+			// The global IDs assigned below are of the index type, so every owned node must fit in its range.
+			// Every rank has the same global count, so every rank returns here together.
+			if(this->nGNodes > (T) std::numeric_limits<I>::max()) {
+				return cupcfd::error::E_INVALID_INDEX;
+			}
+
+			// (3c) Identify the halo layer of each ghost cell, and the number of layers across all ranks
+			status = this->computeGhostLayers();
 			CHECK_ECODE(status)
 
 			// =========================================================================================================
@@ -356,6 +381,14 @@ namespace cupcfd
 			status = this->getGhostNodes(ghostNodes, this->nLGhNodes);
 			CHECK_ECODE(status)
 
+			// ===== Build an array of the ghost layer of each ghost cell on this process =====
+			// Only needed by the owners if there is more than one layer on some rank
+			I * ghostLayers = (I *) malloc(sizeof(I) * this->nLGhNodes);
+
+			for(I i = 0; i < this->nLGhNodes; i++) {
+				ghostLayers[i] = this->nodeGhostLayer[ghostNodes[i]];
+			}
+
 			// ===== Build an array of local owned cell global identifiers on this process =====
 			// Allocate space based on local owned node count.
 			T * localNodes = (T *) malloc(sizeof(T) * this->nLONodes);
@@ -439,6 +472,24 @@ namespace cupcfd
 				status = cupcfd::comm::Broadcast(ghostNodes, this->nLGhNodes, &recvGhostData, &nRecvGhostData, i, *(this->comm));
 				CHECK_ECODE(status)
 
+				// Along with the layer each ghost cell occupies on process i, so that deeper layers can be left out of
+				// shallower exchanges
+				FlatHashMap<T, I> recvGhostLayer;
+
+				if(this->nGhostLayers > 1) {
+					I * recvLayerData = nullptr;
+					I nRecvLayerData;
+					status = cupcfd::comm::Broadcast(ghostLayers, this->nLGhNodes, &recvLayerData, &nRecvLayerData, i, *(this->comm));
+					CHECK_ECODE(status)
+
+					recvGhostLayer.reserve(nRecvLayerData);
+					for(I j = 0; j < nRecvLayerData; j++) {
+						recvGhostLayer[recvGhostData[j]] = recvLayerData[j];
+					}
+
+					free(recvLayerData);
+				}
+
 				// (b)/(c) Identify which cells in the ghost cell list are in the local cell list via a set intersect (uses equality on nodes, precaution if extended in future
 				//		   with custom operator)
 				T * intersect = nullptr;
@@ -455,7 +506,7 @@ namespace cupcfd
 				T * ownership = nullptr;
 				I nOwnership = 0;
 
-				T * countOwned = nullptr;
+				I * countOwned = nullptr;
 				I nCountOwned = 0;
 
 				// Communicate the nodes which we own that have been requested as a ghost node by the root process
@@ -486,6 +537,14 @@ namespace cupcfd
 
 					for(I j = 0; j < nIntersect; j++) {
 						this->sendGlobalIDsAdjncy.push_back(intersectGID[j]);
+
+						if(this->nGhostLayers > 1) {
+							this->sendLayerAdjncy.push_back(recvGhostLayer[intersect[j]]);
+						}
+						else {
+							this->sendLayerAdjncy.push_back(1);
+						}
+
 						sendAdjncyPtr = sendAdjncyPtr + 1;
 					}
 				}
@@ -612,8 +671,8 @@ namespace cupcfd
 			// Get the ghost GIDs
 
 			T * ghosts = (T *) malloc(sizeof(T) * this->nLGhNodes);
-			T * ghostsGIDs = (T *) malloc(sizeof(T) * this->nLGhNodes);
-			T * ghostrank = (T *) malloc(sizeof(T) * this->nLGhNodes);
+			I * ghostsGIDs = (I *) malloc(sizeof(I) * this->nLGhNodes);
+			I * ghostrank = (I *) malloc(sizeof(I) * this->nLGhNodes);
 			status = this->getGhostNodes(ghosts, this->nLGhNodes);
 			CHECK_ECODE(status)
 
@@ -657,13 +716,18 @@ namespace cupcfd
 				CHECK_ECODE(status)
 			}
 
-			// Sort the send global ids within their groups
+			// Sort the send global ids within their groups, keeping the layers of the sent nodes in the same order
 			I numSendGlobalIDsXAdj = cupcfd::utility::drivers::safeConvertSizeT<I>(this->sendGlobalIDsXAdj.size());
 			for(I i = 0; i < numSendGlobalIDsXAdj-1; i++) {
 				I start = this->sendGlobalIDsXAdj[i];
 				I count = this->sendGlobalIDsXAdj[i+1] - this->sendGlobalIDsXAdj[i];
-				status = cupcfd::utility::drivers::merge_sort(&(this->sendGlobalIDsAdjncy[start]), count);
+
+				I * sendIndexes = (I *) malloc(sizeof(I) * count);
+				status = cupcfd::utility::drivers::merge_sort_index(&(this->sendGlobalIDsAdjncy[start]), count, sendIndexes, count);
 				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::sourceIndexReorder(&(this->sendLayerAdjncy[start]), count, sendIndexes, count);
+				CHECK_ECODE(status)
+				free(sendIndexes);
 			}
 
 			free(ghosts);
@@ -675,14 +739,29 @@ namespace cupcfd
 			// Cleanup
 			// =========================================================================================================
 			free(ghostNodes);
+			free(ghostLayers);
 			free(localNodes);
 
 			this->finalized = true;
 
-			// Sort the nodes so local nodes have lower local indexes than ghost nodes
+			// Sort the nodes so local nodes have lower local indexes than ghost nodes, and ghost nodes are
+			// grouped by layer
 			status = this->sortNodesByLocal();
 			CHECK_ECODE(status)
 
+			// Store the local index range of each ghost layer
+			this->ghostLayerXAdj.assign(this->nGhostLayers + 1, 0);
+			this->ghostLayerXAdj[0] = this->nLONodes;
+
+			for(I i = 0; i < this->nLGhNodes; i++) {
+				I layer = this->nodeGhostLayer[this->connGraph.IDXToNode[this->nLONodes + i]];
+				this->ghostLayerXAdj[layer] = this->ghostLayerXAdj[layer] + 1;
+			}
+
+			for(I l = 1; l <= this->nGhostLayers; l++) {
+				this->ghostLayerXAdj[l] = this->ghostLayerXAdj[l] + this->ghostLayerXAdj[l-1];
+			}
+
 			return cupcfd::error::E_SUCCESS;
 		}
 
@@ -724,9 +803,34 @@ namespace cupcfd
 			}
 
 			// (b) Get the list of nodes that are ghosts and add each node to the new adjacency list
+			//     With more than one ghost layer, they are grouped by layer (and remain in ascending order within a layer)
 			T * ghostNodes = (T *) malloc(sizeof(T) * this->nLGhNodes);
 			status = this->getGhostNodes(ghostNodes, this->nLGhNodes);
 			CHECK_ECODE(status)
+
+			if(this->nGhostLayers > 1) {
+				std::vector<I> layerPtr(this->nGhostLayers + 1, 0);
+
+				for(I i = 0; i < this->nLGhNodes; i++) {
+					layerPtr[this->nodeGhostLayer[ghostNodes[i]]] += 1;
+				}
+
+				for(I l = 1; l <= this->nGhostLayers; l++) {
+					layerPtr[l] = layerPtr[l] + layerPtr[l-1];
+				}
+
+				T * layerNodes = (T *) malloc(sizeof(T) * this->nLGhNodes);
+
+				for(I i = 0; i < this->nLGhNodes; i++) {
+					I layer = this->nodeGhostLayer[ghostNodes[i]];
+					layerNodes[layerPtr[layer-1]] = ghostNodes[i];
+					layerPtr[layer-1] = layerPtr[layer-1] + 1;
+				}
+
+				free(ghostNodes);
+				ghostNodes = layerNodes;
+			}
+
 			for(I i = 0; i < this->nLGhNodes; i++) {
 				status = sourceList.addNode(ghostNodes[i]);
 				CHECK_ECODE(status)
@@ -780,6 +884,81 @@ namespace cupcfd
 			return cupcfd::error::E_SUCCESS;
 		}
 
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedAdjacencyList<I, T>::computeGhostLayers() {
+			cupcfd::error::eCodes status;
+
+			// Breadth first search outwards from the locally owned nodes. The distance of each ghost node
+			// from the nearest locally owned node is its layer.
+			I nNodes = this->buildGraph.nNodes;
+			std::vector<I> distance(nNodes, -1);
+			std::vector<I> frontier;
+			std::vector<I> nextFrontier;
+
+			for(I i = 0; i < nNodes; i++) {
+				if(this->nodeDistType[this->buildGraph.IDXToNode[i]] == LOCAL) {
+					distance[i] = 0;
+					frontier.push_back(i);
+				}
+			}
+
+			I depth = 0;
+
+			while(frontier.size() > 0) {
+				depth = depth + 1;
+				nextFrontier.clear();
+
+				for(std::size_t i = 0; i < frontier.size(); i++) {
+					const std::vector<I>& adj = this->buildGraph.adjacencies[frontier[i]];
+
+					for(std::size_t j = 0; j < adj.size(); j++) {
+						if(distance[adj[j]] < 0) {
+							distance[adj[j]] = depth;
+							nextFrontier.push_back(adj[j]);
+						}
+					}
+				}
+
+				frontier.swap(nextFrontier);
+			}
+
+			// Ghost nodes that cannot be reached from a local node are treated as the first layer
+			I localLayers = 1;
+			this->nodeGhostLayer.clear();
+			this->nodeGhostLayer.reserve(this->nLGhNodes);
+
+			for(I i = 0; i < nNodes; i++) {
+				T node = this->buildGraph.IDXToNode[i];
+
+				if(this->nodeDistType[node] == GHOST) {
+					I layer = (distance[i] > 0) ? distance[i] : 1;
+					this->nodeGhostLayer[node] = layer;
+					localLayers = std::max(localLayers, layer);
+				}
+			}
+
+			status = cupcfd::comm::allReduceMax(&localLayers, 1, &(this->nGhostLayers), 1, *(this->comm));
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedAdjacencyList<I, T>::getGhostLayerRange(I layer, I * start, I * end) {
+			if(!this->finalized) {
+				return cupcfd::error::E_DISTGRAPH_UNFINALIZED;
+			}
+
+			if(layer < 1 || layer > this->nGhostLayers) {
+				return cupcfd::error::E_INVALID_INDEX;
+			}
+
+			*start = this->ghostLayerXAdj[layer-1];
+			*end = this->ghostLayerXAdj[layer];
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
 		template <class I, class T>
 		cupcfd::error::eCodes DistributedAdjacencyList<I, T>::getGhostNodes(T * nodes, I nNodes) {
 			auto it = this->nodeDistType.begin();
@@ -798,6 +977,9 @@ namespace cupcfd
 				it++;
 			}
 
+			// The map is unordered, so sort to return the nodes in ascending order
+			std::sort(nodes, nodes + ptr);
+
 			return cupcfd::error::E_SUCCESS;
 		}
 
@@ -819,6 +1001,233 @@ namespace cupcfd
 				it++;
 			}
 
+			// The map is unordered, so sort to return the nodes in ascending order
+			std::sort(nodes, nodes + ptr);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		std::size_t DistributedAdjacencyList<I, T>::getMapMemoryBytes() const {
+			return this->nodeDistType.getMemoryBytes()
+				 + this->nodeOwner.getMemoryBytes()
+				 + this->nodeToGlobal.getMemoryBytes()
+				 + this->globalToNode.getMemoryBytes()
+				 + this->nodeGhostLayer.getMemoryBytes()
+				 + this->connGraph.nodeToIDX.getMemoryBytes()
+				 + (this->connGraph.IDXToNode.capacity() * sizeof(T));
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedAdjacencyList<I, T>::writeSnapshot(cupcfd::io::SnapshotFile& file) {
+			cupcfd::error::eCodes status;
+
+			if(!this->finalized) {
+				return cupcfd::error::E_ADJACENCY_LIST_DISTRIBUTED_NOTFINALIZED;
+			}
+
+			I counts[6] = {this->nLONodes, this->nLGhNodes, this->nLEdges,
+						   this->globalOwnedRangeMin, this->globalOwnedRangeMax,
+						   (I) this->comm->size};
+
+			T globalCounts[3] = {this->nGNodes, this->nGGhNodes, this->nGEdges};
+
+			status = file.writeArray(counts, 6);
+			CHECK_ECODE(status)
+			status = file.writeArray(globalCounts, 3);
+			CHECK_ECODE(status)
+
+			// Node data by local index. The locally owned nodes come first, so the type of each node
+			// is implied by its index.
+			I nNodes = this->connGraph.nNodes;
+			std::vector<T> nodes(nNodes);
+			std::vector<I> owners(nNodes);
+			std::vector<I> globalIDs(nNodes);
+
+			for(I i = 0; i < nNodes; i++) {
+				T node = this->connGraph.IDXToNode[i];
+				nodes[i] = node;
+				owners[i] = (i < this->nLONodes) ? this->comm->rank : this->nodeOwner[node];
+				globalIDs[i] = this->nodeToGlobal[node];
+			}
+
+			status = file.writeVector(nodes);
+			CHECK_ECODE(status)
+			status = file.writeVector(owners);
+			CHECK_ECODE(status)
+			status = file.writeVector(globalIDs);
+			CHECK_ECODE(status)
+
+			status = file.writeVector(this->connGraph.xadj);
+			CHECK_ECODE(status)
+			status = file.writeVector(this->connGraph.adjncy);
+			CHECK_ECODE(status)
+
+			status = file.writeVector(this->neighbourRanks);
+			CHECK_ECODE(status)
+			status = file.writeVector(this->sendRank);
+			CHECK_ECODE(status)
+			status = file.writeVector(this->sendGlobalIDsXAdj);
+			CHECK_ECODE(status)
+			status = file.writeVector(this->sendGlobalIDsAdjncy);
+			CHECK_ECODE(status)
+			status = file.writeVector(this->recvRank);
+			CHECK_ECODE(status)
+			status = file.writeVector(this->recvGlobalIDsXAdj);
+			CHECK_ECODE(status)
+			status = file.writeVector(this->recvGlobalIDsAdjncy);
+			CHECK_ECODE(status)
+
+			status = file.writeArray(this->processNodeCounts, this->comm->size);
+			CHECK_ECODE(status)
+
+			status = file.writeVector(this->ghostLayerXAdj);
+			CHECK_ECODE(status)
+			status = file.writeVector(this->sendLayerAdjncy);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedAdjacencyList<I, T>::readSnapshot(cupcfd::io::SnapshotFile& file) {
+			cupcfd::error::eCodes status;
+
+			this->reset();
+
+			I counts[6];
+			status = file.readArray(counts, 6);
+			CHECK_ECODE(status)
+
+			T globalCounts[3];
+			status = file.readArray(globalCounts, 3);
+			CHECK_ECODE(status)
+
+			if(counts[5] != this->comm->size) {
+				return cupcfd::error::E_INVALID_FILE_FORMAT;
+			}
+
+			std::vector<T> nodes;
+			std::vector<I> owners;
+			std::vector<I> globalIDs;
+			std::vector<I> xadj;
+			std::vector<I> adjncy;
+
+			status = file.readVector(nodes);
+			CHECK_ECODE(status)
+			status = file.readVector(owners);
+			CHECK_ECODE(status)
+			status = file.readVector(globalIDs);
+			CHECK_ECODE(status)
+			status = file.readVector(xadj);
+			CHECK_ECODE(status)
+			status = file.readVector(adjncy);
+			CHECK_ECODE(status)
+
+			I nNodes = cupcfd::utility::drivers::safeConvertSizeT<I>(nodes.size());
+
+			if((nNodes != counts[0] + counts[1]) || (owners.size() != nodes.size()) || (globalIDs.size() != nodes.size()) ||
+			   (xadj.size() != nodes.size() + 1) || ((std::size_t) xadj[nNodes] != adjncy.size())) {
+				return cupcfd::error::E_INVALID_FILE_FORMAT;
+			}
+
+			// Rebuild the graph with the nodes in local index order, so they are given the same local indexes.
+			// The edges of each node are added in their stored order, so the CSR form is the same as well.
+			cupcfd::data_structures::AdjacencyListVector<I, T> sourceList;
+
+			for(I i = 0; i < nNodes; i++) {
+				status = sourceList.addNode(nodes[i]);
+				CHECK_ECODE(status)
+			}
+
+			for(I i = 0; i < nNodes; i++) {
+				for(I j = xadj[i]; j < xadj[i+1]; j++) {
+					if(adjncy[j] < 0 || adjncy[j] >= nNodes) {
+						return cupcfd::error::E_INVALID_FILE_FORMAT;
+					}
+
+					status = sourceList.addEdge(nodes[i], nodes[adjncy[j]]);
+					CHECK_ECODE(status)
+				}
+			}
+
+			this->buildGraph = sourceList;
+			this->connGraph = sourceList;
+
+			this->nodeDistType.reserve(nNodes);
+			this->nodeOwner.reserve(counts[1]);
+			this->nodeToGlobal.clear();
+			this->nodeToGlobal.reserve(nNodes);
+			this->globalToNode.clear();
+			this->globalToNode.reserve(nNodes);
+
+			for(I i = 0; i < nNodes; i++) {
+				if(i < counts[0]) {
+					this->nodeDistType[nodes[i]] = LOCAL;
+				}
+				else {
+					this->nodeDistType[nodes[i]] = GHOST;
+					this->nodeOwner[nodes[i]] = owners[i];
+				}
+
+				this->nodeToGlobal[nodes[i]] = globalIDs[i];
+				this->globalToNode[globalIDs[i]] = nodes[i];
+			}
+
+			status = file.readVector(this->neighbourRanks);
+			CHECK_ECODE(status)
+			status = file.readVector(this->sendRank);
+			CHECK_ECODE(status)
+			status = file.readVector(this->sendGlobalIDsXAdj);
+			CHECK_ECODE(status)
+			status = file.readVector(this->sendGlobalIDsAdjncy);
+			CHECK_ECODE(status)
+			status = file.readVector(this->recvRank);
+			CHECK_ECODE(status)
+			status = file.readVector(this->recvGlobalIDsXAdj);
+			CHECK_ECODE(status)
+			status = file.readVector(this->recvGlobalIDsAdjncy);
+			CHECK_ECODE(status)
+
+			this->processNodeCounts = (I *) malloc(sizeof(I) * this->comm->size);
+			status = file.readArray(this->processNodeCounts, this->comm->size);
+			CHECK_ECODE(status)
+
+			status = file.readVector(this->ghostLayerXAdj);
+			CHECK_ECODE(status)
+			status = file.readVector(this->sendLayerAdjncy);
+			CHECK_ECODE(status)
+
+			if((this->ghostLayerXAdj.size() < 2) || (this->ghostLayerXAdj[0] != counts[0]) ||
+			   (this->ghostLayerXAdj[this->ghostLayerXAdj.size() - 1] != nNodes) ||
+			   (this->sendLayerAdjncy.size() != this->sendGlobalIDsAdjncy.size())) {
+				return cupcfd::error::E_INVALID_FILE_FORMAT;
+			}
+
+			this->nGhostLayers = cupcfd::utility::drivers::safeConvertSizeT<I>(this->ghostLayerXAdj.size()) - 1;
+			this->nodeGhostLayer.reserve(counts[1]);
+
+			for(I l = 1; l <= this->nGhostLayers; l++) {
+				if(this->ghostLayerXAdj[l] < this->ghostLayerXAdj[l-1]) {
+					return cupcfd::error::E_INVALID_FILE_FORMAT;
+				}
+
+				for(I i = this->ghostLayerXAdj[l-1]; i < this->ghostLayerXAdj[l]; i++) {
+					this->nodeGhostLayer[nodes[i]] = l;
+				}
+			}
+
+			this->nLONodes = counts[0];
+			this->nLGhNodes = counts[1];
+			this->nLEdges = counts[2];
+			this->nGNodes = globalCounts[0];
+			this->nGGhNodes = globalCounts[1];
+			this->nGEdges = globalCounts[2];
+			this->globalOwnedRangeMin = counts[3];
+			this->globalOwnedRangeMax = counts[4];
+
+			this->finalized = true;
+
 			return cupcfd::error::E_SUCCESS;
 		}
 	} // namespace data_structures
@@ -826,3 +1235,4 @@ namespace cupcfd
 
 // Explicit Instantiation
 template class cupcfd::data_structures::DistributedAdjacencyList<int, int>;
+template class cupcfd::data_structures::DistributedAdjacencyList<int, long>;
@@ -0,0 +1,416 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the DistributedSparseMatrix class
+ */
+
+#include "DistributedSparseMatrix.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "Gather.h"
+#include "AllToAll.h"
+#include "Reduce.h"
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		template <class I, class T>
+		DistributedSparseMatrix<I,T>::DistributedSparseMatrix(cupcfd::comm::Communicator& comm)
+		: local(0, 0, 0)
+		{
+			this->comm = comm;
+			this->nGlobalRows = 0;
+			this->rowStart = 0;
+			this->nOwnedRows = 0;
+			this->nGhosts = 0;
+			this->exchangePattern = nullptr;
+			this->built = false;
+		}
+
+		template <class I, class T>
+		DistributedSparseMatrix<I,T>::~DistributedSparseMatrix() {
+			if(this->exchangePattern != nullptr) {
+				delete this->exchangePattern;
+			}
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedSparseMatrix<I,T>::build(SparseMatrixSource<I,T>& source, I startRow, I nRows) {
+			cupcfd::error::eCodes status;
+
+			I base;
+			status = source.getMatrixIndicesBase(&base);
+			CHECK_ECODE(status)
+
+			status = source.getNRows(&(this->nGlobalRows));
+			CHECK_ECODE(status)
+
+			this->rowStart = startRow - base;
+			this->nOwnedRows = nRows;
+			this->built = false;
+
+			if(this->exchangePattern != nullptr) {
+				delete this->exchangePattern;
+				this->exchangePattern = nullptr;
+			}
+
+			// === Row Ranges ===
+			// Store the first row of every rank, so the owner of any column can be found by a search
+			this->rankRowStart.resize(this->comm.size + 1);
+
+			if(this->comm.size > 1) {
+				status = cupcfd::comm::AllGather(&(this->rowStart), 1, &(this->rankRowStart[0]), this->comm.size, 1, this->comm);
+				CHECK_ECODE(status)
+			}
+			else {
+				this->rankRowStart[0] = this->rowStart;
+			}
+
+			this->rankRowStart[this->comm.size] = this->nGlobalRows;
+
+			// Every rank must agree the blocks are valid, else some ranks would enter the exchange setup alone
+			int invalid = 0;
+
+			if(this->rankRowStart[0] != 0 || this->rankRowStart[this->comm.rank + 1] != this->rowStart + this->nOwnedRows) {
+				invalid = 1;
+			}
+
+			for(int r = 0; r < this->comm.size; r++) {
+				if(this->rankRowStart[r + 1] < this->rankRowStart[r]) {
+					invalid = 1;
+				}
+			}
+
+			// === Read the owned rows (global columns, base 0) ===
+			// A failure of the source is only returned once every rank has reached the reduction below,
+			// else the other ranks would wait in it for this one
+			std::vector<I> rowPtr(this->nOwnedRows + 1, 0);
+			std::vector<I> globalCols;
+			std::vector<T> vals;
+			cupcfd::error::eCodes sourceStatus = cupcfd::error::E_SUCCESS;
+
+			for(I i = 0; i < this->nOwnedRows && invalid == 0; i++) {
+				I * rowCols;
+				I nRowCols;
+				T * rowVals;
+				I nRowVals;
+
+				sourceStatus = source.getRowColumnIndexes(this->rowStart + i + base, &rowCols, &nRowCols);
+				if(sourceStatus != cupcfd::error::E_SUCCESS) {
+					invalid = 3;
+					break;
+				}
+
+				sourceStatus = source.getRowNNZValues(this->rowStart + i + base, &rowVals, &nRowVals);
+				if(sourceStatus != cupcfd::error::E_SUCCESS) {
+					free(rowCols);
+					invalid = 3;
+					break;
+				}
+
+				for(I k = 0; k < nRowCols; k++) {
+					I col = rowCols[k] - base;
+
+					if(col < 0 || col >= this->nGlobalRows) {
+						invalid = 2;
+					}
+
+					globalCols.push_back(col);
+					vals.push_back(rowVals[k]);
+				}
+
+				rowPtr[i + 1] = rowPtr[i] + nRowCols;
+
+				free(rowCols);
+				free(rowVals);
+			}
+
+			int globalInvalid = invalid;
+
+			if(this->comm.size > 1) {
+				status = cupcfd::comm::allReduceMax(&invalid, 1, &globalInvalid, 1, this->comm);
+				CHECK_ECODE(status)
+			}
+
+			if(globalInvalid == 3) {
+				// Report the error of the source on the ranks where it failed
+				if(sourceStatus != cupcfd::error::E_SUCCESS) {
+					return sourceStatus;
+				}
+
+				return cupcfd::error::E_ERROR;
+			}
+			else if(globalInvalid == 1) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+			else if(globalInvalid == 2) {
+				return cupcfd::error::E_MATRIX_COL_OOB;
+			}
+
+			// === Ghost Columns ===
+			// Columns outside of the owned block, unique and in ascending global order
+			I rowEnd = this->rowStart + this->nOwnedRows;
+			I nnz = rowPtr[this->nOwnedRows];
+
+			this->ghostGlobalIDs.clear();
+
+			for(I k = 0; k < nnz; k++) {
+				if(globalCols[k] < this->rowStart || globalCols[k] >= rowEnd) {
+					this->ghostGlobalIDs.push_back(globalCols[k]);
+				}
+			}
+
+			std::sort(this->ghostGlobalIDs.begin(), this->ghostGlobalIDs.end());
+			this->ghostGlobalIDs.erase(std::unique(this->ghostGlobalIDs.begin(), this->ghostGlobalIDs.end()), this->ghostGlobalIDs.end());
+			this->nGhosts = this->ghostGlobalIDs.size();
+
+			// === Local Matrix ===
+			std::vector<I> localRows(nnz);
+			std::vector<I> localCols(nnz);
+
+			this->interiorRows.clear();
+			this->boundaryRows.clear();
+
+			for(I i = 0; i < this->nOwnedRows; i++) {
+				bool hasGhost = false;
+
+				for(I k = rowPtr[i]; k < rowPtr[i + 1]; k++) {
+					localRows[k] = i;
+
+					status = this->getLocalColumnIndex(globalCols[k], &(localCols[k]));
+					CHECK_ECODE(status)
+
+					if(localCols[k] >= this->nOwnedRows) {
+						hasGhost = true;
+					}
+				}
+
+				if(hasGhost) {
+					this->boundaryRows.push_back(i);
+				}
+				else {
+					this->interiorRows.push_back(i);
+				}
+			}
+
+			status = this->local.clear();
+			CHECK_ECODE(status)
+
+			status = this->local.resize(this->nOwnedRows, this->nOwnedRows + this->nGhosts);
+			CHECK_ECODE(status)
+
+			status = this->local.setElements(localRows.data(), localCols.data(), vals.data(), nnz);
+			CHECK_ECODE(status)
+
+			// === Exchange Pattern ===
+			// A single rank has no ghosts, and the exchange setup requires more than one rank
+			if(this->comm.size > 1) {
+				// Ghosts are sorted by global ID, and so are grouped by ascending owner
+				std::vector<int> sendCounts(this->comm.size, 0);
+				std::vector<int> recvCounts(this->comm.size, 0);
+
+				for(I i = 0; i < this->nGhosts; i++) {
+					int owner = (std::upper_bound(this->rankRowStart.begin(), this->rankRowStart.end(), this->ghostGlobalIDs[i]) - this->rankRowStart.begin()) - 1;
+					sendCounts[owner] = sendCounts[owner] + 1;
+				}
+
+				status = cupcfd::comm::AllToAll(sendCounts.data(), this->comm.size, recvCounts.data(), this->comm.size, 1, this->comm);
+				CHECK_ECODE(status)
+
+				I nRequested = 0;
+
+				for(int r = 0; r < this->comm.size; r++) {
+					nRequested = nRequested + recvCounts[r];
+				}
+
+				// Global IDs of owned entries that other ranks hold as ghosts, and the rank that requested each
+				std::vector<I> requestedIDs(nRequested);
+				std::vector<I> requestRanks(nRequested);
+
+				status = cupcfd::comm::AllToAll(this->ghostGlobalIDs.data(), this->nGhosts, sendCounts.data(), this->comm.size,
+												requestedIDs.data(), nRequested, recvCounts.data(), this->comm.size,
+												this->comm);
+				CHECK_ECODE(status)
+
+				I ptr = 0;
+
+				for(int r = 0; r < this->comm.size; r++) {
+					for(int k = 0; k < recvCounts[r]; k++) {
+						requestRanks[ptr] = r;
+						ptr = ptr + 1;
+					}
+				}
+
+				// Local column to global ID
+				I nMapLocalToExchangeIDX = this->nOwnedRows + this->nGhosts;
+				std::vector<I> mapLocalToExchangeIDX(nMapLocalToExchangeIDX);
+
+				for(I i = 0; i < nMapLocalToExchangeIDX; i++) {
+					status = this->getGlobalColumnIndex(i, &(mapLocalToExchangeIDX[i]));
+					CHECK_ECODE(status)
+				}
+
+				this->exchangePattern = new cupcfd::comm::ExchangePatternTwoSidedNonBlocking<T>();
+
+				status = this->exchangePattern->init(this->comm,
+													 mapLocalToExchangeIDX.data(), nMapLocalToExchangeIDX,
+													 requestedIDs.data(), nRequested,
+													 requestRanks.data(), nRequested);
+				CHECK_ECODE(status)
+			}
+
+			this->built = true;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedSparseMatrix<I,T>::getGlobalColumnIndex(I localCol, I * globalCol) {
+			if(localCol < 0 || localCol >= this->nOwnedRows + this->nGhosts) {
+				return cupcfd::error::E_INVALID_INDEX;
+			}
+
+			if(localCol < this->nOwnedRows) {
+				*globalCol = this->rowStart + localCol;
+			}
+			else {
+				*globalCol = this->ghostGlobalIDs[localCol - this->nOwnedRows];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedSparseMatrix<I,T>::getLocalColumnIndex(I globalCol, I * localCol) {
+			if(globalCol >= this->rowStart && globalCol < this->rowStart + this->nOwnedRows) {
+				*localCol = globalCol - this->rowStart;
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			typename std::vector<I>::iterator it = std::lower_bound(this->ghostGlobalIDs.begin(), this->ghostGlobalIDs.end(), globalCol);
+
+			if(it == this->ghostGlobalIDs.end() || *it != globalCol) {
+				return cupcfd::error::E_INVALID_INDEX;
+			}
+
+			*localCol = this->nOwnedRows + (it - this->ghostGlobalIDs.begin());
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedSparseMatrix<I,T>::haloExchangeStart(T * x, I nX) {
+			cupcfd::error::eCodes status;
+
+			if(!this->built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
+			if(nX != this->nOwnedRows + this->nGhosts) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			if(this->exchangePattern != nullptr) {
+				status = this->exchangePattern->exchangeStart(x, nX);
+				CHECK_ECODE(status)
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedSparseMatrix<I,T>::haloExchangeStop(T * x, I nX) {
+			cupcfd::error::eCodes status;
+
+			if(this->exchangePattern != nullptr) {
+				status = this->exchangePattern->exchangeStop(x, nX);
+				CHECK_ECODE(status)
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedSparseMatrix<I,T>::haloExchange(T * x, I nX) {
+			cupcfd::error::eCodes status;
+
+			status = this->haloExchangeStart(x, nX);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			status = this->haloExchangeStop(x, nX);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedSparseMatrix<I,T>::multiply(T * x, I nX, T * y, I nY) {
+			cupcfd::error::eCodes status;
+
+			if(nY != this->nOwnedRows) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			status = this->haloExchangeStart(x, nX);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			const I * IA = this->local.IA.data();
+			const I * JA = this->local.JA.data();
+			const T * A = this->local.A.data();
+			const I base = this->local.baseIndex;
+
+			// Rows that only use owned entries do not need to wait for the exchange
+			const I * rows = this->interiorRows.data();
+			I nRows = this->interiorRows.size();
+
+			#pragma omp parallel for schedule(static)
+			for(I r = 0; r < nRows; r++) {
+				I i = rows[r];
+				T sum = T(0);
+
+				for(I j = IA[i]; j < IA[i + 1]; j++) {
+					sum = sum + (A[j] * x[JA[j] - base]);
+				}
+
+				y[i] = sum;
+			}
+
+			status = this->haloExchangeStop(x, nX);
+			CHECK_ECODE(status)
+
+			rows = this->boundaryRows.data();
+			nRows = this->boundaryRows.size();
+
+			#pragma omp parallel for schedule(static)
+			for(I r = 0; r < nRows; r++) {
+				I i = rows[r];
+				T sum = T(0);
+
+				for(I j = IA[i]; j < IA[i + 1]; j++) {
+					sum = sum + (A[j] * x[JA[j] - base]);
+				}
+
+				y[i] = sum;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::data_structures::DistributedSparseMatrix<int, float>;
+template class cupcfd::data_structures::DistributedSparseMatrix<int, double>;
@@ -0,0 +1,535 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the GraphColouring class
+ */
+
+#include "GraphColouring.h"
+
+#include <algorithm>
+
+// Worklists smaller than this are coloured on a single thread, since the speculative rounds
+// cost more than they save. A single thread colours in item order, so the result is deterministic.
+#define CUPCFD_COLOURING_MIN_PARALLEL_ITEMS 4096
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		template <class I>
+		GraphColouring<I>::GraphColouring()
+		{
+			this->reset();
+		}
+
+		template <class I>
+		GraphColouring<I>::~GraphColouring() {
+			// Nothing to do currently, vectors will cleanup themselves on destructor call
+		}
+
+		template <class I>
+		void GraphColouring<I>::reset() {
+			this->nItems = 0;
+			this->nColours = 0;
+			this->nRounds = 0;
+			this->imbalance = 1.0;
+
+			this->colours.clear();
+			this->colourXAdj.assign(1, 0);
+			this->colourItems.clear();
+		}
+
+		template <class I>
+		cupcfd::error::eCodes GraphColouring<I>::colourGraph(const I * xadj, const I * adjncy, I nNodes, I base, I distance, bool balance) {
+			if(distance != 1 && distance != 2) {
+				return cupcfd::error::E_INVALID_INDEX;
+			}
+
+			std::vector<I> conflictXAdj;
+			std::vector<I> conflictAdjncy;
+
+			this->buildGraphConflicts(xadj, adjncy, nNodes, base, conflictXAdj, conflictAdjncy);
+
+			if(distance == 2) {
+				std::vector<I> xadj2;
+				std::vector<I> adjncy2;
+
+				this->expandDistance2(conflictXAdj, conflictAdjncy, xadj2, adjncy2);
+				conflictXAdj.swap(xadj2);
+				conflictAdjncy.swap(adjncy2);
+			}
+
+			std::vector<bool> active(nNodes, true);
+			this->colourConflicts(conflictXAdj, conflictAdjncy, active, balance);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I>
+		cupcfd::error::eCodes GraphColouring<I>::colourIncidence(const I * xadj, const I * adjncy, I nItems, I nTargets,
+																	I base, I distance, bool balance) {
+			if(distance != 1 && distance != 2) {
+				return cupcfd::error::E_INVALID_INDEX;
+			}
+
+			// === Reverse Incidence ===
+			// The items that touch each target
+			std::vector<I> targetXAdj(nTargets + 1, 0);
+			std::vector<bool> active(nItems, false);
+
+			for(I i = 0; i < nItems; i++) {
+				for(I j = xadj[i]; j < xadj[i + 1]; j++) {
+					I target = adjncy[j] - base;
+
+					if(target >= 0 && target < nTargets) {
+						targetXAdj[target + 1] = targetXAdj[target + 1] + 1;
+						active[i] = true;
+					}
+				}
+			}
+
+			for(I t = 0; t < nTargets; t++) {
+				targetXAdj[t + 1] = targetXAdj[t + 1] + targetXAdj[t];
+			}
+
+			std::vector<I> targetItems(targetXAdj[nTargets]);
+			std::vector<I> ptr(targetXAdj.begin(), targetXAdj.end() - 1);
+
+			for(I i = 0; i < nItems; i++) {
+				for(I j = xadj[i]; j < xadj[i + 1]; j++) {
+					I target = adjncy[j] - base;
+
+					if(target >= 0 && target < nTargets) {
+						targetItems[ptr[target]] = i;
+						ptr[target] = ptr[target] + 1;
+					}
+				}
+			}
+
+			// === Conflict Graph ===
+			// Items conflict with every other item that touches one of their targets.
+			// A stamp per item avoids listing a conflict twice when items share both targets.
+			std::vector<I> lastMarked(nItems, -1);
+			std::vector<I> conflictXAdj(nItems + 1, 0);
+			std::vector<I> conflictAdjncy;
+
+			for(I i = 0; i < nItems; i++) {
+				lastMarked[i] = i;
+
+				for(I j = xadj[i]; j < xadj[i + 1]; j++) {
+					I target = adjncy[j] - base;
+
+					if(target >= 0 && target < nTargets) {
+						for(I k = targetXAdj[target]; k < targetXAdj[target + 1]; k++) {
+							I item = targetItems[k];
+
+							if(lastMarked[item] != i) {
+								lastMarked[item] = i;
+								conflictAdjncy.push_back(item);
+							}
+						}
+					}
+				}
+
+				conflictXAdj[i + 1] = (I) conflictAdjncy.size();
+			}
+
+			if(distance == 2) {
+				std::vector<I> xadj2;
+				std::vector<I> adjncy2;
+
+				this->expandDistance2(conflictXAdj, conflictAdjncy, xadj2, adjncy2);
+				conflictXAdj.swap(xadj2);
+				conflictAdjncy.swap(adjncy2);
+			}
+
+			this->colourConflicts(conflictXAdj, conflictAdjncy, active, balance);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I>
+		bool GraphColouring<I>::isValid(const I * xadj, const I * adjncy, I base, I distance) {
+			std::vector<I> conflictXAdj;
+			std::vector<I> conflictAdjncy;
+
+			this->buildGraphConflicts(xadj, adjncy, this->nItems, base, conflictXAdj, conflictAdjncy);
+
+			if(distance == 2) {
+				std::vector<I> xadj2;
+				std::vector<I> adjncy2;
+
+				this->expandDistance2(conflictXAdj, conflictAdjncy, xadj2, adjncy2);
+				conflictXAdj.swap(xadj2);
+				conflictAdjncy.swap(adjncy2);
+			}
+
+			for(I i = 0; i < this->nItems; i++) {
+				if(this->colours[i] < 0) {
+					return false;
+				}
+
+				for(I j = conflictXAdj[i]; j < conflictXAdj[i + 1]; j++) {
+					if(this->colours[conflictAdjncy[j]] == this->colours[i]) {
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		template <class I>
+		void GraphColouring<I>::buildGraphConflicts(const I * xadj, const I * adjncy, I nNodes, I base,
+													 std::vector<I>& conflictXAdj, std::vector<I>& conflictAdjncy) {
+			// Each in-range edge is stored in both directions, so that the speculative conflict
+			// check sees every conflict from both ends even if the graph is not symmetric.
+			std::vector<I> count(nNodes + 1, 0);
+
+			for(I i = 0; i < nNodes; i++) {
+				for(I j = xadj[i]; j < xadj[i + 1]; j++) {
+					I adj = adjncy[j] - base;
+
+					if(adj >= 0 && adj < nNodes && adj != i) {
+						count[i + 1] = count[i + 1] + 1;
+						count[adj + 1] = count[adj + 1] + 1;
+					}
+				}
+			}
+
+			for(I i = 0; i < nNodes; i++) {
+				count[i + 1] = count[i + 1] + count[i];
+			}
+
+			std::vector<I> edges(count[nNodes]);
+			std::vector<I> ptr(count.begin(), count.end() - 1);
+
+			for(I i = 0; i < nNodes; i++) {
+				for(I j = xadj[i]; j < xadj[i + 1]; j++) {
+					I adj = adjncy[j] - base;
+
+					if(adj >= 0 && adj < nNodes && adj != i) {
+						edges[ptr[i]] = adj;
+						ptr[i] = ptr[i] + 1;
+						edges[ptr[adj]] = i;
+						ptr[adj] = ptr[adj] + 1;
+					}
+				}
+			}
+
+			// Remove the duplicates of symmetric edges
+			std::vector<I> lastMarked(nNodes, -1);
+			conflictXAdj.assign(nNodes + 1, 0);
+			conflictAdjncy.clear();
+			conflictAdjncy.reserve(edges.size());
+
+			for(I i = 0; i < nNodes; i++) {
+				for(I j = count[i]; j < count[i + 1]; j++) {
+					if(lastMarked[edges[j]] != i) {
+						lastMarked[edges[j]] = i;
+						conflictAdjncy.push_back(edges[j]);
+					}
+				}
+
+				conflictXAdj[i + 1] = (I) conflictAdjncy.size();
+			}
+		}
+
+		template <class I>
+		void GraphColouring<I>::expandDistance2(const std::vector<I>& xadj, const std::vector<I>& adjncy,
+												std::vector<I>& xadj2, std::vector<I>& adjncy2) {
+			I n = (I) xadj.size() - 1;
+			std::vector<I> lastMarked(n, -1);
+
+			xadj2.assign(n + 1, 0);
+			adjncy2.clear();
+
+			for(I i = 0; i < n; i++) {
+				lastMarked[i] = i;
+
+				for(I j = xadj[i]; j < xadj[i + 1]; j++) {
+					I adj = adjncy[j];
+
+					if(lastMarked[adj] != i) {
+						lastMarked[adj] = i;
+						adjncy2.push_back(adj);
+					}
+
+					for(I k = xadj[adj]; k < xadj[adj + 1]; k++) {
+						I adj2 = adjncy[k];
+
+						if(lastMarked[adj2] != i) {
+							lastMarked[adj2] = i;
+							adjncy2.push_back(adj2);
+						}
+					}
+				}
+
+				xadj2[i + 1] = (I) adjncy2.size();
+			}
+		}
+
+		template <class I>
+		void GraphColouring<I>::colourConflicts(const std::vector<I>& xadj, const std::vector<I>& adjncy,
+												const std::vector<bool>& active, bool balance) {
+			I n = (I) active.size();
+
+			this->nItems = n;
+			this->nRounds = 0;
+			this->colours.assign(n, -1);
+
+			// A first-fit colour is at most the number of conflicts of the item
+			I maxDegree = 0;
+
+			for(I i = 0; i < n; i++) {
+				maxDegree = std::max(maxDegree, xadj[i + 1] - xadj[i]);
+			}
+
+			std::vector<I> work;
+			work.reserve(n);
+
+			for(I i = 0; i < n; i++) {
+				if(active[i]) {
+					work.push_back(i);
+				}
+			}
+
+			std::vector<char> conflict;
+			I * colours = this->colours.data();
+			const I * conflictXAdj = xadj.data();
+			const I * conflictAdjncy = adjncy.data();
+
+			while(work.size() > 0) {
+				I nWork = (I) work.size();
+				const I * workItems = work.data();
+
+				this->nRounds = this->nRounds + 1;
+
+				// === Tentative Colouring ===
+				// Neighbours being coloured at the same time may be read before or after their update,
+				// so the reads and writes of colours are atomic and any clashes are fixed below.
+				#pragma omp parallel if(nWork >= CUPCFD_COLOURING_MIN_PARALLEL_ITEMS)
+				{
+					// Track the item that most recently marked each colour as forbidden,
+					// so the array does not need to be cleared between items
+					std::vector<I> forbidden(maxDegree + 1, -1);
+
+					#pragma omp for schedule(static)
+					for(I k = 0; k < nWork; k++) {
+						I i = workItems[k];
+
+						for(I j = conflictXAdj[i]; j < conflictXAdj[i + 1]; j++) {
+							I adjColour;
+
+							#pragma omp atomic read
+							adjColour = colours[conflictAdjncy[j]];
+
+							if(adjColour >= 0 && adjColour <= maxDegree) {
+								forbidden[adjColour] = i;
+							}
+						}
+
+						I colour = 0;
+						while(forbidden[colour] == i) {
+							colour = colour + 1;
+						}
+
+						#pragma omp atomic write
+						colours[i] = colour;
+					}
+				}
+
+				// === Conflict Detection ===
+				// Of two neighbours that picked the same colour, the higher index is coloured again
+				conflict.assign(nWork, 0);
+				char * conflictFlags = conflict.data();
+
+				#pragma omp parallel for schedule(static) if(nWork >= CUPCFD_COLOURING_MIN_PARALLEL_ITEMS)
+				for(I k = 0; k < nWork; k++) {
+					I i = workItems[k];
+
+					for(I j = conflictXAdj[i]; j < conflictXAdj[i + 1]; j++) {
+						I adj = conflictAdjncy[j];
+
+						if(adj < i && colours[adj] == colours[i]) {
+							conflictFlags[k] = 1;
+							break;
+						}
+					}
+				}
+
+				I nConflicts = 0;
+
+				for(I k = 0; k < nWork; k++) {
+					if(conflictFlags[k]) {
+						colours[work[k]] = -1;
+						work[nConflicts] = work[k];
+						nConflicts = nConflicts + 1;
+					}
+				}
+
+				work.resize(nConflicts);
+			}
+
+			this->nColours = 0;
+
+			for(I i = 0; i < n; i++) {
+				this->nColours = std::max(this->nColours, colours[i] + 1);
+			}
+
+			if(balance) {
+				this->balanceColours(xadj, adjncy);
+			}
+
+			this->groupColours();
+		}
+
+		template <class I>
+		void GraphColouring<I>::balanceColours(const std::vector<I>& xadj, const std::vector<I>& adjncy) {
+			if(this->nColours < 2) {
+				return;
+			}
+
+			std::vector<I> size(this->nColours, 0);
+			I nColoured = 0;
+
+			for(I i = 0; i < this->nItems; i++) {
+				if(this->colours[i] >= 0) {
+					size[this->colours[i]] = size[this->colours[i]] + 1;
+					nColoured = nColoured + 1;
+				}
+			}
+
+			// Colours larger than the rounded up mean give up items to the smallest colour below the
+			// mean that none of the item's neighbours use. The number of colours never increases.
+			I target = (nColoured + this->nColours - 1) / this->nColours;
+			std::vector<I> forbidden(this->nColours, -1);
+
+			for(I i = 0; i < this->nItems; i++) {
+				I colour = this->colours[i];
+
+				if(colour < 0 || size[colour] <= target) {
+					continue;
+				}
+
+				for(I j = xadj[i]; j < xadj[i + 1]; j++) {
+					I adjColour = this->colours[adjncy[j]];
+
+					if(adjColour >= 0) {
+						forbidden[adjColour] = i;
+					}
+				}
+
+				I best = -1;
+
+				for(I c = 0; c < this->nColours; c++) {
+					if(forbidden[c] != i && size[c] < target && (best < 0 || size[c] < size[best])) {
+						best = c;
+					}
+				}
+
+				if(best >= 0) {
+					this->colours[i] = best;
+					size[colour] = size[colour] - 1;
+					size[best] = size[best] + 1;
+				}
+			}
+		}
+
+		template <class I>
+		void GraphColouring<I>::groupColours() {
+			this->colourXAdj.assign(this->nColours + 1, 0);
+
+			for(I i = 0; i < this->nItems; i++) {
+				if(this->colours[i] >= 0) {
+					this->colourXAdj[this->colours[i] + 1] = this->colourXAdj[this->colours[i] + 1] + 1;
+				}
+			}
+
+			I maxSize = 0;
+
+			for(I c = 0; c < this->nColours; c++) {
+				maxSize = std::max(maxSize, this->colourXAdj[c + 1]);
+				this->colourXAdj[c + 1] = this->colourXAdj[c + 1] + this->colourXAdj[c];
+			}
+
+			this->colourItems.resize(this->colourXAdj[this->nColours]);
+			std::vector<I> ptr(this->colourXAdj.begin(), this->colourXAdj.end() - 1);
+
+			for(I i = 0; i < this->nItems; i++) {
+				if(this->colours[i] >= 0) {
+					this->colourItems[ptr[this->colours[i]]] = i;
+					ptr[this->colours[i]] = ptr[this->colours[i]] + 1;
+				}
+			}
+
+			if(this->nColours > 0 && this->colourXAdj[this->nColours] > 0) {
+				double mean = ((double) this->colourXAdj[this->nColours]) / ((double) this->nColours);
+				this->imbalance = ((double) maxSize) / mean;
+			}
+			else {
+				this->imbalance = 1.0;
+			}
+		}
+
+		template <class I>
+		cupcfd::error::eCodes GraphColouring<I>::writeSnapshot(cupcfd::io::SnapshotFile& file) {
+			cupcfd::error::eCodes status;
+
+			I counts[3] = {this->nItems, this->nColours, this->nRounds};
+
+			status = file.writeArray(counts, 3);
+			CHECK_ECODE(status)
+			status = file.writeArray(&(this->imbalance), 1);
+			CHECK_ECODE(status)
+			status = file.writeVector(this->colours);
+			CHECK_ECODE(status)
+			status = file.writeVector(this->colourXAdj);
+			CHECK_ECODE(status)
+			status = file.writeVector(this->colourItems);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I>
+		cupcfd::error::eCodes GraphColouring<I>::readSnapshot(cupcfd::io::SnapshotFile& file) {
+			cupcfd::error::eCodes status;
+
+			I counts[3];
+
+			status = file.readArray(counts, 3);
+			CHECK_ECODE(status)
+			status = file.readArray(&(this->imbalance), 1);
+			CHECK_ECODE(status)
+			status = file.readVector(this->colours);
+			CHECK_ECODE(status)
+			status = file.readVector(this->colourXAdj);
+			CHECK_ECODE(status)
+			status = file.readVector(this->colourItems);
+			CHECK_ECODE(status)
+
+			this->nItems = counts[0];
+			this->nColours = counts[1];
+			this->nRounds = counts[2];
+
+			if((this->colours.size() != (std::size_t) this->nItems) ||
+			   (this->colourXAdj.size() != (std::size_t) this->nColours + 1) ||
+			   (this->colourItems.size() != (std::size_t) this->colourXAdj[this->nColours])) {
+				this->reset();
+				return cupcfd::error::E_INVALID_FILE_FORMAT;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::data_structures::GraphColouring<int>;
@@ -0,0 +1,378 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the SparseMatrixBSR class.
+ *
+ */
+
+#include "SparseMatrixBSR.h"
+#include "SparseMatrixCSR.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		/**
+		 * Invert a dense B x B block using Gauss-Jordan elimination with partial pivoting.
+		 *
+		 * @param block The block to invert, row-major
+		 * @param inverse Array of size B * B to store the inverse in, row-major
+		 *
+		 * @tparam T The type of the stored node data
+		 * @tparam B The block size (blocks are B x B)
+		 *
+		 * @return An error status indicating the success or failure of the operation
+		 * @retval cupcfd::error::E_SUCCESS The block was inverted
+		 * @retval cupcfd::error::E_MATRIX_SINGULAR_BLOCK The block is singular
+		 */
+		template <class T, int B>
+		cupcfd::error::eCodes invertDenseBlock(const T * block, T * inverse) {
+			T a[B * B];
+
+			for(int i = 0; i < B * B; i++) {
+				a[i] = block[i];
+				inverse[i] = T(0);
+			}
+
+			for(int i = 0; i < B; i++) {
+				inverse[(i * B) + i] = T(1);
+			}
+
+			for(int c = 0; c < B; c++) {
+				// Select the largest remaining pivot in this column
+				int pivotRow = c;
+				for(int r = c + 1; r < B; r++) {
+					if(std::abs(a[(r * B) + c]) > std::abs(a[(pivotRow * B) + c])) {
+						pivotRow = r;
+					}
+				}
+
+				if(a[(pivotRow * B) + c] == T(0)) {
+					return cupcfd::error::E_MATRIX_SINGULAR_BLOCK;
+				}
+
+				if(pivotRow != c) {
+					for(int j = 0; j < B; j++) {
+						std::swap(a[(c * B) + j], a[(pivotRow * B) + j]);
+						std::swap(inverse[(c * B) + j], inverse[(pivotRow * B) + j]);
+					}
+				}
+
+				T pivot = a[(c * B) + c];
+				for(int j = 0; j < B; j++) {
+					a[(c * B) + j] = a[(c * B) + j] / pivot;
+					inverse[(c * B) + j] = inverse[(c * B) + j] / pivot;
+				}
+
+				// Eliminate this column from every other row
+				for(int r = 0; r < B; r++) {
+					if(r != c) {
+						T factor = a[(r * B) + c];
+						for(int j = 0; j < B; j++) {
+							a[(r * B) + j] = a[(r * B) + j] - (factor * a[(c * B) + j]);
+							inverse[(r * B) + j] = inverse[(r * B) + j] - (factor * inverse[(c * B) + j]);
+						}
+					}
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T, int B>
+		SparseMatrixBSR<I,T,B>::SparseMatrixBSR()
+		: SparseMatrix<SparseMatrixBSR<I,T,B>,I,T>(B, B)
+		{
+			cupcfd::error::eCodes status;
+
+			status = this->resize(this->m, this->n);
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T, int B>
+		SparseMatrixBSR<I,T,B>::SparseMatrixBSR(I m, I n)
+		: SparseMatrix<SparseMatrixBSR<I,T,B>,I,T>(m, n)
+		{
+			cupcfd::error::eCodes status;
+
+			// Validates that the sizes are a multiple of the block size
+			status = this->resize(this->m, this->n);
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T, int B>
+		SparseMatrixBSR<I,T,B>::SparseMatrixBSR(I m, I n, I baseIndex)
+		: SparseMatrix<SparseMatrixBSR<I,T,B>,I,T>(m, n, baseIndex)
+		{
+			cupcfd::error::eCodes status;
+
+			// Validates that the sizes are a multiple of the block size
+			status = this->resize(this->m, this->n);
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T, int B>
+		SparseMatrixBSR<I,T,B>::~SparseMatrixBSR()
+		{
+			// Nothing to do currently, vectors will cleanup themselves on destructor call
+		}
+
+		// === Concrete Methods ===
+
+		template <class I, class T, int B>
+		cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::fromSource(SparseMatrixSource<I,T>& source) {
+			cupcfd::error::eCodes status;
+			I rows, cols, base;
+
+			status = source.getNRows(&rows);
+			CHECK_ECODE(status)
+
+			status = source.getNCols(&cols);
+			CHECK_ECODE(status)
+
+			status = source.getMatrixIndicesBase(&base);
+			CHECK_ECODE(status)
+
+			this->baseIndex = base;
+			status = this->resize(rows * B, cols * B);
+			CHECK_ECODE(status)
+
+			// Each source row becomes a block row. Entries are sorted by column since
+			// the block columns are kept in ascending order.
+			std::vector<std::pair<I,T>> rowEntries;
+
+			for(I i = 0; i < rows; i++) {
+				I * columnIndexes;
+				I nColumnIndexes;
+
+				T * nnzValues;
+				I nNNZValues;
+
+				status = source.getRowColumnIndexes(i + base, &columnIndexes, &nColumnIndexes);
+				CHECK_ECODE(status)
+				status = source.getRowNNZValues(i + base, &nnzValues, &nNNZValues);
+				CHECK_ECODE(status)
+
+				rowEntries.resize(nColumnIndexes);
+				for(I j = 0; j < nColumnIndexes; j++) {
+					rowEntries[j] = std::make_pair(columnIndexes[j] - base, nnzValues[j]);
+				}
+				std::sort(rowEntries.begin(), rowEntries.end());
+
+				for(I j = 0; j < nColumnIndexes; j++) {
+					this->blockCol.push_back(rowEntries[j].first);
+
+					// Block is a(i,j) * Identity(B)
+					for(I r = 0; r < B; r++) {
+						for(I c = 0; c < B; c++) {
+							this->val.push_back((r == c) ? rowEntries[j].second : T(0));
+						}
+					}
+				}
+
+				this->rowPtr[i + 1] = this->rowPtr[i] + nColumnIndexes;
+
+				free(columnIndexes);
+				free(nnzValues);
+			}
+
+			this->nnz = this->rowPtr[this->mb] * B * B;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::setElements(const I * rows, const I * cols, const T * vals, I nVals) {
+			cupcfd::error::eCodes status;
+
+			// Combine any duplicates in the batch first, then set each distinct entry
+			SparseMatrixCSR<I,T> batch(this->m, this->n, this->baseIndex);
+
+			status = batch.setElements(rows, cols, vals, nVals);
+			CHECK_ECODE(status)
+
+			for(I i = 0; i < this->m; i++) {
+				for(I j = batch.IA[i]; j < batch.IA[i + 1]; j++) {
+					status = this->setElement(i + this->baseIndex, batch.JA[j], batch.A[j]);
+					CHECK_ECODE(status)
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::multiply(const T * x, I nX, T * y, I nY) {
+			if(nX != this->n || nY != this->m) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			const I * rowPtr = this->rowPtr.data();
+			const I * blockCol = this->blockCol.data();
+			const T * val = this->val.data();
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < this->mb; i++) {
+				T sum[B];
+
+				for(I r = 0; r < B; r++) {
+					sum[r] = T(0);
+				}
+
+				// The block size is fixed at compile time, so the dense block product unrolls fully
+				for(I k = rowPtr[i]; k < rowPtr[i + 1]; k++) {
+					const T * block = val + (k * B * B);
+					const T * xBlock = x + (blockCol[k] * B);
+
+					for(I r = 0; r < B; r++) {
+						for(I c = 0; c < B; c++) {
+							sum[r] = sum[r] + (block[(r * B) + c] * xBlock[c]);
+						}
+					}
+				}
+
+				for(I r = 0; r < B; r++) {
+					y[(i * B) + r] = sum[r];
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::setupBlockJacobi() {
+			if(this->m != this->n) {
+				return cupcfd::error::E_MATRIX_INVALID_ROW_SIZE;
+			}
+
+			this->invDiag.resize(this->mb * B * B);
+			I nSingular = 0;
+
+			#pragma omp parallel for schedule(static) reduction(+:nSingular)
+			for(I i = 0; i < this->mb; i++) {
+				cupcfd::error::eCodes status;
+				I index;
+
+				status = this->getBlockIndex(i, i, &index);
+
+				if(status != cupcfd::error::E_SUCCESS || index < 0) {
+					// A missing diagonal block cannot be inverted
+					nSingular = nSingular + 1;
+					continue;
+				}
+
+				status = invertDenseBlock<T,B>(&(this->val[index * B * B]), &(this->invDiag[i * B * B]));
+
+				if(status != cupcfd::error::E_SUCCESS) {
+					nSingular = nSingular + 1;
+				}
+			}
+
+			if(nSingular > 0) {
+				this->invDiag.clear();
+				return cupcfd::error::E_MATRIX_SINGULAR_BLOCK;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::applyBlockJacobi(const T * r, I nR, T * z, I nZ) {
+			if(nR != this->m || nZ != this->m) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			if(this->invDiag.size() != (size_t) (this->mb * B * B)) {
+				return cupcfd::error::E_MATRIX_SINGULAR_BLOCK;
+			}
+
+			const T * invDiag = this->invDiag.data();
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < this->mb; i++) {
+				const T * block = invDiag + (i * B * B);
+				const T * rBlock = r + (i * B);
+
+				for(I row = 0; row < B; row++) {
+					T sum = T(0);
+
+					for(I c = 0; c < B; c++) {
+						sum = sum + (block[(row * B) + c] * rBlock[c]);
+					}
+
+					z[(i * B) + row] = sum;
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int B>
+		cupcfd::error::eCodes SparseMatrixBSR<I,T,B>::blockJacobi(const T * b, I nB, T * x, I nX, I nSweeps) {
+			cupcfd::error::eCodes status;
+
+			if(nB != this->m || nX != this->m) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			this->work.resize(this->m);
+
+			for(I s = 0; s < nSweeps; s++) {
+				// r = Ax
+				status = this->multiply(x, nX, &(this->work[0]), this->m);
+				CHECK_ECODE(status)
+
+				// r = b - Ax
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < this->m; i++) {
+					this->work[i] = b[i] - this->work[i];
+				}
+
+				// x = x + D^-1 r, done in place one block row at a time since each
+				// block row only reads its own entries of r
+				if(this->invDiag.size() != (size_t) (this->mb * B * B)) {
+					return cupcfd::error::E_MATRIX_SINGULAR_BLOCK;
+				}
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < this->mb; i++) {
+					const T * block = &(this->invDiag[i * B * B]);
+					const T * rBlock = &(this->work[i * B]);
+
+					for(I row = 0; row < B; row++) {
+						T sum = T(0);
+
+						for(I c = 0; c < B; c++) {
+							sum = sum + (block[(row * B) + c] * rBlock[c]);
+						}
+
+						x[(i * B) + row] = x[(i * B) + row] + sum;
+					}
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::data_structures::SparseMatrixBSR<int, float, 2>;
+template class cupcfd::data_structures::SparseMatrixBSR<int, float, 3>;
+template class cupcfd::data_structures::SparseMatrixBSR<int, float, 4>;
+
+template class cupcfd::data_structures::SparseMatrixBSR<int, double, 2>;
+template class cupcfd::data_structures::SparseMatrixBSR<int, double, 3>;
+template class cupcfd::data_structures::SparseMatrixBSR<int, double, 4>;
@@ -11,13 +11,78 @@
  */
 
 #include "SparseMatrixCOO.h"
+#include "SparseMatrixCSR.h"
 #include "ArrayDrivers.h"
 
 namespace cupcfd
 {
 	namespace data_structures
 	{
+		// === Constructors/Deconstructors ===
 
+		template <class I, class T>
+		SparseMatrixCOO<I,T>::SparseMatrixCOO(SparseMatrixCSR<I,T>& matrix)
+		: SparseMatrix<SparseMatrixCOO<I,T>,I,T>(matrix.m, matrix.n, matrix.baseIndex)
+		{
+			I nEntries = matrix.IA[matrix.m];
+
+			this->row.resize(nEntries);
+			this->col.resize(nEntries);
+			this->val.resize(nEntries);
+
+			// CSR is already sorted by row, then column, so this is a direct expansion of the row pointers
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < matrix.m; i++) {
+				for(I j = matrix.IA[i]; j < matrix.IA[i + 1]; j++) {
+					this->row[j] = i + matrix.baseIndex;
+					this->col[j] = matrix.JA[j];
+					this->val[j] = matrix.A[j];
+				}
+			}
+
+			this->nnz = nEntries;
+		}
+
+		// === Concrete Methods ===
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixCOO<I,T>::multiply(const T * x, I nX, T * y, I nY) {
+			if(nX != this->n || nY != this->m) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			for(I i = 0; i < this->m; i++) {
+				y[i] = T(0);
+			}
+
+			// Entries are stored with the base index applied
+			I nEntries = cupcfd::utility::drivers::safeConvertSizeT<I>(this->val.size());
+			for(I i = 0; i < nEntries; i++) {
+				y[this->row[i] - this->baseIndex] = y[this->row[i] - this->baseIndex] + (this->val[i] * x[this->col[i] - this->baseIndex]);
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixCOO<I,T>::setElements(const I * rows, const I * cols, const T * vals, I nVals) {
+			cupcfd::error::eCodes status;
+
+			// Merge via CSR, which sorts by row then column and combines duplicates
+			SparseMatrixCSR<I,T> csr(*this);
+
+			status = csr.setElements(rows, cols, vals, nVals);
+			CHECK_ECODE(status)
+
+			SparseMatrixCOO<I,T> merged(csr);
+
+			this->row.swap(merged.row);
+			this->col.swap(merged.col);
+			this->val.swap(merged.val);
+			this->nnz = merged.nnz;
+
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
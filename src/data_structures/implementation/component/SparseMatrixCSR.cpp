@@ -12,12 +12,226 @@
  */
 
 #include "SparseMatrixCSR.h"
+#include "SparseMatrixCOO.h"
+
+#include <algorithm>
 
 namespace cupcfd
 {
 	namespace data_structures
 	{
+		/**
+		 * A single matrix entry used when building the CSR structure in bulk.
+		 * Entries are ordered by column, with existing entries ahead of new entries
+		 * for the same column.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The type of the stored node data
+		 */
+		template <class I, class T>
+		struct SparseMatrixCSREntry
+		{
+			/** Column index, including the matrix base index **/
+			I col;
+
+			/** Whether this entry is from the new batch (1) or already stored (0) **/
+			I batch;
+
+			/** Entry value **/
+			T val;
+
+			bool operator<(const SparseMatrixCSREntry<I,T>& other) const {
+				if(this->col != other.col) {
+					return this->col < other.col;
+				}
+
+				return this->batch < other.batch;
+			}
+		};
+
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		SparseMatrixCSR<I,T>::SparseMatrixCSR(SparseMatrixCOO<I,T>& matrix)
+		: SparseMatrix<SparseMatrixCSR<I,T>,I,T>(matrix.m, matrix.n, matrix.baseIndex)
+		{
+			cupcfd::error::eCodes status;
+
+			this->IA.assign(this->m + 1, 0);
+
+			// The COO indexes are stored with the base index applied, matching setElements
+			I nVals = cupcfd::utility::drivers::safeConvertSizeT<I>(matrix.val.size());
+			status = this->setElements(matrix.row.data(), matrix.col.data(), matrix.val.data(), nVals);
+			HARD_CHECK_ECODE(status)
+		}
+
+		// === Concrete Methods ===
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixCSR<I,T>::multiply(const T * x, I nX, T * y, I nY) {
+			if(nX != this->n || nY != this->m) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			const I * IA = this->IA.data();
+			const I * JA = this->JA.data();
+			const T * A = this->A.data();
+			const I base = this->baseIndex;
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < this->m; i++) {
+				T sum = T(0);
+
+				for(I j = IA[i]; j < IA[i + 1]; j++) {
+					sum = sum + (A[j] * x[JA[j] - base]);
+				}
+
+				y[i] = sum;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixCSR<I,T>::residual(const T * x, I nX, const T * b, I nB, T * r, I nR, T * rNormSq) {
+			if(nX != this->n || nB != this->m || nR != this->m) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			const I * IA = this->IA.data();
+			const I * JA = this->JA.data();
+			const T * A = this->A.data();
+			const I base = this->baseIndex;
+			T normSq = T(0);
+
+			#pragma omp parallel for schedule(static) reduction(+:normSq)
+			for(I i = 0; i < this->m; i++) {
+				T sum = T(0);
+
+				#pragma omp simd reduction(+:sum)
+				for(I j = IA[i]; j < IA[i + 1]; j++) {
+					sum = sum + (A[j] * x[JA[j] - base]);
+				}
+
+				T ri = b[i] - sum;
+				r[i] = ri;
+				normSq = normSq + (ri * ri);
+			}
+
+			*rNormSq = normSq;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixCSR<I,T>::setElements(const I * rows, const I * cols, const T * vals, I nVals) {
+			// Error Check: Within Range -- Greater than baseIndex
+			for(I k = 0; k < nVals; k++) {
+				if((rows[k] < this->baseIndex) || (rows[k] >= this->baseIndex + this->m)) {
+					return cupcfd::error::E_MATRIX_ROW_OOB;
+				}
+
+				if((cols[k] < this->baseIndex) || (cols[k] >= this->baseIndex + this->n)) {
+					return cupcfd::error::E_MATRIX_COL_OOB;
+				}
+			}
+
+			// (1) Count the existing and new entries for each row
+			std::vector<I> rowStart(this->m + 1, 0);
+
+			for(I i = 0; i < this->m; i++) {
+				rowStart[i + 1] = this->IA[i + 1] - this->IA[i];
+			}
+
+			for(I k = 0; k < nVals; k++) {
+				rowStart[(rows[k] - this->baseIndex) + 1] = rowStart[(rows[k] - this->baseIndex) + 1] + 1;
+			}
+
+			for(I i = 0; i < this->m; i++) {
+				rowStart[i + 1] = rowStart[i + 1] + rowStart[i];
+			}
+
+			// (2) Bucket the entries by row, existing entries first
+			std::vector<SparseMatrixCSREntry<I,T>> entries(rowStart[this->m]);
+			std::vector<I> rowFill(this->m);
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < this->m; i++) {
+				I ptr = rowStart[i];
+
+				for(I j = this->IA[i]; j < this->IA[i + 1]; j++) {
+					entries[ptr].col = this->JA[j];
+					entries[ptr].batch = 0;
+					entries[ptr].val = this->A[j];
+					ptr = ptr + 1;
+				}
+
+				rowFill[i] = ptr;
+			}
+
+			// Kept serial so that duplicates are summed in the order they were provided
+			for(I k = 0; k < nVals; k++) {
+				I r = rows[k] - this->baseIndex;
+				I ptr = rowFill[r];
+
+				entries[ptr].col = cols[k];
+				entries[ptr].batch = 1;
+				entries[ptr].val = vals[k];
+				rowFill[r] = ptr + 1;
+			}
+
+			// (3) Sort each row by column and count the distinct columns
+			std::vector<I> rowSize(this->m + 1, 0);
+
+			#pragma omp parallel for schedule(dynamic, 64)
+			for(I i = 0; i < this->m; i++) {
+				std::stable_sort(entries.begin() + rowStart[i], entries.begin() + rowStart[i + 1]);
+
+				I count = 0;
+				for(I j = rowStart[i]; j < rowStart[i + 1]; j++) {
+					if(j == rowStart[i] || entries[j].col != entries[j - 1].col) {
+						count = count + 1;
+					}
+				}
+
+				rowSize[i + 1] = count;
+			}
+
+			// (4) Rebuild the row pointers
+			for(I i = 0; i < this->m; i++) {
+				rowSize[i + 1] = rowSize[i + 1] + rowSize[i];
+			}
+
+			this->IA = rowSize;
+			this->JA.resize(this->IA[this->m]);
+			this->A.resize(this->IA[this->m]);
+
+			// (5) Combine the entries for each column.
+			// New values overwrite an existing value, and duplicate new values are summed.
+			#pragma omp parallel for schedule(dynamic, 64)
+			for(I i = 0; i < this->m; i++) {
+				I ptr = this->IA[i] - 1;
+
+				for(I j = rowStart[i]; j < rowStart[i + 1]; j++) {
+					if(j == rowStart[i] || entries[j].col != entries[j - 1].col) {
+						ptr = ptr + 1;
+						this->JA[ptr] = entries[j].col;
+						this->A[ptr] = entries[j].val;
+					}
+					else if(entries[j - 1].batch == 0) {
+						// First new value replaces the existing value
+						this->A[ptr] = entries[j].val;
+					}
+					else {
+						this->A[ptr] = this->A[ptr] + entries[j].val;
+					}
+				}
+			}
+
+			this->nnz = this->IA[this->m];
 
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
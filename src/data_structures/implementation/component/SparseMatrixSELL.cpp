@@ -0,0 +1,233 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the SparseMatrixSELL class.
+ *
+ */
+
+#include "SparseMatrixSELL.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T, int C, int S>
+		SparseMatrixSELL<I,T,C,S>::SparseMatrixSELL()
+		: SparseMatrix<SparseMatrixSELL<I,T,C,S>,I,T>()
+		{
+			cupcfd::error::eCodes status;
+
+			// Setup an empty structure for the default size
+			status = this->clear();
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T, int C, int S>
+		SparseMatrixSELL<I,T,C,S>::SparseMatrixSELL(I m, I n)
+		: SparseMatrix<SparseMatrixSELL<I,T,C,S>,I,T>(m, n)
+		{
+			cupcfd::error::eCodes status;
+
+			status = this->clear();
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T, int C, int S>
+		SparseMatrixSELL<I,T,C,S>::SparseMatrixSELL(I m, I n, I baseIndex)
+		: SparseMatrix<SparseMatrixSELL<I,T,C,S>,I,T>(m, n, baseIndex)
+		{
+			cupcfd::error::eCodes status;
+
+			status = this->clear();
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T, int C, int S>
+		SparseMatrixSELL<I,T,C,S>::~SparseMatrixSELL()
+		{
+			// Nothing to do currently, vectors will cleanup themselves on destructor call
+		}
+
+		// === Concrete Methods ===
+
+		template <class I, class T, int C, int S>
+		cupcfd::error::eCodes SparseMatrixSELL<I,T,C,S>::fromCSR(SparseMatrixCSR<I,T>& source) {
+			this->m = source.m;
+			this->n = source.n;
+			this->baseIndex = source.baseIndex;
+			this->nnz = source.IA[source.m];
+
+			// === Sort rows by descending length within each window of S rows ===
+			// Ties are broken by row index so the ordering is deterministic.
+			this->perm.resize(this->m);
+			this->invPerm.resize(this->m);
+			this->rowLength.resize(this->m);
+
+			std::vector<std::pair<I,I>> window;
+
+			for(I wStart = 0; wStart < this->m; wStart = wStart + S) {
+				I wStop = std::min(wStart + S, this->m);
+				window.resize(wStop - wStart);
+
+				for(I i = wStart; i < wStop; i++) {
+					window[i - wStart] = std::make_pair(-(source.IA[i + 1] - source.IA[i]), i);
+				}
+
+				if(S > 1) {
+					std::sort(window.begin(), window.end());
+				}
+
+				for(I i = wStart; i < wStop; i++) {
+					I row = window[i - wStart].second;
+					this->perm[i] = row;
+					this->invPerm[row] = i;
+					this->rowLength[i] = -window[i - wStart].first;
+				}
+			}
+
+			// === Chunk widths and offsets ===
+			this->nChunks = (this->m + C - 1) / C;
+			this->chunkWidth.assign(this->nChunks, 0);
+			this->chunkPtr.assign(this->nChunks + 1, 0);
+
+			for(I c = 0; c < this->nChunks; c++) {
+				I width = 0;
+
+				for(I r = 0; r < C && (c * C) + r < this->m; r++) {
+					width = std::max(width, this->rowLength[(c * C) + r]);
+				}
+
+				this->chunkWidth[c] = width;
+				this->chunkPtr[c + 1] = this->chunkPtr[c] + (width * C);
+			}
+
+			// === Fill ===
+			// Padding entries have a value of zero. Their column repeats the last real column
+			// of the row (or 0 for an empty row) so the padded loads stay within cached data.
+			this->val.assign(this->chunkPtr[this->nChunks], T(0));
+			this->col.assign(this->chunkPtr[this->nChunks], 0);
+
+			#pragma omp parallel for schedule(static)
+			for(I c = 0; c < this->nChunks; c++) {
+				for(I r = 0; r < C && (c * C) + r < this->m; r++) {
+					I row = this->perm[(c * C) + r];
+					I start = source.IA[row];
+					I len = source.IA[row + 1] - start;
+					I padCol = 0;
+
+					for(I j = 0; j < len; j++) {
+						I index = this->chunkPtr[c] + (j * C) + r;
+						this->val[index] = source.A[start + j];
+						this->col[index] = source.JA[start + j] - source.baseIndex;
+						padCol = this->col[index];
+					}
+
+					for(I j = len; j < this->chunkWidth[c]; j++) {
+						this->col[this->chunkPtr[c] + (j * C) + r] = padCol;
+					}
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int C, int S>
+		cupcfd::error::eCodes SparseMatrixSELL<I,T,C,S>::toCSR(SparseMatrixCSR<I,T>& dest) {
+			cupcfd::error::eCodes status;
+
+			dest.baseIndex = this->baseIndex;
+			status = dest.resize(this->m, this->n);
+			CHECK_ECODE(status)
+
+			// Row offsets, in original row order
+			for(I i = 0; i < this->m; i++) {
+				dest.IA[i + 1] = dest.IA[i] + this->rowLength[this->invPerm[i]];
+			}
+
+			dest.A.resize(dest.IA[this->m]);
+			dest.JA.resize(dest.IA[this->m]);
+
+			for(I i = 0; i < this->m; i++) {
+				I pos = this->invPerm[i];
+				I start = this->chunkPtr[pos / C] + (pos % C);
+
+				for(I j = 0; j < this->rowLength[pos]; j++) {
+					dest.A[dest.IA[i] + j] = this->val[start + (j * C)];
+					dest.JA[dest.IA[i] + j] = this->col[start + (j * C)] + this->baseIndex;
+				}
+			}
+
+			dest.nnz = dest.IA[this->m];
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, int C, int S>
+		cupcfd::error::eCodes SparseMatrixSELL<I,T,C,S>::multiply(const T * x, I nX, T * y, I nY) {
+			if(nX != this->n || nY != this->m) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			const I * chunkPtr = this->chunkPtr.data();
+			const I * chunkWidth = this->chunkWidth.data();
+			const T * val = this->val.data();
+			const I * col = this->col.data();
+			const I * perm = this->perm.data();
+
+			#pragma omp parallel for schedule(static)
+			for(I c = 0; c < this->nChunks; c++) {
+				T sum[C];
+
+				#pragma omp simd
+				for(I r = 0; r < C; r++) {
+					sum[r] = T(0);
+				}
+
+				const T * chunkVal = val + chunkPtr[c];
+				const I * chunkCol = col + chunkPtr[c];
+
+				// Entry j of every row in the chunk is contiguous, so each step is a
+				// unit-stride load of values/columns plus a gather from x across C lanes
+				for(I j = 0; j < chunkWidth[c]; j++) {
+					#pragma omp simd
+					for(I r = 0; r < C; r++) {
+						sum[r] = sum[r] + (chunkVal[(j * C) + r] * x[chunkCol[(j * C) + r]]);
+					}
+				}
+
+				// Undo the sorting permutation, skipping the padding rows of the final chunk
+				for(I r = 0; r < C && (c * C) + r < this->m; r++) {
+					y[perm[(c * C) + r]] = sum[r];
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::data_structures::SparseMatrixSELL<int, float, 4, 1>;
+template class cupcfd::data_structures::SparseMatrixSELL<int, float, 8, 1>;
+template class cupcfd::data_structures::SparseMatrixSELL<int, float, 16, 1>;
+template class cupcfd::data_structures::SparseMatrixSELL<int, float, 4, 256>;
+template class cupcfd::data_structures::SparseMatrixSELL<int, float, 8, 256>;
+template class cupcfd::data_structures::SparseMatrixSELL<int, float, 16, 256>;
+
+template class cupcfd::data_structures::SparseMatrixSELL<int, double, 4, 1>;
+template class cupcfd::data_structures::SparseMatrixSELL<int, double, 8, 1>;
+template class cupcfd::data_structures::SparseMatrixSELL<int, double, 16, 1>;
+template class cupcfd::data_structures::SparseMatrixSELL<int, double, 4, 256>;
+template class cupcfd::data_structures::SparseMatrixSELL<int, double, 8, 256>;
+template class cupcfd::data_structures::SparseMatrixSELL<int, double, 16, 256>;
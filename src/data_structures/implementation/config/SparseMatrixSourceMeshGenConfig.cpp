@@ -11,21 +11,23 @@
  */
 
 #include "SparseMatrixSourceMeshGenConfig.h"
-#include "SparseMatrixSourceHDF5.h"
 
 namespace cupcfd
 {
 	namespace data_structures
 	{
 		template <class I, class T>
-		SparseMatrixSourceMeshGenConfig<I,T>::SparseMatrixSourceMeshGenConfig()
-		: SparseMatrixSourceConfig<I,T>()
+		SparseMatrixSourceMeshGenConfig<I,T>::SparseMatrixSourceMeshGenConfig(T diagonalDominance, T conditionNumber)
+		: SparseMatrixSourceConfig<I,T>(),
+		  diagonalDominance(diagonalDominance),
+		  conditionNumber(conditionNumber)
 		{
 			// Nothing to do beyond intialiser list currently.
 		}
 
 		template <class I, class T>
 		SparseMatrixSourceMeshGenConfig<I,T>::SparseMatrixSourceMeshGenConfig(SparseMatrixSourceMeshGenConfig<I,T>& source)
+		: SparseMatrixSourceConfig<I,T>()
 		{
 			*this = source;
 		}
@@ -36,6 +38,13 @@ namespace cupcfd
 			// Nothing to do beyond intialiser list currently.
 		}
 
+		template <class I, class T>
+		void SparseMatrixSourceMeshGenConfig<I,T>::operator=(SparseMatrixSourceMeshGenConfig<I,T>& source)
+		{
+			this->diagonalDominance = source.diagonalDominance;
+			this->conditionNumber = source.conditionNumber;
+		}
+
 		template <class I, class T>
 		SparseMatrixSourceMeshGenConfig<I,T> * SparseMatrixSourceMeshGenConfig<I,T>::clone()
 		{
@@ -45,7 +54,7 @@ namespace cupcfd
 		template <class I, class T>
 		cupcfd::error::eCodes SparseMatrixSourceMeshGenConfig<I,T>::buildSparseMatrixSource(SparseMatrixSource<I,T> ** matrixSource __attribute__((unused)))
 		{
-			// Not implemented.
+			// Generation requires the mesh the matrix is based on
 			return cupcfd::error::E_NOT_IMPLEMENTED;
 		}
 	}
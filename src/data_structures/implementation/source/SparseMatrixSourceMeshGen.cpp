@@ -15,14 +15,22 @@
 
 // C++ Library Function/Objects
 #include <vector>
+#include <cstdlib>
 
 namespace cupcfd
 {
 	namespace data_structures
 	{
 		template <class I, class T>
-		SparseMatrixSourceMeshGen<I, T>::SparseMatrixSourceMeshGen()
-		: SparseMatrixSource<I,T>()
+		SparseMatrixSourceMeshGen<I, T>::SparseMatrixSourceMeshGen(T diagonalDominance, T conditionNumber)
+		: SparseMatrixSource<I,T>(),
+		  diagonalDominance(diagonalDominance),
+		  conditionNumber(conditionNumber),
+		  conditionEstimate(T(0)),
+		  nGlobalRows(0),
+		  nGlobalNNZ(0),
+		  rowStart(0),
+		  rowPtr(1, 0)
 		{
 
 		}
@@ -32,10 +40,110 @@ namespace cupcfd
 		{
 			// Currently Nothing to Clean Up.
 		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixSourceMeshGen<I, T>::getLocalRowRange(I * startRow, I * nRows) {
+			*startRow = this->rowStart;
+			*nRows = static_cast<I>(this->rowPtr.size()) - 1;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixSourceMeshGen<I, T>::getNNZ(I * nnz) {
+			*nnz = this->nGlobalNNZ;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixSourceMeshGen<I, T>::getNRows(I * nRows) {
+			*nRows = this->nGlobalRows;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixSourceMeshGen<I, T>::getNCols(I * nCols) {
+			// The matrix is square - one row and one column per cell
+			*nCols = this->nGlobalRows;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixSourceMeshGen<I, T>::getMatrixIndicesBase(I * indicesBase) {
+			// Global cell IDs are zero-based
+			*indicesBase = 0;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixSourceMeshGen<I, T>::getNNZRows(I * rowIndices, I nRowIndices) {
+			// Error Check: Size of the rowIndices array should be the same as the number of rows
+			if(nRowIndices != this->nGlobalRows) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			I nLocalRows = static_cast<I>(this->rowPtr.size()) - 1;
+
+			for(I index = 0; index < nRowIndices; index++) {
+				I localRow = index - this->rowStart;
+
+				if(localRow >= 0 && localRow < nLocalRows) {
+					rowIndices[index] = this->rowPtr[localRow + 1] - this->rowPtr[localRow];
+				}
+				else {
+					rowIndices[index] = 0;
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixSourceMeshGen<I, T>::getRowColumnIndexes(I rowIndex, I ** columnIndexes, I * nColumnIndexes) {
+			I localRow = rowIndex - this->rowStart;
+			I nLocalRows = static_cast<I>(this->rowPtr.size()) - 1;
+
+			// Error Check: Was this row generated on this rank?
+			if(localRow < 0 || localRow >= nLocalRows) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			*nColumnIndexes = this->rowPtr[localRow + 1] - this->rowPtr[localRow];
+			*columnIndexes = (I *) malloc(sizeof(I) * (*nColumnIndexes));
+
+			for(I i = 0; i < *nColumnIndexes; i++) {
+				(*columnIndexes)[i] = this->cols[this->rowPtr[localRow] + i];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixSourceMeshGen<I, T>::getRowNNZValues(I rowIndex, T ** nnzValues, I * nNNZValues) {
+			I localRow = rowIndex - this->rowStart;
+			I nLocalRows = static_cast<I>(this->rowPtr.size()) - 1;
+
+			// Error Check: Was this row generated on this rank?
+			if(localRow < 0 || localRow >= nLocalRows) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			*nNNZValues = this->rowPtr[localRow + 1] - this->rowPtr[localRow];
+			*nnzValues = (T *) malloc(sizeof(T) * (*nNNZValues));
+
+			for(I i = 0; i < *nNNZValues; i++) {
+				(*nnzValues)[i] = this->vals[this->rowPtr[localRow] + i];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
 // Explicit Instantiation
 template class cupcfd::data_structures::SparseMatrixSourceMeshGen<int, float>;
 template class cupcfd::data_structures::SparseMatrixSourceMeshGen<int, double>;
-
@@ -11,6 +11,7 @@
  */
 
 #include "SparseMatrixSourceMeshGenConfigJSON.h"
+#include "SparseMatrixSourceMeshGenConfig.h"
 #include <fstream>
 
 namespace cupcfd
@@ -37,6 +38,12 @@ namespace cupcfd
 			}
 		}
 
+		template <class I, class T>
+		SparseMatrixSourceMeshGenConfigJSON<I,T>::SparseMatrixSourceMeshGenConfigJSON(Json::Value& parseJSON)
+		{
+			this->configData = parseJSON;
+		}
+
 		template <class I, class T>
 		SparseMatrixSourceMeshGenConfigJSON<I,T>::SparseMatrixSourceMeshGenConfigJSON(const SparseMatrixSourceMeshGenConfigJSON<I,T>& source)
 		{
@@ -60,9 +67,77 @@ namespace cupcfd
 		}
 
 		template <class I, class T>
-		cupcfd::error::eCodes SparseMatrixSourceMeshGenConfigJSON<I,T>::buildSparseMatrixSourceConfig(SparseMatrixSourceConfig<I,T> ** matrixSourceConfig __attribute__((unused))) {
-			// ToDo
-			return cupcfd::error::E_NOT_IMPLEMENTED;
+		cupcfd::error::eCodes SparseMatrixSourceMeshGenConfigJSON<I,T>::buildSparseMatrixSourceConfig(SparseMatrixSourceConfig<I,T> ** matrixSourceConfig) {
+			cupcfd::error::eCodes status;
+			T diagonalDominance;
+			T conditionNumber;
+
+			// Get the Diagonal Dominance (Optional)
+			status = this->getDiagonalDominance(&diagonalDominance);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				diagonalDominance = T(0);
+			}
+			else if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			// Get the Condition Number (Optional) - zero leaves the diagonal dominance in use
+			status = this->getConditionNumber(&conditionNumber);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				conditionNumber = T(0);
+			}
+			else if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			// Build the object
+			*matrixSourceConfig = new SparseMatrixSourceMeshGenConfig<I,T>(diagonalDominance, conditionNumber);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixSourceMeshGenConfigJSON<I,T>::getDiagonalDominance(T * diagonalDominance) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("DiagonalDominance")) {
+				dataSourceType = this->configData["DiagonalDominance"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else if(dataSourceType.isNumeric() && dataSourceType.asDouble() >= 0.0) {
+					*diagonalDominance = T(dataSourceType.asDouble());
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixSourceMeshGenConfigJSON<I,T>::getConditionNumber(T * conditionNumber) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("ConditionNumber")) {
+				dataSourceType = this->configData["ConditionNumber"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else if(dataSourceType.isNumeric() && dataSourceType.asDouble() > 1.0) {
+					*conditionNumber = T(dataSourceType.asDouble());
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
 		}
 	}
 }
@@ -77,8 +77,7 @@ namespace cupcfd
 				return cupcfd::error::E_ARRAY_SIZE_UNDERSIZED;
 			}
 
-			// Begin the copy - since we are retrieving from a map 
-			// we don't use the utility copy operation here.
+			// Begin the copy
 			for(I i = 0; i < this->nNodes; i++) {
 				nodes[i] = this->IDXToNode[i];
 			}
@@ -182,9 +181,11 @@ namespace cupcfd
 using namespace cupcfd::data_structures;
 
 template class cupcfd::data_structures::AdjacencyList<AdjacencyListCSR<int, int>, int, int>;
+template class cupcfd::data_structures::AdjacencyList<AdjacencyListCSR<int, long>, int, long>;
 template class cupcfd::data_structures::AdjacencyList<AdjacencyListCSR<int, float>,int, float>;
 template class cupcfd::data_structures::AdjacencyList<AdjacencyListCSR<int, double>,int, double>;
 
 template class cupcfd::data_structures::AdjacencyList<AdjacencyListVector<int, int>, int, int>;
+template class cupcfd::data_structures::AdjacencyList<AdjacencyListVector<int, long>, int, long>;
 template class cupcfd::data_structures::AdjacencyList<AdjacencyListVector<int, float>,int, float>;
 template class cupcfd::data_structures::AdjacencyList<AdjacencyListVector<int, double>,int, double>;
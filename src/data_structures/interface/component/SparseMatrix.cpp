@@ -52,7 +52,8 @@ namespace cupcfd
 
 			// This should also clear the matrix before resizing (essentially a reset and reinit)
 
-			this->resize(graph.nGNodes, graph.nGNodes);
+			// The graph guarantees that its global node count fits the global ID (index) type
+			this->resize((I) graph.nGNodes, (I) graph.nGNodes);
 
 			// Get a list of the local cells
 			I nLONodes = graph.nLONodes;
@@ -12,6 +12,8 @@
  */
 
 #include <cstdlib>
+#include <algorithm>
+#include <utility>
 
 #include "CupCfdAoSMesh.h"
 #include "CupCfdAoSMeshCell.h"
@@ -138,6 +140,93 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdAoSMesh<I,T,L>::addCells(
+						L * cellLabels,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3> * centers,
+						T * vols,
+						I nCells,
+						bool isLocal) {
+				cupcfd::error::eCodes status;
+
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				if(nCells <= 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Check the labels are not repeated (sorts a copy unless already sorted)
+				I nDistinct;
+				status = cupcfd::utility::drivers::distinctCount(cellLabels, nCells, &nDistinct);
+				CHECK_ECODE(status)
+
+				if(nDistinct != nCells) {
+					return cupcfd::error::E_MESH_EXISTING_CELL;
+				}
+
+				// Check the labels do not already exist in the mesh or the connectivity graph
+				bool exists = false;
+
+				#pragma omp parallel for reduction(||:exists)
+				for(I i = 0; i < nCells; i++) {
+					if(this->cellBuildIDToLocalID.find(cellLabels[i]) != this->cellBuildIDToLocalID.end() ||
+					   this->cellConnGraph->existsNode(cellLabels[i])) {
+						exists = true;
+					}
+				}
+
+				if(exists) {
+					return cupcfd::error::E_MESH_EXISTING_CELL;
+				}
+
+				// Size the stores once, with the face and vertex counts initialised to 0
+				// Note: The cells will need to be reordered according to the order of the
+				// connectivity graph later.
+				I offset = this->cells.size();
+				this->cells.resize(offset + nCells);
+				this->cellNFaces.resize(offset + nCells, 0);
+				this->cellNGFaces.resize(offset + nCells, 0);
+				this->cellNVertices.resize(offset + nCells, 0);
+				this->cellNGVertices.resize(offset + nCells, 0);
+
+				#pragma omp parallel for
+				for(I i = 0; i < nCells; i++) {
+					this->cells[offset + i].center = centers[i];
+					this->cells[offset + i].vol = vols[i];
+				}
+
+				// Add the cells to the connectivity graph and store their current 'local ID'
+				// (see addCell) in insertion order
+				this->cellBuildIDToLocalID.reserve(this->cellBuildIDToLocalID.size() + nCells);
+
+				for(I i = 0; i < nCells; i++) {
+					if(isLocal) {
+						status = this->cellConnGraph->addLocalNode(cellLabels[i]);
+					}
+					else {
+						status = this->cellConnGraph->addGhostNode(cellLabels[i]);
+					}
+					CHECK_ECODE(status)
+
+					this->cellBuildIDToLocalID[cellLabels[i]] = offset + i;
+				}
+
+				// Update the mesh properties
+				this->properties.lTCells = this->properties.lTCells + nCells;
+
+				if(isLocal) {
+					this->properties.lOCells = this->properties.lOCells + nCells;
+				}
+				else {
+					this->properties.lGhCells = this->properties.lGhCells + nCells;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			// === Vertex Operators ===
 
 			template <class I, class T, class L>
@@ -170,6 +259,64 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdAoSMesh<I,T,L>::addVertices(L * vertexLabels, cupcfd::geometry::euclidean::EuclideanPoint<T,3> * pos, I nVertices) {
+				cupcfd::error::eCodes status;
+
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				if(nVertices <= 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Check the labels are not repeated (sorts a copy unless already sorted)
+				I nDistinct;
+				status = cupcfd::utility::drivers::distinctCount(vertexLabels, nVertices, &nDistinct);
+				CHECK_ECODE(status)
+
+				if(nDistinct != nVertices) {
+					return cupcfd::error::E_MESH_EXISTING_VERTEX;
+				}
+
+				// Check the labels do not already exist
+				bool exists = false;
+
+				#pragma omp parallel for reduction(||:exists)
+				for(I i = 0; i < nVertices; i++) {
+					if(this->vertexBuildIDToLocalID.find(vertexLabels[i]) != this->vertexBuildIDToLocalID.end()) {
+						exists = true;
+					}
+				}
+
+				if(exists) {
+					return cupcfd::error::E_MESH_EXISTING_VERTEX;
+				}
+
+				// Copy Positions
+				I offset = this->vertices.size();
+				this->vertices.resize(offset + nVertices);
+
+				#pragma omp parallel for
+				for(I i = 0; i < nVertices; i++) {
+					this->vertices[offset + i].pos = pos[i];
+				}
+
+				// Store a mapping of the Build IDs to the Local IDs
+				this->vertexBuildIDToLocalID.reserve(this->vertexBuildIDToLocalID.size() + nVertices);
+
+				for(I i = 0; i < nVertices; i++) {
+					this->vertexBuildIDToLocalID[vertexLabels[i]] = offset + i;
+				}
+
+				// Update Mesh Properties
+				this->properties.lVertices = this->properties.lVertices + nVertices;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			// === Region Operators ===
 
 			template <class I, class T, class L>
@@ -270,27 +417,24 @@ namespace cupcfd
 				// It will be updated as part of the finalize stage based on the face->boundary mappings
 				boundary.faceID = -1;
 
-				// Check the vertex count is valid
-				// Currently, we only handle 3-4 vertex faces/boundaries
-				if(nVertexLabels < 3 || nVertexLabels > 4) {
+				// Check the vertex count is valid for the vertex storage layout
+				if(!CupCfdMeshFaceVertices<I>::isValidCount(nVertexLabels)) {
 					return cupcfd::error::E_MESH_INVALID_VERTEX_COUNT;
 				}
 
-				// Copy the vertexIDs, if they exist
+				// Check the vertices exist
 				for(I i = 0; i < nVertexLabels; i++) {
-					// Check the vertex exists
 					if(this->vertexBuildIDToLocalID.find(vertexLabels[i]) == this->vertexBuildIDToLocalID.end()) {
 						return cupcfd::error::E_MESH_INVALID_VERTEX_LABEL;
 					}
-
-					// Point Boundary at Vertex Local ID
-					boundary.verticesID[i] = vertexBuildIDToLocalID[vertexLabels[i]];
 				}
 
-				// If only 3 vertices, set the 4th to -1
-				if(nVertexLabels == 3) {
-					boundary.verticesID[3] = -1;
-				}
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					// Point Boundary at Vertex Local IDs (if only 3 vertices, the 4th stays -1)
+					for(I i = 0; i < nVertexLabels; i++) {
+						boundary.verticesID[i] = vertexBuildIDToLocalID[vertexLabels[i]];
+					}
+				#endif
 
 				// Copy distance
 				boundary.distance = distance;
@@ -315,6 +459,14 @@ namespace cupcfd
 				boundary.h = T(0);
 				boundary.t = T(0);
 
+				#if !CUPCFD_MESH_FIXED_FACE_VERTICES
+					// Point Boundary at Vertex Local IDs
+					this->boundaryVertices.append(nVertexLabels);
+					for(I i = 0; i < nVertexLabels; i++) {
+						this->boundaryVertices.setVertex(this->boundaries.size(), i, vertexBuildIDToLocalID[vertexLabels[i]]);
+					}
+				#endif
+
 				this->boundaries.push_back(boundary);
 				this->properties.lBoundaries = this->properties.lBoundaries + 1;
 				this->boundaryBuildIDToLocalID[boundaryLabel] = boundaries.size() - 1;
@@ -333,6 +485,132 @@ namespace cupcfd
 				return this->addBoundary(boundaryLabel, regionLabel, vertexLabels, nVertexLabels, distance);
 			}
 
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdAoSMesh<I,T,L>::addBoundaries(
+					L * boundaryLabels,
+					L * regionLabels,
+					I * vertexXAdj, L * vertexLabels,
+					T * distance,
+					I nBoundaries) {
+				cupcfd::error::eCodes status;
+
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				if(nBoundaries <= 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Check the labels are not repeated (sorts a copy unless already sorted)
+				I nDistinct;
+				status = cupcfd::utility::drivers::distinctCount(boundaryLabels, nBoundaries, &nDistinct);
+				CHECK_ECODE(status)
+
+				if(nDistinct != nBoundaries) {
+					return cupcfd::error::E_MESH_EXISTING_BOUNDARY;
+				}
+
+				// Check the labels do not already exist
+				bool exists = false;
+
+				#pragma omp parallel for reduction(||:exists)
+				for(I i = 0; i < nBoundaries; i++) {
+					if(this->boundaryBuildIDToLocalID.find(boundaryLabels[i]) != this->boundaryBuildIDToLocalID.end()) {
+						exists = true;
+					}
+				}
+
+				if(exists) {
+					return cupcfd::error::E_MESH_EXISTING_BOUNDARY;
+				}
+
+				// Resolve the vertex and region labels to local IDs and fill the boundaries in parallel.
+				// If any boundary is invalid, the error of the first (by position) is returned
+				// and the store is restored to its previous size.
+				I offset = this->boundaries.size();
+				this->boundaries.resize(offset + nBoundaries);
+				#if !CUPCFD_MESH_FIXED_FACE_VERTICES
+					this->boundaryVertices.append(vertexXAdj, nBoundaries);
+				#endif
+
+				I errorIdx = nBoundaries;
+				cupcfd::error::eCodes errorStatus = cupcfd::error::E_SUCCESS;
+
+				#pragma omp parallel for
+				for(I i = 0; i < nBoundaries; i++) {
+					cupcfd::error::eCodes itemStatus = cupcfd::error::E_SUCCESS;
+					CupCfdAoSMeshBoundary<I,T>& boundary = this->boundaries[offset + i];
+					I nVertexLabels = vertexXAdj[i+1] - vertexXAdj[i];
+
+					if(!CupCfdMeshFaceVertices<I>::isValidCount(nVertexLabels)) {
+						itemStatus = cupcfd::error::E_MESH_INVALID_VERTEX_COUNT;
+					}
+
+					for(I j = 0; j < nVertexLabels && itemStatus == cupcfd::error::E_SUCCESS; j++) {
+						auto find = this->vertexBuildIDToLocalID.find(vertexLabels[vertexXAdj[i] + j]);
+						if(find == this->vertexBuildIDToLocalID.end()) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_VERTEX_LABEL;
+						}
+						else {
+							#if CUPCFD_MESH_FIXED_FACE_VERTICES
+								boundary.verticesID[j] = find->second;
+							#else
+								this->boundaryVertices.setVertex(offset + i, j, find->second);
+							#endif
+						}
+					}
+
+					auto region = this->regionBuildIDToLocalID.find(regionLabels[i]);
+					if(itemStatus == cupcfd::error::E_SUCCESS && region == this->regionBuildIDToLocalID.end()) {
+						itemStatus = cupcfd::error::E_MESH_INVALID_REGION_LABEL;
+					}
+
+					if(itemStatus != cupcfd::error::E_SUCCESS) {
+						#pragma omp critical(cupcfd_mesh_add_error)
+						{
+							if(i < errorIdx) {
+								errorIdx = i;
+								errorStatus = itemStatus;
+							}
+						}
+					}
+					else {
+						// The faceID is initially unknown, and will be set when the boundary's face is added.
+						// The other properties default to 0.
+						boundary.faceID = -1;
+						boundary.regionID = region->second;
+						boundary.distance = distance[i];
+						boundary.yplus = T(0);
+						boundary.uplus = T(0);
+						boundary.shear = cupcfd::geometry::euclidean::EuclideanVector<T,3>(T(0), T(0), T(0));
+						boundary.q = T(0);
+						boundary.h = T(0);
+						boundary.t = T(0);
+					}
+				}
+
+				if(errorStatus != cupcfd::error::E_SUCCESS) {
+					this->boundaries.resize(offset);
+					#if !CUPCFD_MESH_FIXED_FACE_VERTICES
+						this->boundaryVertices.truncate(offset);
+					#endif
+					return errorStatus;
+				}
+
+				// Store a mapping of the Build IDs to the Local IDs
+				this->boundaryBuildIDToLocalID.reserve(this->boundaryBuildIDToLocalID.size() + nBoundaries);
+
+				for(I i = 0; i < nBoundaries; i++) {
+					this->boundaryBuildIDToLocalID[boundaryLabels[i]] = offset + i;
+				}
+
+				this->properties.lBoundaries = this->properties.lBoundaries + nBoundaries;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			// === Face Operators ===
 
 			template <class I, class T, class L>
@@ -392,9 +670,10 @@ namespace cupcfd
 					}
 
 					// Check this is not a face between two ghost cells
-					// We only accept faces between local->local, or local->ghost cells
+					// We only accept faces between local->local, or local->ghost cells, unless the halo is more than
+					// one layer deep (where the faces of the inner ghost layers are also stored)
 					// Since this graph shouldn't be finalised yet, the data will be stored in the build graph
-					if(!isBoundary) {
+					if(!isBoundary && this->properties.haloDepth <= 1) {
 						bool foundGhost1 = this->cellConnGraph->existsGhostNode(cell1Label);
 						bool foundGhost2 = this->cellConnGraph->existsGhostNode(cell2OrBoundaryLabel);
 						if(foundGhost1 && foundGhost2) {
@@ -434,27 +713,30 @@ namespace cupcfd
 				// Copy the face norm
 				face.norm = norm;
 
-				// Check the vertex count is valid
-				// Currently, we only handle 3-4 vertex faces/boundaries
-				if(nVertexLabels < 3 || nVertexLabels > 4) {
+				// Check the vertex count is valid for the vertex storage layout
+				if(!CupCfdMeshFaceVertices<I>::isValidCount(nVertexLabels)) {
 					return cupcfd::error::E_MESH_INVALID_VERTEX_COUNT;
 				}
 
-				// Copy the vertexIDs, if they exist
+				// Check the vertices exist
 				for(I i = 0; i < nVertexLabels; i++) {
-					// Check the vertex exists
 					if(this->vertexBuildIDToLocalID.find(vertexLabels[i]) == this->vertexBuildIDToLocalID.end()) {
 						return cupcfd::error::E_MESH_INVALID_VERTEX_LABEL;
 					}
-
-					// Point Boundary at Vertex Local ID
-					face.verticesID[i] = vertexBuildIDToLocalID[vertexLabels[i]];
 				}
 
-				// if only 3 vertices, set the 4th to -1
-				if(nVertexLabels == 3) {
-					face.verticesID[3] = -1;
-				}
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					// Point Face at Vertex Local IDs (if only 3 vertices, the 4th stays -1)
+					for(I i = 0; i < nVertexLabels; i++) {
+						face.verticesID[i] = vertexBuildIDToLocalID[vertexLabels[i]];
+					}
+				#else
+					// Point Face at Vertex Local IDs. The face is added below without further checks.
+					this->faceVertices.append(nVertexLabels);
+					for(I i = 0; i < nVertexLabels; i++) {
+						this->faceVertices.setVertex(this->faces.size(), i, vertexBuildIDToLocalID[vertexLabels[i]]);
+					}
+				#endif
 
 				// Copy the center
 				face.center = center;
@@ -518,6 +800,218 @@ namespace cupcfd
 							  lambda, norm, vertexLabels, nVertexLabels, center, xpac, xnac, rlencos, area);
 			}
 
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdAoSMesh<I,T,L>::addFaces(
+						L * faceLabels,
+						L * cell1Labels,
+						L * cell2OrBoundaryLabels,
+						bool * isBoundary,
+						T * lambda,
+						cupcfd::geometry::euclidean::EuclideanVector3D<T> * norm,
+						I * vertexXAdj, L * vertexLabels,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3> * center,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3> * xpac,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3> * xnac,
+						T * rlencos,
+						T * area,
+						I nFaces) {
+				cupcfd::error::eCodes status;
+
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				if(nFaces <= 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Check the labels are not repeated (sorts a copy unless already sorted)
+				I nDistinct;
+				status = cupcfd::utility::drivers::distinctCount(faceLabels, nFaces, &nDistinct);
+				CHECK_ECODE(status)
+
+				if(nDistinct != nFaces) {
+					return cupcfd::error::E_MESH_EXISTING_FACE;
+				}
+
+				// Check the labels do not already exist
+				bool exists = false;
+
+				#pragma omp parallel for reduction(||:exists)
+				for(I i = 0; i < nFaces; i++) {
+					if(this->faceBuildIDToLocalID.find(faceLabels[i]) != this->faceBuildIDToLocalID.end()) {
+						exists = true;
+					}
+				}
+
+				if(exists) {
+					return cupcfd::error::E_MESH_EXISTING_FACE;
+				}
+
+				// Resolve the cell, boundary and vertex labels to local IDs and fill the faces in parallel.
+				// If any face is invalid, the error of the first (by position) is returned
+				// and the store is restored to its previous size.
+				I offset = this->faces.size();
+				this->faces.resize(offset + nFaces);
+				#if !CUPCFD_MESH_FIXED_FACE_VERTICES
+					this->faceVertices.append(vertexXAdj, nFaces);
+				#endif
+
+				I errorIdx = nFaces;
+				cupcfd::error::eCodes errorStatus = cupcfd::error::E_SUCCESS;
+
+				#pragma omp parallel for
+				for(I i = 0; i < nFaces; i++) {
+					cupcfd::error::eCodes itemStatus = cupcfd::error::E_SUCCESS;
+					CupCfdAoSMeshFace<I,T>& face = this->faces[offset + i];
+
+					face.cell1ID = -1;
+					face.cell2ID = -1;
+					face.bndID = -1;
+
+					auto cell1 = this->cellBuildIDToLocalID.find(cell1Labels[i]);
+					if(cell1 == this->cellBuildIDToLocalID.end()) {
+						itemStatus = cupcfd::error::E_MESH_INVALID_CELL_LABEL;
+					}
+					else {
+						face.cell1ID = cell1->second;
+					}
+
+					if(itemStatus == cupcfd::error::E_SUCCESS && isBoundary[i]) {
+						auto boundary = this->boundaryBuildIDToLocalID.find(cell2OrBoundaryLabels[i]);
+						if(boundary == this->boundaryBuildIDToLocalID.end()) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_BOUNDARY_LABEL;
+						}
+						else {
+							face.bndID = boundary->second;
+						}
+					}
+					else if(itemStatus == cupcfd::error::E_SUCCESS) {
+						auto cell2 = this->cellBuildIDToLocalID.find(cell2OrBoundaryLabels[i]);
+						if(cell2 == this->cellBuildIDToLocalID.end()) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_CELL_LABEL;
+						}
+						// We only accept faces between local->local, or local->ghost cells (unless the halo is deeper)
+						else if(this->properties.haloDepth <= 1 &&
+								this->cellConnGraph->existsGhostNode(cell1Labels[i]) &&
+								this->cellConnGraph->existsGhostNode(cell2OrBoundaryLabels[i])) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_FACE;
+						}
+						else {
+							face.cell2ID = cell2->second;
+						}
+					}
+
+					I nVertexLabels = vertexXAdj[i+1] - vertexXAdj[i];
+
+					if(itemStatus == cupcfd::error::E_SUCCESS && !CupCfdMeshFaceVertices<I>::isValidCount(nVertexLabels)) {
+						itemStatus = cupcfd::error::E_MESH_INVALID_VERTEX_COUNT;
+					}
+
+					for(I j = 0; j < nVertexLabels && itemStatus == cupcfd::error::E_SUCCESS; j++) {
+						auto find = this->vertexBuildIDToLocalID.find(vertexLabels[vertexXAdj[i] + j]);
+						if(find == this->vertexBuildIDToLocalID.end()) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_VERTEX_LABEL;
+						}
+						else {
+							#if CUPCFD_MESH_FIXED_FACE_VERTICES
+								face.verticesID[j] = find->second;
+							#else
+								this->faceVertices.setVertex(offset + i, j, find->second);
+							#endif
+						}
+					}
+
+					if(itemStatus != cupcfd::error::E_SUCCESS) {
+						#pragma omp critical(cupcfd_mesh_add_error)
+						{
+							if(i < errorIdx) {
+								errorIdx = i;
+								errorStatus = itemStatus;
+							}
+						}
+					}
+					else {
+						// Copy the face properties
+						face.lambda = lambda[i];
+						face.norm = norm[i];
+						face.center = center[i];
+						face.rlencos = (rlencos == nullptr) ? T(0) : rlencos[i];
+						face.area = area[i];
+						face.xpac = (xpac == nullptr) ? cupcfd::geometry::euclidean::EuclideanPoint<T,3>(T(0), T(0), T(0)) : xpac[i];
+						face.xnac = (xnac == nullptr) ? cupcfd::geometry::euclidean::EuclideanPoint<T,3>(T(0), T(0), T(0)) : xnac[i];
+					}
+				}
+
+				// Check no two faces are between the same pair of cells, either in this set (by sorting
+				// the cell pairs) or with a face added previously (by checking the connectivity graph)
+				if(errorStatus == cupcfd::error::E_SUCCESS) {
+					std::vector<std::pair<L,L>> cellPairs;
+					cellPairs.reserve(nFaces);
+
+					for(I i = 0; i < nFaces; i++) {
+						if(!isBoundary[i]) {
+							cellPairs.push_back(std::make_pair(std::min(cell1Labels[i], cell2OrBoundaryLabels[i]),
+															   std::max(cell1Labels[i], cell2OrBoundaryLabels[i])));
+						}
+					}
+
+					std::sort(cellPairs.begin(), cellPairs.end());
+
+					if(std::adjacent_find(cellPairs.begin(), cellPairs.end()) != cellPairs.end()) {
+						errorStatus = cupcfd::error::E_MESH_FACE_EDGE_EXISTS;
+					}
+
+					if(this->cellConnGraph->buildGraph.nEdges > 0) {
+						for(std::size_t i = 0; i < cellPairs.size() && errorStatus == cupcfd::error::E_SUCCESS; i++) {
+							bool found;
+							status = this->cellConnGraph->existsEdge(cellPairs[i].first, cellPairs[i].second, &found);
+							CHECK_ECODE(status)
+
+							if(found) {
+								errorStatus = cupcfd::error::E_MESH_FACE_EDGE_EXISTS;
+							}
+						}
+					}
+				}
+
+				if(errorStatus != cupcfd::error::E_SUCCESS) {
+					this->faces.resize(offset);
+					#if !CUPCFD_MESH_FIXED_FACE_VERTICES
+						this->faceVertices.truncate(offset);
+					#endif
+					return errorStatus;
+				}
+
+				// Store the local IDs for the build IDs, add the edges to the cell connectivity graph
+				// (using the Build Global IDs for the nodes), update the local face counts of the cells
+				// and point the referenced boundaries back at their faces
+				this->faceBuildIDToLocalID.reserve(this->faceBuildIDToLocalID.size() + nFaces);
+
+				for(I i = 0; i < nFaces; i++) {
+					I faceID = offset + i;
+					this->faceBuildIDToLocalID[faceLabels[i]] = faceID;
+
+					this->cellNFaces[this->faces[faceID].cell1ID] = this->cellNFaces[this->faces[faceID].cell1ID] + 1;
+
+					if(isBoundary[i]) {
+						this->boundaries[this->faces[faceID].bndID].faceID = faceID;
+					}
+					else {
+						status = this->cellConnGraph->addUndirectedEdge(cell1Labels[i], cell2OrBoundaryLabels[i]);
+						CHECK_ECODE(status)
+
+						this->cellNFaces[this->faces[faceID].cell2ID] = this->cellNFaces[this->faces[faceID].cell2ID] + 1;
+					}
+				}
+
+				// Update mesh properties
+				this->properties.lFaces = this->properties.lFaces + nFaces;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			// === Concrete Methods ===
 
 			template <class I, class T, class L>
@@ -529,12 +1023,18 @@ namespace cupcfd
 				this->regions.clear();
 				this->vertices.clear();
 
+				#if !CUPCFD_MESH_FIXED_FACE_VERTICES
+					this->boundaryVertices.clear();
+					this->faceVertices.clear();
+				#endif
+
 				this->cellNGFaces.clear();
 				this->cellNFaces.clear();
 				this->cellNGVertices.clear();
 				this->cellNVertices.clear();
 				this->cellFaceMapCSRXAdj.resize(0);
 				this->cellFaceMapCSRAdj.resize(0);
+				this->cellFaceStride = 0;
 
 				// Reset Mesh Properties
 				this->properties.reset();
@@ -550,6 +1050,8 @@ namespace cupcfd
 				// Reset in case it was in use
 				this->cellFaceMapCSRXAdj.clear();
 				this->cellFaceMapCSRAdj.clear();
+				this->cellFaceStride = 0;
+				this->properties.cellType = shapes::POLYHEDRON_UNKNOWN;
 
 				// Number of locally stored faces per cell already set in this->NFaces, updated in addCell.
 				// Use this value to rebuild the cell->face mappings
@@ -643,12 +1145,10 @@ namespace cupcfd
 					for(I j = 0; j < cellFaceCount; j++) {
 						I faceID = this->getCellFaceID(i, j);
 
-						for(I k = 0; k < 4; k++) {
-							I vertexID = this->getFaceVertex(faceID, k);
+						I faceNVertices = this->getFaceNVertices(faceID);
 
-							if(vertexID != -1) {
-								vertexIDs.push_back(vertexID);
-							}
+						for(I k = 0; k < faceNVertices; k++) {
+							vertexIDs.push_back(this->getFaceVertex(faceID, k));
 						}
 					}
 
@@ -679,16 +1179,18 @@ namespace cupcfd
 
 				// First, let us create useful data stores
 				// (a) A vector of valid Keys (Build Cell IDs)
-				std::vector<I> keys;
-				for(typename std::map<I,I>::iterator iter = this->cellBuildIDToLocalID.begin(); iter != this->cellBuildIDToLocalID.end(); iter++) {
+				std::vector<L> keys;
+				keys.reserve(this->cellBuildIDToLocalID.size());
+				for(typename cupcfd::data_structures::FlatHashMap<L,I>::iterator iter = this->cellBuildIDToLocalID.begin(); iter != this->cellBuildIDToLocalID.end(); iter++) {
 					keys.push_back(iter->first);
 				}
 
 
 				// (b) A mapping of the current local cell IDs in the map to their key
-				std::map<I,I> localToBuildID;
+				// The current local cell IDs are the insertion order, so are dense from 0
 				I iLimit;
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(keys.size());
+				std::vector<L> localToBuildID(iLimit);
 				for(I i = 0; i < iLimit; i++) {
 					I lID = this->cellBuildIDToLocalID[keys[i]];
 					localToBuildID[lID] = keys[i];
@@ -700,7 +1202,7 @@ namespace cupcfd
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(faces.size());
 				for(I i = 0; i < iLimit; i++) {
 					// Update Cell 1 ID by mapping the current local back to the build ID, then to the local ID in the graph
-					I bID = localToBuildID[faces[i].cell1ID];
+					L bID = localToBuildID[faces[i].cell1ID];
 					I graphLocalID;
 					status = this->cellConnGraph->connGraph.getNodeLocalIndex(bID, &graphLocalID);
 					CHECK_ECODE(status)
@@ -755,7 +1257,7 @@ namespace cupcfd
 				// Update the source to shuffled order
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(this->cellNFaces.size());
 				for(I i = 0; i < iLimit; i++) {
-					I label = localToBuildID[i];
+					L label = localToBuildID[i];
 					I graphLocalID;
 					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphLocalID);
 					CHECK_ECODE(status)
@@ -773,7 +1275,7 @@ namespace cupcfd
 				// Update the source to shuffled order
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(this->cellNGFaces.size());
 				for(I i = 0; i < iLimit; i++) {
-					I label = localToBuildID[i];
+					L label = localToBuildID[i];
 					I graphLocalID;
 					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphLocalID);
 					CHECK_ECODE(status)
@@ -791,7 +1293,7 @@ namespace cupcfd
 				// Update the source to shuffled order
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(this->cellNGVertices.size());
 				for(I i = 0; i < iLimit; i++) {
-					I label = localToBuildID[i];
+					L label = localToBuildID[i];
 					I graphLocalID;
 					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphLocalID);
 					CHECK_ECODE(status)
@@ -808,7 +1310,7 @@ namespace cupcfd
 
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(this->cellNVertices.size());
 				for(I i = 0; i < iLimit; i++) {
-					I label = localToBuildID[i];
+					L label = localToBuildID[i];
 					I graphLocalID;
 					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphLocalID);
 					CHECK_ECODE(status)
@@ -823,7 +1325,7 @@ namespace cupcfd
 				// mesh local IDs (i.e. the graph local IDs)
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellBuildIDToLocalID.size());
 				for(I i = 0; i < iLimit; i++) {
-					I label = localToBuildID[i];
+					L label = localToBuildID[i];
 					I graphCellID;
 					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphCellID);
 					CHECK_ECODE(status)
@@ -833,6 +1335,32 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			template <class I, class T, class L>
+			void CupCfdAoSMesh<I,T,L>::packCellFaceMap() {
+				I stride = (I) shapes::getPolyhedronNFaces(this->properties.cellType);
+
+				// Mixed cell types keep the CSR mapping
+				if((stride == 0) || (this->cellFaceStride > 0)) {
+					return;
+				}
+
+				I nCells = cupcfd::utility::drivers::safeConvertSizeT<I>(this->cellFaceMapCSRXAdj.size()) - 1;
+				std::vector<I> cellFaceMap(nCells * stride, I(-1));
+
+				for(I i = 0; i < nCells; i++) {
+					I rangeStart = this->cellFaceMapCSRXAdj[i];
+					I rangeSize = this->cellFaceMapCSRXAdj[i+1] - this->cellFaceMapCSRXAdj[i];
+
+					for(I j = 0; j < rangeSize; j++) {
+						cellFaceMap[(i * stride) + j] = this->cellFaceMapCSRAdj[rangeStart + j];
+					}
+				}
+
+				this->cellFaceMapCSRAdj.swap(cellFaceMap);
+				this->cellFaceMapCSRXAdj.clear();
+				this->cellFaceStride = stride;
+			}
+
 			template <class I, class T, class L>
 			cupcfd::error::eCodes CupCfdAoSMesh<I,T,L>::finalize() {
 				cupcfd::error::eCodes status;
@@ -880,6 +1408,18 @@ namespace cupcfd
 				status = this->exchangeCellGlobalNFaces();
 				CHECK_ECODE(status)
 
+				// If every cell has the same type, store the cell->face mapping with a fixed stride
+				this->detectCellType();
+				this->packCellFaceMap();
+
+				// Derive the face geometry from the vertices and cell centres
+				status = this->computeFaceGeometry();
+				CHECK_ECODE(status)
+
+				// Colour the cells and faces now their local indexes are fixed
+				status = this->buildColourings(false);
+				CHECK_ECODE(status)
+
 				// Update status
 				this->finalized = true;
 
@@ -975,9 +1515,267 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdAoSMesh<I,T,L>::getPagePlacement(std::vector<std::size_t>& nodePages, std::size_t * nUnplaced) {
+				cupcfd::error::eCodes status;
+
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaries, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cells, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellNGFaces, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellNFaces, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellNGVertices, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellNVertices, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellFaceMapCSRXAdj, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellFaceMapCSRAdj, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->faces, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->vertices, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+
+				#if !CUPCFD_MESH_FIXED_FACE_VERTICES
+					status = this->boundaryVertices.getPagePlacement(nodePages, nUnplaced);
+					CHECK_ECODE(status)
+					status = this->faceVertices.getPagePlacement(nodePages, nUnplaced);
+					CHECK_ECODE(status)
+				#endif
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			std::size_t CupCfdAoSMesh<I,T,L>::getBuildMapMemoryBytes() const {
+				return this->vertexBuildIDToLocalID.getMemoryBytes()
+					 + this->boundaryBuildIDToLocalID.getMemoryBytes()
+					 + this->regionBuildIDToLocalID.getMemoryBytes()
+					 + this->cellBuildIDToLocalID.getMemoryBytes()
+					 + this->faceBuildIDToLocalID.getMemoryBytes();
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdAoSMesh<I,T,L>::writeSnapshotData(cupcfd::io::SnapshotFile& file) {
+				cupcfd::error::eCodes status;
+
+				// The region structures hold a std::string, so they are stored field by field
+				std::size_t nRegions = this->regions.size();
+				std::vector<RType> regionType(nRegions);
+				std::vector<unsigned char> regionFlags(3 * nRegions);
+				std::vector<T> regionValues(9 * nRegions);
+				std::vector<euc::EuclideanVector<T,3>> regionVectors(2 * nRegions);
+				std::vector<std::string> regionName(nRegions);
+
+				for(std::size_t i = 0; i < nRegions; i++) {
+					CupCfdAoSMeshRegion<I,T>& region = this->regions[i];
+
+					regionType[i] = region.rType;
+
+					regionFlags[3 * i] = (unsigned char) region.std;
+					regionFlags[(3 * i) + 1] = (unsigned char) region.flux;
+					regionFlags[(3 * i) + 2] = (unsigned char) region.adiab;
+
+					regionValues[9 * i] = region.ylog;
+					regionValues[(9 * i) + 1] = region.elog;
+					regionValues[(9 * i) + 2] = region.density;
+					regionValues[(9 * i) + 3] = region.turbKE;
+					regionValues[(9 * i) + 4] = region.turbDiss;
+					regionValues[(9 * i) + 5] = region.splvl;
+					regionValues[(9 * i) + 6] = region.den;
+					regionValues[(9 * i) + 7] = region.r;
+					regionValues[(9 * i) + 8] = region.t;
+
+					regionVectors[2 * i] = region.forceTangent;
+					regionVectors[(2 * i) + 1] = region.uvw;
+
+					regionName[i] = region.regionName;
+				}
+
+				// The remaining structures hold no pointers to other data, so they are stored as they are laid out in memory
+				status = file.writeVector(this->boundaries);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cells);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->faces);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->vertices);
+				CHECK_ECODE(status)
+
+				status = file.writeVector(regionType);
+				CHECK_ECODE(status)
+				status = file.writeVector(regionFlags);
+				CHECK_ECODE(status)
+				status = file.writeVector(regionValues);
+				CHECK_ECODE(status)
+				status = file.writeVector(regionVectors);
+				CHECK_ECODE(status)
+				status = file.writeStrings(regionName);
+				CHECK_ECODE(status)
+
+				#if !CUPCFD_MESH_FIXED_FACE_VERTICES
+					status = this->boundaryVertices.writeSnapshot(file);
+					CHECK_ECODE(status)
+					status = this->faceVertices.writeSnapshot(file);
+					CHECK_ECODE(status)
+				#endif
+
+				status = file.writeVector(this->cellFaceMapCSRXAdj);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellFaceMapCSRAdj);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellNGFaces);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellNFaces);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellNGVertices);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellNVertices);
+				CHECK_ECODE(status)
+
+				// Build ID Lookups
+				status = file.writeMap(this->vertexBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.writeMap(this->boundaryBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.writeMap(this->regionBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.writeMap(this->cellBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.writeMap(this->faceBuildIDToLocalID);
+				CHECK_ECODE(status)
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdAoSMesh<I,T,L>::readSnapshotData(cupcfd::io::SnapshotFile& file) {
+				cupcfd::error::eCodes status;
+
+				std::vector<RType> regionType;
+				std::vector<unsigned char> regionFlags;
+				std::vector<T> regionValues;
+				std::vector<euc::EuclideanVector<T,3>> regionVectors;
+				std::vector<std::string> regionName;
+
+				status = file.readVector(this->boundaries);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cells);
+				CHECK_ECODE(status)
+				status = file.readVector(this->faces);
+				CHECK_ECODE(status)
+				status = file.readVector(this->vertices);
+				CHECK_ECODE(status)
+
+				status = file.readVector(regionType);
+				CHECK_ECODE(status)
+				status = file.readVector(regionFlags);
+				CHECK_ECODE(status)
+				status = file.readVector(regionValues);
+				CHECK_ECODE(status)
+				status = file.readVector(regionVectors);
+				CHECK_ECODE(status)
+				status = file.readStrings(regionName);
+				CHECK_ECODE(status)
+
+				#if !CUPCFD_MESH_FIXED_FACE_VERTICES
+					status = this->boundaryVertices.readSnapshot(file);
+					CHECK_ECODE(status)
+					status = this->faceVertices.readSnapshot(file);
+					CHECK_ECODE(status)
+				#endif
+
+				status = file.readVector(this->cellFaceMapCSRXAdj);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellFaceMapCSRAdj);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellNGFaces);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellNFaces);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellNGVertices);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellNVertices);
+				CHECK_ECODE(status)
+
+				// Build ID Lookups
+				status = file.readMap(this->vertexBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.readMap(this->boundaryBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.readMap(this->regionBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.readMap(this->cellBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.readMap(this->faceBuildIDToLocalID);
+				CHECK_ECODE(status)
+
+				// Check the stores are consistent with the mesh properties read by the interface
+				// A mesh of a single fixed cell type stores the cell->face mapping with a fixed stride
+				I stride = (I) shapes::getPolyhedronNFaces(this->properties.cellType);
+				std::size_t nRegions = regionType.size();
+
+				if((this->cells.size() != (std::size_t) this->properties.lTCells) ||
+				   ((stride == 0) && (this->cellFaceMapCSRXAdj.size() != (std::size_t) this->properties.lTCells + 1)) ||
+				   ((stride > 0) && (this->cellFaceMapCSRAdj.size() != (std::size_t) (this->properties.lTCells * stride))) ||
+				   (this->faces.size() != (std::size_t) this->properties.lFaces) ||
+				   (this->boundaries.size() != (std::size_t) this->properties.lBoundaries) ||
+				   (this->vertices.size() != (std::size_t) this->properties.lVertices) ||
+				   #if !CUPCFD_MESH_FIXED_FACE_VERTICES
+				   (this->faceVertices.size() != this->properties.lFaces) ||
+				   (this->boundaryVertices.size() != this->properties.lBoundaries) ||
+				   #endif
+				   (nRegions != (std::size_t) this->properties.lRegions) ||
+				   (regionFlags.size() != 3 * nRegions) ||
+				   (regionValues.size() != 9 * nRegions) ||
+				   (regionVectors.size() != 2 * nRegions) ||
+				   (regionName.size() != nRegions)) {
+					this->reset();
+					return cupcfd::error::E_INVALID_FILE_FORMAT;
+				}
+
+				this->cellFaceStride = stride;
+
+				this->regions.resize(nRegions);
+
+				for(std::size_t i = 0; i < nRegions; i++) {
+					CupCfdAoSMeshRegion<I,T>& region = this->regions[i];
+
+					region.rType = regionType[i];
+
+					region.std = (regionFlags[3 * i] != 0);
+					region.flux = (regionFlags[(3 * i) + 1] != 0);
+					region.adiab = (regionFlags[(3 * i) + 2] != 0);
+
+					region.ylog = regionValues[9 * i];
+					region.elog = regionValues[(9 * i) + 1];
+					region.density = regionValues[(9 * i) + 2];
+					region.turbKE = regionValues[(9 * i) + 3];
+					region.turbDiss = regionValues[(9 * i) + 4];
+					region.splvl = regionValues[(9 * i) + 5];
+					region.den = regionValues[(9 * i) + 6];
+					region.r = regionValues[(9 * i) + 7];
+					region.t = regionValues[(9 * i) + 8];
+
+					region.forceTangent = regionVectors[2 * i];
+					region.uvw = regionVectors[(2 * i) + 1];
+
+					region.regionName = regionName[i];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			// Explicit Instantiation
 			template class CupCfdAoSMesh<int, float, int>;
 			template class CupCfdAoSMesh<int, double, int>;
+
+			template class CupCfdAoSMesh<int, float, long>;
+			template class CupCfdAoSMesh<int, double, long>;
 		}
 	}
 }
@@ -21,10 +21,12 @@ namespace cupcfd
 			CupCfdAoSMeshBoundary<I,T>::CupCfdAoSMeshBoundary()
 			{
 				this->faceID = (I) -1;
-				this->verticesID[0] = (I) -1;
-				this->verticesID[1] = (I) -1;
-				this->verticesID[2] = (I) -1;
-				this->verticesID[3] = (I) -1;
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					this->verticesID[0] = (I) -1;
+					this->verticesID[1] = (I) -1;
+					this->verticesID[2] = (I) -1;
+					this->verticesID[3] = (I) -1;
+				#endif
 				this->regionID = (I) -1;
 
 				this->distance = (T) 0;
@@ -23,10 +23,12 @@ namespace cupcfd
 				this->bndID = (I) -1;
 				this->cell1ID = (I) -1;
 				this->cell2ID = (I) -1;
-				this->verticesID[0] = (I) -1;
-				this->verticesID[1] = (I) -1;
-				this->verticesID[2] = (I) -1;
-				this->verticesID[3] = (I) -1;
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					this->verticesID[0] = (I) -1;
+					this->verticesID[1] = (I) -1;
+					this->verticesID[2] = (I) -1;
+					this->verticesID[3] = (I) -1;
+				#endif
 				this->lambda = (T) 0;
 				this->rlencos = (T) 0;
 				this->area = (T) 0;
@@ -0,0 +1,1915 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Description
+ *
+ */
+
+#include <cstdlib>
+#include <algorithm>
+#include <utility>
+
+#include "CupCfdAoSoAMesh.h"
+
+#include "ArrayDrivers.h"
+#include "SortDrivers.h"
+
+#include <iostream>
+
+#include "ExchangePattern.h"
+#include "ExchangePatternConfig.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I, class T, class L, int W>
+			CupCfdAoSoAMesh<I,T,L,W>::CupCfdAoSoAMesh(cupcfd::comm::Communicator& comm)
+			:UnstructuredMeshInterface<CupCfdAoSoAMesh<I,T,L,W>,I,T,L>(comm),
+			 nCellRecords(0),
+			 nFaceRecords(0)
+			{
+				// Parent Constructor Sets Properties to Defaults
+
+				// Data stores initially already empty as needed
+			}
+
+			template <class I, class T, class L, int W>
+			CupCfdAoSoAMesh<I,T,L,W>::~CupCfdAoSoAMesh()
+			{
+				// Nothing to do, vectors should clean up mesh objects automatically
+			}
+
+			// ============ Inherited Overloaded Methods  ============
+
+			// === Cell Operators ===
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::addCell(
+						L cellLabel,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3>& center,
+						T vol,
+						bool isLocal) {
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				// Check Cell bID does not already exist
+				if(this->cellBuildIDToLocalID.find(cellLabel) != this->cellBuildIDToLocalID.end()) {
+					return cupcfd::error::E_MESH_EXISTING_CELL;
+				}
+
+				cupcfd::error::eCodes status;
+
+				// Copy the cell center and volume into the next lane
+				I cellID = this->nCellRecords;
+				this->resizeCellTiles(cellID + 1);
+				this->setCellCenter(cellID, center);
+				this->setCellVolume(cellID, vol);
+
+				// Add Cell Local Face Count, initialise to 0
+				this->cellNFaces.push_back(0);
+
+				// Add Cell Global Face Count, initalise to 0
+				this->cellNGFaces.push_back(0);
+
+				// Add Cell Local Vertex Count, initialise to 0
+				this->cellNVertices.push_back(0);
+
+				// Add Cell Global Vertex Count, initialise to 0
+				this->cellNGVertices.push_back(0);
+
+				// Update the mesh properties
+				this->properties.lTCells = this->properties.lTCells + 1;
+
+				if(isLocal) {
+					this->properties.lOCells = this->properties.lOCells + 1;
+
+					// Add the cell to the connectivity graph
+					status = this->cellConnGraph->addLocalNode(cellLabel);
+					CHECK_ECODE(status)
+				}
+				else {
+					this->properties.lGhCells = this->properties.lGhCells + 1;
+
+					// Add the cell to the connectivity graph
+					status = this->cellConnGraph->addGhostNode(cellLabel);
+					CHECK_ECODE(status)
+				}
+
+				// Store the current 'local ID' - this will ultimately be updated to
+				// the local ID inside the connectivity graph.
+				// However, the current ID in the graph may change after adding
+				// subsequent cells, so we cannot set it properly now.
+				this->cellBuildIDToLocalID[cellLabel] = cellID;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::addCell(L cellLabel, bool isLocal) {
+				cupcfd::error::eCodes status;
+
+				// Create empty center, vol for now
+				cupcfd::geometry::euclidean::EuclideanPoint<T,3> center(T(0), T(0), T(0));
+				T vol = T(0);
+
+				// Pass to more descriptive function
+				status = this->addCell(cellLabel, center, vol, isLocal);
+				CHECK_ECODE(status)
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::addCells(
+						L * cellLabels,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3> * centers,
+						T * vols,
+						I nCells,
+						bool isLocal) {
+				cupcfd::error::eCodes status;
+
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				if(nCells <= 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Check the labels are not repeated (sorts a copy unless already sorted)
+				I nDistinct;
+				status = cupcfd::utility::drivers::distinctCount(cellLabels, nCells, &nDistinct);
+				CHECK_ECODE(status)
+
+				if(nDistinct != nCells) {
+					return cupcfd::error::E_MESH_EXISTING_CELL;
+				}
+
+				// Check the labels do not already exist in the mesh or the connectivity graph
+				bool exists = false;
+
+				#pragma omp parallel for reduction(||:exists)
+				for(I i = 0; i < nCells; i++) {
+					if(this->cellBuildIDToLocalID.find(cellLabels[i]) != this->cellBuildIDToLocalID.end() ||
+					   this->cellConnGraph->existsNode(cellLabels[i])) {
+						exists = true;
+					}
+				}
+
+				if(exists) {
+					return cupcfd::error::E_MESH_EXISTING_CELL;
+				}
+
+				// Size the stores once, with the face and vertex counts initialised to 0
+				I offset = this->nCellRecords;
+				this->resizeCellTiles(offset + nCells);
+				this->cellNFaces.resize(offset + nCells, 0);
+				this->cellNGFaces.resize(offset + nCells, 0);
+				this->cellNVertices.resize(offset + nCells, 0);
+				this->cellNGVertices.resize(offset + nCells, 0);
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < nCells; i++) {
+					this->setCellCenter(offset + i, centers[i]);
+					this->setCellVolume(offset + i, vols[i]);
+				}
+
+				// Add the cells to the connectivity graph and store their current 'local ID'
+				// (see addCell) in insertion order
+				this->cellBuildIDToLocalID.reserve(this->cellBuildIDToLocalID.size() + nCells);
+
+				for(I i = 0; i < nCells; i++) {
+					if(isLocal) {
+						status = this->cellConnGraph->addLocalNode(cellLabels[i]);
+					}
+					else {
+						status = this->cellConnGraph->addGhostNode(cellLabels[i]);
+					}
+					CHECK_ECODE(status)
+
+					this->cellBuildIDToLocalID[cellLabels[i]] = offset + i;
+				}
+
+				// Update the mesh properties
+				this->properties.lTCells = this->properties.lTCells + nCells;
+
+				if(isLocal) {
+					this->properties.lOCells = this->properties.lOCells + nCells;
+				}
+				else {
+					this->properties.lGhCells = this->properties.lGhCells + nCells;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// === Vertex Operators ===
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::addVertex(L vertexLabel, cupcfd::geometry::euclidean::EuclideanPoint<T,3>& pos) {
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				// Check the vertex doesn't already exist
+				if(this->vertexBuildIDToLocalID.find(vertexLabel) != this->vertexBuildIDToLocalID.end()) {
+					return cupcfd::error::E_MESH_EXISTING_VERTEX;
+				}
+
+				// Copy Position
+				this->verticesPos.push_back(pos);
+
+				// Update Mesh Properties
+				this->properties.lVertices = this->properties.lVertices + 1;
+
+				// Store a mapping of the Build ID to the Local ID
+				this->vertexBuildIDToLocalID[vertexLabel] = this->verticesPos.size() - 1;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::addVertices(L * vertexLabels, cupcfd::geometry::euclidean::EuclideanPoint<T,3> * pos, I nVertices) {
+				cupcfd::error::eCodes status;
+
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				if(nVertices <= 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Check the labels are not repeated (sorts a copy unless already sorted)
+				I nDistinct;
+				status = cupcfd::utility::drivers::distinctCount(vertexLabels, nVertices, &nDistinct);
+				CHECK_ECODE(status)
+
+				if(nDistinct != nVertices) {
+					return cupcfd::error::E_MESH_EXISTING_VERTEX;
+				}
+
+				// Check the labels do not already exist
+				bool exists = false;
+
+				#pragma omp parallel for reduction(||:exists)
+				for(I i = 0; i < nVertices; i++) {
+					if(this->vertexBuildIDToLocalID.find(vertexLabels[i]) != this->vertexBuildIDToLocalID.end()) {
+						exists = true;
+					}
+				}
+
+				if(exists) {
+					return cupcfd::error::E_MESH_EXISTING_VERTEX;
+				}
+
+				// Copy Positions
+				I offset = this->verticesPos.size();
+				this->verticesPos.resize(offset + nVertices);
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < nVertices; i++) {
+					this->verticesPos[offset + i] = pos[i];
+				}
+
+				// Store a mapping of the Build IDs to the Local IDs
+				this->vertexBuildIDToLocalID.reserve(this->vertexBuildIDToLocalID.size() + nVertices);
+
+				for(I i = 0; i < nVertices; i++) {
+					this->vertexBuildIDToLocalID[vertexLabels[i]] = offset + i;
+				}
+
+				// Update Mesh Properties
+				this->properties.lVertices = this->properties.lVertices + nVertices;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// === Region Operators ===
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::addRegion(L regionLabel,
+																		  RType type,
+																		  bool std,
+																		  bool flux,
+																		  bool adiab,
+																		  T ylog,
+																		  T elog,
+																		  T density,
+																		  T turbKE,
+																		  T turbDiss,
+																		  T splvl,
+																		  T den,
+																		  T r,
+																		  T t,
+																		  cupcfd::geometry::euclidean::EuclideanVector<T,3>& forceTangent,
+																		  cupcfd::geometry::euclidean::EuclideanVector<T,3>& uvw,
+																		  std::string& regionName) {
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				// Check Region bID does not already exist
+				if(this->regionBuildIDToLocalID.find(regionLabel) != this->regionBuildIDToLocalID.end()) {
+					return cupcfd::error::E_MESH_EXISTING_REGION;
+				}
+
+				// Region Object
+				this->regionType.push_back(type);
+				this->regionFlux.push_back(flux);
+				this->regionAdiab.push_back(adiab);
+				this->regionStd.push_back(std);
+				this->regionYLog.push_back(ylog);
+				this->regionELog.push_back(elog);
+				this->regionDensity.push_back(density);
+				this->regionTurbKE.push_back(turbKE);
+				this->regionTurbDiss.push_back(turbDiss);
+				this->regionSplvl.push_back(splvl);
+				this->regionDen.push_back(den);
+				this->regionForceTangent.push_back(forceTangent);
+				this->regionUVW.push_back(uvw);
+				this->regionName.push_back(regionName);
+				this->regionR.push_back(r);
+				this->regionT.push_back(t);
+
+				// Update Mesh Properties
+				this->properties.lRegions = this->properties.lRegions + 1;
+
+				// Store Mapping from build ID to local ID
+				regionBuildIDToLocalID[regionLabel] = this->regionType.size() - 1;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::addRegion(
+								L regionLabel,
+								std::string& regionName) {
+				RType type = RTYPE_DEFAULT;
+
+				cupcfd::geometry::euclidean::EuclideanVector<T,3> forceTangent(T(0), T(0), T(0));
+				cupcfd::geometry::euclidean::EuclideanVector<T,3> uvw(T(0), T(0), T(0));
+
+				// Pass defaults through to more detailed method
+				return this->addRegion(regionLabel, type, false, false, false, T(0), T(0), T(0), T(0), T(0), T(0), T(0), T(0), T(0),
+									   forceTangent, uvw, regionName);
+			}
+
+			// === Boundary Operators ===
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::addBoundary(
+					L boundaryLabel,
+					L regionLabel,
+					L * vertexLabels, I nVertexLabels,
+					T distance) {
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				// Check Boundary bID does not already exist
+				if(this->boundaryBuildIDToLocalID.find(boundaryLabel) != this->boundaryBuildIDToLocalID.end()) {
+					return cupcfd::error::E_MESH_EXISTING_BOUNDARY;
+				}
+
+				// Initially the faceID is unknown
+				// It will be updated as part of the finalize stage based on the face->boundary mappings
+				this->boundaryFaceID.push_back(I(-1));
+
+				// Check the vertex count is valid for the vertex storage layout
+				if(!CupCfdMeshFaceVertices<I>::isValidCount(nVertexLabels)) {
+					return cupcfd::error::E_MESH_INVALID_VERTEX_COUNT;
+				}
+
+				// Check the vertices exist
+				for(I i = 0; i < nVertexLabels; i++) {
+					if(this->vertexBuildIDToLocalID.find(vertexLabels[i]) == this->vertexBuildIDToLocalID.end()) {
+						return cupcfd::error::E_MESH_INVALID_VERTEX_LABEL;
+					}
+				}
+
+				// Point Boundary at Vertex Local IDs
+				I boundaryID = this->boundaryVertexID.size();
+				this->boundaryVertexID.append(nVertexLabels);
+				for(I i = 0; i < nVertexLabels; i++) {
+					this->boundaryVertexID.setVertex(boundaryID, i, vertexBuildIDToLocalID[vertexLabels[i]]);
+				}
+
+				// Copy distance
+				this->boundaryDistance.push_back(distance);
+
+				// Default to 0
+				this->boundaryYPlus.push_back(T(0));
+
+				// Default to 0
+				this->boundaryUPlus.push_back(T(0));
+
+				// Check the Region ID Exists
+				if(this->regionBuildIDToLocalID.find(regionLabel) == this->regionBuildIDToLocalID.end()) {
+					return cupcfd::error::E_MESH_INVALID_REGION_LABEL;
+				}
+
+				// Set the internal boundary region ID to point at the local region ID
+				this->boundaryRegionID.push_back(this->regionBuildIDToLocalID[regionLabel]);
+
+				// Default to 0
+				this->boundaryShear.push_back(cupcfd::geometry::euclidean::EuclideanVector<T,3>(T(0), T(0), T(0)));
+				this->boundaryQ.push_back(T(0));
+				this->boundaryH.push_back(T(0));
+				this->boundaryT.push_back(T(0));
+
+				this->properties.lBoundaries = this->properties.lBoundaries + 1;
+				this->boundaryBuildIDToLocalID[boundaryLabel] = boundaryRegionID.size() - 1;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::addBoundary(
+					L boundaryLabel,
+					L regionLabel,
+					L * vertexLabels, I nVertexLabels) {
+				T distance = 0.0;
+
+				// Passthrough to more detailed function
+				return this->addBoundary(boundaryLabel, regionLabel, vertexLabels, nVertexLabels, distance);
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::addBoundaries(
+					L * boundaryLabels,
+					L * regionLabels,
+					I * vertexXAdj, L * vertexLabels,
+					T * distance,
+					I nBoundaries) {
+				cupcfd::error::eCodes status;
+
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				if(nBoundaries <= 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Check the labels are not repeated (sorts a copy unless already sorted)
+				I nDistinct;
+				status = cupcfd::utility::drivers::distinctCount(boundaryLabels, nBoundaries, &nDistinct);
+				CHECK_ECODE(status)
+
+				if(nDistinct != nBoundaries) {
+					return cupcfd::error::E_MESH_EXISTING_BOUNDARY;
+				}
+
+				// Check the labels do not already exist
+				bool exists = false;
+
+				#pragma omp parallel for reduction(||:exists)
+				for(I i = 0; i < nBoundaries; i++) {
+					if(this->boundaryBuildIDToLocalID.find(boundaryLabels[i]) != this->boundaryBuildIDToLocalID.end()) {
+						exists = true;
+					}
+				}
+
+				if(exists) {
+					return cupcfd::error::E_MESH_EXISTING_BOUNDARY;
+				}
+
+				// Resolve the vertex and region labels to local IDs in parallel.
+				// If any boundary is invalid, the error of the first (by position) is returned
+				// and the stores are restored to their previous size.
+				I offset = this->boundaryRegionID.size();
+				this->boundaryVertexID.append(vertexXAdj, nBoundaries);
+				this->boundaryRegionID.resize(offset + nBoundaries);
+
+				I errorIdx = nBoundaries;
+				cupcfd::error::eCodes errorStatus = cupcfd::error::E_SUCCESS;
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < nBoundaries; i++) {
+					cupcfd::error::eCodes itemStatus = cupcfd::error::E_SUCCESS;
+					I nVertexLabels = vertexXAdj[i+1] - vertexXAdj[i];
+
+					if(!CupCfdMeshFaceVertices<I>::isValidCount(nVertexLabels)) {
+						itemStatus = cupcfd::error::E_MESH_INVALID_VERTEX_COUNT;
+					}
+
+					for(I j = 0; j < nVertexLabels && itemStatus == cupcfd::error::E_SUCCESS; j++) {
+						auto find = this->vertexBuildIDToLocalID.find(vertexLabels[vertexXAdj[i] + j]);
+						if(find == this->vertexBuildIDToLocalID.end()) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_VERTEX_LABEL;
+						}
+						else {
+							this->boundaryVertexID.setVertex(offset + i, j, find->second);
+						}
+					}
+
+					auto region = this->regionBuildIDToLocalID.find(regionLabels[i]);
+					if(itemStatus == cupcfd::error::E_SUCCESS && region == this->regionBuildIDToLocalID.end()) {
+						itemStatus = cupcfd::error::E_MESH_INVALID_REGION_LABEL;
+					}
+
+					if(itemStatus != cupcfd::error::E_SUCCESS) {
+						#pragma omp critical(cupcfd_mesh_add_error)
+						{
+							if(i < errorIdx) {
+								errorIdx = i;
+								errorStatus = itemStatus;
+							}
+						}
+					}
+					else {
+						this->boundaryRegionID[offset + i] = region->second;
+					}
+				}
+
+				if(errorStatus != cupcfd::error::E_SUCCESS) {
+					this->boundaryVertexID.truncate(offset);
+					this->boundaryRegionID.resize(offset);
+					return errorStatus;
+				}
+
+				// Size the remaining stores. The faceID is initially unknown, and will be set when the
+				// boundary's face is added. The other properties default to 0.
+				this->boundaryFaceID.resize(offset + nBoundaries, I(-1));
+				this->boundaryDistance.resize(offset + nBoundaries);
+				this->boundaryYPlus.resize(offset + nBoundaries, T(0));
+				this->boundaryUPlus.resize(offset + nBoundaries, T(0));
+				this->boundaryShear.resize(offset + nBoundaries, cupcfd::geometry::euclidean::EuclideanVector<T,3>(T(0), T(0), T(0)));
+				this->boundaryQ.resize(offset + nBoundaries, T(0));
+				this->boundaryH.resize(offset + nBoundaries, T(0));
+				this->boundaryT.resize(offset + nBoundaries, T(0));
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < nBoundaries; i++) {
+					this->boundaryDistance[offset + i] = distance[i];
+				}
+
+				// Store a mapping of the Build IDs to the Local IDs
+				this->boundaryBuildIDToLocalID.reserve(this->boundaryBuildIDToLocalID.size() + nBoundaries);
+
+				for(I i = 0; i < nBoundaries; i++) {
+					this->boundaryBuildIDToLocalID[boundaryLabels[i]] = offset + i;
+				}
+
+				this->properties.lBoundaries = this->properties.lBoundaries + nBoundaries;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// === Face Operators ===
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::addFace(
+						L faceLabel,
+						L cell1Label,
+						L cell2OrBoundaryLabel,
+						bool isBoundary,
+						T lambda,
+						cupcfd::geometry::euclidean::EuclideanVector<T,3>& norm,
+						L * vertexLabels, I nVertexLabels,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3>& center,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3>& xpac,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3>& xnac,
+						T rlencos,
+						T area) {
+				cupcfd::error::eCodes status;
+
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				// Check Face bID does not already exist
+				if(this->faceBuildIDToLocalID.find(faceLabel) != this->faceBuildIDToLocalID.end()) {
+					return cupcfd::error::E_MESH_EXISTING_FACE;
+				}
+
+				// Check Cell 1 exists
+				if(this->cellBuildIDToLocalID.find(cell1Label) == this->cellBuildIDToLocalID.end()) {
+					return cupcfd::error::E_MESH_INVALID_CELL_LABEL;
+				}
+
+				// Point the face at the (current) local Cell ID for the given Build Cell ID
+				I cell1ID = this->cellBuildIDToLocalID[cell1Label];
+				I cell2ID;
+				I boundaryID;
+
+				if(isBoundary) {
+					// Check the Boundary ID exists
+					if(this->boundaryBuildIDToLocalID.find(cell2OrBoundaryLabel) == this->boundaryBuildIDToLocalID.end()) {
+						return cupcfd::error::E_MESH_INVALID_BOUNDARY_LABEL;
+					}
+
+					// Set the boundary ID to point at the local ID of the provided build boundary ID
+					boundaryID = this->boundaryBuildIDToLocalID[cell2OrBoundaryLabel];
+
+					// Boundary Face, fix cell 2 to -1 (i.e. no cell)
+					cell2ID = I(-1);
+				}
+				else {
+					// Check the Cell ID exists
+					if(this->cellBuildIDToLocalID.find(cell2OrBoundaryLabel) == this->cellBuildIDToLocalID.end()) {
+						return cupcfd::error::E_MESH_INVALID_CELL_LABEL;
+					}
+
+					// Check this is not a face between two ghost cells
+					// We only accept faces between local->local, or local->ghost cells, unless the halo is more than
+					// one layer deep (where the faces of the inner ghost layers are also stored)
+					// Since this graph shouldn't be finalised yet, the data will be stored in the build graph
+					if(!isBoundary && this->properties.haloDepth <= 1) {
+						bool foundGhost1 = this->cellConnGraph->existsGhostNode(cell1Label);
+						bool foundGhost2 = this->cellConnGraph->existsGhostNode(cell2OrBoundaryLabel);
+						if(foundGhost1 && foundGhost2) {
+							return cupcfd::error::E_MESH_INVALID_FACE;
+						}
+					}
+
+					// Check Edge does not already exist in connectivity graph
+					bool found;
+					status = this->cellConnGraph->existsEdge(cell1Label, cell2OrBoundaryLabel, &found);
+					CHECK_ECODE(status)
+					if(found) {
+						return cupcfd::error::E_MESH_FACE_EDGE_EXISTS;
+					}
+
+					status = this->cellConnGraph->existsEdge(cell2OrBoundaryLabel, cell1Label, &found);
+					CHECK_ECODE(status)
+					if(found) {
+						return cupcfd::error::E_MESH_FACE_EDGE_EXISTS;
+					}
+
+					// Set the cell 2 ID to point at the local ID of the provided build Cell 2 ID
+					cell2ID = this->cellBuildIDToLocalID[cell2OrBoundaryLabel];
+
+					// Not a boundary face, fix it's ID to -1 (i.e. no boundary)
+					boundaryID = I(-1);
+
+					// Add the edge to the cell connectivity graph since not a boundary face
+					// Use the Build Global IDs for the connectivity graph nodes.
+					status = this->cellConnGraph->addUndirectedEdge(cell1Label, cell2OrBoundaryLabel);
+					CHECK_ECODE(status)
+				}
+
+				// Check the vertex count is valid for the vertex storage layout
+				if(!CupCfdMeshFaceVertices<I>::isValidCount(nVertexLabels)) {
+					return cupcfd::error::E_MESH_INVALID_VERTEX_COUNT;
+				}
+
+				// Check the vertices exist
+				for(I i = 0; i < nVertexLabels; i++) {
+					if(this->vertexBuildIDToLocalID.find(vertexLabels[i]) == this->vertexBuildIDToLocalID.end()) {
+						return cupcfd::error::E_MESH_INVALID_VERTEX_LABEL;
+					}
+				}
+
+				// Point Face at Vertex Local IDs
+				I faceID = this->nFaceRecords;
+				this->faceVertexID.append(nVertexLabels);
+				for(I i = 0; i < nVertexLabels; i++) {
+					this->faceVertexID.setVertex(faceID, i, vertexBuildIDToLocalID[vertexLabels[i]]);
+				}
+
+				// Copy the face data into the next lane
+				this->resizeFaceTiles(faceID + 1);
+				this->setFaceCell1ID(faceID, cell1ID);
+				this->setFaceCell2ID(faceID, cell2ID);
+				this->setFaceBoundaryID(faceID, boundaryID);
+				this->setFaceLambda(faceID, lambda);
+				this->setFaceNorm(faceID, norm);
+				this->setFaceCenter(faceID, center);
+				this->setFaceRLencos(faceID, rlencos);
+				this->setFaceArea(faceID, area);
+				this->setFaceXpac(faceID, xpac);
+				this->setFaceXnac(faceID, xnac);
+
+				// Update mesh properties
+				this->properties.lFaces = this->properties.lFaces + 1;
+
+				// Store local ID for given build ID
+				this->faceBuildIDToLocalID[faceLabel] = faceID;
+
+				// Update the Local Face Count for Cell 1
+				this->cellNFaces[this->cellBuildIDToLocalID[cell1Label]] = this->cellNFaces[this->cellBuildIDToLocalID[cell1Label]] + 1;
+
+				if(!isBoundary) {
+					// Update the Local Face Count for Cell 2
+					this->cellNFaces[this->cellBuildIDToLocalID[cell2OrBoundaryLabel]] =
+							this->cellNFaces[this->cellBuildIDToLocalID[cell2OrBoundaryLabel]] + 1;
+				}
+
+				if(isBoundary) {
+					// Update the referenced boundary to point back at this face's local ID
+					int localBoundaryID = this->boundaryBuildIDToLocalID[cell2OrBoundaryLabel];
+					this->setBoundaryFaceID(localBoundaryID, this->faceBuildIDToLocalID[faceLabel]);
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::addFace(
+						L faceLabel,
+						L cell1Label,
+						L cell2OrBoundaryLabel,
+						bool isBoundary,
+						L * vertexLabels, I nVertexLabels) {
+				// Set Defaults
+				T lambda = T(0);
+				T rlencos = T(0);
+				T area = T(0);
+				cupcfd::geometry::euclidean::EuclideanVector<T,3> norm(T(0), T(0), T(0));
+				cupcfd::geometry::euclidean::EuclideanPoint<T,3> center(T(0), T(0), T(0));
+				cupcfd::geometry::euclidean::EuclideanPoint<T,3> xpac(T(0), T(0), T(0));
+				cupcfd::geometry::euclidean::EuclideanPoint<T,3> xnac(T(0), T(0), T(0));
+
+				// Passthrough to more detailed function
+				return this->addFace(faceLabel, cell1Label, cell2OrBoundaryLabel, isBoundary,
+							  lambda, norm, vertexLabels, nVertexLabels, center, xpac, xnac, rlencos, area);
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::addFaces(
+						L * faceLabels,
+						L * cell1Labels,
+						L * cell2OrBoundaryLabels,
+						bool * isBoundary,
+						T * lambda,
+						cupcfd::geometry::euclidean::EuclideanVector3D<T> * norm,
+						I * vertexXAdj, L * vertexLabels,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3> * center,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3> * xpac,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3> * xnac,
+						T * rlencos,
+						T * area,
+						I nFaces) {
+				cupcfd::error::eCodes status;
+
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				if(nFaces <= 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Check the labels are not repeated (sorts a copy unless already sorted)
+				I nDistinct;
+				status = cupcfd::utility::drivers::distinctCount(faceLabels, nFaces, &nDistinct);
+				CHECK_ECODE(status)
+
+				if(nDistinct != nFaces) {
+					return cupcfd::error::E_MESH_EXISTING_FACE;
+				}
+
+				// Check the labels do not already exist
+				bool exists = false;
+
+				#pragma omp parallel for reduction(||:exists)
+				for(I i = 0; i < nFaces; i++) {
+					if(this->faceBuildIDToLocalID.find(faceLabels[i]) != this->faceBuildIDToLocalID.end()) {
+						exists = true;
+					}
+				}
+
+				if(exists) {
+					return cupcfd::error::E_MESH_EXISTING_FACE;
+				}
+
+				// Resolve the cell, boundary and vertex labels to local IDs in parallel.
+				// If any face is invalid, the error of the first (by position) is returned
+				// and the stores are restored to their previous size.
+				I offset = this->nFaceRecords;
+				this->resizeFaceTiles(offset + nFaces);
+				this->faceVertexID.append(vertexXAdj, nFaces);
+
+				I errorIdx = nFaces;
+				cupcfd::error::eCodes errorStatus = cupcfd::error::E_SUCCESS;
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < nFaces; i++) {
+					cupcfd::error::eCodes itemStatus = cupcfd::error::E_SUCCESS;
+					I cell1ID = I(-1);
+					I cell2ID = I(-1);
+					I boundaryID = I(-1);
+
+					auto cell1 = this->cellBuildIDToLocalID.find(cell1Labels[i]);
+					if(cell1 == this->cellBuildIDToLocalID.end()) {
+						itemStatus = cupcfd::error::E_MESH_INVALID_CELL_LABEL;
+					}
+					else {
+						cell1ID = cell1->second;
+					}
+
+					if(itemStatus == cupcfd::error::E_SUCCESS && isBoundary[i]) {
+						auto boundary = this->boundaryBuildIDToLocalID.find(cell2OrBoundaryLabels[i]);
+						if(boundary == this->boundaryBuildIDToLocalID.end()) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_BOUNDARY_LABEL;
+						}
+						else {
+							boundaryID = boundary->second;
+						}
+					}
+					else if(itemStatus == cupcfd::error::E_SUCCESS) {
+						auto cell2 = this->cellBuildIDToLocalID.find(cell2OrBoundaryLabels[i]);
+						if(cell2 == this->cellBuildIDToLocalID.end()) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_CELL_LABEL;
+						}
+						// We only accept faces between local->local, or local->ghost cells (unless the halo is deeper)
+						else if(this->properties.haloDepth <= 1 &&
+								this->cellConnGraph->existsGhostNode(cell1Labels[i]) &&
+								this->cellConnGraph->existsGhostNode(cell2OrBoundaryLabels[i])) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_FACE;
+						}
+						else {
+							cell2ID = cell2->second;
+						}
+					}
+
+					I nVertexLabels = vertexXAdj[i+1] - vertexXAdj[i];
+
+					if(itemStatus == cupcfd::error::E_SUCCESS && !CupCfdMeshFaceVertices<I>::isValidCount(nVertexLabels)) {
+						itemStatus = cupcfd::error::E_MESH_INVALID_VERTEX_COUNT;
+					}
+
+					for(I j = 0; j < nVertexLabels && itemStatus == cupcfd::error::E_SUCCESS; j++) {
+						auto find = this->vertexBuildIDToLocalID.find(vertexLabels[vertexXAdj[i] + j]);
+						if(find == this->vertexBuildIDToLocalID.end()) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_VERTEX_LABEL;
+						}
+						else {
+							this->faceVertexID.setVertex(offset + i, j, find->second);
+						}
+					}
+
+					if(itemStatus != cupcfd::error::E_SUCCESS) {
+						#pragma omp critical(cupcfd_mesh_add_error)
+						{
+							if(i < errorIdx) {
+								errorIdx = i;
+								errorStatus = itemStatus;
+							}
+						}
+					}
+					else {
+						this->setFaceCell1ID(offset + i, cell1ID);
+						this->setFaceCell2ID(offset + i, cell2ID);
+						this->setFaceBoundaryID(offset + i, boundaryID);
+					}
+				}
+
+				// Check no two faces are between the same pair of cells, either in this set (by sorting
+				// the cell pairs) or with a face added previously (by checking the connectivity graph)
+				if(errorStatus == cupcfd::error::E_SUCCESS) {
+					std::vector<std::pair<L,L>> cellPairs;
+					cellPairs.reserve(nFaces);
+
+					for(I i = 0; i < nFaces; i++) {
+						if(!isBoundary[i]) {
+							cellPairs.push_back(std::make_pair(std::min(cell1Labels[i], cell2OrBoundaryLabels[i]),
+															   std::max(cell1Labels[i], cell2OrBoundaryLabels[i])));
+						}
+					}
+
+					std::sort(cellPairs.begin(), cellPairs.end());
+
+					if(std::adjacent_find(cellPairs.begin(), cellPairs.end()) != cellPairs.end()) {
+						errorStatus = cupcfd::error::E_MESH_FACE_EDGE_EXISTS;
+					}
+
+					if(this->cellConnGraph->buildGraph.nEdges > 0) {
+						for(std::size_t i = 0; i < cellPairs.size() && errorStatus == cupcfd::error::E_SUCCESS; i++) {
+							bool found;
+							status = this->cellConnGraph->existsEdge(cellPairs[i].first, cellPairs[i].second, &found);
+							CHECK_ECODE(status)
+
+							if(found) {
+								errorStatus = cupcfd::error::E_MESH_FACE_EDGE_EXISTS;
+							}
+						}
+					}
+				}
+
+				if(errorStatus != cupcfd::error::E_SUCCESS) {
+					this->resizeFaceTiles(offset);
+					this->faceVertexID.truncate(offset);
+					return errorStatus;
+				}
+
+				// Copy the face properties. Each tile is written by one thread, as neighbouring lanes
+				// share cache lines. The tiles are already zeroed, which covers the optional arrays.
+				I tileStart = offset / W;
+				I tileEnd = (offset + nFaces + W - 1) / W;
+
+				#pragma omp parallel for schedule(static)
+				for(I tile = tileStart; tile < tileEnd; tile++) {
+					I laneStart = std::max(offset, tile * W);
+					I laneEnd = std::min(offset + nFaces, (tile + 1) * W);
+
+					for(I faceID = laneStart; faceID < laneEnd; faceID++) {
+						I i = faceID - offset;
+
+						this->setFaceLambda(faceID, lambda[i]);
+						this->setFaceNorm(faceID, norm[i]);
+						this->setFaceCenter(faceID, center[i]);
+						this->setFaceArea(faceID, area[i]);
+
+						if(rlencos != nullptr) {
+							this->setFaceRLencos(faceID, rlencos[i]);
+						}
+
+						if(xpac != nullptr) {
+							this->setFaceXpac(faceID, xpac[i]);
+						}
+
+						if(xnac != nullptr) {
+							this->setFaceXnac(faceID, xnac[i]);
+						}
+					}
+				}
+
+				// Store the local IDs for the build IDs, add the edges to the cell connectivity graph
+				// (using the Build Global IDs for the nodes), update the local face counts of the cells
+				// and point the referenced boundaries back at their faces
+				this->faceBuildIDToLocalID.reserve(this->faceBuildIDToLocalID.size() + nFaces);
+
+				for(I i = 0; i < nFaces; i++) {
+					I faceID = offset + i;
+					this->faceBuildIDToLocalID[faceLabels[i]] = faceID;
+
+					I cell1ID = this->getFaceCell1ID(faceID);
+					this->cellNFaces[cell1ID] = this->cellNFaces[cell1ID] + 1;
+
+					if(isBoundary[i]) {
+						this->setBoundaryFaceID(this->getFaceBoundaryID(faceID), faceID);
+					}
+					else {
+						status = this->cellConnGraph->addUndirectedEdge(cell1Labels[i], cell2OrBoundaryLabels[i]);
+						CHECK_ECODE(status)
+
+						I cell2ID = this->getFaceCell2ID(faceID);
+						this->cellNFaces[cell2ID] = this->cellNFaces[cell2ID] + 1;
+					}
+				}
+
+				// Update mesh properties
+				this->properties.lFaces = this->properties.lFaces + nFaces;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// === Concrete Methods ===
+
+			template <class I, class T, class L, int W>
+			void CupCfdAoSoAMesh<I,T,L,W>::reset() {
+				// Reset Data Stores
+				this->boundaryFaceID.clear();
+				this->boundaryVertexID.clear();
+				this->boundaryDistance.clear();
+				this->boundaryYPlus.clear();
+				this->boundaryUPlus.clear();
+				this->boundaryRegionID.clear();
+				this->boundaryShear.clear();
+				this->boundaryQ.clear();
+				this->boundaryH.clear();
+				this->boundaryT.clear();
+
+				this->cellTiles.clear();
+				this->nCellRecords = 0;
+
+				this->faceTiles.clear();
+				this->nFaceRecords = 0;
+				this->faceVertexID.clear();
+
+				this->regionType.clear();
+				this->regionStd.clear();
+				this->regionYLog.clear();
+				this->regionELog.clear();
+				this->regionDensity.clear();
+				this->regionTurbKE.clear();
+				this->regionTurbDiss.clear();
+				this->regionSplvl.clear();
+				this->regionDen.clear();
+				this->regionForceTangent.clear();
+				this->regionUVW.clear();
+				this->regionName.clear();
+				this->regionFlux.clear();
+				this->regionAdiab.clear();
+				this->regionR.clear();
+				this->regionT.clear();
+
+				this->verticesPos.clear();
+
+				this->cellNGFaces.clear();
+				this->cellNFaces.clear();
+				this->cellNGVertices.clear();
+				this->cellNVertices.clear();
+				this->cellFaceMapCSRXAdj.resize(0);
+				this->cellFaceMapCSRAdj.resize(0);
+				this->cellFaceStride = 0;
+
+
+				// Reset Mesh Properties
+				this->properties.reset();
+
+				// Reset to unfinalised
+				this->finalized = false;
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::updateCellFaceMap() {
+				cupcfd::error::eCodes status;
+				
+				// Reset in case it was in use
+				this->cellFaceMapCSRXAdj.clear();
+				this->cellFaceMapCSRAdj.clear();
+				this->cellFaceStride = 0;
+				this->properties.cellType = shapes::POLYHEDRON_UNKNOWN;
+
+				// Number of locally stored faces per cell already set in this->NFaces, updated in addCell.
+				// Use this value to rebuild the cell->face mappings
+				I ptr = 0;
+				I faceCountSum = 0;
+
+				// Part (1) Store the index lookups in cellFaceMapCSRAdj
+				I iLimit;
+				iLimit = this->nCellRecords;
+				for(I i = 0; i < iLimit; i++) {
+					this->cellFaceMapCSRXAdj.push_back(ptr);
+					ptr = ptr + this->getCellStoredNFaces(i);
+
+					// We need to know the size of cellFaceMapCSRAdj which is
+					// 1 entry per face per cell, which will be
+					// greater than the number of faces (lFaces) due to shared faces.
+					// Can find this from a sum of stored faces.
+					faceCountSum = faceCountSum + this->getCellStoredNFaces(i);
+				}
+				this->cellFaceMapCSRXAdj.push_back(ptr);
+
+				for(I i = 0; i < faceCountSum; i++) {
+					this->cellFaceMapCSRAdj.push_back(I(-1));
+				}
+
+				// Store Face IDs in the Cell Mapping Vector
+				// Not a guaranteed order within a cell list
+				iLimit = this->nFaceRecords;
+				for(I i = 0; i < iLimit; i++) {
+					I faceID = i;
+
+					// Cell 1 ID
+					I cell1ID = this->getFaceCell1ID(i);
+					I rangeStart = this->cellFaceMapCSRXAdj[cell1ID];
+					I rangeEnd = this->cellFaceMapCSRXAdj[cell1ID+1];
+
+					for(I j = rangeStart; j < rangeEnd; j++) {
+						if(this->cellFaceMapCSRAdj[j] == -1) {
+							this->cellFaceMapCSRAdj[j] = faceID;
+							break;
+						}
+					}
+
+					// Cell 2 if not boundary
+					if(this->getFaceCell2ID(i) > -1) {
+						I cell2ID = this->getFaceCell2ID(i);
+						rangeStart = this->cellFaceMapCSRXAdj[cell2ID];
+						rangeEnd = this->cellFaceMapCSRXAdj[cell2ID+1];
+
+						for(I j = rangeStart; j < rangeEnd; j++) {
+							if(this->cellFaceMapCSRAdj[j] == -1) {
+								this->cellFaceMapCSRAdj[j] = faceID;
+								break;
+							}
+						}
+					}
+				}
+
+				// Tidyup - Not strictly necessary, but we will sort the face IDs within each cell range
+				iLimit = this->nCellRecords;
+				for(I i = 0; i < iLimit; i++) {
+					I rangeStart = this->cellFaceMapCSRXAdj[i];
+					I rangeSize = this->cellFaceMapCSRXAdj[i+1] - this->cellFaceMapCSRXAdj[i];
+
+					status = cupcfd::utility::drivers::merge_sort(&cellFaceMapCSRAdj[rangeStart], rangeSize);
+					CHECK_ECODE(status)
+				}
+
+				// Now that the cell -> face map is complete, let us compute the number of locally stored
+				// faces and vertices associated with a cell
+
+				// Faces - can derive quickly from CSR mappings
+				iLimit = this->nCellRecords;
+				for(I i = 0; i < iLimit; i++) {
+					this->cellNFaces[i] = this->cellFaceMapCSRXAdj[i+1] - this->cellFaceMapCSRXAdj[i];
+
+					// Temporarily set global nfaces to the same as local stored face counts
+					// This should be overridden for ghost cells by the exchange function
+					this->cellNGFaces[i] = this->cellNFaces[i];
+				}
+
+				// Vertices - Build a list of stored vertices for stored associated faces and remove duplicates
+				iLimit = this->nCellRecords;
+				for(I i = 0; i < iLimit; i++) {
+					std::vector<I> vertexIDs;
+
+					// Number of stored faces
+					I cellFaceCount = this->cellNFaces[i];
+
+					for(I j = 0; j < cellFaceCount; j++) {
+						I faceID = this->getCellFaceID(i, j);
+
+						I faceNVertices = this->getFaceNVertices(faceID);
+
+						for(I k = 0; k < faceNVertices; k++) {
+							vertexIDs.push_back(this->getFaceVertex(faceID, k));
+						}
+					}
+
+					I nVertices = vertexIDs.size();
+
+					// Store number of distinct vertices local IDs stored for this cell on this rank
+					status = cupcfd::utility::drivers::distinctCount(&vertexIDs[0], nVertices, &(this->cellNVertices[i]));
+					CHECK_ECODE(status)
+
+					// Set the global amount to the same as the local amount - for local cells this is the same,
+					// for ghost cells this will be incorrect and should be overridden by an exchange function
+					this->cellNGVertices[i] = this->cellNVertices[i];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::updateCellLocalIndexes() {
+				// We have two mappings
+				// (a) cellBuildIDToLocalID - This maps the build cell ID (e.g. from a file) to the cell data
+				// (b) Connectivity Graph.local - This maps the build Cell ID (the node) to a local ID in the graph
+
+				// We wish to reorder the cell data (this->cells) to the same ordering as the local IDs in the
+				// connectivity graph, and update cellBuildIDToLocalID and the face->cell mappings accordingly.
+
+				cupcfd::error::eCodes status;
+
+				// First, let us create useful data stores
+				// (a) A vector of valid Keys (Build Cell IDs)
+				std::vector<L> keys;
+				keys.reserve(this->cellBuildIDToLocalID.size());
+				for(typename cupcfd::data_structures::FlatHashMap<L,I>::iterator iter = this->cellBuildIDToLocalID.begin(); iter != this->cellBuildIDToLocalID.end(); iter++) {
+					keys.push_back(iter->first);
+				}
+
+
+				// (b) A mapping of the current local cell IDs in the map to their key
+				// The current local cell IDs are the insertion order, so are dense from 0
+				I iLimit;
+				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(keys.size());
+				std::vector<L> localToBuildID(iLimit);
+				for(I i = 0; i < iLimit; i++) {
+					I lID = this->cellBuildIDToLocalID[keys[i]];
+					localToBuildID[lID] = keys[i];
+				}
+
+				// Now we begin correcting all cell related structures and mappings
+
+				// (1) Remap the face->cell mappings to the graph local IDs
+				iLimit = this->nFaceRecords;
+				for(I i = 0; i < iLimit; i++) {
+					// Update Cell 1 ID by mapping the current local back to the build ID, then to the local ID in the graph
+					L bID = localToBuildID[this->getFaceCell1ID(i)];
+					I graphLocalID;
+					status = this->cellConnGraph->connGraph.getNodeLocalIndex(bID, &graphLocalID);
+					CHECK_ECODE(status)
+					this->setFaceCell1ID(i, graphLocalID);
+
+					// Get and Update Cell 2 IF this is not a boundary face
+					if(this->getFaceCell2ID(i) > -1) {
+						bID = localToBuildID[this->getFaceCell2ID(i)];
+						status = this->cellConnGraph->connGraph.getNodeLocalIndex(bID, &graphLocalID);
+						CHECK_ECODE(status)
+						this->setFaceCell2ID(i, graphLocalID);
+					}
+				}
+
+				// ToDo: Shuffle should be converted easily enough into a reusable utility function
+				// (2) Shuffle the cell data structures
+				// Make a copy of the cell tiles
+				std::vector<CupCfdAoSoAMeshCellTile<T,W>> tmpCellTiles(this->cellTiles.begin(), this->cellTiles.end());
+
+				// Now we reorder using tmpCells as the source
+				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(keys.size());
+				for(I i = 0; i < iLimit; i++) {
+					I currentLocalID = this->cellBuildIDToLocalID[keys[i]];
+					I newLocalID;
+
+					// Get Graph Local ID
+					status = this->cellConnGraph->connGraph.getNodeLocalIndex(keys[i], &newLocalID);
+					CHECK_ECODE(status)
+
+					// Update Map To Point at new Local ID
+					this->cellBuildIDToLocalID[keys[i]] = newLocalID;
+
+					// Copy Data to new position at newLocalID
+					const CupCfdAoSoAMeshCellTile<T,W>& source = tmpCellTiles[currentLocalID / W];
+					CupCfdAoSoAMeshCellTile<T,W>& dest = this->cellTiles[newLocalID / W];
+					I sourceLane = currentLocalID % W;
+					I destLane = newLocalID % W;
+
+					dest.center[0][destLane] = source.center[0][sourceLane];
+					dest.center[1][destLane] = source.center[1][sourceLane];
+					dest.center[2][destLane] = source.center[2][sourceLane];
+					dest.volume[destLane] = source.volume[sourceLane];
+				}
+
+				std::vector<I> tmpVec;
+
+				// (3) Shuffle the cellNFaces data structure
+				// Make a copy
+				tmpVec.clear();
+				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellNFaces.size());
+				for(I i = 0; i < iLimit; i++) {
+					tmpVec.push_back(this->cellNFaces[i]);
+				}
+
+				// Update the source to shuffled order
+				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellNFaces.size());
+				for(I i = 0; i < iLimit; i++) {
+					L label = localToBuildID[i];
+					I graphLocalID;
+					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphLocalID);
+					CHECK_ECODE(status)
+					this->cellNFaces[graphLocalID] = tmpVec[i];
+				}
+
+				// (4) Shuffle the cellNGFaces data structure
+				// Make a copy
+				tmpVec.clear();
+				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellNGFaces.size());
+				for(I i = 0; i < iLimit; i++) {
+					tmpVec.push_back(this->cellNGFaces[i]);
+				}
+
+				// Update the source to shuffled order
+				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellNGFaces.size());
+				for(I i = 0; i < iLimit; i++) {
+					L label = localToBuildID[i];
+					I graphLocalID;
+					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphLocalID);
+					CHECK_ECODE(status)
+					this->cellNGFaces[graphLocalID] = tmpVec[i];
+				}
+
+				// (5) Shuffle the cellNGVertices data structure
+				// Make a copy
+				tmpVec.clear();
+				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellNGVertices.size());
+				for(I i = 0; i < iLimit; i++) {
+					tmpVec.push_back(this->cellNGVertices[i]);
+				}
+
+				// Update the source to shuffled order
+				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellNGVertices.size());
+				for(I i = 0; i < iLimit; i++) {
+					L label = localToBuildID[i];
+					I graphLocalID;
+					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphLocalID);
+					CHECK_ECODE(status)
+					this->cellNGVertices[graphLocalID] = tmpVec[i];
+				}
+
+				// (6) Shuffle the cellNVertices data structure
+				// Make a copy
+				tmpVec.clear();
+				// for(I i = 0; i < this->cellNVertices.size(); i++)
+				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellNVertices.size());
+				for(I i = 0; i < iLimit; i++) {
+					tmpVec.push_back(this->cellNVertices[i]);
+				}
+
+				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellNVertices.size());
+				for(I i = 0; i < iLimit; i++) {
+					L label = localToBuildID[i];
+					I graphLocalID;
+					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphLocalID);
+					CHECK_ECODE(status)
+					this->cellNVertices[graphLocalID] = tmpVec[i];
+				}
+
+				// (7) Shuffle the Cell->Face CSR Data Structure
+				// For now, we will not re-shuffle this, and presume that it is rebuilt/built after calling this method
+				// by calling updateCellFaceMap
+
+				// (8) Finally, correct the cellBuildIDToLocalID data structure to point at the new
+				// mesh local IDs (i.e. the graph local IDs)
+				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellBuildIDToLocalID.size());
+				for(I i = 0; i < iLimit; i++) {
+					L label = localToBuildID[i];
+					I graphCellID;
+					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphCellID);
+					CHECK_ECODE(status)
+					this->cellBuildIDToLocalID[label] = graphCellID;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			void CupCfdAoSoAMesh<I,T,L,W>::packCellFaceMap() {
+				I stride = (I) shapes::getPolyhedronNFaces(this->properties.cellType);
+
+				// Mixed cell types keep the CSR mapping
+				if((stride == 0) || (this->cellFaceStride > 0)) {
+					return;
+				}
+
+				I nCells = cupcfd::utility::drivers::safeConvertSizeT<I>(this->cellFaceMapCSRXAdj.size()) - 1;
+				cupcfd::data_structures::AlignedVector<I> cellFaceMap(nCells * stride, I(-1));
+
+				for(I i = 0; i < nCells; i++) {
+					I rangeStart = this->cellFaceMapCSRXAdj[i];
+					I rangeSize = this->cellFaceMapCSRXAdj[i+1] - this->cellFaceMapCSRXAdj[i];
+
+					for(I j = 0; j < rangeSize; j++) {
+						cellFaceMap[(i * stride) + j] = this->cellFaceMapCSRAdj[rangeStart + j];
+					}
+				}
+
+				this->cellFaceMapCSRAdj.swap(cellFaceMap);
+				this->cellFaceMapCSRXAdj.clear();
+				this->cellFaceStride = stride;
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::finalize() {
+				cupcfd::error::eCodes status;
+				// Now all data has been added, finalize the connectivity graph to ensure all
+				// structures are fixed
+
+				// This will be blocking on all members of the graph communicator, and so makes
+				// this method also a blocking method
+
+				status = this->cellConnGraph->finalize();
+				CHECK_ECODE(status)
+
+				// Check that every boundary is mapped to a face
+				I iLimit;
+				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(this->boundaryFaceID.size());
+				for(I i = 0; i < iLimit; i++) {
+					if(this->boundaryFaceID[i] == -1) {
+						return cupcfd::error::E_MESH_UNMAPPED_BOUNDARY_FACE;
+					}
+				}
+
+
+				// Now all cells have been added, we need to order the local cell objects
+				// to have the same local indexes as in the connectivity graph
+				// This also requires an update of the face->cell1 and face->cell2 mappings
+				// where appropriate
+
+				// Important - This should be done before Cell->Face Mapping and Cell->NVertices Mapping
+				// to ensure that the correct indexes are used for those functions
+				status = this->updateCellLocalIndexes();
+				CHECK_ECODE(status)
+
+				status = this->updateCellFaceMap();
+				CHECK_ECODE(status)
+
+				// Exchange the Global NVertices so Ghost Cells have the correct values
+				status = this->exchangeCellGlobalNVertices();
+				CHECK_ECODE(status)
+
+				// Exchange the Global NFace counts so Ghost Cells have the correct values
+				status = this->exchangeCellGlobalNFaces();
+				CHECK_ECODE(status)
+
+				// If every cell has the same type, store the cell->face mapping with a fixed stride
+				this->detectCellType();
+				this->packCellFaceMap();
+
+				// Derive the face geometry from the vertices and cell centres
+				status = this->computeFaceGeometry();
+				CHECK_ECODE(status)
+
+				// Colour the cells and faces now their local indexes are fixed
+				status = this->buildColourings(false);
+				CHECK_ECODE(status)
+
+				// Release the spare capacity left by the adds, so that each store is a single exactly
+				// sized allocation with its pages placed by the threads that will use them
+				this->shrinkStores();
+
+				// Update status
+				this->finalized = true;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::exchangeCellGlobalNVertices() {
+				// Should only be called as part of the finalise step, since it requires the connectivity graph to
+				// be set up
+
+				// ToDo: This should be moved out to a configuration item rather than hardcoded.
+				cupcfd::comm::ExchangePatternConfig exchangePatternConfig(cupcfd::comm::EXCHANGE_NONBLOCKING_ONE_SIDED);
+				cupcfd::comm::ExchangePattern<I> * exchangePattern;
+
+				cupcfd::error::eCodes status;
+
+				// Build the exchange pattern for cells
+				status = exchangePatternConfig.buildExchangePattern(&exchangePattern, *(this->cellConnGraph));
+				CHECK_ECODE(status)
+
+				// Build an array of the number of vertices for local cells, leave space for ghost cells
+				// but their values don't matter at this stage
+				I nCells = this->cellConnGraph->nLONodes + this->cellConnGraph->nLGhNodes;
+
+				I * nVertices = (I *) malloc(sizeof(I) * nCells);
+
+				for(I i = 0; i < nCells; i++) {
+					// For local cells, stored vertices = global vertices
+					// Ghost cell data will be overwritten after exchange
+					nVertices[i] = this->getCellStoredNVertices(i);
+				}
+
+				// MPI Exchange
+				status = exchangePattern->exchangeStart(nVertices, nCells);
+				CHECK_ECODE(status)
+				status = exchangePattern->exchangeStop(nVertices, nCells);
+				CHECK_ECODE(status)
+
+				// Overwrite the Global Counts for Ghost Cells on this rank with the received data
+				for(I i = this->cellConnGraph->nLONodes; i < nCells; i++) {
+					this->cellNGVertices[i] = nVertices[i];
+				}
+
+				free(nVertices);
+
+				delete exchangePattern;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::exchangeCellGlobalNFaces() {
+				// Should only be called as part of the finalise step, since it requires the connectivity graph to
+				// be set up
+
+				// ToDo: This should be moved out to a configuration item rather than hardcoded.
+				cupcfd::comm::ExchangePatternConfig exchangePatternConfig(cupcfd::comm::EXCHANGE_NONBLOCKING_ONE_SIDED);
+				cupcfd::comm::ExchangePattern<I> * exchangePattern;
+
+				cupcfd::error::eCodes status;
+
+				// Build the exchange pattern for cells
+				status = exchangePatternConfig.buildExchangePattern(&exchangePattern, *(this->cellConnGraph));
+				CHECK_ECODE(status)
+
+				// Build an array of the number of vertices for local cells, leave space for ghost cells
+				// but their values don't matter at this stage
+				I nCells = this->cellConnGraph->nLONodes + this->cellConnGraph->nLGhNodes;
+
+				I * nFaces = (I *) malloc(sizeof(I) * nCells);
+
+				for(I i = 0; i < nCells; i++) {
+					// For local cells, stored vertices = global vertices
+					// Ghost cell data will be overwritten after exchange
+					nFaces[i] = this->getCellStoredNFaces(i);
+				}
+
+				// MPI Exchange
+				status = exchangePattern->exchangeStart(nFaces, nCells);
+				CHECK_ECODE(status)
+				status = exchangePattern->exchangeStop(nFaces, nCells);
+				CHECK_ECODE(status)
+
+				// Overwrite the Global Counts for Ghost Cells on this rank with the received data
+				for(I i = this->cellConnGraph->nLONodes; i < nCells; i++) {
+					this->cellNGFaces[i] = nFaces[i];
+				}
+
+				free(nFaces);
+				delete exchangePattern;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			void CupCfdAoSoAMesh<I,T,L,W>::shrinkStores() {
+				// Boundary Data
+				this->boundaryFaceID.shrink_to_fit();
+				this->boundaryDistance.shrink_to_fit();
+				this->boundaryYPlus.shrink_to_fit();
+				this->boundaryUPlus.shrink_to_fit();
+				this->boundaryRegionID.shrink_to_fit();
+				this->boundaryShear.shrink_to_fit();
+				this->boundaryQ.shrink_to_fit();
+				this->boundaryH.shrink_to_fit();
+				this->boundaryT.shrink_to_fit();
+				this->boundaryVertexID.shrinkToFit();
+
+				// Cell Data
+				this->cellTiles.shrink_to_fit();
+				this->cellNGFaces.shrink_to_fit();
+				this->cellNFaces.shrink_to_fit();
+				this->cellNGVertices.shrink_to_fit();
+				this->cellNVertices.shrink_to_fit();
+				this->cellFaceMapCSRXAdj.shrink_to_fit();
+				this->cellFaceMapCSRAdj.shrink_to_fit();
+
+				// Face Data
+				this->faceTiles.shrink_to_fit();
+				this->faceVertexID.shrinkToFit();
+
+				// Vertex Data
+				this->verticesPos.shrink_to_fit();
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::getPagePlacement(std::vector<std::size_t>& nodePages, std::size_t * nUnplaced) {
+				cupcfd::error::eCodes status;
+
+				// Boundary Data
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryFaceID, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryDistance, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryYPlus, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryUPlus, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryRegionID, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryShear, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryQ, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryH, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryT, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = this->boundaryVertexID.getPagePlacement(nodePages, nUnplaced);
+				CHECK_ECODE(status)
+
+				// Cell Data
+				status = cupcfd::utility::drivers::getPageNodes(this->cellTiles, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellNGFaces, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellNFaces, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellNGVertices, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellNVertices, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellFaceMapCSRXAdj, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellFaceMapCSRAdj, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+
+				// Face Data
+				status = cupcfd::utility::drivers::getPageNodes(this->faceTiles, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = this->faceVertexID.getPagePlacement(nodePages, nUnplaced);
+				CHECK_ECODE(status)
+
+				// Vertex Data
+				status = cupcfd::utility::drivers::getPageNodes(this->verticesPos, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			std::size_t CupCfdAoSoAMesh<I,T,L,W>::getBuildMapMemoryBytes() const {
+				return this->vertexBuildIDToLocalID.getMemoryBytes()
+					 + this->boundaryBuildIDToLocalID.getMemoryBytes()
+					 + this->regionBuildIDToLocalID.getMemoryBytes()
+					 + this->cellBuildIDToLocalID.getMemoryBytes()
+					 + this->faceBuildIDToLocalID.getMemoryBytes();
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::writeSnapshotData(cupcfd::io::SnapshotFile& file) {
+				cupcfd::error::eCodes status;
+
+				// std::vector<bool> is packed, so store the region flags as one byte per entry
+				I nRegions = cupcfd::utility::drivers::safeConvertSizeT<I>(this->regionType.size());
+				std::vector<unsigned char> regionFlags(3 * nRegions);
+
+				for(I i = 0; i < nRegions; i++) {
+					regionFlags[3 * i] = (unsigned char) this->regionStd[i];
+					regionFlags[(3 * i) + 1] = (unsigned char) this->regionFlux[i];
+					regionFlags[(3 * i) + 2] = (unsigned char) this->regionAdiab[i];
+				}
+
+				// Boundary Data
+				status = file.writeVector(this->boundaryFaceID);
+				CHECK_ECODE(status)
+				status = this->boundaryVertexID.writeSnapshot(file);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryDistance);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryYPlus);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryUPlus);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryRegionID);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryShear);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryQ);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryH);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryT);
+				CHECK_ECODE(status)
+
+				// Cell Data
+				status = file.writeVector(this->cellTiles);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellNGFaces);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellNFaces);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellNGVertices);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellNVertices);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellFaceMapCSRXAdj);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellFaceMapCSRAdj);
+				CHECK_ECODE(status)
+
+				// Face Data
+				status = file.writeVector(this->faceTiles);
+				CHECK_ECODE(status)
+				status = this->faceVertexID.writeSnapshot(file);
+				CHECK_ECODE(status)
+
+				// Region Data
+				status = file.writeVector(this->regionType);
+				CHECK_ECODE(status)
+				status = file.writeVector(regionFlags);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionYLog);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionELog);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionDensity);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionTurbKE);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionTurbDiss);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionSplvl);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionDen);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionForceTangent);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionUVW);
+				CHECK_ECODE(status)
+				status = file.writeStrings(this->regionName);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionR);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionT);
+				CHECK_ECODE(status)
+
+				// Vertex Data
+				status = file.writeVector(this->verticesPos);
+				CHECK_ECODE(status)
+
+				// Build ID Lookups
+				status = file.writeMap(this->vertexBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.writeMap(this->boundaryBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.writeMap(this->regionBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.writeMap(this->cellBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.writeMap(this->faceBuildIDToLocalID);
+				CHECK_ECODE(status)
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			cupcfd::error::eCodes CupCfdAoSoAMesh<I,T,L,W>::readSnapshotData(cupcfd::io::SnapshotFile& file) {
+				cupcfd::error::eCodes status;
+
+				std::vector<unsigned char> regionFlags;
+
+				// Boundary Data
+				status = file.readVector(this->boundaryFaceID);
+				CHECK_ECODE(status)
+				status = this->boundaryVertexID.readSnapshot(file);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryDistance);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryYPlus);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryUPlus);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryRegionID);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryShear);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryQ);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryH);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryT);
+				CHECK_ECODE(status)
+
+				// Cell Data
+				status = file.readVector(this->cellTiles);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellNGFaces);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellNFaces);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellNGVertices);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellNVertices);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellFaceMapCSRXAdj);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellFaceMapCSRAdj);
+				CHECK_ECODE(status)
+
+				// Face Data
+				status = file.readVector(this->faceTiles);
+				CHECK_ECODE(status)
+				status = this->faceVertexID.readSnapshot(file);
+				CHECK_ECODE(status)
+
+				// Region Data
+				status = file.readVector(this->regionType);
+				CHECK_ECODE(status)
+				status = file.readVector(regionFlags);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionYLog);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionELog);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionDensity);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionTurbKE);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionTurbDiss);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionSplvl);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionDen);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionForceTangent);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionUVW);
+				CHECK_ECODE(status)
+				status = file.readStrings(this->regionName);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionR);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionT);
+				CHECK_ECODE(status)
+
+				// Vertex Data
+				status = file.readVector(this->verticesPos);
+				CHECK_ECODE(status)
+
+				// Build ID Lookups
+				status = file.readMap(this->vertexBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.readMap(this->boundaryBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.readMap(this->regionBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.readMap(this->cellBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.readMap(this->faceBuildIDToLocalID);
+				CHECK_ECODE(status)
+
+				// Check the stores are consistent with the mesh properties read by the interface
+				// A mesh of a single fixed cell type stores the cell->face mapping with a fixed stride
+				I stride = (I) shapes::getPolyhedronNFaces(this->properties.cellType);
+				std::size_t nRegions = this->regionType.size();
+
+				this->nCellRecords = this->properties.lTCells;
+				this->nFaceRecords = this->properties.lFaces;
+
+				if((this->cellTiles.size() != (std::size_t) this->getNCellTiles()) ||
+				   ((stride == 0) && (this->cellFaceMapCSRXAdj.size() != (std::size_t) this->properties.lTCells + 1)) ||
+				   ((stride > 0) && (this->cellFaceMapCSRAdj.size() != (std::size_t) (this->properties.lTCells * stride))) ||
+				   (this->faceTiles.size() != (std::size_t) this->getNFaceTiles()) ||
+				   (this->faceVertexID.size() != this->properties.lFaces) ||
+				   (this->boundaryFaceID.size() != (std::size_t) this->properties.lBoundaries) ||
+				   (this->boundaryVertexID.size() != this->properties.lBoundaries) ||
+				   (this->verticesPos.size() != (std::size_t) this->properties.lVertices) ||
+				   (nRegions != (std::size_t) this->properties.lRegions) ||
+				   (regionFlags.size() != 3 * nRegions)) {
+					this->reset();
+					return cupcfd::error::E_INVALID_FILE_FORMAT;
+				}
+
+				this->cellFaceStride = stride;
+
+				this->regionStd.resize(nRegions);
+				this->regionFlux.resize(nRegions);
+				this->regionAdiab.resize(nRegions);
+
+				for(std::size_t i = 0; i < nRegions; i++) {
+					this->regionStd[i] = (regionFlags[3 * i] != 0);
+					this->regionFlux[i] = (regionFlags[(3 * i) + 1] != 0);
+					this->regionAdiab[i] = (regionFlags[(3 * i) + 2] != 0);
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L, int W>
+			void CupCfdAoSoAMesh<I,T,L,W>::resizeFaceTiles(I nFaces) {
+				// Zero the lanes past the end of the last tile, so that partially filled tiles can be
+				// processed in full
+				if(nFaces < this->nFaceRecords) {
+					this->faceTiles.resize((nFaces + W - 1) / W);
+
+					if(nFaces % W != 0) {
+						CupCfdAoSoAMeshFaceTile<I,T,W>& tile = this->faceTiles.back();
+						CupCfdAoSoAMeshFaceTile<I,T,W> zero = CupCfdAoSoAMeshFaceTile<I,T,W>();
+
+						for(I lane = nFaces % W; lane < W; lane++) {
+							tile.cell1ID[lane] = zero.cell1ID[lane];
+							tile.cell2ID[lane] = zero.cell2ID[lane];
+							tile.boundaryID[lane] = zero.boundaryID[lane];
+							tile.lambda[lane] = zero.lambda[lane];
+							tile.rlencos[lane] = zero.rlencos[lane];
+							tile.area[lane] = zero.area[lane];
+
+							for(int d = 0; d < 3; d++) {
+								tile.norm[d][lane] = zero.norm[d][lane];
+								tile.center[d][lane] = zero.center[d][lane];
+								tile.xpac[d][lane] = zero.xpac[d][lane];
+								tile.xnac[d][lane] = zero.xnac[d][lane];
+							}
+						}
+					}
+				}
+				else {
+					// Value initialisation zeroes the new tiles
+					this->faceTiles.resize((nFaces + W - 1) / W, CupCfdAoSoAMeshFaceTile<I,T,W>());
+				}
+
+				this->nFaceRecords = nFaces;
+			}
+
+			template <class I, class T, class L, int W>
+			void CupCfdAoSoAMesh<I,T,L,W>::resizeCellTiles(I nCells) {
+				if(nCells < this->nCellRecords) {
+					this->cellTiles.resize((nCells + W - 1) / W);
+
+					if(nCells % W != 0) {
+						CupCfdAoSoAMeshCellTile<T,W>& tile = this->cellTiles.back();
+
+						for(I lane = nCells % W; lane < W; lane++) {
+							tile.center[0][lane] = T(0);
+							tile.center[1][lane] = T(0);
+							tile.center[2][lane] = T(0);
+							tile.volume[lane] = T(0);
+						}
+					}
+				}
+				else {
+					this->cellTiles.resize((nCells + W - 1) / W, CupCfdAoSoAMeshCellTile<T,W>());
+				}
+
+				this->nCellRecords = nCells;
+			}
+
+			// Explicit Instantiation
+			template class CupCfdAoSoAMesh<int, float, int, 4>;
+			template class CupCfdAoSoAMesh<int, double, int, 4>;
+			template class CupCfdAoSoAMesh<int, float, int, 8>;
+			template class CupCfdAoSoAMesh<int, double, int, 8>;
+			template class CupCfdAoSoAMesh<int, float, int, 16>;
+			template class CupCfdAoSoAMesh<int, double, int, 16>;
+
+			template class CupCfdAoSoAMesh<int, float, long, CUPCFD_AOSOA_MESH_TILE_WIDTH>;
+			template class CupCfdAoSoAMesh<int, double, long, CUPCFD_AOSOA_MESH_TILE_WIDTH>;
+		}
+	}
+}
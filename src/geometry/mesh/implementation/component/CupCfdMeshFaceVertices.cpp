@@ -0,0 +1,161 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the CupCfdMeshFaceVertices Class
+ */
+
+#include "CupCfdMeshFaceVertices.h"
+#include "MemoryDrivers.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I>
+			CupCfdMeshFaceVertices<I>::CupCfdMeshFaceVertices()
+			{
+				#if !CUPCFD_MESH_FIXED_FACE_VERTICES
+					this->xadj.push_back(I(0));
+				#endif
+			}
+
+			template <class I>
+			CupCfdMeshFaceVertices<I>::~CupCfdMeshFaceVertices()
+			{
+
+			}
+
+			template <class I>
+			void CupCfdMeshFaceVertices<I>::append(I nVertices) {
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					// Unused slots are also -1, so a triangular face has a -1 in the 4th slot
+					(void) nVertices;
+					std::array<I,4> tmp = {I(-1), I(-1), I(-1), I(-1)};
+					this->vertexID.push_back(tmp);
+				#else
+					this->adj.resize(this->adj.size() + nVertices, I(-1));
+					this->xadj.push_back((I) this->adj.size());
+				#endif
+			}
+
+			template <class I>
+			void CupCfdMeshFaceVertices<I>::append(const I * vertexXAdj, I nFaces) {
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					(void) vertexXAdj;
+					std::array<I,4> tmp = {I(-1), I(-1), I(-1), I(-1)};
+					this->vertexID.resize(this->vertexID.size() + nFaces, tmp);
+				#else
+					I offset = this->xadj.back();
+					I base = vertexXAdj[0];
+
+					this->xadj.reserve(this->xadj.size() + nFaces);
+					for(I i = 0; i < nFaces; i++) {
+						// Clamp negative counts so the offsets stay ordered
+						I next = vertexXAdj[i+1] - base;
+						I prev = this->xadj.back() - offset;
+						this->xadj.push_back(offset + ((next > prev) ? next : prev));
+					}
+
+					this->adj.resize(this->xadj.back(), I(-1));
+				#endif
+			}
+
+			template <class I>
+			void CupCfdMeshFaceVertices<I>::truncate(I nFaces) {
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					this->vertexID.resize(nFaces);
+				#else
+					this->xadj.resize(nFaces + 1);
+					this->adj.resize(this->xadj.back());
+				#endif
+			}
+
+			template <class I>
+			void CupCfdMeshFaceVertices<I>::clear() {
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					this->vertexID.clear();
+				#else
+					this->xadj.assign(1, I(0));
+					this->adj.clear();
+				#endif
+			}
+
+			template <class I>
+			void CupCfdMeshFaceVertices<I>::shrinkToFit() {
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					this->vertexID.shrink_to_fit();
+				#else
+					this->xadj.shrink_to_fit();
+					this->adj.shrink_to_fit();
+				#endif
+			}
+
+			template <class I>
+			cupcfd::error::eCodes CupCfdMeshFaceVertices<I>::getPagePlacement(std::vector<std::size_t>& nodePages, std::size_t * nUnplaced) {
+				cupcfd::error::eCodes status;
+
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					status = cupcfd::utility::drivers::getPageNodes(this->vertexID, nodePages, nUnplaced);
+					CHECK_ECODE(status)
+				#else
+					status = cupcfd::utility::drivers::getPageNodes(this->xadj, nodePages, nUnplaced);
+					CHECK_ECODE(status)
+					status = cupcfd::utility::drivers::getPageNodes(this->adj, nodePages, nUnplaced);
+					CHECK_ECODE(status)
+				#endif
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I>
+			cupcfd::error::eCodes CupCfdMeshFaceVertices<I>::writeSnapshot(cupcfd::io::SnapshotFile& file) {
+				cupcfd::error::eCodes status;
+
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					status = file.writeVector(this->vertexID);
+					CHECK_ECODE(status)
+				#else
+					status = file.writeVector(this->xadj);
+					CHECK_ECODE(status)
+					status = file.writeVector(this->adj);
+					CHECK_ECODE(status)
+				#endif
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I>
+			cupcfd::error::eCodes CupCfdMeshFaceVertices<I>::readSnapshot(cupcfd::io::SnapshotFile& file) {
+				cupcfd::error::eCodes status;
+
+				#if CUPCFD_MESH_FIXED_FACE_VERTICES
+					status = file.readVector(this->vertexID);
+					CHECK_ECODE(status)
+				#else
+					status = file.readVector(this->xadj);
+					CHECK_ECODE(status)
+					status = file.readVector(this->adj);
+					CHECK_ECODE(status)
+
+					if(this->xadj.size() == 0 || (std::size_t) this->xadj.back() != this->adj.size()) {
+						this->clear();
+						return cupcfd::error::E_INVALID_FILE_FORMAT;
+					}
+				#endif
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// Explicit Instantiation
+			template class CupCfdMeshFaceVertices<int>;
+		}
+	}
+}
@@ -12,6 +12,8 @@
  */
 
 #include <cstdlib>
+#include <algorithm>
+#include <utility>
 
 #include "CupCfdSoAMesh.h"
 
@@ -124,6 +126,92 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdSoAMesh<I,T,L>::addCells(
+						L * cellLabels,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3> * centers,
+						T * vols,
+						I nCells,
+						bool isLocal) {
+				cupcfd::error::eCodes status;
+
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				if(nCells <= 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Check the labels are not repeated (sorts a copy unless already sorted)
+				I nDistinct;
+				status = cupcfd::utility::drivers::distinctCount(cellLabels, nCells, &nDistinct);
+				CHECK_ECODE(status)
+
+				if(nDistinct != nCells) {
+					return cupcfd::error::E_MESH_EXISTING_CELL;
+				}
+
+				// Check the labels do not already exist in the mesh or the connectivity graph
+				bool exists = false;
+
+				#pragma omp parallel for reduction(||:exists)
+				for(I i = 0; i < nCells; i++) {
+					if(this->cellBuildIDToLocalID.find(cellLabels[i]) != this->cellBuildIDToLocalID.end() ||
+					   this->cellConnGraph->existsNode(cellLabels[i])) {
+						exists = true;
+					}
+				}
+
+				if(exists) {
+					return cupcfd::error::E_MESH_EXISTING_CELL;
+				}
+
+				// Size the stores once, with the face and vertex counts initialised to 0
+				I offset = this->cellCenter.size();
+				this->cellCenter.resize(offset + nCells);
+				this->cellVolume.resize(offset + nCells);
+				this->cellNFaces.resize(offset + nCells, 0);
+				this->cellNGFaces.resize(offset + nCells, 0);
+				this->cellNVertices.resize(offset + nCells, 0);
+				this->cellNGVertices.resize(offset + nCells, 0);
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < nCells; i++) {
+					this->cellCenter[offset + i] = centers[i];
+					this->cellVolume[offset + i] = vols[i];
+				}
+
+				// Add the cells to the connectivity graph and store their current 'local ID'
+				// (see addCell) in insertion order
+				this->cellBuildIDToLocalID.reserve(this->cellBuildIDToLocalID.size() + nCells);
+
+				for(I i = 0; i < nCells; i++) {
+					if(isLocal) {
+						status = this->cellConnGraph->addLocalNode(cellLabels[i]);
+					}
+					else {
+						status = this->cellConnGraph->addGhostNode(cellLabels[i]);
+					}
+					CHECK_ECODE(status)
+
+					this->cellBuildIDToLocalID[cellLabels[i]] = offset + i;
+				}
+
+				// Update the mesh properties
+				this->properties.lTCells = this->properties.lTCells + nCells;
+
+				if(isLocal) {
+					this->properties.lOCells = this->properties.lOCells + nCells;
+				}
+				else {
+					this->properties.lGhCells = this->properties.lGhCells + nCells;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			// === Vertex Operators ===
 
 			template <class I, class T, class L>
@@ -150,6 +238,64 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdSoAMesh<I,T,L>::addVertices(L * vertexLabels, cupcfd::geometry::euclidean::EuclideanPoint<T,3> * pos, I nVertices) {
+				cupcfd::error::eCodes status;
+
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				if(nVertices <= 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Check the labels are not repeated (sorts a copy unless already sorted)
+				I nDistinct;
+				status = cupcfd::utility::drivers::distinctCount(vertexLabels, nVertices, &nDistinct);
+				CHECK_ECODE(status)
+
+				if(nDistinct != nVertices) {
+					return cupcfd::error::E_MESH_EXISTING_VERTEX;
+				}
+
+				// Check the labels do not already exist
+				bool exists = false;
+
+				#pragma omp parallel for reduction(||:exists)
+				for(I i = 0; i < nVertices; i++) {
+					if(this->vertexBuildIDToLocalID.find(vertexLabels[i]) != this->vertexBuildIDToLocalID.end()) {
+						exists = true;
+					}
+				}
+
+				if(exists) {
+					return cupcfd::error::E_MESH_EXISTING_VERTEX;
+				}
+
+				// Copy Positions
+				I offset = this->verticesPos.size();
+				this->verticesPos.resize(offset + nVertices);
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < nVertices; i++) {
+					this->verticesPos[offset + i] = pos[i];
+				}
+
+				// Store a mapping of the Build IDs to the Local IDs
+				this->vertexBuildIDToLocalID.reserve(this->vertexBuildIDToLocalID.size() + nVertices);
+
+				for(I i = 0; i < nVertices; i++) {
+					this->vertexBuildIDToLocalID[vertexLabels[i]] = offset + i;
+				}
+
+				// Update Mesh Properties
+				this->properties.lVertices = this->properties.lVertices + nVertices;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			// === Region Operators ===
 
 			template <class I, class T, class L>
@@ -243,25 +389,24 @@ namespace cupcfd
 				// It will be updated as part of the finalize stage based on the face->boundary mappings
 				this->boundaryFaceID.push_back(I(-1));
 
-				// Check the vertex count is valid
-				// Currently, we only handle 3-4 vertex faces/boundaries
-				if(nVertexLabels < 3 || nVertexLabels > 4) {
+				// Check the vertex count is valid for the vertex storage layout
+				if(!CupCfdMeshFaceVertices<I>::isValidCount(nVertexLabels)) {
 					return cupcfd::error::E_MESH_INVALID_VERTEX_COUNT;
 				}
 
-				// Copy the vertexIDs, if they exist
-				std::array<I,4> tmp = {I(-1), I(-1), I(-1), I(-1)};
+				// Check the vertices exist
 				for(I i = 0; i < nVertexLabels; i++) {
-					// Check the vertex exists
 					if(this->vertexBuildIDToLocalID.find(vertexLabels[i]) == this->vertexBuildIDToLocalID.end()) {
 						return cupcfd::error::E_MESH_INVALID_VERTEX_LABEL;
 					}
+				}
 
-					// Point Boundary at Vertex Local ID
-					tmp[i] = vertexBuildIDToLocalID[vertexLabels[i]];
+				// Point Boundary at Vertex Local IDs
+				I boundaryID = this->boundaryVertexID.size();
+				this->boundaryVertexID.append(nVertexLabels);
+				for(I i = 0; i < nVertexLabels; i++) {
+					this->boundaryVertexID.setVertex(boundaryID, i, vertexBuildIDToLocalID[vertexLabels[i]]);
 				}
-				// If only 3 vertices, 4th should still be -1.
-				this->boundaryVertexID.push_back(tmp);
 
 				// Copy distance
 				this->boundaryDistance.push_back(distance);
@@ -303,6 +448,129 @@ namespace cupcfd
 				return this->addBoundary(boundaryLabel, regionLabel, vertexLabels, nVertexLabels, distance);
 			}
 
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdSoAMesh<I,T,L>::addBoundaries(
+					L * boundaryLabels,
+					L * regionLabels,
+					I * vertexXAdj, L * vertexLabels,
+					T * distance,
+					I nBoundaries) {
+				cupcfd::error::eCodes status;
+
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				if(nBoundaries <= 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Check the labels are not repeated (sorts a copy unless already sorted)
+				I nDistinct;
+				status = cupcfd::utility::drivers::distinctCount(boundaryLabels, nBoundaries, &nDistinct);
+				CHECK_ECODE(status)
+
+				if(nDistinct != nBoundaries) {
+					return cupcfd::error::E_MESH_EXISTING_BOUNDARY;
+				}
+
+				// Check the labels do not already exist
+				bool exists = false;
+
+				#pragma omp parallel for reduction(||:exists)
+				for(I i = 0; i < nBoundaries; i++) {
+					if(this->boundaryBuildIDToLocalID.find(boundaryLabels[i]) != this->boundaryBuildIDToLocalID.end()) {
+						exists = true;
+					}
+				}
+
+				if(exists) {
+					return cupcfd::error::E_MESH_EXISTING_BOUNDARY;
+				}
+
+				// Resolve the vertex and region labels to local IDs in parallel.
+				// If any boundary is invalid, the error of the first (by position) is returned
+				// and the stores are restored to their previous size.
+				I offset = this->boundaryRegionID.size();
+				this->boundaryVertexID.append(vertexXAdj, nBoundaries);
+				this->boundaryRegionID.resize(offset + nBoundaries);
+
+				I errorIdx = nBoundaries;
+				cupcfd::error::eCodes errorStatus = cupcfd::error::E_SUCCESS;
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < nBoundaries; i++) {
+					cupcfd::error::eCodes itemStatus = cupcfd::error::E_SUCCESS;
+					I nVertexLabels = vertexXAdj[i+1] - vertexXAdj[i];
+
+					if(!CupCfdMeshFaceVertices<I>::isValidCount(nVertexLabels)) {
+						itemStatus = cupcfd::error::E_MESH_INVALID_VERTEX_COUNT;
+					}
+
+					for(I j = 0; j < nVertexLabels && itemStatus == cupcfd::error::E_SUCCESS; j++) {
+						auto find = this->vertexBuildIDToLocalID.find(vertexLabels[vertexXAdj[i] + j]);
+						if(find == this->vertexBuildIDToLocalID.end()) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_VERTEX_LABEL;
+						}
+						else {
+							this->boundaryVertexID.setVertex(offset + i, j, find->second);
+						}
+					}
+
+					auto region = this->regionBuildIDToLocalID.find(regionLabels[i]);
+					if(itemStatus == cupcfd::error::E_SUCCESS && region == this->regionBuildIDToLocalID.end()) {
+						itemStatus = cupcfd::error::E_MESH_INVALID_REGION_LABEL;
+					}
+
+					if(itemStatus != cupcfd::error::E_SUCCESS) {
+						#pragma omp critical(cupcfd_mesh_add_error)
+						{
+							if(i < errorIdx) {
+								errorIdx = i;
+								errorStatus = itemStatus;
+							}
+						}
+					}
+					else {
+						this->boundaryRegionID[offset + i] = region->second;
+					}
+				}
+
+				if(errorStatus != cupcfd::error::E_SUCCESS) {
+					this->boundaryVertexID.truncate(offset);
+					this->boundaryRegionID.resize(offset);
+					return errorStatus;
+				}
+
+				// Size the remaining stores. The faceID is initially unknown, and will be set when the
+				// boundary's face is added. The other properties default to 0.
+				this->boundaryFaceID.resize(offset + nBoundaries, I(-1));
+				this->boundaryDistance.resize(offset + nBoundaries);
+				this->boundaryYPlus.resize(offset + nBoundaries, T(0));
+				this->boundaryUPlus.resize(offset + nBoundaries, T(0));
+				this->boundaryShear.resize(offset + nBoundaries, cupcfd::geometry::euclidean::EuclideanVector<T,3>(T(0), T(0), T(0)));
+				this->boundaryQ.resize(offset + nBoundaries, T(0));
+				this->boundaryH.resize(offset + nBoundaries, T(0));
+				this->boundaryT.resize(offset + nBoundaries, T(0));
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < nBoundaries; i++) {
+					this->boundaryDistance[offset + i] = distance[i];
+				}
+
+				// Store a mapping of the Build IDs to the Local IDs
+				this->boundaryBuildIDToLocalID.reserve(this->boundaryBuildIDToLocalID.size() + nBoundaries);
+
+				for(I i = 0; i < nBoundaries; i++) {
+					this->boundaryBuildIDToLocalID[boundaryLabels[i]] = offset + i;
+				}
+
+				this->properties.lBoundaries = this->properties.lBoundaries + nBoundaries;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			// === Face Operators ===
 
 			template <class I, class T, class L>
@@ -359,9 +627,10 @@ namespace cupcfd
 					}
 
 					// Check this is not a face between two ghost cells
-					// We only accept faces between local->local, or local->ghost cells
+					// We only accept faces between local->local, or local->ghost cells, unless the halo is more than
+					// one layer deep (where the faces of the inner ghost layers are also stored)
 					// Since this graph shouldn't be finalised yet, the data will be stored in the build graph
-					if(!isBoundary) {
+					if(!isBoundary && this->properties.haloDepth <= 1) {
 						bool foundGhost1 = this->cellConnGraph->existsGhostNode(cell1Label);
 						bool foundGhost2 = this->cellConnGraph->existsGhostNode(cell2OrBoundaryLabel);
 						if(foundGhost1 && foundGhost2) {
@@ -401,26 +670,24 @@ namespace cupcfd
 				// Copy the face norm
 				this->faceNorm.push_back(norm);
 
-				// Check the vertex count is valid
-				// Currently, we only handle 3-4 vertex faces/boundaries
-				if(nVertexLabels < 3 || nVertexLabels > 4) {
+				// Check the vertex count is valid for the vertex storage layout
+				if(!CupCfdMeshFaceVertices<I>::isValidCount(nVertexLabels)) {
 					return cupcfd::error::E_MESH_INVALID_VERTEX_COUNT;
 				}
 
-				// Copy the vertexIDs, if they exist
-				std::array<I,4> tmp = {I(-1), I(-1), I(-1), I(-1)};
-
+				// Check the vertices exist
 				for(I i = 0; i < nVertexLabels; i++) {
-					// Check the vertex exists
 					if(this->vertexBuildIDToLocalID.find(vertexLabels[i]) == this->vertexBuildIDToLocalID.end()) {
 						return cupcfd::error::E_MESH_INVALID_VERTEX_LABEL;
 					}
-
-					// Point Boundary at Vertex Local ID
-					tmp[i] = vertexBuildIDToLocalID[vertexLabels[i]];
 				}
 
-				this->faceVertexID.push_back(tmp);
+				// Point Face at Vertex Local IDs
+				I faceID = this->faceVertexID.size();
+				this->faceVertexID.append(nVertexLabels);
+				for(I i = 0; i < nVertexLabels; i++) {
+					this->faceVertexID.setVertex(faceID, i, vertexBuildIDToLocalID[vertexLabels[i]]);
+				}
 
 				// Copy the center
 				this->faceCenter.push_back(center);
@@ -480,6 +747,227 @@ namespace cupcfd
 							  lambda, norm, vertexLabels, nVertexLabels, center, xpac, xnac, rlencos, area);
 			}
 
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdSoAMesh<I,T,L>::addFaces(
+						L * faceLabels,
+						L * cell1Labels,
+						L * cell2OrBoundaryLabels,
+						bool * isBoundary,
+						T * lambda,
+						cupcfd::geometry::euclidean::EuclideanVector3D<T> * norm,
+						I * vertexXAdj, L * vertexLabels,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3> * center,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3> * xpac,
+						cupcfd::geometry::euclidean::EuclideanPoint<T,3> * xnac,
+						T * rlencos,
+						T * area,
+						I nFaces) {
+				cupcfd::error::eCodes status;
+
+				// Can only add if not finalized
+				if(this->finalized == true) {
+					return cupcfd::error::E_FINALIZED;
+				}
+
+				if(nFaces <= 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Check the labels are not repeated (sorts a copy unless already sorted)
+				I nDistinct;
+				status = cupcfd::utility::drivers::distinctCount(faceLabels, nFaces, &nDistinct);
+				CHECK_ECODE(status)
+
+				if(nDistinct != nFaces) {
+					return cupcfd::error::E_MESH_EXISTING_FACE;
+				}
+
+				// Check the labels do not already exist
+				bool exists = false;
+
+				#pragma omp parallel for reduction(||:exists)
+				for(I i = 0; i < nFaces; i++) {
+					if(this->faceBuildIDToLocalID.find(faceLabels[i]) != this->faceBuildIDToLocalID.end()) {
+						exists = true;
+					}
+				}
+
+				if(exists) {
+					return cupcfd::error::E_MESH_EXISTING_FACE;
+				}
+
+				// Resolve the cell, boundary and vertex labels to local IDs in parallel.
+				// If any face is invalid, the error of the first (by position) is returned
+				// and the stores are restored to their previous size.
+				I offset = this->faceCell1ID.size();
+				this->faceCell1ID.resize(offset + nFaces);
+				this->faceCell2ID.resize(offset + nFaces);
+				this->faceBoundaryID.resize(offset + nFaces);
+				this->faceVertexID.append(vertexXAdj, nFaces);
+
+				I errorIdx = nFaces;
+				cupcfd::error::eCodes errorStatus = cupcfd::error::E_SUCCESS;
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < nFaces; i++) {
+					cupcfd::error::eCodes itemStatus = cupcfd::error::E_SUCCESS;
+					I cell1ID = I(-1);
+					I cell2ID = I(-1);
+					I boundaryID = I(-1);
+
+					auto cell1 = this->cellBuildIDToLocalID.find(cell1Labels[i]);
+					if(cell1 == this->cellBuildIDToLocalID.end()) {
+						itemStatus = cupcfd::error::E_MESH_INVALID_CELL_LABEL;
+					}
+					else {
+						cell1ID = cell1->second;
+					}
+
+					if(itemStatus == cupcfd::error::E_SUCCESS && isBoundary[i]) {
+						auto boundary = this->boundaryBuildIDToLocalID.find(cell2OrBoundaryLabels[i]);
+						if(boundary == this->boundaryBuildIDToLocalID.end()) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_BOUNDARY_LABEL;
+						}
+						else {
+							boundaryID = boundary->second;
+						}
+					}
+					else if(itemStatus == cupcfd::error::E_SUCCESS) {
+						auto cell2 = this->cellBuildIDToLocalID.find(cell2OrBoundaryLabels[i]);
+						if(cell2 == this->cellBuildIDToLocalID.end()) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_CELL_LABEL;
+						}
+						// We only accept faces between local->local, or local->ghost cells (unless the halo is deeper)
+						else if(this->properties.haloDepth <= 1 &&
+								this->cellConnGraph->existsGhostNode(cell1Labels[i]) &&
+								this->cellConnGraph->existsGhostNode(cell2OrBoundaryLabels[i])) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_FACE;
+						}
+						else {
+							cell2ID = cell2->second;
+						}
+					}
+
+					I nVertexLabels = vertexXAdj[i+1] - vertexXAdj[i];
+
+					if(itemStatus == cupcfd::error::E_SUCCESS && !CupCfdMeshFaceVertices<I>::isValidCount(nVertexLabels)) {
+						itemStatus = cupcfd::error::E_MESH_INVALID_VERTEX_COUNT;
+					}
+
+					for(I j = 0; j < nVertexLabels && itemStatus == cupcfd::error::E_SUCCESS; j++) {
+						auto find = this->vertexBuildIDToLocalID.find(vertexLabels[vertexXAdj[i] + j]);
+						if(find == this->vertexBuildIDToLocalID.end()) {
+							itemStatus = cupcfd::error::E_MESH_INVALID_VERTEX_LABEL;
+						}
+						else {
+							this->faceVertexID.setVertex(offset + i, j, find->second);
+						}
+					}
+
+					if(itemStatus != cupcfd::error::E_SUCCESS) {
+						#pragma omp critical(cupcfd_mesh_add_error)
+						{
+							if(i < errorIdx) {
+								errorIdx = i;
+								errorStatus = itemStatus;
+							}
+						}
+					}
+					else {
+						this->faceCell1ID[offset + i] = cell1ID;
+						this->faceCell2ID[offset + i] = cell2ID;
+						this->faceBoundaryID[offset + i] = boundaryID;
+					}
+				}
+
+				// Check no two faces are between the same pair of cells, either in this set (by sorting
+				// the cell pairs) or with a face added previously (by checking the connectivity graph)
+				if(errorStatus == cupcfd::error::E_SUCCESS) {
+					std::vector<std::pair<L,L>> cellPairs;
+					cellPairs.reserve(nFaces);
+
+					for(I i = 0; i < nFaces; i++) {
+						if(!isBoundary[i]) {
+							cellPairs.push_back(std::make_pair(std::min(cell1Labels[i], cell2OrBoundaryLabels[i]),
+															   std::max(cell1Labels[i], cell2OrBoundaryLabels[i])));
+						}
+					}
+
+					std::sort(cellPairs.begin(), cellPairs.end());
+
+					if(std::adjacent_find(cellPairs.begin(), cellPairs.end()) != cellPairs.end()) {
+						errorStatus = cupcfd::error::E_MESH_FACE_EDGE_EXISTS;
+					}
+
+					if(this->cellConnGraph->buildGraph.nEdges > 0) {
+						for(std::size_t i = 0; i < cellPairs.size() && errorStatus == cupcfd::error::E_SUCCESS; i++) {
+							bool found;
+							status = this->cellConnGraph->existsEdge(cellPairs[i].first, cellPairs[i].second, &found);
+							CHECK_ECODE(status)
+
+							if(found) {
+								errorStatus = cupcfd::error::E_MESH_FACE_EDGE_EXISTS;
+							}
+						}
+					}
+				}
+
+				if(errorStatus != cupcfd::error::E_SUCCESS) {
+					this->faceCell1ID.resize(offset);
+					this->faceCell2ID.resize(offset);
+					this->faceBoundaryID.resize(offset);
+					this->faceVertexID.truncate(offset);
+					return errorStatus;
+				}
+
+				// Copy the face properties
+				this->faceLambda.resize(offset + nFaces);
+				this->faceNorm.resize(offset + nFaces);
+				this->faceCenter.resize(offset + nFaces);
+				this->faceRLencos.resize(offset + nFaces);
+				this->faceArea.resize(offset + nFaces);
+				this->faceXpac.resize(offset + nFaces);
+				this->faceXnac.resize(offset + nFaces);
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < nFaces; i++) {
+					this->faceLambda[offset + i] = lambda[i];
+					this->faceNorm[offset + i] = norm[i];
+					this->faceCenter[offset + i] = center[i];
+					this->faceRLencos[offset + i] = (rlencos == nullptr) ? T(0) : rlencos[i];
+					this->faceArea[offset + i] = area[i];
+					this->faceXpac[offset + i] = (xpac == nullptr) ? cupcfd::geometry::euclidean::EuclideanPoint<T,3>(T(0), T(0), T(0)) : xpac[i];
+					this->faceXnac[offset + i] = (xnac == nullptr) ? cupcfd::geometry::euclidean::EuclideanPoint<T,3>(T(0), T(0), T(0)) : xnac[i];
+				}
+
+				// Store the local IDs for the build IDs, add the edges to the cell connectivity graph
+				// (using the Build Global IDs for the nodes), update the local face counts of the cells
+				// and point the referenced boundaries back at their faces
+				this->faceBuildIDToLocalID.reserve(this->faceBuildIDToLocalID.size() + nFaces);
+
+				for(I i = 0; i < nFaces; i++) {
+					I faceID = offset + i;
+					this->faceBuildIDToLocalID[faceLabels[i]] = faceID;
+
+					this->cellNFaces[this->faceCell1ID[faceID]] = this->cellNFaces[this->faceCell1ID[faceID]] + 1;
+
+					if(isBoundary[i]) {
+						this->setBoundaryFaceID(this->faceBoundaryID[faceID], faceID);
+					}
+					else {
+						status = this->cellConnGraph->addUndirectedEdge(cell1Labels[i], cell2OrBoundaryLabels[i]);
+						CHECK_ECODE(status)
+
+						this->cellNFaces[this->faceCell2ID[faceID]] = this->cellNFaces[this->faceCell2ID[faceID]] + 1;
+					}
+				}
+
+				// Update mesh properties
+				this->properties.lFaces = this->properties.lFaces + nFaces;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			// === Concrete Methods ===
 
 			template <class I, class T, class L>
@@ -536,6 +1024,7 @@ namespace cupcfd
 				this->cellNVertices.clear();
 				this->cellFaceMapCSRXAdj.resize(0);
 				this->cellFaceMapCSRAdj.resize(0);
+				this->cellFaceStride = 0;
 
 
 				// Reset Mesh Properties
@@ -552,6 +1041,8 @@ namespace cupcfd
 				// Reset in case it was in use
 				this->cellFaceMapCSRXAdj.clear();
 				this->cellFaceMapCSRAdj.clear();
+				this->cellFaceStride = 0;
+				this->properties.cellType = shapes::POLYHEDRON_UNKNOWN;
 
 				// Number of locally stored faces per cell already set in this->NFaces, updated in addCell.
 				// Use this value to rebuild the cell->face mappings
@@ -644,12 +1135,10 @@ namespace cupcfd
 					for(I j = 0; j < cellFaceCount; j++) {
 						I faceID = this->getCellFaceID(i, j);
 
-						for(I k = 0; k < 4; k++) {
-							I vertexID = this->getFaceVertex(faceID, k);
+						I faceNVertices = this->getFaceNVertices(faceID);
 
-							if(vertexID != -1) {
-								vertexIDs.push_back(vertexID);
-							}
+						for(I k = 0; k < faceNVertices; k++) {
+							vertexIDs.push_back(this->getFaceVertex(faceID, k));
 						}
 					}
 
@@ -680,16 +1169,18 @@ namespace cupcfd
 
 				// First, let us create useful data stores
 				// (a) A vector of valid Keys (Build Cell IDs)
-				std::vector<I> keys;
-				for(typename std::map<I,I>::iterator iter = this->cellBuildIDToLocalID.begin(); iter != this->cellBuildIDToLocalID.end(); iter++) {
+				std::vector<L> keys;
+				keys.reserve(this->cellBuildIDToLocalID.size());
+				for(typename cupcfd::data_structures::FlatHashMap<L,I>::iterator iter = this->cellBuildIDToLocalID.begin(); iter != this->cellBuildIDToLocalID.end(); iter++) {
 					keys.push_back(iter->first);
 				}
 
 
 				// (b) A mapping of the current local cell IDs in the map to their key
-				std::map<I,I> localToBuildID;
+				// The current local cell IDs are the insertion order, so are dense from 0
 				I iLimit;
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(keys.size());
+				std::vector<L> localToBuildID(iLimit);
 				for(I i = 0; i < iLimit; i++) {
 					I lID = this->cellBuildIDToLocalID[keys[i]];
 					localToBuildID[lID] = keys[i];
@@ -701,7 +1192,7 @@ namespace cupcfd
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(faceCell1ID.size());
 				for(I i = 0; i < iLimit; i++) {
 					// Update Cell 1 ID by mapping the current local back to the build ID, then to the local ID in the graph
-					I bID = localToBuildID[this->getFaceCell1ID(i)];
+					L bID = localToBuildID[this->getFaceCell1ID(i)];
 					I graphLocalID;
 					status = this->cellConnGraph->connGraph.getNodeLocalIndex(bID, &graphLocalID);
 					CHECK_ECODE(status)
@@ -759,7 +1250,7 @@ namespace cupcfd
 				// Update the source to shuffled order
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellNFaces.size());
 				for(I i = 0; i < iLimit; i++) {
-					I label = localToBuildID[i];
+					L label = localToBuildID[i];
 					I graphLocalID;
 					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphLocalID);
 					CHECK_ECODE(status)
@@ -777,7 +1268,7 @@ namespace cupcfd
 				// Update the source to shuffled order
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellNGFaces.size());
 				for(I i = 0; i < iLimit; i++) {
-					I label = localToBuildID[i];
+					L label = localToBuildID[i];
 					I graphLocalID;
 					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphLocalID);
 					CHECK_ECODE(status)
@@ -795,7 +1286,7 @@ namespace cupcfd
 				// Update the source to shuffled order
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellNGVertices.size());
 				for(I i = 0; i < iLimit; i++) {
-					I label = localToBuildID[i];
+					L label = localToBuildID[i];
 					I graphLocalID;
 					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphLocalID);
 					CHECK_ECODE(status)
@@ -813,7 +1304,7 @@ namespace cupcfd
 
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellNVertices.size());
 				for(I i = 0; i < iLimit; i++) {
-					I label = localToBuildID[i];
+					L label = localToBuildID[i];
 					I graphLocalID;
 					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphLocalID);
 					CHECK_ECODE(status)
@@ -828,7 +1319,7 @@ namespace cupcfd
 				// mesh local IDs (i.e. the graph local IDs)
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(cellBuildIDToLocalID.size());
 				for(I i = 0; i < iLimit; i++) {
-					I label = localToBuildID[i];
+					L label = localToBuildID[i];
 					I graphCellID;
 					status = this->cellConnGraph->connGraph.getNodeLocalIndex(label, &graphCellID);
 					CHECK_ECODE(status)
@@ -838,6 +1329,32 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			template <class I, class T, class L>
+			void CupCfdSoAMesh<I,T,L>::packCellFaceMap() {
+				I stride = (I) shapes::getPolyhedronNFaces(this->properties.cellType);
+
+				// Mixed cell types keep the CSR mapping
+				if((stride == 0) || (this->cellFaceStride > 0)) {
+					return;
+				}
+
+				I nCells = cupcfd::utility::drivers::safeConvertSizeT<I>(this->cellFaceMapCSRXAdj.size()) - 1;
+				cupcfd::data_structures::AlignedVector<I> cellFaceMap(nCells * stride, I(-1));
+
+				for(I i = 0; i < nCells; i++) {
+					I rangeStart = this->cellFaceMapCSRXAdj[i];
+					I rangeSize = this->cellFaceMapCSRXAdj[i+1] - this->cellFaceMapCSRXAdj[i];
+
+					for(I j = 0; j < rangeSize; j++) {
+						cellFaceMap[(i * stride) + j] = this->cellFaceMapCSRAdj[rangeStart + j];
+					}
+				}
+
+				this->cellFaceMapCSRAdj.swap(cellFaceMap);
+				this->cellFaceMapCSRXAdj.clear();
+				this->cellFaceStride = stride;
+			}
+
 			template <class I, class T, class L>
 			cupcfd::error::eCodes CupCfdSoAMesh<I,T,L>::finalize() {
 				cupcfd::error::eCodes status;
@@ -881,6 +1398,22 @@ namespace cupcfd
 				status = this->exchangeCellGlobalNFaces();
 				CHECK_ECODE(status)
 
+				// If every cell has the same type, store the cell->face mapping with a fixed stride
+				this->detectCellType();
+				this->packCellFaceMap();
+
+				// Derive the face geometry from the vertices and cell centres
+				status = this->computeFaceGeometry();
+				CHECK_ECODE(status)
+
+				// Colour the cells and faces now their local indexes are fixed
+				status = this->buildColourings(false);
+				CHECK_ECODE(status)
+
+				// Release the spare capacity left by the adds, so that each store is a single exactly
+				// sized allocation with its pages placed by the threads that will use them
+				this->shrinkStores();
+
 				// Update status
 				this->finalized = true;
 
@@ -976,9 +1509,413 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			template <class I, class T, class L>
+			void CupCfdSoAMesh<I,T,L>::shrinkStores() {
+				// Boundary Data
+				this->boundaryFaceID.shrink_to_fit();
+				this->boundaryDistance.shrink_to_fit();
+				this->boundaryYPlus.shrink_to_fit();
+				this->boundaryUPlus.shrink_to_fit();
+				this->boundaryRegionID.shrink_to_fit();
+				this->boundaryShear.shrink_to_fit();
+				this->boundaryQ.shrink_to_fit();
+				this->boundaryH.shrink_to_fit();
+				this->boundaryT.shrink_to_fit();
+				this->boundaryVertexID.shrinkToFit();
+
+				// Cell Data
+				this->cellCenter.shrink_to_fit();
+				this->cellVolume.shrink_to_fit();
+				this->cellNGFaces.shrink_to_fit();
+				this->cellNFaces.shrink_to_fit();
+				this->cellNGVertices.shrink_to_fit();
+				this->cellNVertices.shrink_to_fit();
+				this->cellFaceMapCSRXAdj.shrink_to_fit();
+				this->cellFaceMapCSRAdj.shrink_to_fit();
+
+				// Face Data
+				this->faceCell1ID.shrink_to_fit();
+				this->faceCell2ID.shrink_to_fit();
+				this->faceLambda.shrink_to_fit();
+				this->faceNorm.shrink_to_fit();
+				this->faceCenter.shrink_to_fit();
+				this->faceRLencos.shrink_to_fit();
+				this->faceArea.shrink_to_fit();
+				this->faceXpac.shrink_to_fit();
+				this->faceXnac.shrink_to_fit();
+				this->faceBoundaryID.shrink_to_fit();
+				this->faceVertexID.shrinkToFit();
+
+				// Vertex Data
+				this->verticesPos.shrink_to_fit();
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdSoAMesh<I,T,L>::getPagePlacement(std::vector<std::size_t>& nodePages, std::size_t * nUnplaced) {
+				cupcfd::error::eCodes status;
+
+				// Boundary Data
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryFaceID, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryDistance, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryYPlus, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryUPlus, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryRegionID, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryShear, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryQ, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryH, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->boundaryT, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = this->boundaryVertexID.getPagePlacement(nodePages, nUnplaced);
+				CHECK_ECODE(status)
+
+				// Cell Data
+				status = cupcfd::utility::drivers::getPageNodes(this->cellCenter, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellVolume, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellNGFaces, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellNFaces, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellNGVertices, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellNVertices, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellFaceMapCSRXAdj, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->cellFaceMapCSRAdj, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+
+				// Face Data
+				status = cupcfd::utility::drivers::getPageNodes(this->faceCell1ID, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->faceCell2ID, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->faceLambda, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->faceNorm, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->faceCenter, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->faceRLencos, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->faceArea, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->faceXpac, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->faceXnac, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = cupcfd::utility::drivers::getPageNodes(this->faceBoundaryID, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				status = this->faceVertexID.getPagePlacement(nodePages, nUnplaced);
+				CHECK_ECODE(status)
+
+				// Vertex Data
+				status = cupcfd::utility::drivers::getPageNodes(this->verticesPos, nodePages, nUnplaced);
+				CHECK_ECODE(status)
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			std::size_t CupCfdSoAMesh<I,T,L>::getBuildMapMemoryBytes() const {
+				return this->vertexBuildIDToLocalID.getMemoryBytes()
+					 + this->boundaryBuildIDToLocalID.getMemoryBytes()
+					 + this->regionBuildIDToLocalID.getMemoryBytes()
+					 + this->cellBuildIDToLocalID.getMemoryBytes()
+					 + this->faceBuildIDToLocalID.getMemoryBytes();
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdSoAMesh<I,T,L>::writeSnapshotData(cupcfd::io::SnapshotFile& file) {
+				cupcfd::error::eCodes status;
+
+				// std::vector<bool> is packed, so store the region flags as one byte per entry
+				I nRegions = cupcfd::utility::drivers::safeConvertSizeT<I>(this->regionType.size());
+				std::vector<unsigned char> regionFlags(3 * nRegions);
+
+				for(I i = 0; i < nRegions; i++) {
+					regionFlags[3 * i] = (unsigned char) this->regionStd[i];
+					regionFlags[(3 * i) + 1] = (unsigned char) this->regionFlux[i];
+					regionFlags[(3 * i) + 2] = (unsigned char) this->regionAdiab[i];
+				}
+
+				// Boundary Data
+				status = file.writeVector(this->boundaryFaceID);
+				CHECK_ECODE(status)
+				status = this->boundaryVertexID.writeSnapshot(file);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryDistance);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryYPlus);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryUPlus);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryRegionID);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryShear);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryQ);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryH);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->boundaryT);
+				CHECK_ECODE(status)
+
+				// Cell Data
+				status = file.writeVector(this->cellCenter);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellVolume);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellNGFaces);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellNFaces);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellNGVertices);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellNVertices);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellFaceMapCSRXAdj);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->cellFaceMapCSRAdj);
+				CHECK_ECODE(status)
+
+				// Face Data
+				status = file.writeVector(this->faceCell1ID);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->faceCell2ID);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->faceLambda);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->faceNorm);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->faceCenter);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->faceRLencos);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->faceArea);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->faceXpac);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->faceXnac);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->faceBoundaryID);
+				CHECK_ECODE(status)
+				status = this->faceVertexID.writeSnapshot(file);
+				CHECK_ECODE(status)
+
+				// Region Data
+				status = file.writeVector(this->regionType);
+				CHECK_ECODE(status)
+				status = file.writeVector(regionFlags);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionYLog);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionELog);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionDensity);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionTurbKE);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionTurbDiss);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionSplvl);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionDen);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionForceTangent);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionUVW);
+				CHECK_ECODE(status)
+				status = file.writeStrings(this->regionName);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionR);
+				CHECK_ECODE(status)
+				status = file.writeVector(this->regionT);
+				CHECK_ECODE(status)
+
+				// Vertex Data
+				status = file.writeVector(this->verticesPos);
+				CHECK_ECODE(status)
+
+				// Build ID Lookups
+				status = file.writeMap(this->vertexBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.writeMap(this->boundaryBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.writeMap(this->regionBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.writeMap(this->cellBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.writeMap(this->faceBuildIDToLocalID);
+				CHECK_ECODE(status)
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdSoAMesh<I,T,L>::readSnapshotData(cupcfd::io::SnapshotFile& file) {
+				cupcfd::error::eCodes status;
+
+				std::vector<unsigned char> regionFlags;
+
+				// Boundary Data
+				status = file.readVector(this->boundaryFaceID);
+				CHECK_ECODE(status)
+				status = this->boundaryVertexID.readSnapshot(file);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryDistance);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryYPlus);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryUPlus);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryRegionID);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryShear);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryQ);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryH);
+				CHECK_ECODE(status)
+				status = file.readVector(this->boundaryT);
+				CHECK_ECODE(status)
+
+				// Cell Data
+				status = file.readVector(this->cellCenter);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellVolume);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellNGFaces);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellNFaces);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellNGVertices);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellNVertices);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellFaceMapCSRXAdj);
+				CHECK_ECODE(status)
+				status = file.readVector(this->cellFaceMapCSRAdj);
+				CHECK_ECODE(status)
+
+				// Face Data
+				status = file.readVector(this->faceCell1ID);
+				CHECK_ECODE(status)
+				status = file.readVector(this->faceCell2ID);
+				CHECK_ECODE(status)
+				status = file.readVector(this->faceLambda);
+				CHECK_ECODE(status)
+				status = file.readVector(this->faceNorm);
+				CHECK_ECODE(status)
+				status = file.readVector(this->faceCenter);
+				CHECK_ECODE(status)
+				status = file.readVector(this->faceRLencos);
+				CHECK_ECODE(status)
+				status = file.readVector(this->faceArea);
+				CHECK_ECODE(status)
+				status = file.readVector(this->faceXpac);
+				CHECK_ECODE(status)
+				status = file.readVector(this->faceXnac);
+				CHECK_ECODE(status)
+				status = file.readVector(this->faceBoundaryID);
+				CHECK_ECODE(status)
+				status = this->faceVertexID.readSnapshot(file);
+				CHECK_ECODE(status)
+
+				// Region Data
+				status = file.readVector(this->regionType);
+				CHECK_ECODE(status)
+				status = file.readVector(regionFlags);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionYLog);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionELog);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionDensity);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionTurbKE);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionTurbDiss);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionSplvl);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionDen);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionForceTangent);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionUVW);
+				CHECK_ECODE(status)
+				status = file.readStrings(this->regionName);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionR);
+				CHECK_ECODE(status)
+				status = file.readVector(this->regionT);
+				CHECK_ECODE(status)
+
+				// Vertex Data
+				status = file.readVector(this->verticesPos);
+				CHECK_ECODE(status)
+
+				// Build ID Lookups
+				status = file.readMap(this->vertexBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.readMap(this->boundaryBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.readMap(this->regionBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.readMap(this->cellBuildIDToLocalID);
+				CHECK_ECODE(status)
+				status = file.readMap(this->faceBuildIDToLocalID);
+				CHECK_ECODE(status)
+
+				// Check the stores are consistent with the mesh properties read by the interface
+				// A mesh of a single fixed cell type stores the cell->face mapping with a fixed stride
+				I stride = (I) shapes::getPolyhedronNFaces(this->properties.cellType);
+				std::size_t nRegions = this->regionType.size();
+
+				if((this->cellCenter.size() != (std::size_t) this->properties.lTCells) ||
+				   ((stride == 0) && (this->cellFaceMapCSRXAdj.size() != (std::size_t) this->properties.lTCells + 1)) ||
+				   ((stride > 0) && (this->cellFaceMapCSRAdj.size() != (std::size_t) (this->properties.lTCells * stride))) ||
+				   (this->faceCell1ID.size() != (std::size_t) this->properties.lFaces) ||
+				   (this->faceVertexID.size() != this->properties.lFaces) ||
+				   (this->boundaryFaceID.size() != (std::size_t) this->properties.lBoundaries) ||
+				   (this->boundaryVertexID.size() != this->properties.lBoundaries) ||
+				   (this->verticesPos.size() != (std::size_t) this->properties.lVertices) ||
+				   (nRegions != (std::size_t) this->properties.lRegions) ||
+				   (regionFlags.size() != 3 * nRegions)) {
+					this->reset();
+					return cupcfd::error::E_INVALID_FILE_FORMAT;
+				}
+
+				this->cellFaceStride = stride;
+
+				this->regionStd.resize(nRegions);
+				this->regionFlux.resize(nRegions);
+				this->regionAdiab.resize(nRegions);
+
+				for(std::size_t i = 0; i < nRegions; i++) {
+					this->regionStd[i] = (regionFlags[3 * i] != 0);
+					this->regionFlux[i] = (regionFlags[(3 * i) + 1] != 0);
+					this->regionAdiab[i] = (regionFlags[(3 * i) + 2] != 0);
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			// Explicit Instantiation
 			template class CupCfdSoAMesh<int, float, int>;
 			template class CupCfdSoAMesh<int, double, int>;
+
+			template class CupCfdSoAMesh<int, float, long>;
+			template class CupCfdSoAMesh<int, double, long>;
 		}
 	}
 }
@@ -32,8 +32,12 @@ namespace cupcfd
 			// === Constructors/Deconstructors ===
 
 			template <class I, class T, class L>
-			MeshConfig<I,T,L>::MeshConfig(cupcfd::partitioner::PartitionerConfig<I,I>& partConfig,
+			MeshConfig<I,T,L>::MeshConfig(cupcfd::partitioner::PartitionerConfig<I,L>& partConfig,
 										MeshSourceConfig<I,T,L>& meshSourceConfig)
+			:buildChunkSize(0),
+			 haloDepth(1),
+			 refinementLevels(0),
+			 snapshotPath("")
 			{
 				// Clone so we maintain the polymorphic type
 				this->partConfig = partConfig.clone();
@@ -43,7 +47,11 @@ namespace cupcfd
 			template <class I, class T, class L>
 			MeshConfig<I,T,L>::MeshConfig(MeshConfig<I,T,L>& source)
 			:partConfig(nullptr),
-			 meshSourceConfig(nullptr)
+			 meshSourceConfig(nullptr),
+			 buildChunkSize(0),
+			 haloDepth(1),
+			 refinementLevels(0),
+			 snapshotPath("")
 			{
 				*this = source;
 			}
@@ -67,3 +75,6 @@ namespace cupcfd
 // Explicit Instantiation
 template class cupcfd::geometry::mesh::MeshConfig<int, float, int>;
 template class cupcfd::geometry::mesh::MeshConfig<int, double, int>;
+
+template class cupcfd::geometry::mesh::MeshConfig<int, float, long>;
+template class cupcfd::geometry::mesh::MeshConfig<int, double, long>;
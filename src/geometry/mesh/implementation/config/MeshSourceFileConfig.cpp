@@ -18,32 +18,32 @@ namespace cupcfd
 	{
 		namespace mesh
 		{
-			template <class I, class T>
-			MeshSourceFileConfig<I,T>::MeshSourceFileConfig(MeshFileFormat fileFormat, std::string sourceFilePath)
-			: MeshSourceConfig<I,T,I>(),
+			template <class I, class T, class L>
+			MeshSourceFileConfig<I,T,L>::MeshSourceFileConfig(MeshFileFormat fileFormat, std::string sourceFilePath)
+			: MeshSourceConfig<I,T,L>(),
 			  fileFormat(fileFormat),
 			  sourceFilePath(sourceFilePath)
 			{
 				// Nothing else to do
 			}
 
-			template <class I, class T>
-			MeshSourceFileConfig<I,T>::MeshSourceFileConfig(MeshSourceFileConfig<I,T>& source)
-			: MeshSourceConfig<I,T,I>()
+			template <class I, class T, class L>
+			MeshSourceFileConfig<I,T,L>::MeshSourceFileConfig(MeshSourceFileConfig<I,T,L>& source)
+			: MeshSourceConfig<I,T,L>()
 			{
 				// Constructor required a value above, but it will get overwritten again shortly with
 				// same value.
 				*this = source;
 			}
 
-			template <class I, class T>
-			MeshSourceFileConfig<I,T>::~MeshSourceFileConfig()
+			template <class I, class T, class L>
+			MeshSourceFileConfig<I,T,L>::~MeshSourceFileConfig()
 			{
 				// Nothing to clear in derived components.
 			}
 
-			template <class I, class T>
-			MeshSourceFileConfig<I,T> * MeshSourceFileConfig<I,T>::clone()
+			template <class I, class T, class L>
+			MeshSourceFileConfig<I,T,L> * MeshSourceFileConfig<I,T,L>::clone()
 			{
 				return new MeshSourceFileConfig(*this);
 			}
@@ -52,5 +52,8 @@ namespace cupcfd
 }
 
 // Explicit Instantiation
-template class cupcfd::geometry::mesh::MeshSourceFileConfig<int, float>;
-template class cupcfd::geometry::mesh::MeshSourceFileConfig<int, double>;
+template class cupcfd::geometry::mesh::MeshSourceFileConfig<int, float, int>;
+template class cupcfd::geometry::mesh::MeshSourceFileConfig<int, double, int>;
+
+template class cupcfd::geometry::mesh::MeshSourceFileConfig<int, float, long>;
+template class cupcfd::geometry::mesh::MeshSourceFileConfig<int, double, long>;
@@ -0,0 +1,65 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Implementation of the MeshSourceMixedGenConfig class
+ */
+
+#include "MeshSourceMixedGenConfig.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I, class T, class L>
+			MeshSourceMixedGenConfig<I,T,L>::MeshSourceMixedGenConfig(I cellX, I cellY, I cellZ,
+														  	  	  	  T sMinX, T sMaxX, T sMinY, T sMaxY, T sMinZ, T sMaxZ,
+														  	  	  	  T tetFraction, T prismFraction, T jitter, bool shuffleCellLabels, uint64_t seed)
+			: MeshSourceConfig<I,T,L>(),
+			  cellX(cellX), cellY(cellY), cellZ(cellZ),
+			  sMinX(sMinX), sMaxX(sMaxX),
+			  sMinY(sMinY), sMaxY(sMaxY),
+			  sMinZ(sMinZ), sMaxZ(sMaxZ),
+			  tetFraction(tetFraction), prismFraction(prismFraction), jitter(jitter),
+			  shuffleCellLabels(shuffleCellLabels), seed(seed)
+			{
+				// Nothing else to do beyond member instantiation list
+			}
+
+			template <class I, class T, class L>
+			MeshSourceMixedGenConfig<I,T,L>::MeshSourceMixedGenConfig(MeshSourceMixedGenConfig<I,T,L>& source)
+			: MeshSourceConfig<I,T,L>()
+			{
+				// Will end up setting partConfig twice but shouldn't be too significant.
+				*this = source;
+			}
+
+			template <class I, class T, class L>
+			MeshSourceMixedGenConfig<I,T,L>::~MeshSourceMixedGenConfig()
+			{
+				// Nothing to do in derived
+			}
+
+
+			template <class I, class T, class L>
+			MeshSourceMixedGenConfig<I,T,L> * MeshSourceMixedGenConfig<I,T,L>::clone()
+			{
+				return new MeshSourceMixedGenConfig<I,T,L>(*this);
+			}
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::geometry::mesh::MeshSourceMixedGenConfig<int, float, int>;
+template class cupcfd::geometry::mesh::MeshSourceMixedGenConfig<int, double, int>;
+
+template class cupcfd::geometry::mesh::MeshSourceMixedGenConfig<int, float, long>;
+template class cupcfd::geometry::mesh::MeshSourceMixedGenConfig<int, double, long>;
@@ -18,10 +18,10 @@ namespace cupcfd
 	{
 		namespace mesh
 		{
-			template <class I, class T>
-			MeshSourceStructGenConfig<I,T>::MeshSourceStructGenConfig(I cellX, I cellY, I cellZ,
+			template <class I, class T, class L>
+			MeshSourceStructGenConfig<I,T,L>::MeshSourceStructGenConfig(I cellX, I cellY, I cellZ,
 														  	  	  	  T sMinX, T sMaxX, T sMinY, T sMaxY, T sMinZ, T sMaxZ)
-			: MeshSourceConfig<I,T,I>(),
+			: MeshSourceConfig<I,T,L>(),
 			  cellX(cellX), cellY(cellY), cellZ(cellZ),
 			  sMinX(sMinX), sMaxX(sMaxX),
 			  sMinY(sMinY), sMaxY(sMaxY),
@@ -30,30 +30,33 @@ namespace cupcfd
 				// Nothing else to do beyond member instantiation list
 			}
 
-			template <class I, class T>
-			MeshSourceStructGenConfig<I,T>::MeshSourceStructGenConfig(MeshSourceStructGenConfig<I,T>& source)
-			: MeshSourceConfig<I,T,I>()
+			template <class I, class T, class L>
+			MeshSourceStructGenConfig<I,T,L>::MeshSourceStructGenConfig(MeshSourceStructGenConfig<I,T,L>& source)
+			: MeshSourceConfig<I,T,L>()
 			{
 				// Will end up setting partConfig twice but shouldn't be too significant.
 				*this = source;
 			}
 
-			template <class I, class T>
-			MeshSourceStructGenConfig<I,T>::~MeshSourceStructGenConfig()
+			template <class I, class T, class L>
+			MeshSourceStructGenConfig<I,T,L>::~MeshSourceStructGenConfig()
 			{
 				// Nothing to do in derived
 			}
 
 
-			template <class I, class T>
-			MeshSourceStructGenConfig<I,T> * MeshSourceStructGenConfig<I,T>::clone()
+			template <class I, class T, class L>
+			MeshSourceStructGenConfig<I,T,L> * MeshSourceStructGenConfig<I,T,L>::clone()
 			{
-				return new MeshSourceStructGenConfig<I,T>(*this);
+				return new MeshSourceStructGenConfig<I,T,L>(*this);
 			}
 		}
 	}
 }
 
 // Explicit Instantiation
-template class cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, float>;
-template class cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double>;
+template class cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, float, int>;
+template class cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int>;
+
+template class cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, float, long>;
+template class cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, long>;
@@ -16,6 +16,7 @@
 #include "PartitionerParmetisConfigSourceJSON.h"
 #include "MeshSourceFileConfigJSON.h"
 #include "MeshSourceStructGenConfigJSON.h"
+#include "MeshSourceMixedGenConfigJSON.h"
 
 #include <fstream>
 
@@ -69,7 +70,7 @@ namespace cupcfd
 			}
 
 			template <class I, class T, class L>
-			cupcfd::error::eCodes MeshConfigSourceJSON<I,T,L>::getPartitionerConfig(cupcfd::partitioner::PartitionerConfig<I,I> ** partConfig) {
+			cupcfd::error::eCodes MeshConfigSourceJSON<I,T,L>::getPartitionerConfig(cupcfd::partitioner::PartitionerConfig<I,L> ** partConfig) {
 				cupcfd::error::eCodes status;
 
 				// Determine and build the correct polymorphic PartitionerConfig Type
@@ -81,21 +82,21 @@ namespace cupcfd
 					Json::Value partConfigData = this->configData;
 
 					if(partConfigData["Partitioner"].isMember("NaivePartitioner")) {
-						cupcfd::partitioner::PartitionerNaiveConfigSourceJSON<I,I> naiveConfigSource(partConfigData["Partitioner"]["NaivePartitioner"]);
+						cupcfd::partitioner::PartitionerNaiveConfigSourceJSON<I,L> naiveConfigSource(partConfigData["Partitioner"]["NaivePartitioner"]);
 						status = naiveConfigSource.buildPartitionerConfig(partConfig);
 
 						// Return error or success depending on whether the object was built (e.g. missing options causes failure)
 						return status;
 					}
 					else if(partConfigData["Partitioner"].isMember("MetisPartitioner")) {
-						cupcfd::partitioner::PartitionerMetisConfigSourceJSON<I,I> metisConfigSource(partConfigData["Partitioner"]["MetisPartitioner"]);
+						cupcfd::partitioner::PartitionerMetisConfigSourceJSON<I,L> metisConfigSource(partConfigData["Partitioner"]["MetisPartitioner"]);
 						status = metisConfigSource.buildPartitionerConfig(partConfig);
 
 						// Return error or success depending on whether the object was built (e.g. missing options causes failure)
 						return status;
 					}
 					else if(partConfigData["Partitioner"].isMember("ParmetisPartitioner")) {
-						cupcfd::partitioner::PartitionerParmetisConfigSourceJSON<I,I> parmetisConfigSource(partConfigData["Partitioner"]["ParmetisPartitioner"]);
+						cupcfd::partitioner::PartitionerParmetisConfigSourceJSON<I,L> parmetisConfigSource(partConfigData["Partitioner"]["ParmetisPartitioner"]);
 						status = parmetisConfigSource.buildPartitionerConfig(partConfig);
 
 						// Return error or success depending on whether the object was built (e.g. missing options causes failure)
@@ -122,8 +123,9 @@ namespace cupcfd
 				std::vector<std::string> meshSourceTopLevels = this->topLevel;
 				meshSourceTopLevels.push_back("MeshSource");
 
-				MeshSourceFileConfigJSON<I,T> source1Config(this->configFilePath, &(meshSourceTopLevels[0]), meshSourceTopLevels.size());
-				MeshSourceStructGenConfigJSON<I,T> source2Config(this->configFilePath, &(meshSourceTopLevels[0]), meshSourceTopLevels.size());
+				MeshSourceFileConfigJSON<I,T,L> source1Config(this->configFilePath, &(meshSourceTopLevels[0]), meshSourceTopLevels.size());
+				MeshSourceStructGenConfigJSON<I,T,L> source2Config(this->configFilePath, &(meshSourceTopLevels[0]), meshSourceTopLevels.size());
+				MeshSourceMixedGenConfigJSON<I,T,L> source3Config(this->configFilePath, &(meshSourceTopLevels[0]), meshSourceTopLevels.size());
 
 				// MeshSourceConfig<I,T,L> * sourceConfig;
 
@@ -143,9 +145,20 @@ namespace cupcfd
 				// Test Mesh Source from Structured Generation
 				// status = source2Config.buildMeshSourceConfig(&sourceConfig);
 				status = source2Config.buildMeshSourceConfig(config);
+				if (status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					// This error is ok, try source3Config instead
+				} else {
+					CHECK_ECODE(status);
+					if(status == cupcfd::error::E_SUCCESS) {
+						// return sourceConfig;
+						return cupcfd::error::E_SUCCESS;
+					}
+				}
+
+				// Test Mesh Source from Mixed Element Generation
+				status = source3Config.buildMeshSourceConfig(config);
 				CHECK_ECODE(status);
 				if(status == cupcfd::error::E_SUCCESS) {
-					// return sourceConfig;
 					return cupcfd::error::E_SUCCESS;
 				}
 
@@ -154,12 +167,88 @@ namespace cupcfd
 				throw std::runtime_error("MeshConfigSourceJSON<I,T,L>::getMeshSourceConfig() hit edge case");
 			}
 
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshConfigSourceJSON<I,T,L>::getBuildChunkSize(I * buildChunkSize) {
+				if(this->configData.isMember("BuildChunkSize")) {
+					const Json::Value dataSourceType = this->configData["BuildChunkSize"];
+
+					if(dataSourceType == Json::Value::null) {
+						return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+					}
+
+					if(dataSourceType.asInt() < 0) {
+						return cupcfd::error::E_CONFIG_INVALID_VALUE;
+					}
+
+					*buildChunkSize = I(dataSourceType.asInt());
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshConfigSourceJSON<I,T,L>::getHaloDepth(I * haloDepth) {
+				if(this->configData.isMember("HaloDepth")) {
+					const Json::Value dataSourceType = this->configData["HaloDepth"];
+
+					if(dataSourceType == Json::Value::null) {
+						return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+					}
+
+					if(dataSourceType.asInt() < 1) {
+						return cupcfd::error::E_CONFIG_INVALID_VALUE;
+					}
+
+					*haloDepth = I(dataSourceType.asInt());
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshConfigSourceJSON<I,T,L>::getRefinementLevels(I * refinementLevels) {
+				if(this->configData.isMember("RefinementLevels")) {
+					const Json::Value dataSourceType = this->configData["RefinementLevels"];
+
+					if(dataSourceType == Json::Value::null) {
+						return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+					}
+
+					if(dataSourceType.asInt() < 0) {
+						return cupcfd::error::E_CONFIG_INVALID_VALUE;
+					}
+
+					*refinementLevels = I(dataSourceType.asInt());
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshConfigSourceJSON<I,T,L>::getSnapshotPath(std::string * snapshotPath) {
+				if(this->configData.isMember("SnapshotPath")) {
+					const Json::Value dataSourceType = this->configData["SnapshotPath"];
+
+					if(dataSourceType == Json::Value::null) {
+						return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+					}
+
+					*snapshotPath = dataSourceType.asString();
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+			}
+
 			template <class I, class T, class L>
 			cupcfd::error::eCodes MeshConfigSourceJSON<I,T,L>::buildMeshConfig(MeshConfig<I,T,L> ** config) {
 				cupcfd::error::eCodes status;
 
 				// Get the partitioner config
-				cupcfd::partitioner::PartitionerConfig<I,I> * partConfig;
+				cupcfd::partitioner::PartitionerConfig<I,L> * partConfig;
 
 				status = this->getPartitionerConfig(&partConfig);
 				CHECK_ECODE(status)
@@ -169,7 +258,39 @@ namespace cupcfd
 				status = this->getMeshSourceConfig(&sourceConfig);
 				CHECK_ECODE(status)
 
+				// The build chunk size is optional - the data is read in a single batch if it is not set
+				I buildChunkSize = 0;
+				status = this->getBuildChunkSize(&buildChunkSize);
+				if(status != cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					CHECK_ECODE(status)
+				}
+
+				// The halo depth is optional - a single layer of ghost cells is built if it is not set
+				I haloDepth = 1;
+				status = this->getHaloDepth(&haloDepth);
+				if(status != cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					CHECK_ECODE(status)
+				}
+
+				// Refinement is optional - the mesh is used as built if it is not set
+				I refinementLevels = 0;
+				status = this->getRefinementLevels(&refinementLevels);
+				if(status != cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					CHECK_ECODE(status)
+				}
+
+				// Snapshots are optional - the mesh is always built if no directory is set
+				std::string snapshotPath = "";
+				status = this->getSnapshotPath(&snapshotPath);
+				if(status != cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					CHECK_ECODE(status)
+				}
+
 				*config = new MeshConfig<I,T,L>(*partConfig, *sourceConfig);
+				(*config)->setBuildChunkSize(buildChunkSize);
+				(*config)->setHaloDepth(haloDepth);
+				(*config)->setRefinementLevels(refinementLevels);
+				(*config)->setSnapshotPath(snapshotPath);
 
 				delete partConfig;
 				delete sourceConfig;
@@ -183,3 +304,6 @@ namespace cupcfd
 // Explicit Instantiation
 template class cupcfd::geometry::mesh::MeshConfigSourceJSON<int, float, int>;
 template class cupcfd::geometry::mesh::MeshConfigSourceJSON<int, double, int>;
+
+template class cupcfd::geometry::mesh::MeshConfigSourceJSON<int, float, long>;
+template class cupcfd::geometry::mesh::MeshConfigSourceJSON<int, double, long>;
@@ -38,21 +38,21 @@ namespace cupcfd
 	{
 		namespace mesh
 		{
-			template <class I, class T>
-			MeshHDF5Source<I,T>::MeshHDF5Source(std::string filePath)
-			: MeshSource<I,T,I>()
+			template <class I, class T, class L>
+			MeshHDF5Source<I,T,L>::MeshHDF5Source(std::string filePath)
+			: MeshSource<I,T,L>()
 			{
 				this->fileName = filePath;
 				this->gidBase = 1;
 			}
 
-			template <class I, class T>
-			MeshHDF5Source<I,T>::~MeshHDF5Source()
+			template <class I, class T, class L>
+			MeshHDF5Source<I,T,L>::~MeshHDF5Source()
 			{
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getAttribute(std::string attrName, int * out) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getAttribute(std::string attrName, int * out) {
 				cupcfd::error::eCodes status;
 
 				// This format stores its attributes at the root level
@@ -63,8 +63,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getAttribute(std::string attrName, float * out) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getAttribute(std::string attrName, long * out) {
 				cupcfd::error::eCodes status;
 
 				// This format stores its attributes at the root level
@@ -75,8 +75,20 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getAttribute(std::string attrName, double * out) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getAttribute(std::string attrName, float * out) {
+				cupcfd::error::eCodes status;
+
+				// This format stores its attributes at the root level
+				cupcfd::io::hdf5::HDF5Record record("/",attrName,true);
+				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				status = access.readData(out);
+				CHECK_ECODE(status)
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getAttribute(std::string attrName, double * out) {
 				cupcfd::error::eCodes status;
 
 				// This format stores its attributes at the root level
@@ -89,8 +101,8 @@ namespace cupcfd
 
 			// === Inherited Overloaded Methods ===
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getCellLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getCellLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
 				if (nLabels != nIndexes) {
 					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
 				}
@@ -103,8 +115,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getFaceLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getFaceLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
 				if (nLabels != nIndexes) {
 					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
 				}
@@ -117,8 +129,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getVertexLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getVertexLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
 				if (nLabels != nIndexes) {
 					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
 				}
@@ -131,8 +143,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getBoundaryLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getBoundaryLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
 				if (nLabels != nIndexes) {
 					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
 				}
@@ -145,8 +157,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getRegionLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getRegionLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
 				if (nLabels != nIndexes) {
 					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
 				}
@@ -159,63 +171,63 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getCellCount(I * cellCount) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getCellCount(L * cellCount) {
 				cupcfd::error::eCodes status;
 				status = this->getAttribute("ncel", cellCount);
 				CHECK_ECODE(status)
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getFaceCount(I * faceCount) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getFaceCount(L * faceCount) {
 				cupcfd::error::eCodes status;
 				status = this->getAttribute("nfac", faceCount);
 				CHECK_ECODE(status)
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getBoundaryCount(I * boundaryCount) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getBoundaryCount(L * boundaryCount) {
 				cupcfd::error::eCodes status;
 				status = this->getAttribute("nbnd", boundaryCount);
 				CHECK_ECODE(status)
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getRegionCount(I * regionCount) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getRegionCount(I * regionCount) {
 				cupcfd::error::eCodes status;
 				status = this->getAttribute("nreg", regionCount);
 				CHECK_ECODE(status)
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getVertexCount(I * vertexCount) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getVertexCount(L * vertexCount) {
 				cupcfd::error::eCodes status;
 				status = this->getAttribute("nvrt", vertexCount);
 				CHECK_ECODE(status)
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getMaxFaceCount(I * maxFaceCount) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getMaxFaceCount(I * maxFaceCount) {
 				cupcfd::error::eCodes status;
 				status = this->getAttribute("maxfaces", maxFaceCount);
 				CHECK_ECODE(status)
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getMaxVertexCount(I * maxVertexCount) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getMaxVertexCount(I * maxVertexCount) {
 				// Max vertex count per cell/boundary currently always hardcoded at 4
 				*maxVertexCount = 4;
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getCellNFaces(I * nFaces, I nNFaces, I * cellLabels, I nCellLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getCellNFaces(I * nFaces, I nNFaces, L * cellLabels, I nCellLabels) {
 				cupcfd::error::eCodes status;
 				
 				// Size Check
@@ -243,8 +255,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getCellVolume(T * cellVol, I nCellVol, I * cellLabels, I nCellLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getCellVolume(T * cellVol, I nCellVol, L * cellLabels, I nCellLabels) {
 				cupcfd::error::eCodes status;
 
 				// Size Check
@@ -269,8 +281,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getCellCenter(cupcfd::geometry::euclidean::EuclideanPoint<T,3> * cellCenter, I nCellCenter, I * cellLabels, I nCellLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getCellCenter(cupcfd::geometry::euclidean::EuclideanPoint<T,3> * cellCenter, I nCellCenter, L * cellLabels, I nCellLabels) {
 				cupcfd::error::eCodes status;
 
 				// Size Check
@@ -318,8 +330,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getCellFaceLabels(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData, I * cellLabels, I nCellLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getCellFaceLabels(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData, L * cellLabels, I nCellLabels) {
 				cupcfd::error::eCodes status;
 
 				// Check Size of Arrays are suitable
@@ -353,7 +365,7 @@ namespace cupcfd
 				cupcfd::io::hdf5::HDF5Properties properties(access);
 
 				// Read Data
-				I * cellFaceIndexes = (I *) malloc(sizeof(I) * maxFaceCount * nCellLabels);
+				L * cellFaceIndexes = (L *) malloc(sizeof(L) * maxFaceCount * nCellLabels);
 
 				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
 				for(I i = 0; i < nCellLabels; i++) {
@@ -393,8 +405,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getFaceIsBoundary(bool * isBoundary, I nIsBoundary, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getFaceIsBoundary(bool * isBoundary, I nIsBoundary, L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 
 				// Size Check
@@ -405,7 +417,7 @@ namespace cupcfd
 				// If Cell 2 is 0, then it is a boundary face.
 
 				// Temporary store for cell 2 data
-				I * cell2Data = (I *) malloc(sizeof(I) * nFaceLabels);
+				L * cell2Data = (L *) malloc(sizeof(L) * nFaceLabels);
 
 				cupcfd::io::hdf5::HDF5Record record("/face", "cell2" , false);
 				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
@@ -429,8 +441,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getFaceNVertices(I * nVertices, I nNVertices, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getFaceNVertices(I * nVertices, I nNVertices, L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 
 				// Error Check: Size Check
@@ -469,8 +481,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getFaceBoundaryLabels(I * faceBoundaryLabels, I nFaceBoundaryLabels, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getFaceBoundaryLabels(L * faceBoundaryLabels, I nFaceBoundaryLabels, L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 
 				// Error Check: Size Check
@@ -511,8 +523,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getFaceCell1Labels(I * faceCell1Labels, I nFaceCell1Labels, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getFaceCell1Labels(L * faceCell1Labels, I nFaceCell1Labels, L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 				
 				// Size Check
@@ -539,8 +551,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getFaceCell2Labels(I * faceCell2Labels, I nFaceCell2Labels, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getFaceCell2Labels(L * faceCell2Labels, I nFaceCell2Labels, L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 				
 				// Size Check
@@ -578,8 +590,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getFaceArea(T * faceLambda, I nFaceLambda, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getFaceArea(T * faceLambda, I nFaceLambda, L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 				
 				// Size Check
@@ -606,8 +618,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getFaceLambda(T * faceLambda, I nFaceLambda, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getFaceLambda(T * faceLambda, I nFaceLambda, L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 				
 				// Size Check
@@ -634,8 +646,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getFaceNormal(cupcfd::geometry::euclidean::EuclideanVector<T,3> * faceNormal, I nFaceNormal, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getFaceNormal(cupcfd::geometry::euclidean::EuclideanVector<T,3> * faceNormal, I nFaceNormal, L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 				
 				// Size Check
@@ -684,8 +696,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getFaceCenter(cupcfd::geometry::euclidean::EuclideanPoint<T,3> * faceCenter, I nFaceCenter, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getFaceCenter(cupcfd::geometry::euclidean::EuclideanPoint<T,3> * faceCenter, I nFaceCenter, L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 				
 				// Size Check
@@ -734,8 +746,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getFaceVerticesLabelsCSR(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData,  I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getFaceVerticesLabelsCSR(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData,  L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 				
 				if (nCsrIndices != (nFaceLabels+1)) {
@@ -774,10 +786,10 @@ namespace cupcfd
 				csrIndices[nFaces] = ptr;
 
 				// Update CSR Data array
-				I * vert1 = (I *) malloc(sizeof(I) * nFaces);
-				I * vert2 = (I *) malloc(sizeof(I) * nFaces);
-				I * vert3 = (I *) malloc(sizeof(I) * nFaces);
-				I * vert4 = (I *) malloc(sizeof(I) * nFaces);
+				L * vert1 = (L *) malloc(sizeof(L) * nFaces);
+				L * vert2 = (L *) malloc(sizeof(L) * nFaces);
+				L * vert3 = (L *) malloc(sizeof(L) * nFaces);
+				L * vert4 = (L *) malloc(sizeof(L) * nFaces);
 
 				cupcfd::io::hdf5::HDF5Record record("/face", "vertices" , false);
 				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
@@ -831,8 +843,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getVertexCoords(cupcfd::geometry::euclidean::EuclideanPoint<T,3> * vertCoords, I nVertCoords, I * vertexLabels, I nVertexLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getVertexCoords(cupcfd::geometry::euclidean::EuclideanPoint<T,3> * vertCoords, I nVertCoords, L * vertexLabels, I nVertexLabels) {
 				cupcfd::error::eCodes status;
 				
 				// Size Check
@@ -881,8 +893,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getBoundaryFaceLabels(I * boundaryFaceLabels, I nBoundaryFaceLabels, I * boundaryLabels, I nBoundaryLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getBoundaryFaceLabels(L * boundaryFaceLabels, I nBoundaryFaceLabels, L * boundaryLabels, I nBoundaryLabels) {
 				cupcfd::error::eCodes status;
 				
 				if(nBoundaryLabels > 0) {
@@ -911,8 +923,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getBoundaryNVertices(I * nVertices, I nNVertices, I * boundaryLabels, I nBoundaryLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getBoundaryNVertices(I * nVertices, I nNVertices, L * boundaryLabels, I nBoundaryLabels) {
 				cupcfd::error::eCodes status;
 				
 				// ToDo: We could just read vert4 and ignore the rest....
@@ -953,8 +965,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getBoundaryRegionLabels(I * boundaryRegionLabels, I nBoundaryRegionLabels, I * boundaryLabels, I nBoundaryLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getBoundaryRegionLabels(L * boundaryRegionLabels, I nBoundaryRegionLabels, L * boundaryLabels, I nBoundaryLabels) {
 				cupcfd::error::eCodes status;
 				
 				if(nBoundaryLabels > 0) {
@@ -983,8 +995,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getBoundaryVerticesLabelsCSR(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData,  I * boundaryLabels, I nBoundaryLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getBoundaryVerticesLabelsCSR(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData,  L * boundaryLabels, I nBoundaryLabels) {
 				cupcfd::error::eCodes status;
 				
 				// Size Check
@@ -1026,10 +1038,10 @@ namespace cupcfd
 				csrIndices[nBoundaries] = ptr;
 
 				// Update CSR Data array
-				I * vert1 = (I *) malloc(sizeof(I) * nBoundaries);
-				I * vert2 = (I *) malloc(sizeof(I) * nBoundaries);
-				I * vert3 = (I *) malloc(sizeof(I) * nBoundaries);
-				I * vert4 = (I *) malloc(sizeof(I) * nBoundaries);
+				L * vert1 = (L *) malloc(sizeof(L) * nBoundaries);
+				L * vert2 = (L *) malloc(sizeof(L) * nBoundaries);
+				L * vert3 = (L *) malloc(sizeof(L) * nBoundaries);
+				L * vert4 = (L *) malloc(sizeof(L) * nBoundaries);
 
 				cupcfd::io::hdf5::HDF5Record record("/bnd", "vertices" , false);
 				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
@@ -1083,8 +1095,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getBoundaryDistance(T * boundaryDistance, I nBoundaryDistance, I * boundaryLabels, I nBoundaryLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getBoundaryDistance(T * boundaryDistance, I nBoundaryDistance, L * boundaryLabels, I nBoundaryLabels) {
 				cupcfd::error::eCodes status;
 				
 				if(nBoundaryLabels > 0) {
@@ -1113,8 +1125,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshHDF5Source<I,T>::getRegionName(std::string * names __attribute__((unused)), I nNames __attribute__((unused)), I * regionLabels __attribute__((unused)), I nRegionLabels __attribute__((unused))) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshHDF5Source<I,T,L>::getRegionName(std::string * names __attribute__((unused)), I nNames __attribute__((unused)), L * regionLabels __attribute__((unused)), I nRegionLabels __attribute__((unused))) {
 				// ToDo
 				return cupcfd::error::E_NOT_IMPLEMENTED;
 			}
@@ -1123,5 +1135,8 @@ namespace cupcfd
 }
 
 // Explicit Instantiation
-template class cupcfd::geometry::mesh::MeshHDF5Source<int,float>;
-template class cupcfd::geometry::mesh::MeshHDF5Source<int,double>;
+template class cupcfd::geometry::mesh::MeshHDF5Source<int,float,int>;
+template class cupcfd::geometry::mesh::MeshHDF5Source<int,double,int>;
+
+template class cupcfd::geometry::mesh::MeshHDF5Source<int,float,long>;
+template class cupcfd::geometry::mesh::MeshHDF5Source<int,double,long>;
@@ -0,0 +1,1485 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the MeshMixedGenSource class
+ */
+
+// Parent Class
+#include "MeshMixedGenSource.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace euc = cupcfd::geometry::euclidean;
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			// The faces of a block that are split in a tetrahedral, prism or hexahedral block
+			static const unsigned char mixedGenTetFaces = 0x3F;
+			static const unsigned char mixedGenPrismFaces = 0x30;
+			static const unsigned char mixedGenHexFaces = 0x00;
+
+			// === Constructors/Deconstructors ===
+
+			template <class I, class T, class L>
+			MeshMixedGenSource<I,T,L>::MeshMixedGenSource(I nX, I nY, I nZ, T sMinX, T sMaxX, T sMinY, T sMaxY, T sMinZ, T sMaxZ,
+														  T tetFraction, T prismFraction, T jitter, bool shuffleCells, uint64_t seed)
+			:nX(nX),
+			 nY(nY),
+			 nZ(nZ),
+			 sMinX(sMinX),
+			 sMinY(sMinY),
+			 sMinZ(sMinZ),
+			 sMaxX(sMaxX),
+			 sMaxY(sMaxY),
+			 sMaxZ(sMaxZ),
+			 tetFraction(tetFraction),
+			 prismFraction(prismFraction),
+			 jitter(jitter),
+			 shuffleCells(shuffleCells),
+			 seed(seed)
+			{
+				// Compute Spatial Division
+				this->dSx = (this->sMaxX - this->sMinX) / T(this->nX);
+				this->dSy = (this->sMaxY - this->sMinY) / T(this->nY);
+				this->dSz = (this->sMaxZ - this->sMinZ) / T(this->nZ);
+
+				this->nGridFaces[0] = (this->nX + 1) * this->nY * this->nZ;
+				this->nGridFaces[1] = this->nX * (this->nY + 1) * this->nZ;
+				this->nGridFaces[2] = this->nX * this->nY * (this->nZ + 1);
+				this->nGridVertices = (this->nX + 1) * (this->nY + 1) * (this->nZ + 1);
+
+				I nBlocks = this->nX * this->nY * this->nZ;
+				I dims[3] = {this->nX, this->nY, this->nZ};
+
+				// (1) Choose the faces each block would like to split from its type
+				std::vector<unsigned char> blockFaces(nBlocks);
+
+				for(I b = 0; b < nBlocks; b++) {
+					T r = this->getRandom(0, b);
+
+					if(r < this->tetFraction) {
+						blockFaces[b] = mixedGenTetFaces;
+					}
+					else if(r < this->tetFraction + this->prismFraction) {
+						blockFaces[b] = mixedGenPrismFaces;
+					}
+					else {
+						blockFaces[b] = mixedGenHexFaces;
+					}
+				}
+
+				// (2) A face is only split if the blocks either side of it both split it. Blocks that cannot
+				// be split as their type would like are split about their center instead.
+				this->blockLayout.resize(nBlocks);
+
+				for(I b = 0; b < nBlocks; b++) {
+					I coord[3] = {b % this->nX, (b / this->nX) % this->nY, b / (this->nX * this->nY)};
+					unsigned char mask = blockFaces[b];
+
+					for(int f = 0; f < 6; f++) {
+						int d = f / 2;
+						I next[3] = {coord[0], coord[1], coord[2]};
+						next[d] = next[d] + ((f % 2 == 0) ? -1 : 1);
+
+						if(next[d] >= 0 && next[d] < dims[d]) {
+							I neighbour = next[0] + this->nX * (next[1] + this->nY * next[2]);
+
+							if(!(blockFaces[neighbour] & (1 << (f ^ 1)))) {
+								mask = mask & ~(1 << f);
+							}
+						}
+					}
+
+					unsigned char split;
+
+					if(blockFaces[b] == mixedGenHexFaces) {
+						split = MIXED_GEN_SPLIT_HEXAHEDRON;
+					}
+					else if(blockFaces[b] == mixedGenPrismFaces && mask == mixedGenPrismFaces) {
+						split = MIXED_GEN_SPLIT_TRIPRISM;
+					}
+					else {
+						split = MIXED_GEN_SPLIT_CENTER;
+					}
+
+					this->blockLayout[b] = mask | (split << 6);
+				}
+
+				// (3) Count the cells, faces, boundaries and center vertices of each block, so that indexes can
+				// be mapped to labels
+				this->cellOffset.resize(nBlocks + 1);
+				this->faceOffset.resize(nBlocks + 1);
+				this->boundaryOffset.resize(nBlocks + 1);
+				this->centerOffset.resize(nBlocks + 1);
+
+				this->cellOffset[0] = 0;
+				this->faceOffset[0] = 0;
+				this->boundaryOffset[0] = 0;
+				this->centerOffset[0] = 0;
+
+				L faceLabels[30];
+
+				for(I b = 0; b < nBlocks; b++) {
+					unsigned char mask = this->blockLayout[b] & 0x3F;
+					unsigned char split = this->blockLayout[b] >> 6;
+					I nCells = 1;
+					I nCenters = 0;
+
+					if(split == MIXED_GEN_SPLIT_TRIPRISM) {
+						nCells = 2;
+					}
+					else if(split == MIXED_GEN_SPLIT_CENTER) {
+						nCells = 6;
+						nCenters = 1;
+
+						for(int f = 0; f < 6; f++) {
+							if(mask & (1 << f)) {
+								nCells = nCells + 1;
+							}
+						}
+					}
+
+					this->cellOffset[b + 1] = this->cellOffset[b] + nCells;
+					this->faceOffset[b + 1] = this->faceOffset[b] + this->getBlockFaces(b, faceLabels, false);
+					this->boundaryOffset[b + 1] = this->boundaryOffset[b] + this->getBlockFaces(b, faceLabels, true);
+					this->centerOffset[b + 1] = this->centerOffset[b] + nCenters;
+				}
+
+				// (4) Size the cipher used to shuffle the cell labels to the smallest even number of bits
+				// that covers every cell slot
+				uint64_t nSlots = uint64_t(12) * uint64_t(nBlocks);
+				this->shuffleBits = 2;
+
+				while((uint64_t(1) << this->shuffleBits) < nSlots) {
+					this->shuffleBits = this->shuffleBits + 2;
+				}
+			}
+
+			template <class I, class T, class L>
+			MeshMixedGenSource<I,T,L>::~MeshMixedGenSource()
+			{
+
+			}
+
+			// === Concrete Methods ===
+
+			template <class I, class T, class L>
+			uint64_t MeshMixedGenSource<I,T,L>::getHash(uint64_t stream, uint64_t key) {
+				uint64_t x = this->seed ^ (stream * 0x9E3779B97F4A7C15ULL) ^ (key * 0xC2B2AE3D27D4EB4FULL);
+
+				// Two rounds of the SplitMix64 finaliser
+				for(int i = 0; i < 2; i++) {
+					x = x ^ (x >> 30);
+					x = x * 0xBF58476D1CE4E5B9ULL;
+					x = x ^ (x >> 27);
+					x = x * 0x94D049BB133111EBULL;
+					x = x ^ (x >> 31);
+				}
+
+				return x;
+			}
+
+			template <class I, class T, class L>
+			T MeshMixedGenSource<I,T,L>::getRandom(uint64_t stream, uint64_t key) {
+				// Use the top 53 bits, so the value is below 1 in double precision
+				return T(double(this->getHash(stream, key) >> 11) / 9007199254740992.0);
+			}
+
+			template <class I, class T, class L>
+			uint64_t MeshMixedGenSource<I,T,L>::shuffleCellSlot(uint64_t slot, bool inverse) {
+				// A four round Feistel cipher is a permutation of the values with shuffleBits bits.
+				// Applying it again until the value is in range (cycle walking) restricts it to a
+				// permutation of the slots.
+				uint64_t nSlots = uint64_t(12) * uint64_t(this->cellOffset.size() - 1);
+				int half = this->shuffleBits / 2;
+				uint64_t mask = (uint64_t(1) << half) - 1;
+				uint64_t x = slot;
+
+				do {
+					uint64_t left = x >> half;
+					uint64_t right = x & mask;
+
+					if(!inverse) {
+						for(int round = 0; round < 4; round++) {
+							uint64_t tmp = left ^ (this->getHash(4 + round, right) & mask);
+							left = right;
+							right = tmp;
+						}
+					}
+					else {
+						for(int round = 3; round >= 0; round--) {
+							uint64_t tmp = right ^ (this->getHash(4 + round, left) & mask);
+							right = left;
+							left = tmp;
+						}
+					}
+
+					x = (left << half) | right;
+				} while(x >= nSlots);
+
+				return x;
+			}
+
+			template <class I, class T, class L>
+			L MeshMixedGenSource<I,T,L>::getCellLabel(I block, I n) {
+				uint64_t slot = uint64_t(12) * uint64_t(block) + uint64_t(n);
+
+				if(this->shuffleCells) {
+					slot = this->shuffleCellSlot(slot, false);
+				}
+
+				return L(slot);
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getCellBlock(L label, I * block, I * n) {
+				I nBlocks = this->nX * this->nY * this->nZ;
+
+				if(label < 0 || uint64_t(label) >= uint64_t(12) * uint64_t(nBlocks)) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				uint64_t slot = uint64_t(label);
+
+				if(this->shuffleCells) {
+					slot = this->shuffleCellSlot(slot, true);
+				}
+
+				*block = I(slot / 12);
+				*n = I(slot % 12);
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			I MeshMixedGenSource<I,T,L>::getFaceCellSlot(I block, I face, I triangle) {
+				unsigned char split = this->blockLayout[block] >> 6;
+				bool isSplit = (this->blockLayout[block] & (1 << face)) != 0;
+
+				if(split == MIXED_GEN_SPLIT_HEXAHEDRON) {
+					return 0;
+				}
+				else if(split == MIXED_GEN_SPLIT_TRIPRISM) {
+					// The bottom and top triangles belong to the prism of the same number. Prism 0 has the
+					// low Y and high X faces, and prism 1 the low X and high Y faces.
+					if(face >= 4) {
+						return triangle;
+					}
+
+					return (face == 1 || face == 2) ? 0 : 1;
+				}
+
+				// Split about the center - two tetrahedra for a split face, else a pyramid
+				return 2 * face + (isSplit ? triangle : 0);
+			}
+
+			template <class I, class T, class L>
+			L MeshMixedGenSource<I,T,L>::getGridFaceLabel(I block, I face, I triangle) {
+				I node[3] = {block % this->nX, (block / this->nX) % this->nY, block / (this->nX * this->nY)};
+				int d = face / 2;
+				node[d] = node[d] + (face % 2);
+
+				// Use the MeshStructGenSource label of the face
+				L gridFace;
+
+				if(d == 0) {
+					gridFace = L(node[0]) + L(this->nX + 1) * (L(node[1]) + L(this->nY) * L(node[2]));
+				}
+				else if(d == 1) {
+					gridFace = L(this->nGridFaces[0]) + L(node[0]) + L(this->nX) * (L(node[1]) + L(this->nY + 1) * L(node[2]));
+				}
+				else {
+					gridFace = L(this->nGridFaces[0]) + L(this->nGridFaces[1]) + L(node[0]) + L(this->nX) * (L(node[1]) + L(this->nY) * L(node[2]));
+				}
+
+				return 2 * gridFace + L(triangle);
+			}
+
+			template <class I, class T, class L>
+			int MeshMixedGenSource<I,T,L>::getFaceCorner(int face, int corner) {
+				// The face is in the plane of the two dimensions u < v other than its normal dimension d.
+				// Its corners are (0,0), (1,0), (1,1), (0,1) in (u,v).
+				int d = face / 2;
+				int u = (d == 0) ? 1 : 0;
+				int v = (d == 2) ? 1 : 2;
+
+				int coord[3];
+				coord[d] = face % 2;
+				coord[u] = (corner == 1 || corner == 2) ? 1 : 0;
+				coord[v] = (corner >= 2) ? 1 : 0;
+
+				return coord[0] + 2 * coord[1] + 4 * coord[2];
+			}
+
+			template <class I, class T, class L>
+			L MeshMixedGenSource<I,T,L>::getCornerLabel(I block, int corner) {
+				L x = L(block % this->nX) + L(corner & 1);
+				L y = L((block / this->nX) % this->nY) + L((corner >> 1) & 1);
+				L z = L(block / (this->nX * this->nY)) + L(corner >> 2);
+
+				return x + L(this->nX + 1) * (y + L(this->nY + 1) * z);
+			}
+
+			template <class I, class T, class L>
+			int MeshMixedGenSource<I,T,L>::getEdgeSlot(int face, int edge) {
+				int c0 = getFaceCorner(face, edge);
+				int c1 = getFaceCorner(face, (edge + 1) % 4);
+
+				// The dimension the edge runs along, and the position of the edge in the two others
+				int a = (c0 ^ c1) == 1 ? 0 : ((c0 ^ c1) == 2 ? 1 : 2);
+				int a1 = (a == 0) ? 1 : 0;
+				int a2 = (a == 2) ? 1 : 2;
+
+				return 4 * a + ((c0 >> a1) & 1) + 2 * ((c0 >> a2) & 1);
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getCellFaces(L cellLabel, L * faceLabels, I * nFaces) {
+				cupcfd::error::eCodes status;
+				I block, n;
+
+				status = this->getCellBlock(cellLabel, &block, &n);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				unsigned char split = this->blockLayout[block] >> 6;
+				L internalBase = 2 * (L(this->nGridFaces[0]) + L(this->nGridFaces[1]) + L(this->nGridFaces[2])) + L(18) * L(block);
+
+				if(split == MIXED_GEN_SPLIT_HEXAHEDRON) {
+					if(n != 0) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+
+					for(I f = 0; f < 6; f++) {
+						faceLabels[f] = this->getGridFaceLabel(block, f, 0);
+					}
+
+					*nFaces = 6;
+				}
+				else if(split == MIXED_GEN_SPLIT_TRIPRISM) {
+					if(n > 1) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+
+					faceLabels[0] = this->getGridFaceLabel(block, 4, n);
+					faceLabels[1] = this->getGridFaceLabel(block, 5, n);
+					faceLabels[2] = this->getGridFaceLabel(block, (n == 0) ? 2 : 0, 0);
+					faceLabels[3] = this->getGridFaceLabel(block, (n == 0) ? 1 : 3, 0);
+					faceLabels[4] = internalBase;
+
+					*nFaces = 5;
+				}
+				else {
+					I f = n / 2;
+					I t = n % 2;
+					bool isSplit = (this->blockLayout[block] & (1 << f)) != 0;
+
+					if(t == 1 && !isSplit) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+
+					faceLabels[0] = this->getGridFaceLabel(block, f, t);
+					*nFaces = 1;
+
+					if(isSplit) {
+						// Triangle 0 has the edges from corner 0 to 2, triangle 1 from corner 2 to 0,
+						// and they share the diagonal
+						faceLabels[1] = internalBase + L(getEdgeSlot(f, 2 * t));
+						faceLabels[2] = internalBase + L(getEdgeSlot(f, 2 * t + 1));
+						faceLabels[3] = internalBase + L(12 + f);
+						*nFaces = 4;
+					}
+					else {
+						for(int e = 0; e < 4; e++) {
+							faceLabels[1 + e] = internalBase + L(getEdgeSlot(f, e));
+						}
+						*nFaces = 5;
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			I MeshMixedGenSource<I,T,L>::getBlockFaces(I block, L * faceLabels, bool boundaryOnly) {
+				unsigned char mask = this->blockLayout[block] & 0x3F;
+				unsigned char split = this->blockLayout[block] >> 6;
+				I coord[3] = {block % this->nX, (block / this->nX) % this->nY, block / (this->nX * this->nY)};
+				I dims[3] = {this->nX, this->nY, this->nZ};
+				L internalBase = 2 * (L(this->nGridFaces[0]) + L(this->nGridFaces[1]) + L(this->nGridFaces[2])) + L(18) * L(block);
+				I nFaces = 0;
+
+				// (1) The faces inside the block
+				if(!boundaryOnly) {
+					if(split == MIXED_GEN_SPLIT_TRIPRISM) {
+						faceLabels[nFaces] = internalBase;
+						nFaces++;
+					}
+					else if(split == MIXED_GEN_SPLIT_CENTER) {
+						for(int k = 0; k < 12; k++) {
+							faceLabels[nFaces] = internalBase + L(k);
+							nFaces++;
+						}
+
+						for(int f = 0; f < 6; f++) {
+							if(mask & (1 << f)) {
+								faceLabels[nFaces] = internalBase + L(12 + f);
+								nFaces++;
+							}
+						}
+					}
+				}
+
+				// (2) The faces on the grid in the lower directions, and in the upper directions on the surface of the box
+				for(int f = 0; f < 6; f++) {
+					int d = f / 2;
+					bool isLow = (f % 2 == 0);
+					bool owned = isLow || coord[d] == dims[d] - 1;
+					bool isBoundary = isLow ? (coord[d] == 0) : owned;
+
+					if(!owned || (boundaryOnly && !isBoundary)) {
+						continue;
+					}
+
+					faceLabels[nFaces] = this->getGridFaceLabel(block, f, 0);
+					nFaces++;
+
+					if(mask & (1 << f)) {
+						faceLabels[nFaces] = this->getGridFaceLabel(block, f, 1);
+						nFaces++;
+					}
+				}
+
+				return nFaces;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getFace(L faceLabel, L * vertexLabels, I * nVertices, L * cell1, L * cell2) {
+				I nBlocks = this->nX * this->nY * this->nZ;
+				L nGridSlots = 2 * (L(this->nGridFaces[0]) + L(this->nGridFaces[1]) + L(this->nGridFaces[2]));
+
+				if(faceLabel < 0 || faceLabel >= nGridSlots + L(18) * L(nBlocks)) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				if(faceLabel < nGridSlots) {
+					// === A face on the grid ===
+					L gridFace = faceLabel / 2;
+					I t = I(faceLabel % 2);
+
+					// Find the node coordinate of the face in its normal dimension, and the cell coordinates in the others
+					int d;
+					I node[3];
+					I dims[3] = {this->nX, this->nY, this->nZ};
+
+					if(gridFace < L(this->nGridFaces[0])) {
+						d = 0;
+						node[0] = I(gridFace % L(this->nX + 1));
+						node[1] = I((gridFace / L(this->nX + 1)) % L(this->nY));
+						node[2] = I(gridFace / (L(this->nX + 1) * L(this->nY)));
+					}
+					else if(gridFace < L(this->nGridFaces[0]) + L(this->nGridFaces[1])) {
+						L g = gridFace - L(this->nGridFaces[0]);
+						d = 1;
+						node[0] = I(g % L(this->nX));
+						node[1] = I((g / L(this->nX)) % L(this->nY + 1));
+						node[2] = I(g / (L(this->nX) * L(this->nY + 1)));
+					}
+					else {
+						L g = gridFace - L(this->nGridFaces[0]) - L(this->nGridFaces[1]);
+						d = 2;
+						node[0] = I(g % L(this->nX));
+						node[1] = I((g / L(this->nX)) % L(this->nY));
+						node[2] = I(g / (L(this->nX) * L(this->nY)));
+					}
+
+					// The blocks below and above the face, if they exist
+					I low = -1;
+					I high = -1;
+
+					if(node[d] > 0) {
+						I coord[3] = {node[0], node[1], node[2]};
+						coord[d] = coord[d] - 1;
+						low = coord[0] + this->nX * (coord[1] + this->nY * coord[2]);
+					}
+
+					if(node[d] < dims[d]) {
+						high = node[0] + this->nX * (node[1] + this->nY * node[2]);
+					}
+
+					I block = (low >= 0) ? low : high;
+					I face = (low >= 0) ? (2 * d + 1) : (2 * d);
+
+					if(t == 1 && !(this->blockLayout[block] & (1 << face))) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+
+					// The corners of the face, or of its triangle
+					if(this->blockLayout[block] & (1 << face)) {
+						int corners[2][3] = {{0, 1, 2}, {0, 2, 3}};
+
+						for(int i = 0; i < 3; i++) {
+							vertexLabels[i] = this->getCornerLabel(block, getFaceCorner(face, corners[t][i]));
+						}
+
+						*nVertices = 3;
+					}
+					else {
+						for(int i = 0; i < 4; i++) {
+							vertexLabels[i] = this->getCornerLabel(block, getFaceCorner(face, i));
+						}
+
+						*nVertices = 4;
+					}
+
+					// Cell 1 is the cell below the face if there is one
+					if(low >= 0) {
+						*cell1 = this->getCellLabel(low, this->getFaceCellSlot(low, 2 * d + 1, t));
+						*cell2 = (high >= 0) ? this->getCellLabel(high, this->getFaceCellSlot(high, 2 * d, t)) : L(-1);
+					}
+					else {
+						*cell1 = this->getCellLabel(high, this->getFaceCellSlot(high, 2 * d, t));
+						*cell2 = L(-1);
+					}
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// === A face inside a block ===
+				I block = I((faceLabel - nGridSlots) / 18);
+				int k = int((faceLabel - nGridSlots) % 18);
+				unsigned char split = this->blockLayout[block] >> 6;
+				L center = L(this->nGridVertices) + L(block);
+
+				if(split == MIXED_GEN_SPLIT_TRIPRISM && k == 0) {
+					// The diagonal plane between the two prisms
+					vertexLabels[0] = this->getCornerLabel(block, 0);
+					vertexLabels[1] = this->getCornerLabel(block, 3);
+					vertexLabels[2] = this->getCornerLabel(block, 7);
+					vertexLabels[3] = this->getCornerLabel(block, 4);
+					*nVertices = 4;
+
+					*cell1 = this->getCellLabel(block, 0);
+					*cell2 = this->getCellLabel(block, 1);
+				}
+				else if(split == MIXED_GEN_SPLIT_CENTER && k < 12) {
+					// The triangle between the center and an edge of the block, which lies between the cells
+					// of the two faces of the block that meet at the edge
+					int a = k / 4;
+					int a1 = (a == 0) ? 1 : 0;
+					int a2 = (a == 2) ? 1 : 2;
+					int p = k % 2;
+					int q = (k / 2) % 2;
+					int c0 = (p << a1) | (q << a2);
+
+					vertexLabels[0] = center;
+					vertexLabels[1] = this->getCornerLabel(block, c0);
+					vertexLabels[2] = this->getCornerLabel(block, c0 | (1 << a));
+					*nVertices = 3;
+
+					int faces[2] = {2 * a1 + p, 2 * a2 + q};
+					L cells[2];
+
+					for(int i = 0; i < 2; i++) {
+						for(int e = 0; e < 4; e++) {
+							if(getEdgeSlot(faces[i], e) == k) {
+								cells[i] = this->getCellLabel(block, this->getFaceCellSlot(block, faces[i], e / 2));
+							}
+						}
+					}
+
+					*cell1 = cells[0];
+					*cell2 = cells[1];
+				}
+				else if(split == MIXED_GEN_SPLIT_CENTER && (this->blockLayout[block] & (1 << (k - 12)))) {
+					// The triangle between the center and the diagonal of a split face
+					int f = k - 12;
+
+					vertexLabels[0] = center;
+					vertexLabels[1] = this->getCornerLabel(block, getFaceCorner(f, 0));
+					vertexLabels[2] = this->getCornerLabel(block, getFaceCorner(f, 2));
+					*nVertices = 3;
+
+					*cell1 = this->getCellLabel(block, 2 * f);
+					*cell2 = this->getCellLabel(block, 2 * f + 1);
+				}
+				else {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			euc::EuclideanPoint<T,3> MeshMixedGenSource<I,T,L>::getVertexPos(L vertexLabel) {
+				euc::EuclideanPoint<T,3> pos(T(0), T(0), T(0));
+
+				if(vertexLabel >= L(this->nGridVertices)) {
+					// Block centers are the average of the block corners
+					I block = I(vertexLabel - L(this->nGridVertices));
+
+					for(int c = 0; c < 8; c++) {
+						euc::EuclideanPoint<T,3> corner = this->getVertexPos(this->getCornerLabel(block, c));
+						pos.cmp[0] += corner.cmp[0];
+						pos.cmp[1] += corner.cmp[1];
+						pos.cmp[2] += corner.cmp[2];
+					}
+
+					pos.cmp[0] = pos.cmp[0] / T(8);
+					pos.cmp[1] = pos.cmp[1] / T(8);
+					pos.cmp[2] = pos.cmp[2] / T(8);
+
+					return pos;
+				}
+
+				I coord[3];
+				coord[0] = I(vertexLabel % L(this->nX + 1));
+				coord[1] = I((vertexLabel / L(this->nX + 1)) % L(this->nY + 1));
+				coord[2] = I(vertexLabel / (L(this->nX + 1) * L(this->nY + 1)));
+
+				I dims[3] = {this->nX, this->nY, this->nZ};
+				T sMin[3] = {this->sMinX, this->sMinY, this->sMinZ};
+				T dS[3] = {this->dSx, this->dSy, this->dSz};
+
+				for(int d = 0; d < 3; d++) {
+					pos.cmp[d] = sMin[d] + dS[d] * T(coord[d]);
+
+					// Keep the faces of the box flat
+					if(this->jitter > T(0) && coord[d] > 0 && coord[d] < dims[d]) {
+						T r = this->getRandom(1 + d, uint64_t(vertexLabel));
+						pos.cmp[d] += this->jitter * dS[d] * (T(2) * r - T(1));
+					}
+				}
+
+				return pos;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::computeCellGeometry(L cellLabel, T * volume, euc::EuclideanPoint<T,3> * center) {
+				cupcfd::error::eCodes status;
+				L faceLabels[6];
+				I nFaces;
+
+				status = this->getCellFaces(cellLabel, faceLabels, &nFaces);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				// (1) Gather the positions of the vertices of each face
+				euc::EuclideanPoint<T,3> pos[6][4];
+				I nVertices[6];
+				T ref[3] = {T(0), T(0), T(0)};
+				I nRef = 0;
+
+				for(I i = 0; i < nFaces; i++) {
+					L vertexLabels[4];
+					L cell1, cell2;
+
+					status = this->getFace(faceLabels[i], vertexLabels, &(nVertices[i]), &cell1, &cell2);
+					CHECK_ECODE(status)
+
+					for(I j = 0; j < nVertices[i]; j++) {
+						pos[i][j] = this->getVertexPos(vertexLabels[j]);
+
+						for(int d = 0; d < 3; d++) {
+							ref[d] += pos[i][j].cmp[d];
+						}
+
+						nRef++;
+					}
+				}
+
+				// Any point inside the cell will do as the common apex of the tetrahedra
+				for(int d = 0; d < 3; d++) {
+					ref[d] = ref[d] / T(nRef);
+				}
+
+				// (2) Sum the signed volumes of the tetrahedra between the apex and the fan of triangles of each face,
+				// with each face oriented outwards
+				T vol6 = T(0);
+				T acc[3] = {T(0), T(0), T(0)};
+
+				for(I i = 0; i < nFaces; i++) {
+					T s[3] = {T(0), T(0), T(0)};
+					T mean[3] = {T(0), T(0), T(0)};
+
+					for(I j = 0; j < nVertices[i]; j++) {
+						for(int d = 0; d < 3; d++) {
+							mean[d] += pos[i][j].cmp[d] / T(nVertices[i]);
+						}
+					}
+
+					for(I j = 1; j < nVertices[i] - 1; j++) {
+						T a[3], b[3];
+
+						for(int d = 0; d < 3; d++) {
+							a[d] = pos[i][j].cmp[d] - pos[i][0].cmp[d];
+							b[d] = pos[i][j + 1].cmp[d] - pos[i][0].cmp[d];
+						}
+
+						s[0] += a[1] * b[2] - a[2] * b[1];
+						s[1] += a[2] * b[0] - a[0] * b[2];
+						s[2] += a[0] * b[1] - a[1] * b[0];
+					}
+
+					T sign = ((s[0] * (mean[0] - ref[0]) + s[1] * (mean[1] - ref[1]) + s[2] * (mean[2] - ref[2])) < T(0)) ? T(-1) : T(1);
+
+					for(I j = 1; j < nVertices[i] - 1; j++) {
+						T a[3], b[3], c[3];
+
+						for(int d = 0; d < 3; d++) {
+							a[d] = pos[i][0].cmp[d] - ref[d];
+							b[d] = pos[i][j].cmp[d] - ref[d];
+							c[d] = pos[i][j + 1].cmp[d] - ref[d];
+						}
+
+						T v = sign * (a[0] * (b[1] * c[2] - b[2] * c[1]) +
+									  a[1] * (b[2] * c[0] - b[0] * c[2]) +
+									  a[2] * (b[0] * c[1] - b[1] * c[0]));
+
+						vol6 += v;
+
+						for(int d = 0; d < 3; d++) {
+							acc[d] += v * (a[d] + b[d] + c[d]) / T(4);
+						}
+					}
+				}
+
+				*volume = vol6 / T(6);
+
+				for(int d = 0; d < 3; d++) {
+					center->cmp[d] = ref[d] + ((vol6 != T(0)) ? acc[d] / vol6 : T(0));
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::computeFaceGeometry(L faceLabel, T * area, euc::EuclideanVector<T,3> * normal, euc::EuclideanPoint<T,3> * center) {
+				cupcfd::error::eCodes status;
+				L vertexLabels[4];
+				I nVertices;
+				L cell1, cell2;
+
+				status = this->getFace(faceLabel, vertexLabels, &nVertices, &cell1, &cell2);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				euc::EuclideanPoint<T,3> pos[4];
+
+				for(I j = 0; j < nVertices; j++) {
+					pos[j] = this->getVertexPos(vertexLabels[j]);
+				}
+
+				// Sum of the (twice) vector areas of the triangles of the fan about the first vertex
+				T s[3] = {T(0), T(0), T(0)};
+
+				for(I j = 1; j < nVertices - 1; j++) {
+					T a[3], b[3];
+
+					for(int d = 0; d < 3; d++) {
+						a[d] = pos[j].cmp[d] - pos[0].cmp[d];
+						b[d] = pos[j + 1].cmp[d] - pos[0].cmp[d];
+					}
+
+					s[0] += a[1] * b[2] - a[2] * b[1];
+					s[1] += a[2] * b[0] - a[0] * b[2];
+					s[2] += a[0] * b[1] - a[1] * b[0];
+				}
+
+				// Centroid - the triangle centroids weighted by their area in the plane of the face
+				T c[3] = {T(0), T(0), T(0)};
+				T weight = T(0);
+
+				for(I j = 1; j < nVertices - 1; j++) {
+					T a[3], b[3];
+
+					for(int d = 0; d < 3; d++) {
+						a[d] = pos[j].cmp[d] - pos[0].cmp[d];
+						b[d] = pos[j + 1].cmp[d] - pos[0].cmp[d];
+					}
+
+					T w = (a[1] * b[2] - a[2] * b[1]) * s[0] + (a[2] * b[0] - a[0] * b[2]) * s[1] + (a[0] * b[1] - a[1] * b[0]) * s[2];
+
+					for(int d = 0; d < 3; d++) {
+						c[d] += w * (a[d] + b[d]);
+					}
+
+					weight += w;
+				}
+
+				for(int d = 0; d < 3; d++) {
+					center->cmp[d] = pos[0].cmp[d] + ((weight > T(0)) ? c[d] / (T(3) * weight) : T(0));
+				}
+
+				T length = std::sqrt(s[0] * s[0] + s[1] * s[1] + s[2] * s[2]);
+				*area = T(0.5) * length;
+
+				// Orient the normal out of cell 1
+				T cellVolume;
+				euc::EuclideanPoint<T,3> cellCenter;
+
+				status = this->computeCellGeometry(cell1, &cellVolume, &cellCenter);
+				CHECK_ECODE(status)
+
+				T dot = s[0] * (center->cmp[0] - cellCenter.cmp[0]) +
+						s[1] * (center->cmp[1] - cellCenter.cmp[1]) +
+						s[2] * (center->cmp[2] - cellCenter.cmp[2]);
+				T scale = (length > T(0)) ? ((dot < T(0)) ? T(-1) : T(1)) / length : T(0);
+
+				for(int d = 0; d < 3; d++) {
+					normal->cmp[d] = scale * s[d];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// === Overloaded Inherited Virtual Methods ===
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getCellLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
+				if (nLabels != nIndexes) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				I nBlocks = this->nX * this->nY * this->nZ;
+
+				for(I i = 0; i < nIndexes; i++) {
+					if(indexes[i] < 0 || indexes[i] >= this->cellOffset[nBlocks]) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+
+					// Find the block, then the n'th of its cells
+					I block = I(std::upper_bound(this->cellOffset.begin(), this->cellOffset.end(), indexes[i]) - this->cellOffset.begin()) - 1;
+					I n = indexes[i] - this->cellOffset[block];
+
+					if((this->blockLayout[block] >> 6) == MIXED_GEN_SPLIT_CENTER) {
+						for(I f = 0; f < 6; f++) {
+							I nFaceCells = (this->blockLayout[block] & (1 << f)) ? 2 : 1;
+
+							if(n < nFaceCells) {
+								n = 2 * f + n;
+								break;
+							}
+
+							n = n - nFaceCells;
+						}
+					}
+
+					labels[i] = this->getCellLabel(block, n);
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getFaceLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
+				if (nLabels != nIndexes) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				I nBlocks = this->nX * this->nY * this->nZ;
+				L faceLabels[30];
+
+				for(I i = 0; i < nIndexes; i++) {
+					if(indexes[i] < 0 || indexes[i] >= this->faceOffset[nBlocks]) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+
+					I block = I(std::upper_bound(this->faceOffset.begin(), this->faceOffset.end(), indexes[i]) - this->faceOffset.begin()) - 1;
+					I nFaces __attribute__((unused)) = this->getBlockFaces(block, faceLabels, false);
+
+					labels[i] = faceLabels[indexes[i] - this->faceOffset[block]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getVertexLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
+				if (nLabels != nIndexes) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				I nBlocks = this->nX * this->nY * this->nZ;
+
+				for(I i = 0; i < nIndexes; i++) {
+					if(indexes[i] < 0 || indexes[i] >= this->nGridVertices + this->centerOffset[nBlocks]) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+
+					// The grid vertices come first, followed by the centers of the blocks that have one
+					if(indexes[i] < this->nGridVertices) {
+						labels[i] = L(indexes[i]);
+					}
+					else {
+						I n = indexes[i] - this->nGridVertices;
+						I block = I(std::upper_bound(this->centerOffset.begin(), this->centerOffset.end(), n) - this->centerOffset.begin()) - 1;
+						labels[i] = L(this->nGridVertices) + L(block);
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getBoundaryLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
+				if (nLabels != nIndexes) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				I nBlocks = this->nX * this->nY * this->nZ;
+				L faceLabels[30];
+
+				for(I i = 0; i < nIndexes; i++) {
+					if(indexes[i] < 0 || indexes[i] >= this->boundaryOffset[nBlocks]) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+
+					I block = I(std::upper_bound(this->boundaryOffset.begin(), this->boundaryOffset.end(), indexes[i]) - this->boundaryOffset.begin()) - 1;
+					I nFaces __attribute__((unused)) = this->getBlockFaces(block, faceLabels, true);
+
+					labels[i] = faceLabels[indexes[i] - this->boundaryOffset[block]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getRegionLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
+				if (nLabels != nIndexes) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				// Since we are using zero-based indexes, we will just assign the same label as the index
+				for(I i = 0; i < nIndexes; i++) {
+					labels[i] = indexes[i];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getCellCount(L * cellCount) {
+				*cellCount = this->cellOffset[this->cellOffset.size() - 1];
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getFaceCount(L * faceCount) {
+				*faceCount = this->faceOffset[this->faceOffset.size() - 1];
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getBoundaryCount(L * boundaryCount) {
+				*boundaryCount = this->boundaryOffset[this->boundaryOffset.size() - 1];
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getRegionCount(I * regionCount) {
+				// Just one region, the boundary wall
+				*regionCount = 1;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getVertexCount(L * vertexCount) {
+				*vertexCount = this->nGridVertices + this->centerOffset[this->centerOffset.size() - 1];
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getMaxFaceCount(I * maxFaceCount) {
+				// Hexahedra have the most faces
+				*maxFaceCount = 6;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getMaxVertexCount(I * maxVertexCount) {
+				// Faces are triangles or quadrilaterals
+				*maxVertexCount = 4;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getCellNFaces(I * nFaces, I nNFaces, L * cellLabels, I nCellLabels) {
+				cupcfd::error::eCodes status;
+
+				if (nNFaces != nCellLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				L faceLabels[6];
+
+				for(I i = 0; i < nCellLabels; i++) {
+					status = this->getCellFaces(cellLabels[i], faceLabels, &(nFaces[i]));
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getCellVolume(T * cellVol, I nCellVol, L * cellLabels, I nCellLabels) {
+				cupcfd::error::eCodes status;
+
+				if (nCellVol != nCellLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				euc::EuclideanPoint<T,3> center;
+
+				for(I i = 0; i < nCellLabels; i++) {
+					status = this->computeCellGeometry(cellLabels[i], &(cellVol[i]), &center);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getCellCenter(euc::EuclideanPoint<T,3> * cellCenter, I nCellCenter, L * cellLabels, I nCellLabels) {
+				cupcfd::error::eCodes status;
+
+				if (nCellCenter != nCellLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				T volume;
+
+				for(I i = 0; i < nCellLabels; i++) {
+					status = this->computeCellGeometry(cellLabels[i], &volume, &(cellCenter[i]));
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getCellFaceLabels(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData, L * cellLabels, I nCellLabels) {
+				cupcfd::error::eCodes status;
+
+				// Error Checks: Array sizes need to be correct for CSR
+				if (nCsrIndices != (nCellLabels+1)) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				L faceLabels[6];
+				I nFaces;
+				I csrDataPtr = 0;
+
+				for(I i = 0; i < nCellLabels; i++) {
+					status = this->getCellFaces(cellLabels[i], faceLabels, &nFaces);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+
+					if(csrDataPtr + nFaces > nCsrData) {
+						return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+					}
+
+					csrIndices[i] = csrDataPtr;
+
+					for(I j = 0; j < nFaces; j++) {
+						csrData[csrDataPtr + j] = faceLabels[j];
+					}
+
+					csrDataPtr = csrDataPtr + nFaces;
+				}
+
+				if(csrDataPtr != nCsrData) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				csrIndices[nCellLabels] = csrDataPtr;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getFaceIsBoundary(bool * isBoundary, I nIsBoundary, L * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if (nIsBoundary != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				L vertexLabels[4];
+				I nVertices;
+				L cell1, cell2;
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					status = this->getFace(faceLabels[i], vertexLabels, &nVertices, &cell1, &cell2);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+
+					isBoundary[i] = (cell2 == L(-1));
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getFaceNVertices(I * nVertices, I nNVertices, L * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if (nNVertices != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				L vertexLabels[4];
+				L cell1, cell2;
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					status = this->getFace(faceLabels[i], vertexLabels, &(nVertices[i]), &cell1, &cell2);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getFaceBoundaryLabels(L * faceBoundaryLabels, I nFaceBoundaryLabels, L * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if (nFaceBoundaryLabels != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				std::vector<bool> isBoundary(nFaceLabels);
+				L vertexLabels[4];
+				I nVertices;
+				L cell1, cell2;
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					status = this->getFace(faceLabels[i], vertexLabels, &nVertices, &cell1, &cell2);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+
+					// Error Check: Check they are all boundary faces
+					if(cell2 != L(-1)) {
+						return cupcfd::error::E_ERROR;
+					}
+
+					// The boundary label is the face label
+					faceBoundaryLabels[i] = faceLabels[i];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getFaceCell1Labels(L * faceCell1Labels, I nFaceCell1Labels, L * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if (nFaceCell1Labels != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				L vertexLabels[4];
+				I nVertices;
+				L cell2;
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					status = this->getFace(faceLabels[i], vertexLabels, &nVertices, &(faceCell1Labels[i]), &cell2);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getFaceCell2Labels(L * faceCell2Labels, I nFaceCell2Labels, L * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if (nFaceCell2Labels != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				L vertexLabels[4];
+				I nVertices;
+				L cell1;
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					status = this->getFace(faceLabels[i], vertexLabels, &nVertices, &cell1, &(faceCell2Labels[i]));
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getFaceLambda(T * faceLambda, I nFaceLambda, L * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if (nFaceLambda != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				L vertexLabels[4];
+				I nVertices;
+				L cell1, cell2;
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					status = this->getFace(faceLabels[i], vertexLabels, &nVertices, &cell1, &cell2);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+
+					if(cell2 == L(-1)) {
+						faceLambda[i] = T(-1);
+						continue;
+					}
+
+					// The fraction of the distance along the normal from the center of cell 1 to the center of
+					// cell 2 at which the face lies
+					T area, volume;
+					euc::EuclideanVector<T,3> normal;
+					euc::EuclideanPoint<T,3> faceCenter, center1, center2;
+
+					status = this->computeFaceGeometry(faceLabels[i], &area, &normal, &faceCenter);
+					CHECK_ECODE(status)
+
+					status = this->computeCellGeometry(cell1, &volume, &center1);
+					CHECK_ECODE(status)
+
+					status = this->computeCellGeometry(cell2, &volume, &center2);
+					CHECK_ECODE(status)
+
+					T dP = normal.dotProduct(center1 - faceCenter);
+					T dN = normal.dotProduct(center2 - faceCenter);
+					T d = dN - dP;
+
+					faceLambda[i] = (d > T(0)) ? -dP / d : T(0.5);
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getFaceArea(T * faceArea, I nFaceArea, L * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if (nFaceArea != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				euc::EuclideanVector<T,3> normal;
+				euc::EuclideanPoint<T,3> center;
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					status = this->computeFaceGeometry(faceLabels[i], &(faceArea[i]), &normal, &center);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getFaceNormal(euc::EuclideanVector<T,3> * faceNormal, I nFaceNormal, L * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if (nFaceNormal != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				T area;
+				euc::EuclideanPoint<T,3> center;
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					status = this->computeFaceGeometry(faceLabels[i], &area, &(faceNormal[i]), &center);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getFaceCenter(euc::EuclideanPoint<T,3> * faceCenter, I nFaceCenter, L * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if (nFaceCenter != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				T area;
+				euc::EuclideanVector<T,3> normal;
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					status = this->computeFaceGeometry(faceLabels[i], &area, &normal, &(faceCenter[i]));
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getFaceVerticesLabelsCSR(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData,  L * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				// Error Checks: Array Sizes
+				if(nCsrIndices != nFaceLabels + 1) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				L vertexLabels[4];
+				I nVertices;
+				L cell1, cell2;
+				I csrDataPtr = 0;
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					status = this->getFace(faceLabels[i], vertexLabels, &nVertices, &cell1, &cell2);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+
+					if(csrDataPtr + nVertices > nCsrData) {
+						return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+					}
+
+					csrIndices[i] = csrDataPtr;
+
+					for(I j = 0; j < nVertices; j++) {
+						csrData[csrDataPtr + j] = vertexLabels[j];
+					}
+
+					csrDataPtr = csrDataPtr + nVertices;
+				}
+
+				if(csrDataPtr != nCsrData) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				csrIndices[nFaceLabels] = csrDataPtr;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getVertexCoords(euc::EuclideanPoint<T,3> * vertCoords, I nVertCoords, L * vertexLabels, I nVertexLabels) {
+				if(nVertCoords != nVertexLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				I nBlocks = this->nX * this->nY * this->nZ;
+
+				for(I i = 0; i < nVertexLabels; i++) {
+					if(vertexLabels[i] < 0 || vertexLabels[i] >= L(this->nGridVertices) + L(nBlocks)) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+
+					vertCoords[i] = this->getVertexPos(vertexLabels[i]);
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getBoundaryFaceLabels(L * boundaryFaceLabels, I nBoundaryFaceLabels, L * boundaryLabels, I nBoundaryLabels) {
+				if(nBoundaryFaceLabels != nBoundaryLabels) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				// The boundary label is the face label
+				for(I i = 0; i < nBoundaryLabels; i++) {
+					boundaryFaceLabels[i] = boundaryLabels[i];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getBoundaryNVertices(I * nVertices, I nNVertices, L * boundaryLabels, I nBoundaryLabels) {
+				// The boundary label is the face label
+				return this->getFaceNVertices(nVertices, nNVertices, boundaryLabels, nBoundaryLabels);
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getBoundaryRegionLabels(L * boundaryRegionLabels, I nBoundaryRegionLabels __attribute__((unused)), L * boundaryLabels __attribute__((unused)), I nBoundaryLabels) {
+				// Only one region for now.
+				for(I i = 0; i < nBoundaryLabels; i++) {
+					boundaryRegionLabels[i] = 0;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getBoundaryVerticesLabelsCSR(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData,  L * boundaryLabels, I nBoundaryLabels) {
+				// The boundary label is the face label
+				return this->getFaceVerticesLabelsCSR(csrIndices, nCsrIndices, csrData, nCsrData, boundaryLabels, nBoundaryLabels);
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getBoundaryDistance(T * boundaryDistance, I nBoundaryDistance, L * boundaryLabels __attribute__((unused)), I nBoundaryLabels __attribute__((unused)))
+			{
+				// As for MeshStructGenSource, there are no wall regions yet, so zero the distances
+				for (I i=0; i<nBoundaryDistance; i++) {
+					boundaryDistance[i] = T(0.0);
+				}
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshMixedGenSource<I,T,L>::getRegionName(std::string * names, I nNames __attribute__((unused)), L * regionLabels __attribute__((unused)), I nRegionLabels)
+			{
+				// Always return "Default" for now.
+				for(I i = 0; i < nRegionLabels; i++) {
+					names[i] = "Default";
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+		} // namespace mesh
+	} // namespace geometry
+} // namespace cupcfd
+
+// Explicit Instantiation
+template class cupcfd::geometry::mesh::MeshMixedGenSource<int, float, int>;
+template class cupcfd::geometry::mesh::MeshMixedGenSource<int, double, int>;
+
+template class cupcfd::geometry::mesh::MeshMixedGenSource<int, float, long>;
+template class cupcfd::geometry::mesh::MeshMixedGenSource<int, double, long>;
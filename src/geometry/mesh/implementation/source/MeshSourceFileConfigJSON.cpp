@@ -20,8 +20,8 @@ namespace cupcfd
 	{
 		namespace mesh
 		{
-			template <class I, class T>
-			MeshSourceFileConfigJSON<I,T>::MeshSourceFileConfigJSON(std::string configFilePath, std::string * topLevel, int nTopLevel) {
+			template <class I, class T, class L>
+			MeshSourceFileConfigJSON<I,T,L>::MeshSourceFileConfigJSON(std::string configFilePath, std::string * topLevel, int nTopLevel) {
 				// Copy the top level strings
 				for(int i = 0; i < nTopLevel; i++) {
 					this->topLevel.push_back(topLevel[i]);
@@ -37,31 +37,31 @@ namespace cupcfd
 				}
 			}
 
-			template <class I, class T>
-			MeshSourceFileConfigJSON<I,T>::MeshSourceFileConfigJSON(MeshSourceFileConfigJSON<I,T>& source)
+			template <class I, class T, class L>
+			MeshSourceFileConfigJSON<I,T,L>::MeshSourceFileConfigJSON(MeshSourceFileConfigJSON<I,T,L>& source)
 			{
 				*this = source;
 			}
 
-			template <class I, class T>
-			MeshSourceFileConfigJSON<I,T>::~MeshSourceFileConfigJSON()
+			template <class I, class T, class L>
+			MeshSourceFileConfigJSON<I,T,L>::~MeshSourceFileConfigJSON()
 			{
 
 			}
 
-			template <class I, class T>
-			void MeshSourceFileConfigJSON<I,T>::operator=(MeshSourceFileConfigJSON<I,T>& source) {
+			template <class I, class T, class L>
+			void MeshSourceFileConfigJSON<I,T,L>::operator=(MeshSourceFileConfigJSON<I,T,L>& source) {
 				this->topLevel = source.topLevel;
 				this->configData = source.configData;
 			}
 
-			template <class I, class T>
-			MeshSourceFileConfigJSON<I,T> * MeshSourceFileConfigJSON<I,T>::clone() {
-				return new MeshSourceFileConfigJSON<I,T>(*this);
+			template <class I, class T, class L>
+			MeshSourceFileConfigJSON<I,T,L> * MeshSourceFileConfigJSON<I,T,L>::clone() {
+				return new MeshSourceFileConfigJSON<I,T,L>(*this);
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceFileConfigJSON<I,T>::getFileFormat(MeshFileFormat * fileFormat) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceFileConfigJSON<I,T,L>::getFileFormat(MeshFileFormat * fileFormat) {
 				const Json::Value dataSourceType = this->configData["FileFormat"];
 
 				if(dataSourceType == Json::Value::null) {
@@ -76,8 +76,8 @@ namespace cupcfd
 				return cupcfd::error::E_CONFIG_INVALID_VALUE;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceFileConfigJSON<I,T>::getFilePath(std::string& sourceFilePath) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceFileConfigJSON<I,T,L>::getFilePath(std::string& sourceFilePath) {
 				const Json::Value dataSourceType = this->configData["FilePath"];
 
 				if(dataSourceType == Json::Value::null) {
@@ -92,8 +92,8 @@ namespace cupcfd
 				return cupcfd::error::E_CONFIG_INVALID_VALUE;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceFileConfigJSON<I,T>::buildMeshSourceConfig(MeshSourceConfig<I,T,I> ** meshSourceConfig) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceFileConfigJSON<I,T,L>::buildMeshSourceConfig(MeshSourceConfig<I,T,L> ** meshSourceConfig) {
 				cupcfd::error::eCodes status;
 
 				MeshFileFormat fileFormat;
@@ -109,7 +109,7 @@ namespace cupcfd
 				status = this->getFilePath(sourceFilePath);
 				CHECK_ECODE(status)
 
-				*meshSourceConfig = new MeshSourceFileConfig<I,T>(fileFormat, sourceFilePath);
+				*meshSourceConfig = new MeshSourceFileConfig<I,T,L>(fileFormat, sourceFilePath);
 
 				return cupcfd::error::E_SUCCESS;
 			}
@@ -118,5 +118,8 @@ namespace cupcfd
 }
 
 // Explicit Instantiation
-template class cupcfd::geometry::mesh::MeshSourceFileConfigJSON<int, float>;
-template class cupcfd::geometry::mesh::MeshSourceFileConfigJSON<int, double>;
+template class cupcfd::geometry::mesh::MeshSourceFileConfigJSON<int, float, int>;
+template class cupcfd::geometry::mesh::MeshSourceFileConfigJSON<int, double, int>;
+
+template class cupcfd::geometry::mesh::MeshSourceFileConfigJSON<int, float, long>;
+template class cupcfd::geometry::mesh::MeshSourceFileConfigJSON<int, double, long>;
@@ -0,0 +1,467 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the MeshSourceMixedGenConfigJSON class.
+ */
+
+#include "MeshSourceMixedGenConfigJSON.h"
+#include <fstream>
+#include "MeshSourceMixedGenConfig.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I, class T, class L>
+			MeshSourceMixedGenConfigJSON<I,T,L>::MeshSourceMixedGenConfigJSON(std::string configFilePath, std::string * topLevel, int nTopLevel) {
+				// Copy the top level strings
+				for(int i = 0; i < nTopLevel; i++) {
+					this->topLevel.push_back(topLevel[i]);
+				}
+				this->topLevel.push_back("MeshSourceMixedGen");
+
+				std::ifstream source(configFilePath, std::ifstream::binary);
+				source >> this->configData;
+				int iLimit;
+				iLimit = cupcfd::utility::drivers::safeConvertSizeT<int>(this->topLevel.size());
+				for(int i = 0; i < iLimit; i++) {
+					this->configData = this->configData[this->topLevel[i]];
+				}
+			}
+
+			template <class I, class T, class L>
+			MeshSourceMixedGenConfigJSON<I,T,L>::MeshSourceMixedGenConfigJSON(MeshSourceMixedGenConfigJSON<I,T,L>& source)
+			{
+				*this = source;
+			}
+
+			template <class I, class T, class L>
+			MeshSourceMixedGenConfigJSON<I,T,L>::~MeshSourceMixedGenConfigJSON()
+			{
+
+			}
+
+			template <class I, class T, class L>
+			void MeshSourceMixedGenConfigJSON<I,T,L>::operator=(MeshSourceMixedGenConfigJSON<I,T,L>& source) {
+				this->topLevel = source.topLevel;
+				this->configData = source.configData;
+			}
+
+			template <class I, class T, class L>
+			MeshSourceMixedGenConfigJSON<I,T,L> * MeshSourceMixedGenConfigJSON<I,T,L>::clone() {
+				return new MeshSourceMixedGenConfigJSON<I,T,L>(*this);
+			}
+
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getMeshCellSizeX(I * cellX) {
+				const Json::Value dataSourceType = this->configData["CellX"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					// ToDo: Need template type checking or specialisation to check for correct type conversion
+					// Should be reading it in as same type as I to prevent conversion errors/loss of precision
+					// Will just largest int for now and presume it converts down without loss of precision (not ideal)
+					// ToDo: Should check it is actual an integer value, else it is an invalid value
+					*cellX = I(dataSourceType.asLargestInt());
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getMeshCellSizeY(I * cellY) {
+				const Json::Value dataSourceType = this->configData["CellY"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					// ToDo: Need template type checking or specialisation to check for correct type conversion
+					// Should be reading it in as same type as I to prevent conversion errors/loss of precision
+					// Will just largest int for now and presume it converts down without loss of precision (not ideal)
+					// ToDo: Should check it is actual an integer value, else it is an invalid value
+					*cellY = I(dataSourceType.asLargestInt());
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getMeshCellSizeZ(I * cellZ) {
+				const Json::Value dataSourceType = this->configData["CellZ"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					// ToDo: Need template type checking or specialisation to check for correct type conversion
+					// Should be reading it in as same type as I to prevent conversion errors/loss of precision
+					// Will just largest int for now and presume it converts down without loss of precision (not ideal)
+					// ToDo: Should check it is actual an integer value, else it is an invalid value
+					*cellZ = I(dataSourceType.asLargestInt());
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getMeshSpatialXMin(T * sMinX) {
+				const Json::Value dataSourceType = this->configData["SpatialXMin"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					// ToDo: Need template type checking or specialisation to check for correct type conversion
+					// Should be reading it in as same type as I to prevent conversion errors/loss of precision
+					// Will just use double for now and presume it converts down OK
+					// ToDo: Should check it is actually a number and not a string
+					*sMinX = T(dataSourceType.asDouble());
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getMeshSpatialYMin(T * sMinY) {
+				const Json::Value dataSourceType = this->configData["SpatialYMin"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					// ToDo: Need template type checking or specialisation to check for correct type conversion
+					// Should be reading it in as same type as I to prevent conversion errors/loss of precision
+					// Will just use double for now and presume it converts down OK
+					// ToDo: Should check it is actually a number and not a string
+					*sMinY = T(dataSourceType.asDouble());
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getMeshSpatialZMin(T * sMinZ) {
+				const Json::Value dataSourceType = this->configData["SpatialZMin"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					// ToDo: Need template type checking or specialisation to check for correct type conversion
+					// Should be reading it in as same type as I to prevent conversion errors/loss of precision
+					// Will just use double for now and presume it converts down OK
+					// ToDo: Should check it is actually a number and not a string
+					*sMinZ = T(dataSourceType.asDouble());
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getMeshSpatialXMax(T * sMaxX) {
+				const Json::Value dataSourceType = this->configData["SpatialXMax"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					// ToDo: Need template type checking or specialisation to check for correct type conversion
+					// Should be reading it in as same type as I to prevent conversion errors/loss of precision
+					// Will just use double for now and presume it converts down OK
+					// ToDo: Should check it is actually a number and not a string
+					*sMaxX = T(dataSourceType.asDouble());
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getMeshSpatialYMax(T * sMaxY) {
+				const Json::Value dataSourceType = this->configData["SpatialYMax"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					// ToDo: Need template type checking or specialisation to check for correct type conversion
+					// Should be reading it in as same type as I to prevent conversion errors/loss of precision
+					// Will just use double for now and presume it converts down OK
+					// ToDo: Should check it is actually a number and not a string
+					*sMaxY = T(dataSourceType.asDouble());
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getMeshSpatialZMax(T * sMaxZ) {
+				const Json::Value dataSourceType = this->configData["SpatialZMax"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					// ToDo: Need template type checking or specialisation to check for correct type conversion
+					// Should be reading it in as same type as I to prevent conversion errors/loss of precision
+					// Will just use double for now and presume it converts down OK
+					// ToDo: Should check it is actually a number and not a string
+					*sMaxZ = T(dataSourceType.asDouble());
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getTetFraction(T * tetFraction) {
+				const Json::Value dataSourceType = this->configData["TetFraction"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					// ToDo: Should check it is actually a number and not a string
+					*tetFraction = T(dataSourceType.asDouble());
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getPrismFraction(T * prismFraction) {
+				const Json::Value dataSourceType = this->configData["PrismFraction"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					// ToDo: Should check it is actually a number and not a string
+					*prismFraction = T(dataSourceType.asDouble());
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getJitter(T * jitter) {
+				const Json::Value dataSourceType = this->configData["Jitter"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					// ToDo: Should check it is actually a number and not a string
+					*jitter = T(dataSourceType.asDouble());
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getShuffleCellLabels(bool * shuffleCellLabels) {
+				const Json::Value dataSourceType = this->configData["ShuffleCellLabels"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					*shuffleCellLabels = dataSourceType.asBool();
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::getSeed(uint64_t * seed) {
+				const Json::Value dataSourceType = this->configData["Seed"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					*seed = uint64_t(dataSourceType.asLargestUInt());
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceMixedGenConfigJSON<I,T,L>::buildMeshSourceConfig(MeshSourceConfig<I,T,L> ** meshSourceConfig) {
+				cupcfd::error::eCodes status;
+				I cellX, cellY, cellZ;
+				T sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ;
+				T tetFraction, prismFraction, jitter;
+				bool shuffleCellLabels;
+				uint64_t seed;
+				cupcfd::error::eCodes tetStatus, prismStatus;
+
+				// A missing or invalid option is an error of the configuration file, so it is returned to the caller
+				status = this->getMeshCellSizeX(&cellX);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				status = this->getMeshCellSizeY(&cellY);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				status = this->getMeshCellSizeZ(&cellZ);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				status = this->getMeshSpatialXMin(&sMinX);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				status = this->getMeshSpatialXMax(&sMaxX);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				status = this->getMeshSpatialYMin(&sMinY);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				status = this->getMeshSpatialYMax(&sMaxY);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				status = this->getMeshSpatialZMin(&sMinZ);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				status = this->getMeshSpatialZMax(&sMaxZ);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				// === Optional Fields ===
+				tetStatus = this->getTetFraction(&tetFraction);
+				prismStatus = this->getPrismFraction(&prismFraction);
+
+				if(tetStatus == cupcfd::error::E_CONFIG_OPT_NOT_FOUND && prismStatus == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					tetFraction = T(0.5);
+					prismFraction = T(0.5);
+				}
+				else if(tetStatus == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					if(prismStatus != cupcfd::error::E_SUCCESS) {
+						return prismStatus;
+					}
+					tetFraction = T(1) - prismFraction;
+				}
+				else if(prismStatus == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					if(tetStatus != cupcfd::error::E_SUCCESS) {
+						return tetStatus;
+					}
+					prismFraction = T(1) - tetFraction;
+				}
+				else {
+					if(tetStatus != cupcfd::error::E_SUCCESS) {
+						return tetStatus;
+					}
+					if(prismStatus != cupcfd::error::E_SUCCESS) {
+						return prismStatus;
+					}
+				}
+
+				status = this->getJitter(&jitter);
+				if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					jitter = T(0);
+				}
+				else {
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				status = this->getShuffleCellLabels(&shuffleCellLabels);
+				if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					shuffleCellLabels = false;
+				}
+				else {
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				status = this->getSeed(&seed);
+				if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					seed = 0;
+				}
+				else {
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				*meshSourceConfig = new MeshSourceMixedGenConfig<I,T,L>(cellX, cellY, cellZ, sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ,
+																		 tetFraction, prismFraction, jitter, shuffleCellLabels, seed);
+
+				return cupcfd::error::E_SUCCESS;
+			}
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::geometry::mesh::MeshSourceMixedGenConfigJSON<int, float, int>;
+template class cupcfd::geometry::mesh::MeshSourceMixedGenConfigJSON<int, double, int>;
+
+template class cupcfd::geometry::mesh::MeshSourceMixedGenConfigJSON<int, float, long>;
+template class cupcfd::geometry::mesh::MeshSourceMixedGenConfigJSON<int, double, long>;
@@ -20,8 +20,8 @@ namespace cupcfd
 	{
 		namespace mesh
 		{
-			template <class I, class T>
-			MeshSourceStructGenConfigJSON<I,T>::MeshSourceStructGenConfigJSON(std::string configFilePath, std::string * topLevel, int nTopLevel) {
+			template <class I, class T, class L>
+			MeshSourceStructGenConfigJSON<I,T,L>::MeshSourceStructGenConfigJSON(std::string configFilePath, std::string * topLevel, int nTopLevel) {
 				// Copy the top level strings
 				for(int i = 0; i < nTopLevel; i++) {
 					this->topLevel.push_back(topLevel[i]);
@@ -37,32 +37,32 @@ namespace cupcfd
 				}
 			}
 
-			template <class I, class T>
-			MeshSourceStructGenConfigJSON<I,T>::MeshSourceStructGenConfigJSON(MeshSourceStructGenConfigJSON<I,T>& source)
+			template <class I, class T, class L>
+			MeshSourceStructGenConfigJSON<I,T,L>::MeshSourceStructGenConfigJSON(MeshSourceStructGenConfigJSON<I,T,L>& source)
 			{
 				*this = source;
 			}
 
-			template <class I, class T>
-			MeshSourceStructGenConfigJSON<I,T>::~MeshSourceStructGenConfigJSON()
+			template <class I, class T, class L>
+			MeshSourceStructGenConfigJSON<I,T,L>::~MeshSourceStructGenConfigJSON()
 			{
 
 			}
 
-			template <class I, class T>
-			void MeshSourceStructGenConfigJSON<I,T>::operator=(MeshSourceStructGenConfigJSON<I,T>& source) {
+			template <class I, class T, class L>
+			void MeshSourceStructGenConfigJSON<I,T,L>::operator=(MeshSourceStructGenConfigJSON<I,T,L>& source) {
 				this->topLevel = source.topLevel;
 				this->configData = source.configData;
 			}
 
-			template <class I, class T>
-			MeshSourceStructGenConfigJSON<I,T> * MeshSourceStructGenConfigJSON<I,T>::clone() {
-				return new MeshSourceStructGenConfigJSON<I,T>(*this);
+			template <class I, class T, class L>
+			MeshSourceStructGenConfigJSON<I,T,L> * MeshSourceStructGenConfigJSON<I,T,L>::clone() {
+				return new MeshSourceStructGenConfigJSON<I,T,L>(*this);
 			}
 
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T>::getMeshCellSizeX(I * cellX) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T,L>::getMeshCellSizeX(I * cellX) {
 				const Json::Value dataSourceType = this->configData["CellX"];
 
 				if(dataSourceType == Json::Value::null) {
@@ -81,8 +81,8 @@ namespace cupcfd
 				return cupcfd::error::E_CONFIG_INVALID_VALUE;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T>::getMeshCellSizeY(I * cellY) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T,L>::getMeshCellSizeY(I * cellY) {
 				const Json::Value dataSourceType = this->configData["CellY"];
 
 				if(dataSourceType == Json::Value::null) {
@@ -101,8 +101,8 @@ namespace cupcfd
 				return cupcfd::error::E_CONFIG_INVALID_VALUE;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T>::getMeshCellSizeZ(I * cellZ) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T,L>::getMeshCellSizeZ(I * cellZ) {
 				const Json::Value dataSourceType = this->configData["CellZ"];
 
 				if(dataSourceType == Json::Value::null) {
@@ -121,8 +121,8 @@ namespace cupcfd
 				return cupcfd::error::E_CONFIG_INVALID_VALUE;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T>::getMeshSpatialXMin(T * sMinX) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T,L>::getMeshSpatialXMin(T * sMinX) {
 				const Json::Value dataSourceType = this->configData["SpatialXMin"];
 
 				if(dataSourceType == Json::Value::null) {
@@ -142,8 +142,8 @@ namespace cupcfd
 				return cupcfd::error::E_CONFIG_INVALID_VALUE;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T>::getMeshSpatialYMin(T * sMinY) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T,L>::getMeshSpatialYMin(T * sMinY) {
 				const Json::Value dataSourceType = this->configData["SpatialYMin"];
 
 				if(dataSourceType == Json::Value::null) {
@@ -163,8 +163,8 @@ namespace cupcfd
 				return cupcfd::error::E_CONFIG_INVALID_VALUE;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T>::getMeshSpatialZMin(T * sMinZ) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T,L>::getMeshSpatialZMin(T * sMinZ) {
 				const Json::Value dataSourceType = this->configData["SpatialZMin"];
 
 				if(dataSourceType == Json::Value::null) {
@@ -184,8 +184,8 @@ namespace cupcfd
 				return cupcfd::error::E_CONFIG_INVALID_VALUE;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T>::getMeshSpatialXMax(T * sMaxX) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T,L>::getMeshSpatialXMax(T * sMaxX) {
 				const Json::Value dataSourceType = this->configData["SpatialXMax"];
 
 				if(dataSourceType == Json::Value::null) {
@@ -205,8 +205,8 @@ namespace cupcfd
 				return cupcfd::error::E_CONFIG_INVALID_VALUE;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T>::getMeshSpatialYMax(T * sMaxY) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T,L>::getMeshSpatialYMax(T * sMaxY) {
 				const Json::Value dataSourceType = this->configData["SpatialYMax"];
 
 				if(dataSourceType == Json::Value::null) {
@@ -226,8 +226,8 @@ namespace cupcfd
 				return cupcfd::error::E_CONFIG_INVALID_VALUE;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T>::getMeshSpatialZMax(T * sMaxZ) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T,L>::getMeshSpatialZMax(T * sMaxZ) {
 				const Json::Value dataSourceType = this->configData["SpatialZMax"];
 
 				if(dataSourceType == Json::Value::null) {
@@ -247,8 +247,8 @@ namespace cupcfd
 				return cupcfd::error::E_CONFIG_INVALID_VALUE;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T>::buildMeshSourceConfig(MeshSourceConfig<I,T,I> ** meshSourceConfig) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T,L>::buildMeshSourceConfig(MeshSourceConfig<I,T,L> ** meshSourceConfig) {
 				cupcfd::error::eCodes status;
 				I cellX, cellY, cellZ;
 				T sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ;
@@ -280,7 +280,7 @@ namespace cupcfd
 				status = this->getMeshSpatialZMax(&sMaxZ);
 				CHECK_ECODE(status)
 
-				*meshSourceConfig = new MeshSourceStructGenConfig<I,T>(cellX, cellY, cellZ, sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ);
+				*meshSourceConfig = new MeshSourceStructGenConfig<I,T,L>(cellX, cellY, cellZ, sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ);
 
 				return cupcfd::error::E_SUCCESS;
 			}
@@ -289,5 +289,8 @@ namespace cupcfd
 }
 
 // Explicit Instantiation
-template class cupcfd::geometry::mesh::MeshSourceStructGenConfigJSON<int, float>;
-template class cupcfd::geometry::mesh::MeshSourceStructGenConfigJSON<int, double>;
+template class cupcfd::geometry::mesh::MeshSourceStructGenConfigJSON<int, float, int>;
+template class cupcfd::geometry::mesh::MeshSourceStructGenConfigJSON<int, double, int>;
+
+template class cupcfd::geometry::mesh::MeshSourceStructGenConfigJSON<int, float, long>;
+template class cupcfd::geometry::mesh::MeshSourceStructGenConfigJSON<int, double, long>;
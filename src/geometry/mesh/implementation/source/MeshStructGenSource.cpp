@@ -29,8 +29,8 @@ namespace cupcfd
 		{
 			// === Constructors/Deconstructors ===
 
-			template <class I, class T>
-			MeshStructGenSource<I,T>::MeshStructGenSource(I nX, I nY, I nZ, T sMinX, T sMaxX, T sMinY, T sMaxY, T sMinZ, T sMaxZ)
+			template <class I, class T, class L>
+			MeshStructGenSource<I,T,L>::MeshStructGenSource(I nX, I nY, I nZ, T sMinX, T sMaxX, T sMinY, T sMaxY, T sMinZ, T sMaxZ)
 			:nX(nX),
 			 nY(nY),
 			 nZ(nZ),
@@ -47,16 +47,16 @@ namespace cupcfd
 				this->dSz = (this->sMaxZ - this->sMinZ) / T(this->nZ);
 			}
 
-			template <class I, class T>
-			MeshStructGenSource<I,T>::~MeshStructGenSource()
+			template <class I, class T, class L>
+			MeshStructGenSource<I,T,L>::~MeshStructGenSource()
 			{
 
 			}
 
 			// === Concrete Methods ===
 
-			template <class I, class T>
-			I MeshStructGenSource<I,T>::calculateLabel(I xCoord, I yCoord, I zCoord, I xMin, I xMax, I yMin, I yMax, I zMin) {
+			template <class I, class T, class L>
+			I MeshStructGenSource<I,T,L>::calculateLabel(I xCoord, I yCoord, I zCoord, I xMin, I xMax, I yMin, I yMax, I zMin) {
 				// Sizes
 				I xSize = (xMax - xMin) + 1;
 				I ySize = (yMax - yMin) + 1;
@@ -69,16 +69,16 @@ namespace cupcfd
 				return xCoordZero + (yCoordZero * xSize) + (zCoordZero * (xSize * ySize));
 			}
 
-			template <class I, class T>
-			I MeshStructGenSource<I,T>::calculateXCoord(I label, I xMin, I xMax) {
+			template <class I, class T, class L>
+			I MeshStructGenSource<I,T,L>::calculateXCoord(I label, I xMin, I xMax) {
 				// Compute position in base zero, then offset to xMin base.
 				I xSize = (xMax - xMin) + 1;
 
 				return (label % xSize) + xMin;
 			}
 
-			template <class I, class T>
-			I MeshStructGenSource<I,T>::calculateYCoord(I label, I xMin, I xMax, I yMin, I yMax) {
+			template <class I, class T, class L>
+			I MeshStructGenSource<I,T,L>::calculateYCoord(I label, I xMin, I xMax, I yMin, I yMax) {
 				// Compute position in base zero, then offset to yMin base.
 				I xSize = (xMax - xMin) + 1;
 				I ySize = (yMax - yMin) + 1;
@@ -86,8 +86,8 @@ namespace cupcfd
 				return ((label / xSize) % ySize) + yMin;
 			}
 
-			template <class I, class T>
-			I MeshStructGenSource<I,T>::calculateZCoord(I label, I xMin, I xMax, I yMin, I yMax, I zMin, I zMax) {
+			template <class I, class T, class L>
+			I MeshStructGenSource<I,T,L>::calculateZCoord(I label, I xMin, I xMax, I yMin, I yMax, I zMin, I zMax) {
 				// Compute position in base zero, then offset to zMin base.
 				I xSize = (xMax - xMin) + 1;
 				I ySize = (yMax - yMin) + 1;
@@ -99,8 +99,8 @@ namespace cupcfd
 
 			// === Overloaded Inherited Virtual Methods ===
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getCellLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getCellLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
 				if (nLabels != nIndexes) {
 					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
 				}
@@ -117,8 +117,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getFaceLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getFaceLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
 				if (nLabels != nIndexes) {
 					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
 				}
@@ -150,8 +150,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getVertexLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getVertexLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
 				if (nLabels != nIndexes) {
 					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
 				}
@@ -168,8 +168,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getBoundaryLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getBoundaryLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
 				if (nLabels != nIndexes) {
 					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
 				}
@@ -187,8 +187,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getRegionLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getRegionLabels(L * labels, I nLabels, I * indexes, I nIndexes) {
 				if (nLabels != nIndexes) {
 					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
 				}
@@ -201,72 +201,72 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getCellCount(I * cellCount) {
-				*cellCount = this->nX * this->nY * this->nZ;
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getCellCount(L * cellCount) {
+				*cellCount = ((L) this->nX) * ((L) this->nY) * ((L) this->nZ);
 
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getFaceCount(I * faceCount) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getFaceCount(L * faceCount) {
 				// Number of faces in X dimension = Number of YZ plane faces = Y Cells * Z Cells * (XCells + 1)
-				I faceYZ = this->nY * this->nZ * (this->nX + 1);
-				I faceXZ = this->nX * this->nZ * (this->nY + 1);
-				I faceXY = this->nX * this->nY * (this->nZ + 1);
+				L faceYZ = ((L) this->nY) * ((L) this->nZ) * ((L) this->nX + 1);
+				L faceXZ = ((L) this->nX) * ((L) this->nZ) * ((L) this->nY + 1);
+				L faceXY = ((L) this->nX) * ((L) this->nY) * ((L) this->nZ + 1);
 
 				*faceCount = faceYZ + faceXZ + faceXY;
 
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getBoundaryCount(I * boundaryCount) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getBoundaryCount(L * boundaryCount) {
 				// Same computation as for number of faces, but only two planes in a dimension
 				// count as boundary (the wall)
-				I faceYZ = this->nY * this->nZ * 2;
-				I faceXZ = this->nX * this->nZ * 2;
-				I faceXY = this->nX * this->nY * 2;
+				L faceYZ = ((L) this->nY) * ((L) this->nZ) * 2;
+				L faceXZ = ((L) this->nX) * ((L) this->nZ) * 2;
+				L faceXY = ((L) this->nX) * ((L) this->nY) * 2;
 
 				*boundaryCount = faceYZ + faceXZ + faceXY;
 
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getRegionCount(I * regionCount) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getRegionCount(I * regionCount) {
 				// Just one region, the boundary wall
 				*regionCount = 1;
 
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getVertexCount(I * vertexCount) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getVertexCount(L * vertexCount) {
 				// Number of vertices in a dimension = number of cells + 1
-				*vertexCount = (this->nX + 1) * (this->nY + 1) * (this->nZ + 1);
+				*vertexCount = ((L) this->nX + 1) * ((L) this->nY + 1) * ((L) this->nZ + 1);
 
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getMaxFaceCount(I * maxFaceCount) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getMaxFaceCount(I * maxFaceCount) {
 				// Max Face Count capped at 6
 				*maxFaceCount = 6;
 
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getMaxVertexCount(I * maxVertexCount) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getMaxVertexCount(I * maxVertexCount) {
 				// Max Vertex Count per Face capped at 4
 				*maxVertexCount = 4;
 
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getCellNFaces(I * nFaces, I nNFaces, I * cellLabels __attribute__((unused)), I nCellLabels __attribute__((unused))) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getCellNFaces(I * nFaces, I nNFaces, L * cellLabels __attribute__((unused)), I nCellLabels __attribute__((unused))) {
 				for(I i = 0; i < nNFaces; i++) {
 					nFaces[i] = 6;
 				}
@@ -274,8 +274,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getCellVolume(T * cellVol, I nCellVol, I * cellLabels, I nCellLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getCellVolume(T * cellVol, I nCellVol, L * cellLabels, I nCellLabels) {
 				cupcfd::error::eCodes status;
 
 				// Could do this via retrieving cell faces, vertices etc. However, since this is structured we can
@@ -318,8 +318,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getCellCenter(euc::EuclideanPoint<T,3> * cellCenter, I nCellCenter, I * cellLabels, I nCellLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getCellCenter(euc::EuclideanPoint<T,3> * cellCenter, I nCellCenter, L * cellLabels, I nCellLabels) {
 				if (nCellCenter != nCellLabels) {
 					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
 				}
@@ -351,8 +351,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getCellFaceLabels(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData, I * cellLabels, I nCellLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getCellFaceLabels(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData, L * cellLabels, I nCellLabels) {
 				// Error Checks: Array sizes need to be correct for CSR
 				// nCsrIndices = nCellLabels + 1
 				if (nCsrIndices != (nCellLabels+1)) {
@@ -444,8 +444,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getFaceIsBoundary(bool * isBoundary, I nIsBoundary, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getFaceIsBoundary(bool * isBoundary, I nIsBoundary, L * faceLabels, I nFaceLabels) {
 				if (nIsBoundary != nFaceLabels) {
 					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
 				}
@@ -501,8 +501,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getFaceNVertices(I * nVertices, I nNVertices __attribute__((unused)), I * faceLabels __attribute__((unused)), I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getFaceNVertices(I * nVertices, I nNVertices __attribute__((unused)), L * faceLabels __attribute__((unused)), I nFaceLabels) {
 				// All faces in this setup have 4 vertices.
 				for(I i = 0; i < nFaceLabels; i++) {
 					nVertices[i] = 4;
@@ -511,8 +511,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getFaceBoundaryLabels(I * faceBoundaryLabels, I nFaceBoundaryLabels, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getFaceBoundaryLabels(L * faceBoundaryLabels, I nFaceBoundaryLabels, L * faceLabels, I nFaceLabels) {
 				if (nFaceBoundaryLabels != nFaceLabels) {
 					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
 				}
@@ -624,8 +624,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getFaceCell1Labels(I * faceCell1Labels, I nFaceCell1Labels, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getFaceCell1Labels(L * faceCell1Labels, I nFaceCell1Labels, L * faceLabels, I nFaceLabels) {
 				if (nFaceCell1Labels != nFaceLabels) {
 					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
 				}
@@ -722,8 +722,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getFaceCell2Labels(I * faceCell2Labels, I nFaceCell2Labels, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getFaceCell2Labels(L * faceCell2Labels, I nFaceCell2Labels, L * faceLabels, I nFaceLabels) {
 				if (nFaceCell2Labels != nFaceLabels) {
 					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
 				}
@@ -819,8 +819,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getFaceLambda(T * faceLambda, I nFaceLambda, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getFaceLambda(T * faceLambda, I nFaceLambda, L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 
 				if (nFaceLambda != nFaceLabels) {
@@ -847,8 +847,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getFaceArea(T * faceArea, I nFaceArea, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getFaceArea(T * faceArea, I nFaceArea, L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 
 				if (nFaceArea != nFaceLabels) {
@@ -857,7 +857,7 @@ namespace cupcfd
 				
 				// Retrieve the face vertex labels - since this is a structured grid, we know there should always be 4
 				I * csrIndices = (I*) malloc(sizeof(I) * nFaceLabels + 1);
-				I * csrData = (I*) malloc(sizeof(I) * nFaceLabels * 4);
+				L * csrData = (L*) malloc(sizeof(L) * nFaceLabels * 4);
 				status = this->getFaceVerticesLabelsCSR(csrIndices, nFaceLabels + 1, csrData, nFaceLabels * 4,  faceLabels, nFaceLabels);
 				CHECK_ECODE(status)
 
@@ -882,8 +882,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getFaceNormal(euc::EuclideanVector<T,3> * faceNormal, I nFaceNormal, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getFaceNormal(euc::EuclideanVector<T,3> * faceNormal, I nFaceNormal, L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 
 				if (nFaceNormal != nFaceLabels) {
@@ -892,8 +892,8 @@ namespace cupcfd
 				
 				// Temporary Storage
 				I * csrIndices = (I*) malloc(sizeof(I) * nFaceLabels + 1);
-				I * csrData = (I*) malloc(sizeof(I) * nFaceLabels * 4);
-				I * cell1Labels = (I*) malloc(sizeof(I) * nFaceLabels);
+				L * csrData = (L*) malloc(sizeof(L) * nFaceLabels * 4);
+				L * cell1Labels = (L*) malloc(sizeof(L) * nFaceLabels);
 
 				euc::EuclideanPoint<T,3> * vertexPos = (euc::EuclideanPoint<T,3> *)malloc(sizeof(euc::EuclideanPoint<T,3>) * nFaceLabels * 4);
 
@@ -942,8 +942,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getFaceCenter(euc::EuclideanPoint<T,3> * faceCenter, I nFaceCenter, I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getFaceCenter(euc::EuclideanPoint<T,3> * faceCenter, I nFaceCenter, L * faceLabels, I nFaceLabels) {
 				cupcfd::error::eCodes status;
 
 				if (nFaceCenter != nFaceLabels) {
@@ -952,7 +952,7 @@ namespace cupcfd
 				
 				// Retrieve the face vertex labels - since this is a structured grid, we know there should always be 4
 				I * csrIndices = (I*) malloc(sizeof(I) * nFaceLabels + 1);
-				I * csrData = (I*) malloc(sizeof(I) * nFaceLabels * 4);
+				L * csrData = (L*) malloc(sizeof(L) * nFaceLabels * 4);
 				status = this->getFaceVerticesLabelsCSR(csrIndices, nFaceLabels + 1, csrData, nFaceLabels * 4,  faceLabels, nFaceLabels);
 				CHECK_ECODE(status)
 
@@ -975,8 +975,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getFaceVerticesLabelsCSR(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData,  I * faceLabels, I nFaceLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getFaceVerticesLabelsCSR(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData,  L * faceLabels, I nFaceLabels) {
 				// Error Checks: Array Sizes
 				// nCsrIndices = nFaceLabels + 1
 				if(nCsrIndices != nFaceLabels + 1) {
@@ -1081,8 +1081,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getVertexCoords(euc::EuclideanPoint<T,3> * vertCoords, I nVertCoords, I * vertexLabels, I nVertexLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getVertexCoords(euc::EuclideanPoint<T,3> * vertCoords, I nVertCoords, L * vertexLabels, I nVertexLabels) {
 				if(nVertCoords != nVertexLabels) {
 					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
 				}
@@ -1109,8 +1109,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getBoundaryFaceLabels(I * boundaryFaceLabels, I nBoundaryFaceLabels, I * boundaryLabels, I nBoundaryLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getBoundaryFaceLabels(L * boundaryFaceLabels, I nBoundaryFaceLabels, L * boundaryLabels, I nBoundaryLabels) {
 				if(nBoundaryFaceLabels != nBoundaryLabels) {
 					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
 				}
@@ -1203,8 +1203,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getBoundaryNVertices(I * nVertices, I nNVertices __attribute__((unused)), I * boundaryLabels __attribute__((unused)), I nBoundaryLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getBoundaryNVertices(I * nVertices, I nNVertices __attribute__((unused)), L * boundaryLabels __attribute__((unused)), I nBoundaryLabels) {
 				// All boundaries in this setup have 4 vertices.
 				for(I i = 0; i < nBoundaryLabels; i++) {
 					nVertices[i] = 4;
@@ -1213,8 +1213,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getBoundaryRegionLabels(I * boundaryRegionLabels, I nBoundaryRegionLabels __attribute__((unused)), I * boundaryLabels __attribute__((unused)), I nBoundaryLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getBoundaryRegionLabels(L * boundaryRegionLabels, I nBoundaryRegionLabels __attribute__((unused)), L * boundaryLabels __attribute__((unused)), I nBoundaryLabels) {
 				// Only one region for now.
 				for(I i = 0; i < nBoundaryLabels; i++) {
 					boundaryRegionLabels[i] = 0;
@@ -1223,8 +1223,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getBoundaryVerticesLabelsCSR(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData,  I * boundaryLabels, I nBoundaryLabels) {
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getBoundaryVerticesLabelsCSR(I * csrIndices, I nCsrIndices, L * csrData, I nCsrData,  L * boundaryLabels, I nBoundaryLabels) {
 				// === Passthrough to the face vertex lookup. ===
 				// We can reuse the face lookup method.
 				// This does use a little more memory, since we have to temporarily
@@ -1232,7 +1232,7 @@ namespace cupcfd
 				cupcfd::error::eCodes status;
 
 				// Get the face labels for the boundaries
-				I * faceLabels = (I *) malloc(sizeof(I) * nBoundaryLabels);
+				L * faceLabels = (L *) malloc(sizeof(L) * nBoundaryLabels);
 
 				status = this->getBoundaryFaceLabels(faceLabels, nBoundaryLabels, boundaryLabels, nBoundaryLabels);
 				CHECK_ECODE(status)
@@ -1246,8 +1246,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getBoundaryDistance(T * boundaryDistance, I nBoundaryDistance, I * boundaryLabels __attribute__((unused)), I nBoundaryLabels __attribute__((unused)))
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getBoundaryDistance(T * boundaryDistance, I nBoundaryDistance, L * boundaryLabels __attribute__((unused)), I nBoundaryLabels __attribute__((unused)))
 			{
 				// ToDo: once more region types are added (e.g. for 'wall'), can replace loop with sensible distances.
 				//       Until then, just zero the distances array.
@@ -1257,8 +1257,8 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			template <class I, class T>
-			cupcfd::error::eCodes MeshStructGenSource<I,T>::getRegionName(std::string * names, I nNames __attribute__((unused)), I * regionLabels __attribute__((unused)), I nRegionLabels)
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshStructGenSource<I,T,L>::getRegionName(std::string * names, I nNames __attribute__((unused)), L * regionLabels __attribute__((unused)), I nRegionLabels)
 			{
 				// Always return "Default" for now.
 				for(I i = 0; i < nRegionLabels; i++) {
@@ -1272,5 +1272,8 @@ namespace cupcfd
 } // namespace cupcfd
 
 // Explicit Instantiation
-template class cupcfd::geometry::mesh::MeshStructGenSource<int, float>;
-template class cupcfd::geometry::mesh::MeshStructGenSource<int, double>;
+template class cupcfd::geometry::mesh::MeshStructGenSource<int, float, int>;
+template class cupcfd::geometry::mesh::MeshStructGenSource<int, double, int>;
+
+template class cupcfd::geometry::mesh::MeshStructGenSource<int, float, long>;
+template class cupcfd::geometry::mesh::MeshStructGenSource<int, double, long>;
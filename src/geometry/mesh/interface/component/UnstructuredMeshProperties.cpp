@@ -17,17 +17,17 @@ namespace cupcfd
 	{
 		namespace mesh
 		{
-			template <class I, class T>
-			UnstructuredMeshProperties<I, T>::UnstructuredMeshProperties()
+			template <class I, class T, class L>
+			UnstructuredMeshProperties<I,T,L>::UnstructuredMeshProperties()
 			{
 				// Pass through to the reset function
 				this->reset();
 			}
 
-			template <class I, class T>
-			UnstructuredMeshProperties<I, T>::UnstructuredMeshProperties(
-						   I nCells, I nFaces, I nVertices, I nBoundaries,
-						   I nRegions, I nMaxFaces, T scaleFactor,
+			template <class I, class T, class L>
+			UnstructuredMeshProperties<I,T,L>::UnstructuredMeshProperties(
+						   L nCells, L nFaces, L nVertices, L nBoundaries,
+						   L nRegions, I nMaxFaces, T scaleFactor,
 						   I lOCells, I lGhCells, I lTCells, I lFaces,
 						   I lVertices, I lBoundaries, I lRegions)
 			{
@@ -46,28 +46,31 @@ namespace cupcfd
 				this->lVertices = lVertices;
 				this->lBoundaries = lBoundaries;
 				this->lRegions = lRegions;
+
+				this->haloDepth = (I) 1;
+				this->cellType = shapes::POLYHEDRON_UNKNOWN;
 			}
 
-			template <class I, class T>
-			UnstructuredMeshProperties<I, T>::UnstructuredMeshProperties(UnstructuredMeshProperties<I,T>& source)
+			template <class I, class T, class L>
+			UnstructuredMeshProperties<I,T,L>::UnstructuredMeshProperties(UnstructuredMeshProperties<I,T,L>& source)
 			{
 				// Pass-through to copy operator
 				*this = source;
 			}
 
-			template <class I, class T>
-			UnstructuredMeshProperties<I, T>::~UnstructuredMeshProperties()
+			template <class I, class T, class L>
+			UnstructuredMeshProperties<I,T,L>::~UnstructuredMeshProperties()
 			{
 				// Currently does nothing.
 			}
 
-			template <class I, class T>
-			void UnstructuredMeshProperties<I, T>::reset() {
-				this->nCells = (I) 0;
-				this->nFaces = (I) 0;
-				this->nVertices = (I) 0;
-				this->nBoundaries = (I) 0;
-				this->nRegions = (I) 0;
+			template <class I, class T, class L>
+			void UnstructuredMeshProperties<I,T,L>::reset() {
+				this->nCells = (L) 0;
+				this->nFaces = (L) 0;
+				this->nVertices = (L) 0;
+				this->nBoundaries = (L) 0;
+				this->nRegions = (L) 0;
 				this->nMaxFaces = (I) 0;
 				this->scaleFactor = (T) 0;
 
@@ -78,10 +81,13 @@ namespace cupcfd
 				this->lVertices = (I) 0;
 				this->lBoundaries = (I) 0;
 				this->lRegions = (I) 0;
+
+				this->haloDepth = (I) 1;
+				this->cellType = shapes::POLYHEDRON_UNKNOWN;
 			}
 
-			template <class I, class T>
-			void UnstructuredMeshProperties<I,T>::operator=(UnstructuredMeshProperties<I,T>& source) {
+			template <class I, class T, class L>
+			void UnstructuredMeshProperties<I,T,L>::operator=(UnstructuredMeshProperties<I,T,L>& source) {
 				// No need for reset, since everything is overwritten.
 
 				this->nCells = source.nCells;
@@ -99,19 +105,25 @@ namespace cupcfd
 				this->lVertices = source.lVertices;
 				this->lBoundaries = source.lBoundaries;
 				this->lRegions = source.lRegions;
+
+				this->haloDepth = source.haloDepth;
+				this->cellType = source.cellType;
 			}
 
-			template <class I, class T>
-			UnstructuredMeshProperties<I,T> * UnstructuredMeshProperties<I,T>::clone() {
-				return new UnstructuredMeshProperties<I,T>(*this);
+			template <class I, class T, class L>
+			UnstructuredMeshProperties<I,T,L> * UnstructuredMeshProperties<I,T,L>::clone() {
+				return new UnstructuredMeshProperties<I,T,L>(*this);
 			}
 		}
 	}
 }
 
 // Explicit Instantiation
-template class cupcfd::geometry::mesh::UnstructuredMeshProperties<int, float>;
-template class cupcfd::geometry::mesh::UnstructuredMeshProperties<int, double>;
+template class cupcfd::geometry::mesh::UnstructuredMeshProperties<int, float, int>;
+template class cupcfd::geometry::mesh::UnstructuredMeshProperties<int, double, int>;
+
+template class cupcfd::geometry::mesh::UnstructuredMeshProperties<int, float, long>;
+template class cupcfd::geometry::mesh::UnstructuredMeshProperties<int, double, long>;
 
-template class cupcfd::geometry::mesh::UnstructuredMeshProperties<long, float>;
-template class cupcfd::geometry::mesh::UnstructuredMeshProperties<long, double>;
+template class cupcfd::geometry::mesh::UnstructuredMeshProperties<long, float, long>;
+template class cupcfd::geometry::mesh::UnstructuredMeshProperties<long, double, long>;
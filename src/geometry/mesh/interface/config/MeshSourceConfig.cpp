@@ -45,5 +45,8 @@ namespace cupcfd
 template class cupcfd::geometry::mesh::MeshSourceConfig<int, float, int>;
 template class cupcfd::geometry::mesh::MeshSourceConfig<int, double, int>;
 
+template class cupcfd::geometry::mesh::MeshSourceConfig<int, float, long>;
+template class cupcfd::geometry::mesh::MeshSourceConfig<int, double, long>;
+
 template class cupcfd::geometry::mesh::MeshSourceConfig<long, float, int>;
 template class cupcfd::geometry::mesh::MeshSourceConfig<long, double, int>;
@@ -230,3 +230,6 @@ namespace cupcfd
 // Explicit Instantiation
 template class cupcfd::geometry::mesh::MeshSource<int, float, int>;
 template class cupcfd::geometry::mesh::MeshSource<int, double, int>;
+
+template class cupcfd::geometry::mesh::MeshSource<int, float, long>;
+template class cupcfd::geometry::mesh::MeshSource<int, double, long>;
@@ -42,3 +42,6 @@ namespace cupcfd
 // Explicit Instantiation
 template class cupcfd::geometry::mesh::MeshSourceConfigSource<int, float, int>;
 template class cupcfd::geometry::mesh::MeshSourceConfigSource<int, double, int>;
+
+template class cupcfd::geometry::mesh::MeshSourceConfigSource<int, float, long>;
+template class cupcfd::geometry::mesh::MeshSourceConfigSource<int, double, long>;
@@ -0,0 +1,185 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Definitions for the GeneralPolyhedron class
+ *
+ */
+
+#include "GeneralPolyhedron.h"
+
+#include <cmath>
+#include <limits>
+
+namespace euc = cupcfd::geometry::euclidean;
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace shapes
+		{
+			// === Constructors/Deconstructors ===
+
+			template <class T>
+			GeneralPolyhedron<T>::GeneralPolyhedron(const euc::EuclideanPoint<T,3> * facePoints, const int * faceXAdj, int nFaces)
+			: facePoints(facePoints + faceXAdj[0], facePoints + faceXAdj[nFaces]),
+			  faceXAdj(faceXAdj, faceXAdj + nFaces + 1)
+			{
+				// Rebase the offsets to the copied points
+				for(int i = nFaces; i >= 0; i--) {
+					this->faceXAdj[i] = this->faceXAdj[i] - this->faceXAdj[0];
+				}
+			}
+
+			template <class T>
+			GeneralPolyhedron<T>::~GeneralPolyhedron() {
+			}
+
+			// === Concrete Methods ===
+
+			template <class T>
+			T GeneralPolyhedron<T>::getVolume() {
+				if (!this->volumeComputed) {
+					this->volume = this->computeVolume();
+					this->volumeComputed = true;
+				}
+				return this->volume;
+			}
+
+			template <class T>
+			euc::EuclideanPoint<T,3> GeneralPolyhedron<T>::getCentroid() {
+				if (!this->centroidComputed) {
+					this->centroid = this->computeCentroid();
+					this->centroidComputed = true;
+				}
+				return this->centroid;
+			}
+
+			template <class T>
+			euc::EuclideanPoint<T,3> GeneralPolyhedron<T>::computeVertexAverage() {
+				euc::EuclideanPoint<T,3> average(T(0), T(0), T(0));
+				int nPoints = (int) this->facePoints.size();
+
+				for(int i = 0; i < nPoints; i++) {
+					average = average + this->facePoints[i];
+				}
+
+				return average / T(nPoints);
+			}
+
+			template <class T>
+			T GeneralPolyhedron<T>::computeVolume() {
+				euc::EuclideanPoint<T,3> apex = this->computeVertexAverage();
+				T volume = T(0);
+
+				for(int f = 0; f < this->getNFaces(); f++) {
+					const euc::EuclideanPoint<T,3> * points = this->facePoints.data() + this->faceXAdj[f];
+					int nPoints = this->getFaceNVertices(f);
+					euc::EuclideanPoint<T,3> faceCentroid = computePolygonCentroid(points, nPoints);
+
+					// Sum the signed volumes of the tetrahedrons between the apex and each edge of the face.
+					// The sign only depends on the orientation of the face, so take the magnitude per face.
+					T faceVolume = T(0);
+					for(int i1 = 0; i1 < nPoints; i1++) {
+						const int i2 = (i1+1)%nPoints;
+						euc::EuclideanVector3D<T> a = points[i1] - apex;
+						euc::EuclideanVector3D<T> b = points[i2] - apex;
+						euc::EuclideanVector3D<T> c = faceCentroid - apex;
+						faceVolume += a.dotProduct(b.crossProduct(c));
+					}
+
+					volume += std::abs(faceVolume) / T(6);
+				}
+
+				return volume;
+			}
+
+			template <class T>
+			euc::EuclideanPoint<T,3> GeneralPolyhedron<T>::computeCentroid() {
+				// Volume-weighted average of the centroids of the tetrahedron decomposition
+				euc::EuclideanPoint<T,3> apex = this->computeVertexAverage();
+				euc::EuclideanPoint<T,3> centroid(T(0), T(0), T(0));
+				T volume = T(0);
+
+				for(int f = 0; f < this->getNFaces(); f++) {
+					const euc::EuclideanPoint<T,3> * points = this->facePoints.data() + this->faceXAdj[f];
+					int nPoints = this->getFaceNVertices(f);
+					euc::EuclideanPoint<T,3> faceCentroid = computePolygonCentroid(points, nPoints);
+
+					euc::EuclideanPoint<T,3> faceMoment(T(0), T(0), T(0));
+					T faceVolume = T(0);
+					for(int i1 = 0; i1 < nPoints; i1++) {
+						const int i2 = (i1+1)%nPoints;
+						euc::EuclideanVector3D<T> a = points[i1] - apex;
+						euc::EuclideanVector3D<T> b = points[i2] - apex;
+						euc::EuclideanVector3D<T> c = faceCentroid - apex;
+						T tetVolume = a.dotProduct(b.crossProduct(c)) / T(6);
+						euc::EuclideanPoint<T,3> tetCentroid = (apex + points[i1] + points[i2] + faceCentroid) / T(4);
+
+						faceMoment = faceMoment + (tetCentroid * tetVolume);
+						faceVolume += tetVolume;
+					}
+
+					// Orient the contributions of each face consistently
+					if(faceVolume < T(0)) {
+						faceMoment = faceMoment * T(-1);
+						faceVolume = -faceVolume;
+					}
+
+					centroid = centroid + faceMoment;
+					volume += faceVolume;
+				}
+
+				return centroid / volume;
+			}
+
+			template <class T>
+			bool GeneralPolyhedron<T>::isPointInside(const euc::EuclideanPoint<T,3>& point) {
+				// Algorithm: For each face, orient the face normal to point away from the interior,
+				// and test which side of the face plane the point lies on. The point is inside
+				// if it is not in front of any face. Points within a small tolerance of a face plane
+				// count as inside.
+
+				euc::EuclideanPoint<T,3> apex = this->computeVertexAverage();
+
+				// Scale the tolerance by the size of the polyhedron
+				T size = T(0);
+				int nPoints = (int) this->facePoints.size();
+				for(int i = 0; i < nPoints; i++) {
+					euc::EuclideanVector<T,3> r = this->facePoints[i] - apex;
+					size = std::max(size, (T) r.length());
+				}
+				T tolerance = size * std::sqrt(std::numeric_limits<T>::epsilon());
+
+				for(int f = 0; f < this->getNFaces(); f++) {
+					const euc::EuclideanPoint<T,3> * points = this->facePoints.data() + this->faceXAdj[f];
+					int nFacePoints = this->getFaceNVertices(f);
+					euc::EuclideanPoint<T,3> faceCentroid = computePolygonCentroid(points, nFacePoints);
+					euc::EuclideanVector3D<T> normal = computePolygonNormal(points, nFacePoints);
+
+					euc::EuclideanVector<T,3> outward = faceCentroid - apex;
+					if(normal.dotProduct(outward) < T(0)) {
+						normal = normal * T(-1);
+					}
+
+					euc::EuclideanVector<T,3> pointVector = point - faceCentroid;
+					if(normal.dotProduct(pointVector) > tolerance) {
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			// Explicit Instantiation
+			template class GeneralPolyhedron<float>;
+			template class GeneralPolyhedron<double>;
+		}
+	}
+}
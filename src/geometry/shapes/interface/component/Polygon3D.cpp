@@ -118,6 +118,66 @@ namespace cupcfd
 				return false;
 			}
 
+			template <class T>
+			T computePolygonArea(const euc::EuclideanPoint<T,3> * points, int nPoints) {
+				if (nPoints < 3) {
+					throw(std::runtime_error("Polygon3D::computePolygonArea() called with < 3 points"));
+				}
+
+				T area = T(0);
+				for (int i2=2; i2<nPoints; i2++) {
+					const int i1 = i2-1;
+					Triangle3D<T> tri(points[0], points[i1], points[i2]);
+					area += tri.getArea();
+				}
+				return area;
+			}
+
+			template <class T>
+			euc::EuclideanPoint<T,3> computePolygonCentroid(const euc::EuclideanPoint<T,3> * points, int nPoints) {
+				if (nPoints < 3) {
+					throw(std::runtime_error("Polygon3D::computePolygonCentroid() called with < 3 points"));
+				}
+
+				// Polygon centroid is area-weighted average of triangles centroids:
+				euc::EuclideanPoint<T,3> centroid(T(0), T(0), T(0));
+				T area = T(0);
+				for (int i2=2; i2<nPoints; i2++) {
+					const int i1 = i2-1;
+					Triangle3D<T> tri(points[0], points[i1], points[i2]);
+					T triArea = tri.getArea();
+					centroid = centroid + (tri.getCentroid() * triArea);
+					area += triArea;
+				}
+				centroid = centroid / area;
+
+				return centroid;
+			}
+
+			template <class T>
+			euc::EuclideanVector3D<T> computePolygonNormal(const euc::EuclideanPoint<T,3> * points, int nPoints) {
+				if (nPoints < 3) {
+					throw(std::runtime_error("Polygon3D::computePolygonNormal() called with < 3 points"));
+				}
+
+				// Newell's method - sum the cross products of each edge's end points
+				T nx = T(0);
+				T ny = T(0);
+				T nz = T(0);
+				for (int i1=0; i1<nPoints; i1++) {
+					const int i2 = (i1+1)%nPoints;
+					const euc::EuclideanPoint<T,3>& a = points[i1];
+					const euc::EuclideanPoint<T,3>& b = points[i2];
+					nx += (a.cmp[1] - b.cmp[1]) * (a.cmp[2] + b.cmp[2]);
+					ny += (a.cmp[2] - b.cmp[2]) * (a.cmp[0] + b.cmp[0]);
+					nz += (a.cmp[0] - b.cmp[0]) * (a.cmp[1] + b.cmp[1]);
+				}
+
+				euc::EuclideanVector3D<T> normal(nx, ny, nz);
+				normal.normalise();
+				return normal;
+			}
+
 			// Explicit Instantiation
 			template class Polygon3D<float, 4>;
 			template class Polygon3D<double, 4>;
@@ -127,6 +187,15 @@ namespace cupcfd
 			template bool isVertexOrderClockwise(const euc::EuclideanPoint<double,3>&, euc::EuclideanPoint<double,3>*, int);
 			template bool isVertexOrderClockwise(const euc::EuclideanPoint<float,3>&, euc::EuclideanPoint<float,3>*, int);
 
+			template double computePolygonArea(const euc::EuclideanPoint<double,3>*, int);
+			template float computePolygonArea(const euc::EuclideanPoint<float,3>*, int);
+
+			template euc::EuclideanPoint<double,3> computePolygonCentroid(const euc::EuclideanPoint<double,3>*, int);
+			template euc::EuclideanPoint<float,3> computePolygonCentroid(const euc::EuclideanPoint<float,3>*, int);
+
+			template euc::EuclideanVector3D<double> computePolygonNormal(const euc::EuclideanPoint<double,3>*, int);
+			template euc::EuclideanVector3D<float> computePolygonNormal(const euc::EuclideanPoint<float,3>*, int);
+
 		}
 	}
 }
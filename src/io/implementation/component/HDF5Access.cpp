@@ -24,12 +24,14 @@ namespace cupcfd
 			HDF5Access::HDF5Access(std::string fileName, HDF5Record& record)
 			 : record(record)
 			{
-				this->fileID = 0;
-				this->groupID = 0;
-				this->datasetID = 0;
-				this->dataspaceID = 0;
-				this->memspaceID = 0;
-				this->attrID = 0;
+				// Nothing is open yet - HDF5 identifiers are only valid if they are not negative,
+				// and any that are already open are closed again before being reopened
+				this->fileID = -1;
+				this->groupID = -1;
+				this->datasetID = -1;
+				this->dataspaceID = -1;
+				this->memspaceID = -1;
+				this->attrID = -1;
 
 				this->fileName = fileName;
 
@@ -125,6 +127,27 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			cupcfd::error::eCodes HDF5Access::readData(long * sink) {
+				hid_t err;
+
+				if(this->record.attr == false) {
+					// Begin Data Read into arrays
+					err = H5Dread(this->datasetID, H5T_NATIVE_LONG, H5S_ALL,
+								  this->dataspaceID, H5P_DEFAULT, sink);
+					if (err < 0) {
+						throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
+					}
+				}
+				else if(this->record. attr == true) {
+					err = H5Aread(this->attrID, H5T_NATIVE_LONG, sink);
+					if (err < 0) {
+						throw(std::invalid_argument("HDF5Interface: readData: H5Aread() failed"));
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			cupcfd::error::eCodes HDF5Access::readData(float * sink) {
 				hid_t err;
 
@@ -226,6 +249,65 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			cupcfd::error::eCodes HDF5Access::readData(long * sink, HDF5Properties& properties) {
+				hid_t err;
+
+				if(this->record.attr == false) {
+					// Begin Data Read into arrays
+					if(properties.nidx > 0) {
+						// Indexed Read
+
+						err = H5Sselect_elements(	this->dataspaceID,
+													H5S_SELECT_SET,
+													properties.nidx,
+													&properties.idx[0]);
+						if (err < 0) {
+							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_elements() failed"));
+						}
+
+						// ToDo - Move this out and associate it with the properties objects?
+						hid_t memspaceID = H5Screate_simple(1,&(properties.nidx), NULL);
+						if (memspaceID < 0) {
+							throw(std::invalid_argument("HDF5Interface: readData: H5Screate_simple() failed"));
+						}
+
+						err = H5Dread(this->datasetID, H5T_NATIVE_LONG, memspaceID,
+									  this->dataspaceID, H5P_DEFAULT, sink);
+						if (err < 0) {
+							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
+						}
+
+						err = H5Sclose(memspaceID);
+						if (err < 0) {
+							throw(std::invalid_argument("HDF5Interface: readData: H5Sclose() failed"));
+						}
+
+						// Cleanup Indexing into Dataspace.
+						err = H5Sselect_none(this->dataspaceID);
+						if (err < 0) {
+							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_none() failed"));
+						}
+					}
+					else
+					{
+						// Full Read
+						err = H5Dread(this->datasetID, H5T_NATIVE_LONG, H5S_ALL,
+									  this->dataspaceID, H5P_DEFAULT, sink);
+						if (err < 0) {
+							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
+						}
+					}
+				}
+				else if(this->record. attr == true) {
+					err = H5Aread(this->attrID, H5T_NATIVE_LONG, sink);
+					if (err < 0) {
+						throw(std::invalid_argument("HDF5Interface: readData: H5Aread() failed"));
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			cupcfd::error::eCodes HDF5Access::readData(float * sink, HDF5Properties& properties) {
 				hid_t err;
 
@@ -0,0 +1,366 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the SnapshotFile class
+ */
+
+#include "SnapshotFile.h"
+
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace cupcfd
+{
+	namespace io
+	{
+		/** Identifies a snapshot file **/
+		static const char snapshotMagic[8] = {'C', 'U', 'P', 'C', 'F', 'D', 'S', 'N'};
+
+		/** The version of the file layout. Increment if the layout of the header or table changes. **/
+		static const uint64_t snapshotVersion = 1;
+
+		/** Alignment of each section in bytes **/
+		static const std::size_t snapshotAlignment = 64;
+
+		/**
+		 * The header at the start of a snapshot file, padded to a multiple of the section alignment
+		 */
+		struct SnapshotHeader
+		{
+			char magic[8];
+			uint64_t version;
+			uint64_t keys[SnapshotFile::nKeys];
+			uint64_t nSections;
+			uint64_t tableOffset;
+			uint64_t padding[4];
+		};
+
+		// === Constructors/Deconstructors ===
+
+		SnapshotFile::SnapshotFile()
+		: writeFile(nullptr),
+		  fileSize(0),
+		  mapped(nullptr),
+		  nextSection(0)
+		{
+			for(int i = 0; i < nKeys; i++) {
+				this->keys[i] = 0;
+			}
+		}
+
+		SnapshotFile::~SnapshotFile() {
+			if(this->writeFile != nullptr) {
+				// Never completed, so discard it
+				fclose(this->writeFile);
+				std::string tmpName = this->fileName + ".tmp";
+				remove(tmpName.c_str());
+			}
+
+			this->closeRead();
+		}
+
+		// === Concrete Methods ===
+
+		cupcfd::error::eCodes SnapshotFile::openWrite(std::string fileName) {
+			if(this->writeFile != nullptr || this->mapped != nullptr) {
+				return cupcfd::error::E_ERROR;
+			}
+
+			this->fileName = fileName;
+			std::string tmpName = fileName + ".tmp";
+
+			this->writeFile = fopen(tmpName.c_str(), "wb");
+
+			if(this->writeFile == nullptr) {
+				return cupcfd::error::E_FILE_MISSING;
+			}
+
+			this->table.clear();
+
+			// Reserve space for the header, which is written once the table location is known
+			SnapshotHeader header;
+			std::memset(&header, 0, sizeof(SnapshotHeader));
+
+			if(fwrite(&header, sizeof(SnapshotHeader), 1, this->writeFile) != 1) {
+				return cupcfd::error::E_ERROR;
+			}
+
+			this->fileSize = sizeof(SnapshotHeader);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes SnapshotFile::pad() {
+			static const char zeros[snapshotAlignment] = {0};
+
+			std::size_t remainder = this->fileSize % snapshotAlignment;
+
+			if(remainder != 0) {
+				std::size_t nPad = snapshotAlignment - remainder;
+
+				if(fwrite(zeros, 1, nPad, this->writeFile) != nPad) {
+					return cupcfd::error::E_ERROR;
+				}
+
+				this->fileSize = this->fileSize + nPad;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes SnapshotFile::writeSection(const void * data, std::size_t nBytes) {
+			cupcfd::error::eCodes status;
+
+			if(this->writeFile == nullptr) {
+				return cupcfd::error::E_ERROR;
+			}
+
+			status = this->pad();
+			CHECK_ECODE(status)
+
+			this->table.push_back((uint64_t) this->fileSize);
+			this->table.push_back((uint64_t) nBytes);
+
+			if(nBytes > 0 && fwrite(data, 1, nBytes, this->writeFile) != nBytes) {
+				return cupcfd::error::E_ERROR;
+			}
+
+			this->fileSize = this->fileSize + nBytes;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes SnapshotFile::writeStrings(const std::vector<std::string>& data) {
+			cupcfd::error::eCodes status;
+
+			std::vector<uint64_t> offsets(data.size() + 1, 0);
+			std::vector<char> chars;
+
+			for(std::size_t i = 0; i < data.size(); i++) {
+				chars.insert(chars.end(), data[i].begin(), data[i].end());
+				offsets[i + 1] = (uint64_t) chars.size();
+			}
+
+			status = this->writeVector(offsets);
+			CHECK_ECODE(status)
+
+			status = this->writeVector(chars);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes SnapshotFile::closeWrite() {
+			cupcfd::error::eCodes status;
+
+			if(this->writeFile == nullptr) {
+				return cupcfd::error::E_ERROR;
+			}
+
+			status = this->pad();
+			CHECK_ECODE(status)
+
+			SnapshotHeader header;
+			std::memset(&header, 0, sizeof(SnapshotHeader));
+			std::memcpy(header.magic, snapshotMagic, sizeof(snapshotMagic));
+			header.version = snapshotVersion;
+
+			for(int i = 0; i < nKeys; i++) {
+				header.keys[i] = this->keys[i];
+			}
+
+			header.nSections = (uint64_t) (this->table.size() / 2);
+			header.tableOffset = (uint64_t) this->fileSize;
+
+			bool failed = false;
+
+			if(this->table.size() > 0 && fwrite(this->table.data(), sizeof(uint64_t), this->table.size(), this->writeFile) != this->table.size()) {
+				failed = true;
+			}
+
+			if(!failed && fseek(this->writeFile, 0, SEEK_SET) != 0) {
+				failed = true;
+			}
+
+			if(!failed && fwrite(&header, sizeof(SnapshotHeader), 1, this->writeFile) != 1) {
+				failed = true;
+			}
+
+			if(fclose(this->writeFile) != 0) {
+				failed = true;
+			}
+
+			this->writeFile = nullptr;
+			this->fileSize = this->fileSize + (this->table.size() * sizeof(uint64_t));
+
+			std::string tmpName = this->fileName + ".tmp";
+
+			if(failed || rename(tmpName.c_str(), this->fileName.c_str()) != 0) {
+				remove(tmpName.c_str());
+				return cupcfd::error::E_ERROR;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes SnapshotFile::openRead(std::string fileName) {
+			if(this->writeFile != nullptr || this->mapped != nullptr) {
+				return cupcfd::error::E_ERROR;
+			}
+
+			int fd = open(fileName.c_str(), O_RDONLY);
+
+			if(fd < 0) {
+				return cupcfd::error::E_FILE_MISSING;
+			}
+
+			struct stat fileStat;
+
+			if(fstat(fd, &fileStat) != 0) {
+				close(fd);
+				return cupcfd::error::E_FILE_MISSING;
+			}
+
+			std::size_t size = (std::size_t) fileStat.st_size;
+
+			if(size < sizeof(SnapshotHeader)) {
+				close(fd);
+				return cupcfd::error::E_INVALID_FILE_FORMAT;
+			}
+
+			void * addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+			// The mapping remains valid after the descriptor is closed
+			close(fd);
+
+			if(addr == MAP_FAILED) {
+				return cupcfd::error::E_FILE_MISSING;
+			}
+
+			// The whole file is about to be read, so start reading it in now
+			madvise(addr, size, MADV_WILLNEED);
+
+			this->fileName = fileName;
+			this->mapped = (char *) addr;
+			this->fileSize = size;
+			this->nextSection = 0;
+			this->table.clear();
+
+			const SnapshotHeader * header = (const SnapshotHeader *) this->mapped;
+
+			bool valid = (std::memcmp(header->magic, snapshotMagic, sizeof(snapshotMagic)) == 0) &&
+						 (header->version == snapshotVersion) &&
+						 (header->tableOffset <= size) &&
+						 (header->nSections <= (size - header->tableOffset) / (2 * sizeof(uint64_t)));
+
+			if(valid) {
+				const uint64_t * fileTable = (const uint64_t *) (this->mapped + header->tableOffset);
+				this->table.assign(fileTable, fileTable + (2 * header->nSections));
+
+				for(uint64_t i = 0; i < header->nSections; i++) {
+					uint64_t offset = this->table[2 * i];
+					uint64_t nBytes = this->table[(2 * i) + 1];
+
+					if(offset % snapshotAlignment != 0 || offset > header->tableOffset || nBytes > header->tableOffset - offset) {
+						valid = false;
+						break;
+					}
+				}
+			}
+
+			if(!valid) {
+				this->closeRead();
+				return cupcfd::error::E_INVALID_FILE_FORMAT;
+			}
+
+			for(int i = 0; i < nKeys; i++) {
+				this->keys[i] = header->keys[i];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes SnapshotFile::readSection(const void ** data, std::size_t * nBytes) {
+			if(this->mapped == nullptr || (2 * this->nextSection) >= this->table.size()) {
+				return cupcfd::error::E_INVALID_FILE_FORMAT;
+			}
+
+			*data = (const void *) (this->mapped + this->table[2 * this->nextSection]);
+			*nBytes = (std::size_t) this->table[(2 * this->nextSection) + 1];
+
+			this->nextSection = this->nextSection + 1;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes SnapshotFile::readStrings(std::vector<std::string>& data) {
+			cupcfd::error::eCodes status;
+
+			const void * offsetSection;
+			const void * charSection;
+			std::size_t nOffsetBytes;
+			std::size_t nCharBytes;
+
+			status = this->readSection(&offsetSection, &nOffsetBytes);
+			CHECK_ECODE(status)
+
+			status = this->readSection(&charSection, &nCharBytes);
+			CHECK_ECODE(status)
+
+			if(nOffsetBytes < sizeof(uint64_t) || nOffsetBytes % sizeof(uint64_t) != 0) {
+				return cupcfd::error::E_INVALID_FILE_FORMAT;
+			}
+
+			const uint64_t * offsets = (const uint64_t *) offsetSection;
+			const char * chars = (const char *) charSection;
+			std::size_t nStrings = (nOffsetBytes / sizeof(uint64_t)) - 1;
+
+			data.resize(nStrings);
+
+			for(std::size_t i = 0; i < nStrings; i++) {
+				if(offsets[i] > offsets[i + 1] || offsets[i + 1] > nCharBytes) {
+					return cupcfd::error::E_INVALID_FILE_FORMAT;
+				}
+
+				data[i].assign(chars + offsets[i], chars + offsets[i + 1]);
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		void SnapshotFile::closeRead() {
+			if(this->mapped != nullptr) {
+				munmap((void *) this->mapped, this->fileSize);
+				this->mapped = nullptr;
+				this->fileSize = 0;
+				this->table.clear();
+				this->nextSection = 0;
+			}
+		}
+
+		std::size_t SnapshotFile::getFileSize() {
+			return this->fileSize;
+		}
+
+		uint64_t SnapshotFile::hashBytes(const void * data, std::size_t nBytes, uint64_t seed) {
+			const unsigned char * bytes = (const unsigned char *) data;
+			uint64_t hash = seed;
+
+			for(std::size_t i = 0; i < nBytes; i++) {
+				hash = hash ^ (uint64_t) bytes[i];
+				hash = hash * UINT64_C(1099511628211);
+			}
+
+			return hash;
+		}
+	}
+}
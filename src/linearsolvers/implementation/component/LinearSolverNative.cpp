@@ -0,0 +1,1353 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the LinearSolverNative class
+ */
+
+#include "LinearSolverNative.h"
+
+// SparseMatrix Implementation Classes
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixCOO.h"
+
+// Preconditioners
+#include "PreconditionerSGSMulticolour.h"
+#include "PreconditionerILU0.h"
+
+// Reductions across ranks
+#include "Reduce.h"
+
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class C, class I, class T>
+		LinearSolverNative<C,I,T>::LinearSolverNative(cupcfd::comm::Communicator& comm, NativeAlgorithm algorithm, NativePreconditioner preconType,
+													  T rTol, T eTol, I maxIterations,
+													  cupcfd::data_structures::SparseMatrix<C,I,T>& matrix)
+		:LinearSolverNative<C,I,T>(comm, algorithm, preconType, rTol, eTol, maxIterations, false, 0, T(0), matrix)
+		{
+
+		}
+
+		template <class C, class I, class T>
+		LinearSolverNative<C,I,T>::LinearSolverNative(cupcfd::comm::Communicator& comm, NativeAlgorithm algorithm, NativePreconditioner preconType,
+													  T rTol, T eTol, I maxIterations,
+													  bool mixedPrecision, I maxRefinements, T innerRTol,
+													  cupcfd::data_structures::SparseMatrix<C,I,T>& matrix)
+		:LinearSolverInterface<C,I,T>(comm, matrix.m, matrix.n),
+		 algorithm(algorithm),
+		 preconType(preconType),
+		 precon(nullptr),
+		 rTol(rTol),
+		 eTol(eTol),
+		 maxIterations(maxIterations),
+		 preconStale(true),
+		 iterations(0),
+		 residualNorm(0),
+		 mixedPrecision(mixedPrecision),
+		 maxRefinements(maxRefinements),
+		 innerRTol(innerRTol),
+		 refinementSteps(0),
+		 inner(nullptr),
+		 distributed(nullptr),
+		 nLocalRows(matrix.m),
+		 nLocalCols(matrix.n),
+		 rowStart(0)
+		{
+			cupcfd::error::eCodes status;
+
+			// A whole matrix is not distributed across ranks
+			if(this->comm.size != 1) {
+				HARD_CHECK_ECODE(cupcfd::error::E_LINEARSOLVER_INVALID_COMM)
+			}
+
+			// In mixed precision mode the preconditioner belongs to the inner solver only
+			if(!this->mixedPrecision) {
+				this->buildPreconditioner();
+			}
+
+			status = this->setupVectorX();
+			HARD_CHECK_ECODE(status)
+			status = this->setupVectorB();
+			HARD_CHECK_ECODE(status)
+			status = this->setupMatrixA(matrix);
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class C, class I, class T>
+		LinearSolverNative<C,I,T>::LinearSolverNative(cupcfd::comm::Communicator& comm, NativeAlgorithm algorithm, NativePreconditioner preconType,
+													  T rTol, T eTol, I maxIterations,
+													  cupcfd::data_structures::DistributedSparseMatrix<I,T>& matrix)
+		:LinearSolverInterface<C,I,T>(comm, matrix.nGlobalRows, matrix.nGlobalRows),
+		 algorithm(algorithm),
+		 preconType(preconType),
+		 precon(nullptr),
+		 rTol(rTol),
+		 eTol(eTol),
+		 maxIterations(maxIterations),
+		 preconStale(true),
+		 iterations(0),
+		 residualNorm(0),
+		 mixedPrecision(false),
+		 maxRefinements(0),
+		 innerRTol(T(0)),
+		 refinementSteps(0),
+		 inner(nullptr),
+		 distributed(&matrix),
+		 nLocalRows(matrix.nOwnedRows),
+		 nLocalCols(matrix.nOwnedRows + matrix.nGhosts),
+		 rowStart(matrix.rowStart)
+		{
+			cupcfd::error::eCodes status;
+
+			// The solver must run across the same ranks as the matrix rows
+			if(this->comm.size != matrix.comm.size) {
+				HARD_CHECK_ECODE(cupcfd::error::E_LINEARSOLVER_INVALID_COMM)
+			}
+
+			if(!matrix.built) {
+				HARD_CHECK_ECODE(cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX)
+			}
+
+			this->buildPreconditioner();
+
+			status = this->setupVectorX();
+			HARD_CHECK_ECODE(status)
+			status = this->setupVectorB();
+			HARD_CHECK_ECODE(status)
+			status = this->setupMatrixADistributed();
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class C, class I, class T>
+		LinearSolverNative<C,I,T>::~LinearSolverNative()
+		{
+			if(this->precon != nullptr) {
+				delete this->precon;
+			}
+
+			if(this->inner != nullptr) {
+				delete this->inner;
+			}
+		}
+
+		// === Concrete Methods ===
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::multiply(const T * xVec, T * yVec) {
+			const I * IA = &(this->a.IA[0]);
+			const I * JA = &(this->a.JA[0]);
+			const T * A = &(this->a.A[0]);
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < this->nLocalRows; i++) {
+				T sum = T(0);
+
+				for(I j = IA[i]; j < IA[i+1]; j++) {
+					sum = sum + (A[j] * xVec[JA[j]]);
+				}
+
+				yVec[i] = sum;
+			}
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::multiplyExchange(T * xVec, T * yVec) {
+			cupcfd::error::eCodes status;
+
+			if(this->distributed == nullptr) {
+				this->multiply(xVec, yVec);
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			const I * IA = &(this->a.IA[0]);
+			const I * JA = &(this->a.JA[0]);
+			const T * A = &(this->a.A[0]);
+
+			status = this->distributed->haloExchangeStart(xVec, this->nLocalCols);
+			CHECK_ECODE(status)
+
+			// The internal matrix has the same rows as the distributed matrix, so its row split applies
+			const I * rows = this->distributed->interiorRows.data();
+			I nRows = this->distributed->interiorRows.size();
+
+			#pragma omp parallel for schedule(static)
+			for(I r = 0; r < nRows; r++) {
+				I i = rows[r];
+				T sum = T(0);
+
+				for(I j = IA[i]; j < IA[i+1]; j++) {
+					sum = sum + (A[j] * xVec[JA[j]]);
+				}
+
+				yVec[i] = sum;
+			}
+
+			status = this->distributed->haloExchangeStop(xVec, this->nLocalCols);
+			CHECK_ECODE(status)
+
+			rows = this->distributed->boundaryRows.data();
+			nRows = this->distributed->boundaryRows.size();
+
+			#pragma omp parallel for schedule(static)
+			for(I r = 0; r < nRows; r++) {
+				I i = rows[r];
+				T sum = T(0);
+
+				for(I j = IA[i]; j < IA[i+1]; j++) {
+					sum = sum + (A[j] * xVec[JA[j]]);
+				}
+
+				yVec[i] = sum;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::computeResidual(T * rNorm) {
+			cupcfd::error::eCodes status;
+
+			T * xPtr = &(this->x[0]);
+
+			if(this->distributed != nullptr) {
+				status = this->distributed->haloExchange(xPtr, this->nLocalCols);
+				CHECK_ECODE(status)
+			}
+
+			T localNorm;
+			status = this->a.residual(xPtr, this->nLocalCols, &(this->b[0]), this->nLocalRows, &(this->r[0]), this->nLocalRows, &localNorm);
+			CHECK_ECODE(status)
+
+			if(this->distributed != nullptr) {
+				T globalNorm;
+				status = cupcfd::comm::allReduceAdd(&localNorm, 1, &globalNorm, 1, this->comm);
+				CHECK_ECODE(status)
+				localNorm = globalNorm;
+			}
+
+			*rNorm = sqrt(localNorm);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::multiplyBlock(const T * xBlk, T * yBlk, I nVec) {
+			const I * IA = &(this->a.IA[0]);
+			const I * JA = &(this->a.JA[0]);
+			const T * A = &(this->a.A[0]);
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < this->mGlobal; i++) {
+				T * yRow = yBlk + (i * nVec);
+
+				for(I k = 0; k < nVec; k++) {
+					yRow[k] = T(0);
+				}
+
+				for(I j = IA[i]; j < IA[i+1]; j++) {
+					const T val = A[j];
+					const T * xRow = xBlk + (JA[j] * nVec);
+
+					for(I k = 0; k < nVec; k++) {
+						yRow[k] = yRow[k] + (val * xRow[k]);
+					}
+				}
+			}
+		}
+
+		template <class C, class I, class T>
+		T LinearSolverNative<C,I,T>::dot(const T * v1, const T * v2) {
+			T sum = T(0);
+
+			#pragma omp parallel for schedule(static) reduction(+:sum)
+			for(I i = 0; i < this->nLocalRows; i++) {
+				sum = sum + (v1[i] * v2[i]);
+			}
+
+			if(this->distributed != nullptr) {
+				T globalSum;
+				cupcfd::error::eCodes status = cupcfd::comm::allReduceAdd(&sum, 1, &globalSum, 1, this->comm);
+				HARD_CHECK_ECODE(status)
+				sum = globalSum;
+			}
+
+			return sum;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::applyPreconditioner(T * rVec, T * zVec) {
+			cupcfd::error::eCodes status;
+
+			if(this->precon == nullptr) {
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < this->nLocalRows; i++) {
+					zVec[i] = rVec[i];
+				}
+			}
+			else {
+				status = this->precon->apply(rVec, this->nLocalRows, zVec, this->nLocalRows);
+				CHECK_ECODE(status)
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::dotBlock(const T * uBlk, const T * vBlk, I nVec, T * result) {
+			for(I k = 0; k < nVec; k++) {
+				result[k] = T(0);
+			}
+
+			#pragma omp parallel
+			{
+				std::vector<T> local(nVec, T(0));
+
+				#pragma omp for schedule(static)
+				for(I i = 0; i < this->mGlobal; i++) {
+					for(I k = 0; k < nVec; k++) {
+						local[k] = local[k] + (uBlk[i * nVec + k] * vBlk[i * nVec + k]);
+					}
+				}
+
+				#pragma omp critical
+				{
+					for(I k = 0; k < nVec; k++) {
+						result[k] = result[k] + local[k];
+					}
+				}
+			}
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::applyPreconditionerBlock(T * rBlk, T * zBlk, I nVec, std::vector<bool>& active) {
+			cupcfd::error::eCodes status;
+
+			I n = this->mGlobal;
+
+			// Each column is gathered into the single vector workspaces
+			for(I k = 0; k < nVec; k++) {
+				if(!active[k]) {
+					continue;
+				}
+
+				for(I i = 0; i < n; i++) {
+					this->r[i] = rBlk[i * nVec + k];
+				}
+
+				status = this->applyPreconditioner(&(this->r[0]), &(this->z[0]));
+				CHECK_ECODE(status)
+
+				for(I i = 0; i < n; i++) {
+					zBlk[i * nVec + k] = this->z[i];
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::solveCG() {
+			cupcfd::error::eCodes status;
+
+			I n = this->nLocalRows;
+			T * xPtr = &(this->x[0]);
+			T * bPtr = &(this->b[0]);
+			T * rPtr = &(this->r[0]);
+			T * zPtr = &(this->z[0]);
+			T * pPtr = &(this->p[0]);
+			T * qPtr = &(this->q[0]);
+
+			// r = b - Ax
+			T rNorm;
+			status = this->computeResidual(&rNorm);
+			CHECK_ECODE(status)
+
+			T bNorm = sqrt(this->dot(bPtr, bPtr));
+			T tol = std::max(this->rTol * bNorm, this->eTol);
+
+			this->iterations = 0;
+			this->residualNorm = rNorm;
+
+			if(rNorm <= tol) {
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			status = this->applyPreconditioner(rPtr, zPtr);
+			CHECK_ECODE(status)
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < n; i++) {
+				pPtr[i] = zPtr[i];
+			}
+
+			T rz = this->dot(rPtr, zPtr);
+
+			for(I it = 1; it <= this->maxIterations; it++) {
+				status = this->multiplyExchange(pPtr, qPtr);
+				CHECK_ECODE(status)
+
+				T pq = this->dot(pPtr, qPtr);
+				if(pq == T(0)) {
+					// Breakdown - cannot progress further
+					break;
+				}
+
+				T alpha = rz / pq;
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < n; i++) {
+					xPtr[i] = xPtr[i] + (alpha * pPtr[i]);
+					rPtr[i] = rPtr[i] - (alpha * qPtr[i]);
+				}
+
+				rNorm = sqrt(this->dot(rPtr, rPtr));
+				this->iterations = it;
+				this->residualNorm = rNorm;
+
+				if(rNorm <= tol) {
+					break;
+				}
+
+				status = this->applyPreconditioner(rPtr, zPtr);
+				CHECK_ECODE(status)
+
+				T rzNew = this->dot(rPtr, zPtr);
+				T beta = rzNew / rz;
+				rz = rzNew;
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < n; i++) {
+					pPtr[i] = zPtr[i] + (beta * pPtr[i]);
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::solveRichardson() {
+			cupcfd::error::eCodes status;
+
+			I n = this->nLocalRows;
+			T * xPtr = &(this->x[0]);
+			T * bPtr = &(this->b[0]);
+			T * rPtr = &(this->r[0]);
+			T * zPtr = &(this->z[0]);
+
+			T bNorm = sqrt(this->dot(bPtr, bPtr));
+			T tol = std::max(this->rTol * bNorm, this->eTol);
+
+			this->iterations = 0;
+
+			for(I it = 0; it <= this->maxIterations; it++) {
+				// r = b - Ax
+				status = this->computeResidual(&(this->residualNorm));
+				CHECK_ECODE(status)
+				this->iterations = it;
+
+				if(this->residualNorm <= tol || it == this->maxIterations) {
+					break;
+				}
+
+				// x = x + M^-1 r
+				status = this->applyPreconditioner(rPtr, zPtr);
+				CHECK_ECODE(status)
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < n; i++) {
+					xPtr[i] = xPtr[i] + zPtr[i];
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::solveMixedPrecision() {
+			cupcfd::error::eCodes status;
+
+			if(this->inner == nullptr) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+			}
+
+			I n = this->mGlobal;
+			T * xPtr = &(this->x[0]);
+			T * bPtr = &(this->b[0]);
+			T * rPtr = &(this->r[0]);
+			float * innerX = &(this->inner->x[0]);
+			float * innerB = &(this->inner->b[0]);
+
+			T bNorm = sqrt(this->dot(bPtr, bPtr));
+			T tol = std::max(this->rTol * bNorm, this->eTol);
+
+			this->iterations = 0;
+			this->refinementSteps = 0;
+
+			while(true) {
+				// Outer residual in full precision: r = b - Ax
+				status = this->computeResidual(&(this->residualNorm));
+				CHECK_ECODE(status)
+
+				if(this->residualNorm <= tol || this->refinementSteps >= this->maxRefinements) {
+					break;
+				}
+
+				// Inner correction solve in single precision: Ad = r
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < n; i++) {
+					innerB[i] = float(rPtr[i]);
+					innerX[i] = 0.0f;
+				}
+
+				status = this->inner->solve();
+				CHECK_ECODE(status)
+
+				this->iterations = this->iterations + this->inner->iterations;
+
+				// Apply the correction in full precision: x = x + d
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < n; i++) {
+					xPtr[i] = xPtr[i] + T(innerX[i]);
+				}
+
+				this->refinementSteps = this->refinementSteps + 1;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::solveMultiCG() {
+			cupcfd::error::eCodes status;
+
+			I n = this->mGlobal;
+			I nVec = this->nRHS;
+			I nIndexes = this->multiIndexes.size();
+
+			this->xBlock.assign(n * nVec, T(0));
+			this->bBlock.assign(n * nVec, T(0));
+			this->rBlock.resize(n * nVec);
+			this->zBlock.resize(n * nVec);
+			this->pBlock.resize(n * nVec);
+			this->qBlock.resize(n * nVec);
+
+			T * X = &(this->xBlock[0]);
+			T * B = &(this->bBlock[0]);
+			T * R = &(this->rBlock[0]);
+			T * Z = &(this->zBlock[0]);
+			T * P = &(this->pBlock[0]);
+			T * Q = &(this->qBlock[0]);
+
+			// Interleave the right-hand-sides and initial guesses
+			for(I i = 0; i < nIndexes; i++) {
+				I row = this->multiIndexes[i] - this->multiIndexBase;
+
+				if(row < 0 || row >= n) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				for(I k = 0; k < nVec; k++) {
+					B[row * nVec + k] = this->multiB[k][i];
+					X[row * nVec + k] = this->multiX[k][i];
+				}
+			}
+
+			std::vector<T> tol(nVec), rNorm(nVec), rz(nVec), pq(nVec), rzNew(nVec), alpha(nVec), beta(nVec);
+			std::vector<bool> active(nVec);
+
+			// R = B - AX
+			this->multiplyBlock(X, Q, nVec);
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < n * nVec; i++) {
+				R[i] = B[i] - Q[i];
+			}
+
+			this->dotBlock(B, B, nVec, &(rNorm[0]));
+			for(I k = 0; k < nVec; k++) {
+				tol[k] = std::max(this->rTol * T(sqrt(rNorm[k])), this->eTol);
+			}
+
+			this->dotBlock(R, R, nVec, &(rNorm[0]));
+
+			bool anyActive = false;
+			for(I k = 0; k < nVec; k++) {
+				rNorm[k] = sqrt(rNorm[k]);
+				active[k] = rNorm[k] > tol[k];
+				anyActive = anyActive || active[k];
+			}
+
+			this->iterations = 0;
+
+			if(anyActive) {
+				status = this->applyPreconditionerBlock(R, Z, nVec, active);
+				CHECK_ECODE(status)
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < n * nVec; i++) {
+					P[i] = Z[i];
+				}
+
+				this->dotBlock(R, Z, nVec, &(rz[0]));
+			}
+
+			for(I it = 1; it <= this->maxIterations && anyActive; it++) {
+				// One shared matrix product for all right-hand-sides
+				this->multiplyBlock(P, Q, nVec);
+
+				this->dotBlock(P, Q, nVec, &(pq[0]));
+
+				for(I k = 0; k < nVec; k++) {
+					if(active[k] && pq[k] == T(0)) {
+						// Breakdown - cannot progress this right-hand-side further
+						active[k] = false;
+					}
+
+					alpha[k] = active[k] ? rz[k] / pq[k] : T(0);
+				}
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < n; i++) {
+					for(I k = 0; k < nVec; k++) {
+						X[i * nVec + k] = X[i * nVec + k] + (alpha[k] * P[i * nVec + k]);
+						R[i * nVec + k] = R[i * nVec + k] - (alpha[k] * Q[i * nVec + k]);
+					}
+				}
+
+				this->dotBlock(R, R, nVec, &(rNorm[0]));
+				this->iterations = it;
+
+				anyActive = false;
+				for(I k = 0; k < nVec; k++) {
+					rNorm[k] = sqrt(rNorm[k]);
+					active[k] = active[k] && (rNorm[k] > tol[k]);
+					anyActive = anyActive || active[k];
+				}
+
+				if(!anyActive) {
+					break;
+				}
+
+				status = this->applyPreconditionerBlock(R, Z, nVec, active);
+				CHECK_ECODE(status)
+
+				this->dotBlock(R, Z, nVec, &(rzNew[0]));
+
+				for(I k = 0; k < nVec; k++) {
+					beta[k] = active[k] ? rzNew[k] / rz[k] : T(0);
+					rz[k] = rzNew[k];
+				}
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < n; i++) {
+					for(I k = 0; k < nVec; k++) {
+						if(active[k]) {
+							P[i * nVec + k] = Z[i * nVec + k] + (beta[k] * P[i * nVec + k]);
+						}
+						else {
+							P[i * nVec + k] = T(0);
+						}
+					}
+				}
+			}
+
+			// The reported residual is the worst across the right-hand-sides
+			this->residualNorm = T(0);
+			for(I k = 0; k < nVec; k++) {
+				this->residualNorm = std::max(this->residualNorm, rNorm[k]);
+			}
+
+			// De-interleave the solutions
+			for(I i = 0; i < nIndexes; i++) {
+				I row = this->multiIndexes[i] - this->multiIndexBase;
+
+				for(I k = 0; k < nVec; k++) {
+					this->multiX[k][i] = X[row * nVec + k];
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::buildPreconditioner() {
+			switch(this->preconType) {
+				case NATIVE_PC_SGS_MULTICOLOUR:
+					this->precon = new PreconditionerSGSMulticolour<I,T>();
+					break;
+
+				case NATIVE_PC_ILU0:
+					this->precon = new PreconditionerILU0<I,T>();
+					break;
+
+				default:
+					this->precon = nullptr;
+					break;
+			}
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setupMatrixADistributed() {
+			cupcfd::error::eCodes status;
+
+			cupcfd::data_structures::SparseMatrixCSR<I,T>& local = this->distributed->local;
+
+			// The local rows are already base zero and sorted by local column
+			status = this->a.resize(this->nLocalRows, this->nLocalCols);
+			CHECK_ECODE(status)
+
+			this->a.IA = local.IA;
+			this->a.JA = local.JA;
+			this->a.A.assign(local.nnz, T(0));
+			this->a.nnz = local.nnz;
+
+			// The preconditioner only sees the owned columns of each row (block Jacobi), since the
+			// ghost rows are not held on this rank
+			status = this->aOwned.resize(this->nLocalRows, this->nLocalRows);
+			CHECK_ECODE(status)
+
+			this->aOwnedEntries.clear();
+
+			for(I i = 0; i < this->nLocalRows; i++) {
+				for(I j = this->a.IA[i]; j < this->a.IA[i+1]; j++) {
+					if(this->a.JA[j] < this->nLocalRows) {
+						this->aOwned.JA.push_back(this->a.JA[j]);
+						this->aOwned.A.push_back(T(0));
+						this->aOwnedEntries.push_back(j);
+					}
+				}
+
+				this->aOwned.IA[i+1] = this->aOwned.JA.size();
+			}
+
+			this->aOwned.IA[0] = 0;
+			this->aOwned.nnz = this->aOwned.JA.size();
+
+			if(this->precon != nullptr) {
+				status = this->precon->setup(this->aOwned);
+				CHECK_ECODE(status)
+			}
+
+			this->preconStale = true;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		// === Overloaded Inherited Methods ===
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::reset() {
+			this->resetVectorX();
+			this->resetVectorB();
+			this->resetMatrixA();
+		}
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::resetVectorX() {
+			this->x.clear();
+			this->x.shrink_to_fit();
+		}
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::resetVectorB() {
+			this->b.clear();
+			this->b.shrink_to_fit();
+		}
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::resetMatrixA() {
+			this->a = cupcfd::data_structures::SparseMatrixCSR<I,T>();
+			this->aOwned = cupcfd::data_structures::SparseMatrixCSR<I,T>();
+			this->aOwnedEntries.clear();
+			this->preconStale = true;
+
+			if(this->inner != nullptr) {
+				delete this->inner;
+				this->inner = nullptr;
+			}
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setupVectorX() {
+			if(this->mGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_ROW_SIZE_UNSET;
+			}
+
+			// Distributed solves also hold the ghost entries of x
+			this->x.assign(this->nLocalCols, T(0));
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setupVectorB() {
+			if(this->mGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_ROW_SIZE_UNSET;
+			}
+
+			this->b.assign(this->nLocalRows, T(0));
+
+			// Workspaces are sized to match the vectors - p is multiplied by the matrix, so holds ghost entries
+			this->r.assign(this->nLocalRows, T(0));
+			this->z.assign(this->nLocalRows, T(0));
+			this->p.assign(this->nLocalCols, T(0));
+			this->q.assign(this->nLocalRows, T(0));
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setupMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix) {
+			cupcfd::error::eCodes status;
+
+			if(this->mGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_ROW_SIZE_UNSET;
+			}
+
+			if(this->nGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_COL_SIZE_UNSET;
+			}
+
+			// The structure of a distributed solve is always that of the distributed matrix
+			if(this->distributed != nullptr) {
+				status = this->setupMatrixADistributed();
+				CHECK_ECODE(status)
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			status = this->a.resize(this->mGlobal, this->nGlobal);
+			CHECK_ECODE(status)
+
+			// Copy the non-zero structure across row by row. Rows and columns are retrieved in
+			// ascending order, so the internal CSR can be built directly without searching.
+			I * rowIndexes;
+			I nRowIndexes;
+			status = matrix.getNonZeroRowIndexes(&rowIndexes, &nRowIndexes);
+			CHECK_ECODE(status)
+
+			I ptr = 0;
+			I currentRow = 0;
+
+			for(I i = 0; i < nRowIndexes; i++) {
+				I rowBaseZero = rowIndexes[i] - matrix.baseIndex;
+
+				I * columnIndexes;
+				I nColumnIndexes;
+				status = matrix.getRowColumnIndexes(rowIndexes[i], &columnIndexes, &nColumnIndexes);
+				CHECK_ECODE(status)
+
+				// Any rows skipped are empty
+				while(currentRow <= rowBaseZero) {
+					this->a.IA[currentRow] = ptr;
+					currentRow = currentRow + 1;
+				}
+
+				for(I j = 0; j < nColumnIndexes; j++) {
+					this->a.JA.push_back(columnIndexes[j] - matrix.baseIndex);
+					this->a.A.push_back(T(0));
+					ptr = ptr + 1;
+				}
+
+				free(columnIndexes);
+			}
+
+			while(currentRow <= this->mGlobal) {
+				this->a.IA[currentRow] = ptr;
+				currentRow = currentRow + 1;
+			}
+
+			this->a.nnz = ptr;
+
+			free(rowIndexes);
+
+			// Build the single precision inner solver from the same non-zero structure
+			if(this->mixedPrecision) {
+				if(this->inner != nullptr) {
+					delete this->inner;
+				}
+
+				cupcfd::data_structures::SparseMatrixCSR<I,float> structure(this->mGlobal, this->nGlobal, 0);
+				structure.IA = this->a.IA;
+				structure.JA = this->a.JA;
+				structure.A.assign(this->a.nnz, 0.0f);
+				structure.nnz = this->a.nnz;
+
+				this->inner = new LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<I,float>, I, float>(this->comm, this->algorithm, this->preconType,
+																												 float(this->innerRTol), 0.0f, this->maxIterations,
+																												 structure);
+			}
+
+			// Structural setup of the preconditioner - numeric setup is deferred until values are set
+			if(this->precon != nullptr) {
+				status = this->precon->setup(this->a);
+				CHECK_ECODE(status)
+			}
+
+			this->preconStale = true;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setup(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix) {
+			cupcfd::error::eCodes status;
+
+			status = this->setupVectorX();
+			CHECK_ECODE(status)
+
+			status = this->setupVectorB();
+			CHECK_ECODE(status)
+
+			status = this->setupMatrixA(matrix);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setValuesVectorX(T scalar) {
+			if(this->x.size() == 0) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < this->nLocalRows; i++) {
+				this->x[i] = scalar;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setValuesVectorX(T * scalars, I nScalars, I * indexes, I nIndexes, I indexBase) {
+			if(nScalars != nIndexes) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			if(this->x.size() == 0) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			// Indexes are global - only rows held on this rank may be set
+			for(I i = 0; i < nIndexes; i++) {
+				I index = indexes[i] - indexBase - this->rowStart;
+
+				if(index < 0 || index >= this->nLocalRows) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				this->x[index] = scalars[i];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setValuesVectorB(T scalar) {
+			if(this->b.size() == 0) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < this->nLocalRows; i++) {
+				this->b[i] = scalar;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setValuesVectorB(T * scalars, I nScalars, I * indexes, I nIndexes, I indexBase) {
+			if(nScalars != nIndexes) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			if(this->b.size() == 0) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			// Indexes are global - only rows held on this rank may be set
+			for(I i = 0; i < nIndexes; i++) {
+				I index = indexes[i] - indexBase - this->rowStart;
+
+				if(index < 0 || index >= this->nLocalRows) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				this->b[index] = scalars[i];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setValuesMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix) {
+			cupcfd::error::eCodes status;
+
+			if(this->mGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_ROW_SIZE_UNSET;
+			}
+
+			if(this->nGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_COL_SIZE_UNSET;
+			}
+
+			I * rowIndexes;
+			I nRowIndexes;
+			status = matrix.getNonZeroRowIndexes(&rowIndexes, &nRowIndexes);
+			CHECK_ECODE(status)
+
+			for(I i = 0; i < nRowIndexes; i++) {
+				I rowBaseZero = rowIndexes[i] - matrix.baseIndex - this->rowStart;
+
+				if(rowBaseZero < 0 || rowBaseZero >= this->nLocalRows) {
+					free(rowIndexes);
+					return cupcfd::error::E_MATRIX_ROW_OOB;
+				}
+
+				I * columnIndexes;
+				I nColumnIndexes;
+				status = matrix.getRowColumnIndexes(rowIndexes[i], &columnIndexes, &nColumnIndexes);
+				CHECK_ECODE(status)
+
+				T * nnzValues;
+				I nNNZValues;
+				status = matrix.getRowNNZValues(rowIndexes[i], &nnzValues, &nNNZValues);
+				CHECK_ECODE(status)
+
+				// Both the source row and the internal row are sorted by column, so merge
+				// rather than search. Entries outside of the setup structure are an error.
+				I ptr = this->a.IA[rowBaseZero];
+				I stop = this->a.IA[rowBaseZero + 1];
+
+				for(I j = 0; j < nColumnIndexes; j++) {
+					I col = columnIndexes[j] - matrix.baseIndex;
+
+					// Local columns of a distributed row are not in global order, so search from the row start
+					if(this->distributed != nullptr) {
+						status = this->distributed->getLocalColumnIndex(col, &col);
+
+						if(status != cupcfd::error::E_SUCCESS) {
+							free(columnIndexes);
+							free(nnzValues);
+							free(rowIndexes);
+							return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+						}
+
+						ptr = this->a.IA[rowBaseZero];
+					}
+
+					while(ptr < stop && this->a.JA[ptr] < col) {
+						ptr = ptr + 1;
+					}
+
+					if(ptr == stop || this->a.JA[ptr] != col) {
+						free(columnIndexes);
+						free(nnzValues);
+						free(rowIndexes);
+						return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+					}
+
+					this->a.A[ptr] = nnzValues[j];
+				}
+
+				free(columnIndexes);
+				free(nnzValues);
+			}
+
+			free(rowIndexes);
+
+			this->refreshMatrixA();
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setValuesMatrixA(cupcfd::data_structures::DistributedSparseMatrix<I,T>& matrix) {
+			if(this->mGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_ROW_SIZE_UNSET;
+			}
+
+			if(this->nGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_COL_SIZE_UNSET;
+			}
+
+			if(!matrix.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
+			// The local rows share the setup structure, so the values are copied directly
+			// without building a globally sized matrix
+			if(matrix.rowStart != this->rowStart || matrix.nOwnedRows != this->nLocalRows ||
+			   matrix.local.nnz != this->a.nnz || matrix.local.IA != this->a.IA || matrix.local.JA != this->a.JA) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+			}
+
+			#pragma omp parallel for schedule(static)
+			for(I k = 0; k < this->a.nnz; k++) {
+				this->a.A[k] = matrix.local.A[k];
+			}
+
+			this->refreshMatrixA();
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::refreshMatrixA() {
+			this->preconStale = true;
+
+			// Refresh the owned block used by the preconditioner
+			I nOwnedEntries = this->aOwnedEntries.size();
+
+			#pragma omp parallel for schedule(static)
+			for(I k = 0; k < nOwnedEntries; k++) {
+				this->aOwned.A[k] = this->a.A[this->aOwnedEntries[k]];
+			}
+
+			// Refresh the single precision copy of the values
+			if(this->inner != nullptr) {
+				#pragma omp parallel for schedule(static)
+				for(I k = 0; k < this->a.nnz; k++) {
+					this->inner->a.A[k] = float(this->a.A[k]);
+				}
+
+				this->inner->preconStale = true;
+			}
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::getValuesVectorX(T ** result, I * nResult) {
+			if(this->x.size() == 0) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			*nResult = this->nLocalRows;
+			*result = (T *) malloc(sizeof(T) * (*nResult));
+
+			for(I i = 0; i < *nResult; i++) {
+				(*result)[i] = this->x[i];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::getValuesVectorX(T ** result, I * nResult, I * indexes, I nIndexes, I indexBase) {
+			if(this->x.size() == 0) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			for(I i = 0; i < nIndexes; i++) {
+				if((indexes[i] - indexBase - this->rowStart) < 0 || (indexes[i] - indexBase - this->rowStart) >= this->nLocalRows) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+			}
+
+			*nResult = nIndexes;
+			*result = (T *) malloc(sizeof(T) * (*nResult));
+
+			for(I i = 0; i < nIndexes; i++) {
+				(*result)[i] = this->x[indexes[i] - indexBase - this->rowStart];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::getValuesVectorB(T ** result, I * nResult) {
+			if(this->b.size() == 0) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			*nResult = this->nLocalRows;
+			*result = (T *) malloc(sizeof(T) * (*nResult));
+
+			for(I i = 0; i < *nResult; i++) {
+				(*result)[i] = this->b[i];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::getValuesVectorB(T ** result, I * nResult, I * indexes, I nIndexes, I indexBase) {
+			if(this->b.size() == 0) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			for(I i = 0; i < nIndexes; i++) {
+				if((indexes[i] - indexBase - this->rowStart) < 0 || (indexes[i] - indexBase - this->rowStart) >= this->nLocalRows) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+			}
+
+			*nResult = nIndexes;
+			*result = (T *) malloc(sizeof(T) * (*nResult));
+
+			for(I i = 0; i < nIndexes; i++) {
+				(*result)[i] = this->b[indexes[i] - indexBase - this->rowStart];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::getValuesMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix) {
+			cupcfd::error::eCodes status;
+
+			for(I i = 0; i < this->nLocalRows; i++) {
+				for(I j = this->a.IA[i]; j < this->a.IA[i+1]; j++) {
+					I col = this->a.JA[j];
+
+					if(this->distributed != nullptr) {
+						status = this->distributed->getGlobalColumnIndex(col, &col);
+						CHECK_ECODE(status)
+					}
+
+					status = matrix.setElement(i + this->rowStart + matrix.baseIndex, col + matrix.baseIndex, this->a.A[j]);
+					CHECK_ECODE(status)
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::clearVectorX() {
+			cupcfd::error::eCodes status;
+
+			status = this->setValuesVectorX((T) 0);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::clearVectorB() {
+			cupcfd::error::eCodes status;
+
+			status = this->setValuesVectorB((T) 0);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::clearMatrixA() {
+			// Retain the non-zero structure, zero the values
+			std::fill(this->a.A.begin(), this->a.A.end(), T(0));
+			std::fill(this->aOwned.A.begin(), this->aOwned.A.end(), T(0));
+			this->preconStale = true;
+
+			if(this->inner != nullptr) {
+				cupcfd::error::eCodes status = this->inner->clearMatrixA();
+				CHECK_ECODE(status)
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::solve() {
+			cupcfd::error::eCodes status;
+
+			if(this->x.size() == 0 || this->b.size() == 0) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			if(this->mixedPrecision) {
+				status = this->solveMixedPrecision();
+				CHECK_ECODE(status)
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			this->refinementSteps = 0;
+
+			// Refresh the numeric component of the preconditioner if the matrix values have changed
+			if(this->precon != nullptr && this->preconStale) {
+				status = this->precon->update();
+				CHECK_ECODE(status)
+			}
+
+			this->preconStale = false;
+
+			switch(this->algorithm) {
+				case NATIVE_KSP_RICHARDSON:
+					status = this->solveRichardson();
+					CHECK_ECODE(status)
+					break;
+
+				case NATIVE_KSP_CG:
+				default:
+					status = this->solveCG();
+					CHECK_ECODE(status)
+					break;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::solveMulti() {
+			cupcfd::error::eCodes status;
+
+			if(this->nRHS <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			// Only the full precision serial CG path shares matrix products between right-hand-sides -
+			// other modes solve each right-hand-side in turn
+			if(this->mixedPrecision || this->algorithm != NATIVE_KSP_CG || this->distributed != nullptr) {
+				status = LinearSolverInterface<C,I,T>::solveMulti();
+				CHECK_ECODE(status)
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			if(this->precon != nullptr && this->preconStale) {
+				status = this->precon->update();
+				CHECK_ECODE(status)
+			}
+
+			this->preconStale = false;
+			this->refinementSteps = 0;
+
+			status = this->solveMultiCG();
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::getSolveStatistics(I * iterations, I * refinementSteps) {
+			*iterations = this->iterations;
+			*refinementSteps = this->refinementSteps;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::linearsolvers::LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, float>, int, float>;
+template class cupcfd::linearsolvers::LinearSolverNative<cupcfd::data_structures::SparseMatrixCOO<int, float>, int, float>;
+
+template class cupcfd::linearsolvers::LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double>;
+template class cupcfd::linearsolvers::LinearSolverNative<cupcfd::data_structures::SparseMatrixCOO<int, double>, int, double>;
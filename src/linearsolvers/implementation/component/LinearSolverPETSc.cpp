@@ -1448,6 +1448,22 @@ namespace cupcfd
 
 			return cupcfd::error::E_SUCCESS;
 		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverPETSc<C,I,T>::getSolveStatistics(I * iterations, I * refinementSteps) {
+			PetscInt its;
+
+			if (KSPGetIterationNumber(this->algSolver->petscSolver, &its)) {
+				return cupcfd::error::E_PETSC_ERROR;
+			}
+
+			*iterations = I(its);
+
+			// PETSc solves are not refined
+			*refinementSteps = 0;
+
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
@@ -0,0 +1,287 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the PreconditionerILU0 class
+ */
+
+#include "PreconditionerILU0.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		PreconditionerILU0<I,T>::PreconditionerILU0()
+		:Preconditioner<I,T>(),
+		 nLowerLevels(0),
+		 nUpperLevels(0)
+		{
+
+		}
+
+		template <class I, class T>
+		PreconditionerILU0<I,T>::~PreconditionerILU0()
+		{
+			// Vectors will cleanup themselves
+		}
+
+		// === Concrete Methods ===
+
+		template <class I, class T>
+		void PreconditionerILU0<I,T>::triangularSolve(T * r, T * z) {
+			const I * IA = &(this->matrix->IA[0]);
+			const I * JA = &(this->matrix->JA[0]);
+			const I base = this->matrix->baseIndex;
+			const T * lu = &(this->LU[0]);
+
+			// Forward Solve: Lz = r (L has a unit diagonal)
+			for(I l = 0; l < this->nLowerLevels; l++) {
+				#pragma omp parallel for schedule(static)
+				for(I ptr = this->lowerLevelXAdj[l]; ptr < this->lowerLevelXAdj[l + 1]; ptr++) {
+					I row = this->lowerLevelRows[ptr];
+					T sum = r[row];
+
+					for(I j = IA[row]; j < this->diagIndex[row]; j++) {
+						sum = sum - (lu[j] * z[JA[j] - base]);
+					}
+
+					z[row] = sum;
+				}
+			}
+
+			// Backward Solve: Uz = z
+			for(I l = 0; l < this->nUpperLevels; l++) {
+				#pragma omp parallel for schedule(static)
+				for(I ptr = this->upperLevelXAdj[l]; ptr < this->upperLevelXAdj[l + 1]; ptr++) {
+					I row = this->upperLevelRows[ptr];
+					T sum = z[row];
+
+					for(I j = this->diagIndex[row] + 1; j < IA[row + 1]; j++) {
+						sum = sum - (lu[j] * z[JA[j] - base]);
+					}
+
+					z[row] = sum / lu[this->diagIndex[row]];
+				}
+			}
+		}
+
+		// === Overridden Inherited Methods ===
+
+		template <class I, class T>
+		cupcfd::error::eCodes PreconditionerILU0<I,T>::setup(cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix) {
+			if(matrix.m != matrix.n) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+			}
+
+			this->matrix = &matrix;
+			this->nRows = matrix.m;
+			this->LU.resize(matrix.A.size());
+			this->work.resize(this->nRows);
+			this->correction.resize(this->nRows);
+
+			// Locate the diagonal entry of each row - columns are stored in ascending order,
+			// so entries before the diagonal belong to L and those after to U.
+			this->diagIndex.resize(this->nRows);
+
+			for(I i = 0; i < this->nRows; i++) {
+				this->diagIndex[i] = -1;
+
+				for(I j = matrix.IA[i]; j < matrix.IA[i+1]; j++) {
+					if((matrix.JA[j] - matrix.baseIndex) == i) {
+						this->diagIndex[i] = j;
+						break;
+					}
+				}
+
+				if(this->diagIndex[i] < 0) {
+					return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+				}
+			}
+
+			// === Build Level Schedules ===
+			std::vector<I> levels(this->nRows);
+
+			// Lower: A row depends on all rows referenced by its strictly lower entries
+			this->nLowerLevels = 0;
+			for(I i = 0; i < this->nRows; i++) {
+				I level = 0;
+
+				for(I j = matrix.IA[i]; j < this->diagIndex[i]; j++) {
+					I dep = levels[matrix.JA[j] - matrix.baseIndex] + 1;
+					if(dep > level) {
+						level = dep;
+					}
+				}
+
+				levels[i] = level;
+				if(level + 1 > this->nLowerLevels) {
+					this->nLowerLevels = level + 1;
+				}
+			}
+
+			buildLevelSchedule(&(levels[0]), this->nRows, this->nLowerLevels, this->lowerLevelXAdj, this->lowerLevelRows);
+
+			// Upper: A row depends on all rows referenced by its strictly upper entries
+			this->nUpperLevels = 0;
+			for(I i = this->nRows - 1; i >= 0; i--) {
+				I level = 0;
+
+				for(I j = this->diagIndex[i] + 1; j < matrix.IA[i+1]; j++) {
+					I dep = levels[matrix.JA[j] - matrix.baseIndex] + 1;
+					if(dep > level) {
+						level = dep;
+					}
+				}
+
+				levels[i] = level;
+				if(level + 1 > this->nUpperLevels) {
+					this->nUpperLevels = level + 1;
+				}
+			}
+
+			buildLevelSchedule(&(levels[0]), this->nRows, this->nUpperLevels, this->upperLevelXAdj, this->upperLevelRows);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PreconditionerILU0<I,T>::update() {
+			if(this->matrix == nullptr) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_PRECONDITIONER;
+			}
+
+			const I * IA = &(this->matrix->IA[0]);
+			const I * JA = &(this->matrix->JA[0]);
+			const I base = this->matrix->baseIndex;
+
+			this->LU = this->matrix->A;
+			T * lu = &(this->LU[0]);
+
+			// IKJ variant of ILU(0). Row i is only modified by rows k < i that appear in its
+			// lower part, which by construction lie in earlier lower levels - so the rows of
+			// a level can be factorised concurrently.
+			I nZeroPivots = 0;
+
+			for(I l = 0; l < this->nLowerLevels; l++) {
+				#pragma omp parallel for schedule(static) reduction(+:nZeroPivots)
+				for(I ptr = this->lowerLevelXAdj[l]; ptr < this->lowerLevelXAdj[l + 1]; ptr++) {
+					I i = this->lowerLevelRows[ptr];
+
+					for(I kk = IA[i]; kk < this->diagIndex[i]; kk++) {
+						I k = JA[kk] - base;
+						T pivot = lu[this->diagIndex[k]];
+
+						if(pivot == T(0)) {
+							nZeroPivots = nZeroPivots + 1;
+							continue;
+						}
+
+						lu[kk] = lu[kk] / pivot;
+
+						// Subtract the multiple of the upper part of row k from the remainder of row i,
+						// restricted to the existing non-zero structure of row i. Both rows are sorted
+						// by column so this is a merge.
+						I jj = kk + 1;
+						I kj = this->diagIndex[k] + 1;
+
+						while(jj < IA[i + 1] && kj < IA[k + 1]) {
+							if(JA[jj] == JA[kj]) {
+								lu[jj] = lu[jj] - (lu[kk] * lu[kj]);
+								jj = jj + 1;
+								kj = kj + 1;
+							}
+							else if(JA[jj] < JA[kj]) {
+								jj = jj + 1;
+							}
+							else {
+								kj = kj + 1;
+							}
+						}
+					}
+				}
+			}
+
+			// Check the final pivots of U
+			#pragma omp parallel for schedule(static) reduction(+:nZeroPivots)
+			for(I i = 0; i < this->nRows; i++) {
+				if(lu[this->diagIndex[i]] == T(0)) {
+					nZeroPivots = nZeroPivots + 1;
+				}
+			}
+
+			if(nZeroPivots > 0) {
+				return cupcfd::error::E_LINEARSOLVER_ZERO_PIVOT;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PreconditionerILU0<I,T>::apply(T * r, I nR, T * z, I nZ) {
+			if(this->matrix == nullptr) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_PRECONDITIONER;
+			}
+
+			if(nR != this->nRows || nZ != this->nRows) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			this->triangularSolve(r, z);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PreconditionerILU0<I,T>::smooth(T * b, I nB, T * x, I nX, I nSweeps) {
+			if(this->matrix == nullptr) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_PRECONDITIONER;
+			}
+
+			if(nB != this->nRows || nX != this->nRows) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			const I * IA = &(this->matrix->IA[0]);
+			const I * JA = &(this->matrix->JA[0]);
+			const T * A = &(this->matrix->A[0]);
+			const I base = this->matrix->baseIndex;
+			T * r = &(this->work[0]);
+			T * z = &(this->correction[0]);
+
+			// Preconditioned Richardson: x = x + (LU)^-1 (b - Ax)
+			for(I s = 0; s < nSweeps; s++) {
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < this->nRows; i++) {
+					T sum = b[i];
+
+					for(I j = IA[i]; j < IA[i + 1]; j++) {
+						sum = sum - (A[j] * x[JA[j] - base]);
+					}
+
+					r[i] = sum;
+				}
+
+				this->triangularSolve(r, z);
+
+				#pragma omp parallel for schedule(static)
+				for(I i = 0; i < this->nRows; i++) {
+					x[i] = x[i] + z[i];
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::linearsolvers::PreconditionerILU0<int, float>;
+template class cupcfd::linearsolvers::PreconditionerILU0<int, double>;
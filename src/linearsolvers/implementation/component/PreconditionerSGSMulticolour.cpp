@@ -0,0 +1,234 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the PreconditionerSGSMulticolour class
+ */
+
+#include "PreconditionerSGSMulticolour.h"
+
+#include <cstdlib>
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		PreconditionerSGSMulticolour<I,T>::PreconditionerSGSMulticolour()
+		:Preconditioner<I,T>(),
+		 nColours(0),
+		 userColouring(false)
+		{
+
+		}
+
+		template <class I, class T>
+		PreconditionerSGSMulticolour<I,T>::~PreconditionerSGSMulticolour()
+		{
+			// Vectors will cleanup themselves
+		}
+
+		// === Concrete Methods ===
+
+		template <class I, class T>
+		cupcfd::error::eCodes PreconditionerSGSMulticolour<I,T>::setColouring(I * colours, I nRowColours) {
+			// Count the number of colours in use
+			I maxColour = -1;
+			for(I i = 0; i < nRowColours; i++) {
+				if(colours[i] < 0) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				if(colours[i] > maxColour) {
+					maxColour = colours[i];
+				}
+			}
+
+			this->nColours = maxColour + 1;
+
+			// Bucket the rows by colour (counting sort, so rows within a colour stay in ascending order)
+			this->colourXAdj.assign(this->nColours + 1, 0);
+			for(I i = 0; i < nRowColours; i++) {
+				this->colourXAdj[colours[i] + 1] = this->colourXAdj[colours[i] + 1] + 1;
+			}
+
+			for(I c = 0; c < this->nColours; c++) {
+				this->colourXAdj[c + 1] = this->colourXAdj[c + 1] + this->colourXAdj[c];
+			}
+
+			std::vector<I> insertPos(this->colourXAdj.begin(), this->colourXAdj.end() - 1);
+			this->colourRows.resize(nRowColours);
+
+			for(I i = 0; i < nRowColours; i++) {
+				this->colourRows[insertPos[colours[i]]] = i;
+				insertPos[colours[i]] = insertPos[colours[i]] + 1;
+			}
+
+			this->userColouring = true;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		void PreconditionerSGSMulticolour<I,T>::sweep(T * b, T * x, bool forward) {
+			const I * IA = &(this->matrix->IA[0]);
+			const I * JA = &(this->matrix->JA[0]);
+			const T * A = &(this->matrix->A[0]);
+			const I base = this->matrix->baseIndex;
+
+			for(I k = 0; k < this->nColours; k++) {
+				I c = forward ? k : (this->nColours - 1 - k);
+				I start = this->colourXAdj[c];
+				I stop = this->colourXAdj[c + 1];
+
+				// Rows of the same colour are not coupled, so they can be relaxed concurrently
+				#pragma omp parallel for schedule(static)
+				for(I ptr = start; ptr < stop; ptr++) {
+					I row = this->colourRows[ptr];
+					T sum = b[row];
+
+					for(I j = IA[row]; j < IA[row + 1]; j++) {
+						I col = JA[j] - base;
+						if(col != row) {
+							sum = sum - (A[j] * x[col]);
+						}
+					}
+
+					x[row] = sum * this->invDiag[row];
+				}
+			}
+		}
+
+		// === Overridden Inherited Methods ===
+
+		template <class I, class T>
+		cupcfd::error::eCodes PreconditionerSGSMulticolour<I,T>::setup(cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix) {
+			if(matrix.m != matrix.n) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+			}
+
+			this->matrix = &matrix;
+			this->nRows = matrix.m;
+
+			// Locate the diagonal entry of each row
+			this->diagIndex.resize(this->nRows);
+			this->invDiag.assign(this->nRows, T(0));
+
+			for(I i = 0; i < this->nRows; i++) {
+				this->diagIndex[i] = -1;
+
+				for(I j = matrix.IA[i]; j < matrix.IA[i+1]; j++) {
+					if((matrix.JA[j] - matrix.baseIndex) == i) {
+						this->diagIndex[i] = j;
+						break;
+					}
+				}
+
+				if(this->diagIndex[i] < 0) {
+					return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+				}
+			}
+
+			if(this->userColouring) {
+				// Check the provided colouring covers the matrix
+				if((I) this->colourRows.size() != this->nRows) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+			}
+			else {
+				// No colouring provided, so colour using the non-zero structure of the matrix
+				cupcfd::data_structures::GraphColouring<I> colouring;
+				cupcfd::error::eCodes status;
+
+				status = colouring.colourGraph(&(matrix.IA[0]), &(matrix.JA[0]), this->nRows, matrix.baseIndex, (I) 1, false);
+				CHECK_ECODE(status)
+
+				status = this->setColouring(colouring.colours.data(), this->nRows);
+				CHECK_ECODE(status)
+
+				// This colouring belongs to the matrix structure, so recompute it on the next setup
+				this->userColouring = false;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PreconditionerSGSMulticolour<I,T>::update() {
+			if(this->matrix == nullptr) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_PRECONDITIONER;
+			}
+
+			I nZeroPivots = 0;
+
+			#pragma omp parallel for schedule(static) reduction(+:nZeroPivots)
+			for(I i = 0; i < this->nRows; i++) {
+				T diag = this->matrix->A[this->diagIndex[i]];
+
+				if(diag == T(0)) {
+					nZeroPivots = nZeroPivots + 1;
+				}
+				else {
+					this->invDiag[i] = T(1) / diag;
+				}
+			}
+
+			if(nZeroPivots > 0) {
+				return cupcfd::error::E_LINEARSOLVER_ZERO_PIVOT;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PreconditionerSGSMulticolour<I,T>::apply(T * r, I nR, T * z, I nZ) {
+			if(this->matrix == nullptr) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_PRECONDITIONER;
+			}
+
+			if(nR != this->nRows || nZ != this->nRows) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			// One symmetric sweep from a zero initial guess
+			#pragma omp parallel for schedule(static)
+			for(I i = 0; i < this->nRows; i++) {
+				z[i] = T(0);
+			}
+
+			this->sweep(r, z, true);
+			this->sweep(r, z, false);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PreconditionerSGSMulticolour<I,T>::smooth(T * b, I nB, T * x, I nX, I nSweeps) {
+			if(this->matrix == nullptr) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_PRECONDITIONER;
+			}
+
+			if(nB != this->nRows || nX != this->nRows) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			for(I s = 0; s < nSweeps; s++) {
+				this->sweep(b, x, true);
+				this->sweep(b, x, false);
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::linearsolvers::PreconditionerSGSMulticolour<int, float>;
+template class cupcfd::linearsolvers::PreconditionerSGSMulticolour<int, double>;
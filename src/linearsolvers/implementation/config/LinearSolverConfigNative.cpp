@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the LinearSolverConfigNative class
+ */
+
+#include "LinearSolverConfigNative.h"
+#include "Communicator.h"
+
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixCOO.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		template <class C, class I, class T>
+		LinearSolverConfigNative<C,I,T>::LinearSolverConfigNative(NativeAlgorithm solverAlg, NativePreconditioner preconType, T eTol, T rTol, I maxIterations)
+		: LinearSolverConfig<C,I,T>(),
+		  solverAlg(solverAlg),
+		  preconType(preconType),
+		  rTol(rTol),
+		  eTol(eTol),
+		  maxIterations(maxIterations),
+		  mixedPrecision(false),
+		  maxRefinements(0),
+		  innerRTol(T(0))
+		{
+
+		}
+
+		template <class C, class I, class T>
+		LinearSolverConfigNative<C,I,T>::LinearSolverConfigNative(NativeAlgorithm solverAlg, NativePreconditioner preconType, T eTol, T rTol, I maxIterations,
+																  bool mixedPrecision, I maxRefinements, T innerRTol)
+		: LinearSolverConfig<C,I,T>(),
+		  solverAlg(solverAlg),
+		  preconType(preconType),
+		  rTol(rTol),
+		  eTol(eTol),
+		  maxIterations(maxIterations),
+		  mixedPrecision(mixedPrecision),
+		  maxRefinements(maxRefinements),
+		  innerRTol(innerRTol)
+		{
+
+		}
+
+		template <class C, class I, class T>
+		LinearSolverConfigNative<C,I,T>::LinearSolverConfigNative(const LinearSolverConfigNative<C,I,T>& source)
+		{
+			*this = source;
+		}
+
+		template <class C, class I, class T>
+		LinearSolverConfigNative<C,I,T>::~LinearSolverConfigNative()
+		{
+
+		}
+
+		template <class C, class I, class T>
+		void LinearSolverConfigNative<C,I,T>::operator=(const LinearSolverConfigNative<C,I,T>& source)
+		{
+			this->eTol = source.eTol;
+			this->rTol = source.rTol;
+			this->solverAlg = source.solverAlg;
+			this->preconType = source.preconType;
+			this->maxIterations = source.maxIterations;
+			this->mixedPrecision = source.mixedPrecision;
+			this->maxRefinements = source.maxRefinements;
+			this->innerRTol = source.innerRTol;
+		}
+
+		template <class C, class I, class T>
+		LinearSolverConfigNative<C,I,T> * LinearSolverConfigNative<C,I,T>::clone()
+		{
+			return new LinearSolverConfigNative<C,I,T>(*this);
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNative<C,I,T>::buildLinearSolver(LinearSolverInterface<C,I,T> ** solverSystem,
+																					  cupcfd::data_structures::SparseMatrix<C,I,T>& matrix,
+																					  cupcfd::comm::Communicator& solverComm)
+		{
+			// The native solver is serial per communicator
+			if(solverComm.size != 1) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_COMM;
+			}
+
+			*solverSystem = new LinearSolverNative<C,I,T>(solverComm, this->solverAlg, this->preconType,
+														  this->rTol, this->eTol, this->maxIterations,
+														  this->mixedPrecision, this->maxRefinements, this->innerRTol, matrix);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNative<C,I,T>::buildLinearSolver(LinearSolverInterface<C,I,T> ** solverSystem,
+																					  cupcfd::data_structures::DistributedSparseMatrix<I,T>& matrix)
+		{
+			// Refinement is only available to the serial solver
+			if(this->mixedPrecision) {
+				return cupcfd::error::E_NOT_IMPLEMENTED;
+			}
+
+			*solverSystem = new LinearSolverNative<C,I,T>(matrix.comm, this->solverAlg, this->preconType,
+														  this->rTol, this->eTol, this->maxIterations, matrix);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::linearsolvers::LinearSolverConfigNative<cupcfd::data_structures::SparseMatrixCSR<int,float>, int, float>;
+template class cupcfd::linearsolvers::LinearSolverConfigNative<cupcfd::data_structures::SparseMatrixCSR<int,double>, int, double>;
+
+template class cupcfd::linearsolvers::LinearSolverConfigNative<cupcfd::data_structures::SparseMatrixCOO<int,float>, int, float>;
+template class cupcfd::linearsolvers::LinearSolverConfigNative<cupcfd::data_structures::SparseMatrixCOO<int,double>, int, double>;
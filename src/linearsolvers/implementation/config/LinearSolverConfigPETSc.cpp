@@ -68,6 +68,24 @@ namespace cupcfd
 
 			return cupcfd::error::E_SUCCESS;
 		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigPETSc<C,I,T>::buildLinearSolver(LinearSolverInterface<C,I,T> ** solverSystem,
+																					 cupcfd::data_structures::DistributedSparseMatrix<I,T>& matrix)
+		{
+			cupcfd::error::eCodes status;
+
+			// PETSc takes global row and column indexes - only the rows owned by this rank are set,
+			// so the structure passed to PETSc is still distributed
+			C global(matrix.nGlobalRows, matrix.nGlobalRows, 0);
+
+			status = matrix.copyToGlobal(global);
+			CHECK_ECODE(status)
+
+			*solverSystem = new LinearSolverPETSc<C,I,T>(matrix.comm, this->solverAlg, this->rTol, this->eTol, global);
+
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
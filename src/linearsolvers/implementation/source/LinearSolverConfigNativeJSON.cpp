@@ -0,0 +1,297 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Definitions for the LinearSolverConfigNativeJSON class.
+ */
+
+#include "LinearSolverConfigNativeJSON.h"
+
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixCOO.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class C, class I, class T>
+		LinearSolverConfigNativeJSON<C,I,T>::LinearSolverConfigNativeJSON(Json::Value& parseJSON)
+		:LinearSolverConfigSource<C,I,T>()
+		{
+			this->configData = parseJSON;
+		}
+
+		template <class C, class I, class T>
+		LinearSolverConfigNativeJSON<C,I,T>::~LinearSolverConfigNativeJSON()
+		{
+			// Nothing to do currently
+		}
+
+		// === Concrete Methods ===
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::getNativeAlgorithm(NativeAlgorithm * solverAlg) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("Algorithm")) {
+				// Access the correct field
+				dataSourceType = this->configData["Algorithm"];
+
+				// Check the value and return the appropriate ID
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else if(dataSourceType == "CG") {
+					*solverAlg = NATIVE_KSP_CG;
+					return cupcfd::error::E_SUCCESS;
+				}
+				else if(dataSourceType == "Richardson") {
+					*solverAlg = NATIVE_KSP_RICHARDSON;
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::getNativePreconditioner(NativePreconditioner * preconType) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("Preconditioner")) {
+				// Access the correct field
+				dataSourceType = this->configData["Preconditioner"];
+
+				// Check the value and return the appropriate ID
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else if(dataSourceType == "None") {
+					*preconType = NATIVE_PC_NONE;
+					return cupcfd::error::E_SUCCESS;
+				}
+				else if(dataSourceType == "SGSMulticolour") {
+					*preconType = NATIVE_PC_SGS_MULTICOLOUR;
+					return cupcfd::error::E_SUCCESS;
+				}
+				else if(dataSourceType == "ILU0") {
+					*preconType = NATIVE_PC_ILU0;
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::getETol(T * eTol) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("eTol")) {
+				// Access the correct field
+				dataSourceType = this->configData["eTol"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+
+				*eTol = T(dataSourceType.asDouble());
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::getRTol(T * rTol) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("rTol")) {
+				// Access the correct field
+				dataSourceType = this->configData["rTol"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+
+				*rTol = T(dataSourceType.asDouble());
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::getMaxIterations(I * maxIterations) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("MaxIterations")) {
+				// Access the correct field
+				dataSourceType = this->configData["MaxIterations"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+
+				if(dataSourceType.asInt() <= 0) {
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+
+				*maxIterations = I(dataSourceType.asInt());
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::getMixedPrecision(bool * mixedPrecision) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("MixedPrecision")) {
+				// Access the correct field
+				dataSourceType = this->configData["MixedPrecision"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+
+				if(!dataSourceType.isBool()) {
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+
+				*mixedPrecision = dataSourceType.asBool();
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::getMaxRefinements(I * maxRefinements) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("MaxRefinements")) {
+				// Access the correct field
+				dataSourceType = this->configData["MaxRefinements"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+
+				if(dataSourceType.asInt() <= 0) {
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+
+				*maxRefinements = I(dataSourceType.asInt());
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::getInnerRTol(T * innerRTol) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("InnerRTol")) {
+				// Access the correct field
+				dataSourceType = this->configData["InnerRTol"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+
+				*innerRTol = T(dataSourceType.asDouble());
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::buildLinearSolverConfig(LinearSolverConfig<C,I,T> ** linearSolverConfig) {
+			cupcfd::error::eCodes status;
+
+			NativeAlgorithm solverAlg;
+			NativePreconditioner preconType;
+			T eTol, rTol, innerRTol;
+			I maxIterations, maxRefinements;
+			bool mixedPrecision;
+
+			status = this->getNativeAlgorithm(&solverAlg);
+			CHECK_ECODE(status)
+
+			status = this->getETol(&eTol);
+			CHECK_ECODE(status)
+
+			status = this->getRTol(&rTol);
+			CHECK_ECODE(status)
+
+			// Optional Fields
+			status = this->getNativePreconditioner(&preconType);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				preconType = NATIVE_PC_NONE;
+			}
+			else {
+				CHECK_ECODE(status)
+			}
+
+			status = this->getMaxIterations(&maxIterations);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				maxIterations = 10000;
+			}
+			else {
+				CHECK_ECODE(status)
+			}
+
+			status = this->getMixedPrecision(&mixedPrecision);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				mixedPrecision = false;
+			}
+			else {
+				CHECK_ECODE(status)
+			}
+
+			status = this->getMaxRefinements(&maxRefinements);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				maxRefinements = 50;
+			}
+			else {
+				CHECK_ECODE(status)
+			}
+
+			status = this->getInnerRTol(&innerRTol);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				innerRTol = T(1e-4);
+			}
+			else {
+				CHECK_ECODE(status)
+			}
+
+			*linearSolverConfig = new LinearSolverConfigNative<C,I,T>(solverAlg, preconType, eTol, rTol, maxIterations,
+																	  mixedPrecision, maxRefinements, innerRTol);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+template class cupcfd::linearsolvers::LinearSolverConfigNativeJSON<cupcfd::data_structures::SparseMatrixCSR<int,float>, int, float>;
+template class cupcfd::linearsolvers::LinearSolverConfigNativeJSON<cupcfd::data_structures::SparseMatrixCSR<int,double>, int, double>;
+
+template class cupcfd::linearsolvers::LinearSolverConfigNativeJSON<cupcfd::data_structures::SparseMatrixCOO<int,float>, int, float>;
+template class cupcfd::linearsolvers::LinearSolverConfigNativeJSON<cupcfd::data_structures::SparseMatrixCOO<int,double>, int, double>;
@@ -13,6 +13,9 @@
 #include "LinearSolverInterface.h"
 #include "SparseMatrixCSR.h"
 #include "SparseMatrixCOO.h"
+#include "SparseMatrixBSR.h"
+
+#include <cstdlib>
 
 namespace cupcfd
 {
@@ -23,7 +26,9 @@ namespace cupcfd
 		LinearSolverInterface<C,I,T>::LinearSolverInterface(cupcfd::comm::Communicator comm, I mGlobal, I nGlobal)
 		:comm(comm),
 		 mGlobal(mGlobal),
-		 nGlobal(nGlobal)
+		 nGlobal(nGlobal),
+		 nRHS(0),
+		 multiIndexBase(0)
 		{
 
 		}
@@ -33,6 +38,129 @@ namespace cupcfd
 		{
 
 		}
+
+		// === Concrete Methods ===
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverInterface<C,I,T>::setValuesVectorsB(T ** scalars, I nRHS, I nScalars, I * indexes, I nIndexes, I indexBase) {
+			if(nScalars != nIndexes) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			if(nRHS <= 0) {
+				return cupcfd::error::E_INVALID_INDEX;
+			}
+
+			// Reset the initial guesses if the shape of the block has changed
+			if(nRHS != this->nRHS || nIndexes != I(this->multiIndexes.size())) {
+				this->multiX.assign(nRHS, std::vector<T>(nIndexes, T(0)));
+			}
+
+			this->nRHS = nRHS;
+			this->multiIndexBase = indexBase;
+			this->multiIndexes.assign(indexes, indexes + nIndexes);
+			this->multiB.resize(nRHS);
+
+			for(I k = 0; k < nRHS; k++) {
+				this->multiB[k].assign(scalars[k], scalars[k] + nScalars);
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverInterface<C,I,T>::setValuesVectorsX(T ** scalars, I nRHS, I nScalars, I * indexes, I nIndexes, I indexBase) {
+			if(nScalars != nIndexes || nRHS != this->nRHS || nIndexes != I(this->multiIndexes.size())) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			for(I i = 0; i < nIndexes; i++) {
+				if((indexes[i] - indexBase) != (this->multiIndexes[i] - this->multiIndexBase)) {
+					return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+				}
+			}
+
+			for(I k = 0; k < nRHS; k++) {
+				this->multiX[k].assign(scalars[k], scalars[k] + nScalars);
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverInterface<C,I,T>::getValuesVectorsX(T ** results, I nRHS, I * nResult) {
+			if(nRHS != this->nRHS) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			*nResult = this->multiIndexes.size();
+
+			for(I k = 0; k < nRHS; k++) {
+				results[k] = (T *) malloc(sizeof(T) * (*nResult));
+
+				for(I i = 0; i < *nResult; i++) {
+					results[k][i] = this->multiX[k][i];
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverInterface<C,I,T>::solveMulti() {
+			cupcfd::error::eCodes status;
+
+			if(this->nRHS <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			I nIndexes = this->multiIndexes.size();
+			I * indexes = &(this->multiIndexes[0]);
+
+			for(I k = 0; k < this->nRHS; k++) {
+				status = this->setValuesVectorB(&(this->multiB[k][0]), nIndexes, indexes, nIndexes, this->multiIndexBase);
+				CHECK_ECODE(status)
+
+				status = this->setValuesVectorX(&(this->multiX[k][0]), nIndexes, indexes, nIndexes, this->multiIndexBase);
+				CHECK_ECODE(status)
+
+				status = this->solve();
+				CHECK_ECODE(status)
+
+				T * result;
+				I nResult;
+				status = this->getValuesVectorX(&result, &nResult, indexes, nIndexes, this->multiIndexBase);
+				CHECK_ECODE(status)
+
+				for(I i = 0; i < nResult; i++) {
+					this->multiX[k][i] = result[i];
+				}
+
+				free(result);
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverInterface<C,I,T>::setValuesMatrixA(cupcfd::data_structures::DistributedSparseMatrix<I,T>& matrix) {
+			cupcfd::error::eCodes status;
+
+			if(!matrix.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
+			// Only the owned rows are set in the temporary, using global indexes
+			C global(matrix.nGlobalRows, matrix.nGlobalRows, 0);
+
+			status = matrix.copyToGlobal(global);
+			CHECK_ECODE(status)
+
+			status = this->setValuesMatrixA(global);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
@@ -42,3 +170,9 @@ template class cupcfd::linearsolvers::LinearSolverInterface<cupcfd::data_structu
 
 template class cupcfd::linearsolvers::LinearSolverInterface<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double>;
 template class cupcfd::linearsolvers::LinearSolverInterface<cupcfd::data_structures::SparseMatrixCOO<int, double>, int, double>;
+
+template class cupcfd::linearsolvers::LinearSolverInterface<cupcfd::data_structures::SparseMatrixBSR<int, float, 3>, int, float>;
+template class cupcfd::linearsolvers::LinearSolverInterface<cupcfd::data_structures::SparseMatrixBSR<int, float, 4>, int, float>;
+
+template class cupcfd::linearsolvers::LinearSolverInterface<cupcfd::data_structures::SparseMatrixBSR<int, double, 3>, int, double>;
+template class cupcfd::linearsolvers::LinearSolverInterface<cupcfd::data_structures::SparseMatrixBSR<int, double, 4>, int, double>;
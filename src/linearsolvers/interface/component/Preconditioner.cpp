@@ -0,0 +1,39 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the Preconditioner class
+ */
+
+#include "Preconditioner.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		Preconditioner<I,T>::Preconditioner()
+		:matrix(nullptr),
+		 nRows(0)
+		{
+
+		}
+
+		template <class I, class T>
+		Preconditioner<I,T>::~Preconditioner()
+		{
+			// The matrix is not owned by the preconditioner, so is not freed here
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::linearsolvers::Preconditioner<int, float>;
+template class cupcfd::linearsolvers::Preconditioner<int, double>;
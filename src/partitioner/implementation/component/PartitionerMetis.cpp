@@ -267,7 +267,7 @@ namespace cupcfd
 					this->nResult = this->nNodes;
 
 					for(I i = 0; i < this->nNodes; i++) {
-						this->result[i] = this->nodes[i];
+						this->result[i] = 0;
 					}
 
 					return cupcfd::error::E_SUCCESS;
@@ -277,24 +277,34 @@ namespace cupcfd
 				this->result = (I *) malloc(sizeof(I) * this->nNodes);
 				this->nResult = this->nNodes;
 
+				// METIS takes its counts and returns the partitions as idx_t, which may be wider than I
+				// (e.g. if METIS is built with 64-bit indexes), so they are passed via idx_t copies
+				idx_t nVertices = this->nNodes;
+				idx_t nParts = this->nParts;
+				std::vector<idx_t> part(this->nNodes);
+
 				// This is an external function call to the METIS library - it computes the partition.
 				// Currently does not bother with weightings
-				int ret = METIS_PartGraphKway(&(this->nNodes),
+				int ret = METIS_PartGraphKway(&nVertices,
 											  &(this->nCon),
 											  this->xadj,
 											  this->adjncy,
 											  NULL,
 											  NULL,
 											  NULL,
-											  &(this->nParts),
+											  &nParts,
 											  NULL,
 											  NULL,
 											  NULL,
 											  &(this->objval),
-											  this->result);
+											  part.data());
 				if (ret != METIS_OK) {
 					return cupcfd::error::E_METIS_ERROR;
 				}
+
+				for(I i = 0; i < this->nNodes; i++) {
+					this->result[i] = (I) part[i];
+				}
 			}
 
 			return cupcfd::error::E_SUCCESS;
@@ -343,3 +353,4 @@ namespace cupcfd
 
 // Explicit Instantiation
 template class cupcfd::partitioner::PartitionerMetis<int,int>;
+template class cupcfd::partitioner::PartitionerMetis<int,long>;
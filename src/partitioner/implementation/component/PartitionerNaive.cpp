@@ -176,3 +176,4 @@ namespace cupcfd
 
 // Explicit Instantiation
 template class cupcfd::partitioner::PartitionerNaive<int,int>;
+template class cupcfd::partitioner::PartitionerNaive<int,long>;
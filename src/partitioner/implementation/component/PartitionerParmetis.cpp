@@ -433,6 +433,11 @@ namespace cupcfd
 				adjwgt = NULL;
 			}
 
+			// ParMETIS takes its counts and returns the partitions as idx_t, which may be wider than I
+			// (e.g. if ParMETIS is built with 64-bit indexes), so they are passed via idx_t copies
+			idx_t nParts = this->nParts;
+			std::vector<idx_t> part(this->nNodes);
+
 			// === Run Partitioner ===
 			// This is an external function call to the PARMETIS library - it computes the partition.
 			int ret = ParMETIS_V3_PartKway(this->vtxdist,
@@ -443,12 +448,12 @@ namespace cupcfd
 										   &this->wgtflag,
 										   &this->numflag,
 										   &this->nCon,
-										   &this->nParts,
+										   &nParts,
 										   this->tpwgts,
 										   this->ubvec,
 										   this->options,
 										   &this->edgecut,
-										   this->result,
+										   part.data(),
 										   &(this->workComm.comm)
 										   );
 
@@ -457,6 +462,10 @@ namespace cupcfd
 				return cupcfd::error::E_PARMETIS_LIBRARY_ERROR;
 			}
 
+			for(I i = 0; i < this->nNodes; i++) {
+				this->result[i] = (I) part[i];
+			}
+
 			return cupcfd::error::E_SUCCESS;
 		}
 
@@ -505,4 +514,5 @@ namespace cupcfd
 // Explicit Instantiation
 
 template class cupcfd::partitioner::PartitionerParmetis<int,int>;
+template class cupcfd::partitioner::PartitionerParmetis<int,long>;
 
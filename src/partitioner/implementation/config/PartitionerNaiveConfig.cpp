@@ -19,6 +19,9 @@
 // Communicator
 #include "Communicator.h"
 
+// Hashing
+#include "SnapshotFile.h"
+
 namespace cupcfd
 {
 	namespace partitioner
@@ -63,9 +66,21 @@ namespace cupcfd
 
 			return cupcfd::error::E_SUCCESS;
 		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerNaiveConfig<I,T>::getConfigHash(uint64_t * hash)
+		{
+			// The naive partitioner has no settings beyond the number of parts
+			const char partType[] = "Naive";
+
+			*hash = cupcfd::io::SnapshotFile::hashBytes(partType, sizeof(partType));
+
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
 // Explicit Instantiation
 template class cupcfd::partitioner::PartitionerNaiveConfig<int, int>;
+template class cupcfd::partitioner::PartitionerNaiveConfig<int, long>;
 
@@ -19,6 +19,9 @@
 // Communicator
 #include "Communicator.h"
 
+// Hashing
+#include "SnapshotFile.h"
+
 namespace cupcfd
 {
 	namespace partitioner
@@ -63,9 +66,23 @@ namespace cupcfd
 
 			return cupcfd::error::E_SUCCESS;
 		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerParmetisConfig<I,T>::getConfigHash(uint64_t * hash)
+		{
+			// Hash the same settings that buildPartitioner passes to the partitioner
+			const char partType[] = "Parmetis";
+			int nCon = 1;
+
+			*hash = cupcfd::io::SnapshotFile::hashBytes(partType, sizeof(partType));
+			*hash = cupcfd::io::SnapshotFile::hashBytes(&nCon, sizeof(nCon), *hash);
+
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
 // Explicit Instantiation
 template class cupcfd::partitioner::PartitionerParmetisConfig<int, int>;
+template class cupcfd::partitioner::PartitionerParmetisConfig<int, long>;
 
@@ -53,3 +53,4 @@ namespace cupcfd
 
 // Explicit Instantiation
 template class cupcfd::partitioner::PartitionerMetisConfigSourceJSON<int,int>;
+template class cupcfd::partitioner::PartitionerMetisConfigSourceJSON<int,long>;
@@ -57,3 +57,4 @@ namespace cupcfd
 
 // Explicit Instantiation
 template class cupcfd::partitioner::PartitionerNaiveConfigSourceJSON<int,int>;
+template class cupcfd::partitioner::PartitionerNaiveConfigSourceJSON<int,long>;
@@ -56,3 +56,4 @@ namespace cupcfd
 
 // Explicit Instantiation
 template class cupcfd::partitioner::PartitionerParmetisConfigSourceJSON<int,int>;
+template class cupcfd::partitioner::PartitionerParmetisConfigSourceJSON<int,long>;
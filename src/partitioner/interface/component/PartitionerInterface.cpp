@@ -169,3 +169,4 @@ namespace cupcfd
 // Explicit Instantiation
 
 template class cupcfd::partitioner::PartitionerInterface<int, int>;
+template class cupcfd::partitioner::PartitionerInterface<int, long>;
@@ -33,3 +33,4 @@ namespace cupcfd
 
 // Explicit Instantiation
 template class cupcfd::partitioner::PartitionerConfig<int, int>;
+template class cupcfd::partitioner::PartitionerConfig<int, long>;
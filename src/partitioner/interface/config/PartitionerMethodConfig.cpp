@@ -69,3 +69,4 @@ namespace cupcfd
 
 // Explicit Instantiation
 template class cupcfd::partitioner::PartitionerMethodConfig<int, int>;
+template class cupcfd::partitioner::PartitionerMethodConfig<int, long>;
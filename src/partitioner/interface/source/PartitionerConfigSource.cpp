@@ -34,5 +34,6 @@ namespace cupcfd
 
 // Explicit Instantiation
 template class cupcfd::partitioner::PartitionerConfigSource<int, int>;
+template class cupcfd::partitioner::PartitionerConfigSource<int, long>;
 template class cupcfd::partitioner::PartitionerConfigSource<int, float>;
 template class cupcfd::partitioner::PartitionerConfigSource<int, double>;
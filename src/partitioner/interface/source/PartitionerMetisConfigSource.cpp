@@ -34,5 +34,6 @@ namespace cupcfd
 
 // Explicit Instantiation
 template class cupcfd::partitioner::PartitionerMetisConfigSource<int, int>;
+template class cupcfd::partitioner::PartitionerMetisConfigSource<int, long>;
 template class cupcfd::partitioner::PartitionerMetisConfigSource<int, float>;
 template class cupcfd::partitioner::PartitionerMetisConfigSource<int, double>;
@@ -34,5 +34,6 @@ namespace cupcfd
 
 // Explicit Instantiation
 template class cupcfd::partitioner::PartitionerNaiveConfigSource<int, int>;
+template class cupcfd::partitioner::PartitionerNaiveConfigSource<int, long>;
 template class cupcfd::partitioner::PartitionerNaiveConfigSource<int, float>;
 template class cupcfd::partitioner::PartitionerNaiveConfigSource<int, double>;
@@ -34,5 +34,6 @@ namespace cupcfd
 
 // Explicit Instantiation
 template class cupcfd::partitioner::PartitionerParmetisConfigSource<int, int>;
+template class cupcfd::partitioner::PartitionerParmetisConfigSource<int, long>;
 template class cupcfd::partitioner::PartitionerParmetisConfigSource<int, float>;
 template class cupcfd::partitioner::PartitionerParmetisConfigSource<int, double>;
@@ -13,17 +13,23 @@
 #include "CupCfd.h"
 #include "CupCfdAoSMesh.h"
 #include "CupCfdSoAMesh.h"
+#include "CupCfdAoSoAMesh.h"
 
 // JsonCPP - Supplied as standalone in include/io/jsoncpp
 #include "json.h"
 #include "json-forwards.h"
 
 #include <fstream>
+#include <type_traits>
 
 #include "BenchmarkKernels.h"
 #include "BenchmarkConfigKernels.h"
 #include "BenchmarkConfigKernelsJSON.h"
 
+#include "BenchmarkMatrixAssembly.h"
+#include "BenchmarkConfigMatrixAssembly.h"
+#include "BenchmarkConfigMatrixAssemblyJSON.h"
+
 #include "BenchmarkExchange.h"
 #include "BenchmarkConfigExchange.h"
 #include "BenchmarkConfigExchangeJSON.h"
@@ -32,6 +38,10 @@
 #include "BenchmarkConfigLinearSolver.h"
 #include "BenchmarkConfigLinearSolverJSON.h"
 
+#include "BenchmarkSpMV.h"
+#include "BenchmarkConfigSpMV.h"
+#include "BenchmarkConfigSpMVJSON.h"
+
 #include "BenchmarkParticleSystemSimple.h"
 #include "BenchmarkConfigParticleSystemSimple.h"
 #include "BenchmarkConfigParticleSystemSimpleJSON.h"
@@ -102,6 +112,36 @@ namespace cupcfd
 					}
 				}
 
+				// === Matrix Assembly Benchmarks ===
+				if(benchmarkConfigData.isMember("BenchmarkMatrixAssembly")) {
+					cupcfd::benchmark::BenchmarkConfigMatrixAssemblyJSON<I,T> assemblyBenchJSON(benchmarkConfigData["BenchmarkMatrixAssembly"]);
+					cupcfd::benchmark::BenchmarkConfigMatrixAssembly<I,T> * assemblyBenchConfig;
+					status = assemblyBenchJSON.buildBenchmarkConfig(&assemblyBenchConfig);
+
+					if(status != cupcfd::error::E_SUCCESS) {
+						std::cout << "Cannot Parse a Matrix Assembly Benchmark Config at " << jsonFilePath << ". Skipping.\n";
+					}
+					else {
+						if(comm.rank == 0) {
+							std::cout << "Building Matrix Assembly Benchmark\n";
+						}
+
+						cupcfd::benchmark::BenchmarkMatrixAssembly<M,I,T,L> * assemblyBench;
+						status = assemblyBenchConfig->buildBenchmark(&assemblyBench, meshPtr);
+
+						if(status != cupcfd::error::E_SUCCESS) {
+							std::cout << "Error Encountered: Failed to build Matrix Assembly Benchmark with current configuration. Please check the provided configuration is correct.\n";
+						}
+						else {
+							status = assemblyBench->runBenchmark();
+							HARD_CHECK_ECODE(status)
+							delete(assemblyBench);
+						}
+
+						delete(assemblyBenchConfig);
+					}
+				}
+
 				// === Exchange Benchmarks ===
 				if(benchmarkConfigData.isMember("BenchmarkExchange")) {
 					cupcfd::benchmark::BenchmarkConfigExchangeJSON<I,T> exchangeBenchJSON(benchmarkConfigData["BenchmarkExchange"]);
@@ -150,7 +190,7 @@ namespace cupcfd
 					}
 					else {
 						cupcfd::benchmark::BenchmarkLinearSolver<cupcfd::data_structures::SparseMatrixCSR<I,T>,I,T> * linearSolverBench;
-						status = linearSolverBenchConfig->buildBenchmark(&linearSolverBench);
+						status = linearSolverBenchConfig->buildBenchmark(&linearSolverBench, *meshPtr);
 
 						if(status != cupcfd::error::E_SUCCESS) {
 							std::cout << "Error Encountered: Failed to build Linear Solver Benchmark with current configuration. Please check the provided configuration is correct.\n";
@@ -165,36 +205,74 @@ namespace cupcfd
 					}
 				}
 
-				// === Particle Benchmarks ===
-				if(benchmarkConfigData.isMember("BenchmarkParticleSystem")) {
+				// === SpMV Benchmarks ===
+				if(benchmarkConfigData.isMember("BenchmarkSpMV")) {
 					if(comm.rank == 0) {
-						std::cout << "Building Simple Particle Benchmark\n";
+						std::cout << "Building SpMV Benchmark\n";
 					}
 
-					// Test for a Particle Simple System Benchmark
-					cupcfd::benchmark::BenchmarkConfigParticleSystemSimpleJSON<M,I,T,L> particleSystemJSON(benchmarkConfigData["BenchmarkParticleSystem"]);
-
-					// Build Config
-					cupcfd::benchmark::BenchmarkConfigParticleSystemSimple<M,I,T,L> * particleSystemConfig;
-					status = particleSystemJSON.buildBenchmarkConfig(&particleSystemConfig);
+					cupcfd::benchmark::BenchmarkConfigSpMVJSON<I,T> spmvBenchJSON(benchmarkConfigData["BenchmarkSpMV"]);
+					cupcfd::benchmark::BenchmarkConfigSpMV<I,T> * spmvBenchConfig;
+					status = spmvBenchJSON.buildBenchmarkConfig(&spmvBenchConfig);
 
 					if(status != cupcfd::error::E_SUCCESS) {
-						std::cout << "Cannot Parse a Particle Benchmark Config at " << jsonFilePath << ". Skipping.\n";
+						std::cout << "Cannot Parse a SpMV Benchmark Config at " << jsonFilePath << ". Skipping.\n";
 					}
 					else {
-						cupcfd::benchmark::BenchmarkParticleSystemSimple<M,I,T,L> * benchmarkParticleSystem;
-						status = particleSystemConfig->buildBenchmark(&benchmarkParticleSystem, meshPtr);
+						cupcfd::benchmark::BenchmarkSpMV<I,T> * spmvBench;
+						status = spmvBenchConfig->buildBenchmark(&spmvBench);
 
 						if(status != cupcfd::error::E_SUCCESS) {
-							std::cout << "Error Encountered: Failed to build Simple Particle Benchmark with current configuration. Please check the provided configuration is correct.\n";
+							std::cout << "Error Encountered: Failed to build SpMV Benchmark with current configuration. Please check the provided configuration is correct.\n";
 						}
 						else {
-							status = benchmarkParticleSystem->runBenchmark();
+							status = spmvBench->runBenchmark();
 							HARD_CHECK_ECODE(status)
-							delete(benchmarkParticleSystem);
+							delete(spmvBench);
+						}
+
+						delete(spmvBenchConfig);
+					}
+				}
+
+				// === Particle Benchmarks ===
+				if(benchmarkConfigData.isMember("BenchmarkParticleSystem")) {
+					// The particle system only supports meshes with int labels
+					if constexpr(!std::is_same<L,int>::value) {
+						if(comm.rank == 0) {
+							std::cout << "Particle Benchmarks require int mesh labels. Skipping.\n";
+						}
+					}
+					else {
+						if(comm.rank == 0) {
+							std::cout << "Building Simple Particle Benchmark\n";
 						}
 
-						delete(particleSystemConfig);
+						// Test for a Particle Simple System Benchmark
+						cupcfd::benchmark::BenchmarkConfigParticleSystemSimpleJSON<M,I,T,L> particleSystemJSON(benchmarkConfigData["BenchmarkParticleSystem"]);
+
+						// Build Config
+						cupcfd::benchmark::BenchmarkConfigParticleSystemSimple<M,I,T,L> * particleSystemConfig;
+						status = particleSystemJSON.buildBenchmarkConfig(&particleSystemConfig);
+
+						if(status != cupcfd::error::E_SUCCESS) {
+							std::cout << "Cannot Parse a Particle Benchmark Config at " << jsonFilePath << ". Skipping.\n";
+						}
+						else {
+							cupcfd::benchmark::BenchmarkParticleSystemSimple<M,I,T,L> * benchmarkParticleSystem;
+							status = particleSystemConfig->buildBenchmark(&benchmarkParticleSystem, meshPtr);
+
+							if(status != cupcfd::error::E_SUCCESS) {
+								std::cout << "Error Encountered: Failed to build Simple Particle Benchmark with current configuration. Please check the provided configuration is correct.\n";
+							}
+							else {
+								status = benchmarkParticleSystem->runBenchmark();
+								HARD_CHECK_ECODE(status)
+								delete(benchmarkParticleSystem);
+							}
+
+							delete(particleSystemConfig);
+						}
 					}
 				}
 
@@ -215,3 +293,10 @@ template class cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSMesh<int,double,i
 
 template class cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdSoAMesh<int,float,int>, int, float, int>;
 template class cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdSoAMesh<int,double,int>, int, double, int>;
+template class cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSoAMesh<int,float,int,CUPCFD_AOSOA_MESH_TILE_WIDTH>, int, float, int>;
+template class cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSoAMesh<int,double,int,CUPCFD_AOSOA_MESH_TILE_WIDTH>, int, double, int>;
+
+template class cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSMesh<int,float,long>, int, float, long>;
+template class cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSMesh<int,double,long>, int, double, long>;
+template class cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdSoAMesh<int,float,long>, int, float, long>;
+template class cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdSoAMesh<int,double,long>, int, double, long>;
@@ -99,6 +99,40 @@ namespace cupcfd
 				*dataType = MESH_DATATYPE_MINISOA;
 				return cupcfd::error::E_SUCCESS;
 			}
+			else if(dataSourceType.asString() == "MiniAoSoA")
+			{
+				*dataType = MESH_DATATYPE_MINIAOSOA;
+				return cupcfd::error::E_SUCCESS;
+			}
+			// Found, but not a matching value
+
+			return cupcfd::error::E_CONFIG_INVALID_VALUE;
+		}
+
+		return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+	}
+
+	cupcfd::error::eCodes SystemConfigJSON::getLabelDataType(labelDataType * dataType)
+	{
+		if(this->configData.isMember("LabelDataType"))
+		{
+			const Json::Value dataSourceType = this->configData["LabelDataType"];
+
+			if(dataSourceType == Json::Value::null)
+			{
+				return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+			}
+			else if(dataSourceType.asString() == "int")
+			{
+				*dataType = LABEL_DATATYPE_INT;
+				return cupcfd::error::E_SUCCESS;
+			}
+			else if(dataSourceType.asString() == "long")
+			{
+				*dataType = LABEL_DATATYPE_LONG;
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			// Found, but not a matching value
 
 			return cupcfd::error::E_CONFIG_INVALID_VALUE;
@@ -17,8 +17,11 @@
 #include "MeshConfig.h"
 #include "CupCfdAoSMesh.h"
 #include "CupCfdSoAMesh.h"
+#include "CupCfdAoSoAMesh.h"
 
 #include "Communicator.h"
+#include "Reduce.h"
+#include "MemoryDrivers.h"
 
 #include "Benchmark.h"
 
@@ -67,6 +70,88 @@
 
 namespace mesh = cupcfd::geometry::mesh;
 
+/**
+ * Print the largest peak resident set size of any rank while the mesh data was loaded, and
+ * of the process so far (which also includes the partitioning and finalize stages), along with
+ * the longest time taken by any rank to derive the face geometry at finalize, and the largest
+ * heap memory of any rank held by the build ID maps of the mesh and the node maps of its cell graph.
+ *
+ * All ranks of comm must call this.
+ */
+template <class M>
+void reportMeshBuildCost(M& mesh, cupcfd::comm::Communicator& comm) {
+	cupcfd::error::eCodes status;
+	double localCost[5];
+	double globalCost[5];
+
+	localCost[0] = mesh.buildPeakRSS / (1024.0 * 1024.0);
+	localCost[1] = cupcfd::utility::drivers::getPeakRSS() / (1024.0 * 1024.0);
+	localCost[2] = mesh.faceGeometryTime;
+	localCost[3] = mesh.getBuildMapMemoryBytes() / (1024.0 * 1024.0);
+	localCost[4] = mesh.cellConnGraph->getMapMemoryBytes() / (1024.0 * 1024.0);
+
+	status = cupcfd::comm::allReduceMax(localCost, 5, globalCost, 5, comm);
+	if(status == cupcfd::error::E_SUCCESS && comm.rank == 0) {
+		std::cout << "Mesh Build Peak RSS (Max over Ranks): " << globalCost[0] << " MiB while loading, "
+				  << globalCost[1] << " MiB overall\n";
+		std::cout << "Mesh Face Geometry Time (Max over Ranks): " << globalCost[2] << " s\n";
+		std::cout << "Mesh Map Memory (Max over Ranks): " << globalCost[3] << " MiB build ID maps, "
+				  << globalCost[4] << " MiB cell graph maps\n";
+	}
+}
+
+/**
+ * Print the number of pages of the mesh arrays held on each NUMA node, summed over all ranks,
+ * to check the placement made by the parallel first touch of the mesh stores. The pages are
+ * located with a query-only move_pages call, so numactl/libnuma are not needed.
+ *
+ * All ranks of comm must call this.
+ */
+template <class M>
+void reportPagePlacement(M& mesh, cupcfd::comm::Communicator& comm) {
+	cupcfd::error::eCodes status;
+	std::vector<std::size_t> nodePages;
+	std::size_t nUnplaced = 0;
+
+	// Agree on the number of nodes, and whether any rank could not query its pages
+	double localInfo[2];
+	double globalInfo[2];
+
+	status = mesh.getPagePlacement(nodePages, &nUnplaced);
+	localInfo[0] = (double) nodePages.size();
+	localInfo[1] = (status == cupcfd::error::E_SUCCESS) ? 0.0 : 1.0;
+
+	status = cupcfd::comm::allReduceMax(localInfo, 2, globalInfo, 2, comm);
+	if(status != cupcfd::error::E_SUCCESS) {
+		return;
+	}
+
+	if(globalInfo[1] > 0.0) {
+		if(comm.rank == 0) {
+			std::cout << "Mesh Page Placement: Unavailable (move_pages is not supported on this system)\n";
+		}
+		return;
+	}
+
+	int nNodes = (int) globalInfo[0];
+	std::vector<double> localPages(nNodes + 1, 0.0);
+	std::vector<double> globalPages(nNodes + 1, 0.0);
+
+	for(std::size_t i = 0; i < nodePages.size(); i++) {
+		localPages[i] = (double) nodePages[i];
+	}
+	localPages[nNodes] = (double) nUnplaced;
+
+	status = cupcfd::comm::allReduceAdd(localPages.data(), nNodes + 1, globalPages.data(), nNodes + 1, comm);
+	if(status == cupcfd::error::E_SUCCESS && comm.rank == 0) {
+		std::cout << "Mesh Page Placement (Pages Summed over Ranks):";
+		for(int i = 0; i < nNodes; i++) {
+			std::cout << " Node " << i << ": " << (std::size_t) globalPages[i] << ",";
+		}
+		std::cout << " Untouched: " << (std::size_t) globalPages[nNodes] << "\n";
+	}
+}
+
 int main (int argc, char ** argv)
 {
 	cupcfd::error::eCodes status;
@@ -135,6 +220,7 @@ int main (int argc, char ** argv)
 	cupcfd::intDataType iData = cupcfd::INT_DATATYPE_INT;
 	cupcfd::floatingDataType fData = cupcfd::FLOAT_DATATYPE_FLOAT;
 	cupcfd::meshDataType mData = cupcfd::MESH_DATATYPE_MINIAOS;
+	cupcfd::labelDataType lData = cupcfd::LABEL_DATATYPE_INT;
 
 	Json::Value configData;
 	std::ifstream source(configPath, std::ifstream::binary);
@@ -167,13 +253,28 @@ int main (int argc, char ** argv)
 				std::cout << "Warning: Could not read Mesh Datatype from JSON. Using Default Mesh Type of CupCfdAoS";
 			}
 		}
+
+		// Optional, so only warn if it is present but not recognised
+		status = dataTypeJSON.getLabelDataType(&lData);
+		if(status == cupcfd::error::E_CONFIG_INVALID_VALUE) {
+			if(comm.rank == 0) {
+				std::cout << "Warning: Could not read Label Datatype from JSON. Using Default Label Type of int";
+			}
+		}
+	}
+
+	// Optionally report where the pages of the mesh arrays were placed
+	bool reportPlacement = false;
+
+	if(configData.isMember("ReportPagePlacement")) {
+		reportPlacement = configData["ReportPagePlacement"].asBool();
 	}
 
 	// === Mesh ====
 
 	// Downside of CRTP - need to know types at compile time, so we're forced to have multiple branches here.
 	// May figure out a while to do this in a more reusable fashion at another time
-	if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_DOUBLE && mData == cupcfd::MESH_DATATYPE_MINIAOS) {
+	if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_DOUBLE && mData == cupcfd::MESH_DATATYPE_MINIAOS && lData == cupcfd::LABEL_DATATYPE_INT) {
 		// Mesh is reused across multiple components, so it is loaded as its own configuration step
 		// Mesh Config Source
 		std::string topLevel[0] = {};
@@ -209,6 +310,12 @@ int main (int argc, char ** argv)
 			return -1;
 		}
 
+		reportMeshBuildCost(*mesh, comm);
+
+		if(reportPlacement) {
+			reportPagePlacement(*mesh, comm);
+		}
+
 		// ToDo: Should only ever exist as a shared pointer, not a raw pointer, but this is the only instance for now
 		// so convert to a shared pointer and never use the raw pointer again (even for deleting)
 		// This needs to be shared for safely passing around the mesh
@@ -221,7 +328,7 @@ int main (int argc, char ** argv)
 
 		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSMesh<int,double,int>,int,double,int> run(configPath, meshPtr);
 	}
-	else if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_FLOAT && mData == cupcfd::MESH_DATATYPE_MINIAOS) {
+	else if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_FLOAT && mData == cupcfd::MESH_DATATYPE_MINIAOS && lData == cupcfd::LABEL_DATATYPE_INT) {
 		// Mesh is reused across multiple components, so it is loaded as its own configuration step
 		// Mesh Config Source
 		std::string topLevel[0] = {};
@@ -257,6 +364,12 @@ int main (int argc, char ** argv)
 			return -1;
 		}
 
+		reportMeshBuildCost(*mesh, comm);
+
+		if(reportPlacement) {
+			reportPagePlacement(*mesh, comm);
+		}
+
 		// ToDo: Should only ever exist as a shared pointer, not a raw pointer, but this is the only instance for now
 		// so convert to a shared pointer and never use the raw pointer again (even for deleting)
 		// This needs to be shared for safely passing around the mesh
@@ -269,7 +382,7 @@ int main (int argc, char ** argv)
 
 		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSMesh<int,float,int>,int,float,int> run(configPath, meshPtr);
 	}
-	else if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_DOUBLE && mData == cupcfd::MESH_DATATYPE_MINISOA) {
+	else if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_DOUBLE && mData == cupcfd::MESH_DATATYPE_MINISOA && lData == cupcfd::LABEL_DATATYPE_INT) {
 		// Mesh is reused across multiple components, so it is loaded as its own configuration step
 		// Mesh Config Source
 		std::string topLevel[0] = {};
@@ -305,6 +418,12 @@ int main (int argc, char ** argv)
 			return -1;
 		}
 
+		reportMeshBuildCost(*mesh, comm);
+
+		if(reportPlacement) {
+			reportPagePlacement(*mesh, comm);
+		}
+
 		// ToDo: Should only ever exist as a shared pointer, not a raw pointer, but this is the only instance for now
 		// so convert to a shared pointer and never use the raw pointer again (even for deleting)
 		// This needs to be shared for safely passing around the mesh
@@ -317,7 +436,7 @@ int main (int argc, char ** argv)
 
 		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdSoAMesh<int,double,int>,int,double,int> run(configPath, meshPtr);
 	}
-	else if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_FLOAT && mData == cupcfd::MESH_DATATYPE_MINISOA) {
+	else if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_FLOAT && mData == cupcfd::MESH_DATATYPE_MINISOA && lData == cupcfd::LABEL_DATATYPE_INT) {
 		// Mesh is reused across multiple components, so it is loaded as its own configuration step
 		// Mesh Config Source
 		std::string topLevel[0] = {};
@@ -353,6 +472,12 @@ int main (int argc, char ** argv)
 			return -1;
 		}
 
+		reportMeshBuildCost(*mesh, comm);
+
+		if(reportPlacement) {
+			reportPagePlacement(*mesh, comm);
+		}
+
 		// ToDo: Should only ever exist as a shared pointer, not a raw pointer, but this is the only instance for now
 		// so convert to a shared pointer and never use the raw pointer again (even for deleting)
 		// This needs to be shared for safely passing around the mesh
@@ -366,6 +491,337 @@ int main (int argc, char ** argv)
 		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdSoAMesh<int,float,int>,int,float,int> run(configPath, meshPtr);
 	}
 
+	else if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_DOUBLE && mData == cupcfd::MESH_DATATYPE_MINIAOSOA && lData == cupcfd::LABEL_DATATYPE_INT) {
+		// Mesh is reused across multiple components, so it is loaded as its own configuration step
+		// Mesh Config Source
+		std::string topLevel[0] = {};
+		cupcfd::geometry::mesh::MeshConfigSourceJSON<int, double, int> configFile(configPath, topLevel, 0);
+
+		// Build Mesh Config
+		cupcfd::geometry::mesh::MeshConfig<int,double,int> * meshConfig;
+		status = configFile.buildMeshConfig(&meshConfig);
+		if(status != cupcfd::error::E_SUCCESS) {
+			std::cout << "Error Encountered: Cannot Parse a JSON Mesh Configuration at " << configPath << "\n";
+			std::cout << "Ending Benchmarking\n";
+			int ierr = -1;
+			TreeTimerFinalize();
+			PetscFinalize();
+			MPI_Abort(MPI_COMM_WORLD, ierr);
+			return -1;
+		}
+
+		// Build Mesh
+		if(comm.rank == 0) {
+			std::cout << "Building Mesh\n";
+		}
+
+		mesh::CupCfdAoSoAMesh<int, double, int, CUPCFD_AOSOA_MESH_TILE_WIDTH> * mesh;
+		status = meshConfig->buildUnstructuredMesh(&mesh, comm);
+		if(status != cupcfd::error::E_SUCCESS) {
+			std::cout << "Error Encountered: Failed to build Mesh with current configuration. Please check the provided configuration is correct.\n";
+			std::cout << "Ending Benchmarking\n";
+			int ierr = -1;
+			TreeTimerFinalize();
+			PetscFinalize();
+			MPI_Abort(MPI_COMM_WORLD, ierr);
+			return -1;
+		}
+
+		reportMeshBuildCost(*mesh, comm);
+
+		if(reportPlacement) {
+			reportPagePlacement(*mesh, comm);
+		}
+
+		// ToDo: Should only ever exist as a shared pointer, not a raw pointer, but this is the only instance for now
+		// so convert to a shared pointer and never use the raw pointer again (even for deleting)
+		// This needs to be shared for safely passing around the mesh
+		std::shared_ptr<mesh::CupCfdAoSoAMesh<int, double, int, CUPCFD_AOSOA_MESH_TILE_WIDTH>> meshPtr(mesh);
+
+		// === Benchmarking System ===
+		// This should create and setup the top level structure that will contain the benchmarks, state etc.
+		// ToDo: For now, it is hard-coded to read from a JSON file (by passing the path), but it should technically
+		// be moved out to get input from a generic 'source' structure.
+
+		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSoAMesh<int,double,int,CUPCFD_AOSOA_MESH_TILE_WIDTH>,int,double,int> run(configPath, meshPtr);
+	}
+	else if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_FLOAT && mData == cupcfd::MESH_DATATYPE_MINIAOSOA && lData == cupcfd::LABEL_DATATYPE_INT) {
+		// Mesh is reused across multiple components, so it is loaded as its own configuration step
+		// Mesh Config Source
+		std::string topLevel[0] = {};
+		cupcfd::geometry::mesh::MeshConfigSourceJSON<int, float, int> configFile(configPath, topLevel, 0);
+
+		// Build Mesh Config
+		cupcfd::geometry::mesh::MeshConfig<int,float,int> * meshConfig;
+		status = configFile.buildMeshConfig(&meshConfig);
+		if(status != cupcfd::error::E_SUCCESS) {
+			std::cout << "Error Encountered: Cannot Parse a JSON Mesh Configuration at " << configPath << "\n";
+			std::cout << "Ending Benchmarking\n";
+			int ierr = -1;
+			TreeTimerFinalize();
+			PetscFinalize();
+			MPI_Abort(MPI_COMM_WORLD, ierr);
+			return -1;
+		}
+
+		// Build Mesh
+		if(comm.rank == 0) {
+			std::cout << "Building Mesh\n";
+		}
+
+		mesh::CupCfdAoSoAMesh<int, float, int, CUPCFD_AOSOA_MESH_TILE_WIDTH> * mesh;
+		status = meshConfig->buildUnstructuredMesh(&mesh, comm);
+		if(status != cupcfd::error::E_SUCCESS) {
+			std::cout << "Error Encountered: Failed to build Mesh with current configuration. Please check the provided configuration is correct.\n";
+			std::cout << "Ending Benchmarking\n";
+			int ierr = -1;
+			TreeTimerFinalize();
+			PetscFinalize();
+			MPI_Abort(MPI_COMM_WORLD, ierr);
+			return -1;
+		}
+
+		reportMeshBuildCost(*mesh, comm);
+
+		if(reportPlacement) {
+			reportPagePlacement(*mesh, comm);
+		}
+
+		// ToDo: Should only ever exist as a shared pointer, not a raw pointer, but this is the only instance for now
+		// so convert to a shared pointer and never use the raw pointer again (even for deleting)
+		// This needs to be shared for safely passing around the mesh
+		std::shared_ptr<mesh::CupCfdAoSoAMesh<int, float, int, CUPCFD_AOSOA_MESH_TILE_WIDTH>> meshPtr(mesh);
+
+		// === Benchmarking System ===
+		// This should create and setup the top level structure that will contain the benchmarks, state etc.
+		// ToDo: For now, it is hard-coded to read from a JSON file (by passing the path), but it should technically
+		// be moved out to get input from a generic 'source' structure.
+
+		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSoAMesh<int,float,int,CUPCFD_AOSOA_MESH_TILE_WIDTH>,int,float,int> run(configPath, meshPtr);
+	}
+
+	else if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_DOUBLE && mData == cupcfd::MESH_DATATYPE_MINIAOS && lData == cupcfd::LABEL_DATATYPE_LONG) {
+		// Mesh is reused across multiple components, so it is loaded as its own configuration step
+		// Mesh Config Source
+		std::string topLevel[0] = {};
+		cupcfd::geometry::mesh::MeshConfigSourceJSON<int, double, long> configFile(configPath, topLevel, 0);
+
+		// Build Mesh Config
+		cupcfd::geometry::mesh::MeshConfig<int,double,long> * meshConfig;
+		status = configFile.buildMeshConfig(&meshConfig);
+		if(status != cupcfd::error::E_SUCCESS) {
+			std::cout << "Error Encountered: Cannot Parse a JSON Mesh Configuration at " << configPath << "\n";
+			std::cout << "Ending Benchmarking\n";
+			int ierr = -1;
+			TreeTimerFinalize();
+			PetscFinalize();
+			MPI_Abort(MPI_COMM_WORLD, ierr);
+			return -1;
+		}
+
+		// Build Mesh
+		if(comm.rank == 0) {
+			std::cout << "Building Mesh\n";
+		}
+
+		mesh::CupCfdAoSMesh<int, double, long> * mesh;
+		status = meshConfig->buildUnstructuredMesh(&mesh, comm);
+		if(status != cupcfd::error::E_SUCCESS) {
+			std::cout << "Error Encountered: Failed to build Mesh with current configuration. Please check the provided configuration is correct.\n";
+			std::cout << "Ending Benchmarking\n";
+			int ierr = -1;
+			TreeTimerFinalize();
+			PetscFinalize();
+			MPI_Abort(MPI_COMM_WORLD, ierr);
+			return -1;
+		}
+
+		reportMeshBuildCost(*mesh, comm);
+
+		if(reportPlacement) {
+			reportPagePlacement(*mesh, comm);
+		}
+
+		// ToDo: Should only ever exist as a shared pointer, not a raw pointer, but this is the only instance for now
+		// so convert to a shared pointer and never use the raw pointer again (even for deleting)
+		// This needs to be shared for safely passing around the mesh
+		std::shared_ptr<mesh::CupCfdAoSMesh<int, double, long>> meshPtr(mesh);
+
+		// === Benchmarking System ===
+		// This should create and setup the top level structure that will contain the benchmarks, state etc.
+		// ToDo: For now, it is hard-coded to read from a JSON file (by passing the path), but it should technically
+		// be moved out to get input from a generic 'source' structure.
+
+		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSMesh<int,double,long>,int,double,long> run(configPath, meshPtr);
+	}
+	else if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_FLOAT && mData == cupcfd::MESH_DATATYPE_MINIAOS && lData == cupcfd::LABEL_DATATYPE_LONG) {
+		// Mesh is reused across multiple components, so it is loaded as its own configuration step
+		// Mesh Config Source
+		std::string topLevel[0] = {};
+		cupcfd::geometry::mesh::MeshConfigSourceJSON<int, float, long> configFile(configPath, topLevel, 0);
+
+		// Build Mesh Config
+		cupcfd::geometry::mesh::MeshConfig<int,float,long> * meshConfig;
+		status = configFile.buildMeshConfig(&meshConfig);
+		if(status != cupcfd::error::E_SUCCESS) {
+			std::cout << "Error Encountered: Cannot Parse a JSON Mesh Configuration at " << configPath << "\n";
+			std::cout << "Ending Benchmarking\n";
+			int ierr = -1;
+			TreeTimerFinalize();
+			PetscFinalize();
+			MPI_Abort(MPI_COMM_WORLD, ierr);
+			return -1;
+		}
+
+		// Build Mesh
+		if(comm.rank == 0) {
+			std::cout << "Building Mesh\n";
+		}
+
+		mesh::CupCfdAoSMesh<int, float, long> * mesh;
+		status = meshConfig->buildUnstructuredMesh(&mesh, comm);
+		if(status != cupcfd::error::E_SUCCESS) {
+			std::cout << "Error Encountered: Failed to build Mesh with current configuration. Please check the provided configuration is correct.\n";
+			std::cout << "Ending Benchmarking\n";
+			int ierr = -1;
+			TreeTimerFinalize();
+			PetscFinalize();
+			MPI_Abort(MPI_COMM_WORLD, ierr);
+			return -1;
+		}
+
+		reportMeshBuildCost(*mesh, comm);
+
+		if(reportPlacement) {
+			reportPagePlacement(*mesh, comm);
+		}
+
+		// ToDo: Should only ever exist as a shared pointer, not a raw pointer, but this is the only instance for now
+		// so convert to a shared pointer and never use the raw pointer again (even for deleting)
+		// This needs to be shared for safely passing around the mesh
+		std::shared_ptr<mesh::CupCfdAoSMesh<int, float, long>> meshPtr(mesh);
+
+		// === Benchmarking System ===
+		// This should create and setup the top level structure that will contain the benchmarks, state etc.
+		// ToDo: For now, it is hard-coded to read from a JSON file (by passing the path), but it should technically
+		// be moved out to get input from a generic 'source' structure.
+
+		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSMesh<int,float,long>,int,float,long> run(configPath, meshPtr);
+	}
+	else if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_DOUBLE && mData == cupcfd::MESH_DATATYPE_MINISOA && lData == cupcfd::LABEL_DATATYPE_LONG) {
+		// Mesh is reused across multiple components, so it is loaded as its own configuration step
+		// Mesh Config Source
+		std::string topLevel[0] = {};
+		cupcfd::geometry::mesh::MeshConfigSourceJSON<int, double, long> configFile(configPath, topLevel, 0);
+
+		// Build Mesh Config
+		cupcfd::geometry::mesh::MeshConfig<int,double,long> * meshConfig;
+		status = configFile.buildMeshConfig(&meshConfig);
+		if(status != cupcfd::error::E_SUCCESS) {
+			std::cout << "Error Encountered: Cannot Parse a JSON Mesh Configuration at " << configPath << "\n";
+			std::cout << "Ending Benchmarking\n";
+			int ierr = -1;
+			TreeTimerFinalize();
+			PetscFinalize();
+			MPI_Abort(MPI_COMM_WORLD, ierr);
+			return -1;
+		}
+
+		// Build Mesh
+		if(comm.rank == 0) {
+			std::cout << "Building Mesh\n";
+		}
+
+		mesh::CupCfdSoAMesh<int, double, long> * mesh;
+		status = meshConfig->buildUnstructuredMesh(&mesh, comm);
+		if(status != cupcfd::error::E_SUCCESS) {
+			std::cout << "Error Encountered: Failed to build Mesh with current configuration. Please check the provided configuration is correct.\n";
+			std::cout << "Ending Benchmarking\n";
+			int ierr = -1;
+			TreeTimerFinalize();
+			PetscFinalize();
+			MPI_Abort(MPI_COMM_WORLD, ierr);
+			return -1;
+		}
+
+		reportMeshBuildCost(*mesh, comm);
+
+		if(reportPlacement) {
+			reportPagePlacement(*mesh, comm);
+		}
+
+		// ToDo: Should only ever exist as a shared pointer, not a raw pointer, but this is the only instance for now
+		// so convert to a shared pointer and never use the raw pointer again (even for deleting)
+		// This needs to be shared for safely passing around the mesh
+		std::shared_ptr<mesh::CupCfdSoAMesh<int, double, long>> meshPtr(mesh);
+
+		// === Benchmarking System ===
+		// This should create and setup the top level structure that will contain the benchmarks, state etc.
+		// ToDo: For now, it is hard-coded to read from a JSON file (by passing the path), but it should technically
+		// be moved out to get input from a generic 'source' structure.
+
+		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdSoAMesh<int,double,long>,int,double,long> run(configPath, meshPtr);
+	}
+	else if(iData == cupcfd::INT_DATATYPE_INT && fData == cupcfd::FLOAT_DATATYPE_FLOAT && mData == cupcfd::MESH_DATATYPE_MINISOA && lData == cupcfd::LABEL_DATATYPE_LONG) {
+		// Mesh is reused across multiple components, so it is loaded as its own configuration step
+		// Mesh Config Source
+		std::string topLevel[0] = {};
+		cupcfd::geometry::mesh::MeshConfigSourceJSON<int, float, long> configFile(configPath, topLevel, 0);
+
+		// Build Mesh Config
+		cupcfd::geometry::mesh::MeshConfig<int,float,long> * meshConfig;
+		status = configFile.buildMeshConfig(&meshConfig);
+		if(status != cupcfd::error::E_SUCCESS) {
+			std::cout << "Error Encountered: Cannot Parse a JSON Mesh Configuration at " << configPath << "\n";
+			std::cout << "Ending Benchmarking\n";
+			int ierr = -1;
+			TreeTimerFinalize();
+			PetscFinalize();
+			MPI_Abort(MPI_COMM_WORLD, ierr);
+			return -1;
+		}
+
+		// Build Mesh
+		if(comm.rank == 0) {
+			std::cout << "Building Mesh\n";
+		}
+
+		mesh::CupCfdSoAMesh<int, float, long> * mesh;
+		status = meshConfig->buildUnstructuredMesh(&mesh, comm);
+		if(status != cupcfd::error::E_SUCCESS) {
+			std::cout << "Error Encountered: Failed to build Mesh with current configuration. Please check the provided configuration is correct.\n";
+			std::cout << "Ending Benchmarking\n";
+			int ierr = -1;
+			TreeTimerFinalize();
+			PetscFinalize();
+			MPI_Abort(MPI_COMM_WORLD, ierr);
+			return -1;
+		}
+
+		reportMeshBuildCost(*mesh, comm);
+
+		if(reportPlacement) {
+			reportPagePlacement(*mesh, comm);
+		}
+
+		// ToDo: Should only ever exist as a shared pointer, not a raw pointer, but this is the only instance for now
+		// so convert to a shared pointer and never use the raw pointer again (even for deleting)
+		// This needs to be shared for safely passing around the mesh
+		std::shared_ptr<mesh::CupCfdSoAMesh<int, float, long>> meshPtr(mesh);
+
+		// === Benchmarking System ===
+		// This should create and setup the top level structure that will contain the benchmarks, state etc.
+		// ToDo: For now, it is hard-coded to read from a JSON file (by passing the path), but it should technically
+		// be moved out to get input from a generic 'source' structure.
+
+		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdSoAMesh<int,float,long>,int,float,long> run(configPath, meshPtr);
+	}
+	else {
+		if(comm.rank == 0) {
+			std::cout << "Error Encountered: The selected combination of DataTypes is not supported\n";
+		}
+	}
+
 	// Deregister the Custom MPI Types
 	status = particle.deregisterMPIType();
 	if (status != cupcfd::error::E_SUCCESS) {
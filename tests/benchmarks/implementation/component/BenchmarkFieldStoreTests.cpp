@@ -0,0 +1,189 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the BenchmarkFieldStore class
+ */
+
+#define BOOST_TEST_MODULE BenchmarkFieldStore
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+#include <cstdint>
+
+#include "BenchmarkFieldStore.h"
+#include "EuclideanVector.h"
+#include "Error.h"
+
+using namespace cupcfd::benchmark;
+
+namespace euc = cupcfd::geometry::euclidean;
+
+// === Constructor ===
+// Test 1: Entity counts are stored for each location
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	BenchmarkFieldStore<int, double> store(100, 250, 40, 3);
+
+	BOOST_CHECK_EQUAL(store.getNEntities(FIELD_CELL), 100);
+	BOOST_CHECK_EQUAL(store.getNEntities(FIELD_FACE), 250);
+	BOOST_CHECK_EQUAL(store.getNEntities(FIELD_BOUNDARY), 40);
+	BOOST_CHECK_EQUAL(store.getNEntities(FIELD_REGION), 3);
+	BOOST_CHECK_EQUAL(store.getNFields(), 0);
+	BOOST_CHECK_EQUAL(store.getNBytes(), 0);
+}
+
+// === addScalarField/getScalarField ===
+// Test 1: Fields are sized for their location, aligned, and distinct
+BOOST_AUTO_TEST_CASE(addScalarField_test1)
+{
+	cupcfd::error::eCodes status;
+	BenchmarkFieldStore<int, double> store(100, 250, 40, 3);
+
+	status = store.addScalarField("Phi", FIELD_CELL);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// The same name may be used at another location
+	status = store.addScalarField("Phi", FIELD_BOUNDARY);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = store.addScalarField("RFace", FIELD_FACE, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(store.getNFields(), 3);
+	BOOST_CHECK_EQUAL(store.getNBytes(), (100 + 40 + 500) * sizeof(double));
+
+	double * phiCell = nullptr;
+	double * phiBoundary = nullptr;
+	double * rFace = nullptr;
+
+	status = store.getScalarField("Phi", FIELD_CELL, &phiCell);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = store.getScalarField("Phi", FIELD_BOUNDARY, &phiBoundary);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = store.getScalarField("RFace", FIELD_FACE, &rFace);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK(phiCell != phiBoundary);
+	BOOST_CHECK_EQUAL(((uintptr_t) phiCell) % 64, 0);
+	BOOST_CHECK_EQUAL(((uintptr_t) phiBoundary) % 64, 0);
+	BOOST_CHECK_EQUAL(((uintptr_t) rFace) % 64, 0);
+
+	// Every value can be written
+	for(int i = 0; i < 500; i++) {
+		rFace[i] = (double) i;
+	}
+
+	BOOST_CHECK_EQUAL(rFace[499], 499.0);
+}
+
+// Test 2: Error Case: A field with the same name at the same location already exists
+BOOST_AUTO_TEST_CASE(addScalarField_test2)
+{
+	cupcfd::error::eCodes status;
+	BenchmarkFieldStore<int, float> store(10, 20, 5, 1);
+
+	status = store.addScalarField("Den", FIELD_CELL);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = store.addScalarField("Den", FIELD_CELL);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ERROR);
+
+	status = store.addVectorField("Den", FIELD_CELL);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ERROR);
+
+	BOOST_CHECK_EQUAL(store.getNFields(), 1);
+}
+
+// Test 3: Error Case: The field does not exist, or is a vector field
+BOOST_AUTO_TEST_CASE(getScalarField_test1)
+{
+	cupcfd::error::eCodes status;
+	BenchmarkFieldStore<int, double> store(10, 20, 5, 1);
+
+	status = store.addScalarField("Den", FIELD_CELL);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = store.addVectorField("dPdx", FIELD_CELL);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double * data;
+	status = store.getScalarField("Den", FIELD_BOUNDARY, &data);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SEARCH_NOT_FOUND);
+
+	status = store.getScalarField("dPdx", FIELD_CELL, &data);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SEARCH_NOT_FOUND);
+
+	euc::EuclideanVector<double,3> * vecData;
+	status = store.getVectorField("Den", FIELD_CELL, &vecData);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SEARCH_NOT_FOUND);
+}
+
+// === addVectorField/getVectorField ===
+// Test 1: Vector fields are constructed and sized for their location
+BOOST_AUTO_TEST_CASE(addVectorField_test1)
+{
+	cupcfd::error::eCodes status;
+	BenchmarkFieldStore<int, double> store(100, 250, 40, 3);
+
+	status = store.addVectorField("dPhidx", FIELD_CELL);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(store.getNBytes(), 100 * sizeof(euc::EuclideanVector<double,3>));
+
+	euc::EuclideanVector<double,3> * data = nullptr;
+	status = store.getVectorField("dPhidx", FIELD_CELL, &data);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(((uintptr_t) data) % 64, 0);
+
+	// Default constructed vectors are zero
+	for(int i = 0; i < 100; i++) {
+		BOOST_CHECK_EQUAL(data[i].cmp[0], 0.0);
+		BOOST_CHECK_EQUAL(data[i].cmp[1], 0.0);
+		BOOST_CHECK_EQUAL(data[i].cmp[2], 0.0);
+	}
+}
+
+// === initialise ===
+// Test 1: Every value of every field lies within the bounds
+BOOST_AUTO_TEST_CASE(initialise_test1)
+{
+	cupcfd::error::eCodes status;
+	BenchmarkFieldStore<int, double> store(100, 250, 40, 3);
+
+	status = store.addScalarField("Phi", FIELD_CELL);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = store.addScalarField("FlowFact", FIELD_REGION);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = store.addVectorField("dUdx", FIELD_CELL);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	store.initialise(2.0, 3.0);
+
+	double * phi;
+	double * flowFact;
+	euc::EuclideanVector<double,3> * dUdx;
+
+	status = store.getScalarField("Phi", FIELD_CELL, &phi);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = store.getScalarField("FlowFact", FIELD_REGION, &flowFact);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = store.getVectorField("dUdx", FIELD_CELL, &dUdx);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < 100; i++) {
+		BOOST_CHECK(phi[i] >= 2.0 && phi[i] <= 3.0);
+
+		for(int j = 0; j < 3; j++) {
+			BOOST_CHECK(dUdx[i].cmp[j] >= 2.0 && dUdx[i].cmp[j] <= 3.0);
+		}
+	}
+
+	for(int i = 0; i < 3; i++) {
+		BOOST_CHECK(flowFact[i] >= 2.0 && flowFact[i] <= 3.0);
+	}
+}
@@ -24,6 +24,7 @@
 #include "MeshSourceStructGenConfig.h"
 #include "MeshConfig.h"
 #include "CupCfdAoSMesh.h"
+#include "CupCfdSoAMesh.h"
 
 #include <iostream>
 
@@ -46,7 +47,7 @@ BOOST_AUTO_TEST_CASE(constructor_test1)
 
 	// Setup a Mesh
     cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int,double> meshSourceConfig(10, 20, 20, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int,double,int> meshSourceConfig(10, 20, 20, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 	cupcfd::error::eCodes status;
 
@@ -66,7 +67,7 @@ BOOST_AUTO_TEST_CASE(runBenchmark_test1)
 
 	// Setup a Mesh
     cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int,double> meshSourceConfig(10, 20, 21, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int,double,int> meshSourceConfig(10, 20, 21, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 	cupcfd::error::eCodes status;
 
@@ -80,6 +81,27 @@ BOOST_AUTO_TEST_CASE(runBenchmark_test1)
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 }
 
+// Test 2: Test running all of the kernel benchmarks on a mesh with long labels
+BOOST_AUTO_TEST_CASE(runBenchmark_test2)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// Setup a Mesh
+	cupcfd::partitioner::PartitionerNaiveConfig<int,long> partConfig;
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int,double,long> meshSourceConfig(10, 20, 21, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	cupcfd::geometry::mesh::MeshConfig<int,double,long> meshConfig(partConfig, meshSourceConfig);
+	cupcfd::error::eCodes status;
+
+	cupcfd::geometry::mesh::CupCfdSoAMesh<int,double,long> * meshPtr;
+	status = meshConfig.buildUnstructuredMesh(&meshPtr, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	std::shared_ptr<cupcfd::geometry::mesh::CupCfdSoAMesh<int,double,long>> sharedPtr(meshPtr);
+
+	BenchmarkKernels<cupcfd::geometry::mesh::CupCfdSoAMesh<int,double,long>, int, double, long> benchmark("KernelBench",sharedPtr, 1000);
+	status = benchmark.runBenchmark();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+}
+
 
 // Finalize MPI
 BOOST_AUTO_TEST_CASE(cleanup)
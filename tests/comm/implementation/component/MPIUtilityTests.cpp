@@ -79,7 +79,19 @@ BOOST_AUTO_TEST_CASE(getMPIType_test4)
 	BOOST_CHECK_EQUAL(dataType, MPI_LONG);
 }
 
-// Test 5: Get MPI of a CustomMPIType when registered
+// Test 5: Get MPI Long Long Type
+BOOST_AUTO_TEST_CASE(getMPIType_test5)
+{
+	long long dummy = 0xDEADC0DE;
+	cupcfd::error::eCodes status;
+	MPI_Datatype dataType;
+
+	status = getMPIType(dummy, &dataType);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(dataType, MPI_LONG_LONG);
+}
+
+// Test 6: Get MPI of a CustomMPIType when registered
 // Unsure of best way to test this
 // Theoretically, it just passes through to CustomType methods so it
 // should just work without further testing - don't want to have to test
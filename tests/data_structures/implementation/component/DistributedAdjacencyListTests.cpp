@@ -1723,6 +1723,106 @@ BOOST_AUTO_TEST_CASE(buildSerialAdjacencyList_test1)
 	}
 }
 
+// === Multi-layer Halos ===
+// Test 1: A chain of nodes with a two node deep halo on each rank is ordered by layer,
+// and a depth limited exchange pattern leaves the second layer unchanged
+BOOST_AUTO_TEST_CASE(driver_finalize_ghostLayers_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	DistributedAdjacencyList<int, int> graph(comm);
+	cupcfd::error::eCodes status;
+
+	// Each rank owns 4 nodes of a chain 1-2-3-...-(4 * size), and adds the edges out to two nodes either side
+	int nNodes = 4 * comm.size;
+	int first = (4 * comm.rank) + 1;
+	int last = first + 3;
+
+	for(int i = first; i <= last; i++) {
+		status = graph.addLocalNode(i);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	for(int i = std::max(1, first - 2); i < std::min(nNodes, last + 2); i++) {
+		status = graph.addUndirectedEdge(i, i + 1);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	status = graph.finalize();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(graph.nGhostLayers, 2);
+
+	// Expected ordering: [Local] | [Layer 1] | [Layer 2], ascending within each
+	std::vector<int> expectedNodes;
+	for(int i = first; i <= last; i++) {
+		expectedNodes.push_back(i);
+	}
+
+	std::vector<int> expectedXAdj(3, 4);
+
+	for(int layer = 1; layer <= 2; layer++) {
+		if(first - layer >= 1) {
+			expectedNodes.push_back(first - layer);
+		}
+
+		if(last + layer <= nNodes) {
+			expectedNodes.push_back(last + layer);
+		}
+
+		expectedXAdj[layer] = (int) expectedNodes.size();
+	}
+
+	std::vector<int> nodes(graph.connGraph.nNodes);
+	for(int i = 0; i < graph.connGraph.nNodes; i++) {
+		nodes[i] = graph.connGraph.IDXToNode[i];
+	}
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(nodes.begin(), nodes.end(), expectedNodes.begin(), expectedNodes.end());
+	BOOST_CHECK_EQUAL_COLLECTIONS(graph.ghostLayerXAdj.begin(), graph.ghostLayerXAdj.end(), expectedXAdj.begin(), expectedXAdj.end());
+
+	int start, end;
+	status = graph.getGhostLayerRange(2, &start, &end);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(start, expectedXAdj[1]);
+	BOOST_CHECK_EQUAL(end, expectedXAdj[2]);
+
+	status = graph.getGhostLayerRange(3, &start, &end);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_INDEX);
+
+	// Exchange the node values, first with only the first layer, then with both
+	int nData = graph.connGraph.nNodes;
+	std::vector<int> data(nData, -1);
+
+	for(int i = 0; i < graph.nLONodes; i++) {
+		data[i] = nodes[i];
+	}
+
+	cupcfd::comm::ExchangePatternTwoSidedNonBlocking<int> * pattern;
+	status = graph.buildExchangePattern(&pattern, 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = pattern->exchangeStart(data.data(), nData);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = pattern->exchangeStop(data.data(), nData);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	delete pattern;
+
+	for(int i = expectedXAdj[0]; i < expectedXAdj[1]; i++) {
+		BOOST_CHECK_EQUAL(data[i], nodes[i]);
+	}
+
+	for(int i = expectedXAdj[1]; i < expectedXAdj[2]; i++) {
+		BOOST_CHECK_EQUAL(data[i], -1);
+	}
+
+	status = graph.buildExchangePattern(&pattern);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = pattern->exchangeStart(data.data(), nData);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = pattern->exchangeStop(data.data(), nData);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	delete pattern;
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(data.begin(), data.end(), nodes.begin(), nodes.end());
+}
 
 // Finalize MPI
 BOOST_AUTO_TEST_CASE(cleanup)
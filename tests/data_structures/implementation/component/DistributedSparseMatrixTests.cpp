@@ -0,0 +1,378 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the DistributedSparseMatrix class
+ */
+
+#define BOOST_TEST_MODULE DistributedSparseMatrix
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+
+#include <stdexcept>
+#include <cstdlib>
+#include <vector>
+
+#include "DistributedSparseMatrix.h"
+#include "SparseMatrixSourceMeshGen.h"
+#include "MeshConfig.h"
+#include "MeshSourceStructGenConfig.h"
+#include "CupCfdAoSMesh.h"
+#include "PartitionerNaiveConfig.h"
+#include "PartitionerConfig.h"
+#include "Reduce.h"
+#include "Error.h"
+
+using namespace cupcfd::data_structures;
+
+namespace meshgeo = cupcfd::geometry::mesh;
+
+// These tests require MPI
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+
+    MPI_Init(&argc, &argv);
+}
+
+// 5x5x5 cube - the rows of each rank are the cells it owns
+meshgeo::CupCfdAoSMesh<int,double,int> * buildTestMesh(cupcfd::comm::Communicator& comm) {
+	cupcfd::error::eCodes status;
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	meshgeo::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	meshgeo::MeshConfig<int, double,int> meshConfig(partConfig, meshSourceConfig);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	return mesh;
+}
+
+// === build ===
+// Test 1: Each rank holds only its own rows, the rows cover the matrix once, and
+// local and global column indexes map to each other
+BOOST_AUTO_TEST_CASE(build_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	SparseMatrixSourceMeshGen<int,double> source(0.5, 0.0);
+	status = source.generate(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int startRow, nRows;
+	status = source.getLocalRowRange(&startRow, &nRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	DistributedSparseMatrix<int,double> matrix(comm);
+	status = matrix.build(source, startRow, nRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK(matrix.built);
+	BOOST_CHECK_EQUAL(matrix.nGlobalRows, 125);
+	BOOST_CHECK_EQUAL(matrix.rowStart, startRow);
+	BOOST_CHECK_EQUAL(matrix.nOwnedRows, mesh->properties.lOCells);
+	BOOST_CHECK_EQUAL(matrix.local.m, matrix.nOwnedRows);
+	BOOST_CHECK_EQUAL(matrix.local.n, matrix.nOwnedRows + matrix.nGhosts);
+	BOOST_CHECK_EQUAL(matrix.rankRowStart.size(), comm.size + 1);
+	BOOST_CHECK_EQUAL(matrix.rankRowStart[comm.rank], startRow);
+	BOOST_CHECK_EQUAL(matrix.interiorRows.size() + matrix.boundaryRows.size(), matrix.nOwnedRows);
+
+	// The local rows hold every non-zero of the global matrix once
+	int nnz;
+	status = cupcfd::comm::allReduceAdd(&(matrix.local.nnz), 1, &nnz, 1, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nnz, 725);
+
+	// A split mesh has neighbours on other ranks
+	if(comm.size > 1) {
+		BOOST_CHECK(matrix.nGhosts > 0);
+		BOOST_CHECK(matrix.boundaryRows.size() > 0);
+	}
+
+	for(int i = 0; i < matrix.nOwnedRows + matrix.nGhosts; i++) {
+		int globalCol, localCol;
+
+		status = matrix.getGlobalColumnIndex(i, &globalCol);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		if(i < matrix.nOwnedRows) {
+			BOOST_CHECK_EQUAL(globalCol, startRow + i);
+		}
+		else {
+			BOOST_CHECK(globalCol < startRow || globalCol >= startRow + nRows);
+		}
+
+		status = matrix.getLocalColumnIndex(globalCol, &localCol);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(localCol, i);
+	}
+
+	int localCol;
+	status = matrix.getLocalColumnIndex(125, &localCol);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_INDEX);
+
+	delete mesh;
+}
+
+// === build ===
+// Test 2: Error Case - the row blocks of the ranks overlap
+BOOST_AUTO_TEST_CASE(build_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	SparseMatrixSourceMeshGen<int,double> source(0.5, 0.0);
+	status = source.generate(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int startRow, nRows;
+	status = source.getLocalRowRange(&startRow, &nRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Every rank claims to start at row 0
+	DistributedSparseMatrix<int,double> matrix(comm);
+	status = matrix.build(source, 0, nRows);
+
+	if(comm.size > 1) {
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
+		BOOST_CHECK(!matrix.built);
+	}
+
+	delete mesh;
+}
+
+// A source that fails to provide the values of its first row on rank 0
+class FailingSource : public SparseMatrixSourceMeshGen<int,double>
+{
+	public:
+		int failRow;
+
+		FailingSource(int failRow)
+		:SparseMatrixSourceMeshGen<int,double>(0.5, 0.0), failRow(failRow)
+		{
+		}
+
+		cupcfd::error::eCodes getRowNNZValues(int rowIndex, double ** nnzValues, int * nNNZValues) {
+			if(rowIndex == this->failRow) {
+				return cupcfd::error::E_NO_DATA;
+			}
+
+			return SparseMatrixSourceMeshGen<int,double>::getRowNNZValues(rowIndex, nnzValues, nNNZValues);
+		}
+};
+
+// === build ===
+// Test 3: Error Case - the source fails on one rank. Every rank returns together rather than the
+// other ranks waiting for it in the collective operations of the build.
+BOOST_AUTO_TEST_CASE(build_test3)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	FailingSource source(-1);
+	status = source.generate(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int startRow, nRows;
+	status = source.getLocalRowRange(&startRow, &nRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	if(comm.rank == 0) {
+		source.failRow = startRow;
+	}
+
+	DistributedSparseMatrix<int,double> matrix(comm);
+	status = matrix.build(source, startRow, nRows);
+
+	if(comm.rank == 0) {
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_NO_DATA);
+	}
+	else {
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_ERROR);
+	}
+	BOOST_CHECK(!matrix.built);
+
+	delete mesh;
+}
+
+// === haloExchange ===
+// Test 1: The ghost entries of a vector are updated from their owning ranks
+BOOST_AUTO_TEST_CASE(haloExchange_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	SparseMatrixSourceMeshGen<int,double> source(0.5, 0.0);
+	status = source.generate(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int startRow, nRows;
+	status = source.getLocalRowRange(&startRow, &nRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	DistributedSparseMatrix<int,double> matrix(comm);
+	status = matrix.build(source, startRow, nRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Each owned entry is its global index, ghosts are unset
+	int nX = matrix.nOwnedRows + matrix.nGhosts;
+	std::vector<double> x(nX, -1.0);
+
+	for(int i = 0; i < matrix.nOwnedRows; i++) {
+		x[i] = double(startRow + i);
+	}
+
+	status = matrix.haloExchange(x.data(), nX);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < matrix.nGhosts; i++) {
+		BOOST_CHECK_EQUAL(x[matrix.nOwnedRows + i], double(matrix.ghostGlobalIDs[i]));
+	}
+
+	// Error Case - the vector does not hold the ghost entries
+	status = matrix.haloExchange(x.data(), matrix.nOwnedRows - 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+
+	delete mesh;
+}
+
+// === multiply ===
+// Test 1: The distributed product matches the product of the global rows
+BOOST_AUTO_TEST_CASE(multiply_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	SparseMatrixSourceMeshGen<int,double> source(0.5, 0.0);
+	status = source.generate(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int startRow, nRows;
+	status = source.getLocalRowRange(&startRow, &nRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	DistributedSparseMatrix<int,double> matrix(comm);
+	status = matrix.build(source, startRow, nRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// x[g] = 1 + g, only the owned entries are set locally
+	int nX = matrix.nOwnedRows + matrix.nGhosts;
+	std::vector<double> x(nX, 0.0);
+	std::vector<double> y(matrix.nOwnedRows);
+
+	for(int i = 0; i < matrix.nOwnedRows; i++) {
+		x[i] = 1.0 + double(startRow + i);
+	}
+
+	status = matrix.multiply(x.data(), nX, y.data(), matrix.nOwnedRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < matrix.nOwnedRows; i++) {
+		int * cols;
+		int nCols;
+		double * vals;
+		int nVals;
+
+		status = source.getRowColumnIndexes(startRow + i, &cols, &nCols);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = source.getRowNNZValues(startRow + i, &vals, &nVals);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		double expected = 0.0;
+
+		for(int k = 0; k < nCols; k++) {
+			expected = expected + (vals[k] * (1.0 + double(cols[k])));
+		}
+
+		BOOST_CHECK_CLOSE(y[i], expected, 1e-10);
+
+		free(cols);
+		free(vals);
+	}
+
+	// Error Case - the result does not match the owned rows
+	status = matrix.multiply(x.data(), nX, y.data(), matrix.nOwnedRows + 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+
+	delete mesh;
+}
+
+// === copyToGlobal ===
+// Test 1: The owned rows are copied with global indexes
+BOOST_AUTO_TEST_CASE(copyToGlobal_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	SparseMatrixSourceMeshGen<int,double> source(0.5, 0.0);
+	status = source.generate(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int startRow, nRows;
+	status = source.getLocalRowRange(&startRow, &nRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	DistributedSparseMatrix<int,double> matrix(comm);
+	status = matrix.build(source, startRow, nRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	SparseMatrixCSR<int,double> global(1, 1, 1);
+	status = matrix.copyToGlobal(global);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(global.m, 125);
+	BOOST_CHECK_EQUAL(global.n, 125);
+	BOOST_CHECK_EQUAL(global.nnz, matrix.local.nnz);
+
+	for(int i = 0; i < matrix.nOwnedRows; i++) {
+		int * cols;
+		int nCols;
+		double * vals;
+		int nVals;
+
+		status = source.getRowColumnIndexes(startRow + i, &cols, &nCols);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = source.getRowNNZValues(startRow + i, &vals, &nVals);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		for(int k = 0; k < nCols; k++) {
+			double val;
+			status = global.getElement(startRow + i + 1, cols[k] + 1, &val);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+			BOOST_CHECK_EQUAL(val, vals[k]);
+		}
+
+		free(cols);
+		free(vals);
+	}
+
+	delete mesh;
+}
+
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+	MPI_Finalize();
+}
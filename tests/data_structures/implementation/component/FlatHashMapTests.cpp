@@ -0,0 +1,290 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the FlatHashMap class
+ */
+
+#define BOOST_TEST_MODULE FlatHashMap
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+#include <vector>
+#include <algorithm>
+
+#include "FlatHashMap.h"
+
+using namespace cupcfd::data_structures;
+
+// === Constructors/Deconstructors ===
+// Test 1: Empty Constructor
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	FlatHashMap<int, int> map;
+
+	BOOST_CHECK_EQUAL(map.size(), 0);
+	BOOST_CHECK(map.empty());
+	BOOST_CHECK(map.begin() == map.end());
+	BOOST_CHECK_EQUAL(map.getMemoryBytes(), 0);
+}
+
+// === operator[] ===
+// Test 1: Insert new keys, and read back their values
+BOOST_AUTO_TEST_CASE(operator_brackets_test1)
+{
+	FlatHashMap<int, long> map;
+
+	map[7] = 70;
+	map[-3] = -30;
+	map[1000000] = 5;
+
+	BOOST_CHECK_EQUAL(map.size(), 3);
+	BOOST_CHECK(!map.empty());
+	BOOST_CHECK_EQUAL(map[7], 70);
+	BOOST_CHECK_EQUAL(map[-3], -30);
+	BOOST_CHECK_EQUAL(map[1000000], 5);
+
+	// Reading stored keys does not add entries
+	BOOST_CHECK_EQUAL(map.size(), 3);
+}
+
+// Test 2: A missing key is inserted with a default constructed value
+BOOST_AUTO_TEST_CASE(operator_brackets_test2)
+{
+	FlatHashMap<long, int> map;
+
+	map[4] = 9;
+
+	BOOST_CHECK_EQUAL(map[5], 0);
+	BOOST_CHECK_EQUAL(map.size(), 2);
+	BOOST_CHECK_EQUAL(map[4], 9);
+}
+
+// Test 3: Looking up stored keys in a table at its load limit does not grow the table
+BOOST_AUTO_TEST_CASE(operator_brackets_test3)
+{
+	FlatHashMap<int, int> map;
+
+	// The first table holds 16 positions, of which 12 can be used before growing
+	for(int i = 0; i < 12; i++) {
+		map[i] = i + 1;
+	}
+
+	std::size_t bytes = map.getMemoryBytes();
+	BOOST_CHECK(bytes > 0);
+
+	for(int i = 0; i < 12; i++) {
+		BOOST_CHECK_EQUAL(map[i], i + 1);
+	}
+
+	BOOST_CHECK_EQUAL(map.getMemoryBytes(), bytes);
+	BOOST_CHECK_EQUAL(map.size(), 12);
+
+	// A new key does grow it
+	map[12] = 13;
+	BOOST_CHECK(map.getMemoryBytes() > bytes);
+	BOOST_CHECK_EQUAL(map.size(), 13);
+}
+
+// === find ===
+// Test 1: Find stored keys
+BOOST_AUTO_TEST_CASE(find_test1)
+{
+	FlatHashMap<int, int> map;
+
+	for(int i = 0; i < 20; i++) {
+		map[3 * i] = i;
+	}
+
+	for(int i = 0; i < 20; i++) {
+		FlatHashMap<int, int>::iterator it = map.find(3 * i);
+		BOOST_CHECK(it != map.end());
+		BOOST_CHECK_EQUAL(it->first, 3 * i);
+		BOOST_CHECK_EQUAL(it->second, i);
+		BOOST_CHECK_EQUAL((*it).second, i);
+	}
+}
+
+// Test 2: Missing keys return end(), and are not inserted
+BOOST_AUTO_TEST_CASE(find_test2)
+{
+	FlatHashMap<int, int> map;
+
+	// Empty map with no table
+	BOOST_CHECK(map.find(1) == map.end());
+
+	for(int i = 0; i < 20; i++) {
+		map[3 * i] = i;
+	}
+
+	BOOST_CHECK(map.find(1) == map.end());
+	BOOST_CHECK(map.find(-3) == map.end());
+	BOOST_CHECK(map.find(60) == map.end());
+	BOOST_CHECK_EQUAL(map.size(), 20);
+}
+
+// === at ===
+// Test 1: Stored keys return their value, missing keys throw and are not inserted
+BOOST_AUTO_TEST_CASE(at_test1)
+{
+	FlatHashMap<int, int> map;
+
+	// Empty map with no table
+	BOOST_CHECK_THROW(map.at(1), std::out_of_range);
+
+	for(int i = 0; i < 20; i++) {
+		map[3 * i] = i;
+	}
+
+	for(int i = 0; i < 20; i++) {
+		BOOST_CHECK_EQUAL(map.at(3 * i), i);
+	}
+
+	map.at(3) = 100;
+	BOOST_CHECK_EQUAL(map[3], 100);
+
+	BOOST_CHECK_THROW(map.at(1), std::out_of_range);
+	BOOST_CHECK_THROW(map.at(60), std::out_of_range);
+	BOOST_CHECK_EQUAL(map.size(), 20);
+}
+
+// === rehash ===
+// Test 1: Entries are kept when the table grows several times
+BOOST_AUTO_TEST_CASE(rehash_test1)
+{
+	FlatHashMap<long, int> map;
+	std::size_t bytes = 0;
+	int nGrowths = 0;
+
+	for(int i = 0; i < 5000; i++) {
+		// Spread the keys out so they do not fill consecutive positions
+		map[1000003L * i] = i;
+
+		if(map.getMemoryBytes() != bytes) {
+			bytes = map.getMemoryBytes();
+			nGrowths++;
+		}
+	}
+
+	BOOST_CHECK(nGrowths > 5);
+	BOOST_CHECK_EQUAL(map.size(), 5000);
+
+	for(int i = 0; i < 5000; i++) {
+		FlatHashMap<long, int>::iterator it = map.find(1000003L * i);
+		BOOST_CHECK(it != map.end());
+		BOOST_CHECK_EQUAL(it->second, i);
+	}
+}
+
+// === clear ===
+// Test 1: Clearing removes all entries but keeps the table
+BOOST_AUTO_TEST_CASE(clear_test1)
+{
+	FlatHashMap<int, int> map;
+
+	for(int i = 0; i < 100; i++) {
+		map[i] = i;
+	}
+
+	std::size_t bytes = map.getMemoryBytes();
+
+	map.clear();
+
+	BOOST_CHECK_EQUAL(map.size(), 0);
+	BOOST_CHECK(map.empty());
+	BOOST_CHECK(map.begin() == map.end());
+	BOOST_CHECK(map.find(5) == map.end());
+	BOOST_CHECK_EQUAL(map.getMemoryBytes(), bytes);
+
+	// The map can be reused
+	map[5] = 50;
+	BOOST_CHECK_EQUAL(map.size(), 1);
+	BOOST_CHECK_EQUAL(map[5], 50);
+}
+
+// === reserve ===
+// Test 1: Reserved space is used without growing
+BOOST_AUTO_TEST_CASE(reserve_test1)
+{
+	FlatHashMap<int, int> map;
+
+	map.reserve(1000);
+	std::size_t bytes = map.getMemoryBytes();
+	BOOST_CHECK(bytes > 0);
+
+	for(int i = 0; i < 1000; i++) {
+		map[i] = -i;
+	}
+
+	BOOST_CHECK_EQUAL(map.getMemoryBytes(), bytes);
+	BOOST_CHECK_EQUAL(map.size(), 1000);
+
+	for(int i = 0; i < 1000; i++) {
+		BOOST_CHECK_EQUAL(map[i], -i);
+	}
+}
+
+// Test 2: Reserving less than the current table size keeps the entries and the table
+BOOST_AUTO_TEST_CASE(reserve_test2)
+{
+	FlatHashMap<int, int> map;
+
+	for(int i = 0; i < 100; i++) {
+		map[i] = i;
+	}
+
+	std::size_t bytes = map.getMemoryBytes();
+	map.reserve(10);
+
+	BOOST_CHECK_EQUAL(map.getMemoryBytes(), bytes);
+	BOOST_CHECK_EQUAL(map.size(), 100);
+	BOOST_CHECK_EQUAL(map[42], 42);
+}
+
+// === iterator ===
+// Test 1: Iteration visits every entry once
+BOOST_AUTO_TEST_CASE(iterator_test1)
+{
+	FlatHashMap<int, int> map;
+	std::vector<int> keys;
+
+	for(int i = 0; i < 300; i++) {
+		map[7 * i + 2] = i;
+	}
+
+	for(FlatHashMap<int, int>::iterator it = map.begin(); it != map.end(); it++) {
+		BOOST_CHECK_EQUAL(it->first, 7 * it->second + 2);
+		keys.push_back(it->first);
+	}
+
+	BOOST_CHECK_EQUAL(keys.size(), 300);
+
+	// The order is unspecified, so sort before comparing
+	std::sort(keys.begin(), keys.end());
+	for(int i = 0; i < 300; i++) {
+		BOOST_CHECK_EQUAL(keys[i], 7 * i + 2);
+	}
+}
+
+// Test 2: Values can be updated through an iterator
+BOOST_AUTO_TEST_CASE(iterator_test2)
+{
+	FlatHashMap<int, int> map;
+
+	for(int i = 0; i < 50; i++) {
+		map[i] = i;
+	}
+
+	for(FlatHashMap<int, int>::iterator it = map.begin(); it != map.end(); ++it) {
+		it->second = 2 * it->second;
+	}
+
+	for(int i = 0; i < 50; i++) {
+		BOOST_CHECK_EQUAL(map[i], 2 * i);
+	}
+}
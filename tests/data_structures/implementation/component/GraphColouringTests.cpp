@@ -0,0 +1,280 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the GraphColouring class
+ */
+
+#define BOOST_TEST_MODULE GraphColouring
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+#include <vector>
+#include <algorithm>
+
+#include "GraphColouring.h"
+#include "AdjacencyListCSR.h"
+#include "Error.h"
+
+using namespace cupcfd::data_structures;
+
+// Build the 5-point stencil graph of a nx * nx grid (base 0)
+void buildGrid(std::vector<int>& xadj, std::vector<int>& adjncy, int nx) {
+	xadj.assign(1, 0);
+	adjncy.clear();
+
+	for(int j = 0; j < nx; j++) {
+		for(int i = 0; i < nx; i++) {
+			int node = j * nx + i;
+
+			if(j > 0) {
+				adjncy.push_back(node - nx);
+			}
+
+			if(i > 0) {
+				adjncy.push_back(node - 1);
+			}
+
+			if(i < nx - 1) {
+				adjncy.push_back(node + 1);
+			}
+
+			if(j < nx - 1) {
+				adjncy.push_back(node + nx);
+			}
+
+			xadj.push_back((int) adjncy.size());
+		}
+	}
+}
+
+// Build the face->cell incidence of the faces of a nx * nx grid of cells.
+// Horizontal faces are followed by vertical faces, each touching two cells.
+void buildGridFaces(std::vector<int>& xadj, std::vector<int>& adjncy, int nx) {
+	xadj.assign(1, 0);
+	adjncy.clear();
+
+	for(int j = 0; j < nx; j++) {
+		for(int i = 0; i < nx - 1; i++) {
+			adjncy.push_back(j * nx + i);
+			adjncy.push_back(j * nx + i + 1);
+			xadj.push_back((int) adjncy.size());
+		}
+	}
+
+	for(int j = 0; j < nx - 1; j++) {
+		for(int i = 0; i < nx; i++) {
+			adjncy.push_back(j * nx + i);
+			adjncy.push_back((j + 1) * nx + i);
+			xadj.push_back((int) adjncy.size());
+		}
+	}
+}
+
+// === Constructors/Deconstructors ===
+// Test 1: Empty Constructor
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	GraphColouring<int> colouring;
+
+	BOOST_CHECK_EQUAL(colouring.nItems, 0);
+	BOOST_CHECK_EQUAL(colouring.nColours, 0);
+	BOOST_CHECK_EQUAL(colouring.colourXAdj.size(), 1);
+}
+
+// === colourGraph ===
+// Test 1: A small grid is coloured in order, giving a red-black colouring
+BOOST_AUTO_TEST_CASE(colourGraph_test1)
+{
+	GraphColouring<int> colouring;
+	std::vector<int> xadj;
+	std::vector<int> adjncy;
+	cupcfd::error::eCodes status;
+
+	buildGrid(xadj, adjncy, 4);
+
+	status = colouring.colourGraph(xadj.data(), adjncy.data(), 16, 0, 1, false);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(colouring.nItems, 16);
+	BOOST_CHECK_EQUAL(colouring.nColours, 2);
+	BOOST_CHECK_EQUAL(colouring.nRounds, 1);
+	BOOST_CHECK_EQUAL(colouring.colourXAdj[2], 16);
+	BOOST_CHECK_CLOSE(colouring.imbalance, 1.0, 1e-10);
+	BOOST_CHECK(colouring.isValid(xadj.data(), adjncy.data(), 0, 1));
+
+	for(int i = 0; i < 16; i++) {
+		BOOST_CHECK_EQUAL(colouring.colours[i], ((i / 4) + (i % 4)) % 2);
+	}
+}
+
+// Test 2: A large grid is coloured validly at distance 1 and 2
+BOOST_AUTO_TEST_CASE(colourGraph_test2)
+{
+	GraphColouring<int> colouring;
+	std::vector<int> xadj;
+	std::vector<int> adjncy;
+	cupcfd::error::eCodes status;
+	int nx = 150;
+
+	buildGrid(xadj, adjncy, nx);
+
+	status = colouring.colourGraph(xadj.data(), adjncy.data(), nx * nx, 0, 1, false);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK(colouring.isValid(xadj.data(), adjncy.data(), 0, 1));
+	BOOST_CHECK(colouring.nColours <= 5);
+	BOOST_CHECK_EQUAL(colouring.colourXAdj[colouring.nColours], nx * nx);
+
+	status = colouring.colourGraph(xadj.data(), adjncy.data(), nx * nx, 0, 2, false);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK(colouring.isValid(xadj.data(), adjncy.data(), 0, 2));
+	BOOST_CHECK(colouring.nColours >= 5);
+	BOOST_CHECK(colouring.nColours <= 13);
+}
+
+// Test 3: Balancing keeps the colouring valid, does not add colours and does not worsen the imbalance
+BOOST_AUTO_TEST_CASE(colourGraph_test3)
+{
+	GraphColouring<int> colouring;
+	std::vector<int> xadj;
+	std::vector<int> adjncy;
+	cupcfd::error::eCodes status;
+	int nx = 100;
+
+	buildGrid(xadj, adjncy, nx);
+
+	status = colouring.colourGraph(xadj.data(), adjncy.data(), nx * nx, 0, 2, false);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	int nColours = colouring.nColours;
+	double imbalance = colouring.imbalance;
+
+	status = colouring.colourGraph(xadj.data(), adjncy.data(), nx * nx, 0, 2, true);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK(colouring.isValid(xadj.data(), adjncy.data(), 0, 2));
+	BOOST_CHECK(colouring.nColours <= nColours);
+	BOOST_CHECK(colouring.imbalance <= imbalance);
+}
+
+// Test 4: Colour an adjacency list, ignoring self-loops and one-way edges
+BOOST_AUTO_TEST_CASE(colourGraph_test4)
+{
+	AdjacencyListCSR<int, int> graph;
+	GraphColouring<int> colouring;
+	cupcfd::error::eCodes status;
+
+	// Triangle 0-1-2 with a self loop on 0, and a one-way edge 3->0
+	for(int i = 0; i < 4; i++) {
+		status = graph.addNode(i);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	status = graph.addEdge(0, 0);
+	status = graph.addEdge(0, 1);
+	status = graph.addEdge(1, 2);
+	status = graph.addEdge(2, 0);
+	status = graph.addEdge(3, 0);
+
+	status = colouring.colourGraph(graph, 1, false);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(colouring.nColours, 3);
+	BOOST_CHECK(colouring.colours[3] != colouring.colours[0]);
+	BOOST_CHECK(colouring.isValid(graph.xadj.data(), graph.adjncy.data(), 0, 1));
+}
+
+// Test 5: Error Case: Unsupported distance
+BOOST_AUTO_TEST_CASE(colourGraph_test5)
+{
+	GraphColouring<int> colouring;
+	std::vector<int> xadj;
+	std::vector<int> adjncy;
+	cupcfd::error::eCodes status;
+
+	buildGrid(xadj, adjncy, 4);
+
+	status = colouring.colourGraph(xadj.data(), adjncy.data(), 16, 0, 3, false);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_INDEX);
+}
+
+// === colourIncidence ===
+// Test 1: No two faces of a colour share a cell, at distance 1 and 2
+BOOST_AUTO_TEST_CASE(colourIncidence_test1)
+{
+	GraphColouring<int> colouring;
+	std::vector<int> xadj;
+	std::vector<int> adjncy;
+	cupcfd::error::eCodes status;
+	int nx = 120;
+
+	buildGridFaces(xadj, adjncy, nx);
+	int nFaces = (int) xadj.size() - 1;
+
+	for(int distance = 1; distance <= 2; distance++) {
+		status = colouring.colourIncidence(xadj.data(), adjncy.data(), nFaces, nx * nx, 0, distance, distance == 2);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(colouring.colourXAdj[colouring.nColours], nFaces);
+
+		// Each cell is touched at most once per colour
+		std::vector<int> lastColour(nx * nx, -1);
+		for(int c = 0; c < colouring.nColours; c++) {
+			for(int k = colouring.colourXAdj[c]; k < colouring.colourXAdj[c + 1]; k++) {
+				int face = colouring.colourItems[k];
+
+				for(int j = xadj[face]; j < xadj[face + 1]; j++) {
+					BOOST_CHECK(lastColour[adjncy[j]] != c);
+					lastColour[adjncy[j]] = c;
+				}
+			}
+		}
+	}
+
+	// At distance 2, the faces that share a cell with any one face also all have different colours
+	std::vector<std::vector<int>> cellFaces(nx * nx);
+	for(int face = 0; face < nFaces; face++) {
+		for(int j = xadj[face]; j < xadj[face + 1]; j++) {
+			cellFaces[adjncy[j]].push_back(face);
+		}
+	}
+
+	std::vector<int> lastMarked(colouring.nColours, -1);
+	for(int face = 0; face < nFaces; face++) {
+		std::vector<int> conflicts;
+		for(int j = xadj[face]; j < xadj[face + 1]; j++) {
+			for(std::size_t k = 0; k < cellFaces[adjncy[j]].size(); k++) {
+				int other = cellFaces[adjncy[j]][k];
+				if(std::find(conflicts.begin(), conflicts.end(), other) == conflicts.end()) {
+					conflicts.push_back(other);
+				}
+			}
+		}
+
+		for(std::size_t k = 0; k < conflicts.size(); k++) {
+			BOOST_CHECK(lastMarked[colouring.colours[conflicts[k]]] != face);
+			lastMarked[colouring.colours[conflicts[k]]] = face;
+		}
+	}
+}
+
+// Test 2: Items with no valid targets are left uncoloured
+BOOST_AUTO_TEST_CASE(colourIncidence_test2)
+{
+	GraphColouring<int> colouring;
+	cupcfd::error::eCodes status;
+
+	// Base 1 incidence. Item 1 only touches an out of range target.
+	std::vector<int> xadj = {0, 2, 3, 5};
+	std::vector<int> adjncy = {1, 2, 7, 2, 3};
+
+	status = colouring.colourIncidence(xadj.data(), adjncy.data(), 3, 3, 1, 1, false);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(colouring.colours[0], 0);
+	BOOST_CHECK_EQUAL(colouring.colours[1], -1);
+	BOOST_CHECK_EQUAL(colouring.colours[2], 1);
+	BOOST_CHECK_EQUAL(colouring.nColours, 2);
+	BOOST_CHECK_EQUAL(colouring.colourXAdj[2], 2);
+}
@@ -0,0 +1,391 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the SparseMatrixBSR class
+ */
+
+#define BOOST_TEST_MODULE SparseMatrixBSR
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+#include <vector>
+
+#include "SparseMatrixBSR.h"
+#include "SparseMatrixCSR.h"
+#include "Error.h"
+
+using namespace cupcfd::data_structures;
+
+// Build a block tridiagonal matrix with 3x3 blocks. The diagonal blocks are
+// block diagonally dominant, the off-diagonal blocks are -0.5 * Identity.
+void buildTestBSR(SparseMatrixBSR<int, double, 3>& matrix, int mb) {
+	cupcfd::error::eCodes status;
+
+	double diag[9] = {4.0, 1.0, 0.0,
+					  1.0, 4.0, 1.0,
+					  0.0, 1.0, 4.0};
+
+	double offDiag[9] = {-0.5, 0.0, 0.0,
+						 0.0, -0.5, 0.0,
+						 0.0, 0.0, -0.5};
+
+	for(int i = 0; i < mb; i++) {
+		status = matrix.setBlock(i, i, diag);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		if(i > 0) {
+			status = matrix.setBlock(i, i - 1, offDiag);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+
+		if(i < mb - 1) {
+			status = matrix.setBlock(i, i + 1, offDiag);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+	}
+}
+
+// =========================================================================
+// === Constructor Tests ===
+// =========================================================================
+// Test 1: Default Constructor is a single block
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	SparseMatrixBSR<int, double, 3> matrix;
+
+	BOOST_CHECK_EQUAL(matrix.m, 3);
+	BOOST_CHECK_EQUAL(matrix.n, 3);
+	BOOST_CHECK_EQUAL(matrix.mb, 1);
+	BOOST_CHECK_EQUAL(matrix.nb, 1);
+	BOOST_CHECK_EQUAL(matrix.baseIndex, 0);
+	BOOST_CHECK_EQUAL(matrix.nnz, 0);
+}
+
+// Test 2: Size and base index
+BOOST_AUTO_TEST_CASE(constructor_test2)
+{
+	SparseMatrixBSR<int, double, 3> matrix(6, 9, 1);
+
+	BOOST_CHECK_EQUAL(matrix.m, 6);
+	BOOST_CHECK_EQUAL(matrix.n, 9);
+	BOOST_CHECK_EQUAL(matrix.mb, 2);
+	BOOST_CHECK_EQUAL(matrix.nb, 3);
+	BOOST_CHECK_EQUAL(matrix.baseIndex, 1);
+	BOOST_CHECK_EQUAL(matrix.rowPtr.size(), 3);
+}
+
+// =========================================================================
+// === resize Tests ===
+// =========================================================================
+// Test 1: Sizes must be a multiple of the block size
+BOOST_AUTO_TEST_CASE(resize_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixBSR<int, double, 2> matrix;
+
+	status = matrix.resize(3, 4);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_INVALID_ROW_SIZE);
+
+	status = matrix.resize(4, 5);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_INVALID_COL_SIZE);
+
+	status = matrix.resize(4, 6);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.mb, 2);
+	BOOST_CHECK_EQUAL(matrix.nb, 3);
+}
+
+// =========================================================================
+// === setElement/getElement Tests ===
+// =========================================================================
+// Test 1: Setting an element stores a whole block, and overwriting updates in place
+BOOST_AUTO_TEST_CASE(setElement_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixBSR<int, double, 2> matrix(4, 4, 1);
+	double val;
+
+	status = matrix.setElement(4, 3, 5.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.nnz, 4);
+	BOOST_CHECK_EQUAL(matrix.blockCol.size(), 1);
+
+	// Same block, different element
+	status = matrix.setElement(3, 4, 2.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.nnz, 4);
+
+	// Overwrite
+	status = matrix.setElement(4, 3, 6.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = matrix.getElement(4, 3, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 6.0);
+
+	status = matrix.getElement(3, 4, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 2.0);
+
+	// Explicit zero within a stored block
+	status = matrix.getElement(3, 3, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 0.0);
+
+	// Unstored block
+	status = matrix.getElement(1, 1, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 0.0);
+}
+
+// Test 2: Out of bounds
+BOOST_AUTO_TEST_CASE(setElement_test2)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixBSR<int, double, 2> matrix(4, 4, 1);
+
+	status = matrix.setElement(0, 1, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
+
+	status = matrix.setElement(1, 5, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_COL_OOB);
+}
+
+// =========================================================================
+// === setBlock/getBlock Tests ===
+// =========================================================================
+// Test 1: Blocks are kept sorted by block column when inserted out of order
+BOOST_AUTO_TEST_CASE(setBlock_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixBSR<int, double, 2> matrix(4, 6);
+
+	double a[4] = {1.0, 2.0, 3.0, 4.0};
+	double b[4] = {5.0, 6.0, 7.0, 8.0};
+	double result[4];
+
+	status = matrix.setBlock(0, 2, a);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setBlock(0, 0, b);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setBlock(1, 1, a);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int rowPtrCmp[3] = {0, 2, 3};
+	int blockColCmp[3] = {0, 2, 1};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.rowPtr.begin(), matrix.rowPtr.end(), rowPtrCmp, rowPtrCmp + 3);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.blockCol.begin(), matrix.blockCol.end(), blockColCmp, blockColCmp + 3);
+	BOOST_CHECK_EQUAL(matrix.nnz, 12);
+
+	status = matrix.getBlock(0, 2, result);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(result, result + 4, a, a + 4);
+
+	status = matrix.getBlock(0, 0, result);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(result, result + 4, b, b + 4);
+
+	status = matrix.getBlock(2, 0, result);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
+}
+
+// =========================================================================
+// === multiply Tests ===
+// =========================================================================
+// Test 1: Block SpMV matches the equivalent CSR SpMV
+BOOST_AUTO_TEST_CASE(multiply_test1)
+{
+	cupcfd::error::eCodes status;
+	int mb = 5;
+
+	SparseMatrixBSR<int, double, 3> matrix(mb * 3, mb * 3);
+	buildTestBSR(matrix, mb);
+
+	// Copy the stored entries (including explicit zeroes) into a CSR matrix
+	SparseMatrixCSR<int, double> csr(mb * 3, mb * 3, 0);
+	for(int row = 0; row < mb * 3; row++) {
+		int * columnIndexes;
+		int nColumnIndexes;
+		double * nnzValues;
+		int nNNZValues;
+
+		status = matrix.getRowColumnIndexes(row, &columnIndexes, &nColumnIndexes);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		status = matrix.getRowNNZValues(row, &nnzValues, &nNNZValues);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		for(int j = 0; j < nColumnIndexes; j++) {
+			status = csr.setElement(row, columnIndexes[j], nnzValues[j]);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+
+		free(columnIndexes);
+		free(nnzValues);
+	}
+
+	std::vector<double> x(mb * 3);
+	for(int i = 0; i < mb * 3; i++) {
+		x[i] = 1.0 + (0.25 * i);
+	}
+
+	std::vector<double> y(mb * 3);
+	std::vector<double> yCmp(mb * 3);
+
+	status = matrix.multiply(&(x[0]), mb * 3, &(y[0]), mb * 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = csr.multiply(&(x[0]), mb * 3, &(yCmp[0]), mb * 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < mb * 3; i++) {
+		BOOST_CHECK_CLOSE(y[i], yCmp[i], 1e-12);
+	}
+}
+
+// Test 2: Size mismatch
+BOOST_AUTO_TEST_CASE(multiply_test2)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixBSR<int, double, 3> matrix(6, 6);
+
+	std::vector<double> x(6);
+	std::vector<double> y(5);
+
+	status = matrix.multiply(&(x[0]), 6, &(y[0]), 5);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+}
+
+// =========================================================================
+// === Block Jacobi Tests ===
+// =========================================================================
+// Test 1: Block Jacobi converges on a block diagonally dominant system
+BOOST_AUTO_TEST_CASE(blockJacobi_test1)
+{
+	cupcfd::error::eCodes status;
+	int mb = 6;
+	int m = mb * 3;
+
+	SparseMatrixBSR<int, double, 3> matrix(m, m);
+	buildTestBSR(matrix, mb);
+
+	status = matrix.setupBlockJacobi();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Solution of all ones
+	std::vector<double> xSolution(m, 1.0);
+	std::vector<double> b(m);
+	status = matrix.multiply(&(xSolution[0]), m, &(b[0]), m);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<double> x(m, 0.0);
+	status = matrix.blockJacobi(&(b[0]), m, &(x[0]), m, 60);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < m; i++) {
+		BOOST_CHECK_CLOSE(x[i], 1.0, 1e-8);
+	}
+}
+
+// Test 2: Applying the inverse diagonal to a diagonal block row recovers the input
+BOOST_AUTO_TEST_CASE(applyBlockJacobi_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixBSR<int, double, 3> matrix(3, 3);
+	buildTestBSR(matrix, 1);
+
+	status = matrix.setupBlockJacobi();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double x[3] = {1.0, 2.0, 3.0};
+	double r[3];
+	double z[3];
+
+	status = matrix.multiply(x, 3, r, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.applyBlockJacobi(r, 3, z, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < 3; i++) {
+		BOOST_CHECK_CLOSE(z[i], x[i], 1e-12);
+	}
+}
+
+// Test 3: A missing or singular diagonal block is reported
+BOOST_AUTO_TEST_CASE(setupBlockJacobi_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixBSR<int, double, 2> matrix(4, 4);
+
+	double a[4] = {1.0, 2.0, 3.0, 4.0};
+	double singular[4] = {1.0, 2.0, 2.0, 4.0};
+
+	status = matrix.setBlock(0, 0, a);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Block row 1 has no diagonal block
+	status = matrix.setupBlockJacobi();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_SINGULAR_BLOCK);
+
+	status = matrix.setBlock(1, 1, singular);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setupBlockJacobi();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_SINGULAR_BLOCK);
+
+	double r[4] = {1.0, 1.0, 1.0, 1.0};
+	double z[4];
+	status = matrix.applyBlockJacobi(r, 4, z, 4);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_SINGULAR_BLOCK);
+}
+
+// =========================================================================
+// === Row Access Tests ===
+// =========================================================================
+// Test 1: Scalar rows expose every column of each stored block, with the base index applied
+BOOST_AUTO_TEST_CASE(getRowColumnIndexes_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixBSR<int, double, 2> matrix(4, 6, 1);
+
+	double a[4] = {1.0, 2.0, 3.0, 4.0};
+	status = matrix.setBlock(1, 0, a);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setBlock(1, 2, a);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int * rowIndexes;
+	int nRowIndexes;
+	status = matrix.getNonZeroRowIndexes(&rowIndexes, &nRowIndexes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int rowCmp[2] = {3, 4};
+	BOOST_CHECK_EQUAL_COLLECTIONS(rowIndexes, rowIndexes + nRowIndexes, rowCmp, rowCmp + 2);
+	free(rowIndexes);
+
+	int * columnIndexes;
+	int nColumnIndexes;
+	double * nnzValues;
+	int nNNZValues;
+
+	// Second scalar row of block row 1
+	status = matrix.getRowColumnIndexes(4, &columnIndexes, &nColumnIndexes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.getRowNNZValues(4, &nnzValues, &nNNZValues);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int colCmp[4] = {1, 2, 5, 6};
+	double valCmp[4] = {3.0, 4.0, 3.0, 4.0};
+	BOOST_CHECK_EQUAL_COLLECTIONS(columnIndexes, columnIndexes + nColumnIndexes, colCmp, colCmp + 4);
+	BOOST_CHECK_EQUAL_COLLECTIONS(nnzValues, nnzValues + nNNZValues, valCmp, valCmp + 4);
+
+	free(columnIndexes);
+	free(nnzValues);
+
+	status = matrix.getRowColumnIndexes(5, &columnIndexes, &nColumnIndexes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
+}
@@ -16,6 +16,7 @@
 #include <stdexcept>
 
 #include "SparseMatrixCOO.h"
+#include "SparseMatrixCSR.h"
 #include "Error.h"
 
 #include <iostream>
@@ -720,3 +721,95 @@ BOOST_AUTO_TEST_CASE(getRowNNZValues_test3)
 	status = matrix.getRowNNZValues(8, &nnzValues, &nNNZValues);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
 }
+
+// === multiply Tests ===
+// Test 1: Compute a product with a non-zero base index
+BOOST_AUTO_TEST_CASE(multiply_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCOO<int, double> matrix(3, 4, 1);
+
+	// [ 2 0 1 0 ]
+	// [ 0 0 0 0 ]
+	// [ 0 3 0 4 ]
+	status = matrix.setElement(1, 1, 2.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(1, 3, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(3, 4, 4.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(3, 2, 3.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double x[4] = {1.0, 2.0, 3.0, 4.0};
+	double y[3] = {-1.0, -1.0, -1.0};
+	double yCmp[3] = {5.0, 0.0, 22.0};
+
+	status = matrix.multiply(x, 4, y, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(y, y + 3, yCmp, yCmp + 3);
+
+	// Size mismatch
+	status = matrix.multiply(x, 3, y, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+}
+
+// === setElements Tests ===
+// Test 1: A batch with duplicates is merged with the existing entries in sorted order
+BOOST_AUTO_TEST_CASE(setElements_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCOO<int, double> matrix(3, 3, 0);
+
+	status = matrix.setElement(1, 1, 9.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int rows[4] = {2, 0, 2, 1};
+	int cols[4] = {0, 2, 0, 1};
+	double vals[4] = {1.0, 2.0, 3.0, 4.0};
+
+	status = matrix.setElements(rows, cols, vals, 4);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.nnz, 3);
+
+	int rowCmp[3] = {0, 1, 2};
+	int colCmp[3] = {2, 1, 0};
+	double valCmp[3] = {2.0, 4.0, 4.0};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.row.begin(), matrix.row.end(), rowCmp, rowCmp + 3);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.col.begin(), matrix.col.end(), colCmp, colCmp + 3);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.val.begin(), matrix.val.end(), valCmp, valCmp + 3);
+}
+
+// === Conversion Constructor Tests ===
+// Test 1: Convert from a CSR matrix
+BOOST_AUTO_TEST_CASE(constructor_csr_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, double> csr(3, 4, 1);
+
+	status = csr.setElement(3, 2, 3.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = csr.setElement(1, 3, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = csr.setElement(1, 1, 2.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	SparseMatrixCOO<int, double> matrix(csr);
+
+	BOOST_CHECK_EQUAL(matrix.m, 3);
+	BOOST_CHECK_EQUAL(matrix.n, 4);
+	BOOST_CHECK_EQUAL(matrix.baseIndex, 1);
+	BOOST_CHECK_EQUAL(matrix.nnz, 3);
+
+	int rowCmp[3] = {1, 1, 3};
+	int colCmp[3] = {1, 3, 2};
+	double valCmp[3] = {2.0, 1.0, 3.0};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.row.begin(), matrix.row.end(), rowCmp, rowCmp + 3);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.col.begin(), matrix.col.end(), colCmp, colCmp + 3);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.val.begin(), matrix.val.end(), valCmp, valCmp + 3);
+}
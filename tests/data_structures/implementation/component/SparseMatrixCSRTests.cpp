@@ -16,6 +16,7 @@
 #include <stdexcept>
 
 #include "SparseMatrixCSR.h"
+#include "SparseMatrixCOO.h"
 #include "Error.h"
 
 using namespace cupcfd::data_structures;
@@ -718,3 +719,201 @@ BOOST_AUTO_TEST_CASE(getRowNNZValues_test3)
 	status = matrix.getRowNNZValues(8, &nnzValues, &nNNZValues);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
 }
+
+// === multiply Tests ===
+// Test 1: Compute a product with a non-zero base index
+BOOST_AUTO_TEST_CASE(multiply_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, double> matrix(3, 4, 1);
+
+	// [ 2 0 1 0 ]
+	// [ 0 0 0 0 ]
+	// [ 0 3 0 4 ]
+	status = matrix.setElement(1, 1, 2.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(1, 3, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(3, 4, 4.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(3, 2, 3.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double x[4] = {1.0, 2.0, 3.0, 4.0};
+	double y[3] = {-1.0, -1.0, -1.0};
+	double yCmp[3] = {5.0, 0.0, 22.0};
+
+	status = matrix.multiply(x, 4, y, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(y, y + 3, yCmp, yCmp + 3);
+
+	// Size mismatch
+	status = matrix.multiply(x, 3, y, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+}
+
+// === residual Tests ===
+// Test 1: Compute r = b - Ax and the squared norm of r
+BOOST_AUTO_TEST_CASE(residual_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, double> matrix(3, 4, 1);
+
+	// [ 2 0 1 0 ]
+	// [ 0 0 0 0 ]
+	// [ 0 3 0 4 ]
+	status = matrix.setElement(1, 1, 2.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(1, 3, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(3, 4, 4.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(3, 2, 3.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double x[4] = {1.0, 2.0, 3.0, 4.0};
+	double b[3] = {6.0, 2.0, 20.0};
+	double r[3] = {-1.0, -1.0, -1.0};
+	double rCmp[3] = {1.0, 2.0, -2.0};
+	double rNormSq;
+
+	status = matrix.residual(x, 4, b, 3, r, 3, &rNormSq);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(r, r + 3, rCmp, rCmp + 3);
+	BOOST_CHECK_EQUAL(rNormSq, 9.0);
+}
+
+// Test 2: Error Case - vector sizes do not match the matrix dimensions
+BOOST_AUTO_TEST_CASE(residual_test2)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, double> matrix(3, 4, 1);
+
+	double x[4] = {1.0, 2.0, 3.0, 4.0};
+	double b[3] = {6.0, 2.0, 20.0};
+	double r[3];
+	double rNormSq;
+
+	status = matrix.residual(x, 3, b, 3, r, 3, &rNormSq);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+
+	status = matrix.residual(x, 4, b, 2, r, 3, &rNormSq);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+
+	status = matrix.residual(x, 4, b, 3, r, 4, &rNormSq);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+}
+
+// === setElements Tests ===
+// Test 1: Build from an unordered batch with duplicates, which are summed
+BOOST_AUTO_TEST_CASE(setElements_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, double> matrix(3, 4, 1);
+
+	int rows[6] = {3, 1, 3, 1, 3, 1};
+	int cols[6] = {4, 3, 2, 1, 4, 3};
+	double vals[6] = {1.0, 1.5, 3.0, 2.0, 3.0, 0.25};
+
+	status = matrix.setElements(rows, cols, vals, 6);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.nnz, 4);
+
+	int IACmp[4] = {0, 2, 2, 4};
+	int JACmp[4] = {1, 3, 2, 4};
+	double ACmp[4] = {2.0, 1.75, 3.0, 4.0};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.IA.begin(), matrix.IA.end(), IACmp, IACmp + 4);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.JA.begin(), matrix.JA.end(), JACmp, JACmp + 4);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.A.begin(), matrix.A.end(), ACmp, ACmp + 4);
+}
+
+// Test 2: A batch overwrites existing values and merges with the existing structure
+BOOST_AUTO_TEST_CASE(setElements_test2)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, double> matrix(3, 3, 0);
+
+	status = matrix.setElement(0, 0, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(2, 1, 5.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int rows[3] = {0, 1, 0};
+	int cols[3] = {0, 2, 0};
+	double vals[3] = {7.0, 2.0, 1.0};
+
+	status = matrix.setElements(rows, cols, vals, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.nnz, 3);
+
+	double val;
+	status = matrix.getElement(0, 0, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 8.0);
+
+	status = matrix.getElement(1, 2, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 2.0);
+
+	status = matrix.getElement(2, 1, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 5.0);
+}
+
+// Test 3: Out of bounds indexes leave the matrix unchanged
+BOOST_AUTO_TEST_CASE(setElements_test3)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, double> matrix(3, 3, 1);
+
+	int rows[2] = {1, 0};
+	int cols[2] = {1, 1};
+	double vals[2] = {1.0, 1.0};
+
+	status = matrix.setElements(rows, cols, vals, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
+
+	rows[1] = 3;
+	cols[1] = 4;
+	status = matrix.setElements(rows, cols, vals, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_COL_OOB);
+	BOOST_CHECK_EQUAL(matrix.nnz, 0);
+}
+
+// === Conversion Constructor Tests ===
+// Test 1: Convert from a COO matrix
+BOOST_AUTO_TEST_CASE(constructor_coo_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCOO<int, double> coo(3, 4, 1);
+
+	status = coo.setElement(3, 4, 4.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = coo.setElement(1, 3, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = coo.setElement(1, 1, 2.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	SparseMatrixCSR<int, double> matrix(coo);
+
+	BOOST_CHECK_EQUAL(matrix.m, 3);
+	BOOST_CHECK_EQUAL(matrix.n, 4);
+	BOOST_CHECK_EQUAL(matrix.baseIndex, 1);
+	BOOST_CHECK_EQUAL(matrix.nnz, 3);
+
+	int IACmp[4] = {0, 2, 2, 3};
+	int JACmp[3] = {1, 3, 4};
+	double ACmp[3] = {2.0, 1.0, 4.0};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.IA.begin(), matrix.IA.end(), IACmp, IACmp + 4);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.JA.begin(), matrix.JA.end(), JACmp, JACmp + 3);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.A.begin(), matrix.A.end(), ACmp, ACmp + 3);
+}
@@ -0,0 +1,320 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the SparseMatrixSELL class
+ */
+
+#define BOOST_TEST_MODULE SparseMatrixSELL
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+#include <vector>
+
+#include "SparseMatrixSELL.h"
+#include "SparseMatrixCSR.h"
+#include "Error.h"
+
+using namespace cupcfd::data_structures;
+
+// Build a CSR matrix where row i has (i % 5) non-zeroes, in consecutive columns starting at column i (wrapped).
+// Values are chosen to be distinct so misplaced entries are detected.
+void buildTestCSR(SparseMatrixCSR<int, double>& csr, int m, int n) {
+	cupcfd::error::eCodes status;
+
+	for(int i = 0; i < m; i++) {
+		for(int j = 0; j < (i % 5); j++) {
+			int col = (i + j) % n;
+			status = csr.setElement(i + csr.baseIndex, col + csr.baseIndex, 1.0 + i + (0.1 * j));
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+	}
+}
+
+// =========================================================================
+// === Constructor Tests ===
+// =========================================================================
+// Test 1: Default Constructor
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	SparseMatrixSELL<int, double, 4, 1> matrix;
+
+	BOOST_CHECK_EQUAL(matrix.m, 1);
+	BOOST_CHECK_EQUAL(matrix.n, 1);
+	BOOST_CHECK_EQUAL(matrix.baseIndex, 0);
+	BOOST_CHECK_EQUAL(matrix.nnz, 0);
+	BOOST_CHECK_EQUAL(matrix.nChunks, 1);
+	BOOST_CHECK_EQUAL(matrix.getNStoredEntries(), 0);
+}
+
+// Test 2: Size and base index, final chunk partially filled
+BOOST_AUTO_TEST_CASE(constructor_test2)
+{
+	SparseMatrixSELL<int, double, 4, 256> matrix(9, 7, 2);
+
+	BOOST_CHECK_EQUAL(matrix.m, 9);
+	BOOST_CHECK_EQUAL(matrix.n, 7);
+	BOOST_CHECK_EQUAL(matrix.baseIndex, 2);
+	BOOST_CHECK_EQUAL(matrix.nnz, 0);
+	BOOST_CHECK_EQUAL(matrix.nChunks, 3);
+}
+
+// =========================================================================
+// === fromCSR Tests ===
+// =========================================================================
+// Test 1: Rows are sorted by descending length within the window, and chunks
+// are padded to their longest row
+BOOST_AUTO_TEST_CASE(fromCSR_test1)
+{
+	cupcfd::error::eCodes status;
+
+	// Row lengths 0, 1, 2, 3, 4, 0
+	SparseMatrixCSR<int, double> csr(6, 6, 0);
+	buildTestCSR(csr, 6, 6);
+
+	SparseMatrixSELL<int, double, 4, 256> matrix;
+	status = matrix.fromCSR(csr);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(matrix.m, 6);
+	BOOST_CHECK_EQUAL(matrix.n, 6);
+	BOOST_CHECK_EQUAL(matrix.nnz, 10);
+	BOOST_CHECK_EQUAL(matrix.nChunks, 2);
+
+	int permCmp[6] = {4, 3, 2, 1, 0, 5};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.perm.begin(), matrix.perm.end(), permCmp, permCmp + 6);
+
+	int widthCmp[2] = {4, 0};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.chunkWidth.begin(), matrix.chunkWidth.end(), widthCmp, widthCmp + 2);
+
+	// 4 columns * 4 rows for the first chunk, nothing for the second
+	BOOST_CHECK_EQUAL(matrix.getNStoredEntries(), 16);
+}
+
+// Test 2: A sorting window of 1 preserves the row order
+BOOST_AUTO_TEST_CASE(fromCSR_test2)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, double> csr(6, 6, 0);
+	buildTestCSR(csr, 6, 6);
+
+	SparseMatrixSELL<int, double, 4, 1> matrix;
+	status = matrix.fromCSR(csr);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int permCmp[6] = {0, 1, 2, 3, 4, 5};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.perm.begin(), matrix.perm.end(), permCmp, permCmp + 6);
+
+	int widthCmp[2] = {3, 4};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.chunkWidth.begin(), matrix.chunkWidth.end(), widthCmp, widthCmp + 2);
+}
+
+// =========================================================================
+// === toCSR Tests ===
+// =========================================================================
+// Test 1: Converting to SELL and back reproduces the original CSR matrix
+BOOST_AUTO_TEST_CASE(toCSR_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, double> csr(23, 17, 1);
+	buildTestCSR(csr, 23, 17);
+
+	SparseMatrixSELL<int, double, 8, 256> matrix;
+	status = matrix.fromCSR(csr);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	SparseMatrixCSR<int, double> result;
+	status = matrix.toCSR(result);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(result.m, 23);
+	BOOST_CHECK_EQUAL(result.n, 17);
+	BOOST_CHECK_EQUAL(result.baseIndex, 1);
+	BOOST_CHECK_EQUAL(result.nnz, csr.nnz);
+	BOOST_CHECK_EQUAL_COLLECTIONS(result.IA.begin(), result.IA.end(), csr.IA.begin(), csr.IA.end());
+	BOOST_CHECK_EQUAL_COLLECTIONS(result.JA.begin(), result.JA.end(), csr.JA.begin(), csr.JA.end());
+	BOOST_CHECK_EQUAL_COLLECTIONS(result.A.begin(), result.A.end(), csr.A.begin(), csr.A.end());
+}
+
+// =========================================================================
+// === multiply Tests ===
+// =========================================================================
+// Test 1: Product matches the CSR product for each chunk height and sorting window
+BOOST_AUTO_TEST_CASE(multiply_test1)
+{
+	cupcfd::error::eCodes status;
+
+	int m = 53;
+	int n = 41;
+
+	SparseMatrixCSR<int, double> csr(m, n, 0);
+	buildTestCSR(csr, m, n);
+
+	std::vector<double> x(n);
+	for(int i = 0; i < n; i++) {
+		x[i] = 0.5 + (0.25 * i);
+	}
+
+	std::vector<double> yCmp(m);
+	status = csr.multiply(&(x[0]), n, &(yCmp[0]), m);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	SparseMatrixSELL<int, double, 4, 1> sell4;
+	SparseMatrixSELL<int, double, 8, 256> sell8;
+	SparseMatrixSELL<int, double, 16, 256> sell16;
+
+	status = sell4.fromCSR(csr);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = sell8.fromCSR(csr);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = sell16.fromCSR(csr);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<double> y4(m, -1.0);
+	std::vector<double> y8(m, -1.0);
+	std::vector<double> y16(m, -1.0);
+
+	status = sell4.multiply(&(x[0]), n, &(y4[0]), m);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = sell8.multiply(&(x[0]), n, &(y8[0]), m);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = sell16.multiply(&(x[0]), n, &(y16[0]), m);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < m; i++) {
+		BOOST_CHECK_CLOSE(y4[i] + 1.0, yCmp[i] + 1.0, 1e-10);
+		BOOST_CHECK_CLOSE(y8[i] + 1.0, yCmp[i] + 1.0, 1e-10);
+		BOOST_CHECK_CLOSE(y16[i] + 1.0, yCmp[i] + 1.0, 1e-10);
+	}
+}
+
+// Test 2: Error if the vector sizes do not match the matrix
+BOOST_AUTO_TEST_CASE(multiply_test2)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixSELL<int, double, 4, 1> matrix(4, 3, 0);
+
+	double x[4];
+	double y[4];
+
+	status = matrix.multiply(x, 4, y, 4);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+
+	status = matrix.multiply(x, 3, y, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+}
+
+// =========================================================================
+// === setElement/getElement Tests ===
+// =========================================================================
+// Test 1: Insert new entries and overwrite existing entries, using a non-zero base index
+BOOST_AUTO_TEST_CASE(setElement_test1)
+{
+	cupcfd::error::eCodes status;
+	double val;
+
+	SparseMatrixSELL<int, double, 4, 256> matrix(5, 5, 1);
+
+	status = matrix.setElement(2, 3, 4.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(5, 1, 7.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(2, 1, 2.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.nnz, 3);
+
+	// Overwrite
+	status = matrix.setElement(2, 3, 9.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.nnz, 3);
+
+	status = matrix.getElement(2, 3, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 9.0);
+
+	status = matrix.getElement(2, 1, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 2.0);
+
+	status = matrix.getElement(5, 1, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 7.0);
+
+	// Zero entry
+	status = matrix.getElement(4, 4, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 0.0);
+}
+
+// Test 2: Out of bounds indexes
+BOOST_AUTO_TEST_CASE(setElement_test2)
+{
+	cupcfd::error::eCodes status;
+	double val;
+
+	SparseMatrixSELL<int, double, 4, 256> matrix(5, 5, 1);
+
+	status = matrix.setElement(0, 1, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
+
+	status = matrix.setElement(1, 6, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_COL_OOB);
+
+	status = matrix.getElement(6, 1, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
+}
+
+// =========================================================================
+// === Row Access Tests ===
+// =========================================================================
+// Test 1: Row data is returned in the original row order with the base index applied
+BOOST_AUTO_TEST_CASE(getRowColumnIndexes_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, double> csr(6, 6, 1);
+	buildTestCSR(csr, 6, 6);
+
+	SparseMatrixSELL<int, double, 4, 256> matrix;
+	status = matrix.fromCSR(csr);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int * rowIndexes;
+	int nRowIndexes;
+	status = matrix.getNonZeroRowIndexes(&rowIndexes, &nRowIndexes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int rowCmp[4] = {2, 3, 4, 5};
+	BOOST_CHECK_EQUAL_COLLECTIONS(rowIndexes, rowIndexes + nRowIndexes, rowCmp, rowCmp + 4);
+	free(rowIndexes);
+
+	int * columnIndexes;
+	int nColumnIndexes;
+	double * nnzValues;
+	int nNNZValues;
+
+	// Row 3 (index 2 from base 0) has columns 2 and 3 (0-based)
+	status = matrix.getRowColumnIndexes(3, &columnIndexes, &nColumnIndexes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.getRowNNZValues(3, &nnzValues, &nNNZValues);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int colCmp[2] = {3, 4};
+	double valCmp[2] = {3.0, 3.1};
+	BOOST_CHECK_EQUAL_COLLECTIONS(columnIndexes, columnIndexes + nColumnIndexes, colCmp, colCmp + 2);
+	BOOST_CHECK_EQUAL_COLLECTIONS(nnzValues, nnzValues + nNNZValues, valCmp, valCmp + 2);
+
+	free(columnIndexes);
+	free(nnzValues);
+
+	status = matrix.getRowColumnIndexes(7, &columnIndexes, &nColumnIndexes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
+}
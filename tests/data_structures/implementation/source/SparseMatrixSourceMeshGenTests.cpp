@@ -0,0 +1,397 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the SparseMatrixSourceMeshGen class
+ */
+
+#define BOOST_TEST_MODULE SparseMatrixSourceMeshGen
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+
+#include <stdexcept>
+#include <cstdlib>
+#include <vector>
+
+#include "SparseMatrixSourceMeshGen.h"
+#include "SparseMatrixSourceMeshGenConfig.h"
+#include "MeshConfig.h"
+#include "MeshSourceStructGenConfig.h"
+#include "CupCfdAoSMesh.h"
+#include "PartitionerNaiveConfig.h"
+#include "PartitionerConfig.h"
+#include "Reduce.h"
+#include "Error.h"
+
+using namespace cupcfd::data_structures;
+
+namespace meshgeo = cupcfd::geometry::mesh;
+
+// These tests require MPI
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+
+    MPI_Init(&argc, &argv);
+}
+
+// 5x5x5 cube of side 2 - every cell has width 0.4, so the interior face coefficient is
+// 0.16/0.4 = 0.4 and the boundary face coefficient is 0.16/0.2 = 0.8
+meshgeo::CupCfdAoSMesh<int,double,int> * buildTestMesh(cupcfd::comm::Communicator& comm) {
+	cupcfd::error::eCodes status;
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	meshgeo::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	meshgeo::MeshConfig<int, double,int> meshConfig(partConfig, meshSourceConfig);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	return mesh;
+}
+
+// === generate ===
+// Test 1: Without a shift, the rows cover the global matrix once, the columns are sorted
+// and each row sums to its boundary coefficients
+BOOST_AUTO_TEST_CASE(generate_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	SparseMatrixSourceMeshGen<int,double> source(0.0, 0.0);
+	status = source.generate(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int nRows, nCols, nnz, base;
+	status = source.getNRows(&nRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nRows, 125);
+
+	status = source.getNCols(&nCols);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nCols, 125);
+
+	// One diagonal per cell and two entries per interior face (300 interior faces)
+	status = source.getNNZ(&nnz);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nnz, 725);
+
+	status = source.getMatrixIndicesBase(&base);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(base, 0);
+
+	int startRow, nLocalRows;
+	status = source.getLocalRowRange(&startRow, &nLocalRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nLocalRows, mesh->properties.lOCells);
+
+	int nGlobalRows;
+	status = cupcfd::comm::allReduceAdd(&nLocalRows, 1, &nGlobalRows, 1, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nGlobalRows, 125);
+
+	std::vector<int> rowNNZ(nRows);
+	status = source.getNNZRows(rowNNZ.data(), nRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int row = startRow; row < startRow + nLocalRows; row++) {
+		int * cols;
+		int nColsRow;
+		double * vals;
+		int nValsRow;
+
+		status = source.getRowColumnIndexes(row, &cols, &nColsRow);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = source.getRowNNZValues(row, &vals, &nValsRow);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		BOOST_CHECK_EQUAL(nColsRow, nValsRow);
+		BOOST_CHECK_EQUAL(nColsRow, rowNNZ[row]);
+
+		double rowSum = 0.0;
+		double diag = 0.0;
+		int nOffDiag = 0;
+
+		for(int k = 0; k < nColsRow; k++) {
+			if(k > 0) {
+				BOOST_CHECK(cols[k] > cols[k - 1]);
+			}
+
+			if(cols[k] == row) {
+				diag = vals[k];
+			}
+			else {
+				BOOST_CHECK_CLOSE(vals[k], -0.4, 1e-10);
+				nOffDiag++;
+			}
+
+			rowSum = rowSum + vals[k];
+		}
+
+		// Each missing neighbour is a boundary face
+		BOOST_CHECK_CLOSE(diag, (0.4 * nOffDiag) + (0.8 * (6 - nOffDiag)), 1e-10);
+		BOOST_CHECK_SMALL(rowSum - (0.8 * (6 - nOffDiag)), 1e-10);
+
+		free(cols);
+		free(vals);
+	}
+
+	delete(mesh);
+}
+
+// Test 2: The diagonal dominance scales the diagonal of each row
+BOOST_AUTO_TEST_CASE(generate_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	SparseMatrixSourceMeshGen<int,double> source(0.5, 0.0);
+	status = source.generate(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int startRow, nLocalRows;
+	status = source.getLocalRowRange(&startRow, &nLocalRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int row = startRow; row < startRow + nLocalRows; row++) {
+		int * cols;
+		int nColsRow;
+		double * vals;
+		int nValsRow;
+
+		status = source.getRowColumnIndexes(row, &cols, &nColsRow);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = source.getRowNNZValues(row, &vals, &nValsRow);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		int nOffDiag = nColsRow - 1;
+
+		for(int k = 0; k < nColsRow; k++) {
+			if(cols[k] == row) {
+				BOOST_CHECK_CLOSE(vals[k], 1.5 * ((0.4 * nOffDiag) + (0.8 * (6 - nOffDiag))), 1e-10);
+			}
+		}
+
+		free(cols);
+		free(vals);
+	}
+
+	// Smallest Gershgorin bound is 1.5 * 2.4 - 2.4 for an interior cell,
+	// largest is 1.5 * 3.6 + 1.2 for a corner cell
+	BOOST_CHECK_CLOSE(source.conditionEstimate, 6.6 / 1.2, 1e-10);
+
+	delete(mesh);
+}
+
+// Test 3: The target condition number sets a uniform shift that meets the target
+BOOST_AUTO_TEST_CASE(generate_test3)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	SparseMatrixSourceMeshGen<int,double> source(0.0, 10.0);
+	status = source.generate(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// 2S + B is 4.8 for every cell on this mesh
+	double shift = 4.8 / 9.0;
+
+	int startRow, nLocalRows;
+	status = source.getLocalRowRange(&startRow, &nLocalRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int row = startRow; row < startRow + nLocalRows; row++) {
+		int * cols;
+		int nColsRow;
+		double * vals;
+		int nValsRow;
+
+		status = source.getRowColumnIndexes(row, &cols, &nColsRow);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = source.getRowNNZValues(row, &vals, &nValsRow);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		int nOffDiag = nColsRow - 1;
+
+		for(int k = 0; k < nColsRow; k++) {
+			if(cols[k] == row) {
+				BOOST_CHECK_CLOSE(vals[k], (0.4 * nOffDiag) + (0.8 * (6 - nOffDiag)) + shift, 1e-10);
+			}
+		}
+
+		free(cols);
+		free(vals);
+	}
+
+	BOOST_CHECK_CLOSE(source.conditionEstimate, 10.0, 1e-10);
+
+	delete(mesh);
+}
+
+// Test 4: Error Case - the mesh is not finalized
+BOOST_AUTO_TEST_CASE(generate_test4)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> mesh(comm);
+
+	SparseMatrixSourceMeshGen<int,double> source(0.0, 0.0);
+	status = source.generate(mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_UNFINALIZED);
+}
+
+// Test 5: Error Case - the diagonal dominance is negative
+BOOST_AUTO_TEST_CASE(generate_test5)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	SparseMatrixSourceMeshGen<int,double> source(-1.0, 0.0);
+	status = source.generate(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_CONFIG_INVALID_VALUE);
+
+	delete(mesh);
+}
+
+// Test 6: A rank that owns no cells does not affect the condition estimate
+BOOST_AUTO_TEST_CASE(generate_test6)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// 3x1x1 row of cells of width 0.4 - the first three ranks own a cell each, the rest own none
+	meshgeo::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(3, 1, 1, -0.6, 0.6, -0.2, 0.2, -0.2, 0.2);
+	meshgeo::MeshSource<int,double,int> * meshSource;
+	status = meshSourceConfig.buildMeshSource(&meshSource);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int cellLabels[1] = {comm.rank};
+	int nCellLabels = (comm.rank < 3) ? 1 : 0;
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = new meshgeo::CupCfdAoSMesh<int,double,int>(comm);
+	status = mesh->addData(*meshSource, cellLabels, nCellLabels);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = mesh->finalize();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	delete(meshSource);
+
+	SparseMatrixSourceMeshGen<int,double> source(0.5, 0.0);
+	status = source.generate(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int nEmpty = (mesh->properties.lOCells == 0) ? 1 : 0;
+	int nGlobalEmpty;
+	status = cupcfd::comm::allReduceAdd(&nEmpty, 1, &nGlobalEmpty, 1, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK(nGlobalEmpty > 0);
+
+	// Coefficients are 0.4 (interior) and 0.8 (boundary). The end cells have S = 0.4, B = 4.0,
+	// the middle cell S = 0.8, B = 3.2, so the diagonals are 1.5 * 4.4 = 6.6 and 1.5 * 4.0 = 6.0.
+	// Largest Gershgorin bound is 6.6 + 0.4 for an end cell, smallest is 6.0 - 0.8 for the middle cell
+	BOOST_CHECK_CLOSE(source.conditionEstimate, 7.0 / 5.2, 1e-10);
+
+	delete(mesh);
+}
+
+// === getRowColumnIndexes ===
+// Test 1: Error Case - rows not generated on this rank are not available
+BOOST_AUTO_TEST_CASE(getRowColumnIndexes_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	SparseMatrixSourceMeshGen<int,double> source(0.0, 0.0);
+	status = source.generate(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int startRow, nLocalRows;
+	status = source.getLocalRowRange(&startRow, &nLocalRows);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int * cols;
+	int nColsRow;
+	double * vals;
+	int nValsRow;
+
+	status = source.getRowColumnIndexes(startRow + nLocalRows, &cols, &nColsRow);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
+
+	status = source.getRowNNZValues(startRow - 1, &vals, &nValsRow);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
+
+	delete(mesh);
+}
+
+// === getNNZRows ===
+// Test 1: Error Case - the array is not sized to the number of global rows
+BOOST_AUTO_TEST_CASE(getNNZRows_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	SparseMatrixSourceMeshGen<int,double> source(0.0, 0.0);
+	status = source.generate(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<int> rowNNZ(124);
+	status = source.getNNZRows(rowNNZ.data(), 124);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+
+	delete(mesh);
+}
+
+// === SparseMatrixSourceMeshGenConfig ===
+// Test 1: The config builds a generated source with its parameters
+BOOST_AUTO_TEST_CASE(config_buildSparseMatrixSource_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	SparseMatrixSourceMeshGenConfig<int,double> config(0.0, 10.0);
+	SparseMatrixSource<int,double> * source;
+
+	// A mesh is required
+	status = config.buildSparseMatrixSource(&source);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_NOT_IMPLEMENTED);
+
+	status = config.buildSparseMatrixSource(*mesh, &source);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	SparseMatrixSourceMeshGen<int,double> * meshGenSource = dynamic_cast<SparseMatrixSourceMeshGen<int,double> *>(source);
+	BOOST_CHECK(meshGenSource != nullptr);
+	BOOST_CHECK_CLOSE(meshGenSource->conditionEstimate, 10.0, 1e-10);
+
+	delete(source);
+	delete(mesh);
+}
+
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    MPI_Finalize();
+}
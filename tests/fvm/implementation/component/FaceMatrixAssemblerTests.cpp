@@ -0,0 +1,290 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the FaceMatrixAssembler class
+ */
+
+#define BOOST_TEST_MODULE FaceMatrixAssembler
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "FaceMatrixAssembler.h"
+#include "SparseMatrixCSR.h"
+#include "MeshConfig.h"
+#include "MeshSourceStructGenConfig.h"
+#include "CupCfdAoSMesh.h"
+
+#include "PartitionerNaiveConfig.h"
+#include "PartitionerConfig.h"
+
+#include <cstdlib>
+
+using namespace cupcfd::fvm;
+
+namespace utf = boost::unit_test;
+namespace meshgeo = cupcfd::geometry::mesh;
+
+// Setup
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+
+    MPI_Init(&argc, &argv);
+}
+
+meshgeo::CupCfdAoSMesh<int,double,int> * buildTestMesh(cupcfd::comm::Communicator& comm) {
+	cupcfd::error::eCodes status;
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	meshgeo::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	meshgeo::MeshConfig<int, double,int> meshConfig(partConfig, meshSourceConfig);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	return mesh;
+}
+
+// === symbolic ===
+// Test 1: The pattern has a diagonal for every owned cell and one entry per owned side of each interior face
+BOOST_AUTO_TEST_CASE(symbolic_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	int nOwnedCells = mesh->properties.lOCells;
+	int nFaces = mesh->properties.lFaces;
+
+	int expectedNNZ = nOwnedCells;
+	for(int i = 0; i < nFaces; i++) {
+		if(!mesh->getFaceIsBoundary(i)) {
+			if(mesh->getFaceCell1ID(i) < nOwnedCells) expectedNNZ++;
+			if(mesh->getFaceCell2ID(i) < nOwnedCells) expectedNNZ++;
+		}
+	}
+
+	FaceMatrixAssembler<int,double> assembler;
+	cupcfd::data_structures::SparseMatrixCSR<int,double> matrix(1, 1, 0);
+
+	status = assembler.symbolic(*mesh, matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(matrix.m, nOwnedCells);
+	BOOST_CHECK_EQUAL(matrix.n, mesh->properties.lTCells);
+	BOOST_CHECK_EQUAL(matrix.nnz, expectedNNZ);
+	BOOST_CHECK_EQUAL(assembler.nnz, expectedNNZ);
+	BOOST_CHECK_EQUAL(assembler.symbolicBuilt, true);
+
+	// Each face slot must point at the entry for its (row, column)
+	for(int i = 0; i < nFaces; i++) {
+		int ip = mesh->getFaceCell1ID(i);
+		int in = mesh->getFaceCell2ID(i);
+
+		if(mesh->getFaceIsBoundary(i)) {
+			for(int k = 0; k < 4; k++) {
+				BOOST_CHECK_EQUAL(assembler.faceSlots[(4 * i) + k], -1);
+			}
+			continue;
+		}
+
+		if(ip < nOwnedCells) {
+			BOOST_CHECK_EQUAL(matrix.JA[assembler.faceSlots[(4 * i)]], in);
+			BOOST_CHECK_EQUAL(matrix.JA[assembler.faceSlots[(4 * i) + 2]], ip);
+		}
+
+		if(in < nOwnedCells) {
+			BOOST_CHECK_EQUAL(matrix.JA[assembler.faceSlots[(4 * i) + 1]], ip);
+			BOOST_CHECK_EQUAL(matrix.JA[assembler.faceSlots[(4 * i) + 3]], in);
+		}
+	}
+
+	delete(mesh);
+}
+
+// Test 2: No two faces of the same colour share a cell, and every contributing face is coloured once
+BOOST_AUTO_TEST_CASE(symbolic_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	FaceMatrixAssembler<int,double> assembler;
+	cupcfd::data_structures::SparseMatrixCSR<int,double> matrix(1, 1, 0);
+
+	status = assembler.symbolic(*mesh, matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int nContributing = 0;
+	for(int i = 0; i < mesh->properties.lFaces; i++) {
+		if(assembler.faceSlots[(4 * i)] >= 0 || assembler.faceSlots[(4 * i) + 1] >= 0) {
+			nContributing++;
+		}
+	}
+
+	BOOST_CHECK(assembler.nColours > 0);
+	BOOST_CHECK_EQUAL(assembler.colourXAdj[assembler.nColours], nContributing);
+
+	std::vector<int> lastColour(mesh->properties.lTCells, -1);
+	for(int c = 0; c < assembler.nColours; c++) {
+		for(int k = assembler.colourXAdj[c]; k < assembler.colourXAdj[c + 1]; k++) {
+			int face = assembler.colourFaces[k];
+			int ip = mesh->getFaceCell1ID(face);
+			int in = mesh->getFaceCell2ID(face);
+
+			BOOST_CHECK(lastColour[ip] != c);
+			BOOST_CHECK(lastColour[in] != c);
+
+			lastColour[ip] = c;
+			lastColour[in] = c;
+		}
+	}
+
+	delete(mesh);
+}
+
+// Test 3: Error Case - the mesh is not finalized
+BOOST_AUTO_TEST_CASE(symbolic_test3)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> mesh(comm);
+
+	FaceMatrixAssembler<int,double> assembler;
+	cupcfd::data_structures::SparseMatrixCSR<int,double> matrix(1, 1, 0);
+
+	status = assembler.symbolic(mesh, matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_UNFINALIZED);
+	BOOST_CHECK_EQUAL(assembler.symbolicBuilt, false);
+}
+
+// === numeric ===
+// Test 1: The assembled values match a reference built with setElement/getElement,
+// and repeated assembly does not accumulate
+BOOST_AUTO_TEST_CASE(numeric_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+
+	int nOwnedCells = mesh->properties.lOCells;
+	int nCells = mesh->properties.lTCells;
+	int nFaces = mesh->properties.lFaces;
+
+	std::vector<double> rface(2 * nFaces);
+	for(int i = 0; i < 2 * nFaces; i++) {
+		rface[i] = 1.0 + (0.01 * i);
+	}
+
+	FaceMatrixAssembler<int,double> assembler;
+	cupcfd::data_structures::SparseMatrixCSR<int,double> matrix(1, 1, 0);
+
+	status = assembler.symbolic(*mesh, matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int r = 0; r < 2; r++) {
+		status = assembler.numeric(&(rface[0]), 2 * nFaces, matrix);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	// Reference
+	cupcfd::data_structures::SparseMatrixCSR<int,double> reference(nOwnedCells, nCells, 0);
+	double val;
+
+	for(int i = 0; i < nFaces; i++) {
+		if(!mesh->getFaceIsBoundary(i)) {
+			int ip = mesh->getFaceCell1ID(i);
+			int in = mesh->getFaceCell2ID(i);
+
+			if(ip < nOwnedCells) {
+				status = reference.getElement(ip, in, &val);
+				status = reference.setElement(ip, in, val + rface[2 * i]);
+				status = reference.getElement(ip, ip, &val);
+				status = reference.setElement(ip, ip, val - rface[2 * i]);
+			}
+
+			if(in < nOwnedCells) {
+				status = reference.getElement(in, ip, &val);
+				status = reference.setElement(in, ip, val + rface[(2 * i) + 1]);
+				status = reference.getElement(in, in, &val);
+				status = reference.setElement(in, in, val - rface[(2 * i) + 1]);
+			}
+		}
+	}
+
+	BOOST_CHECK_EQUAL(reference.nnz, matrix.nnz);
+
+	double expected;
+	for(int i = 0; i < nOwnedCells; i++) {
+		for(int k = matrix.IA[i]; k < matrix.IA[i + 1]; k++) {
+			status = reference.getElement(i, matrix.JA[k], &expected);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+			BOOST_CHECK_CLOSE(matrix.A[k], expected, 1e-10);
+		}
+	}
+
+	delete(mesh);
+}
+
+// Test 2: Error Case - the symbolic phase has not been run
+BOOST_AUTO_TEST_CASE(numeric_test2)
+{
+	cupcfd::error::eCodes status;
+
+	FaceMatrixAssembler<int,double> assembler;
+	cupcfd::data_structures::SparseMatrixCSR<int,double> matrix(1, 1, 0);
+	double rface[2] = {1.0, 1.0};
+
+	status = assembler.numeric(rface, 2, matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_UNFINALIZED);
+}
+
+// Test 3: Error Case - rface or the matrix pattern does not match the symbolic phase
+BOOST_AUTO_TEST_CASE(numeric_test3)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh = buildTestMesh(comm);
+	int nFaces = mesh->properties.lFaces;
+
+	FaceMatrixAssembler<int,double> assembler;
+	cupcfd::data_structures::SparseMatrixCSR<int,double> matrix(1, 1, 0);
+
+	status = assembler.symbolic(*mesh, matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<double> rface(2 * nFaces, 1.0);
+
+	status = assembler.numeric(&(rface[0]), nFaces, matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+
+	status = matrix.clear();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = assembler.numeric(&(rface[0]), 2 * nFaces, matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+
+	delete(mesh);
+}
+
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    MPI_Finalize();
+}
@@ -16,11 +16,14 @@
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "GradientKernels.h"
 #include "MeshConfig.h"
 #include "MeshSourceStructGenConfig.h"
 #include "CupCfdAoSMesh.h"
+#include "CupCfdSoAMesh.h"
+#include "CupCfdAoSoAMesh.h"
 #include "EuclideanVector.h"
 
 #include "PartitionerNaiveConfig.h"
@@ -57,7 +60,7 @@ BOOST_AUTO_TEST_CASE(GradientPhiGaussDolfyn_test1)
     cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
 
 	// Setup the source config
-    meshgeo::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+    meshgeo::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 
 	// Setup the config to use for building
     meshgeo::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
@@ -87,6 +90,97 @@ BOOST_AUTO_TEST_CASE(GradientPhiGaussDolfyn_test1)
 	delete(mesh);
 }
 
+// Set a linear field on the cells and a constant on each boundary, so that the gradient is non-trivial
+template <class M>
+void setGradientFields(M& mesh, std::vector<double>& phiCell, std::vector<double>& phiBoundary)
+{
+	phiCell.resize(mesh.properties.lTCells);
+	phiBoundary.resize(mesh.properties.lBoundaries);
+
+	for(int i = 0; i < mesh.properties.lTCells; i++) {
+		euc::EuclideanPoint<double,3> center = mesh.getCellCenter(i);
+		phiCell[i] = 1.0 + center.cmp[0] + 2.0 * center.cmp[1] + 3.0 * center.cmp[2];
+	}
+
+	for(int i = 0; i < mesh.properties.lBoundaries; i++) {
+		phiBoundary[i] = 0.25 * (i % 7);
+	}
+}
+
+// Check that the tile-aware kernel on an AoSoA mesh of tile width W gives the same results as the generic kernel
+// on the SoA mesh built from the same configuration
+template <int W>
+void checkAoSoAGradient(std::vector<euc::EuclideanVector<double,3>>& dPhidxCmp, std::vector<euc::EuclideanVector<double,3>>& dPhidxoCmp,
+						meshgeo::MeshConfig<int,double,int>& meshConfig, cupcfd::comm::Communicator& comm)
+{
+	cupcfd::error::eCodes status;
+
+	meshgeo::CupCfdAoSoAMesh<int,double,int,W> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<double> phiCell;
+	std::vector<double> phiBoundary;
+	setGradientFields(*mesh, phiCell, phiBoundary);
+
+	int nCells = mesh->properties.lTCells;
+	std::vector<euc::EuclideanVector<double,3>> dPhidxCell(nCells);
+	std::vector<euc::EuclideanVector<double,3>> dPhidxoCell(nCells);
+
+	// The concrete mesh type selects the tile-aware overload
+	status = GradientPhiGaussDolfyn(*mesh, 2, phiCell.data(), nCells,
+			phiBoundary.data(), (int) phiBoundary.size(),
+			dPhidxCell.data(), nCells,
+			dPhidxoCell.data(), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(nCells, (int) dPhidxCmp.size());
+	for(int i = 0; i < nCells; i++) {
+		for(int d = 0; d < 3; d++) {
+			BOOST_CHECK_EQUAL(dPhidxCell[i].cmp[d], dPhidxCmp[i].cmp[d]);
+			BOOST_CHECK_EQUAL(dPhidxoCell[i].cmp[d], dPhidxoCmp[i].cmp[d]);
+		}
+	}
+
+	delete mesh;
+}
+
+// Test 2: The tile-aware kernel for the AoSoA mesh matches the generic kernel for tile widths of 4, 8 and 16
+BOOST_AUTO_TEST_CASE(GradientPhiGaussDolfyn_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// 6 x 5 x 3 cells, so that the last face tile on each rank is only partially filled for some widths
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	meshgeo::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(6, 5, 3, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	meshgeo::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	meshgeo::CupCfdSoAMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<double> phiCell;
+	std::vector<double> phiBoundary;
+	setGradientFields(*mesh, phiCell, phiBoundary);
+
+	int nCells = mesh->properties.lTCells;
+	std::vector<euc::EuclideanVector<double,3>> dPhidxCell(nCells);
+	std::vector<euc::EuclideanVector<double,3>> dPhidxoCell(nCells);
+
+	status = GradientPhiGaussDolfyn(*mesh, 2, phiCell.data(), nCells,
+			phiBoundary.data(), (int) phiBoundary.size(),
+			dPhidxCell.data(), nCells,
+			dPhidxoCell.data(), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	checkAoSoAGradient<4>(dPhidxCell, dPhidxoCell, meshConfig, comm);
+	checkAoSoAGradient<8>(dPhidxCell, dPhidxoCell, meshConfig, comm);
+	checkAoSoAGradient<16>(dPhidxCell, dPhidxoCell, meshConfig, comm);
+
+	delete mesh;
+}
+
 BOOST_AUTO_TEST_CASE(cleanup)
 {
     MPI_Finalize();
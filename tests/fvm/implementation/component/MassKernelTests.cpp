@@ -16,11 +16,14 @@
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "MassKernels.h"
 #include "MeshConfig.h"
 #include "MeshSourceStructGenConfig.h"
 #include "CupCfdAoSMesh.h"
+#include "CupCfdSoAMesh.h"
+#include "CupCfdAoSoAMesh.h"
 #include "EuclideanVector.h"
 
 #include "PartitionerNaiveConfig.h"
@@ -57,7 +60,7 @@ BOOST_AUTO_TEST_CASE(FluxMassDolfynFaceLoop_test1)
     cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
 
 	// Setup the source config
-    meshgeo::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+    meshgeo::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 
 	// Setup the config to use for building
     meshgeo::MeshConfig<int, double,int> meshConfig(partConfig, meshSourceConfig);
@@ -160,6 +163,198 @@ BOOST_AUTO_TEST_CASE(FluxMassDolfynFaceLoop_test1)
 	delete(mesh);
 }
 
+// Give every region of the mesh the same type, and set the region values read by the inlet branch of the kernel
+template <class M>
+void setBoundaryConditions(M& mesh, meshgeo::RType type)
+{
+	euc::EuclideanVector<double,3> uvw(1.0, 0.5, -0.25);
+
+	for(int i = 0; i < mesh.properties.lRegions; i++) {
+		mesh.setRegionType(i, type);
+		mesh.setRegionUVW(i, uvw);
+		mesh.setRegionDen(i, 1.1);
+	}
+}
+
+// The inputs and outputs of FluxMassDolfynFaceLoop, with the inputs set from the cell centres
+// so that the results differ from face to face
+struct MassFields
+{
+	std::vector<euc::EuclideanVector<double,3>> dudx, dvdx, dwdx, dpdx;
+	std::vector<double> denCell, denBoundary, uCell, vCell, wCell, massFlux, p, ar, su, rface;
+	std::vector<double> teCell, teBoundary, edCell, edBoundary, viseffCell, viseffBoundary, tCell, tBoundary;
+	int icinl, icout, icsym, icwal;
+
+	template <class M>
+	void set(M& mesh) {
+		int nCells = mesh.properties.lTCells;
+		int nBnds = mesh.properties.lBoundaries;
+		int nFaces = mesh.properties.lFaces;
+
+		dudx.resize(nCells);
+		dvdx.resize(nCells);
+		dwdx.resize(nCells);
+		dpdx.resize(nCells);
+		denCell.resize(nCells);
+		uCell.resize(nCells);
+		vCell.resize(nCells);
+		wCell.resize(nCells);
+		p.resize(nCells);
+		ar.assign(nCells, 0.0);
+		su.assign(nCells, 0.0);
+		teCell.resize(nCells);
+		edCell.resize(nCells);
+		viseffCell.resize(nCells);
+		tCell.resize(nCells);
+
+		for(int i = 0; i < nCells; i++) {
+			euc::EuclideanPoint<double,3> center = mesh.getCellCenter(i);
+			double x = center.cmp[0];
+			double y = center.cmp[1];
+			double z = center.cmp[2];
+
+			dudx[i] = euc::EuclideanVector<double,3>(0.1 * x, 0.2 * y, 0.3 * z);
+			dvdx[i] = euc::EuclideanVector<double,3>(0.2 * y, 0.3 * z, 0.1 * x);
+			dwdx[i] = euc::EuclideanVector<double,3>(0.3 * z, 0.1 * x, 0.2 * y);
+			dpdx[i] = euc::EuclideanVector<double,3>(x + y, y + z, z + x);
+			denCell[i] = 1.2 + 0.1 * x;
+			uCell[i] = 1.0 + x - y;
+			vCell[i] = 0.5 - y + z;
+			wCell[i] = -0.5 + z - x;
+			p[i] = 2.0 + x + 2.0 * y + 3.0 * z;
+			teCell[i] = 0.1 + 0.01 * y;
+			edCell[i] = 0.2 + 0.01 * z;
+			viseffCell[i] = 1.5 + 0.1 * y;
+			tCell[i] = 300.0 + x;
+		}
+
+		denBoundary.assign(nBnds, 0.0);
+		teBoundary.assign(nBnds, 0.0);
+		edBoundary.assign(nBnds, 0.0);
+		viseffBoundary.assign(nBnds, 0.0);
+		tBoundary.assign(nBnds, 0.0);
+
+		massFlux.assign(nFaces, 0.0);
+		rface.assign(nFaces * 2, 0.0);
+
+		icinl = 0;
+		icout = 0;
+		icsym = 0;
+		icwal = 0;
+	}
+
+	template <class M>
+	cupcfd::error::eCodes run(M& mesh) {
+		int nCells = mesh.properties.lTCells;
+		int nBnds = mesh.properties.lBoundaries;
+		int nFaces = mesh.properties.lFaces;
+
+		return FluxMassDolfynFaceLoop(mesh,
+				dudx.data(), nCells,
+				dvdx.data(), nCells,
+				dwdx.data(), nCells,
+				dpdx.data(), nCells,
+				denCell.data(), nCells,
+				denBoundary.data(), nBnds,
+				uCell.data(), nCells,
+				vCell.data(), nCells,
+				wCell.data(), nCells,
+				massFlux.data(), nFaces,
+				p.data(), nCells,
+				ar.data(), nCells,
+				su.data(), nCells,
+				rface.data(), nFaces * 2,
+				1E-18, &icinl, &icout, &icsym, &icwal,
+				true, true, true, true,
+				teCell.data(), nCells,
+				teBoundary.data(), nBnds,
+				edCell.data(), nCells,
+				edBoundary.data(), nBnds,
+				viseffCell.data(), nCells,
+				viseffBoundary.data(), nBnds,
+				tCell.data(), nCells,
+				tBoundary.data(), nBnds);
+	}
+};
+
+void checkEqual(std::vector<double>& a, std::vector<double>& b)
+{
+	BOOST_CHECK_EQUAL(a.size(), b.size());
+	for(std::size_t i = 0; i < a.size() && i < b.size(); i++) {
+		BOOST_CHECK_EQUAL(a[i], b[i]);
+	}
+}
+
+// Check that the tile-aware kernel on an AoSoA mesh of tile width W gives the same results as the generic kernel
+// on the SoA mesh built from the same configuration
+template <int W>
+void checkAoSoAMassFlux(MassFields& cmp, meshgeo::RType type, meshgeo::MeshConfig<int,double,int>& meshConfig, cupcfd::comm::Communicator& comm)
+{
+	cupcfd::error::eCodes status;
+
+	meshgeo::CupCfdAoSoAMesh<int,double,int,W> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	setBoundaryConditions(*mesh, type);
+
+	// The concrete mesh type selects the tile-aware overload
+	MassFields fields;
+	fields.set(*mesh);
+	status = fields.run(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	checkEqual(fields.massFlux, cmp.massFlux);
+	checkEqual(fields.rface, cmp.rface);
+	checkEqual(fields.ar, cmp.ar);
+	checkEqual(fields.su, cmp.su);
+	checkEqual(fields.denBoundary, cmp.denBoundary);
+	checkEqual(fields.teBoundary, cmp.teBoundary);
+	checkEqual(fields.edBoundary, cmp.edBoundary);
+	checkEqual(fields.viseffBoundary, cmp.viseffBoundary);
+	checkEqual(fields.tBoundary, cmp.tBoundary);
+	BOOST_CHECK_EQUAL(fields.icinl, cmp.icinl);
+	BOOST_CHECK_EQUAL(fields.icout, cmp.icout);
+	BOOST_CHECK_EQUAL(fields.icsym, cmp.icsym);
+	BOOST_CHECK_EQUAL(fields.icwal, cmp.icwal);
+
+	delete mesh;
+}
+
+// Test 2: The tile-aware kernel for the AoSoA mesh matches the generic kernel for tile widths of 4, 8 and 16
+BOOST_AUTO_TEST_CASE(FluxMassDolfynFaceLoop_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// 6 x 5 x 3 cells, so that the last face tile on each rank is only partially filled for some widths
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	meshgeo::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(6, 5, 3, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	meshgeo::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	// Run with each boundary type in turn, so that every branch of the kernel is compared
+	meshgeo::RType types[5] = {meshgeo::RTYPE_INLET, meshgeo::RTYPE_OUTLET, meshgeo::RTYPE_SYMP, meshgeo::RTYPE_WALL, meshgeo::RTYPE_DEFAULT};
+
+	for(int t = 0; t < 5; t++) {
+		meshgeo::CupCfdSoAMesh<int,double,int> * mesh;
+		status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		setBoundaryConditions(*mesh, types[t]);
+
+		MassFields fields;
+		fields.set(*mesh);
+		status = fields.run(*mesh);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		checkAoSoAMassFlux<4>(fields, types[t], meshConfig, comm);
+		checkAoSoAMassFlux<8>(fields, types[t], meshConfig, comm);
+		checkAoSoAMassFlux<16>(fields, types[t], meshConfig, comm);
+
+		delete mesh;
+	}
+}
+
 BOOST_AUTO_TEST_CASE(cleanup)
 {
     MPI_Finalize();
@@ -0,0 +1,121 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the ResidualKernels Operations
+ */
+
+#define BOOST_TEST_MODULE ResidualKernels
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "ResidualKernels.h"
+#include "FaceMatrixAssembler.h"
+#include "SparseMatrixCSR.h"
+#include "MeshConfig.h"
+#include "MeshSourceStructGenConfig.h"
+#include "CupCfdAoSMesh.h"
+
+#include "PartitionerNaiveConfig.h"
+#include "PartitionerConfig.h"
+
+#include "mpi.h"
+
+using namespace cupcfd::fvm;
+
+namespace utf = boost::unit_test;
+namespace meshgeo = cupcfd::geometry::mesh;
+
+// Setup
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+
+    MPI_Init(&argc, &argv);
+}
+
+// === ResidualCSR ===
+// Test 1: The residual matches b - Ax and the norm is taken across all ranks
+BOOST_AUTO_TEST_CASE(ResidualCSR_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// Create a small test mesh
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	meshgeo::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	meshgeo::MeshConfig<int, double,int> meshConfig(partConfig, meshSourceConfig);
+
+	meshgeo::CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int nCells = mesh->properties.lTCells;
+	int nOwnedCells = mesh->properties.lOCells;
+	int nFaces = mesh->properties.lFaces;
+
+	// Build the cell matrix from the faces
+	FaceMatrixAssembler<int,double> assembler;
+	cupcfd::data_structures::SparseMatrixCSR<int,double> matrix(1, 1, 0);
+
+	status = assembler.symbolic(*mesh, matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<double> rface(2 * nFaces, 1.0);
+	status = assembler.numeric(&(rface[0]), 2 * nFaces, matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<double> x(nCells);
+	std::vector<double> b(nOwnedCells);
+	std::vector<double> r(nOwnedCells);
+	std::vector<double> ax(nOwnedCells);
+
+	for(int i = 0; i < nCells; i++) {
+		x[i] = 1.0 + (0.1 * i);
+	}
+
+	for(int i = 0; i < nOwnedCells; i++) {
+		b[i] = 2.0 - (0.05 * i);
+	}
+
+	double rNorm;
+	status = ResidualCSR(comm, matrix, &(x[0]), nCells, &(b[0]), nOwnedCells, &(r[0]), nOwnedCells, &rNorm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Compare against a separate product and norm
+	status = matrix.multiply(&(x[0]), nCells, &(ax[0]), nOwnedCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double localSq = 0.0;
+	for(int i = 0; i < nOwnedCells; i++) {
+		BOOST_CHECK_CLOSE(r[i], b[i] - ax[i], 1e-10);
+		localSq = localSq + (r[i] * r[i]);
+	}
+
+	double globalSq;
+	MPI_Allreduce(&localSq, &globalSq, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+	BOOST_CHECK_CLOSE(rNorm, sqrt(globalSq), 1e-10);
+
+	// Error Case: Size mismatch
+	status = ResidualCSR(comm, matrix, &(x[0]), nOwnedCells - 1, &(b[0]), nOwnedCells, &(r[0]), nOwnedCells, &rNorm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+
+	delete(mesh);
+}
+
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    MPI_Finalize();
+}
@@ -16,11 +16,14 @@
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "ScalarKernels.h"
 #include "MeshConfig.h"
 #include "MeshSourceStructGenConfig.h"
 #include "CupCfdAoSMesh.h"
+#include "CupCfdSoAMesh.h"
+#include "CupCfdAoSoAMesh.h"
 #include "EuclideanVector.h"
 
 #include "PartitionerNaiveConfig.h"
@@ -57,7 +60,7 @@ BOOST_AUTO_TEST_CASE(FluxScalarDolfynFaceLoop_test1)
     cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
 
 	// Setup the source config
-    meshgeo::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+    meshgeo::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 
 	// Setup the config to use for building
     meshgeo::MeshConfig<int, double, int> meshConfig(partConfig, meshSourceConfig);
@@ -151,6 +154,192 @@ BOOST_AUTO_TEST_CASE(FluxScalarDolfynFaceLoop_test1)
 	delete(mesh);
 }
 
+// Give every region of the mesh the same type, and set the region and boundary values used by the
+// boundary branches of the kernel, so that they do not depend on how each mesh initialises its storage
+template <class M>
+void setBoundaryConditions(M& mesh, meshgeo::RType type)
+{
+	euc::EuclideanVector<double,3> uvw(1.0, 0.5, -0.25);
+
+	for(int i = 0; i < mesh.properties.lRegions; i++) {
+		mesh.setRegionType(i, type);
+		mesh.setRegionUVW(i, uvw);
+		mesh.setRegionDen(i, 1.1);
+		mesh.setRegionT(i, 310.0);
+		mesh.setRegionR(i, 0.01);
+		mesh.setRegionYLog(i, 11.0);
+		mesh.setRegionFlux(i, false);
+		mesh.setRegionAdiab(i, false);
+	}
+
+	for(int i = 0; i < mesh.properties.lBoundaries; i++) {
+		mesh.setBoundaryDistance(i, 0.01 + 0.001 * (i % 5));
+		mesh.setBoundaryYPlus(i, 12.0);
+		mesh.setBoundaryUPlus(i, 10.0);
+		mesh.setBoundaryQ(i, 0.0);
+		mesh.setBoundaryH(i, 0.0);
+		mesh.setBoundaryT(i, 0.0);
+	}
+}
+
+// The inputs and outputs of FluxScalarDolfynFaceLoop, with the inputs set from the cell centres
+// so that the results differ from face to face
+struct ScalarFields
+{
+	std::vector<double> PhiCell, PhiBoundary, VisEff, Au, Su, Den, MassFlux, TE, CpBoundary, visEffBoundary, RFace;
+	std::vector<euc::EuclideanVector<double,3>> dPhidx;
+
+	template <class M>
+	void set(M& mesh) {
+		int nCells = mesh.properties.lTCells;
+		int nBnds = mesh.properties.lBoundaries;
+		int nFaces = mesh.properties.lFaces;
+
+		PhiCell.resize(nCells);
+		VisEff.resize(nCells);
+		Au.assign(nCells, 0.0);
+		Su.assign(nCells, 0.0);
+		Den.resize(nCells);
+		TE.resize(nCells);
+		dPhidx.resize(nCells);
+
+		for(int i = 0; i < nCells; i++) {
+			euc::EuclideanPoint<double,3> center = mesh.getCellCenter(i);
+			double x = center.cmp[0];
+			double y = center.cmp[1];
+			double z = center.cmp[2];
+
+			PhiCell[i] = 300.0 + x + 2.0 * y + 3.0 * z;
+			VisEff[i] = 1.5 + 0.1 * y;
+			Den[i] = 1.2 + 0.1 * x;
+			TE[i] = 0.1 + 0.01 * z;
+			dPhidx[i] = euc::EuclideanVector<double,3>(1.0 + 0.1 * y, 2.0 + 0.1 * z, 3.0 + 0.1 * x);
+		}
+
+		PhiBoundary.resize(nBnds);
+		CpBoundary.resize(nBnds);
+		visEffBoundary.resize(nBnds);
+
+		for(int i = 0; i < nBnds; i++) {
+			PhiBoundary[i] = 290.0 + (i % 5);
+			CpBoundary[i] = 1000.0 + (i % 3);
+			visEffBoundary[i] = 1.4 + 0.01 * (i % 7);
+		}
+
+		MassFlux.resize(nFaces);
+		for(int i = 0; i < nFaces; i++) {
+			MassFlux[i] = 0.1 * ((i % 11) - 5);
+		}
+
+		RFace.assign(nFaces * 2, 0.0);
+	}
+
+	template <class M>
+	cupcfd::error::eCodes run(M& mesh) {
+		int nCells = mesh.properties.lTCells;
+		int nBnds = mesh.properties.lBoundaries;
+		int nFaces = mesh.properties.lFaces;
+
+		// Solve for the temperature, so that the wall heat transfer is included
+		return FluxScalarDolfynFaceLoop(mesh,
+				PhiCell.data(), nCells,
+				PhiBoundary.data(), nBnds,
+				VisEff.data(), nCells,
+				Au.data(), nCells,
+				Su.data(), nCells,
+				Den.data(), nCells,
+				MassFlux.data(), nFaces,
+				TE.data(), nCells,
+				CpBoundary.data(), nBnds,
+				visEffBoundary.data(), nBnds,
+				RFace.data(), nFaces * 2,
+				dPhidx.data(), nCells,
+				false, true,
+				1.3,
+				2, 2, 1.4, 1.2E-3,
+				3, 1.5, 4, 1.6,
+				1.7, 1.4E-3, 1.1, 1E-18, 1E+18, 1.8);
+	}
+};
+
+void checkEqual(std::vector<double>& a, std::vector<double>& b)
+{
+	BOOST_CHECK_EQUAL(a.size(), b.size());
+	for(std::size_t i = 0; i < a.size() && i < b.size(); i++) {
+		BOOST_CHECK_EQUAL(a[i], b[i]);
+	}
+}
+
+// Check that the tile-aware kernel on an AoSoA mesh of tile width W gives the same results as the generic kernel
+// on the SoA mesh built from the same configuration
+template <int W>
+void checkAoSoAScalarFlux(ScalarFields& cmp, meshgeo::RType type, meshgeo::CupCfdSoAMesh<int,double,int>& cmpMesh,
+						  meshgeo::MeshConfig<int,double,int>& meshConfig, cupcfd::comm::Communicator& comm)
+{
+	cupcfd::error::eCodes status;
+
+	meshgeo::CupCfdAoSoAMesh<int,double,int,W> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	setBoundaryConditions(*mesh, type);
+
+	// The concrete mesh type selects the tile-aware overload
+	ScalarFields fields;
+	fields.set(*mesh);
+	status = fields.run(*mesh);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	checkEqual(fields.Au, cmp.Au);
+	checkEqual(fields.Su, cmp.Su);
+	checkEqual(fields.RFace, cmp.RFace);
+	checkEqual(fields.PhiBoundary, cmp.PhiBoundary);
+
+	// The wall heat transfer is stored on the mesh boundaries
+	BOOST_CHECK_EQUAL(mesh->properties.lBoundaries, cmpMesh.properties.lBoundaries);
+	for(int i = 0; i < mesh->properties.lBoundaries && i < cmpMesh.properties.lBoundaries; i++) {
+		BOOST_CHECK_EQUAL(mesh->getBoundaryQ(i), cmpMesh.getBoundaryQ(i));
+		BOOST_CHECK_EQUAL(mesh->getBoundaryH(i), cmpMesh.getBoundaryH(i));
+		BOOST_CHECK_EQUAL(mesh->getBoundaryT(i), cmpMesh.getBoundaryT(i));
+	}
+
+	delete mesh;
+}
+
+// Test 2: The tile-aware kernel for the AoSoA mesh matches the generic kernel for tile widths of 4, 8 and 16
+BOOST_AUTO_TEST_CASE(FluxScalarDolfynFaceLoop_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// 6 x 5 x 3 cells, so that the last face tile on each rank is only partially filled for some widths
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	meshgeo::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(6, 5, 3, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	meshgeo::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	// Run with each boundary type in turn, so that every branch of the kernel is compared
+	meshgeo::RType types[5] = {meshgeo::RTYPE_INLET, meshgeo::RTYPE_OUTLET, meshgeo::RTYPE_SYMP, meshgeo::RTYPE_WALL, meshgeo::RTYPE_DEFAULT};
+
+	for(int t = 0; t < 5; t++) {
+		meshgeo::CupCfdSoAMesh<int,double,int> * mesh;
+		status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		setBoundaryConditions(*mesh, types[t]);
+
+		ScalarFields fields;
+		fields.set(*mesh);
+		status = fields.run(*mesh);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		checkAoSoAScalarFlux<4>(fields, types[t], *mesh, meshConfig, comm);
+		checkAoSoAScalarFlux<8>(fields, types[t], *mesh, meshConfig, comm);
+		checkAoSoAScalarFlux<16>(fields, types[t], *mesh, meshConfig, comm);
+
+		delete mesh;
+	}
+}
+
 BOOST_AUTO_TEST_CASE(cleanup)
 {
     MPI_Finalize();
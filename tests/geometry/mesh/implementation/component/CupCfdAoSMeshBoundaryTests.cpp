@@ -27,10 +27,12 @@ BOOST_AUTO_TEST_CASE(constructor_test1)
 	CupCfdAoSMeshBoundary<int, double> boundary;
 
 	BOOST_CHECK_EQUAL(boundary.faceID, -1);
-	BOOST_CHECK_EQUAL(boundary.verticesID[0], -1);
-	BOOST_CHECK_EQUAL(boundary.verticesID[1], -1);
-	BOOST_CHECK_EQUAL(boundary.verticesID[2], -1);
-	BOOST_CHECK_EQUAL(boundary.verticesID[3], -1);
+	#if CUPCFD_MESH_FIXED_FACE_VERTICES
+		BOOST_CHECK_EQUAL(boundary.verticesID[0], -1);
+		BOOST_CHECK_EQUAL(boundary.verticesID[1], -1);
+		BOOST_CHECK_EQUAL(boundary.verticesID[2], -1);
+		BOOST_CHECK_EQUAL(boundary.verticesID[3], -1);
+	#endif
 	BOOST_CHECK_EQUAL(boundary.regionID, -1);
 	BOOST_CHECK_EQUAL(boundary.distance, 0.0);
 	BOOST_CHECK_EQUAL(boundary.yplus, 0.0);
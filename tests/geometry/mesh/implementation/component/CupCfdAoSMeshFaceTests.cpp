@@ -29,10 +29,12 @@ BOOST_AUTO_TEST_CASE(constructor_test1)
 	BOOST_CHECK_EQUAL(face.bndID, -1);
 	BOOST_CHECK_EQUAL(face.cell1ID, -1);
 	BOOST_CHECK_EQUAL(face.cell2ID, -1);
-	BOOST_CHECK_EQUAL(face.verticesID[0], -1);
-	BOOST_CHECK_EQUAL(face.verticesID[1], -1);
-	BOOST_CHECK_EQUAL(face.verticesID[2], -1);
-	BOOST_CHECK_EQUAL(face.verticesID[3], -1);
+	#if CUPCFD_MESH_FIXED_FACE_VERTICES
+		BOOST_CHECK_EQUAL(face.verticesID[0], -1);
+		BOOST_CHECK_EQUAL(face.verticesID[1], -1);
+		BOOST_CHECK_EQUAL(face.verticesID[2], -1);
+		BOOST_CHECK_EQUAL(face.verticesID[3], -1);
+	#endif
 	BOOST_CHECK_EQUAL(face.lambda, 0.0);
 	BOOST_CHECK_EQUAL(face.rlencos, 0.0);
 	BOOST_CHECK_EQUAL(face.area, 0.0);
@@ -2758,7 +2758,7 @@ BOOST_AUTO_TEST_CASE(findCellID_test1)
 	// === Create a small test mesh ===
 	// Setup the configurations
     cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-    MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+    MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
     MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
     // Build the mesh
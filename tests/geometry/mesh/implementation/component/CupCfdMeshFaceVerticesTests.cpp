@@ -0,0 +1,166 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the CupCfdMeshFaceVertices class
+ */
+
+#define BOOST_TEST_MODULE CupCfdMeshFaceVertices
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+
+#include "CupCfdMeshFaceVertices.h"
+#include "Error.h"
+
+using namespace cupcfd::geometry::mesh;
+
+// === Constructor ===
+// Test 1: The store is empty
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	CupCfdMeshFaceVertices<int> store;
+
+	BOOST_CHECK_EQUAL(store.size(), 0);
+}
+
+// === isValidCount ===
+// Test 1: Triangles and quadrilaterals are always valid, larger faces only in the CSR layout
+BOOST_AUTO_TEST_CASE(isValidCount_test1)
+{
+	BOOST_CHECK_EQUAL(CupCfdMeshFaceVertices<int>::isValidCount(2), false);
+	BOOST_CHECK_EQUAL(CupCfdMeshFaceVertices<int>::isValidCount(3), true);
+	BOOST_CHECK_EQUAL(CupCfdMeshFaceVertices<int>::isValidCount(4), true);
+
+	#if CUPCFD_MESH_FIXED_FACE_VERTICES
+		BOOST_CHECK_EQUAL(CupCfdMeshFaceVertices<int>::isValidCount(5), false);
+	#else
+		BOOST_CHECK_EQUAL(CupCfdMeshFaceVertices<int>::isValidCount(5), true);
+		BOOST_CHECK_EQUAL(CupCfdMeshFaceVertices<int>::isValidCount(12), true);
+	#endif
+}
+
+// === append ===
+// Test 1: Append single faces and set their vertices
+BOOST_AUTO_TEST_CASE(append_test1)
+{
+	CupCfdMeshFaceVertices<int> store;
+
+	store.append(3);
+	store.append(4);
+
+	for(int k = 0; k < 3; k++) {
+		store.setVertex(0, k, 10 + k);
+	}
+
+	for(int k = 0; k < 4; k++) {
+		store.setVertex(1, k, 20 + k);
+	}
+
+	BOOST_CHECK_EQUAL(store.size(), 2);
+	BOOST_CHECK_EQUAL(store.getNVertices(0), 3);
+	BOOST_CHECK_EQUAL(store.getNVertices(1), 4);
+
+	for(int k = 0; k < 3; k++) {
+		BOOST_CHECK_EQUAL(store.getVertex(0, k), 10 + k);
+	}
+
+	for(int k = 0; k < 4; k++) {
+		BOOST_CHECK_EQUAL(store.getVertex(1, k), 20 + k);
+	}
+}
+
+// Test 2: Append faces in bulk from offsets that do not start at 0, then set their vertices
+BOOST_AUTO_TEST_CASE(append_test2)
+{
+	CupCfdMeshFaceVertices<int> store;
+	int xadj[4] = {5, 9, 12, 16};
+
+	store.append(3);
+	store.append(xadj, 3);
+	BOOST_CHECK_EQUAL(store.size(), 4);
+
+	for(int i = 0; i < 3; i++) {
+		for(int k = 0; k < xadj[i+1] - xadj[i]; k++) {
+			store.setVertex(i + 1, k, xadj[i] + k);
+		}
+	}
+
+	// The fixed layout infers the count from the set vertices
+	BOOST_CHECK_EQUAL(store.getNVertices(1), 4);
+	BOOST_CHECK_EQUAL(store.getNVertices(2), 3);
+	BOOST_CHECK_EQUAL(store.getNVertices(3), 4);
+
+	BOOST_CHECK_EQUAL(store.getVertex(0, 0), -1);
+	BOOST_CHECK_EQUAL(store.getVertex(1, 0), 5);
+	BOOST_CHECK_EQUAL(store.getVertex(2, 2), 11);
+	BOOST_CHECK_EQUAL(store.getVertex(3, 3), 15);
+}
+
+#if !CUPCFD_MESH_FIXED_FACE_VERTICES
+// Test 3: Faces with more than 4 vertices are stored in the CSR layout
+BOOST_AUTO_TEST_CASE(append_test3)
+{
+	CupCfdMeshFaceVertices<int> store;
+	int xadj[3] = {0, 6, 14};
+
+	store.append(xadj, 2);
+
+	for(int i = 0; i < 2; i++) {
+		for(int k = 0; k < xadj[i+1] - xadj[i]; k++) {
+			store.setVertex(i, k, xadj[i] + k);
+		}
+	}
+
+	BOOST_CHECK_EQUAL(store.getNVertices(0), 6);
+	BOOST_CHECK_EQUAL(store.getNVertices(1), 8);
+	BOOST_CHECK_EQUAL(store.getVertex(1, 7), 13);
+	BOOST_CHECK_EQUAL(store.adj.size(), 14);
+}
+#endif
+
+// === truncate ===
+// Test 1: Remove faces from the end of the store
+BOOST_AUTO_TEST_CASE(truncate_test1)
+{
+	CupCfdMeshFaceVertices<int> store;
+	int xadj[4] = {0, 3, 7, 10};
+
+	store.append(xadj, 3);
+	store.truncate(1);
+
+	BOOST_CHECK_EQUAL(store.size(), 1);
+	BOOST_CHECK_EQUAL(store.getNVertices(0), 3);
+
+	// Faces can be appended again afterwards
+	store.append(4);
+	for(int k = 0; k < 4; k++) {
+		store.setVertex(1, k, k);
+	}
+
+	BOOST_CHECK_EQUAL(store.size(), 2);
+	BOOST_CHECK_EQUAL(store.getNVertices(1), 4);
+	BOOST_CHECK_EQUAL(store.getVertex(1, 3), 3);
+}
+
+// === clear ===
+// Test 1: Remove all faces
+BOOST_AUTO_TEST_CASE(clear_test1)
+{
+	CupCfdMeshFaceVertices<int> store;
+
+	store.append(4);
+	store.append(3);
+	store.clear();
+
+	BOOST_CHECK_EQUAL(store.size(), 0);
+
+	store.append(3);
+	BOOST_CHECK_EQUAL(store.size(), 1);
+	BOOST_CHECK_EQUAL(store.getNVertices(0), 3);
+}
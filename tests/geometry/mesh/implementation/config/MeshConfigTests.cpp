@@ -98,7 +98,7 @@ BOOST_AUTO_TEST_CASE(buildUnstructuredMesh_test1, * utf::tolerance(0.00001))
     cupcfd::partitioner::PartitionerConfig<int,int> partConfig(naiveConfig);
 
 	// Setup the source config
-	MeshSourceFileConfig<int, double> meshSourceConfig(MESH_FILE_FORMAT_HDF5, "../tests/geometry/mesh/data/MeshHDF5.hdf5");
+	MeshSourceFileConfig<int, double, int> meshSourceConfig(MESH_FILE_FORMAT_HDF5, "../tests/geometry/mesh/data/MeshHDF5.hdf5");
 
 	// Setup the config to use for building
 	MeshConfig<int, double, int> meshConfig(partConfig, meshSourceConfig);
@@ -368,7 +368,7 @@ BOOST_AUTO_TEST_CASE(buildUnstructuredMesh_test2, * utf::tolerance(0.00001))
 	cupcfd::partitioner::PartitionerConfig<int,int> partConfig(naiveConfig);
 
 	// Setup the source config
-	MeshSourceStructGenConfig<int, double> meshSourceConfig(20, 20, 20, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshSourceStructGenConfig<int, double, int> meshSourceConfig(20, 20, 20, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 
 	// Setup the config to use for building
 	MeshConfig<int, double,int> meshConfig(partConfig, meshSourceConfig);
@@ -73,7 +73,7 @@ BOOST_AUTO_TEST_CASE(buildMeshSource2_test1)
 {
 	cupcfd::error::eCodes status;
 	MeshSource<int, double, int> * source;
-	MeshSourceFileConfig<int, double> config(MESH_FILE_FORMAT_HDF5, "../tests/geometry/mesh/data/MeshHDF5.hdf5");
+	MeshSourceFileConfig<int, double, int> config(MESH_FILE_FORMAT_HDF5, "../tests/geometry/mesh/data/MeshHDF5.hdf5");
 
 	status = config.buildMeshSource(&source);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
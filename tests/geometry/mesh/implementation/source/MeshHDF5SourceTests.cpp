@@ -53,7 +53,7 @@ BOOST_AUTO_TEST_CASE(getCellLabels)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	int indices[4] = {0, 1, 2, 3};
@@ -82,7 +82,7 @@ BOOST_AUTO_TEST_CASE(getFaceNVertices_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[15] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
@@ -102,7 +102,7 @@ BOOST_AUTO_TEST_CASE(getFaceVerticesLabelsCSR_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[15] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
@@ -141,7 +141,7 @@ BOOST_AUTO_TEST_CASE(getFaceVerticesLabelsCSR_test2)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[12] = {15, 1, 2, 4, 5, 6, 8, 10, 11, 13, 14, 7};
@@ -178,7 +178,7 @@ BOOST_AUTO_TEST_CASE(getBoundaryVerticesLabelsCSR_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	int boundaryLabels[15] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
@@ -218,7 +218,7 @@ BOOST_AUTO_TEST_CASE(getCellCount_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	int cells;
 	cupcfd::error::eCodes status;
 
@@ -234,7 +234,7 @@ BOOST_AUTO_TEST_CASE(getFaceCount_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	int faces;
 	cupcfd::error::eCodes status;
 
@@ -250,7 +250,7 @@ BOOST_AUTO_TEST_CASE(getBoundaryCount_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	int boundaries;
 	cupcfd::error::eCodes status;
 
@@ -266,7 +266,7 @@ BOOST_AUTO_TEST_CASE(getRegionCount_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	int regions;
 	cupcfd::error::eCodes status;
 
@@ -282,7 +282,7 @@ BOOST_AUTO_TEST_CASE(getVertexCount_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	int vertices;
 	cupcfd::error::eCodes status;
 
@@ -298,7 +298,7 @@ BOOST_AUTO_TEST_CASE(getMaxFaceCount_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	int maxFaceCount;
 	cupcfd::error::eCodes status;
 
@@ -313,7 +313,7 @@ BOOST_AUTO_TEST_CASE(getMaxVertexCount_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	int maxVertexCount;
 	cupcfd::error::eCodes status;
 
@@ -328,7 +328,7 @@ BOOST_AUTO_TEST_CASE(getCellNFaces_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	// Cell Labels - Indexed from base of 1 for this format
@@ -348,7 +348,7 @@ BOOST_AUTO_TEST_CASE(getCellVolume_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	int nLabels[3] = {1,3,4};
@@ -374,7 +374,7 @@ BOOST_AUTO_TEST_CASE(getCellFaceLabels_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	int cellLabels[3] = {1, 3, 4};
@@ -397,7 +397,7 @@ BOOST_AUTO_TEST_CASE(getFaceIsBoundary_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[20] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
@@ -417,7 +417,7 @@ BOOST_AUTO_TEST_CASE(getFaceBoundaryLabels_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[17] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
@@ -436,7 +436,7 @@ BOOST_AUTO_TEST_CASE(getFaceBoundaryLabels_test2)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[20] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
@@ -452,7 +452,7 @@ BOOST_AUTO_TEST_CASE(getFaceCell1Labels_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[20] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
@@ -470,7 +470,7 @@ BOOST_AUTO_TEST_CASE(getFaceCell2Labels_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[20] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
@@ -489,7 +489,7 @@ BOOST_AUTO_TEST_CASE(getFaceLambda2_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	double faceLambda[20];
@@ -515,7 +515,7 @@ BOOST_AUTO_TEST_CASE(getFaceNormal_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	cupcfd::geometry::euclidean::EuclideanVector<double,3> normal[20];
@@ -566,7 +566,7 @@ BOOST_AUTO_TEST_CASE(getBoundaryNVertices_test1)
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
 
 	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
-	MeshHDF5Source<int, double> file(filePath);
+	MeshHDF5Source<int, double, int> file(filePath);
 	cupcfd::error::eCodes status;
 
 	// Note: Face 13 - > Boundary 12 and Face 12 -> Boundary 13.
@@ -0,0 +1,383 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the MeshMixedGenSource Class
+ */
+
+#define BOOST_TEST_MODULE MeshMixedGenSource
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+
+#include "MeshMixedGenSource.h"
+#include "MeshSourceMixedGenConfig.h"
+#include "MeshConfig.h"
+#include "PartitionerNaiveConfig.h"
+#include "CupCfdSoAMesh.h"
+#include "EuclideanPoint.h"
+#include "EuclideanVector.h"
+
+using namespace cupcfd::geometry::mesh;
+
+namespace utf = boost::unit_test;
+
+// Setup
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+
+    MPI_Init(&argc, &argv);
+}
+
+// Read the whole mesh from a source and check that it fills the box [-1,1]^3, that every face is
+// shared by the cells it names and that the faces of each cell enclose it.
+// Returns the number of cells with each number of faces.
+std::map<int,int> checkMixedGenSource(MeshMixedGenSource<int,double,int>& source)
+{
+	cupcfd::error::eCodes status;
+	int nCells, nFaces, nBoundaries, nVertices, maxFaces;
+
+	status = source.getCellCount(&nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = source.getFaceCount(&nFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = source.getBoundaryCount(&nBoundaries);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = source.getVertexCount(&nVertices);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = source.getMaxFaceCount(&maxFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// === Labels ===
+	std::vector<int> indexes(std::max(nCells, nFaces));
+	for(int i = 0; i < int(indexes.size()); i++) {
+		indexes[i] = i;
+	}
+
+	std::vector<int> cellLabels(nCells);
+	status = source.getCellLabels(&(cellLabels[0]), nCells, &(indexes[0]), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<int> faceLabels(nFaces);
+	status = source.getFaceLabels(&(faceLabels[0]), nFaces, &(indexes[0]), nFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<int> boundaryLabels(nBoundaries);
+	status = source.getBoundaryLabels(&(boundaryLabels[0]), nBoundaries, &(indexes[0]), nBoundaries);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(std::set<int>(cellLabels.begin(), cellLabels.end()).size(), size_t(nCells));
+	BOOST_CHECK_EQUAL(std::set<int>(faceLabels.begin(), faceLabels.end()).size(), size_t(nFaces));
+
+	// === Faces ===
+	std::vector<int> cell1(nFaces), cell2(nFaces);
+	std::vector<double> area(nFaces);
+	std::vector<cupcfd::geometry::euclidean::EuclideanVector<double,3>> normal(nFaces);
+	std::vector<double> lambda(nFaces);
+
+	status = source.getFaceCell1Labels(&(cell1[0]), nFaces, &(faceLabels[0]), nFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = source.getFaceCell2Labels(&(cell2[0]), nFaces, &(faceLabels[0]), nFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = source.getFaceArea(&(area[0]), nFaces, &(faceLabels[0]), nFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = source.getFaceNormal(&(normal[0]), nFaces, &(faceLabels[0]), nFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = source.getFaceLambda(&(lambda[0]), nFaces, &(faceLabels[0]), nFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::map<int,int> faceIndex;
+	int nBoundaryFaces = 0;
+	for(int i = 0; i < nFaces; i++) {
+		faceIndex[faceLabels[i]] = i;
+		BOOST_CHECK(area[i] > 0.0);
+
+		if(cell2[i] == -1) {
+			nBoundaryFaces++;
+			BOOST_CHECK_EQUAL(lambda[i], -1.0);
+		}
+		else {
+			BOOST_CHECK(lambda[i] > 0.0 && lambda[i] < 1.0);
+		}
+	}
+	BOOST_CHECK_EQUAL(nBoundaryFaces, nBoundaries);
+
+	// === Cells ===
+	std::vector<int> nCellFaces(nCells);
+	status = source.getCellNFaces(&(nCellFaces[0]), nCells, &(cellLabels[0]), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int nCsrData = 0;
+	for(int i = 0; i < nCells; i++) {
+		nCsrData += nCellFaces[i];
+		BOOST_CHECK(nCellFaces[i] <= maxFaces);
+	}
+
+	std::vector<int> csrIndices(nCells + 1), csrData(nCsrData);
+	status = source.getCellFaceLabels(&(csrIndices[0]), nCells + 1, &(csrData[0]), nCsrData, &(cellLabels[0]), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Every interior face belongs to two cells, and every boundary face to one
+	BOOST_CHECK_EQUAL(nCsrData, 2 * nFaces - nBoundaries);
+
+	std::vector<double> volume(nCells);
+	status = source.getCellVolume(&(volume[0]), nCells, &(cellLabels[0]), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double totalVolume = 0.0;
+	std::map<int,int> shapes;
+
+	for(int i = 0; i < nCells; i++) {
+		BOOST_CHECK(volume[i] > 0.0);
+		totalVolume += volume[i];
+		shapes[nCellFaces[i]]++;
+
+		double normSum[3] = {0.0, 0.0, 0.0};
+		for(int j = csrIndices[i]; j < csrIndices[i+1]; j++) {
+			BOOST_REQUIRE(faceIndex.count(csrData[j]) == 1);
+			int face = faceIndex[csrData[j]];
+			BOOST_CHECK(cell1[face] == cellLabels[i] || cell2[face] == cellLabels[i]);
+
+			double sign = (cell1[face] == cellLabels[i]) ? 1.0 : -1.0;
+			for(int d = 0; d < 3; d++) {
+				normSum[d] += sign * area[face] * normal[face].cmp[d];
+			}
+		}
+
+		for(int d = 0; d < 3; d++) {
+			BOOST_CHECK_SMALL(normSum[d], 1e-12);
+		}
+	}
+
+	BOOST_CHECK_CLOSE(totalVolume, 8.0, 1e-8);
+
+	return shapes;
+}
+
+// === Constructors ===
+// Test 1:
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	MeshMixedGenSource<int, double, int> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 0.3, 0.3, 0.1, true, 7);
+}
+
+// === Mesh Layout ===
+// Test 1: Only tetrahedra, twelve to a block
+BOOST_AUTO_TEST_CASE(layout_test1)
+{
+	MeshMixedGenSource<int, double, int> source(3, 2, 2, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 1.0, 0.0, 0.0, false, 0);
+	std::map<int,int> shapes = checkMixedGenSource(source);
+
+	BOOST_CHECK_EQUAL(shapes.size(), size_t(1));
+	BOOST_CHECK_EQUAL(shapes[4], 12 * 12);
+}
+
+// Test 2: Only triangular prisms, two to a block
+BOOST_AUTO_TEST_CASE(layout_test2)
+{
+	MeshMixedGenSource<int, double, int> source(3, 2, 2, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 0.0, 1.0, 0.0, false, 0);
+	std::map<int,int> shapes = checkMixedGenSource(source);
+
+	BOOST_CHECK_EQUAL(shapes.size(), size_t(1));
+	BOOST_CHECK_EQUAL(shapes[5], 2 * 12);
+}
+
+// Test 3: Only hexahedra, matching the structured generator
+BOOST_AUTO_TEST_CASE(layout_test3)
+{
+	MeshMixedGenSource<int, double, int> source(3, 2, 2, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 0.0, 0.0, 0.0, false, 0);
+	std::map<int,int> shapes = checkMixedGenSource(source);
+
+	BOOST_CHECK_EQUAL(shapes.size(), size_t(1));
+	BOOST_CHECK_EQUAL(shapes[6], 12);
+}
+
+// Test 4: A mix, with jittered vertices and shuffled cell labels, still fills the box and
+// the faces still match
+BOOST_AUTO_TEST_CASE(layout_test4)
+{
+	MeshMixedGenSource<int, double, int> source(4, 3, 3, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 0.3, 0.3, 0.2, true, 11);
+	std::map<int,int> shapes = checkMixedGenSource(source);
+
+	BOOST_CHECK(shapes[4] > 0);
+	BOOST_CHECK(shapes[5] > 0);
+	BOOST_CHECK(shapes[6] > 0);
+
+	// The shuffled labels are a permutation of the unshuffled ones
+	MeshMixedGenSource<int, double, int> ordered(4, 3, 3, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 0.3, 0.3, 0.2, false, 11);
+	int nCells;
+	cupcfd::error::eCodes status = source.getCellCount(&nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<int> indexes(nCells), labels(nCells), orderedLabels(nCells);
+	for(int i = 0; i < nCells; i++) {
+		indexes[i] = i;
+	}
+
+	status = source.getCellLabels(&(labels[0]), nCells, &(indexes[0]), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = ordered.getCellLabels(&(orderedLabels[0]), nCells, &(indexes[0]), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK(labels != orderedLabels);
+
+	std::vector<double> volume(nCells), orderedVolume(nCells);
+	status = source.getCellVolume(&(volume[0]), nCells, &(labels[0]), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = ordered.getCellVolume(&(orderedVolume[0]), nCells, &(orderedLabels[0]), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < nCells; i++) {
+		BOOST_CHECK_EQUAL(volume[i], orderedVolume[i]);
+	}
+}
+
+// Test 5: Error Case: Labels that are not in use, and mismatched array sizes
+BOOST_AUTO_TEST_CASE(layout_test5)
+{
+	cupcfd::error::eCodes status;
+	MeshMixedGenSource<int, double, int> source(2, 2, 2, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 0.0, 0.0, 0.0, false, 0);
+
+	// Each hexahedral block only uses the first of its twelve cell labels
+	int cellLabel = 1;
+	double volume;
+	status = source.getCellVolume(&volume, 1, &cellLabel, 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_INDEX);
+
+	int index = 8;
+	int label;
+	status = source.getCellLabels(&label, 1, &index, 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_INDEX);
+
+	int faceLabel = 1;
+	int nVertices;
+	status = source.getFaceNVertices(&nVertices, 1, &faceLabel, 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_INDEX);
+
+	status = source.getCellLabels(&label, 1, &index, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+}
+
+// === buildUnstructuredMesh ===
+// Test 1: A distributed mesh built from the source has every type of cell, fills the box
+// and its faces enclose its cells
+BOOST_AUTO_TEST_CASE(buildUnstructuredMesh_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceMixedGenConfig<int,double,int> sourceConfig(5, 4, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 0.3, 0.3, 0.15, true, 3);
+	MeshConfig<int,double,int> meshConfig(partConfig, sourceConfig);
+
+	CupCfdSoAMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int counts[5] = {0, 0, 0, 0, 0};
+	double volume = 0.0;
+
+	for(int i = 0; i < mesh->properties.lOCells; i++) {
+		BOOST_CHECK(mesh->getCellVolume(i) > 0.0);
+		volume += mesh->getCellVolume(i);
+
+		cupcfd::geometry::shapes::PolyhedronType type = mesh->getCellPolyhedronType(i);
+		if(type == cupcfd::geometry::shapes::POLYHEDRON_TETRAHEDRON) {
+			counts[0]++;
+		}
+		else if(type == cupcfd::geometry::shapes::POLYHEDRON_QUADPYRAMID) {
+			counts[1]++;
+		}
+		else if(type == cupcfd::geometry::shapes::POLYHEDRON_TRIPRISM) {
+			counts[2]++;
+		}
+		else if(type == cupcfd::geometry::shapes::POLYHEDRON_HEXAHEDRON) {
+			counts[3]++;
+		}
+		else {
+			counts[4]++;
+		}
+	}
+
+	int totalCounts[5];
+	double totalVolume;
+	MPI_Allreduce(counts, totalCounts, 5, MPI_INT, MPI_SUM, comm.comm);
+	MPI_Allreduce(&volume, &totalVolume, 1, MPI_DOUBLE, MPI_SUM, comm.comm);
+
+	BOOST_CHECK(totalCounts[0] > 0);
+	BOOST_CHECK(totalCounts[1] > 0);
+	BOOST_CHECK(totalCounts[2] > 0);
+	BOOST_CHECK(totalCounts[3] > 0);
+	BOOST_CHECK_EQUAL(totalCounts[4], 0);
+	BOOST_CHECK_CLOSE(totalVolume, 8.0, 1e-8);
+
+	// The (area weighted) normals of the faces of a closed cell sum to zero
+	std::vector<double> normSum(3 * mesh->properties.lTCells, 0.0);
+	for(int i = 0; i < mesh->properties.lFaces; i++) {
+		cupcfd::geometry::euclidean::EuclideanVector3D<double> norm = mesh->getFaceNorm(i);
+		int cell1 = mesh->getFaceCell1ID(i);
+
+		for(int d = 0; d < 3; d++) {
+			normSum[3 * cell1 + d] += norm.cmp[d];
+		}
+
+		if(!mesh->getFaceIsBoundary(i)) {
+			int cell2 = mesh->getFaceCell2ID(i);
+			for(int d = 0; d < 3; d++) {
+				normSum[3 * cell2 + d] -= norm.cmp[d];
+			}
+
+			BOOST_CHECK(mesh->getFaceLambda(i) > 0.0 && mesh->getFaceLambda(i) < 1.0);
+		}
+	}
+
+	for(int i = 0; i < mesh->properties.lOCells; i++) {
+		for(int d = 0; d < 3; d++) {
+			BOOST_CHECK_SMALL(normSum[3 * i + d], 1e-12);
+		}
+	}
+
+	delete mesh;
+}
+
+// === buildMeshSource ===
+// Test 1: Error Case: Invalid element fractions and jitter are rejected by the config
+BOOST_AUTO_TEST_CASE(buildMeshSource_test1)
+{
+	cupcfd::error::eCodes status;
+	MeshSource<int,double,int> * source;
+
+	MeshSourceMixedGenConfig<int,double,int> config1(2, 2, 2, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 0.7, 0.7, 0.0, false, 0);
+	status = config1.buildMeshSource(&source);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_CONFIG_INVALID_VALUE);
+
+	MeshSourceMixedGenConfig<int,double,int> config2(2, 2, 2, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 0.5, 0.5, 0.3, false, 0);
+	status = config2.buildMeshSource(&source);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_CONFIG_INVALID_VALUE);
+
+	MeshSourceMixedGenConfig<int,double,int> config3(2, 0, 2, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 0.5, 0.5, 0.0, false, 0);
+	status = config3.buildMeshSource(&source);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_CONFIG_INVALID_VALUE);
+
+	MeshSourceMixedGenConfig<int,double,int> config4(2, 2, 2, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 0.5, 0.5, 0.25, false, 0);
+	status = config4.buildMeshSource(&source);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	delete source;
+}
+
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    MPI_Finalize();
+}
@@ -28,7 +28,7 @@ namespace utf = boost::unit_test;
 BOOST_AUTO_TEST_CASE(constructor_test1)
 {
 	std::string topLevel[0] = {};
-	MeshSourceFileConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceFileConfigHDF5.json", topLevel, 0);
+	MeshSourceFileConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceFileConfigHDF5.json", topLevel, 0);
 }
 
 // === getFileFormat ===
@@ -39,7 +39,7 @@ BOOST_AUTO_TEST_CASE(getFileFormat_test1)
 	MeshFileFormat fileFormat;
 
 	std::string topLevel[0] = {};
-	MeshSourceFileConfigJSON<int, double> configFile1("../tests/geometry/mesh/data/MeshSourceFileConfigHDF5.json", topLevel, 0);
+	MeshSourceFileConfigJSON<int, double, int> configFile1("../tests/geometry/mesh/data/MeshSourceFileConfigHDF5.json", topLevel, 0);
 
 	status = configFile1.getFileFormat(&fileFormat);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
@@ -72,7 +72,7 @@ BOOST_AUTO_TEST_CASE(getFilePath)
 	std::string filePath;
 
 	std::string topLevel[0] = {};
-	MeshSourceFileConfigJSON<int, double> configFile1("../tests/geometry/mesh/data/MeshSourceFileConfigHDF5.json", topLevel, 0);
+	MeshSourceFileConfigJSON<int, double, int> configFile1("../tests/geometry/mesh/data/MeshSourceFileConfigHDF5.json", topLevel, 0);
 
 	status = configFile1.getFilePath(filePath);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
@@ -104,7 +104,7 @@ BOOST_AUTO_TEST_CASE(buildMeshSourceConfig)
 	std::string filePath;
 
 	std::string topLevel[0] = {};
-	MeshSourceFileConfigJSON<int, double> configFile1("../tests/geometry/mesh/data/MeshSourceFileConfigHDF5.json", topLevel, 0);
+	MeshSourceFileConfigJSON<int, double, int> configFile1("../tests/geometry/mesh/data/MeshSourceFileConfigHDF5.json", topLevel, 0);
 
 
 	MeshSourceConfig<int,double,int> * config;
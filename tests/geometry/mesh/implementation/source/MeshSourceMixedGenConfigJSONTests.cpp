@@ -0,0 +1,148 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the MeshSourceMixedGenConfigJSON class
+ */
+
+#define BOOST_TEST_MODULE MeshSourceMixedGenConfigJSON
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+
+
+#include "MeshSourceMixedGenConfigJSON.h"
+
+using namespace cupcfd::geometry::mesh;
+
+// Namespaces
+namespace utf = boost::unit_test;
+
+// === Constructor ===
+// Test 1: Successfully setup the object
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	std::string topLevel[0] = {};
+	MeshSourceMixedGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceMixedGenConfig.json", topLevel, 0);
+}
+
+// === getMeshCellSizeZ ===
+// Test 1:
+BOOST_AUTO_TEST_CASE(getMeshCellSizeZ_test1)
+{
+	cupcfd::error::eCodes status;
+	int cellZ;
+
+	std::string topLevel[0] = {};
+	MeshSourceMixedGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceMixedGenConfig.json", topLevel, 0);
+	status = configFile.getMeshCellSizeZ(&cellZ);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(cellZ, 5);
+}
+
+// === getTetFraction ===
+// Test 1:
+BOOST_AUTO_TEST_CASE(getTetFraction_test1)
+{
+	cupcfd::error::eCodes status;
+	double tetFraction;
+
+	std::string topLevel[0] = {};
+	MeshSourceMixedGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceMixedGenConfig.json", topLevel, 0);
+	status = configFile.getTetFraction(&tetFraction);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(tetFraction, 0.25);
+}
+
+// Test 2: Error Case - E_CONFIG_OPT_NOT_FOUND
+BOOST_AUTO_TEST_CASE(getTetFraction_test2)
+{
+	cupcfd::error::eCodes status;
+	double tetFraction;
+
+	std::string topLevel[1] = {"Defaults"};
+	MeshSourceMixedGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceMixedGenConfig.json", topLevel, 1);
+	status = configFile.getTetFraction(&tetFraction);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_CONFIG_OPT_NOT_FOUND);
+}
+
+// === getShuffleCellLabels ===
+// Test 1:
+BOOST_AUTO_TEST_CASE(getShuffleCellLabels_test1)
+{
+	cupcfd::error::eCodes status;
+	bool shuffleCellLabels;
+
+	std::string topLevel[0] = {};
+	MeshSourceMixedGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceMixedGenConfig.json", topLevel, 0);
+	status = configFile.getShuffleCellLabels(&shuffleCellLabels);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(shuffleCellLabels, true);
+}
+
+// === buildMeshSourceConfig ===
+// Test 1: All of the fields are given
+BOOST_AUTO_TEST_CASE(buildMeshSourceConfig_test1)
+{
+	cupcfd::error::eCodes status;
+	MeshSourceConfig<int, double, int> * config;
+
+	std::string topLevel[0] = {};
+	MeshSourceMixedGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceMixedGenConfig.json", topLevel, 0);
+	status = configFile.buildMeshSourceConfig(&config);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	MeshSourceMixedGenConfig<int, double, int> * mixedConfig = dynamic_cast<MeshSourceMixedGenConfig<int, double, int> *>(config);
+	BOOST_REQUIRE(mixedConfig != nullptr);
+	BOOST_CHECK_EQUAL(mixedConfig->getCellX(), 12);
+	BOOST_CHECK_EQUAL(mixedConfig->getCellY(), 31);
+	BOOST_CHECK_EQUAL(mixedConfig->getCellZ(), 5);
+	BOOST_CHECK_EQUAL(mixedConfig->getSpatialMaxZ(), 7.9);
+	BOOST_CHECK_EQUAL(mixedConfig->getTetFraction(), 0.25);
+	BOOST_CHECK_EQUAL(mixedConfig->getPrismFraction(), 0.5);
+	BOOST_CHECK_EQUAL(mixedConfig->getJitter(), 0.125);
+	BOOST_CHECK_EQUAL(mixedConfig->getShuffleCellLabels(), true);
+	BOOST_CHECK_EQUAL(mixedConfig->getSeed(), uint64_t(1234));
+
+	delete config;
+}
+
+// Test 2: The optional fields take their defaults, with the tetrahedra taking the blocks that are not prisms
+BOOST_AUTO_TEST_CASE(buildMeshSourceConfig_test2)
+{
+	cupcfd::error::eCodes status;
+	MeshSourceConfig<int, double, int> * config;
+
+	std::string topLevel[1] = {"Defaults"};
+	MeshSourceMixedGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceMixedGenConfig.json", topLevel, 1);
+	status = configFile.buildMeshSourceConfig(&config);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	MeshSourceMixedGenConfig<int, double, int> * mixedConfig = dynamic_cast<MeshSourceMixedGenConfig<int, double, int> *>(config);
+	BOOST_REQUIRE(mixedConfig != nullptr);
+	BOOST_CHECK_EQUAL(mixedConfig->getCellZ(), 2);
+	BOOST_CHECK_EQUAL(mixedConfig->getTetFraction(), 0.25);
+	BOOST_CHECK_EQUAL(mixedConfig->getPrismFraction(), 0.75);
+	BOOST_CHECK_EQUAL(mixedConfig->getJitter(), 0.0);
+	BOOST_CHECK_EQUAL(mixedConfig->getShuffleCellLabels(), false);
+	BOOST_CHECK_EQUAL(mixedConfig->getSeed(), uint64_t(0));
+
+	delete config;
+}
+
+// Test 3: Error Case - E_CONFIG_OPT_NOT_FOUND when the source is not a mixed element generator
+BOOST_AUTO_TEST_CASE(buildMeshSourceConfig_test3)
+{
+	cupcfd::error::eCodes status;
+	MeshSourceConfig<int, double, int> * config;
+
+	std::string topLevel[0] = {};
+	MeshSourceMixedGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
+	status = configFile.buildMeshSourceConfig(&config);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_CONFIG_OPT_NOT_FOUND);
+}
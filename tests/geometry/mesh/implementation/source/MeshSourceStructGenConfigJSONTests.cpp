@@ -28,7 +28,7 @@ namespace utf = boost::unit_test;
 BOOST_AUTO_TEST_CASE(constructor_test1)
 {
 	std::string topLevel[0] = {};
-	MeshSourceStructGenConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
+	MeshSourceStructGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
 }
 
 // === getMeshCellSizeX ===
@@ -39,7 +39,7 @@ BOOST_AUTO_TEST_CASE(getMeshCellSizeX_test1)
 	int cellX;
 
 	std::string topLevel[0] = {};
-	MeshSourceStructGenConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
+	MeshSourceStructGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
 	status = configFile.getMeshCellSizeX(&cellX);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 	BOOST_CHECK_EQUAL(cellX, 127);
@@ -71,7 +71,7 @@ BOOST_AUTO_TEST_CASE(getMeshCellSizeY_test1)
 	int cellY;
 
 	std::string topLevel[0] = {};
-	MeshSourceStructGenConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
+	MeshSourceStructGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
 	status = configFile.getMeshCellSizeY(&cellY);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 	BOOST_CHECK_EQUAL(cellY, 301);
@@ -103,7 +103,7 @@ BOOST_AUTO_TEST_CASE(getMeshCellSizeZ_test1)
 	int cellZ;
 
 	std::string topLevel[0] = {};
-	MeshSourceStructGenConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
+	MeshSourceStructGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
 	status = configFile.getMeshCellSizeZ(&cellZ);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 	BOOST_CHECK_EQUAL(cellZ, 54);
@@ -135,7 +135,7 @@ BOOST_AUTO_TEST_CASE(getMeshSpatialXMin_test1)
 	double sXMin;
 
 	std::string topLevel[0] = {};
-	MeshSourceStructGenConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
+	MeshSourceStructGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
 	status = configFile.getMeshSpatialXMin(&sXMin);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 	BOOST_CHECK_EQUAL(sXMin, -1.5);
@@ -167,7 +167,7 @@ BOOST_AUTO_TEST_CASE(getMeshSpatialYMin_test1)
 	double sYMin;
 
 	std::string topLevel[0] = {};
-	MeshSourceStructGenConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
+	MeshSourceStructGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
 	status = configFile.getMeshSpatialYMin(&sYMin);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 	BOOST_CHECK_EQUAL(sYMin, -1.2);
@@ -199,7 +199,7 @@ BOOST_AUTO_TEST_CASE(getMeshSpatialZMin_test1)
 	double sZMin;
 
 	std::string topLevel[0] = {};
-	MeshSourceStructGenConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
+	MeshSourceStructGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
 	status = configFile.getMeshSpatialZMin(&sZMin);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 	BOOST_CHECK_EQUAL(sZMin, -2.7);
@@ -231,7 +231,7 @@ BOOST_AUTO_TEST_CASE(getMeshSpatialXMax_test1)
 	double sXMax;
 
 	std::string topLevel[0] = {};
-	MeshSourceStructGenConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
+	MeshSourceStructGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
 	status = configFile.getMeshSpatialXMax(&sXMax);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 	BOOST_CHECK_EQUAL(sXMax, 3.4);
@@ -263,7 +263,7 @@ BOOST_AUTO_TEST_CASE(getMeshSpatialYMax_test1)
 	double sYMax;
 
 	std::string topLevel[0] = {};
-	MeshSourceStructGenConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
+	MeshSourceStructGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
 	status = configFile.getMeshSpatialYMax(&sYMax);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 	BOOST_CHECK_EQUAL(sYMax, 5.6);
@@ -295,7 +295,7 @@ BOOST_AUTO_TEST_CASE(getMeshSpatialZMax_test1)
 	double sZMax;
 
 	std::string topLevel[0] = {};
-	MeshSourceStructGenConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
+	MeshSourceStructGenConfigJSON<int, double, int> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
 	status = configFile.getMeshSpatialZMax(&sZMax);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 	BOOST_CHECK_EQUAL(sZMax, 7.9);
@@ -326,7 +326,7 @@ BOOST_AUTO_TEST_CASE(buildMeshSourceConfig)
 	std::string filePath;
 
 	std::string topLevel[0] = {};
-	MeshSourceStructGenConfigJSON<int, double> configFile1("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
+	MeshSourceStructGenConfigJSON<int, double, int> configFile1("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
 
 	MeshSourceConfig<int,double,int> * config;
 	status = configFile1.buildMeshSourceConfig(&config);
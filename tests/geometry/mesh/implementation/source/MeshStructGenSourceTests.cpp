@@ -42,14 +42,14 @@ BOOST_AUTO_TEST_CASE(setup)
 // Test 1:
 BOOST_AUTO_TEST_CASE(constructor_test1)
 {
-	MeshStructGenSource<int, double> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 }
 
 // === getCellLabels ===
 // Test 1: Test Labels are correct
 BOOST_AUTO_TEST_CASE(getCellLabels_test1)
 {
-	MeshStructGenSource<int, double> source(3, 3, 3, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(3, 3, 3, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int indices[27] = {0, 1, 2, 3, 4, 5, 6, 7, 8,
@@ -123,7 +123,7 @@ BOOST_AUTO_TEST_CASE(calculateXCoord_test3)
 // Test 4: Compute the correct coordinate for all cellLabels
 BOOST_AUTO_TEST_CASE(calculateXCoord_test4)
 {
-	MeshStructGenSource<int, double> source(3, 4, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(3, 4, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 
 	int cellLabels[60] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
 				 	      17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
@@ -166,7 +166,7 @@ BOOST_AUTO_TEST_CASE(calculateYCoord_test3)
 // Test 4: Compute the correct coordinate for all cellLabels
 BOOST_AUTO_TEST_CASE(calculateYCoord_test4)
 {
-	MeshStructGenSource<int, double> source(3, 4, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(3, 4, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 
 	int cellLabels[60] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
 				 	      17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
@@ -210,7 +210,7 @@ BOOST_AUTO_TEST_CASE(calculateZCoord_test3)
 // Test 4: Compute the correct coordinate for all cellLabels
 BOOST_AUTO_TEST_CASE(calculateZCoord_test4)
 {
-	MeshStructGenSource<int, double> source(3, 4, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(3, 4, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 
 	int cellLabels[60] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
 				 	      17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
@@ -236,7 +236,7 @@ BOOST_AUTO_TEST_CASE(calculateZCoord_test4)
 // Test 1: Get Correct Value
 BOOST_AUTO_TEST_CASE(getCellCount_test1)
 {
-	MeshStructGenSource<int, double> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int cellCount;
@@ -249,7 +249,7 @@ BOOST_AUTO_TEST_CASE(getCellCount_test1)
 // Test 1: Get Correct Value
 BOOST_AUTO_TEST_CASE(getFaceCount_test1)
 {
-	MeshStructGenSource<int, double> source(3, 4, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(3, 4, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int faceCount;
@@ -262,7 +262,7 @@ BOOST_AUTO_TEST_CASE(getFaceCount_test1)
 // Test 1: Get Correct Value
 BOOST_AUTO_TEST_CASE(getBoundaryCount_test1)
 {
-	MeshStructGenSource<int, double> source(3, 4, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(3, 4, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int boundaryCount;
@@ -275,7 +275,7 @@ BOOST_AUTO_TEST_CASE(getBoundaryCount_test1)
 // Test 1: Get Correct Value
 BOOST_AUTO_TEST_CASE(getRegionCount_test1)
 {
-	MeshStructGenSource<int, double> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int regionCount;
@@ -288,7 +288,7 @@ BOOST_AUTO_TEST_CASE(getRegionCount_test1)
 // Test 1: Get Correct Value
 BOOST_AUTO_TEST_CASE(getVertexCount_test1)
 {
-	MeshStructGenSource<int, double> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int vertexCount;
@@ -301,7 +301,7 @@ BOOST_AUTO_TEST_CASE(getVertexCount_test1)
 // Test 1: Get Correct Value
 BOOST_AUTO_TEST_CASE(getMaxFaceCount_test1)
 {
-	MeshStructGenSource<int, double> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int maxFaceCount;
@@ -314,7 +314,7 @@ BOOST_AUTO_TEST_CASE(getMaxFaceCount_test1)
 // Test 1: Get Correct Value
 BOOST_AUTO_TEST_CASE(getMaxVertexCount_test1)
 {
-	MeshStructGenSource<int, double> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int maxVertexCount;
@@ -327,7 +327,7 @@ BOOST_AUTO_TEST_CASE(getMaxVertexCount_test1)
 // Test 1:
 BOOST_AUTO_TEST_CASE(getCellNFaces_test1)
 {
-	MeshStructGenSource<int, double> source(3, 4, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(3, 4, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int cellLabels[60] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
@@ -359,7 +359,7 @@ BOOST_AUTO_TEST_CASE(getCellVolume_test1)
 // Test 1:
 BOOST_AUTO_TEST_CASE(getCellCenter_test1)
 {
-	MeshStructGenSource<int, double> source(2, 3, 2, -1.0, 1.0, -1.0, 2.0, 0.0, 2.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 2, -1.0, 1.0, -1.0, 2.0, 0.0, 2.0);
 	cupcfd::error::eCodes status;
 
 	int cellLabels[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
@@ -396,7 +396,7 @@ BOOST_AUTO_TEST_CASE(getCellCenter_test1)
 // Test 1:
 BOOST_AUTO_TEST_CASE(getCellFaceLabels_test1)
 {
-	MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int cellLabels[24] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23};
@@ -444,7 +444,7 @@ BOOST_AUTO_TEST_CASE(getCellFaceLabels_test1)
 // Test 1:
 BOOST_AUTO_TEST_CASE(getFaceIsBoundary_test1)
 {
-	MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[98] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
@@ -481,7 +481,7 @@ BOOST_AUTO_TEST_CASE(getFaceIsBoundary_test1)
 // Test 1:
 BOOST_AUTO_TEST_CASE(getFaceNVertices_test1)
 {
-	MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[98] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
@@ -517,7 +517,7 @@ BOOST_AUTO_TEST_CASE(getFaceNVertices_test1)
 // Test 1: Get correct values
 BOOST_AUTO_TEST_CASE(getFaceBoundaryLabels_test1)
 {
-	MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[52] = {0, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, 17, 18, 20, 21, 23, 24,
@@ -540,7 +540,7 @@ BOOST_AUTO_TEST_CASE(getFaceBoundaryLabels_test1)
 // Test 2: Error Case: One or more faces are not boundary faces
 BOOST_AUTO_TEST_CASE(getFaceBoundaryLabels_test2)
 {
-	MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[41] = {0, 1, 2, 3, 4, 5, 27, 30, 31, 32, 33, 34, 35,
@@ -557,7 +557,7 @@ BOOST_AUTO_TEST_CASE(getFaceBoundaryLabels_test2)
 // Test 1:
 BOOST_AUTO_TEST_CASE(getFaceCell1Labels_test1)
 {
-	MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[98] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
@@ -595,7 +595,7 @@ BOOST_AUTO_TEST_CASE(getFaceCell1Labels_test1)
 // Test 1:
 BOOST_AUTO_TEST_CASE(getFaceCell2Labels_test1)
 {
-	MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[98] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
@@ -668,7 +668,7 @@ BOOST_AUTO_TEST_CASE(getFaceVerticesLabels_test1)
 // Test 1:
 BOOST_AUTO_TEST_CASE(getFaceVerticesLabelsCSR_test1)
 {
-	MeshStructGenSource<int, double> source(2, 3, 2, -1.0, 1.0, -1.0, 2.0, 0.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 2, -1.0, 1.0, -1.0, 2.0, 0.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int faceLabels[52] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
@@ -748,7 +748,7 @@ BOOST_AUTO_TEST_CASE(getFaceVerticesLabelsCSR_test1)
 // Test 1:
 BOOST_AUTO_TEST_CASE(getVertexCoords_test1)
 {
-	MeshStructGenSource<int, double> source(2, 3, 2, -1.0, 1.0, -1.0, 2.0, 0.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 2, -1.0, 1.0, -1.0, 2.0, 0.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int vertexLabels[36] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
@@ -811,7 +811,7 @@ BOOST_AUTO_TEST_CASE(getVertexCoords_test1)
 // Test 1:
 BOOST_AUTO_TEST_CASE(getBoundaryFaceLabels_test1)
 {
-	MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int boundaryLabels[52] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
@@ -835,7 +835,7 @@ BOOST_AUTO_TEST_CASE(getBoundaryFaceLabels_test1)
 // Test 1:
 BOOST_AUTO_TEST_CASE(getBoundaryNVertices_test1)
 {
-	MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int boundaryLabels[40] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
@@ -859,7 +859,7 @@ BOOST_AUTO_TEST_CASE(getBoundaryNVertices_test1)
 // Test 1:
 BOOST_AUTO_TEST_CASE(getBoundaryRegionLabels_test1)
 {
-	MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int boundaryLabels[40] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
@@ -883,7 +883,7 @@ BOOST_AUTO_TEST_CASE(getBoundaryRegionLabels_test1)
 // Test 1:
 BOOST_AUTO_TEST_CASE(getBoundaryVerticesLabelsCSR_test1)
 {
-	MeshStructGenSource<int, double> source(2, 3, 2, -1.0, 1.0, -1.0, 2.0, 0.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 2, -1.0, 1.0, -1.0, 2.0, 0.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int boundaryLabels[32] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
@@ -948,7 +948,7 @@ BOOST_AUTO_TEST_CASE(getBoundaryDistance_test1)
 BOOST_AUTO_TEST_CASE(getRegionName_test1)
 {
 
-	MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshStructGenSource<int, double, int> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	int regionLabels[1] = {0};
@@ -967,7 +967,7 @@ BOOST_AUTO_TEST_CASE(getRegionName_test1)
 BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 {
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
-	cupcfd::geometry::mesh::MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	cupcfd::geometry::mesh::MeshStructGenSource<int, double, int> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	// Assign arbitrary range of cells to each process
@@ -1130,7 +1130,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 {
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
-	cupcfd::geometry::mesh::MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	cupcfd::geometry::mesh::MeshStructGenSource<int, double, int> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	cupcfd::data_structures::DistributedAdjacencyList<int,int> * graph;
@@ -1265,7 +1265,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 {
 	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
-	cupcfd::geometry::mesh::MeshStructGenSource<int, double> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	cupcfd::geometry::mesh::MeshStructGenSource<int, double, int> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
 	cupcfd::data_structures::DistributedAdjacencyList<int,int> * graph;
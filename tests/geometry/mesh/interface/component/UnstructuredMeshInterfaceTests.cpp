@@ -15,7 +15,24 @@
 #include <boost/test/output_test_stream.hpp>
 #include <stdexcept>
 
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <glob.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "UnstructuredMeshInterface.h"
+#include "MeshConfig.h"
+#include "MeshSourceStructGenConfig.h"
+#include "MeshSourceMixedGenConfig.h"
+#include "MeshSourceFileConfig.h"
+#include "PartitionerNaiveConfig.h"
+#include "CupCfdSoAMesh.h"
+#include "CupCfdAoSMesh.h"
+#include "CupCfdAoSoAMesh.h"
 
 using namespace cupcfd::geometry::mesh;
 
@@ -29,6 +46,1064 @@ BOOST_AUTO_TEST_CASE(setup)
     MPI_Init(&argc, &argv);
 }
 
+// Compare the stored data of a mesh restored from a snapshot against the mesh it was written from
+// (or against the same mesh built with another storage format)
+template <class M, class N>
+void checkSnapshotMesh(M& mesh, N& cmp)
+{
+	BOOST_CHECK_EQUAL(mesh.properties.nCells, cmp.properties.nCells);
+	BOOST_CHECK_EQUAL(mesh.properties.lOCells, cmp.properties.lOCells);
+	BOOST_CHECK_EQUAL(mesh.properties.lTCells, cmp.properties.lTCells);
+	BOOST_CHECK_EQUAL(mesh.properties.lFaces, cmp.properties.lFaces);
+	BOOST_CHECK_EQUAL(mesh.properties.lVertices, cmp.properties.lVertices);
+	BOOST_CHECK_EQUAL(mesh.properties.lBoundaries, cmp.properties.lBoundaries);
+	BOOST_CHECK_EQUAL(mesh.properties.lRegions, cmp.properties.lRegions);
+	BOOST_CHECK_EQUAL(mesh.cellConnGraph->nLONodes, cmp.cellConnGraph->nLONodes);
+	BOOST_CHECK_EQUAL(mesh.cellConnGraph->nLGhNodes, cmp.cellConnGraph->nLGhNodes);
+	BOOST_CHECK_EQUAL(mesh.properties.cellType, cmp.properties.cellType);
+
+	for(int i = 0; i < cmp.properties.lTCells; i++) {
+		BOOST_CHECK_EQUAL(mesh.getCellVolume(i), cmp.getCellVolume(i));
+		BOOST_CHECK(mesh.getCellCenter(i) == cmp.getCellCenter(i));
+		BOOST_CHECK_EQUAL(mesh.getCellNFaces(i), cmp.getCellNFaces(i));
+	}
+
+	for(int i = 0; i < cmp.properties.lOCells; i++) {
+		for(int j = 0; j < cmp.getCellNFaces(i); j++) {
+			BOOST_CHECK_EQUAL(mesh.getCellFaceID(i, j), cmp.getCellFaceID(i, j));
+		}
+	}
+
+	for(int i = 0; i < cmp.properties.lFaces; i++) {
+		BOOST_CHECK_EQUAL(mesh.getFaceCell1ID(i), cmp.getFaceCell1ID(i));
+		BOOST_CHECK_EQUAL(mesh.getFaceCell2ID(i), cmp.getFaceCell2ID(i));
+		BOOST_CHECK_EQUAL(mesh.getFaceLambda(i), cmp.getFaceLambda(i));
+		BOOST_CHECK_EQUAL(mesh.getFaceArea(i), cmp.getFaceArea(i));
+		BOOST_CHECK(mesh.getFaceNorm(i) == cmp.getFaceNorm(i));
+
+		for(int j = 0; j < cmp.getFaceNVertices(i); j++) {
+			BOOST_CHECK_EQUAL(mesh.getFaceVertex(i, j), cmp.getFaceVertex(i, j));
+		}
+	}
+
+	for(int i = 0; i < cmp.properties.lBoundaries; i++) {
+		BOOST_CHECK_EQUAL(mesh.getBoundaryFaceID(i), cmp.getBoundaryFaceID(i));
+		BOOST_CHECK_EQUAL(mesh.getBoundaryRegionID(i), cmp.getBoundaryRegionID(i));
+	}
+
+	for(int i = 0; i < cmp.properties.lRegions; i++) {
+		BOOST_CHECK_EQUAL(mesh.getRegionName(i), cmp.getRegionName(i));
+	}
+
+	for(int i = 0; i < cmp.properties.lVertices; i++) {
+		BOOST_CHECK(mesh.getVertexPos(i) == cmp.getVertexPos(i));
+	}
+}
+
+// === writeSnapshot/readSnapshot ===
+// Test 1: A mesh restored from a snapshot matches the mesh that was written
+BOOST_AUTO_TEST_CASE(readSnapshot_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double,int> sourceConfig(6, 5, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, sourceConfig);
+
+	CupCfdSoAMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::string fileName = "mesh_snapshot_test1_" + std::to_string(comm.rank) + ".snap";
+	status = mesh->writeSnapshot(fileName, 42);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	CupCfdSoAMesh<int,double,int> restored(comm);
+	status = restored.readSnapshot(fileName, 42);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkSnapshotMesh(restored, *mesh);
+
+	// The restored mesh is finalized, so cannot be restored into again
+	status = restored.readSnapshot(fileName, 42);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_FINALIZED);
+
+	remove(fileName.c_str());
+	delete mesh;
+}
+
+// Test 2: Error Case: The snapshot was written with a different configuration, or by a different mesh type
+BOOST_AUTO_TEST_CASE(readSnapshot_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double,int> sourceConfig(6, 5, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, sourceConfig);
+
+	CupCfdSoAMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::string fileName = "mesh_snapshot_test2_" + std::to_string(comm.rank) + ".snap";
+	status = mesh->writeSnapshot(fileName, 42);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	CupCfdSoAMesh<int,double,int> wrongHash(comm);
+	status = wrongHash.readSnapshot(fileName, 43);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_FILE_FORMAT);
+
+	CupCfdAoSMesh<int,double,int> wrongType(comm);
+	status = wrongType.readSnapshot(fileName, 42);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_FILE_FORMAT);
+
+	// An unfinalized mesh cannot be stored
+	status = wrongHash.writeSnapshot(fileName, 42);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_UNFINALIZED);
+
+	remove(fileName.c_str());
+	delete mesh;
+}
+
+// Test 3: A mesh configuration with a snapshot path stores the mesh once and restores it afterwards
+BOOST_AUTO_TEST_CASE(readSnapshot_test3)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	std::string snapshotPath = "mesh_snapshot_test3";
+
+	if(comm.rank == 0) {
+		mkdir(snapshotPath.c_str(), 0755);
+	}
+	MPI_Barrier(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double,int> sourceConfig(7, 3, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, sourceConfig);
+	meshConfig.setSnapshotPath(snapshotPath);
+
+	CupCfdAoSMesh<int,double,int> * built;
+	status = meshConfig.buildUnstructuredMesh(&built, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	CupCfdAoSMesh<int,double,int> * restored;
+	status = meshConfig.buildUnstructuredMesh(&restored, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Only a mesh built from the source records its construction memory use
+	BOOST_CHECK(built->buildPeakRSS > 0);
+	BOOST_CHECK_EQUAL(restored->buildPeakRSS, 0);
+	checkSnapshotMesh(*restored, *built);
+
+	delete built;
+	delete restored;
+
+	// One snapshot per rank
+	glob_t files;
+	std::string pattern = snapshotPath + "/mesh_*_" + std::to_string(comm.rank) + ".snap";
+	BOOST_CHECK_EQUAL(glob(pattern.c_str(), 0, NULL, &files), 0);
+	BOOST_CHECK_EQUAL(files.gl_pathc, 1);
+
+	for(std::size_t i = 0; i < files.gl_pathc; i++) {
+		remove(files.gl_pathv[i]);
+	}
+	globfree(&files);
+
+	MPI_Barrier(MPI_COMM_WORLD);
+	if(comm.rank == 0) {
+		rmdir(snapshotPath.c_str());
+	}
+}
+
+// === CupCfdAoSoAMesh ===
+// Test 1: An AoSoA mesh stores the same data as an SoA mesh built from the same source, and can be restored from a snapshot
+template <int W>
+void checkAoSoAMesh(CupCfdSoAMesh<int,double,int>& cmp, MeshConfig<int,double,int>& meshConfig, cupcfd::comm::Communicator& comm)
+{
+	cupcfd::error::eCodes status;
+
+	CupCfdAoSoAMesh<int,double,int,W> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkSnapshotMesh(*mesh, cmp);
+
+	// Faces are stored in order, W to a tile
+	BOOST_CHECK_EQUAL(mesh->getNFaceTiles(), (cmp.properties.lFaces + W - 1) / W);
+	BOOST_CHECK_EQUAL(mesh->getNCellTiles(), (cmp.properties.lTCells + W - 1) / W);
+
+	for(int i = 0; i < cmp.properties.lFaces; i++) {
+		const CupCfdAoSoAMeshFaceTile<int,double,W>& tile = mesh->getFaceTile(i / W);
+		BOOST_CHECK_EQUAL(tile.cell1ID[i % W], cmp.getFaceCell1ID(i));
+		BOOST_CHECK_EQUAL(tile.boundaryID[i % W], cmp.getFaceBoundaryID(i));
+		BOOST_CHECK_EQUAL(tile.center[2][i % W], cmp.getFaceCenter(i).cmp[2]);
+	}
+
+	std::string fileName = "mesh_aosoa_test1_" + std::to_string(W) + "_" + std::to_string(comm.rank) + ".snap";
+	status = mesh->writeSnapshot(fileName, 42);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	CupCfdAoSoAMesh<int,double,int,W> restored(comm);
+	status = restored.readSnapshot(fileName, 42);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkSnapshotMesh(restored, cmp);
+
+	remove(fileName.c_str());
+	delete mesh;
+}
+
+BOOST_AUTO_TEST_CASE(aosoaMesh_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double,int> sourceConfig(7, 5, 3, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, sourceConfig);
+
+	CupCfdSoAMesh<int,double,int> * cmp;
+	status = meshConfig.buildUnstructuredMesh(&cmp, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	checkAoSoAMesh<4>(*cmp, meshConfig, comm);
+	checkAoSoAMesh<8>(*cmp, meshConfig, comm);
+	checkAoSoAMesh<16>(*cmp, meshConfig, comm);
+
+	delete cmp;
+}
+
+// === computeFaceGeometry ===
+// Check the face geometry of a structured box of cubic cells with edge length h
+template <class M>
+void checkBoxFaceGeometry(M& mesh, double h)
+{
+	for(int i = 0; i < mesh.properties.lFaces; i++) {
+		double area = mesh.getFaceArea(i);
+		BOOST_CHECK_CLOSE(area, h * h, 1e-10);
+
+		// The stored normal is scaled by the area, and is a unit axis direction pointing out of cell 1
+		cupcfd::geometry::euclidean::EuclideanVector3D<double> norm = mesh.getFaceNorm(i);
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> cell1Center = mesh.getCellCenter(mesh.getFaceCell1ID(i));
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> faceCenter = mesh.getFaceCenter(i);
+
+		double unit[3];
+		int nAxis = 0;
+		double outward = 0.0;
+
+		for(int d = 0; d < 3; d++) {
+			unit[d] = norm.cmp[d] / area;
+			outward += unit[d] * (faceCenter.cmp[d] - cell1Center.cmp[d]);
+
+			if(std::abs(unit[d]) > 0.5) {
+				BOOST_CHECK_CLOSE(std::abs(unit[d]), 1.0, 1e-10);
+				nAxis++;
+			}
+			else {
+				BOOST_CHECK_SMALL(unit[d], 1e-12);
+			}
+		}
+
+		BOOST_CHECK_EQUAL(nAxis, 1);
+		BOOST_CHECK_CLOSE(outward, 0.5 * h, 1e-10);
+
+		// Xpac is the cell 1 centre, since it lies on the line through the face centre along the normal
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> xpac = mesh.getFaceXpac(i);
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> xnac = mesh.getFaceXnac(i);
+
+		for(int d = 0; d < 3; d++) {
+			BOOST_CHECK_SMALL(xpac.cmp[d] - cell1Center.cmp[d], 1e-12);
+		}
+
+		if(mesh.getFaceIsBoundary(i)) {
+			// Xnac is the face centre, half a cell from Xpac
+			for(int d = 0; d < 3; d++) {
+				BOOST_CHECK_SMALL(xnac.cmp[d] - faceCenter.cmp[d], 1e-12);
+			}
+
+			BOOST_CHECK_CLOSE(mesh.getFaceRLencos(i), area / (0.5 * h), 1e-10);
+		}
+		else {
+			// Xnac is the cell 2 centre, one cell spacing from Xpac along the normal
+			cupcfd::geometry::euclidean::EuclideanPoint<double,3> cell2Center = mesh.getCellCenter(mesh.getFaceCell2ID(i));
+
+			for(int d = 0; d < 3; d++) {
+				BOOST_CHECK_SMALL(xnac.cmp[d] - cell2Center.cmp[d], 1e-12);
+				BOOST_CHECK_SMALL(cell2Center.cmp[d] - cell1Center.cmp[d] - h * unit[d], 1e-12);
+			}
+
+			BOOST_CHECK_CLOSE(mesh.getFaceLambda(i), 0.5, 1e-10);
+			BOOST_CHECK_CLOSE(mesh.getFaceRLencos(i), area / h, 1e-10);
+		}
+	}
+}
+
+// Test 1: The face geometry of a structured box, for the AoS and SoA meshes
+BOOST_AUTO_TEST_CASE(computeFaceGeometry_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double,int> sourceConfig(4, 4, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, sourceConfig);
+
+	CupCfdSoAMesh<int,double,int> * soaMesh;
+	status = meshConfig.buildUnstructuredMesh(&soaMesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkBoxFaceGeometry(*soaMesh, 0.5);
+
+	CupCfdAoSMesh<int,double,int> * aosMesh;
+	status = meshConfig.buildUnstructuredMesh(&aosMesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkBoxFaceGeometry(*aosMesh, 0.5);
+
+	delete soaMesh;
+	delete aosMesh;
+}
+
+// Test 2: The AoS and SoA meshes compute bit-identical face geometry
+BOOST_AUTO_TEST_CASE(computeFaceGeometry_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double,int> sourceConfig(6, 5, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, sourceConfig);
+
+	CupCfdSoAMesh<int,double,int> * soaMesh;
+	status = meshConfig.buildUnstructuredMesh(&soaMesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	CupCfdAoSMesh<int,double,int> * aosMesh;
+	status = meshConfig.buildUnstructuredMesh(&aosMesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(aosMesh->properties.lFaces, soaMesh->properties.lFaces);
+
+	for(int i = 0; i < soaMesh->properties.lFaces; i++) {
+		BOOST_CHECK_EQUAL(aosMesh->getFaceArea(i), soaMesh->getFaceArea(i));
+		BOOST_CHECK(aosMesh->getFaceNorm(i) == soaMesh->getFaceNorm(i));
+		BOOST_CHECK(aosMesh->getFaceCenter(i) == soaMesh->getFaceCenter(i));
+		BOOST_CHECK(aosMesh->getFaceXpac(i) == soaMesh->getFaceXpac(i));
+		BOOST_CHECK(aosMesh->getFaceXnac(i) == soaMesh->getFaceXnac(i));
+		BOOST_CHECK_EQUAL(aosMesh->getFaceRLencos(i), soaMesh->getFaceRLencos(i));
+		BOOST_CHECK_EQUAL(aosMesh->getFaceLambda(i), soaMesh->getFaceLambda(i));
+	}
+
+	delete soaMesh;
+	delete aosMesh;
+}
+
+// === Label types ===
+// Check that a mesh built with long labels matches the same mesh built with int labels
+void checkLongLabelMesh(MeshSourceConfig<int,double,int>& intSourceConfig, MeshSourceConfig<int,double,long>& longSourceConfig,
+						cupcfd::comm::Communicator& comm)
+{
+	cupcfd::error::eCodes status;
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> intPartConfig;
+	MeshConfig<int,double,int> intMeshConfig(intPartConfig, intSourceConfig);
+
+	CupCfdSoAMesh<int,double,int> * intMesh;
+	status = intMeshConfig.buildUnstructuredMesh(&intMesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,long> longPartConfig;
+	MeshConfig<int,double,long> longMeshConfig(longPartConfig, longSourceConfig);
+
+	CupCfdSoAMesh<int,double,long> * longMesh;
+	status = longMeshConfig.buildUnstructuredMesh(&longMesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	checkSnapshotMesh(*longMesh, *intMesh);
+
+	// The cells have the same labels and global IDs at each local index
+	BOOST_CHECK_EQUAL(longMesh->cellConnGraph->nGNodes, (long) intMesh->cellConnGraph->nGNodes);
+	BOOST_CHECK_EQUAL(longMesh->cellConnGraph->globalOwnedRangeMin, intMesh->cellConnGraph->globalOwnedRangeMin);
+
+	for(int i = 0; i < intMesh->properties.lTCells; i++) {
+		long longLabel = longMesh->cellConnGraph->connGraph.IDXToNode[i];
+		int intLabel = intMesh->cellConnGraph->connGraph.IDXToNode[i];
+
+		BOOST_CHECK_EQUAL(longLabel, (long) intLabel);
+		BOOST_CHECK_EQUAL(longMesh->cellConnGraph->nodeToGlobal[longLabel], intMesh->cellConnGraph->nodeToGlobal[intLabel]);
+	}
+
+	delete intMesh;
+	delete longMesh;
+}
+
+// Test 1: A generated mesh
+BOOST_AUTO_TEST_CASE(longLabels_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	MeshSourceStructGenConfig<int,double,int> intSourceConfig(6, 5, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshSourceStructGenConfig<int,double,long> longSourceConfig(6, 5, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+
+	checkLongLabelMesh(intSourceConfig, longSourceConfig, comm);
+}
+
+// Test 2: A mesh read from a HDF5 file
+// The file source is compared before the mesh build, since the label type only changes how the
+// source reports counts and labels, and the distributed graph it builds from them
+BOOST_AUTO_TEST_CASE(longLabels_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	MeshSourceFileConfig<int,double,int> intSourceConfig(MESH_FILE_FORMAT_HDF5, "../tests/geometry/mesh/data/MeshHDF5.hdf5");
+	MeshSourceFileConfig<int,double,long> longSourceConfig(MESH_FILE_FORMAT_HDF5, "../tests/geometry/mesh/data/MeshHDF5.hdf5");
+
+	MeshSource<int,double,int> * intSource;
+	status = intSourceConfig.buildMeshSource(&intSource);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	MeshSource<int,double,long> * longSource;
+	status = longSourceConfig.buildMeshSource(&longSource);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int intCount;
+	long longCount;
+
+	status = intSource->getCellCount(&intCount);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = longSource->getCellCount(&longCount);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(longCount, (long) intCount);
+	int nCells = intCount;
+
+	status = intSource->getFaceCount(&intCount);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = longSource->getFaceCount(&longCount);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(longCount, (long) intCount);
+	int nFaces = intCount;
+
+	status = intSource->getVertexCount(&intCount);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = longSource->getVertexCount(&longCount);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(longCount, (long) intCount);
+
+	status = intSource->getBoundaryCount(&intCount);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = longSource->getBoundaryCount(&longCount);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(longCount, (long) intCount);
+
+	// Cell labels and the cell data read through them
+	std::vector<int> indexes(std::max(nCells, nFaces));
+	for(int i = 0; i < (int) indexes.size(); i++) {
+		indexes[i] = i;
+	}
+
+	std::vector<int> intCellLabels(nCells);
+	std::vector<long> longCellLabels(nCells);
+	status = intSource->getCellLabels(intCellLabels.data(), nCells, indexes.data(), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = longSource->getCellLabels(longCellLabels.data(), nCells, indexes.data(), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<int> intNFaces(nCells), longNFaces(nCells);
+	std::vector<double> intVol(nCells), longVol(nCells);
+	status = intSource->getCellNFaces(intNFaces.data(), nCells, intCellLabels.data(), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = longSource->getCellNFaces(longNFaces.data(), nCells, longCellLabels.data(), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = intSource->getCellVolume(intVol.data(), nCells, intCellLabels.data(), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = longSource->getCellVolume(longVol.data(), nCells, longCellLabels.data(), nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < nCells; i++) {
+		BOOST_CHECK_EQUAL(longCellLabels[i], (long) intCellLabels[i]);
+		BOOST_CHECK_EQUAL(longNFaces[i], intNFaces[i]);
+		BOOST_CHECK_EQUAL(longVol[i], intVol[i]);
+	}
+
+	// Face labels and the cells either side of each face
+	std::vector<int> intFaceLabels(nFaces), intCell1(nFaces);
+	std::vector<long> longFaceLabels(nFaces), longCell1(nFaces);
+	status = intSource->getFaceLabels(intFaceLabels.data(), nFaces, indexes.data(), nFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = longSource->getFaceLabels(longFaceLabels.data(), nFaces, indexes.data(), nFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = intSource->getFaceCell1Labels(intCell1.data(), nFaces, intFaceLabels.data(), nFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = longSource->getFaceCell1Labels(longCell1.data(), nFaces, longFaceLabels.data(), nFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < nFaces; i++) {
+		BOOST_CHECK_EQUAL(longFaceLabels[i], (long) intFaceLabels[i]);
+		BOOST_CHECK_EQUAL(longCell1[i], (long) intCell1[i]);
+	}
+
+	// The naive distributed graph gives each cell the same global ID
+	cupcfd::data_structures::DistributedAdjacencyList<int,int> * intGraph;
+	cupcfd::data_structures::DistributedAdjacencyList<int,long> * longGraph;
+	status = intSource->buildDistributedAdjacencyList(&intGraph, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = longSource->buildDistributedAdjacencyList(&longGraph, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(longGraph->nGNodes, (long) intGraph->nGNodes);
+	BOOST_CHECK_EQUAL(longGraph->nLONodes, intGraph->nLONodes);
+	BOOST_CHECK_EQUAL(longGraph->globalOwnedRangeMin, intGraph->globalOwnedRangeMin);
+
+	for(int i = 0; i < intGraph->nLONodes; i++) {
+		long longLabel = longGraph->connGraph.IDXToNode[i];
+		int intLabel = intGraph->connGraph.IDXToNode[i];
+
+		BOOST_CHECK_EQUAL(longLabel, (long) intLabel);
+		BOOST_CHECK_EQUAL(longGraph->nodeToGlobal[longLabel], intGraph->nodeToGlobal[intLabel]);
+	}
+
+	delete intGraph;
+	delete longGraph;
+	delete intSource;
+	delete longSource;
+}
+
+// === refine ===
+// Check that a refined mesh of a single cell type covers the same volume, that the faces of each local cell
+// enclose it, and that the ghost cells match the cells they copy on their owning ranks
+template <class M>
+void checkRefinedMesh(M& mesh, M& coarse, cupcfd::geometry::shapes::PolyhedronType cellType, cupcfd::comm::Communicator& comm)
+{
+	BOOST_CHECK_EQUAL(mesh.properties.lOCells, 8 * coarse.properties.lOCells);
+	BOOST_CHECK_EQUAL(mesh.properties.cellType, cellType);
+
+	double volume[2] = {0.0, 0.0};
+	for(int i = 0; i < coarse.properties.lOCells; i++) {
+		volume[0] += coarse.getCellVolume(i);
+	}
+	for(int i = 0; i < mesh.properties.lOCells; i++) {
+		volume[1] += mesh.getCellVolume(i);
+		BOOST_CHECK(mesh.getCellVolume(i) > 0.0);
+	}
+
+	double totalVolume[2];
+	MPI_Allreduce(volume, totalVolume, 2, MPI_DOUBLE, MPI_SUM, comm.comm);
+	BOOST_CHECK_CLOSE(totalVolume[0], 8.0, 1e-8);
+	BOOST_CHECK_CLOSE(totalVolume[1], 8.0, 1e-8);
+
+	// The normals of the faces of a closed cell sum to zero
+	std::vector<double> normSum(3 * mesh.properties.lTCells, 0.0);
+	for(int i = 0; i < mesh.properties.lFaces; i++) {
+		cupcfd::geometry::euclidean::EuclideanVector3D<double> norm = mesh.getFaceNorm(i);
+		int cell1 = mesh.getFaceCell1ID(i);
+
+		BOOST_CHECK(mesh.getFaceArea(i) > 0.0);
+
+		for(int d = 0; d < 3; d++) {
+			normSum[3 * cell1 + d] += norm.cmp[d];
+		}
+
+		if(!mesh.getFaceIsBoundary(i)) {
+			int cell2 = mesh.getFaceCell2ID(i);
+			for(int d = 0; d < 3; d++) {
+				normSum[3 * cell2 + d] -= norm.cmp[d];
+			}
+
+			BOOST_CHECK(mesh.getFaceLambda(i) > 0.0 && mesh.getFaceLambda(i) < 1.0);
+		}
+	}
+
+	// Tetrahedra have 4 faces, triangular prisms 5 and hexahedra 6
+	for(int i = 0; i < mesh.properties.lOCells; i++) {
+		BOOST_CHECK_EQUAL(mesh.getCellNFaces(i), cupcfd::geometry::shapes::getPolyhedronNFaces(cellType));
+		for(int d = 0; d < 3; d++) {
+			BOOST_CHECK_SMALL(normSum[3 * i + d], 1e-12);
+		}
+	}
+
+	// Gather the global IDs and volumes of the owned cells of every rank
+	int nOwned = mesh.properties.lOCells;
+	std::vector<int> ownedGlobalIDs(nOwned);
+	std::vector<double> ownedVolumes(nOwned);
+	for(int i = 0; i < nOwned; i++) {
+		ownedGlobalIDs[i] = mesh.cellConnGraph->nodeToGlobal[mesh.cellConnGraph->connGraph.IDXToNode[i]];
+		ownedVolumes[i] = mesh.getCellVolume(i);
+	}
+
+	std::vector<int> counts(comm.size);
+	MPI_Allgather(&nOwned, 1, MPI_INT, counts.data(), 1, MPI_INT, comm.comm);
+
+	std::vector<int> displs(comm.size + 1, 0);
+	for(int r = 0; r < comm.size; r++) {
+		displs[r + 1] = displs[r] + counts[r];
+	}
+
+	std::vector<int> globalIDs(displs[comm.size]);
+	std::vector<double> volumes(displs[comm.size]);
+	MPI_Allgatherv(ownedGlobalIDs.data(), nOwned, MPI_INT, globalIDs.data(), counts.data(), displs.data(), MPI_INT, comm.comm);
+	MPI_Allgatherv(ownedVolumes.data(), nOwned, MPI_DOUBLE, volumes.data(), counts.data(), displs.data(), MPI_DOUBLE, comm.comm);
+
+	std::vector<double> volumeByGlobalID(displs[comm.size], -1.0);
+	for(int i = 0; i < displs[comm.size]; i++) {
+		volumeByGlobalID[globalIDs[i]] = volumes[i];
+	}
+
+	BOOST_CHECK_EQUAL(mesh.properties.lGhCells, mesh.properties.lTCells - mesh.properties.lOCells);
+	for(int i = mesh.properties.lOCells; i < mesh.properties.lTCells; i++) {
+		int globalID = mesh.cellConnGraph->nodeToGlobal[mesh.cellConnGraph->connGraph.IDXToNode[i]];
+		BOOST_CHECK(volumeByGlobalID[globalID] > 0.0);
+		BOOST_CHECK_CLOSE(mesh.getCellVolume(i), volumeByGlobalID[globalID], 1e-10);
+	}
+}
+
+// Test 1: Each cell is split into 8, on the same rank, and repeated refinement matches refinement by the mesh configuration
+BOOST_AUTO_TEST_CASE(refine_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double,int> sourceConfig(6, 5, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, sourceConfig);
+
+	CupCfdSoAMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	CupCfdSoAMesh<int,double,int> * refined;
+	status = mesh->refine(&refined);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkRefinedMesh(*refined, *mesh, cupcfd::geometry::shapes::POLYHEDRON_HEXAHEDRON, comm);
+
+	CupCfdSoAMesh<int,double,int> * refined2;
+	status = refined->refine(&refined2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkRefinedMesh(*refined2, *refined, cupcfd::geometry::shapes::POLYHEDRON_HEXAHEDRON, comm);
+
+	meshConfig.setRefinementLevels(2);
+	CupCfdSoAMesh<int,double,int> * built;
+	status = meshConfig.buildUnstructuredMesh(&built, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkSnapshotMesh(*built, *refined2);
+
+	delete mesh;
+	delete refined;
+	delete refined2;
+	delete built;
+}
+
+// Test 2: Error Case: The mesh is not finalized, or refinement is combined with a deeper halo
+BOOST_AUTO_TEST_CASE(refine_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	CupCfdSoAMesh<int,double,int> mesh(comm);
+	CupCfdSoAMesh<int,double,int> * refined;
+	status = mesh.refine(&refined);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_UNFINALIZED);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double,int> sourceConfig(6, 5, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, sourceConfig);
+	meshConfig.setRefinementLevels(1);
+	meshConfig.setHaloDepth(2);
+
+	CupCfdSoAMesh<int,double,int> * built;
+	status = meshConfig.buildUnstructuredMesh(&built, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_CONFIG_INVALID_VALUE);
+}
+
+// Test 3: Meshes of only tetrahedra or only triangular prisms are refined into 8 cells of the same type
+BOOST_AUTO_TEST_CASE(refine_test3)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+
+	MeshSourceMixedGenConfig<int,double,int> tetConfig(4, 4, 3, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 1.0, 0.0, 0.0, false, 0);
+	MeshConfig<int,double,int> tetMeshConfig(partConfig, tetConfig);
+
+	CupCfdSoAMesh<int,double,int> * tetMesh;
+	status = tetMeshConfig.buildUnstructuredMesh(&tetMesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	CupCfdSoAMesh<int,double,int> * tetRefined;
+	status = tetMesh->refine(&tetRefined);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkRefinedMesh(*tetRefined, *tetMesh, cupcfd::geometry::shapes::POLYHEDRON_TETRAHEDRON, comm);
+
+	MeshSourceMixedGenConfig<int,double,int> prismConfig(4, 4, 3, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 0.0, 1.0, 0.0, false, 0);
+	MeshConfig<int,double,int> prismMeshConfig(partConfig, prismConfig);
+
+	CupCfdSoAMesh<int,double,int> * prismMesh;
+	status = prismMeshConfig.buildUnstructuredMesh(&prismMesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	CupCfdSoAMesh<int,double,int> * prismRefined;
+	status = prismMesh->refine(&prismRefined);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkRefinedMesh(*prismRefined, *prismMesh, cupcfd::geometry::shapes::POLYHEDRON_TRIPRISM, comm);
+
+	delete tetMesh;
+	delete tetRefined;
+	delete prismMesh;
+	delete prismRefined;
+}
+
+// === detectCellType ===
+// Check that the cell type detected by finalize matches every local cell
+template <class M>
+void checkCellType(M& mesh, cupcfd::geometry::shapes::PolyhedronType cellType)
+{
+	BOOST_CHECK_EQUAL(mesh.properties.cellType, cellType);
+
+	if(cellType == cupcfd::geometry::shapes::POLYHEDRON_UNKNOWN) {
+		return;
+	}
+
+	for(int i = 0; i < mesh.properties.lOCells; i++) {
+		BOOST_CHECK_EQUAL(mesh.getCellPolyhedronType(i), cellType);
+		BOOST_CHECK_EQUAL(mesh.getCellNFaces(i), cupcfd::geometry::shapes::getPolyhedronNFaces(cellType));
+	}
+}
+
+// Test 1: A mesh with a single cell type is detected as that type, a mesh of mixed cell types is not
+BOOST_AUTO_TEST_CASE(detectCellType_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double,int> hexConfig(6, 5, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	MeshConfig<int,double,int> hexMeshConfig(partConfig, hexConfig);
+
+	CupCfdSoAMesh<int,double,int> * hexMesh;
+	status = hexMeshConfig.buildUnstructuredMesh(&hexMesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkCellType(*hexMesh, cupcfd::geometry::shapes::POLYHEDRON_HEXAHEDRON);
+
+	// findCellID runs the loop for hexahedra, and finds each local cell from its center
+	for(int i = 0; i < hexMesh->properties.lOCells; i++) {
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> center = hexMesh->getCellCenter(i);
+		int localID;
+		int globalID;
+		status = hexMesh->findCellID(center, &localID, &globalID);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(localID, i);
+	}
+
+	MeshSourceMixedGenConfig<int,double,int> tetConfig(4, 4, 3, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 1.0, 0.0, 0.0, false, 0);
+	MeshConfig<int,double,int> tetMeshConfig(partConfig, tetConfig);
+
+	CupCfdSoAMesh<int,double,int> * tetMesh;
+	status = tetMeshConfig.buildUnstructuredMesh(&tetMesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkCellType(*tetMesh, cupcfd::geometry::shapes::POLYHEDRON_TETRAHEDRON);
+
+	MeshSourceMixedGenConfig<int,double,int> mixedConfig(5, 4, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0, 0.3, 0.3, 0.0, false, 3);
+	MeshConfig<int,double,int> mixedMeshConfig(partConfig, mixedConfig);
+
+	CupCfdSoAMesh<int,double,int> * mixedMesh;
+	status = mixedMeshConfig.buildUnstructuredMesh(&mixedMesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkCellType(*mixedMesh, cupcfd::geometry::shapes::POLYHEDRON_UNKNOWN);
+
+	delete hexMesh;
+	delete tetMesh;
+	delete mixedMesh;
+}
+
+// === addVertices ===
+// Add a set of vertices and retrieve correct points, then check repeated labels, in the set or
+// already in the mesh, leave the mesh unchanged
+template <class M>
+void checkAddVertices(cupcfd::comm::Communicator& comm)
+{
+	cupcfd::error::eCodes status;
+
+	M mesh(comm);
+
+	int vertLabel[6] = {60, 50, 40, 30, 20, 10};
+	cupcfd::geometry::euclidean::EuclideanPoint<double,3> points[6];
+
+	for(int i = 0; i < 6; i++) {
+		points[i] = cupcfd::geometry::euclidean::EuclideanPoint<double,3>(0.5 * i, 1.0, -0.5 * i);
+	}
+
+	status = mesh.addVertices(vertLabel, points, 6);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(mesh.properties.lVertices, 6);
+
+	for(int i = 0; i < 6; i++) {
+		int localID = mesh.getVertexID(vertLabel[i]);
+		BOOST_CHECK_EQUAL(localID, i);
+
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> point = mesh.getVertexPos(localID);
+		BOOST_CHECK_EQUAL(point.cmp[0], 0.5 * i);
+		BOOST_CHECK_EQUAL(point.cmp[1], 1.0);
+		BOOST_CHECK_EQUAL(point.cmp[2], -0.5 * i);
+	}
+
+	// Error Check: Repeated labels leave the mesh unchanged
+	M mesh2(comm);
+
+	int vertLabel1[3] = {0, 1, 0};
+	status = mesh2.addVertices(vertLabel1, points, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MESH_EXISTING_VERTEX);
+	BOOST_CHECK_EQUAL(mesh2.properties.lVertices, 0);
+
+	status = mesh2.addVertex(1, points[0]);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int vertLabel2[3] = {2, 3, 1};
+	status = mesh2.addVertices(vertLabel2, points, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MESH_EXISTING_VERTEX);
+	BOOST_CHECK_EQUAL(mesh2.properties.lVertices, 1);
+}
+
+// Test 1: Bulk vertex insertion for the AoS and SoA meshes
+BOOST_AUTO_TEST_CASE(addVertices_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	checkAddVertices<CupCfdAoSMesh<int,double,int>>(comm);
+	checkAddVertices<CupCfdSoAMesh<int,double,int>>(comm);
+}
+
+// === addCells ===
+// Add sets of local and ghost cells, and check a repeated label leaves the mesh unchanged
+template <class M>
+void checkAddCells(cupcfd::comm::Communicator& comm)
+{
+	cupcfd::error::eCodes status;
+
+	M mesh(comm);
+
+	int cellLabel[5] = {4, 8, 2, 6, 0};
+	double vol[5] = {1.0, 2.0, 3.0, 4.0, 5.0};
+	cupcfd::geometry::euclidean::EuclideanPoint<double,3> center[5];
+
+	for(int i = 0; i < 5; i++) {
+		center[i] = cupcfd::geometry::euclidean::EuclideanPoint<double,3>(double(i), 0.0, 0.0);
+	}
+
+	status = mesh.addCells(cellLabel, center, vol, 3, true);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = mesh.addCells(cellLabel + 3, center + 3, vol + 3, 2, false);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(mesh.properties.lTCells, 5);
+	BOOST_CHECK_EQUAL(mesh.properties.lOCells, 3);
+	BOOST_CHECK_EQUAL(mesh.properties.lGhCells, 2);
+
+	for(int i = 0; i < 5; i++) {
+		int localID = mesh.getCellID(cellLabel[i]);
+		BOOST_CHECK_EQUAL(mesh.getCellVolume(localID), vol[i]);
+		BOOST_CHECK_EQUAL(mesh.getCellCenter(localID).cmp[0], double(i));
+		BOOST_CHECK_EQUAL(mesh.cellNFaces[localID], 0);
+		BOOST_CHECK_EQUAL(mesh.cellConnGraph->existsLocalNode(cellLabel[i]), i < 3);
+		BOOST_CHECK_EQUAL(mesh.cellConnGraph->existsGhostNode(cellLabel[i]), i >= 3);
+	}
+
+	// Error Check: Adding an existing cell leaves the mesh unchanged
+	int cellLabel2[2] = {10, 8};
+	status = mesh.addCells(cellLabel2, center, vol, 2, true);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MESH_EXISTING_CELL);
+	BOOST_CHECK_EQUAL(mesh.properties.lTCells, 5);
+	BOOST_CHECK_EQUAL(mesh.cellConnGraph->existsNode(10), false);
+}
+
+// Test 1: Bulk cell insertion for the AoS and SoA meshes
+BOOST_AUTO_TEST_CASE(addCells_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	checkAddCells<CupCfdAoSMesh<int,double,int>>(comm);
+	checkAddCells<CupCfdSoAMesh<int,double,int>>(comm);
+}
+
+// === addBoundaries ===
+// Add a set of boundaries with 3 and 4 vertices, and error check an invalid vertex count and region
+template <class M>
+void checkAddBoundaries(cupcfd::comm::Communicator& comm)
+{
+	cupcfd::error::eCodes status;
+
+	M mesh(comm);
+	cupcfd::geometry::euclidean::EuclideanPoint<double,3> points[5];
+
+	int vertLabel[5] = {10, 11, 12, 13, 14};
+	status = mesh.addVertices(vertLabel, points, 5);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::string regionName = "Default";
+	status = mesh.addRegion(7, regionName);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int bndLabel[2] = {3, 5};
+	int regionLabel[2] = {7, 7};
+	int vertXAdj[3] = {0, 3, 7};
+	int bndVertLabel[7] = {10, 11, 12, 11, 12, 13, 14};
+	double distance[2] = {0.25, 0.75};
+
+	status = mesh.addBoundaries(bndLabel, regionLabel, vertXAdj, bndVertLabel, distance, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(mesh.properties.lBoundaries, 2);
+
+	int localID = mesh.getBoundaryID(3);
+	BOOST_CHECK_EQUAL(mesh.getBoundaryFaceID(localID), -1);
+	BOOST_CHECK_EQUAL(mesh.getBoundaryRegionID(localID), 0);
+	BOOST_CHECK_EQUAL(mesh.getBoundaryDistance(localID), 0.25);
+	BOOST_CHECK_EQUAL(mesh.getBoundaryNVertices(localID), 3);
+	BOOST_CHECK_EQUAL(mesh.getBoundaryVertex(localID, 2), 2);
+
+	localID = mesh.getBoundaryID(5);
+	BOOST_CHECK_EQUAL(mesh.getBoundaryDistance(localID), 0.75);
+	BOOST_CHECK_EQUAL(mesh.getBoundaryNVertices(localID), 4);
+	BOOST_CHECK_EQUAL(mesh.getBoundaryVertex(localID, 0), 1);
+	BOOST_CHECK_EQUAL(mesh.getBoundaryVertex(localID, 3), 4);
+
+	// Error Check: Too few vertices for a boundary
+	int bndLabel2[2] = {8, 9};
+	int vertXAdj2[3] = {0, 3, 5};
+	int regionLabel2[2] = {7, 99};
+	status = mesh.addBoundaries(bndLabel2, regionLabel2, vertXAdj2, bndVertLabel, distance, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MESH_INVALID_VERTEX_COUNT);
+
+	// Error Check: Non-existing region label, reported for the first invalid boundary
+	vertXAdj2[2] = 6;
+	status = mesh.addBoundaries(bndLabel2, regionLabel2, vertXAdj2, bndVertLabel, distance, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MESH_INVALID_REGION_LABEL);
+	BOOST_CHECK_EQUAL(mesh.properties.lBoundaries, 2);
+}
+
+// Test 1: Bulk boundary insertion for the AoS and SoA meshes
+BOOST_AUTO_TEST_CASE(addBoundaries_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	checkAddBoundaries<CupCfdAoSMesh<int,double,int>>(comm);
+	checkAddBoundaries<CupCfdSoAMesh<int,double,int>>(comm);
+}
+
+// === addFaces ===
+// Add a set of interior and boundary faces, and check the cells, boundaries and graph are updated
+template <class M>
+void checkAddFaces(cupcfd::comm::Communicator& comm)
+{
+	cupcfd::error::eCodes status;
+
+	M mesh(comm);
+	cupcfd::geometry::euclidean::EuclideanPoint<double,3> points[4];
+	double zero[3] = {0.0, 0.0, 0.0};
+
+	int vertLabel[4] = {0, 1, 2, 3};
+	status = mesh.addVertices(vertLabel, points, 4);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int cellLabel[3] = {0, 1, 2};
+	status = mesh.addCells(cellLabel, points, zero, 3, true);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::string regionName = "Default";
+	status = mesh.addRegion(0, regionName);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int bndLabel[1] = {0};
+	int bndVertXAdj[2] = {0, 3};
+	status = mesh.addBoundaries(bndLabel, bndLabel, bndVertXAdj, vertLabel, zero, 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Faces 0-1 and 1-2, and a boundary face on cell 2
+	int faceLabel[3] = {5, 6, 7};
+	int cell1Label[3] = {0, 1, 2};
+	int cell2OrBoundaryLabel[3] = {1, 2, 0};
+	bool isBoundary[3] = {false, false, true};
+	double lambda[3] = {0.1, 0.2, 0.3};
+	double area[3] = {1.0, 2.0, 3.0};
+	cupcfd::geometry::euclidean::EuclideanVector3D<double> norm[3];
+	int faceVertXAdj[4] = {0, 3, 7, 10};
+	int faceVertLabel[10] = {0, 1, 2, 0, 1, 2, 3, 1, 2, 3};
+
+	status = mesh.addFaces(faceLabel, cell1Label, cell2OrBoundaryLabel, isBoundary, lambda, norm,
+						   faceVertXAdj, faceVertLabel, points, nullptr, nullptr, nullptr, area, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(mesh.properties.lFaces, 3);
+	BOOST_CHECK_EQUAL(mesh.cellNFaces[0], 1);
+	BOOST_CHECK_EQUAL(mesh.cellNFaces[1], 2);
+	BOOST_CHECK_EQUAL(mesh.cellNFaces[2], 2);
+
+	int faceID = mesh.getFaceID(6);
+	BOOST_CHECK_EQUAL(mesh.getFaceCell1ID(faceID), 1);
+	BOOST_CHECK_EQUAL(mesh.getFaceCell2ID(faceID), 2);
+	BOOST_CHECK_EQUAL(mesh.getFaceIsBoundary(faceID), false);
+	BOOST_CHECK_EQUAL(mesh.getFaceLambda(faceID), 0.2);
+	BOOST_CHECK_EQUAL(mesh.getFaceArea(faceID), 2.0);
+	BOOST_CHECK_EQUAL(mesh.getFaceNVertices(faceID), 4);
+	BOOST_CHECK_EQUAL(mesh.getFaceVertex(faceID, 3), 3);
+
+	faceID = mesh.getFaceID(7);
+	BOOST_CHECK_EQUAL(mesh.getFaceIsBoundary(faceID), true);
+	BOOST_CHECK_EQUAL(mesh.getFaceBoundaryID(faceID), 0);
+	BOOST_CHECK_EQUAL(mesh.getFaceNVertices(faceID), 3);
+	BOOST_CHECK_EQUAL(mesh.getBoundaryFaceID(0), faceID);
+
+	bool found;
+	status = mesh.cellConnGraph->existsEdge(2, 1, &found);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(found, true);
+
+	// Error Check: Two faces between the same cells, in the set or already in the mesh, leave the mesh unchanged
+	M mesh2(comm);
+
+	status = mesh2.addVertices(vertLabel, points, 4);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = mesh2.addCells(cellLabel, points, zero, 3, true);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int faceLabel2[2] = {0, 1};
+	int cell1Label2[2] = {0, 1};
+	int cell2Label2[2] = {1, 0};
+	bool isBoundary2[2] = {false, false};
+	int faceVertXAdj2[3] = {0, 3, 6};
+	int faceVertLabel2[6] = {0, 1, 2, 1, 2, 3};
+
+	status = mesh2.addFaces(faceLabel2, cell1Label2, cell2Label2, isBoundary2, zero, norm,
+							faceVertXAdj2, faceVertLabel2, points, nullptr, nullptr, nullptr, zero, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MESH_FACE_EDGE_EXISTS);
+	BOOST_CHECK_EQUAL(mesh2.properties.lFaces, 0);
+
+	status = mesh2.addFace(2, 1, 0, false, faceVertLabel2, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = mesh2.addFaces(faceLabel2, cell1Label2, cell2Label2, isBoundary2, zero, norm,
+							faceVertXAdj2, faceVertLabel2, points, nullptr, nullptr, nullptr, zero, 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MESH_FACE_EDGE_EXISTS);
+
+	// Error Check: Non-existing vertex label
+	faceVertLabel2[5] = 9;
+	cell2Label2[1] = 2;
+	status = mesh2.addFaces(faceLabel2, cell1Label2 + 1, cell2Label2 + 1, isBoundary2, zero, norm,
+							faceVertXAdj2 + 1, faceVertLabel2, points, nullptr, nullptr, nullptr, zero, 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MESH_INVALID_VERTEX_LABEL);
+	BOOST_CHECK_EQUAL(mesh2.properties.lFaces, 1);
+	BOOST_CHECK_EQUAL(mesh2.cellNFaces[1], 1);
+	BOOST_CHECK_EQUAL(mesh2.cellNFaces[2], 0);
+}
+
+// Test 1: Bulk face insertion for the AoS and SoA meshes
+BOOST_AUTO_TEST_CASE(addFaces_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	checkAddFaces<CupCfdAoSMesh<int,double,int>>(comm);
+	checkAddFaces<CupCfdSoAMesh<int,double,int>>(comm);
+}
+
 BOOST_AUTO_TEST_CASE(cleanup)
 {
     MPI_Finalize();
@@ -24,7 +24,7 @@ using namespace cupcfd::geometry::mesh;
 // Test 1: Test Default Constructor
 BOOST_AUTO_TEST_CASE(constructor_test1)
 {
-	UnstructuredMeshProperties<int, double> prop;
+	UnstructuredMeshProperties<int, double, int> prop;
 
 	// ToDo: Direct access should be replaced with getters and setters
 	BOOST_CHECK_EQUAL(prop.nCells, 0);
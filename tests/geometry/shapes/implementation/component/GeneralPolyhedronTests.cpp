@@ -0,0 +1,158 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the methods of the GeneralPolyhedron class
+ */
+
+
+#define BOOST_TEST_MODULE GeneralPolyhedron
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+#include <cmath>
+#include <vector>
+
+#include "GeneralPolyhedron.h"
+#include "EuclideanPoint.h"
+
+using namespace cupcfd::geometry::shapes;
+namespace euc = cupcfd::geometry::euclidean;
+namespace utf = boost::unit_test;
+
+// Build the faces of a prism with a regular hexagonal base of circumradius 2 centred at (1,2) in z = 0,
+// and height 3. The side faces alternate in orientation, since the ordering should not matter.
+void buildHexagonalPrism(std::vector<euc::EuclideanPoint<double,3>>& points, std::vector<int>& xadj) {
+	euc::EuclideanPoint<double,3> bottom[6];
+	euc::EuclideanPoint<double,3> top[6];
+
+	for(int i = 0; i < 6; i++) {
+		double angle = i * M_PI / 3.0;
+		bottom[i] = euc::EuclideanPoint<double,3>(1.0 + 2.0 * cos(angle), 2.0 + 2.0 * sin(angle), 0.0);
+		top[i] = euc::EuclideanPoint<double,3>(1.0 + 2.0 * cos(angle), 2.0 + 2.0 * sin(angle), 3.0);
+	}
+
+	points.clear();
+	xadj.assign(1, 0);
+
+	for(int i = 0; i < 6; i++) {
+		points.push_back(bottom[i]);
+	}
+	xadj.push_back((int) points.size());
+
+	for(int i = 0; i < 6; i++) {
+		points.push_back(top[i]);
+	}
+	xadj.push_back((int) points.size());
+
+	for(int i = 0; i < 6; i++) {
+		int j = (i + 1) % 6;
+
+		if(i % 2 == 0) {
+			points.push_back(bottom[i]);
+			points.push_back(bottom[j]);
+			points.push_back(top[j]);
+			points.push_back(top[i]);
+		}
+		else {
+			points.push_back(top[i]);
+			points.push_back(top[j]);
+			points.push_back(bottom[j]);
+			points.push_back(bottom[i]);
+		}
+		xadj.push_back((int) points.size());
+	}
+}
+
+// === Constructor ===
+// Test 1: Construct from the faces of a hexagonal prism
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	std::vector<euc::EuclideanPoint<double,3>> points;
+	std::vector<int> xadj;
+	buildHexagonalPrism(points, xadj);
+
+	GeneralPolyhedron<double> shape(points.data(), xadj.data(), 8);
+
+	BOOST_CHECK_EQUAL(shape.getNFaces(), 8);
+	BOOST_CHECK_EQUAL(shape.getFaceNVertices(0), 6);
+	BOOST_CHECK_EQUAL(shape.getFaceNVertices(1), 6);
+	BOOST_CHECK_EQUAL(shape.getFaceNVertices(2), 4);
+	BOOST_CHECK_EQUAL(shape.facePoints.size(), 36);
+}
+
+// Test 2: Construct from a subset of faces, with offsets that do not start at 0
+BOOST_AUTO_TEST_CASE(constructor_test2)
+{
+	std::vector<euc::EuclideanPoint<double,3>> points;
+	std::vector<int> xadj;
+	buildHexagonalPrism(points, xadj);
+
+	GeneralPolyhedron<double> shape(points.data(), xadj.data() + 1, 2);
+
+	BOOST_CHECK_EQUAL(shape.getNFaces(), 2);
+	BOOST_CHECK_EQUAL(shape.faceXAdj[0], 0);
+	BOOST_CHECK_EQUAL(shape.faceXAdj[1], 6);
+	BOOST_CHECK_EQUAL(shape.faceXAdj[2], 10);
+	BOOST_CHECK(shape.facePoints[0] == points[6]);
+}
+
+// === getVolume ===
+// Test 1: Volume of a hexagonal prism
+BOOST_AUTO_TEST_CASE(getVolume_test1, * utf::tolerance(0.00001))
+{
+	std::vector<euc::EuclideanPoint<double,3>> points;
+	std::vector<int> xadj;
+	buildHexagonalPrism(points, xadj);
+
+	GeneralPolyhedron<double> shape(points.data(), xadj.data(), 8);
+	BOOST_TEST(shape.getVolume() == 1.5 * sqrt(3.0) * 4.0 * 3.0);
+}
+
+// === getCentroid ===
+// Test 1: Centroid of a hexagonal prism
+BOOST_AUTO_TEST_CASE(getCentroid_test1, * utf::tolerance(0.00001))
+{
+	std::vector<euc::EuclideanPoint<double,3>> points;
+	std::vector<int> xadj;
+	buildHexagonalPrism(points, xadj);
+
+	GeneralPolyhedron<double> shape(points.data(), xadj.data(), 8);
+	euc::EuclideanPoint<double,3> centroid = shape.getCentroid();
+
+	BOOST_TEST(centroid.cmp[0] == 1.0);
+	BOOST_TEST(centroid.cmp[1] == 2.0);
+	BOOST_TEST(centroid.cmp[2] == 1.5);
+}
+
+// === isPointInside ===
+// Test 1: Points inside, outside and on the boundary of a hexagonal prism
+BOOST_AUTO_TEST_CASE(isPointInside_test1)
+{
+	std::vector<euc::EuclideanPoint<double,3>> points;
+	std::vector<int> xadj;
+	buildHexagonalPrism(points, xadj);
+
+	GeneralPolyhedron<double> shape(points.data(), xadj.data(), 8);
+
+	euc::EuclideanPoint<double,3> inside(1.5, 2.5, 1.0);
+	BOOST_CHECK_EQUAL(shape.isPointInside(inside), true);
+
+	// On the top face and on a vertex
+	euc::EuclideanPoint<double,3> onFace(1.0, 2.0, 3.0);
+	BOOST_CHECK_EQUAL(shape.isPointInside(onFace), true);
+	BOOST_CHECK_EQUAL(shape.isPointInside(points[0]), true);
+
+	// Above the top face
+	euc::EuclideanPoint<double,3> above(1.0, 2.0, 3.1);
+	BOOST_CHECK_EQUAL(shape.isPointInside(above), false);
+
+	// Inside the bounding box, but outside a side face
+	euc::EuclideanPoint<double,3> corner(2.9, 3.9, 1.0);
+	BOOST_CHECK_EQUAL(shape.isPointInside(corner), false);
+}
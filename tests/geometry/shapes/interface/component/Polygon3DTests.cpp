@@ -15,6 +15,7 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/output_test_stream.hpp>
 #include <stdexcept>
+#include <cmath>
 
 #include "Polygon3D.h"
 
@@ -57,3 +58,82 @@ BOOST_AUTO_TEST_CASE(isVertexOrderClockwise_test2, * utf::tolerance(0.00001))
 	bool dir = isVertexOrderClockwise(observation, points, 3);
 	BOOST_CHECK_EQUAL(dir, true);
 }
+
+// Regular hexagon of circumradius 2, centred at (1,2,3) in the plane z = 3, anti-clockwise from +z
+void buildHexagon(euc::EuclideanPoint<double,3> * points) {
+	for(int i = 0; i < 6; i++) {
+		double angle = i * M_PI / 3.0;
+		points[i] = euc::EuclideanPoint<double,3>(1.0 + 2.0 * cos(angle), 2.0 + 2.0 * sin(angle), 3.0);
+	}
+}
+
+// === computePolygonArea ===
+// Test 1: Area of a regular hexagon
+BOOST_AUTO_TEST_CASE(computePolygonArea_test1, * utf::tolerance(0.00001))
+{
+	euc::EuclideanPoint<double,3> points[6];
+	buildHexagon(points);
+
+	double area = computePolygonArea(points, 6);
+	BOOST_TEST(area == 1.5 * sqrt(3.0) * 4.0);
+}
+
+// Test 2: Error Case: Less than 3 points
+BOOST_AUTO_TEST_CASE(computePolygonArea_test2)
+{
+	euc::EuclideanPoint<double,3> points[6];
+	buildHexagon(points);
+
+	BOOST_CHECK_THROW({ double area = computePolygonArea(points, 2); (void) area; }, std::runtime_error);
+}
+
+// === computePolygonCentroid ===
+// Test 1: Centroid of a regular hexagon
+BOOST_AUTO_TEST_CASE(computePolygonCentroid_test1, * utf::tolerance(0.00001))
+{
+	euc::EuclideanPoint<double,3> points[6];
+	buildHexagon(points);
+
+	euc::EuclideanPoint<double,3> centroid = computePolygonCentroid(points, 6);
+	BOOST_TEST(centroid.cmp[0] == 1.0);
+	BOOST_TEST(centroid.cmp[1] == 2.0);
+	BOOST_TEST(centroid.cmp[2] == 3.0);
+}
+
+// Test 2: Centroid of a quadrilateral that is not a parallelogram is area weighted
+BOOST_AUTO_TEST_CASE(computePolygonCentroid_test2, * utf::tolerance(0.00001))
+{
+	euc::EuclideanPoint<double,3> points[4];
+	points[0] = euc::EuclideanPoint<double,3>(0.0, 0.0, 0.0);
+	points[1] = euc::EuclideanPoint<double,3>(4.0, 0.0, 0.0);
+	points[2] = euc::EuclideanPoint<double,3>(4.0, 2.0, 0.0);
+	points[3] = euc::EuclideanPoint<double,3>(0.0, 4.0, 0.0);
+
+	// Trapezium - rectangle (0,0)-(4,2) plus triangle (0,2),(4,2),(0,4)
+	euc::EuclideanPoint<double,3> centroid = computePolygonCentroid(points, 4);
+	BOOST_TEST(centroid.cmp[0] == (8.0 * 2.0 + 4.0 * (4.0 / 3.0)) / 12.0);
+	BOOST_TEST(centroid.cmp[1] == (8.0 * 1.0 + 4.0 * (8.0 / 3.0)) / 12.0);
+	BOOST_TEST(centroid.cmp[2] == 0.0);
+}
+
+// === computePolygonNormal ===
+// Test 1: Normal of a regular hexagon follows the vertex ordering
+BOOST_AUTO_TEST_CASE(computePolygonNormal_test1, * utf::tolerance(0.00001))
+{
+	euc::EuclideanPoint<double,3> points[6];
+	buildHexagon(points);
+
+	euc::EuclideanVector3D<double> normal = computePolygonNormal(points, 6);
+	BOOST_TEST(normal.cmp[0] == 0.0);
+	BOOST_TEST(normal.cmp[1] == 0.0);
+	BOOST_TEST(normal.cmp[2] == 1.0);
+
+	// Reverse the ordering
+	euc::EuclideanPoint<double,3> reversed[6];
+	for(int i = 0; i < 6; i++) {
+		reversed[i] = points[5 - i];
+	}
+
+	normal = computePolygonNormal(reversed, 6);
+	BOOST_TEST(normal.cmp[2] == -1.0);
+}
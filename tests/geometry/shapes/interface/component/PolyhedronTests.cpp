@@ -60,3 +60,40 @@ BOOST_AUTO_TEST_CASE(findPolyhedronType_test5, * utf::tolerance(0.00001))
 	PolyhedronType type = findPolyhedronType(14,23);
 	BOOST_CHECK_EQUAL(type, POLYHEDRON_UNKNOWN);
 }
+
+// Test 6: Fixed types are found when all faces are triangles or quadrilaterals
+BOOST_AUTO_TEST_CASE(findPolyhedronType_test6, * utf::tolerance(0.00001))
+{
+	BOOST_CHECK_EQUAL(findPolyhedronType(4,4,3), POLYHEDRON_TETRAHEDRON);
+	BOOST_CHECK_EQUAL(findPolyhedronType(6,5,4), POLYHEDRON_TRIPRISM);
+	BOOST_CHECK_EQUAL(findPolyhedronType(8,6,4), POLYHEDRON_HEXAHEDRON);
+}
+
+// Test 7: General Polyhedron - a face has more than 4 vertices, or the counts match no fixed type
+BOOST_AUTO_TEST_CASE(findPolyhedronType_test7, * utf::tolerance(0.00001))
+{
+	BOOST_CHECK_EQUAL(findPolyhedronType(12,8,6), POLYHEDRON_GENERAL);
+	BOOST_CHECK_EQUAL(findPolyhedronType(8,6,5), POLYHEDRON_GENERAL);
+	BOOST_CHECK_EQUAL(findPolyhedronType(14,23,4), POLYHEDRON_GENERAL);
+}
+
+// Test 8: Unknown Polyhedron - too few vertices or faces to enclose a volume
+BOOST_AUTO_TEST_CASE(findPolyhedronType_test8, * utf::tolerance(0.00001))
+{
+	BOOST_CHECK_EQUAL(findPolyhedronType(3,4,3), POLYHEDRON_UNKNOWN);
+	BOOST_CHECK_EQUAL(findPolyhedronType(6,3,4), POLYHEDRON_UNKNOWN);
+}
+
+// === getPolyhedronNFaces/getPolyhedronNVertices ===
+// Test 1: The counts of each fixed type are consistent with findPolyhedronType, and 0 otherwise
+BOOST_AUTO_TEST_CASE(getPolyhedronNFaces_test1, * utf::tolerance(0.00001))
+{
+	PolyhedronType types[4] = {POLYHEDRON_TETRAHEDRON, POLYHEDRON_QUADPYRAMID, POLYHEDRON_TRIPRISM, POLYHEDRON_HEXAHEDRON};
+
+	for(int i = 0; i < 4; i++) {
+		BOOST_CHECK_EQUAL(findPolyhedronType(getPolyhedronNVertices(types[i]), getPolyhedronNFaces(types[i])), types[i]);
+	}
+
+	BOOST_CHECK_EQUAL(getPolyhedronNFaces(POLYHEDRON_GENERAL), 0);
+	BOOST_CHECK_EQUAL(getPolyhedronNVertices(POLYHEDRON_UNKNOWN), 0);
+}
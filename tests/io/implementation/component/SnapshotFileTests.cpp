@@ -0,0 +1,176 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the SnapshotFile class
+ */
+
+#define BOOST_TEST_MODULE SnapshotFile
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+
+#include "SnapshotFile.h"
+#include "FlatHashMap.h"
+#include "Error.h"
+
+using namespace cupcfd::io;
+
+// === writeSection/readSection ===
+// Test 1: Sections are read back in order, aligned, along with the keys
+BOOST_AUTO_TEST_CASE(readSection_test1)
+{
+	cupcfd::error::eCodes status;
+	std::string fileName = "snapshot_test1.snap";
+
+	std::vector<int> ints = {1, 2, 3, 4, 5};
+	std::vector<double> doubles = {0.5, 1.5, 2.5};
+	std::vector<char> empty;
+
+	{
+		SnapshotFile file;
+		status = file.openWrite(fileName);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = file.writeVector(ints);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		status = file.writeVector(empty);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		status = file.writeArray(doubles.data(), doubles.size());
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		file.keys[0] = 42;
+		file.keys[7] = 7;
+		status = file.closeWrite();
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	SnapshotFile file;
+	status = file.openRead(fileName);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(file.keys[0], 42);
+	BOOST_CHECK_EQUAL(file.keys[1], 0);
+	BOOST_CHECK_EQUAL(file.keys[7], 7);
+
+	const void * data;
+	std::size_t nBytes;
+	status = file.readSection(&data, &nBytes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nBytes, 5 * sizeof(int));
+	BOOST_CHECK_EQUAL(((uintptr_t) data) % 64, 0);
+	BOOST_CHECK_EQUAL_COLLECTIONS((const int *) data, ((const int *) data) + 5, ints.begin(), ints.end());
+
+	std::vector<char> emptyCmp(3, 'a');
+	status = file.readVector(emptyCmp);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(emptyCmp.size(), 0);
+
+	std::vector<double> doublesCmp(3);
+	status = file.readArray(doublesCmp.data(), doublesCmp.size());
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(doublesCmp.begin(), doublesCmp.end(), doubles.begin(), doubles.end());
+
+	// No more sections
+	status = file.readSection(&data, &nBytes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_FILE_FORMAT);
+
+	file.closeRead();
+	remove(fileName.c_str());
+}
+
+// === writeMap/readMap, writeStrings/readStrings ===
+// Test 1: Maps and strings are restored
+BOOST_AUTO_TEST_CASE(readMap_test1)
+{
+	cupcfd::error::eCodes status;
+	std::string fileName = "snapshot_test2.snap";
+
+	cupcfd::data_structures::FlatHashMap<long, int> map;
+	for(int i = 0; i < 1000; i++) {
+		map[(long) i * 7919] = i;
+	}
+
+	std::vector<std::string> names = {"inlet", "", "wall"};
+
+	{
+		SnapshotFile file;
+		status = file.openWrite(fileName);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		status = file.writeMap(map);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		status = file.writeStrings(names);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		status = file.closeWrite();
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	SnapshotFile file;
+	status = file.openRead(fileName);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	cupcfd::data_structures::FlatHashMap<long, int> mapCmp;
+	mapCmp[5] = 5;
+	status = file.readMap(mapCmp);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(mapCmp.size(), 1000);
+	BOOST_CHECK(mapCmp.find(5) == mapCmp.end());
+
+	for(int i = 0; i < 1000; i++) {
+		BOOST_CHECK_EQUAL(mapCmp[(long) i * 7919], i);
+	}
+
+	std::vector<std::string> namesCmp;
+	status = file.readStrings(namesCmp);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(namesCmp.begin(), namesCmp.end(), names.begin(), names.end());
+
+	file.closeRead();
+	remove(fileName.c_str());
+}
+
+// === openRead ===
+// Test 1: Error Case: Missing file
+BOOST_AUTO_TEST_CASE(openRead_test1)
+{
+	SnapshotFile file;
+	cupcfd::error::eCodes status = file.openRead("snapshot_missing.snap");
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_FILE_MISSING);
+}
+
+// Test 2: Error Case: Not a snapshot file, or an unfinished one
+BOOST_AUTO_TEST_CASE(openRead_test2)
+{
+	cupcfd::error::eCodes status;
+	std::string fileName = "snapshot_test3.snap";
+
+	FILE * out = fopen(fileName.c_str(), "wb");
+	std::vector<char> junk(4096, 'x');
+	fwrite(junk.data(), 1, junk.size(), out);
+	fclose(out);
+
+	SnapshotFile file;
+	status = file.openRead(fileName);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_FILE_FORMAT);
+	remove(fileName.c_str());
+
+	// A file that is not closed is discarded, so never appears at the path
+	{
+		SnapshotFile unfinished;
+		status = unfinished.openWrite(fileName);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		status = unfinished.writeVector(junk);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	status = file.openRead(fileName);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_FILE_MISSING);
+}
@@ -0,0 +1,533 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the LinearSolverNative class
+ */
+
+#define BOOST_TEST_MODULE LinearSolverNative
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+#include <cstdlib>
+
+#include "Communicator.h"
+#include "LinearSolverNative.h"
+#include "Error.h"
+#include "SparseMatrixCOO.h"
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixSource.h"
+#include "DistributedSparseMatrix.h"
+
+// ========================================
+// ============== Tests ===================
+// ========================================
+
+namespace utf = boost::unit_test;
+using namespace cupcfd::linearsolvers;
+
+// Build the 5-point Laplacian of a nx * nx grid
+template <class C>
+void buildLaplacian(C& matrix, int nx) {
+	cupcfd::error::eCodes status;
+
+	for(int j = 0; j < nx; j++) {
+		for(int i = 0; i < nx; i++) {
+			int row = j * nx + i;
+
+			if(j > 0) {
+				status = matrix.setElement(row, row - nx, -1.0);
+				BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+			}
+
+			if(i > 0) {
+				status = matrix.setElement(row, row - 1, -1.0);
+				BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+			}
+
+			status = matrix.setElement(row, row, 4.0);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+			if(i < nx - 1) {
+				status = matrix.setElement(row, row + 1, -1.0);
+				BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+			}
+
+			if(j < nx - 1) {
+				status = matrix.setElement(row, row + nx, -1.0);
+				BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+			}
+		}
+	}
+}
+
+// Matrix source backed by an existing matrix, so a distributed matrix can be built without a mesh
+class MatrixSource : public cupcfd::data_structures::SparseMatrixSource<int, double>
+{
+	public:
+		cupcfd::data_structures::SparseMatrixCSR<int, double>& matrix;
+
+		MatrixSource(cupcfd::data_structures::SparseMatrixCSR<int, double>& matrix)
+		:matrix(matrix) {
+		}
+
+		cupcfd::error::eCodes getNNZ(int * nnz) {
+			*nnz = this->matrix.nnz;
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes getNRows(int * nRows) {
+			*nRows = this->matrix.m;
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes getNCols(int * nCols) {
+			*nCols = this->matrix.n;
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes getMatrixIndicesBase(int * indicesBase) {
+			*indicesBase = this->matrix.baseIndex;
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes getNNZRows(int * rowIndices, int nRowIndices) {
+			for(int i = 0; i < nRowIndices; i++) {
+				rowIndices[i] = this->matrix.IA[i + 1] - this->matrix.IA[i];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes getRowColumnIndexes(int rowIndex, int ** columnIndexes, int * nColumnIndexes) {
+			return this->matrix.getRowColumnIndexes(rowIndex, columnIndexes, nColumnIndexes);
+		}
+
+		cupcfd::error::eCodes getRowNNZValues(int rowIndex, double ** nnzValues, int * nNNZValues) {
+			return this->matrix.getRowNNZValues(rowIndex, nnzValues, nNNZValues);
+		}
+};
+
+// Solve a 8x8 grid Laplacian with a known solution and check the result
+template <class C>
+void solveAndCheck(NativeAlgorithm alg, NativePreconditioner precon) {
+	cupcfd::comm::Communicator comm;
+	cupcfd::error::eCodes status;
+
+	int nx = 8;
+	int n = nx * nx;
+
+	C matrix(n, n, 0);
+	buildLaplacian(matrix, nx);
+
+	LinearSolverNative<C, int, double> solver(comm, alg, precon, 1e-12, 1e-14, 5000, matrix);
+
+	status = solver.setValuesMatrixA(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// b = A * xRef where xRef = 1..n
+	double * xRef = (double *) malloc(sizeof(double) * n);
+	double * bVals = (double *) malloc(sizeof(double) * n);
+	int * indexes = (int *) malloc(sizeof(int) * n);
+
+	for(int i = 0; i < n; i++) {
+		xRef[i] = 1.0 + i;
+		indexes[i] = i;
+	}
+
+	solver.multiply(xRef, bVals);
+
+	status = solver.setValuesVectorB(bVals, n, indexes, n, 0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.clearVectorX();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.solve();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK(solver.iterations > 0);
+	BOOST_CHECK(solver.iterations < 5000);
+
+	double * result;
+	int nResult;
+	status = solver.getValuesVectorX(&result, &nResult);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nResult, n);
+
+	for(int i = 0; i < n; i++) {
+		BOOST_CHECK_CLOSE(result[i], xRef[i], 1e-6);
+	}
+
+	free(xRef);
+	free(bVals);
+	free(indexes);
+	free(result);
+}
+
+// Setup
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+
+    MPI_Init(&argc, &argv);
+}
+
+// === Constructors ===
+// Test 1: Internal structure is copied from a COO matrix
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	cupcfd::comm::Communicator comm;
+
+	cupcfd::data_structures::SparseMatrixCOO<int, double> matrix(16, 16, 0);
+	buildLaplacian(matrix, 4);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCOO<int, double>, int, double> solver(comm, NATIVE_KSP_CG, NATIVE_PC_NONE, 1e-6, 1e-6, 100, matrix);
+
+	BOOST_CHECK_EQUAL(solver.a.m, 16);
+	BOOST_CHECK_EQUAL(solver.a.n, 16);
+	BOOST_CHECK_EQUAL(solver.a.nnz, 64);
+	BOOST_CHECK_EQUAL(solver.x.size(), 16);
+	BOOST_CHECK_EQUAL(solver.b.size(), 16);
+	BOOST_CHECK(solver.precon == nullptr);
+
+	// Values are not transferred by the constructor
+	for(int i = 0; i < solver.a.nnz; i++) {
+		BOOST_CHECK_EQUAL(solver.a.A[i], 0.0);
+	}
+}
+
+// === setValuesMatrixA ===
+// Test 1: Error Case: Entry outside of the setup non-zero structure
+BOOST_AUTO_TEST_CASE(setValuesMatrixA_test1)
+{
+	cupcfd::comm::Communicator comm;
+	cupcfd::error::eCodes status;
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(16, 16, 0);
+	buildLaplacian(matrix, 4);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, NATIVE_KSP_CG, NATIVE_PC_ILU0, 1e-6, 1e-6, 100, matrix);
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix2(16, 16, 0);
+	buildLaplacian(matrix2, 4);
+	status = matrix2.setElement(0, 15, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.setValuesMatrixA(matrix2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX);
+}
+
+// Test 2: Values are copied directly from the local rows of a distributed matrix,
+// matching the values set from the same rows in global form
+BOOST_AUTO_TEST_CASE(setValuesMatrixA_test2)
+{
+	cupcfd::comm::Communicator comm;
+	cupcfd::error::eCodes status;
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> laplacian(16, 16, 0);
+	buildLaplacian(laplacian, 4);
+	MatrixSource source(laplacian);
+
+	cupcfd::data_structures::DistributedSparseMatrix<int, double> matrix(comm);
+	status = matrix.build(source, 0, 16);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, NATIVE_KSP_CG, NATIVE_PC_ILU0, 1e-6, 1e-6, 100, matrix);
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> reference(comm, NATIVE_KSP_CG, NATIVE_PC_ILU0, 1e-6, 1e-6, 100, matrix);
+
+	status = solver.setValuesMatrixA(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> global(16, 16, 0);
+	status = matrix.copyToGlobal(global);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = reference.setValuesMatrixA(global);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(solver.a.nnz, 64);
+
+	for(int i = 0; i < solver.a.nnz; i++) {
+		BOOST_CHECK_EQUAL(solver.a.A[i], matrix.local.A[i]);
+		BOOST_CHECK_EQUAL(solver.a.A[i], reference.a.A[i]);
+	}
+
+	for(int i = 0; i < solver.aOwned.nnz; i++) {
+		BOOST_CHECK_EQUAL(solver.aOwned.A[i], reference.aOwned.A[i]);
+	}
+
+	// Error Case: the solver was setup from a different non-zero structure
+	cupcfd::data_structures::SparseMatrixCSR<int, double> other(16, 16, 0);
+	buildLaplacian(other, 4);
+	status = other.setElement(15, 0, -1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> otherSolver(comm, NATIVE_KSP_CG, NATIVE_PC_NONE, 1e-6, 1e-6, 100, other);
+
+	status = otherSolver.setValuesMatrixA(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX);
+}
+
+// === solve ===
+// Test 1: Unpreconditioned CG
+BOOST_AUTO_TEST_CASE(solve_test1)
+{
+	solveAndCheck<cupcfd::data_structures::SparseMatrixCSR<int, double>>(NATIVE_KSP_CG, NATIVE_PC_NONE);
+}
+
+// Test 2: CG with a multicolour SGS preconditioner
+BOOST_AUTO_TEST_CASE(solve_test2)
+{
+	solveAndCheck<cupcfd::data_structures::SparseMatrixCSR<int, double>>(NATIVE_KSP_CG, NATIVE_PC_SGS_MULTICOLOUR);
+}
+
+// Test 3: CG with an ILU(0) preconditioner
+BOOST_AUTO_TEST_CASE(solve_test3)
+{
+	solveAndCheck<cupcfd::data_structures::SparseMatrixCOO<int, double>>(NATIVE_KSP_CG, NATIVE_PC_ILU0);
+}
+
+// Test 4: Richardson with a multicolour SGS smoother
+BOOST_AUTO_TEST_CASE(solve_test4)
+{
+	solveAndCheck<cupcfd::data_structures::SparseMatrixCSR<int, double>>(NATIVE_KSP_RICHARDSON, NATIVE_PC_SGS_MULTICOLOUR);
+}
+
+// Test 5: Richardson with an ILU(0) smoother
+BOOST_AUTO_TEST_CASE(solve_test5)
+{
+	solveAndCheck<cupcfd::data_structures::SparseMatrixCSR<int, double>>(NATIVE_KSP_RICHARDSON, NATIVE_PC_ILU0);
+}
+
+// Test 6: Preconditioning reduces the number of CG iterations
+BOOST_AUTO_TEST_CASE(solve_test6)
+{
+	cupcfd::comm::Communicator comm;
+	cupcfd::error::eCodes status;
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(256, 256, 0);
+	buildLaplacian(matrix, 16);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> plain(comm, NATIVE_KSP_CG, NATIVE_PC_NONE, 1e-8, 1e-14, 1000, matrix);
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> ilu(comm, NATIVE_KSP_CG, NATIVE_PC_ILU0, 1e-8, 1e-14, 1000, matrix);
+
+	status = plain.setValuesMatrixA(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = ilu.setValuesMatrixA(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = plain.setValuesVectorB(1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = ilu.setValuesVectorB(1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = plain.solve();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = ilu.solve();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK(ilu.iterations < plain.iterations);
+}
+
+// Test 7: Mixed-precision refinement reaches a double precision tolerance
+BOOST_AUTO_TEST_CASE(solve_test7)
+{
+	cupcfd::comm::Communicator comm;
+	cupcfd::error::eCodes status;
+
+	int nx = 16;
+	int n = nx * nx;
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(n, n, 0);
+	buildLaplacian(matrix, nx);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, NATIVE_KSP_CG, NATIVE_PC_ILU0, 1e-12, 0.0, 1000,
+																							   true, 50, 1e-4, matrix);
+
+	BOOST_CHECK(solver.inner != nullptr);
+	BOOST_CHECK(solver.precon == nullptr);
+
+	status = solver.setValuesMatrixA(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < solver.a.nnz; i++) {
+		BOOST_CHECK_EQUAL(solver.inner->a.A[i], float(solver.a.A[i]));
+	}
+
+	status = solver.setValuesVectorB(1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.solve();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Single precision alone cannot reach a relative residual of 1e-12
+	BOOST_CHECK(solver.refinementSteps > 1);
+	BOOST_CHECK(solver.refinementSteps < 50);
+	BOOST_CHECK(solver.residualNorm <= 1e-12 * double(nx));
+
+	int iterations, refinementSteps;
+	status = solver.getSolveStatistics(&iterations, &refinementSteps);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(refinementSteps, solver.refinementSteps);
+	BOOST_CHECK(iterations > 0);
+}
+
+// === getSolveStatistics ===
+// Test 1: No refinement steps are reported outside of mixed precision
+BOOST_AUTO_TEST_CASE(getSolveStatistics_test1)
+{
+	cupcfd::comm::Communicator comm;
+	cupcfd::error::eCodes status;
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(16, 16, 0);
+	buildLaplacian(matrix, 4);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, NATIVE_KSP_CG, NATIVE_PC_NONE, 1e-10, 0.0, 100, matrix);
+
+	status = solver.setValuesMatrixA(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = solver.setValuesVectorB(1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = solver.solve();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int iterations, refinementSteps;
+	status = solver.getSolveStatistics(&iterations, &refinementSteps);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(iterations, solver.iterations);
+	BOOST_CHECK_EQUAL(refinementSteps, 0);
+}
+
+// Solve three right-hand-sides with known solutions as a block and check the results
+void solveMultiAndCheck(NativeAlgorithm alg, NativePreconditioner precon) {
+	cupcfd::comm::Communicator comm;
+	cupcfd::error::eCodes status;
+
+	int nx = 8;
+	int n = nx * nx;
+	int nRHS = 3;
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(n, n, 0);
+	buildLaplacian(matrix, nx);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, alg, precon, 1e-12, 1e-14, 5000, matrix);
+
+	status = solver.setValuesMatrixA(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double * xRef[3];
+	double * bVals[3];
+	int * indexes = (int *) malloc(sizeof(int) * n);
+
+	for(int i = 0; i < n; i++) {
+		indexes[i] = i;
+	}
+
+	for(int k = 0; k < nRHS; k++) {
+		xRef[k] = (double *) malloc(sizeof(double) * n);
+		bVals[k] = (double *) malloc(sizeof(double) * n);
+
+		for(int i = 0; i < n; i++) {
+			xRef[k][i] = 1.0 + i * (k + 1) + 0.5 * k;
+		}
+
+		solver.multiply(xRef[k], bVals[k]);
+	}
+
+	status = solver.setValuesVectorsB(bVals, nRHS, n, indexes, n, 0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.solveMulti();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double * results[3];
+	int nResult;
+	status = solver.getValuesVectorsX(results, nRHS, &nResult);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nResult, n);
+
+	for(int k = 0; k < nRHS; k++) {
+		for(int i = 0; i < n; i++) {
+			BOOST_CHECK_CLOSE(results[k][i], xRef[k][i], 1e-6);
+		}
+
+		free(results[k]);
+		free(xRef[k]);
+		free(bVals[k]);
+	}
+
+	free(indexes);
+}
+
+// === solveMulti ===
+// Test 1: Block CG with shared matrix products
+BOOST_AUTO_TEST_CASE(solveMulti_test1)
+{
+	solveMultiAndCheck(NATIVE_KSP_CG, NATIVE_PC_NONE);
+}
+
+// Test 2: Block CG with an ILU(0) preconditioner
+BOOST_AUTO_TEST_CASE(solveMulti_test2)
+{
+	solveMultiAndCheck(NATIVE_KSP_CG, NATIVE_PC_ILU0);
+}
+
+// Test 3: Richardson falls back to solving each right-hand-side in turn
+BOOST_AUTO_TEST_CASE(solveMulti_test3)
+{
+	solveMultiAndCheck(NATIVE_KSP_RICHARDSON, NATIVE_PC_SGS_MULTICOLOUR);
+}
+
+// Test 4: Error Case: No right-hand-sides set
+BOOST_AUTO_TEST_CASE(solveMulti_test4)
+{
+	cupcfd::comm::Communicator comm;
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(16, 16, 0);
+	buildLaplacian(matrix, 4);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, NATIVE_KSP_CG, NATIVE_PC_NONE, 1e-10, 0.0, 100, matrix);
+
+	cupcfd::error::eCodes status = solver.solveMulti();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR);
+}
+
+// === setValuesVectorsX ===
+// Test 1: Error Case: Number of right-hand-sides does not match
+BOOST_AUTO_TEST_CASE(setValuesVectorsX_test1)
+{
+	cupcfd::comm::Communicator comm;
+	cupcfd::error::eCodes status;
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(16, 16, 0);
+	buildLaplacian(matrix, 4);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, NATIVE_KSP_CG, NATIVE_PC_NONE, 1e-10, 0.0, 100, matrix);
+
+	double vals[2][16];
+	double * ptrs[2] = {vals[0], vals[1]};
+	int indexes[16];
+
+	for(int i = 0; i < 16; i++) {
+		indexes[i] = i;
+		vals[0][i] = 1.0;
+		vals[1][i] = 2.0;
+	}
+
+	status = solver.setValuesVectorsB(ptrs, 2, 16, indexes, 16, 0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.setValuesVectorsX(ptrs, 1, 16, indexes, 16, 0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+}
+
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    MPI_Finalize();
+}
@@ -0,0 +1,193 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the PreconditionerILU0 class
+ */
+
+#define BOOST_TEST_MODULE PreconditionerILU0
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+#include <vector>
+
+#include "PreconditionerILU0.h"
+#include "Error.h"
+#include "SparseMatrixCSR.h"
+
+// ========================================
+// ============== Tests ===================
+// ========================================
+
+namespace utf = boost::unit_test;
+using namespace cupcfd::linearsolvers;
+
+// Build a nonsymmetric tridiagonal matrix - ILU(0) of a tridiagonal matrix is its exact LU factorisation
+void buildTridiagonal(cupcfd::data_structures::SparseMatrixCSR<int, double>& matrix, int n) {
+	cupcfd::error::eCodes status;
+
+	for(int i = 0; i < n; i++) {
+		if(i > 0) {
+			status = matrix.setElement(i, i - 1, -1.0);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+
+		status = matrix.setElement(i, i, 3.0 + 0.1 * i);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		if(i < n - 1) {
+			status = matrix.setElement(i, i + 1, -0.5);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+	}
+}
+
+// === setup ===
+// Test 1: Level schedules of a diagonal matrix contain a single level
+BOOST_AUTO_TEST_CASE(setup_test1)
+{
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(6, 6, 0);
+	cupcfd::error::eCodes status;
+
+	for(int i = 0; i < 6; i++) {
+		status = matrix.setElement(i, i, 2.0);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	PreconditionerILU0<int, double> precon;
+	status = precon.setup(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(precon.nLowerLevels, 1);
+	BOOST_CHECK_EQUAL(precon.nUpperLevels, 1);
+	BOOST_CHECK_EQUAL(precon.lowerLevelXAdj[1], 6);
+	BOOST_CHECK_EQUAL(precon.upperLevelXAdj[1], 6);
+}
+
+// Test 2: Level schedules of a tridiagonal matrix are fully sequential
+BOOST_AUTO_TEST_CASE(setup_test2)
+{
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(6, 6, 0);
+	buildTridiagonal(matrix, 6);
+
+	PreconditionerILU0<int, double> precon;
+	cupcfd::error::eCodes status = precon.setup(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(precon.nLowerLevels, 6);
+	BOOST_CHECK_EQUAL(precon.nUpperLevels, 6);
+
+	for(int l = 0; l < 6; l++) {
+		BOOST_CHECK_EQUAL(precon.lowerLevelRows[l], l);
+		BOOST_CHECK_EQUAL(precon.upperLevelRows[l], 5 - l);
+	}
+}
+
+// Test 3: Error Case: Missing diagonal entry
+BOOST_AUTO_TEST_CASE(setup_test3)
+{
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(3, 3, 0);
+	cupcfd::error::eCodes status;
+
+	status = matrix.setElement(0, 0, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(1, 2, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(2, 2, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	PreconditionerILU0<int, double> precon;
+	status = precon.setup(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX);
+}
+
+// === update ===
+// Test 1: Error Case: Zero pivot
+BOOST_AUTO_TEST_CASE(update_test1)
+{
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(2, 2, 0);
+	cupcfd::error::eCodes status;
+
+	// [1 1; 1 1] has a zero second pivot
+	status = matrix.setElement(0, 0, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(0, 1, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(1, 0, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(1, 1, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	PreconditionerILU0<int, double> precon;
+	status = precon.setup(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = precon.update();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_LINEARSOLVER_ZERO_PIVOT);
+}
+
+// === apply ===
+// Test 1: ILU(0) of a tridiagonal matrix is exact, so apply solves Az = r
+BOOST_AUTO_TEST_CASE(apply_test1)
+{
+	int n = 10;
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(n, n, 0);
+	buildTridiagonal(matrix, n);
+
+	PreconditionerILU0<int, double> precon;
+	cupcfd::error::eCodes status = precon.setup(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = precon.update();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<double> r(n);
+	std::vector<double> z(n);
+	for(int i = 0; i < n; i++) {
+		r[i] = 1.0 + i;
+	}
+
+	status = precon.apply(&(r[0]), n, &(z[0]), n);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < n; i++) {
+		double sum = 0.0;
+		for(int j = matrix.IA[i]; j < matrix.IA[i+1]; j++) {
+			sum = sum + matrix.A[j] * z[matrix.JA[j]];
+		}
+		BOOST_CHECK_CLOSE(sum, r[i], 1e-10);
+	}
+}
+
+// === smooth ===
+// Test 1: A single sweep from zero solves a tridiagonal system
+BOOST_AUTO_TEST_CASE(smooth_test1)
+{
+	int n = 10;
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(n, n, 0);
+	buildTridiagonal(matrix, n);
+
+	PreconditionerILU0<int, double> precon;
+	cupcfd::error::eCodes status = precon.setup(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = precon.update();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<double> b(n, 1.0);
+	std::vector<double> x(n, 0.0);
+
+	status = precon.smooth(&(b[0]), n, &(x[0]), n, 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < n; i++) {
+		double sum = 0.0;
+		for(int j = matrix.IA[i]; j < matrix.IA[i+1]; j++) {
+			sum = sum + matrix.A[j] * x[matrix.JA[j]];
+		}
+		BOOST_CHECK_CLOSE(sum, 1.0, 1e-10);
+	}
+}
@@ -0,0 +1,251 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the PreconditionerSGSMulticolour class
+ */
+
+#define BOOST_TEST_MODULE PreconditionerSGSMulticolour
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+#include <vector>
+#include <cmath>
+
+#include "PreconditionerSGSMulticolour.h"
+#include "Error.h"
+#include "SparseMatrixCSR.h"
+
+// ========================================
+// ============== Tests ===================
+// ========================================
+
+namespace utf = boost::unit_test;
+using namespace cupcfd::linearsolvers;
+
+// Build the 5-point Laplacian of a nx * nx grid
+void buildLaplacian(cupcfd::data_structures::SparseMatrixCSR<int, double>& matrix, int nx) {
+	cupcfd::error::eCodes status;
+
+	for(int j = 0; j < nx; j++) {
+		for(int i = 0; i < nx; i++) {
+			int row = j * nx + i;
+
+			if(j > 0) {
+				status = matrix.setElement(row, row - nx, -1.0);
+				BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+			}
+
+			if(i > 0) {
+				status = matrix.setElement(row, row - 1, -1.0);
+				BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+			}
+
+			status = matrix.setElement(row, row, 4.0);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+			if(i < nx - 1) {
+				status = matrix.setElement(row, row + 1, -1.0);
+				BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+			}
+
+			if(j < nx - 1) {
+				status = matrix.setElement(row, row + nx, -1.0);
+				BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+			}
+		}
+	}
+}
+
+// === setup ===
+// Test 1: The automatic colouring of a 5-point Laplacian is valid
+BOOST_AUTO_TEST_CASE(setup_test1)
+{
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(16, 16, 0);
+	buildLaplacian(matrix, 4);
+
+	PreconditionerSGSMulticolour<int, double> precon;
+	cupcfd::error::eCodes status = precon.setup(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// A greedy colouring of a structured grid in natural order is a red-black colouring
+	BOOST_CHECK_EQUAL(precon.nColours, 2);
+	BOOST_CHECK_EQUAL(precon.colourXAdj[precon.nColours], 16);
+
+	std::vector<int> colours(16, -1);
+	for(int c = 0; c < precon.nColours; c++) {
+		for(int ptr = precon.colourXAdj[c]; ptr < precon.colourXAdj[c+1]; ptr++) {
+			colours[precon.colourRows[ptr]] = c;
+		}
+	}
+
+	// No two coupled rows share a colour
+	for(int i = 0; i < 16; i++) {
+		BOOST_CHECK(colours[i] >= 0);
+
+		for(int j = matrix.IA[i]; j < matrix.IA[i+1]; j++) {
+			if(matrix.JA[j] != i) {
+				BOOST_CHECK(colours[i] != colours[matrix.JA[j]]);
+			}
+		}
+	}
+}
+
+// Test 2: Error Case: Non-square matrix
+BOOST_AUTO_TEST_CASE(setup_test2)
+{
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(4, 5, 0);
+	cupcfd::error::eCodes status;
+
+	for(int i = 0; i < 4; i++) {
+		status = matrix.setElement(i, i, 1.0);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	PreconditionerSGSMulticolour<int, double> precon;
+	status = precon.setup(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX);
+}
+
+// === setColouring ===
+// Test 1: A user supplied colouring is retained by setup
+BOOST_AUTO_TEST_CASE(setColouring_test1)
+{
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(16, 16, 0);
+	buildLaplacian(matrix, 4);
+
+	// Four colours, by (i % 2, j % 2)
+	int colours[16];
+	for(int j = 0; j < 4; j++) {
+		for(int i = 0; i < 4; i++) {
+			colours[j * 4 + i] = (j % 2) * 2 + (i % 2);
+		}
+	}
+
+	PreconditionerSGSMulticolour<int, double> precon;
+	cupcfd::error::eCodes status = precon.setColouring(colours, 16);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = precon.setup(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(precon.nColours, 4);
+	for(int c = 0; c < 4; c++) {
+		BOOST_CHECK_EQUAL(precon.colourXAdj[c+1] - precon.colourXAdj[c], 4);
+	}
+}
+
+// === update ===
+// Test 1: Error Case: Zero diagonal
+BOOST_AUTO_TEST_CASE(update_test1)
+{
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(3, 3, 0);
+	cupcfd::error::eCodes status;
+
+	double diag[3] = {2.0, 0.0, 2.0};
+	for(int i = 0; i < 3; i++) {
+		if(i > 0) {
+			status = matrix.setElement(i, i - 1, -1.0);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+
+		status = matrix.setElement(i, i, diag[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		if(i < 2) {
+			status = matrix.setElement(i, i + 1, -1.0);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+	}
+
+	PreconditionerSGSMulticolour<int, double> precon;
+	status = precon.setup(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = precon.update();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_LINEARSOLVER_ZERO_PIVOT);
+}
+
+// === apply ===
+// Test 1: A diagonal matrix is inverted exactly
+BOOST_AUTO_TEST_CASE(apply_test1)
+{
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(4, 4, 0);
+	cupcfd::error::eCodes status;
+
+	double diag[4] = {2.0, 4.0, 5.0, 8.0};
+	for(int i = 0; i < 4; i++) {
+		status = matrix.setElement(i, i, diag[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	PreconditionerSGSMulticolour<int, double> precon;
+	status = precon.setup(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = precon.update();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double r[4] = {1.0, 1.0, 1.0, 1.0};
+	double z[4];
+
+	status = precon.apply(r, 4, z, 4);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < 4; i++) {
+		BOOST_CHECK_CLOSE(z[i], 1.0 / diag[i], 1e-10);
+	}
+}
+
+// Test 2: Error Case: Mismatched array sizes
+BOOST_AUTO_TEST_CASE(apply_test2)
+{
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(16, 16, 0);
+	buildLaplacian(matrix, 4);
+
+	PreconditionerSGSMulticolour<int, double> precon;
+	cupcfd::error::eCodes status = precon.setup(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = precon.update();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double r[16];
+	double z[16];
+	status = precon.apply(r, 15, z, 16);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+}
+
+// === smooth ===
+// Test 1: Sweeps reduce the residual of a 5-point Laplacian
+BOOST_AUTO_TEST_CASE(smooth_test1)
+{
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(16, 16, 0);
+	buildLaplacian(matrix, 4);
+
+	PreconditionerSGSMulticolour<int, double> precon;
+	cupcfd::error::eCodes status = precon.setup(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = precon.update();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<double> b(16, 1.0);
+	std::vector<double> x(16, 0.0);
+
+	status = precon.smooth(&(b[0]), 16, &(x[0]), 16, 50);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double resNorm = 0.0;
+	for(int i = 0; i < 16; i++) {
+		double sum = b[i];
+		for(int j = matrix.IA[i]; j < matrix.IA[i+1]; j++) {
+			sum = sum - matrix.A[j] * x[matrix.JA[j]];
+		}
+		resNorm = resNorm + sum * sum;
+	}
+
+	BOOST_CHECK(sqrt(resNorm) < 1e-8);
+}
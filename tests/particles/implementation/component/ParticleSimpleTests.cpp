@@ -179,7 +179,7 @@ BOOST_AUTO_TEST_CASE(updatePosition_test1, * utf::tolerance(0.00001))
 		// === Create a small test mesh ===
 		// Setup the configurations
 		cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-		cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+		cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 		cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 		// Build the mesh
@@ -229,7 +229,7 @@ BOOST_AUTO_TEST_CASE(updatePosition_test2, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -280,7 +280,7 @@ BOOST_AUTO_TEST_CASE(updatePosition_test3, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -341,7 +341,7 @@ BOOST_AUTO_TEST_CASE(updatePosition_test4, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -398,7 +398,7 @@ BOOST_AUTO_TEST_CASE(updateVelocityAtomic_test1, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -448,7 +448,7 @@ BOOST_AUTO_TEST_CASE(updateVelocityAtomic_test2, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -498,7 +498,7 @@ BOOST_AUTO_TEST_CASE(updateVelocityAtomic_test3, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -564,7 +564,7 @@ BOOST_AUTO_TEST_CASE(updateNonBoundaryFace_test1, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -609,7 +609,7 @@ BOOST_AUTO_TEST_CASE(updateNonBoundaryFace_test2, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -674,7 +674,7 @@ BOOST_AUTO_TEST_CASE(updateNonBoundaryFace_test3, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -724,7 +724,7 @@ BOOST_AUTO_TEST_CASE(updateBoundaryFaceWall_test1, * utf::tolerance(0.00001))
 		// === Create a small test mesh ===
 		// Setup the configurations
 		cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-		cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+		cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 		cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 		// Build the mesh
@@ -71,7 +71,7 @@ BOOST_AUTO_TEST_CASE(constructor_test1)
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -96,7 +96,7 @@ BOOST_AUTO_TEST_CASE(addParticle_test1, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -134,7 +134,7 @@ BOOST_AUTO_TEST_CASE(addParticleEmitter_test1, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -182,7 +182,7 @@ BOOST_AUTO_TEST_CASE(removeInactiveParticles_test1, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -255,7 +255,7 @@ BOOST_AUTO_TEST_CASE(exchangeParticles_test1)
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -353,7 +353,7 @@ BOOST_AUTO_TEST_CASE(updateSystem_test1, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -397,7 +397,7 @@ BOOST_AUTO_TEST_CASE(updateSystem_test2, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -460,7 +460,7 @@ BOOST_AUTO_TEST_CASE(updateSystem_test3, * utf::tolerance(0.00001))
 	// === Create a small test mesh ===
 	// Setup the configurations
 	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
-	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double, int> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
 	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
 
 	// Build the mesh
@@ -18,6 +18,7 @@
 #include <stdexcept>
 
 #include "PartitionerMetisConfig.h"
+#include "PartitionerNaiveConfig.h"
 #include "Error.h"
 #include "PartitionerInterface.h"
 
@@ -56,6 +57,24 @@ BOOST_AUTO_TEST_CASE(buildPartitioner_test1, * utf::tolerance(0.00001))
 	delete part;
 }
 
+// === getConfigHash ===
+// Test 1: The hash differs from that of a different partitioning method
+BOOST_AUTO_TEST_CASE(getConfigHash_test1)
+{
+	cupcfd::error::eCodes status;
+	PartitionerMetisConfig<int,int> config;
+	PartitionerNaiveConfig<int,int> naiveConfig;
+	uint64_t hash;
+	uint64_t naiveHash;
+
+	status = config.getConfigHash(&hash);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = naiveConfig.getConfigHash(&naiveHash);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK(hash != naiveHash);
+}
+
 // ======= Cleanup ========
 // Finalize MPI
 BOOST_AUTO_TEST_CASE(cleanup)
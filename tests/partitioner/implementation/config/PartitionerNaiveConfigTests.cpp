@@ -62,6 +62,24 @@ BOOST_AUTO_TEST_CASE(buildPartitioner_test2, * utf::tolerance(0.00001))
 
 }
 
+// === getConfigHash ===
+// Test 1: The hash is the same for configurations with the same settings
+BOOST_AUTO_TEST_CASE(getConfigHash_test1)
+{
+	cupcfd::error::eCodes status;
+	PartitionerNaiveConfig<int,int> config;
+	PartitionerNaiveConfig<int,int> other;
+	uint64_t hash;
+	uint64_t otherHash;
+
+	status = config.getConfigHash(&hash);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = other.getConfigHash(&otherHash);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(hash, otherHash);
+}
+
 // ======= Cleanup ========
 // Finalize MPI
 BOOST_AUTO_TEST_CASE(cleanup)
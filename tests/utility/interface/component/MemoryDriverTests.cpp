@@ -0,0 +1,106 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the Memory drivers of the utility operations
+ */
+
+#define BOOST_TEST_MODULE MemoryDrivers
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+
+#include <stdexcept>
+#include <vector>
+#include <cstdint>
+#include <unistd.h>
+
+#include "MemoryDrivers.h"
+
+using namespace cupcfd::utility::drivers;
+
+// === getCurrentRSS ===
+// Test 1: Touching a large allocation increases the resident set size
+BOOST_AUTO_TEST_CASE(getCurrentRSS_test1)
+{
+	std::size_t before = getCurrentRSS();
+	BOOST_CHECK(before > 0);
+
+	std::size_t nBytes = 64 * 1024 * 1024;
+	std::vector<char> data(nBytes, 1);
+
+	std::size_t after = getCurrentRSS();
+	BOOST_CHECK(after >= before + nBytes / 2);
+	BOOST_CHECK_EQUAL(data[nBytes - 1], 1);
+}
+
+// === getPeakRSS ===
+// Test 1: The peak is never below the current resident set size
+BOOST_AUTO_TEST_CASE(getPeakRSS_test1)
+{
+	std::size_t current = getCurrentRSS();
+	std::size_t peak = getPeakRSS();
+
+	BOOST_CHECK(current > 0);
+	BOOST_CHECK(peak >= current);
+}
+
+// === allocateAligned ===
+// Test 1: Small allocations are cache line aligned, larger ones page aligned
+BOOST_AUTO_TEST_CASE(allocateAligned_test1)
+{
+	std::size_t pageSize = (std::size_t) sysconf(_SC_PAGESIZE);
+
+	double * small = allocateAligned<double>(3);
+	BOOST_CHECK(small != nullptr);
+	BOOST_CHECK_EQUAL(((uintptr_t) small) % 64, 0);
+	small[2] = 1.5;
+	BOOST_CHECK_EQUAL(small[2], 1.5);
+	freeAligned(small);
+
+	std::size_t nEle = 4 * pageSize;
+	int * large = allocateAligned<int>(nEle);
+	BOOST_CHECK(large != nullptr);
+	BOOST_CHECK_EQUAL(((uintptr_t) large) % pageSize, 0);
+	large[nEle - 1] = 7;
+	BOOST_CHECK_EQUAL(large[nEle - 1], 7);
+	freeAligned(large);
+
+	BOOST_CHECK(allocateAligned<int>(0) == nullptr);
+	freeAligned(nullptr);
+}
+
+// === getPageNodes ===
+// Test 1: Every page of an allocation is touched by allocateAligned, so is placed on a node
+BOOST_AUTO_TEST_CASE(getPageNodes_test1)
+{
+	cupcfd::error::eCodes status;
+	std::size_t pageSize = (std::size_t) sysconf(_SC_PAGESIZE);
+	std::size_t nPages = 64;
+
+	char * data = allocateAligned<char>(nPages * pageSize);
+
+	std::vector<std::size_t> nodePages;
+	std::size_t nUnplaced = 0;
+	status = getPageNodes(data, nPages * pageSize, nodePages, &nUnplaced);
+
+	// The query is unavailable on kernels built without NUMA support
+	if(status == cupcfd::error::E_SUCCESS) {
+		std::size_t nPlaced = 0;
+		for(std::size_t i = 0; i < nodePages.size(); i++) {
+			nPlaced = nPlaced + nodePages[i];
+		}
+
+		BOOST_CHECK_EQUAL(nPlaced, nPages);
+		BOOST_CHECK_EQUAL(nUnplaced, 0);
+	}
+	else {
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_ERROR);
+	}
+
+	freeAligned(data);
+}